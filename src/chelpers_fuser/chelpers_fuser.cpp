@@ -0,0 +1,478 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+using namespace std;
+
+/*
+    Chelpers fuser
+
+    Offline pass over a chelpers parser (e.g. zkevm.chelpers.step42ns.parser.cpp) and its op stream
+    (e.g. op42[] in zkevm.chelpers.step42ns.parser.hpp), that generates a header with:
+    - a fused op stream, where the most frequent op sequences are replaced by superinstructions, so
+      that every row batch dispatches fewer times; the args stream is not changed, since the ops of a
+      superinstruction consume their args in the same order
+    - the fused parser, <functionName>_fused(), a copy of the original parser with one more case per
+      superinstruction, whose body is the concatenation of the bodies of its ops
+    - a profiler, <functionName>_profile(), a copy of the original parser that executes the op stream
+      of a sample of rows in a single thread and logs the number of calls and cycles per op type
+
+    The generated header must be included at the end of the parser cpp file, since the op and args
+    arrays are defined in the parser hpp file, that can only be included once.
+
+    Usage: chelpersFuser <parser.cpp> <parser.hpp> <functionName> <output.hpp> [superinstructions] [maxLength]
+*/
+
+#define DEFAULT_SUPERINSTRUCTIONS 64
+#define DEFAULT_MAX_LENGTH 8
+#define MAX_EXPANDED_LENGTH 32 // Maximum number of original ops of a superinstruction, to limit the code size
+#define MIN_SAVED_DISPATCHES 16 // Superinstructions that save less dispatches per row batch are not worth the code size
+
+// Forward declaration
+bool file2string (const string &fileName, string &s);
+void string2file (const string & s, const string & fileName);
+bool parseOps (const string &header, string &opsName, vector<uint64_t> &ops);
+bool findFunction (const string &code, const string &functionName, size_t &begin, size_t &end);
+size_t matchBrace (const string &code, size_t openPos);
+bool parseCases (const string &function, const string &opsName, map<uint64_t, string> &cases, size_t &defaultPos);
+void expand (const map<uint64_t, vector<uint64_t>> &superinstructions, uint64_t op, vector<uint64_t> &expanded);
+bool replaceOnce (string &s, const string &from, const string &to);
+string string2upper (const string &s);
+uint64_t opsHash (const vector<uint64_t> &ops);
+
+int main(int argc, char **argv)
+{
+    cout << "Chelpers fuser" << endl;
+
+    if ((argc != 5) && (argc != 6) && (argc != 7))
+    {
+        cerr << "Usage: chelpersFuser <parser.cpp> <parser.hpp> <functionName> <output.hpp> [superinstructions] [maxLength]" << endl;
+        return -1;
+    }
+    string parserFileName = argv[1];
+    string headerFileName = argv[2];
+    string functionName = argv[3];
+    string outputFileName = argv[4];
+    uint64_t nSuperinstructions = (argc >= 6) ? strtoull(argv[5], NULL, 10) : DEFAULT_SUPERINSTRUCTIONS;
+    uint64_t maxLength = (argc >= 7) ? strtoull(argv[6], NULL, 10) : DEFAULT_MAX_LENGTH;
+
+    // Load the op stream
+    string header;
+    if (!file2string(headerFileName, header))
+    {
+        return -1;
+    }
+    string opsName;
+    vector<uint64_t> ops;
+    if (!parseOps(header, opsName, ops))
+    {
+        cerr << "Error: Chelpers fuser could not find the ops array in " << headerFileName << endl;
+        return -1;
+    }
+    cout << "Loaded " << opsName << " with " << ops.size() << " ops from " << headerFileName << endl;
+
+    // Load the parser function and the body of every op
+    string code;
+    if (!file2string(parserFileName, code))
+    {
+        return -1;
+    }
+    size_t functionBegin, functionEnd;
+    if (!findFunction(code, functionName, functionBegin, functionEnd))
+    {
+        cerr << "Error: Chelpers fuser could not find function " << functionName << " in " << parserFileName << endl;
+        return -1;
+    }
+    string function = code.substr(functionBegin, functionEnd - functionBegin);
+    map<uint64_t, string> cases;
+    size_t defaultPos;
+    if (!parseCases(function, opsName, cases, defaultPos))
+    {
+        cerr << "Error: Chelpers fuser could not parse the switch cases of function " << functionName << endl;
+        return -1;
+    }
+    for (uint64_t i=0; i<ops.size(); i++)
+    {
+        if (cases.find(ops[i]) == cases.end())
+        {
+            cerr << "Error: Chelpers fuser found op=" << ops[i] << " at position=" << i << " without a case in function " << functionName << endl;
+            return -1;
+        }
+    }
+    cout << "Parsed " << cases.size() << " op cases from " << functionName << endl;
+
+    // Greedily create the superinstruction that saves more dispatches, and replace its occurrences
+    uint64_t nextOp = cases.rbegin()->first + 1;
+    map<uint64_t, vector<uint64_t>> superinstructions;
+    vector<uint64_t> fused = ops;
+    for (uint64_t s=0; s<nSuperinstructions; s++)
+    {
+        vector<uint64_t> bestSequence;
+        uint64_t bestSaved = 0;
+        for (uint64_t length=2; length<=maxLength; length++)
+        {
+            // Count non-overlapping occurrences, left to right
+            map<vector<uint64_t>, uint64_t> counters;
+            map<vector<uint64_t>, uint64_t> lastEnd;
+            for (uint64_t i=0; i+length<=fused.size(); i++)
+            {
+                vector<uint64_t> sequence(fused.begin() + i, fused.begin() + i + length);
+                map<vector<uint64_t>, uint64_t>::iterator it = lastEnd.find(sequence);
+                if ((it != lastEnd.end()) && (i < it->second))
+                {
+                    continue;
+                }
+                lastEnd[sequence] = i + length;
+                counters[sequence]++;
+            }
+            map<vector<uint64_t>, uint64_t>::iterator it;
+            for (it=counters.begin(); it!=counters.end(); it++)
+            {
+                uint64_t saved = it->second*(length - 1);
+                if (saved <= bestSaved)
+                {
+                    continue;
+                }
+                vector<uint64_t> expanded;
+                for (uint64_t i=0; i<it->first.size(); i++)
+                {
+                    expand(superinstructions, it->first[i], expanded);
+                }
+                if (expanded.size() > MAX_EXPANDED_LENGTH)
+                {
+                    continue;
+                }
+                bestSaved = saved;
+                bestSequence = it->first;
+            }
+        }
+        if (bestSaved < MIN_SAVED_DISPATCHES)
+        {
+            break;
+        }
+
+        // Replace the occurrences of the best sequence by the new superinstruction
+        vector<uint64_t> aux;
+        for (uint64_t i=0; i<fused.size(); )
+        {
+            if ((i + bestSequence.size() <= fused.size()) && equal(bestSequence.begin(), bestSequence.end(), fused.begin() + i))
+            {
+                aux.push_back(nextOp);
+                i += bestSequence.size();
+            }
+            else
+            {
+                aux.push_back(fused[i]);
+                i++;
+            }
+        }
+        fused = aux;
+        superinstructions[nextOp] = bestSequence;
+
+        string sequenceString;
+        for (uint64_t i=0; i<bestSequence.size(); i++) sequenceString += (i == 0 ? "" : ",") + to_string(bestSequence[i]);
+        cout << "Superinstruction " << nextOp << " = " << sequenceString << " saves " << bestSaved << " dispatches, ops=" << fused.size() << endl;
+        nextOp++;
+    }
+    cout << "Fused " << ops.size() << " ops into " << fused.size() << " ops with " << superinstructions.size() << " superinstructions" << endl;
+
+    string fusedName = functionName + "_fused";
+    string profileName = functionName + "_profile";
+    string fusedOpsName = fusedName + "_ops";
+    string fusedOpsDefine = string2upper(fusedName) + "_NOPS";
+    string opsDefine = "NOPS_";
+
+    string out;
+    out += "// Generated by chelpersFuser from " + parserFileName + " and " + headerFileName + "; do not edit\n";
+    out += "// Must be included at the end of " + parserFileName + "\n\n";
+    out += "#include <vector>\n";
+    out += "#include <algorithm>\n";
+    out += "#include <x86intrin.h>\n";
+    out += "#include \"zklog.hpp\"\n";
+    out += "#include \"exit_process.hpp\"\n\n";
+
+    // Original op stream fingerprint, to detect that the parser files were regenerated without fusing them again
+    out += "#define " + string2upper(fusedName) + "_SOURCE_NOPS " + to_string(ops.size()) + "\n";
+    out += "#define " + string2upper(fusedName) + "_SOURCE_HASH " + to_string(opsHash(ops)) + "ULL\n";
+    out += "#define " + fusedOpsDefine + " " + to_string(fused.size()) + "\n\n";
+
+    // Superinstructions, as sequences of original ops
+    for (map<uint64_t, vector<uint64_t>>::iterator it=superinstructions.begin(); it!=superinstructions.end(); it++)
+    {
+        vector<uint64_t> expanded;
+        expand(superinstructions, it->first, expanded);
+        out += "// " + to_string(it->first) + " =";
+        for (uint64_t i=0; i<expanded.size(); i++) out += " " + to_string(expanded[i]);
+        out += "\n";
+    }
+    out += "\n";
+
+    out += "uint64_t " + fusedOpsName + "[" + fusedOpsDefine + "] = {";
+    for (uint64_t i=0; i<fused.size(); i++)
+    {
+        out += (i == 0 ? " " : ", ") + to_string(fused[i]);
+    }
+    out += " };\n\n";
+
+    // Fused parser: the original function with the fused op stream and the superinstruction cases
+    string fusedFunction = function;
+    if (!replaceOnce(fusedFunction, "::" + functionName + "(", "::" + fusedName + "(") ||
+        !replaceOnce(fusedFunction, "kk < " + opsDefine, "kk < " + fusedOpsDefine) ||
+        !replaceOnce(fusedFunction, "switch (" + opsName + "[kk])", "switch (" + fusedOpsName + "[kk])"))
+    {
+        cerr << "Error: Chelpers fuser could not adapt function " << functionName << " to the fused op stream" << endl;
+        return -1;
+    }
+    string superCases;
+    for (map<uint64_t, vector<uint64_t>>::iterator it=superinstructions.begin(); it!=superinstructions.end(); it++)
+    {
+        vector<uint64_t> expanded;
+        expand(superinstructions, it->first, expanded);
+        superCases += "               case " + to_string(it->first) + ":\n";
+        superCases += "               {\n";
+        for (uint64_t i=0; i<expanded.size(); i++)
+        {
+            superCases += "                    // " + to_string(expanded[i]) + "\n";
+            superCases += "                    {\n" + cases[expanded[i]] + "\n                    }\n";
+        }
+        superCases += "                    break;\n";
+        superCases += "               }\n";
+    }
+    size_t fusedDefaultPos = fusedFunction.rfind("default:");
+    fusedDefaultPos = fusedFunction.rfind('\n', fusedDefaultPos) + 1;
+    fusedFunction.insert(fusedDefaultPos, superCases);
+
+    // Check that the op stream has not changed since it was fused
+    string check;
+    check += "\n";
+    check += "     if ((NOPS_ != " + string2upper(fusedName) + "_SOURCE_NOPS) || (chelpersOpsHash(" + opsName + ", NOPS_) != " + string2upper(fusedName) + "_SOURCE_HASH))\n";
+    check += "     {\n";
+    check += "          zklog.error(\"ZkevmSteps::" + fusedName + "() found that " + opsName + " changed after it was fused; run chelpersFuser again\");\n";
+    check += "          exitProcess();\n";
+    check += "     }\n";
+    fusedFunction.insert(fusedFunction.find('{') + 1, check);
+
+    out += "#ifndef CHELPERS_OPS_HASH\n";
+    out += "#define CHELPERS_OPS_HASH\n";
+    out += "static inline uint64_t chelpersOpsHash (const uint64_t * pOps, uint64_t nOps)\n";
+    out += "{\n";
+    out += "     uint64_t hash = 14695981039346656037ULL;\n";
+    out += "     for (uint64_t i = 0; i < nOps; i++)\n";
+    out += "     {\n";
+    out += "          hash = (hash ^ pOps[i]) * 1099511628211ULL;\n";
+    out += "     }\n";
+    out += "     return hash;\n";
+    out += "}\n";
+    out += "#endif\n\n";
+
+    out += fusedFunction + "\n\n";
+
+    // Profiler: the original function executed in one thread on a sample of rows, timing every op
+    string profileFunction = function;
+    if (!replaceOnce(profileFunction, "::" + functionName + "(", "::" + profileName + "(") ||
+        !replaceOnce(profileFunction, "#pragma omp parallel for", "") ||
+        !replaceOnce(profileFunction, "i < nrows;", "i < profileRows;"))
+    {
+        cerr << "Error: Chelpers fuser could not adapt function " << functionName << " to the profiler" << endl;
+        return -1;
+    }
+    map<uint64_t, string>::reverse_iterator rit;
+    for (rit=cases.rbegin(); rit!=cases.rend(); rit++)
+    {
+        // Cases are replaced from the last one, so that the positions of the previous ones do not change
+        string caseLabel = "case " + to_string(rit->first) + ":";
+        size_t pos = profileFunction.find(caseLabel);
+        size_t open = profileFunction.find('{', pos);
+        size_t close = matchBrace(profileFunction, open);
+        string body;
+        body += "{\n";
+        body += "                    uint64_t profileStart = __rdtsc();\n";
+        body += "                    {\n" + rit->second + "\n                    }\n";
+        body += "                    profileCycles[" + to_string(rit->first) + "] += __rdtsc() - profileStart;\n";
+        body += "                    profileCalls[" + to_string(rit->first) + "]++;\n";
+        body += "                    break;\n";
+        body += "               }";
+        profileFunction.replace(open, close - open + 1, body);
+    }
+    uint64_t nCases = cases.rbegin()->first + 1;
+    string profileInit;
+    profileInit += "\n";
+    profileInit += "     uint64_t profileRows = nrows < " + string2upper(profileName) + "_ROWS ? nrows : " + string2upper(profileName) + "_ROWS;\n";
+    profileInit += "     uint64_t profileCycles[" + to_string(nCases) + "] = {0};\n";
+    profileInit += "     uint64_t profileCalls[" + to_string(nCases) + "] = {0};\n";
+    profileFunction.insert(profileFunction.find('{') + 1, profileInit);
+
+    string profileLog;
+    profileLog += "\n";
+    profileLog += "     uint64_t profileTotal = 0;\n";
+    profileLog += "     for (uint64_t op = 0; op < " + to_string(nCases) + "; op++) profileTotal += profileCycles[op];\n";
+    profileLog += "     zklog.info(\"ZkevmSteps::" + profileName + "() rows=\" + to_string(profileRows) + \" ops=\" + to_string(NOPS_) + \" cycles=\" + to_string(profileTotal) + \" per op type, sorted by cycles:\");\n";
+    profileLog += "     vector<pair<uint64_t, uint64_t>> profileSorted;\n";
+    profileLog += "     for (uint64_t op = 0; op < " + to_string(nCases) + "; op++) if (profileCalls[op] > 0) profileSorted.push_back(pair<uint64_t, uint64_t>(profileCycles[op], op));\n";
+    profileLog += "     sort(profileSorted.rbegin(), profileSorted.rend());\n";
+    profileLog += "     for (uint64_t i = 0; i < profileSorted.size(); i++)\n";
+    profileLog += "     {\n";
+    profileLog += "          uint64_t op = profileSorted[i].second;\n";
+    profileLog += "          zklog.info(\"    op=\" + to_string(op) + \" calls=\" + to_string(profileCalls[op]) + \" cycles=\" + to_string(profileCycles[op]) + \" cycles/call=\" + to_string(double(profileCycles[op])/profileCalls[op]) + \" share=\" + to_string(double(profileCycles[op])*100/(profileTotal == 0 ? 1 : profileTotal)) + \"%\");\n";
+    profileLog += "     }\n";
+    profileFunction.insert(profileFunction.rfind('}'), profileLog);
+
+    out += "#define " + string2upper(profileName) + "_ROWS 4096 // Rows executed by the profiler\n\n";
+    out += profileFunction + "\n";
+
+    string2file(out, outputFileName);
+    cout << "Generated " << outputFileName << endl;
+
+    return 0;
+}
+
+bool file2string (const string &fileName, string &s)
+{
+    ifstream inputStream(fileName);
+    if (!inputStream.good())
+    {
+        cerr << "Error: Chelpers fuser failed loading file " << fileName << endl;
+        return false;
+    }
+    stringstream buffer;
+    buffer << inputStream.rdbuf();
+    s = buffer.str();
+    inputStream.close();
+    return true;
+}
+
+void string2file (const string & s, const string & fileName)
+{
+    ofstream outfile;
+    outfile.open(fileName);
+    outfile << s << endl;
+    outfile.close();
+}
+
+// Parses the first "uint64_t op...[...] = { ... };" array of the header
+bool parseOps (const string &header, string &opsName, vector<uint64_t> &ops)
+{
+    size_t pos = header.find("uint64_t op");
+    if (pos == string::npos) return false;
+    size_t nameBegin = pos + 9;
+    size_t nameEnd = header.find('[', nameBegin);
+    size_t open = header.find('{', nameBegin);
+    size_t close = header.find('}', nameBegin);
+    if ((nameEnd == string::npos) || (open == string::npos) || (close == string::npos) || (nameEnd > open) || (open > close)) return false;
+    opsName = header.substr(nameBegin, nameEnd - nameBegin);
+    stringstream values(header.substr(open + 1, close - open - 1));
+    string value;
+    while (getline(values, value, ','))
+    {
+        size_t first = value.find_first_not_of(" \t\r\n");
+        if (first == string::npos) continue;
+        ops.push_back(strtoull(value.c_str() + first, NULL, 10));
+    }
+    return ops.size() > 0;
+}
+
+// Returns the position of the closing brace that matches the opening brace at openPos
+size_t matchBrace (const string &code, size_t openPos)
+{
+    uint64_t depth = 0;
+    for (size_t i=openPos; i<code.size(); i++)
+    {
+        if (code[i] == '{') depth++;
+        else if (code[i] == '}')
+        {
+            depth--;
+            if (depth == 0) return i;
+        }
+    }
+    return string::npos;
+}
+
+bool findFunction (const string &code, const string &functionName, size_t &begin, size_t &end)
+{
+    begin = code.find("void ZkevmSteps::" + functionName + "(");
+    if (begin == string::npos) return false;
+    size_t open = code.find('{', begin);
+    if (open == string::npos) return false;
+    end = matchBrace(code, open);
+    if (end == string::npos) return false;
+    end++;
+    return true;
+}
+
+// Gets the body of every "case N: { ... break; }" of the switch, without the break
+bool parseCases (const string &function, const string &opsName, map<uint64_t, string> &cases, size_t &defaultPos)
+{
+    size_t switchPos = function.find("switch (" + opsName + "[kk])");
+    if (switchPos == string::npos) return false;
+    size_t switchOpen = function.find('{', switchPos);
+    size_t switchClose = matchBrace(function, switchOpen);
+    defaultPos = function.find("default:", switchOpen);
+    if ((switchClose == string::npos) || (defaultPos == string::npos) || (defaultPos > switchClose)) return false;
+
+    size_t pos = switchOpen;
+    while (true)
+    {
+        pos = function.find("case ", pos);
+        if ((pos == string::npos) || (pos > defaultPos)) break;
+        size_t colon = function.find(':', pos);
+        uint64_t op = strtoull(function.c_str() + pos + 5, NULL, 10);
+        size_t open = function.find('{', colon);
+        size_t close = matchBrace(function, open);
+        if (close == string::npos) return false;
+        string body = function.substr(open + 1, close - open - 1);
+        size_t breakPos = body.rfind("break;");
+        if (breakPos == string::npos) return false;
+        body = body.substr(0, breakPos);
+        while ((body.size() > 0) && ((body.back() == ' ') || (body.back() == '\n') || (body.back() == '\t'))) body.pop_back();
+        while ((body.size() > 0) && (body[0] == '\n')) body.erase(0, 1);
+        cases[op] = body;
+        pos = close;
+    }
+    return cases.size() > 0;
+}
+
+// Appends the original ops of op, expanding superinstructions recursively
+void expand (const map<uint64_t, vector<uint64_t>> &superinstructions, uint64_t op, vector<uint64_t> &expanded)
+{
+    map<uint64_t, vector<uint64_t>>::const_iterator it = superinstructions.find(op);
+    if (it == superinstructions.end())
+    {
+        expanded.push_back(op);
+        return;
+    }
+    for (uint64_t i=0; i<it->second.size(); i++)
+    {
+        expand(superinstructions, it->second[i], expanded);
+    }
+}
+
+bool replaceOnce (string &s, const string &from, const string &to)
+{
+    size_t pos = s.find(from);
+    if (pos == string::npos) return false;
+    s.replace(pos, from.size(), to);
+    return true;
+}
+
+string string2upper (const string &s)
+{
+    string result = s;
+    transform(result.begin(), result.end(), result.begin(), ::toupper);
+    return result;
+}
+
+// FNV-1a of the ops, the same as chelpersOpsHash() in the generated code
+uint64_t opsHash (const vector<uint64_t> &ops)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (uint64_t i=0; i<ops.size(); i++)
+    {
+        hash = (hash ^ ops[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
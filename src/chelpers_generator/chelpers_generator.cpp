@@ -0,0 +1,539 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <cstdlib>
+
+using namespace std;
+
+/*
+    Chelpers generator
+
+    Offline pass over the AVX chelpers parsers of a circuit (e.g. zkevm.chelpers.step42ns.parser.cpp
+    and its op and args arrays in zkevm.chelpers.step42ns.parser.hpp), that generates:
+    - a binary file (e.g. zkevm.chelpers.bin) with the op and args streams of every step, loaded at
+      runtime by ChelpersBinary, so that a circuit change does not require recompiling the prover
+    - the generic evaluator chelpers_generic_avx.cpp, whose switch contains every distinct case body
+      of all the parsers (the ISA), with the args array renamed to args and the constant polynomials
+      accessed through a pConstPols pointer, selected at runtime by the step flags
+
+    The op numbers of the parsers are different in every step, so they are translated to ISA ops.
+    If the evaluator file already exists, its ISA is loaded first and new case bodies are appended
+    to it, so that the op numbers of existing binary files are still valid; the evaluator only
+    changes, and the prover only needs to be recompiled, if a step introduces a new case body.
+
+    Every step is given as <stepName>:<parser.cpp>:<parser.hpp>, and its parser function must be
+    ZkevmSteps::<stepName>_parser_first_avx().
+
+    Usage: chelpersGenerator <chelpers_generic_avx.cpp> <output.bin> <stepName>:<parser.cpp>:<parser.hpp> [...]
+*/
+
+#define CHELPERS_BINARY_MAGIC 0x504C4548435A4BULL // Must match chelpers_binary.hpp
+#define CHELPERS_BINARY_VERSION 1
+#define CHELPERS_STEP_FLAG_EXTENDED 0x1
+
+class Step
+{
+public:
+    string name;
+    uint64_t nTemp1;
+    uint64_t nTemp3;
+    uint64_t flags;
+    vector<uint64_t> ops; // ISA ops
+    vector<uint64_t> args;
+};
+
+// Forward declaration
+bool file2string (const string &fileName, string &s, bool bQuiet = false);
+void string2file (const string & s, const string & fileName);
+bool parseArray (const string &header, const string &prefix, string &name, vector<uint64_t> &values);
+bool parseDefine (const string &header, const string &name, uint64_t &value);
+bool findFunction (const string &code, const string &signature, size_t &begin, size_t &end);
+size_t matchBrace (const string &code, size_t openPos);
+bool parseCases (const string &function, const string &opsName, map<uint64_t, string> &cases);
+void replaceAll (string &s, const string &from, const string &to);
+string normalizeBody (const string &body, const string &argsName);
+string bodyKey (const string &body);
+uint64_t bodyArgs (const string &key);
+uint64_t isaHash (const vector<string> &keys);
+void pushU64 (string &s, uint64_t value);
+void pad8 (string &s);
+
+int main(int argc, char **argv)
+{
+    cout << "Chelpers generator" << endl;
+
+    if (argc < 4)
+    {
+        cerr << "Usage: chelpersGenerator <chelpers_generic_avx.cpp> <output.bin> <stepName>:<parser.cpp>:<parser.hpp> [...]" << endl;
+        return -1;
+    }
+    string evaluatorFileName = argv[1];
+    string binaryFileName = argv[2];
+
+    // Load the ISA of the existing evaluator, if any
+    vector<string> isaBodies;
+    vector<string> isaKeys;
+    map<string, uint64_t> isaMap;
+    string evaluator;
+    if (file2string(evaluatorFileName, evaluator, true))
+    {
+        size_t begin, end;
+        map<uint64_t, string> cases;
+        if (!findFunction(evaluator, "void chelpersGenericAvx (", begin, end) || !parseCases(evaluator.substr(begin, end - begin), "ops", cases))
+        {
+            cerr << "Error: Chelpers generator could not parse the ISA of " << evaluatorFileName << endl;
+            return -1;
+        }
+        for (map<uint64_t, string>::iterator it=cases.begin(); it!=cases.end(); it++)
+        {
+            if (it->first != isaBodies.size())
+            {
+                cerr << "Error: Chelpers generator found a gap before op=" << it->first << " in " << evaluatorFileName << endl;
+                return -1;
+            }
+            string body = normalizeBody(it->second, "args");
+            string key = bodyKey(body);
+            isaMap[key] = isaBodies.size();
+            isaBodies.push_back(body);
+            isaKeys.push_back(key);
+        }
+        cout << "Loaded ISA with " << isaBodies.size() << " ops from " << evaluatorFileName << endl;
+    }
+    uint64_t initialIsaSize = isaBodies.size();
+
+    // Parse every step, translating its ops to ISA ops
+    vector<Step> steps;
+    string stepNames;
+    for (int a=3; a<argc; a++)
+    {
+        string arg = argv[a];
+        size_t colon1 = arg.find(':');
+        size_t colon2 = (colon1 == string::npos) ? string::npos : arg.find(':', colon1 + 1);
+        if (colon2 == string::npos)
+        {
+            cerr << "Error: Chelpers generator expected <stepName>:<parser.cpp>:<parser.hpp> but got " << arg << endl;
+            return -1;
+        }
+        Step step;
+        step.name = arg.substr(0, colon1);
+        string parserFileName = arg.substr(colon1 + 1, colon2 - colon1 - 1);
+        string headerFileName = arg.substr(colon2 + 1);
+        string functionName = step.name + "_parser_first_avx";
+
+        string header;
+        if (!file2string(headerFileName, header))
+        {
+            return -1;
+        }
+        string opsName, argsName;
+        vector<uint64_t> ops;
+        if (!parseArray(header, "op", opsName, ops) ||
+            !parseArray(header, "args", argsName, step.args) ||
+            !parseDefine(header, "NTEMP1_", step.nTemp1) ||
+            !parseDefine(header, "NTEMP3_", step.nTemp3))
+        {
+            cerr << "Error: Chelpers generator could not find the ops, args, NTEMP1_ or NTEMP3_ in " << headerFileName << endl;
+            return -1;
+        }
+
+        string code;
+        if (!file2string(parserFileName, code))
+        {
+            return -1;
+        }
+        size_t begin, end;
+        if (!findFunction(code, "void ZkevmSteps::" + functionName + "(", begin, end))
+        {
+            cerr << "Error: Chelpers generator could not find function " << functionName << " in " << parserFileName << endl;
+            return -1;
+        }
+        string function = code.substr(begin, end - begin);
+        map<uint64_t, string> cases;
+        if (!parseCases(function, opsName, cases))
+        {
+            cerr << "Error: Chelpers generator could not parse the switch cases of function " << functionName << endl;
+            return -1;
+        }
+        step.flags = (function.find("params.pConstPols2ns->numPols()") != string::npos) ? CHELPERS_STEP_FLAG_EXTENDED : 0;
+
+        // Map every case of the step to an ISA op, appending the new ones
+        map<uint64_t, uint64_t> opMap;
+        for (map<uint64_t, string>::iterator it=cases.begin(); it!=cases.end(); it++)
+        {
+            string body = normalizeBody(it->second, argsName);
+            string key = bodyKey(body);
+            if (key.find("numpols") != string::npos && key.find("pConstPols->") == string::npos)
+            {
+                cerr << "Error: Chelpers generator found case " << it->first << " of function " << functionName << " using numpols without the constant polynomials" << endl;
+                return -1;
+            }
+            map<string, uint64_t>::iterator isaIt = isaMap.find(key);
+            if (isaIt == isaMap.end())
+            {
+                isaMap[key] = isaBodies.size();
+                opMap[it->first] = isaBodies.size();
+                isaBodies.push_back(body);
+                isaKeys.push_back(key);
+            }
+            else
+            {
+                opMap[it->first] = isaIt->second;
+            }
+        }
+
+        uint64_t nArgs = 0;
+        for (uint64_t i=0; i<ops.size(); i++)
+        {
+            map<uint64_t, uint64_t>::iterator it = opMap.find(ops[i]);
+            if (it == opMap.end())
+            {
+                cerr << "Error: Chelpers generator found op=" << ops[i] << " at position=" << i << " without a case in function " << functionName << endl;
+                return -1;
+            }
+            step.ops.push_back(it->second);
+            nArgs += bodyArgs(isaKeys[it->second]);
+        }
+        if (nArgs != step.args.size())
+        {
+            cerr << "Error: Chelpers generator found that the ops of " << step.name << " consume " << nArgs << " args but " << argsName << " has " << step.args.size() << endl;
+            return -1;
+        }
+        cout << "Parsed " << step.name << " with " << step.ops.size() << " ops, " << step.args.size() << " args and " << cases.size() << " op cases" << endl;
+        stepNames += " " + step.name;
+        steps.push_back(step);
+    }
+    if (isaBodies.size() > 0xFFFF)
+    {
+        cerr << "Error: Chelpers generator got an ISA of " << isaBodies.size() << " ops, that does not fit in 16 bits" << endl;
+        return -1;
+    }
+    uint64_t hash = isaHash(isaKeys);
+
+    // Generate the evaluator, only if the ISA changed
+    if ((isaBodies.size() != initialIsaSize) || (initialIsaSize == 0))
+    {
+        stringstream hashString;
+        hashString << "0x" << hex << hash << "ULL";
+        string out;
+        out += "// Generated by chelpersGenerator, do not edit; new ops are appended, so that existing binary files remain valid\n";
+        out += "#include <immintrin.h>\n";
+        out += "#include \"goldilocks_cubic_extension.hpp\"\n";
+        out += "#include \"zhInv.hpp\"\n";
+        out += "#include \"starks.hpp\"\n";
+        out += "#include \"constant_pols_starks.hpp\"\n";
+        out += "#include \"chelpers_binary.hpp\"\n";
+        out += "#include \"zklog.hpp\"\n";
+        out += "#include \"exit_process.hpp\"\n";
+        out += "\n";
+        out += "#define AVX_SIZE_ 4\n";
+        out += "#define CHELPERS_GENERIC_NOPS " + to_string(isaBodies.size()) + "\n";
+        out += "\n";
+        out += "const uint64_t chelpersGenericIsaHash = " + hashString.str() + ";\n";
+        out += "const uint64_t chelpersGenericNOps = CHELPERS_GENERIC_NOPS;\n";
+        out += "const uint8_t chelpersGenericOpArgs[CHELPERS_GENERIC_NOPS] = {";
+        for (uint64_t i=0; i<isaKeys.size(); i++)
+        {
+            out += string(i == 0 ? " " : ", ") + to_string(bodyArgs(isaKeys[i]));
+        }
+        out += " };\n";
+        out += "\n";
+        out += "void chelpersGenericAvx (StepsParams &params, const ChelpersStep &step, uint64_t nrows)\n";
+        out += "{\n";
+        out += "     const uint16_t *ops = step.ops;\n";
+        out += "     const uint64_t *args = step.args;\n";
+        out += "     const uint64_t nOps = step.nOps;\n";
+        out += "     ConstantPolsStarks *pConstPols = (step.flags & CHELPERS_STEP_FLAG_EXTENDED) ? params.pConstPols2ns : params.pConstPols;\n";
+        out += "     uint64_t numpols = pConstPols->numPols();\n";
+        out += "\n";
+        out += "#pragma omp parallel\n";
+        out += "     {\n";
+        out += "          // The number of temporaries is only known at runtime, so they are allocated once per thread\n";
+        out += "          __m256i *tmp1 = new __m256i[step.nTemp1];\n";
+        out += "          Goldilocks3::Element_avx *tmp3 = new Goldilocks3::Element_avx[step.nTemp3];\n";
+        out += "          uint64_t offsets1[4], offsets2[4], offsets3[4];\n";
+        out += "\n";
+        out += "#pragma omp for\n";
+        out += "          for (uint64_t i = 0; i < nrows; i += AVX_SIZE_)\n";
+        out += "          {\n";
+        out += "               uint64_t i_args = 0;\n";
+        out += "               for (uint64_t kk = 0; kk < nOps; ++kk)\n";
+        out += "               {\n";
+        out += "                    switch (ops[kk])\n";
+        out += "                    {\n";
+        for (uint64_t i=0; i<isaBodies.size(); i++)
+        {
+            out += "                    case " + to_string(i) + ":\n";
+            out += "                    {\n";
+            out += isaBodies[i];
+            out += "                         break;\n";
+            out += "                    }\n";
+        }
+        out += "                    default:\n";
+        out += "                         zklog.error(\"chelpersGenericAvx() found invalid op=\" + to_string(ops[kk]) + \" in step \" + step.name);\n";
+        out += "                         exitProcess();\n";
+        out += "                    }\n";
+        out += "               }\n";
+        out += "          }\n";
+        out += "\n";
+        out += "          delete[] tmp1;\n";
+        out += "          delete[] tmp3;\n";
+        out += "     }\n";
+        out += "}";
+        string2file(out, evaluatorFileName);
+        cout << "Generated " << evaluatorFileName << " with an ISA of " << isaBodies.size() << " ops (" << (isaBodies.size() - initialIsaSize) << " new); the prover must be recompiled" << endl;
+    }
+    else
+    {
+        cout << "The ISA of " << evaluatorFileName << " did not change; the prover does not need to be recompiled" << endl;
+    }
+
+    // Generate the binary file
+    string binary;
+    pushU64(binary, CHELPERS_BINARY_MAGIC);
+    pushU64(binary, CHELPERS_BINARY_VERSION);
+    pushU64(binary, hash);
+    pushU64(binary, steps.size());
+    for (uint64_t s=0; s<steps.size(); s++)
+    {
+        Step &step = steps[s];
+        pushU64(binary, step.name.size());
+        binary += step.name;
+        pad8(binary);
+        pushU64(binary, step.nTemp1);
+        pushU64(binary, step.nTemp3);
+        pushU64(binary, step.flags);
+        pushU64(binary, step.ops.size());
+        pushU64(binary, step.args.size());
+        for (uint64_t i=0; i<step.ops.size(); i++)
+        {
+            binary += (char)(step.ops[i] & 0xFF);
+            binary += (char)(step.ops[i] >> 8);
+        }
+        pad8(binary);
+        for (uint64_t i=0; i<step.args.size(); i++)
+        {
+            pushU64(binary, step.args[i]);
+        }
+    }
+    ofstream outfile(binaryFileName, ios::binary);
+    outfile.write(binary.data(), binary.size());
+    outfile.close();
+    if (!outfile.good())
+    {
+        cerr << "Error: Chelpers generator failed writing file " << binaryFileName << endl;
+        return -1;
+    }
+    cout << "Generated " << binaryFileName << " with " << binary.size() << " bytes and steps:" << stepNames << endl;
+
+    return 0;
+}
+
+bool file2string (const string &fileName, string &s, bool bQuiet)
+{
+    ifstream inputStream(fileName);
+    if (!inputStream.good())
+    {
+        if (!bQuiet) cerr << "Error: Chelpers generator failed loading file " << fileName << endl;
+        return false;
+    }
+    stringstream buffer;
+    buffer << inputStream.rdbuf();
+    s = buffer.str();
+    inputStream.close();
+    return true;
+}
+
+void string2file (const string & s, const string & fileName)
+{
+    ofstream outfile;
+    outfile.open(fileName);
+    outfile << s << endl;
+    outfile.close();
+}
+
+// Parses the first "uint64_t <prefix>...[...] = { ... };" array of the header
+bool parseArray (const string &header, const string &prefix, string &name, vector<uint64_t> &values)
+{
+    size_t pos = header.find("uint64_t " + prefix);
+    if (pos == string::npos) return false;
+    size_t nameBegin = pos + 9;
+    size_t nameEnd = header.find('[', nameBegin);
+    size_t open = header.find('{', nameBegin);
+    size_t close = header.find('}', nameBegin);
+    if ((nameEnd == string::npos) || (open == string::npos) || (close == string::npos) || (nameEnd > open) || (open > close)) return false;
+    name = header.substr(nameBegin, nameEnd - nameBegin);
+    stringstream stream(header.substr(open + 1, close - open - 1));
+    string value;
+    while (getline(stream, value, ','))
+    {
+        size_t first = value.find_first_not_of(" \t\r\n");
+        if (first == string::npos) continue;
+        values.push_back(strtoull(value.c_str() + first, NULL, 10));
+    }
+    return values.size() > 0;
+}
+
+bool parseDefine (const string &header, const string &name, uint64_t &value)
+{
+    size_t pos = header.find("#define " + name + " ");
+    if (pos == string::npos) return false;
+    value = strtoull(header.c_str() + pos + 9 + name.size(), NULL, 10);
+    return true;
+}
+
+// Returns the position of the closing brace that matches the opening brace at openPos
+size_t matchBrace (const string &code, size_t openPos)
+{
+    uint64_t depth = 0;
+    for (size_t i=openPos; i<code.size(); i++)
+    {
+        if (code[i] == '{') depth++;
+        else if (code[i] == '}')
+        {
+            depth--;
+            if (depth == 0) return i;
+        }
+    }
+    return string::npos;
+}
+
+bool findFunction (const string &code, const string &signature, size_t &begin, size_t &end)
+{
+    begin = code.find(signature);
+    if (begin == string::npos) return false;
+    size_t open = code.find('{', begin);
+    if (open == string::npos) return false;
+    end = matchBrace(code, open);
+    if (end == string::npos) return false;
+    end++;
+    return true;
+}
+
+// Gets the body of every "case N: { ... break; }" of the switch, without the break
+bool parseCases (const string &function, const string &opsName, map<uint64_t, string> &cases)
+{
+    size_t switchPos = function.find("switch (" + opsName + "[kk])");
+    if (switchPos == string::npos) return false;
+    size_t switchOpen = function.find('{', switchPos);
+    size_t switchClose = matchBrace(function, switchOpen);
+    size_t defaultPos = function.find("default:", switchOpen);
+    if ((switchClose == string::npos) || (defaultPos == string::npos) || (defaultPos > switchClose)) return false;
+
+    size_t pos = switchOpen;
+    while (true)
+    {
+        pos = function.find("case ", pos);
+        if ((pos == string::npos) || (pos > defaultPos)) break;
+        size_t colon = function.find(':', pos);
+        uint64_t op = strtoull(function.c_str() + pos + 5, NULL, 10);
+        size_t open = function.find('{', colon);
+        size_t close = matchBrace(function, open);
+        if (close == string::npos) return false;
+        string body = function.substr(open + 1, close - open - 1);
+        size_t breakPos = body.rfind("break;");
+        if (breakPos == string::npos) return false;
+        cases[op] = body.substr(0, breakPos);
+        pos = close;
+    }
+    return cases.size() > 0;
+}
+
+void replaceAll (string &s, const string &from, const string &to)
+{
+    size_t pos = 0;
+    while ((pos = s.find(from, pos)) != string::npos)
+    {
+        s.replace(pos, from.size(), to);
+        pos += to.size();
+    }
+}
+
+// Renames the args array and the constant polynomials, removes comment lines, and indents the body
+// for the generic evaluator switch
+string normalizeBody (const string &body, const string &argsName)
+{
+    string renamed = body;
+    if (argsName != "args") replaceAll(renamed, argsName + "[", "args[");
+    replaceAll(renamed, "params.pConstPols2ns->", "pConstPols->");
+    replaceAll(renamed, "params.pConstPols->", "pConstPols->");
+
+    vector<string> lines;
+    stringstream stream(renamed);
+    string line;
+    size_t minIndent = string::npos;
+    while (getline(stream, line))
+    {
+        size_t first = line.find_first_not_of(" \t\r");
+        if ((first == string::npos) || (line.compare(first, 2, "//") == 0)) continue;
+        while ((line.size() > 0) && ((line.back() == ' ') || (line.back() == '\r'))) line.pop_back();
+        if (first < minIndent) minIndent = first;
+        lines.push_back(line);
+    }
+    string result;
+    for (uint64_t i=0; i<lines.size(); i++)
+    {
+        result += string(25, ' ') + lines[i].substr(minIndent) + "\n";
+    }
+    return result;
+}
+
+// Key of a case body, independent of comments and white spaces
+string bodyKey (const string &body)
+{
+    string key;
+    stringstream stream(body);
+    string line;
+    while (getline(stream, line))
+    {
+        size_t comment = line.find("//");
+        if (comment != string::npos) line = line.substr(0, comment);
+        for (uint64_t i=0; i<line.size(); i++)
+        {
+            if ((line[i] != ' ') && (line[i] != '\t') && (line[i] != '\r')) key += line[i];
+        }
+    }
+    return key;
+}
+
+// Number of args consumed by a case body, i.e. the sum of its "i_args += N;"
+uint64_t bodyArgs (const string &key)
+{
+    uint64_t nArgs = 0;
+    size_t pos = 0;
+    while ((pos = key.find("i_args+=", pos)) != string::npos)
+    {
+        pos += 8;
+        nArgs += strtoull(key.c_str() + pos, NULL, 10);
+    }
+    return nArgs;
+}
+
+// FNV-1a of the ISA case bodies, in op order
+uint64_t isaHash (const vector<string> &keys)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (uint64_t i=0; i<keys.size(); i++)
+    {
+        for (uint64_t j=0; j<=keys[i].size(); j++)
+        {
+            hash = (hash ^ (uint8_t)keys[i].c_str()[j]) * 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+void pushU64 (string &s, uint64_t value)
+{
+    for (uint64_t i=0; i<8; i++)
+    {
+        s += (char)((value >> (8*i)) & 0xFF);
+    }
+}
+
+void pad8 (string &s)
+{
+    while (s.size() % 8 != 0) s += (char)0;
+}
@@ -120,6 +120,7 @@ void Config::load(json &config)
     ParseBool(config, "runExecutorClientMultithread", "RUN_EXECUTOR_CLIENT_MULTITHREAD", runExecutorClientMultithread, false);
     ParseBool(config, "runHashDBServer", "RUN_HASHDB_SERVER", runHashDBServer, true);
     ParseBool(config, "runHashDBTest", "RUN_HASHDB_TEST", runHashDBTest, false);
+    ParseBool(config, "runHashDBRemoteBatchTest", "RUN_HASHDB_REMOTE_BATCH_TEST", runHashDBRemoteBatchTest, false);
     ParseBool(config, "runAggregatorServer", "RUN_AGGREGATOR_SERVER", runAggregatorServer, false);
     ParseBool(config, "runAggregatorClient", "RUN_AGGREGATOR_CLIENT", runAggregatorClient, false);
     ParseBool(config, "runAggregatorClientMock", "RUN_AGGREGATOR_CLIENT_MOCK", runAggregatorClientMock, false);
@@ -151,9 +152,22 @@ void Config::load(json &config)
     ParseBool(config, "runKeyValueTreeTest", "RUN_KEY_VALUE_TREE_TEST", runKeyValueTreeTest, false);
     ParseBool(config, "runSMT64Test", "RUN_SMT64_TEST", runSMT64Test, false);
     ParseBool(config, "runUnitTest", "RUN_UNIT_TEST", runUnitTest, false);
+    ParseBool(config, "runFlatHashMapTest", "RUN_FLAT_HASH_MAP_TEST", runFlatHashMapTest, false);
+    ParseBool(config, "runMultiexpTest", "RUN_MULTIEXP_TEST", runMultiexpTest, false);
+    ParseBool(config, "runFFTTest", "RUN_FFT_TEST", runFFTTest, false);
+    ParseBool(config, "runDatabaseAssociativeCacheTest", "RUN_DATABASE_ASSOCIATIVE_CACHE_TEST", runDatabaseAssociativeCacheTest, false);
+    ParseBool(config, "runFRIFoldTest", "RUN_FRI_FOLD_TEST", runFRIFoldTest, false);
+    ParseBool(config, "runZkinTest", "RUN_ZKIN_TEST", runZkinTest, false);
+    ParseBool(config, "runLDEMerkleTreeTest", "RUN_LDE_MERKLE_TREE_TEST", runLDEMerkleTreeTest, false);
+    ParseBool(config, "runSharedMemoryTest", "RUN_SHARED_MEMORY_TEST", runSharedMemoryTest, false);
+    ParseBool(config, "runChelpersFusedTest", "RUN_CHELPERS_FUSED_TEST", runChelpersFusedTest, false);
 
     // Main SM executor
     ParseBool(config, "executeInParallel", "EXECUTE_IN_PARALLEL", executeInParallel, true);
+    ParseBool(config, "executeStreaming", "EXECUTE_STREAMING", executeStreaming, false);
+    ParseU64(config, "executeStreamingChunkSize", "EXECUTE_STREAMING_CHUNK_SIZE", executeStreamingChunkSize, 1024);
+    ParseU64(config, "executeStreamingQueueSize", "EXECUTE_STREAMING_QUEUE_SIZE", executeStreamingQueueSize, 64);
+    ParseU64(config, "executorPoolThreads", "EXECUTOR_POOL_THREADS", executorPoolThreads, 0);
     ParseBool(config, "useMainExecGenerated", "USE_MAIN_EXEC_GENERATED", useMainExecGenerated, true);
     //ParseBool(config, "useMainExecC", "USE_MAIN_EXEC_C", useMainExecC, false);
     useMainExecC = false; // Do not use in production; under development
@@ -196,8 +210,11 @@ void Config::load(json &config)
     ParseU64(config, "executorClientLoops", "EXECUTOR_CLIENT_LOOPS", executorClientLoops, 1);
     ParseBool(config, "executorClientCheckNewStateRoot", "EXECUTOR_CLIENT_CHECK_NEW_STATE_ROOT", executorClientCheckNewStateRoot, false);
     ParseBool(config, "executorClientResetDB", "EXECUTOR_CLIENT_RESET_DB", executorClientResetDB, false);
+    ParseBool(config, "executorClientStream", "EXECUTOR_CLIENT_STREAM", executorClientStream, false);
     ParseU16(config, "hashDBServerPort", "HASHDB_SERVER_PORT", hashDBServerPort, 50061);
     ParseString(config, "hashDBURL", "HASHDB_URL", hashDBURL, "local");
+    ParseBool(config, "hashDBRemoteBatch", "HASHDB_REMOTE_BATCH", hashDBRemoteBatch, false);
+    ParseU64(config, "hashDBRemotePrefetchKeys", "HASHDB_REMOTE_PREFETCH_KEYS", hashDBRemotePrefetchKeys, 1024);
     //ParseBool(config, "hashDB64", "HASHDB64", hashDB64, false);
     hashDB64 = false; // Do not use in production; under development
     ParseU64(config, "kvDBMaxVersions", "HASHDB64_MAX_VERSIONS", kvDBMaxVersions, 131072);
@@ -205,6 +222,8 @@ void Config::load(json &config)
     ParseString(config, "hashDBFileName", "HASHDB_FILE_NAME", hashDBFileName, "");
     ParseU64(config, "hashDBFileSize", "HASHDB_FILE_SIZE", hashDBFileSize, 128);
     ParseString(config, "hashDBFolder", "HASHDB_FOLDER", hashDBFolder, "hashdb");
+    ParseU64(config, "hashDB64WriteThreads", "HASHDB64_WRITE_THREADS", hashDB64WriteThreads, 1);
+    ParseU64(config, "hashDB64CompactionPeriod", "HASHDB64_COMPACTION_PERIOD", hashDB64CompactionPeriod, 0);
     ParseU16(config, "aggregatorServerPort", "AGGREGATOR_SERVER_PORT", aggregatorServerPort, 50081);
     ParseU16(config, "aggregatorClientPort", "AGGREGATOR_CLIENT_PORT", aggregatorClientPort, 50081);
     ParseString(config, "aggregatorClientHost", "AGGREGATOR_CLIENT_HOST", aggregatorClientHost, "127.0.0.1");
@@ -270,6 +289,16 @@ void Config::load(json &config)
     ParseString(config, "recursive1CmPols", "RECURSIVE1_CM_POLS", recursive1CmPols, "");
     ParseBool(config, "mapConstPolsFile", "MAP_CONST_POLS_FILE", mapConstPolsFile, false);
     ParseBool(config, "mapConstantsTreeFile", "MAP_CONSTANTS_TREE_FILE", mapConstantsTreeFile, false);
+    ParseBool(config, "useSharedConstants", "USE_SHARED_CONSTANTS", useSharedConstants, false);
+    ParseString(config, "sharedConstantsHugePagesPath", "SHARED_CONSTANTS_HUGE_PAGES_PATH", sharedConstantsHugePagesPath, "");
+    ParseU64(config, "sharedConstantsTimeout", "SHARED_CONSTANTS_TIMEOUT", sharedConstantsTimeout, 1800);
+    ParseBool(config, "fusedLDEAndMerkleTree", "FUSED_LDE_AND_MERKLE_TREE", fusedLDEAndMerkleTree, false);
+    ParseU64(config, "fusedLDEAndMerkleTreeTileSize", "FUSED_LDE_AND_MERKLE_TREE_TILE_SIZE", fusedLDEAndMerkleTreeTileSize, 2*1024*1024);
+    ParseBool(config, "chelpersFused", "CHELPERS_FUSED", chelpersFused, false);
+    ParseBool(config, "chelpersProfile", "CHELPERS_PROFILE", chelpersProfile, false);
+    ParseString(config, "zkevmChelpers", "ZKEVM_CHELPERS", zkevmChelpers, "");
+    ParseBool(config, "chelpersCompare", "CHELPERS_COMPARE", chelpersCompare, false);
+    ParseBool(config, "blockedFFT", "BLOCKED_FFT", blockedFFT, false);
     ParseString(config, "proofFile", "PROOF_FILE", proofFile, "proof.json");
     ParseString(config, "publicsOutput", "PUBLICS_OUTPUT", publicsOutput, "public.json");
     ParseString(config, "keccakPolsFile", "KECCAK_POLS_FILE", keccakPolsFile, "keccak_pols.json");
@@ -302,6 +331,11 @@ void Config::load(json &config)
     ParseU64(config, "maxExecutorThreads", "MAX_EXECUTOR_THREADS", maxExecutorThreads, 20);
     ParseU64(config, "maxProverThreads", "MAX_PROVER_THREADS", maxProverThreads, 8);
     ParseU64(config, "maxHashDBThreads", "MAX_HASHDB_THREADS", maxHashDBThreads, 8);
+    ParseU64(config, "proverPriorityBatchProof", "PROVER_PRIORITY_BATCH_PROOF", proverPriorityBatchProof, 0);
+    ParseU64(config, "proverPriorityAggregatedProof", "PROVER_PRIORITY_AGGREGATED_PROOF", proverPriorityAggregatedProof, 1);
+    ParseU64(config, "proverPriorityFinalProof", "PROVER_PRIORITY_FINAL_PROOF", proverPriorityFinalProof, 2);
+    ParseU64(config, "proverRequestAgingPeriod", "PROVER_REQUEST_AGING_PERIOD", proverRequestAgingPeriod, 600);
+    ParseU64(config, "proverPipelineMemory", "PROVER_PIPELINE_MEMORY", proverPipelineMemory, 0);
 
     // Prover name, name of this instance as per configuration
     ParseString(config, "proverName", "PROVER_NAME", proverName, "UNSPECIFIED");
@@ -333,6 +367,8 @@ void Config::print(void)
     zklog.info("    runHashDBServer=" + to_string(runHashDBServer));
     if (runHashDBTest)
         zklog.info("    runHashDBTest=true");
+    if (runHashDBRemoteBatchTest)
+        zklog.info("    runHashDBRemoteBatchTest=true");
     if (runAggregatorServer)
         zklog.info("    runAggregatorServer=true");
     zklog.info("    runAggregatorClient=" + to_string(runAggregatorClient));
@@ -388,8 +424,30 @@ void Config::print(void)
         zklog.info("    runSMT64Test=true");
     if (runUnitTest)
         zklog.info("    runUnitTest=true");
+    if (runFlatHashMapTest)
+        zklog.info("    runFlatHashMapTest=true");
+    if (runMultiexpTest)
+        zklog.info("    runMultiexpTest=true");
+    if (runFFTTest)
+        zklog.info("    runFFTTest=true");
+    if (runDatabaseAssociativeCacheTest)
+        zklog.info("    runDatabaseAssociativeCacheTest=true");
+    if (runFRIFoldTest)
+        zklog.info("    runFRIFoldTest=true");
+    if (runZkinTest)
+        zklog.info("    runZkinTest=true");
+    if (runLDEMerkleTreeTest)
+        zklog.info("    runLDEMerkleTreeTest=true");
+    if (runSharedMemoryTest)
+        zklog.info("    runSharedMemoryTest=true");
+    if (runChelpersFusedTest)
+        zklog.info("    runChelpersFusedTest=true");
 
     zklog.info("    executeInParallel=" + to_string(executeInParallel));
+    zklog.info("    executeStreaming=" + to_string(executeStreaming));
+    zklog.info("    executeStreamingChunkSize=" + to_string(executeStreamingChunkSize));
+    zklog.info("    executeStreamingQueueSize=" + to_string(executeStreamingQueueSize));
+    zklog.info("    executorPoolThreads=" + to_string(executorPoolThreads));
     zklog.info("    useMainExecGenerated=" + to_string(useMainExecGenerated));
     zklog.info("    useMainExecC=" + to_string(useMainExecC));
 
@@ -440,14 +498,19 @@ void Config::print(void)
     zklog.info("    executorClientLoops=" + to_string(executorClientLoops));
     zklog.info("    executorClientCheckNewStateRoot=" + to_string(executorClientCheckNewStateRoot));
     zklog.info("    executorClientResetDB=" + to_string(executorClientResetDB));
+    zklog.info("    executorClientStream=" + to_string(executorClientStream));
     zklog.info("    hashDBServerPort=" + to_string(hashDBServerPort));
     zklog.info("    hashDBURL=" + hashDBURL);
+    zklog.info("    hashDBRemoteBatch=" + to_string(hashDBRemoteBatch));
+    zklog.info("    hashDBRemotePrefetchKeys=" + to_string(hashDBRemotePrefetchKeys));
     zklog.info("    hashDB64=" + to_string(hashDB64));
     zklog.info("    kvDBMaxVersions=" + to_string(kvDBMaxVersions));
     zklog.info("    dbCacheSynchURL=" + dbCacheSynchURL);
     zklog.info("    hashDBFileName=" + hashDBFileName);
     zklog.info("    hashDBFileSize=" + to_string(hashDBFileSize));
     zklog.info("    hastDBFolder=" + hashDBFolder);
+    zklog.info("    hashDB64WriteThreads=" + to_string(hashDB64WriteThreads));
+    zklog.info("    hashDB64CompactionPeriod=" + to_string(hashDB64CompactionPeriod));
     zklog.info("    aggregatorServerPort=" + to_string(aggregatorServerPort));
     zklog.info("    aggregatorClientPort=" + to_string(aggregatorClientPort));
     zklog.info("    aggregatorClientHost=" + aggregatorClientHost);
@@ -469,6 +532,16 @@ void Config::print(void)
     zklog.info("    zkevmConstantsTree=" + zkevmConstantsTree);
     zklog.info("    c12aConstantsTree=" + c12aConstantsTree);
     zklog.info("    mapConstantsTreeFile=" + to_string(mapConstantsTreeFile));
+    zklog.info("    useSharedConstants=" + to_string(useSharedConstants));
+    zklog.info("    sharedConstantsHugePagesPath=" + sharedConstantsHugePagesPath);
+    zklog.info("    sharedConstantsTimeout=" + to_string(sharedConstantsTimeout));
+    zklog.info("    fusedLDEAndMerkleTree=" + to_string(fusedLDEAndMerkleTree));
+    zklog.info("    fusedLDEAndMerkleTreeTileSize=" + to_string(fusedLDEAndMerkleTreeTileSize));
+    zklog.info("    chelpersFused=" + to_string(chelpersFused));
+    zklog.info("    chelpersProfile=" + to_string(chelpersProfile));
+    zklog.info("    zkevmChelpers=" + zkevmChelpers);
+    zklog.info("    chelpersCompare=" + to_string(chelpersCompare));
+    zklog.info("    blockedFFT=" + to_string(blockedFFT));
     zklog.info("    finalVerkey=" + finalVerkey);
     zklog.info("    zkevmVerifier=" + zkevmVerifier);
     zklog.info("    zkevmVerkey=" + zkevmVerkey);
@@ -511,6 +584,11 @@ void Config::print(void)
     zklog.info("    maxExecutorThreads=" + to_string(maxExecutorThreads));
     zklog.info("    maxProverThreads=" + to_string(maxProverThreads));
     zklog.info("    maxHashDBThreads=" + to_string(maxHashDBThreads));
+    zklog.info("    proverPriorityBatchProof=" + to_string(proverPriorityBatchProof));
+    zklog.info("    proverPriorityAggregatedProof=" + to_string(proverPriorityAggregatedProof));
+    zklog.info("    proverPriorityFinalProof=" + to_string(proverPriorityFinalProof));
+    zklog.info("    proverRequestAgingPeriod=" + to_string(proverRequestAgingPeriod));
+    zklog.info("    proverPipelineMemory=" + to_string(proverPipelineMemory));
     zklog.info("    dbMTCacheSize=" + to_string(dbMTCacheSize));
     zklog.info("    useAssociativeCache=" + to_string(useAssociativeCache));
     zklog.info("    log2DbMTAssociativeCacheSize=" + to_string(log2DbMTAssociativeCacheSize));
@@ -648,6 +726,11 @@ bool Config::check (void)
             zklog.error("required file config.zkevmStarkInfo=" + zkevmStarkInfo + " does not exist");
             bError = true;
         }
+        if ((zkevmChelpers.size() > 0) && !fileExists(zkevmChelpers))
+        {
+            zklog.error("required file config.zkevmChelpers=" + zkevmChelpers + " does not exist");
+            bError = true;
+        }
         if (!fileExists(c12aStarkInfo))
         {
             zklog.error("required file config.c12aStarkInfo=" + c12aStarkInfo + " does not exist");
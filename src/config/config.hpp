@@ -19,6 +19,7 @@ public:
     bool runExecutorClientMultithread;
     bool runHashDBServer;
     bool runHashDBTest;
+    bool runHashDBRemoteBatchTest;
     bool runAggregatorServer;
     bool runAggregatorClient;
     bool runAggregatorClientMock;
@@ -48,8 +49,21 @@ public:
     bool runKeyValueTreeTest;
     bool runSMT64Test;
     bool runUnitTest;
+    bool runFlatHashMapTest;
+    bool runMultiexpTest;
+    bool runFFTTest;
+    bool runDatabaseAssociativeCacheTest;
+    bool runFRIFoldTest;
+    bool runZkinTest;
+    bool runLDEMerkleTreeTest;
+    bool runSharedMemoryTest;
+    bool runChelpersFusedTest;
 
     bool executeInParallel;
+    bool executeStreaming; // Stream Binary, Arith and MemAlign actions to their executors while the main executor runs
+    uint64_t executeStreamingChunkSize; // Minimum number of actions published at once
+    uint64_t executeStreamingQueueSize; // Maximum number of published chunks pending to be executed, per state machine
+    uint64_t executorPoolThreads; // Size of the work-stealing pool that executes the secondary state machines; 0 = one thread per state machine
     bool useMainExecGenerated;
     bool useMainExecC;
 
@@ -82,16 +96,21 @@ public:
     uint64_t executorClientLoops;
     bool executorClientCheckNewStateRoot;
     bool executorClientResetDB;
+    bool executorClientStream;
 
     // HashDB service
     uint16_t hashDBServerPort;
     string hashDBURL;
+    bool hashDBRemoteBatch;
+    uint64_t hashDBRemotePrefetchKeys;
     bool hashDB64;
     uint64_t kvDBMaxVersions;
     string dbCacheSynchURL;
     string hashDBFileName;
     uint64_t hashDBFileSize;
     string hashDBFolder;
+    uint64_t hashDB64WriteThreads;
+    uint64_t hashDB64CompactionPeriod;
 
     // Aggregator service (client)
     uint16_t aggregatorServerPort;
@@ -135,6 +154,16 @@ public:
     string recursive2ConstantsTree;
     string recursivefConstantsTree;
     bool mapConstantsTreeFile;
+    bool useSharedConstants; // Load constant polynomials and trees once per host, in shared memory segments attached by all the prover processes
+    string sharedConstantsHugePagesPath; // If not empty, hugetlbfs mount point where the shared segments are created, instead of /dev/shm
+    uint64_t sharedConstantsTimeout; // Seconds to wait for another process loading the shared constants
+    bool fusedLDEAndMerkleTree; // Hash the Merkle tree leaves of the extended committed polynomials while they are computed
+    uint64_t fusedLDEAndMerkleTreeTileSize; // Size in bytes of the tiles of rows extended and hashed at once
+    bool chelpersFused; // Evaluate the step 4 constraint polynomials with the fused chelpers parser, generated by chelpersFuser
+    bool chelpersProfile; // Log the cycles spent per chelpers op type of step 4, evaluated on a sample of rows
+    string zkevmChelpers; // If not empty, chelpers binary file evaluated by the generic evaluator instead of the compiled-in parsers
+    bool chelpersCompare; // Evaluate step 4 with both the chelpers binary file and the compiled-in parser, and compare them
+    bool blockedFFT; // Compute the BN128 scalar field FFTs of the fflonk and groth16 provers in cache sized blocks
     string finalVerkey;
     string zkevmVerifier;
     string recursive1Verifier;
@@ -191,6 +220,11 @@ public:
     uint64_t maxExecutorThreads;
     uint64_t maxProverThreads;
     uint64_t maxHashDBThreads;
+    uint64_t proverPriorityBatchProof; // Scheduling priority of genBatchProof requests; higher goes first
+    uint64_t proverPriorityAggregatedProof; // Scheduling priority of genAggregatedProof requests; higher goes first
+    uint64_t proverPriorityFinalProof; // Scheduling priority of genFinalProof requests; higher goes first
+    uint64_t proverRequestAgingPeriod; // Time in seconds a pending request has to wait to increase its priority by one level; if 0, aging is disabled
+    uint64_t proverPipelineMemory; // Size in MBytes of the committed pols staging buffers used to execute the next batch while proving the current one; if 0, requests are processed serially
     string proverName;
     uint64_t fullTracerTraceReserveSize;
 
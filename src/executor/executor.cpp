@@ -321,6 +321,8 @@ public:
     Executor * pExecutor;
     PROVER_FORK_NAMESPACE::MainExecRequired * pRequired;
     PROVER_FORK_NAMESPACE::CommitPols * pCommitPols;
+    MainExecStreams * pStreams;
+    TaskPool * pTaskPool;
 };
 
 void* BinaryThread (void* arg)
@@ -349,6 +351,118 @@ void* MemAlignThread (void* arg)
     return NULL;
 }
 
+// Minimum number of memory accesses reordered by every task
+#define MEMORY_TASKS_MIN_REORDER_SIZE 1024
+
+class MemoryReorderTask
+{
+public:
+    ExecutorContext * pExecutorContext;
+    uint64_t first;
+    uint64_t last;
+    vector<MemoryAccess> * pFirstList; // Reordered lists to merge, if pFirstList != NULL
+    vector<MemoryAccess> * pSecondList;
+    vector<MemoryAccess> * pOutput;
+};
+
+void* MemoryReorderThread (void* arg)
+{
+    MemoryReorderTask * pTask = (MemoryReorderTask *)arg;
+    MemoryExecutor &memoryExecutor = pTask->pExecutorContext->pExecutor->memoryExecutor;
+    if (pTask->pFirstList != NULL)
+    {
+        memoryExecutor.reorderMerge(*pTask->pFirstList, *pTask->pSecondList, *pTask->pOutput);
+    }
+    else
+    {
+        memoryExecutor.reorder(pTask->pExecutorContext->pRequired->Memory, pTask->first, pTask->last, *pTask->pOutput);
+    }
+    return NULL;
+}
+
+class MemoryRowsTask
+{
+public:
+    ExecutorContext * pExecutorContext;
+    vector<MemoryAccess> * pAccess;
+    uint64_t firstRow;
+    uint64_t lastRow;
+};
+
+void* MemoryRowsThread (void* arg)
+{
+    MemoryRowsTask * pTask = (MemoryRowsTask *)arg;
+    pTask->pExecutorContext->pExecutor->memoryExecutor.executeRows(*pTask->pAccess, pTask->pExecutorContext->pCommitPols->Mem, pTask->firstRow, pTask->lastRow);
+    return NULL;
+}
+
+// Executes the Memory state machine as tasks of the pool: the input is reordered in ranges that are then merged
+// by pairs, and the evaluations are filled in ranges
+void MemoryTasks (ExecutorContext * pExecutorContext)
+{
+    MemoryExecutor &memoryExecutor = pExecutorContext->pExecutor->memoryExecutor;
+    vector<MemoryAccess> &input = pExecutorContext->pRequired->Memory;
+    TaskPool &taskPool = *pExecutorContext->pTaskPool;
+    memoryExecutor.executePrepare(input);
+
+    // Reorder ranges of the input
+    TimerStart(MEMORY_EXECUTOR_REORDER);
+    uint64_t numberOfLists = zkmax(zkmin(input.size()/MEMORY_TASKS_MIN_REORDER_SIZE, taskPool.size()*2), 1);
+    vector<vector<MemoryAccess>> lists(numberOfLists);
+    vector<MemoryReorderTask> reorderTasks(numberOfLists);
+    TaskGroup group;
+    for (uint64_t i=0; i<numberOfLists; i++)
+    {
+        reorderTasks[i].pExecutorContext = pExecutorContext;
+        reorderTasks[i].first = (input.size()*i)/numberOfLists;
+        reorderTasks[i].last = (input.size()*(i + 1))/numberOfLists;
+        reorderTasks[i].pFirstList = NULL;
+        reorderTasks[i].pSecondList = NULL;
+        reorderTasks[i].pOutput = &lists[i];
+        taskPool.submit(group, MemoryReorderThread, &reorderTasks[i]);
+    }
+    taskPool.wait(group);
+
+    // Merge consecutive lists by pairs, until only one is left
+    while (lists.size() > 1)
+    {
+        vector<vector<MemoryAccess>> mergedLists((lists.size() + 1)/2);
+        vector<MemoryReorderTask> mergeTasks(lists.size()/2);
+        for (uint64_t i=0; i<mergeTasks.size(); i++)
+        {
+            mergeTasks[i].pExecutorContext = pExecutorContext;
+            mergeTasks[i].pFirstList = &lists[2*i];
+            mergeTasks[i].pSecondList = &lists[2*i + 1];
+            mergeTasks[i].pOutput = &mergedLists[i];
+            taskPool.submit(group, MemoryReorderThread, &mergeTasks[i]);
+        }
+        if ((lists.size() % 2) != 0)
+        {
+            mergedLists.back().swap(lists.back());
+        }
+        taskPool.wait(group);
+        lists.swap(mergedLists);
+    }
+    vector<MemoryAccess> &access = lists[0];
+    TimerStopAndLog(MEMORY_EXECUTOR_REORDER);
+
+    // Fill ranges of evaluations
+    uint64_t N = PROVER_FORK_NAMESPACE::MemCommitPols::pilDegree();
+    uint64_t numberOfTasks = taskPool.size()*2;
+    vector<MemoryRowsTask> rowsTasks(numberOfTasks);
+    for (uint64_t i=0; i<numberOfTasks; i++)
+    {
+        rowsTasks[i].pExecutorContext = pExecutorContext;
+        rowsTasks[i].pAccess = &access;
+        rowsTasks[i].firstRow = (N*i)/numberOfTasks;
+        rowsTasks[i].lastRow = (N*(i + 1))/numberOfTasks;
+        taskPool.submit(group, MemoryRowsThread, &rowsTasks[i]);
+    }
+    taskPool.wait(group);
+
+    memoryExecutor.executeFinal(access, pExecutorContext->pCommitPols->Mem);
+}
+
 void* MemoryThread (void* arg)
 {
     // Get the context
@@ -356,7 +470,14 @@ void* MemoryThread (void* arg)
 
     // Execute the Binary State Machine
     TimerStart(MEMORY_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->memoryExecutor.execute(pExecutorContext->pRequired->Memory, pExecutorContext->pCommitPols->Mem);
+    if (pExecutorContext->pTaskPool != NULL)
+    {
+        MemoryTasks(pExecutorContext);
+    }
+    else
+    {
+        pExecutorContext->pExecutor->memoryExecutor.execute(pExecutorContext->pRequired->Memory, pExecutorContext->pCommitPols->Mem);
+    }
     TimerStopAndLog(MEMORY_SM_EXECUTE_THREAD);
 
     return NULL;
@@ -375,6 +496,54 @@ void* ArithThread (void* arg)
     return NULL;
 }
 
+class PaddingPGInputsTask
+{
+public:
+    ExecutorContext * pExecutorContext;
+    vector<uint64_t> * pFirstRow;
+    uint64_t firstInput;
+    uint64_t lastInput;
+    vector<array<Goldilocks::Element, 17>> required;
+};
+
+void* PaddingPGInputsThread (void* arg)
+{
+    PaddingPGInputsTask * pTask = (PaddingPGInputsTask *)arg;
+    PROVER_FORK_NAMESPACE::MainExecRequired * pRequired = pTask->pExecutorContext->pRequired;
+    pTask->pExecutorContext->pExecutor->paddingPGExecutor.executeInputs(pRequired->PaddingPG, *pTask->pFirstRow, pTask->pExecutorContext->pCommitPols->PaddingPG, pTask->required, pTask->firstInput, pTask->lastInput);
+    return NULL;
+}
+
+// Executes the PaddingPG inputs as tasks of the pool, since every input fills its own rows, and appends their
+// PoseidonG required lists in input order
+void PaddingPGTasks (ExecutorContext * pExecutorContext)
+{
+    PaddingPGExecutor &paddingPGExecutor = pExecutorContext->pExecutor->paddingPGExecutor;
+    PROVER_FORK_NAMESPACE::MainExecRequired * pRequired = pExecutorContext->pRequired;
+    vector<uint64_t> firstRow;
+    paddingPGExecutor.executePrepare(pRequired->PaddingPG, pExecutorContext->pCommitPols->PaddingPG, firstRow);
+
+    uint64_t numberOfInputs = pRequired->PaddingPG.size();
+    uint64_t numberOfTasks = zkmin(numberOfInputs, pExecutorContext->pTaskPool->size()*2);
+    vector<PaddingPGInputsTask> tasks(numberOfTasks);
+    TaskGroup group;
+    for (uint64_t i=0; i<numberOfTasks; i++)
+    {
+        tasks[i].pExecutorContext = pExecutorContext;
+        tasks[i].pFirstRow = &firstRow;
+        tasks[i].firstInput = (numberOfInputs*i)/numberOfTasks;
+        tasks[i].lastInput = (numberOfInputs*(i + 1))/numberOfTasks;
+        pExecutorContext->pTaskPool->submit(group, PaddingPGInputsThread, &tasks[i]);
+    }
+    pExecutorContext->pTaskPool->wait(group);
+
+    for (uint64_t i=0; i<numberOfTasks; i++)
+    {
+        pRequired->PoseidonGFromPG.insert(pRequired->PoseidonGFromPG.end(), tasks[i].required.begin(), tasks[i].required.end());
+    }
+    paddingPGExecutor.executeFinal(pRequired->PaddingPG, firstRow, pExecutorContext->pCommitPols->PaddingPG, pRequired->PoseidonGFromPG);
+}
+
 void* PaddingPGThread (void* arg)
 {
     // Get the context
@@ -382,7 +551,14 @@ void* PaddingPGThread (void* arg)
 
     // Execute the Padding PG State Machine
     TimerStart(PADDING_PG_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->paddingPGExecutor.execute(pExecutorContext->pRequired->PaddingPG, pExecutorContext->pCommitPols->PaddingPG, pExecutorContext->pRequired->PoseidonGFromPG);
+    if (pExecutorContext->pTaskPool != NULL)
+    {
+        PaddingPGTasks(pExecutorContext);
+    }
+    else
+    {
+        pExecutorContext->pExecutor->paddingPGExecutor.execute(pExecutorContext->pRequired->PaddingPG, pExecutorContext->pCommitPols->PaddingPG, pExecutorContext->pRequired->PoseidonGFromPG);
+    }
     TimerStopAndLog(PADDING_PG_SM_EXECUTE_THREAD);
 
     return NULL;
@@ -414,6 +590,46 @@ void* ClimbKeyThread (void* arg)
     return NULL;
 }
 
+class PoseidonGSlotsTask
+{
+public:
+    ExecutorContext * pExecutorContext;
+    uint64_t firstSlot;
+    uint64_t lastSlot;
+};
+
+void* PoseidonGSlotsThread (void* arg)
+{
+    PoseidonGSlotsTask * pTask = (PoseidonGSlotsTask *)arg;
+    PROVER_FORK_NAMESPACE::MainExecRequired * pRequired = pTask->pExecutorContext->pRequired;
+    pTask->pExecutorContext->pExecutor->poseidonGExecutor.executeSlots(pRequired->PoseidonG, pRequired->PoseidonGFromPG, pRequired->PoseidonGFromST, pTask->pExecutorContext->pCommitPols->PoseidonG, pTask->firstSlot, pTask->lastSlot);
+    return NULL;
+}
+
+// Executes the PoseidonG slots as independent tasks of the pool, as KeccakFTasks() does
+void PoseidonGTasks (ExecutorContext * pExecutorContext)
+{
+    PoseidonGExecutor &poseidonGExecutor = pExecutorContext->pExecutor->poseidonGExecutor;
+    PROVER_FORK_NAMESPACE::MainExecRequired * pRequired = pExecutorContext->pRequired;
+    poseidonGExecutor.executePrepare(pRequired->PoseidonG, pRequired->PoseidonGFromPG, pRequired->PoseidonGFromST);
+
+    uint64_t numberOfSlots = poseidonGExecutor.getNumberOfSlots();
+    uint64_t numberOfTasks = zkmin(numberOfSlots, pExecutorContext->pTaskPool->size()*4);
+    vector<PoseidonGSlotsTask> tasks(numberOfTasks);
+    TaskGroup group;
+    for (uint64_t i=0; i<numberOfTasks; i++)
+    {
+        tasks[i].pExecutorContext = pExecutorContext;
+        tasks[i].firstSlot = (numberOfSlots*i)/numberOfTasks;
+        tasks[i].lastSlot = (numberOfSlots*(i + 1))/numberOfTasks;
+        pExecutorContext->pTaskPool->submit(group, PoseidonGSlotsThread, &tasks[i]);
+    }
+    pExecutorContext->pTaskPool->wait(group);
+
+    uint64_t size = pRequired->PoseidonG.size() + pRequired->PoseidonGFromPG.size() + pRequired->PoseidonGFromST.size();
+    zklog.info("PoseidonGTasks() successfully processed " + to_string(size) + " Poseidon hashes in " + to_string(numberOfSlots) + " slots and " + to_string(numberOfTasks) + " tasks");
+}
+
 void* PoseidonThread (void* arg)
 {
     // Get the context
@@ -421,12 +637,57 @@ void* PoseidonThread (void* arg)
 
     // Execute the Poseidon G State Machine
     TimerStart(POSEIDON_G_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->poseidonGExecutor.execute(pExecutorContext->pRequired->PoseidonG, pExecutorContext->pRequired->PoseidonGFromPG, pExecutorContext->pRequired->PoseidonGFromST, pExecutorContext->pCommitPols->PoseidonG);
+    if (pExecutorContext->pTaskPool != NULL)
+    {
+        PoseidonGTasks(pExecutorContext);
+    }
+    else
+    {
+        pExecutorContext->pExecutor->poseidonGExecutor.execute(pExecutorContext->pRequired->PoseidonG, pExecutorContext->pRequired->PoseidonGFromPG, pExecutorContext->pRequired->PoseidonGFromST, pExecutorContext->pCommitPols->PoseidonG);
+    }
     TimerStopAndLog(POSEIDON_G_SM_EXECUTE_THREAD);
 
     return NULL;
 }
 
+class KeccakFSlotsTask
+{
+public:
+    ExecutorContext * pExecutorContext;
+    uint64_t firstSlot;
+    uint64_t lastSlot;
+};
+
+void* KeccakFSlotsThread (void* arg)
+{
+    KeccakFSlotsTask * pTask = (KeccakFSlotsTask *)arg;
+    pTask->pExecutorContext->pExecutor->keccakFExecutor.executeSlots(pTask->pExecutorContext->pCommitPols->KeccakF, pTask->firstSlot, pTask->lastSlot);
+    return NULL;
+}
+
+// Executes the Keccak F slots as independent tasks of the pool, instead of using an OMP parallel for,
+// and helps executing them (or any other pending task) while waiting
+void KeccakFTasks (ExecutorContext * pExecutorContext)
+{
+    KeccakFExecutor &keccakFExecutor = pExecutorContext->pExecutor->keccakFExecutor;
+    keccakFExecutor.executePrepare(pExecutorContext->pRequired->KeccakF, pExecutorContext->pCommitPols->KeccakF);
+
+    uint64_t numberOfSlots = keccakFExecutor.getNumberOfSlots();
+    uint64_t numberOfTasks = zkmin(numberOfSlots, pExecutorContext->pTaskPool->size()*2);
+    vector<KeccakFSlotsTask> tasks(numberOfTasks);
+    TaskGroup group;
+    for (uint64_t i=0; i<numberOfTasks; i++)
+    {
+        tasks[i].pExecutorContext = pExecutorContext;
+        tasks[i].firstSlot = (numberOfSlots*i)/numberOfTasks;
+        tasks[i].lastSlot = (numberOfSlots*(i + 1))/numberOfTasks;
+        pExecutorContext->pTaskPool->submit(group, KeccakFSlotsThread, &tasks[i]);
+    }
+    pExecutorContext->pTaskPool->wait(group);
+
+    zklog.info("KeccakFTasks() successfully processed " + to_string(numberOfSlots) + " Keccak-F slots in " + to_string(numberOfTasks) + " tasks");
+}
+
 void* KeccakThread (void* arg)
 {
     // Get the context
@@ -449,7 +710,14 @@ void* KeccakThread (void* arg)
 
     // Execute the Keccak F State Machine
     TimerStart(KECCAK_F_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->keccakFExecutor.execute(pExecutorContext->pRequired->KeccakF, pExecutorContext->pCommitPols->KeccakF);
+    if (pExecutorContext->pTaskPool != NULL)
+    {
+        KeccakFTasks(pExecutorContext);
+    }
+    else
+    {
+        pExecutorContext->pExecutor->keccakFExecutor.execute(pExecutorContext->pRequired->KeccakF, pExecutorContext->pCommitPols->KeccakF);
+    }
     TimerStopAndLog(KECCAK_F_SM_EXECUTE_THREAD);
 
     return NULL;
@@ -483,6 +751,211 @@ void* Sha256Thread (void* arg)
     return NULL;
 }
 
+void* BinaryStreamThread (void* arg)
+{
+    // Get the context
+    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
+
+    // Execute the Binary State Machine, chunk by chunk, as the main executor publishes them
+    TimerStart(BINARY_SM_STREAM_THREAD);
+    vector<BinaryAction> chunk;
+    uint64_t nActions = 0;
+    uint64_t nChunks = 0;
+    uint64_t busyTime = 0;
+    struct timeval t;
+    while (pExecutorContext->pStreams->Binary.pop(chunk))
+    {
+        gettimeofday(&t, NULL);
+        pExecutorContext->pExecutor->binaryExecutor.executeChunk(chunk, nActions, pExecutorContext->pCommitPols->Binary);
+        busyTime += TimeDiff(t);
+        nActions += chunk.size();
+        nChunks++;
+    }
+    pExecutorContext->pExecutor->binaryExecutor.executeFinal(nActions, pExecutorContext->pCommitPols->Binary);
+    TimerStopAndLog(BINARY_SM_STREAM_THREAD);
+
+    zklog.info("BinaryStreamThread() executed actions=" + to_string(nActions) + " chunks=" + to_string(nChunks) + " busy=" + to_string(double(busyTime)/1000000) + " s producerWaits=" + to_string(pExecutorContext->pStreams->Binary.producerWaits));
+
+    return NULL;
+}
+
+void* ArithStreamThread (void* arg)
+{
+    // Get the context
+    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
+
+    // Execute the Arith State Machine, chunk by chunk, as the main executor publishes them
+    TimerStart(ARITH_SM_STREAM_THREAD);
+    vector<ArithAction> chunk;
+    uint64_t nActions = 0;
+    uint64_t nChunks = 0;
+    uint64_t busyTime = 0;
+    struct timeval t;
+    while (pExecutorContext->pStreams->Arith.pop(chunk))
+    {
+        gettimeofday(&t, NULL);
+        pExecutorContext->pExecutor->arithExecutor.executeChunk(chunk, nActions, pExecutorContext->pCommitPols->Arith);
+        busyTime += TimeDiff(t);
+        nActions += chunk.size();
+        nChunks++;
+    }
+    pExecutorContext->pExecutor->arithExecutor.executeFinal(nActions, pExecutorContext->pCommitPols->Arith);
+    TimerStopAndLog(ARITH_SM_STREAM_THREAD);
+
+    zklog.info("ArithStreamThread() executed actions=" + to_string(nActions) + " chunks=" + to_string(nChunks) + " busy=" + to_string(double(busyTime)/1000000) + " s producerWaits=" + to_string(pExecutorContext->pStreams->Arith.producerWaits));
+
+    return NULL;
+}
+
+void* MemAlignStreamThread (void* arg)
+{
+    // Get the context
+    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
+
+    // Execute the MemAlign State Machine, chunk by chunk, as the main executor publishes them
+    TimerStart(MEM_ALIGN_SM_STREAM_THREAD);
+    vector<MemAlignAction> chunk;
+    uint64_t nActions = 0;
+    uint64_t nChunks = 0;
+    uint64_t busyTime = 0;
+    struct timeval t;
+    while (pExecutorContext->pStreams->MemAlign.pop(chunk))
+    {
+        gettimeofday(&t, NULL);
+        pExecutorContext->pExecutor->memAlignExecutor.executeChunk(chunk, nActions, pExecutorContext->pCommitPols->MemAlign);
+        busyTime += TimeDiff(t);
+        nActions += chunk.size();
+        nChunks++;
+    }
+    pExecutorContext->pExecutor->memAlignExecutor.executeFinal(nActions, pExecutorContext->pCommitPols->MemAlign);
+    TimerStopAndLog(MEM_ALIGN_SM_STREAM_THREAD);
+
+    zklog.info("MemAlignStreamThread() executed actions=" + to_string(nActions) + " chunks=" + to_string(nChunks) + " busy=" + to_string(double(busyTime)/1000000) + " s producerWaits=" + to_string(pExecutorContext->pStreams->MemAlign.producerWaits));
+
+    return NULL;
+}
+
+/*
+    Task graph of the secondary state machines, executed by the task pool when executorPoolThreads > 0.
+    Every state machine task reuses its thread function; when it completes, it submits the tasks that
+    were only waiting for it (ClimbKey waits for Storage, PoseidonG waits for Storage and PaddingPG).
+    KeccakF, PoseidonG, PaddingPG and Memory split their work into subtasks that idle workers can steal.
+    Storage stays a single task: it runs the storage ROM over the SMT actions, every evaluation takes the
+    registers of the previous one, and the PoseidonG and ClimbKey required lists are produced in that order,
+    so no evaluation can be computed before all the previous ones.  It is the first task submitted after
+    Keccak, so that it starts as soon as possible.
+*/
+
+class SMTask
+{
+public:
+    const char * name;
+    TaskFunction function;
+    ExecutorContext * pExecutorContext;
+    TaskGroup * pGroup;
+    SMTask * pSuccessors[2];
+    atomic<uint64_t> pendingDependencies;
+    struct timeval start;
+    struct timeval end;
+    SMTask() : name(""), function(NULL), pExecutorContext(NULL), pGroup(NULL), pendingDependencies(0)
+    {
+        pSuccessors[0] = NULL;
+        pSuccessors[1] = NULL;
+    };
+};
+
+void* SMTaskThread (void* arg)
+{
+    SMTask * pTask = (SMTask *)arg;
+
+    gettimeofday(&pTask->start, NULL);
+    pTask->function(pTask->pExecutorContext);
+    gettimeofday(&pTask->end, NULL);
+
+    for (uint64_t i=0; i<2; i++)
+    {
+        SMTask * pSuccessor = pTask->pSuccessors[i];
+        if ((pSuccessor != NULL) && (--pSuccessor->pendingDependencies == 0))
+        {
+            pTask->pExecutorContext->pTaskPool->submit(*pTask->pGroup, SMTaskThread, pSuccessor);
+        }
+    }
+
+    return NULL;
+}
+
+void ExecuteSMTasks (ExecutorContext &executorContext)
+{
+    TaskPool &taskPool = *executorContext.pTaskPool;
+    TaskGroup group;
+
+    // Tasks are listed by decreasing expected cost, since idle workers steal the oldest tasks first
+    enum { KECCAK, STORAGE, SHA256, PADDING_PG, MEMORY, BINARY, ARITH, MEM_ALIGN, POSEIDON_G, CLIMB_KEY, SM_TASKS_NUMBER };
+    SMTask tasks[SM_TASKS_NUMBER];
+    tasks[KECCAK].name = "PaddingKK+PaddingKKBit+Bits2Field+KeccakF";
+    tasks[KECCAK].function = KeccakThread;
+    tasks[STORAGE].name = "Storage";
+    tasks[STORAGE].function = StorageThread;
+    tasks[SHA256].name = "PaddingSha256+PaddingSha256Bit+Bits2FieldSha256+Sha256F";
+    tasks[SHA256].function = Sha256Thread;
+    tasks[PADDING_PG].name = "PaddingPG";
+    tasks[PADDING_PG].function = PaddingPGThread;
+    tasks[MEMORY].name = "Memory";
+    tasks[MEMORY].function = MemoryThread;
+    tasks[BINARY].name = "Binary";
+    tasks[BINARY].function = BinaryThread;
+    tasks[ARITH].name = "Arith";
+    tasks[ARITH].function = ArithThread;
+    tasks[MEM_ALIGN].name = "MemAlign";
+    tasks[MEM_ALIGN].function = MemAlignThread;
+    tasks[POSEIDON_G].name = "PoseidonG";
+    tasks[POSEIDON_G].function = PoseidonThread;
+    tasks[POSEIDON_G].pendingDependencies = 2;
+    tasks[CLIMB_KEY].name = "ClimbKey";
+    tasks[CLIMB_KEY].function = ClimbKeyThread;
+    tasks[CLIMB_KEY].pendingDependencies = 1;
+    tasks[STORAGE].pSuccessors[0] = &tasks[CLIMB_KEY];
+    tasks[STORAGE].pSuccessors[1] = &tasks[POSEIDON_G];
+    tasks[PADDING_PG].pSuccessors[0] = &tasks[POSEIDON_G];
+
+    // Binary, Arith and MemAlign have already been executed by their stream threads, if streaming
+    bool bStreamed = (executorContext.pStreams != NULL);
+
+    struct timeval startTime;
+    gettimeofday(&startTime, NULL);
+    for (uint64_t i=0; i<SM_TASKS_NUMBER; i++)
+    {
+        tasks[i].pExecutorContext = &executorContext;
+        tasks[i].pGroup = &group;
+        if (bStreamed && ((i == BINARY) || (i == ARITH) || (i == MEM_ALIGN)))
+        {
+            continue;
+        }
+        if (tasks[i].pendingDependencies == 0)
+        {
+            taskPool.submit(group, SMTaskThread, &tasks[i]);
+        }
+    }
+    taskPool.wait(group);
+    uint64_t totalTime = TimeDiff(startTime);
+
+    // Report when every state machine started and how long it took, relative to the first submission
+    uint64_t busyTime = 0;
+    string report;
+    for (uint64_t i=0; i<SM_TASKS_NUMBER; i++)
+    {
+        if (bStreamed && ((i == BINARY) || (i == ARITH) || (i == MEM_ALIGN)))
+        {
+            continue;
+        }
+        uint64_t duration = TimeDiff(tasks[i].start, tasks[i].end);
+        busyTime += duration;
+        report += " " + string(tasks[i].name) + "=" + to_string(double(TimeDiff(startTime, tasks[i].start))/1000000) + "+" + to_string(double(duration)/1000000);
+    }
+    zklog.info("ExecuteSMTasks() done total=" + to_string(double(totalTime)/1000000) + " s busy=" + to_string(double(busyTime)/1000000) + " s threads=" + to_string(taskPool.size()) + " start+duration(s):" + report);
+    taskPool.printStats();
+}
+
 // Full version: all polynomials are evaluated, in all evaluations
 void Executor::execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::CommitPols & commitPols)
 {
@@ -614,6 +1087,22 @@ void Executor::execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::Com
         executorContext.pExecutor = this;
         executorContext.pCommitPols = &commitPols;
         executorContext.pRequired = &required;
+        executorContext.pStreams = NULL;
+        executorContext.pTaskPool = pTaskPool;
+
+        // In streaming mode, the Binary, Arith and MemAlign State Machines execute their actions
+        // while the Main State Machine is still running, as it publishes them
+        pthread_t binaryThread;
+        pthread_t arithThread;
+        pthread_t memAlignThread;
+        if (config.executeStreaming)
+        {
+            executorContext.pStreams = new MainExecStreams(config.executeStreamingChunkSize, config.executeStreamingQueueSize);
+            required.pStreams = executorContext.pStreams;
+            pthread_create(&binaryThread, NULL, BinaryStreamThread, &executorContext);
+            pthread_create(&arithThread, NULL, ArithStreamThread, &executorContext);
+            pthread_create(&memAlignThread, NULL, MemAlignStreamThread, &executorContext);
+        }
 
         // Execute the Main State Machine
         TimerStart(MAIN_EXECUTOR_EXECUTE);
@@ -638,67 +1127,103 @@ void Executor::execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::Com
 
         TimerStopAndLog(MAIN_EXECUTOR_EXECUTE);
 
+        // Publish the last actions and let the streaming threads complete the polynomials
+        if (executorContext.pStreams != NULL)
+        {
+            required.publish(true);
+            executorContext.pStreams->Binary.close();
+            executorContext.pStreams->Arith.close();
+            executorContext.pStreams->MemAlign.close();
+        }
+
         if (proverRequest.result != ZKR_SUCCESS)
         {
             zklog.error("Executor::execute() got from main execution proverRequest.result=" + to_string(proverRequest.result) + "=" + zkresult2string(proverRequest.result));
+            if (executorContext.pStreams != NULL)
+            {
+                pthread_join(binaryThread, NULL);
+                pthread_join(arithThread, NULL);
+                pthread_join(memAlignThread, NULL);
+                delete executorContext.pStreams;
+            }
             return;
         }
 
-        // Execute the Storage State Machines
-        pthread_t storageThread;
-        pthread_create(&storageThread, NULL, StorageThread, &executorContext);
-
-        // Execute the Padding PG
-        pthread_t paddingPGThread;
-        pthread_create(&paddingPGThread, NULL, PaddingPGThread, &executorContext);
-
-        // Execute the Arith State Machine, in parallel
-        pthread_t arithThread;
-        pthread_create(&arithThread, NULL, ArithThread, &executorContext);
-
-        // Execute the Binary State Machine, in parallel
-        pthread_t binaryThread;
-        pthread_create(&binaryThread, NULL, BinaryThread, &executorContext);
-
-        // Execute the Mem Align State Machine, in parallel
-        pthread_t memAlignThread;
-        pthread_create(&memAlignThread, NULL, MemAlignThread, &executorContext);
-
-        // Execute the Memory State Machine, in parallel
-        pthread_t memoryThread;
-        pthread_create(&memoryThread, NULL, MemoryThread, &executorContext);
-
-        // Execute the PaddingKK, PaddingKKBit, Bits2Field, Keccak F
-        pthread_t keccakThread;
-        pthread_create(&keccakThread, NULL, KeccakThread, &executorContext);
+        if (pTaskPool != NULL)
+        {
+            // Execute the rest of State Machines as tasks of the pool
+            ExecuteSMTasks(executorContext);
 
-        // Execute the PaddingSha256, PaddingSha256Bit, Bits2FieldSha256, Sha256 F
-        pthread_t sha256Thread;
-        pthread_create(&sha256Thread, NULL, Sha256Thread, &executorContext);
+            // Wait for the stream threads, if streaming
+            if (executorContext.pStreams != NULL)
+            {
+                pthread_join(binaryThread, NULL);
+                pthread_join(arithThread, NULL);
+                pthread_join(memAlignThread, NULL);
+            }
+        }
+        else
+        {
+            // Execute the Storage State Machines
+            pthread_t storageThread;
+            pthread_create(&storageThread, NULL, StorageThread, &executorContext);
 
-        // Wait for the Storage SM threads
-        pthread_join(storageThread, NULL);
+            // Execute the Padding PG
+            pthread_t paddingPGThread;
+            pthread_create(&paddingPGThread, NULL, PaddingPGThread, &executorContext);
 
-        // Execute the ClimKey State Machines (now that Storage is done)
-        pthread_t climbKeyThread;
-        pthread_create(&climbKeyThread, NULL, ClimbKeyThread, &executorContext);
+            if (executorContext.pStreams == NULL)
+            {
+                // Execute the Arith State Machine, in parallel
+                pthread_create(&arithThread, NULL, ArithThread, &executorContext);
 
-        // Wait for the PaddingPG SM threads
-        pthread_join(paddingPGThread, NULL);
+                // Execute the Binary State Machine, in parallel
+                pthread_create(&binaryThread, NULL, BinaryThread, &executorContext);
 
-        // Execute the PoseidonG State Machine (now that Storage and PaddingPG are done)
-        pthread_t poseidonThread;
-        pthread_create(&poseidonThread, NULL, PoseidonThread, &executorContext);
+                // Execute the Mem Align State Machine, in parallel
+                pthread_create(&memAlignThread, NULL, MemAlignThread, &executorContext);
+            }
 
-        // Wait for the parallel SM threads
-        pthread_join(binaryThread, NULL);
-        pthread_join(memAlignThread, NULL);
-        pthread_join(memoryThread, NULL);
-        pthread_join(arithThread, NULL);
-        pthread_join(poseidonThread, NULL);
-        pthread_join(keccakThread, NULL);
-        pthread_join(sha256Thread, NULL);
-        pthread_join(climbKeyThread, NULL);
+            // Execute the Memory State Machine, in parallel
+            pthread_t memoryThread;
+            pthread_create(&memoryThread, NULL, MemoryThread, &executorContext);
+
+            // Execute the PaddingKK, PaddingKKBit, Bits2Field, Keccak F
+            pthread_t keccakThread;
+            pthread_create(&keccakThread, NULL, KeccakThread, &executorContext);
+
+            // Execute the PaddingSha256, PaddingSha256Bit, Bits2FieldSha256, Sha256 F
+            pthread_t sha256Thread;
+            pthread_create(&sha256Thread, NULL, Sha256Thread, &executorContext);
+
+            // Wait for the Storage SM threads
+            pthread_join(storageThread, NULL);
+
+            // Execute the ClimKey State Machines (now that Storage is done)
+            pthread_t climbKeyThread;
+            pthread_create(&climbKeyThread, NULL, ClimbKeyThread, &executorContext);
+
+            // Wait for the PaddingPG SM threads
+            pthread_join(paddingPGThread, NULL);
+
+            // Execute the PoseidonG State Machine (now that Storage and PaddingPG are done)
+            pthread_t poseidonThread;
+            pthread_create(&poseidonThread, NULL, PoseidonThread, &executorContext);
+
+            // Wait for the parallel SM threads
+            pthread_join(binaryThread, NULL);
+            pthread_join(memAlignThread, NULL);
+            pthread_join(memoryThread, NULL);
+            pthread_join(arithThread, NULL);
+            pthread_join(poseidonThread, NULL);
+            pthread_join(keccakThread, NULL);
+            pthread_join(sha256Thread, NULL);
+            pthread_join(climbKeyThread, NULL);
+        }
 
+        if (executorContext.pStreams != NULL)
+        {
+            delete executorContext.pStreams;
+        }
     }
 }
\ No newline at end of file
@@ -29,6 +29,7 @@
 #include "sm/sha256_f/sha256_f_executor.hpp"
 #include "sm/climb_key/climb_key_executor.hpp"
 #include "prover_request.hpp"
+#include "task_pool.hpp"
 
 class Executor
 {
@@ -62,7 +63,7 @@ public:
     PoseidonGExecutor poseidonGExecutor;
     MemAlignExecutor memAlignExecutor;
     ClimbKeyExecutor climbKeyExecutor;
-
+    TaskPool * pTaskPool; // Executes the secondary state machines, if executorPoolThreads > 0
 
     Executor(Goldilocks &fr, const Config &config, PoseidonGoldilocks &poseidon) :
         fr(fr),
@@ -92,8 +93,23 @@ public:
         paddingPGExecutor(fr, poseidon),
         poseidonGExecutor(fr, poseidon),
         memAlignExecutor(fr, config),
-        climbKeyExecutor(fr, config)
-        {};
+        climbKeyExecutor(fr, config),
+        pTaskPool(NULL)
+        {
+            // Only full executions of proofs use the task pool
+            if (config.generateProof() && config.executeInParallel && (config.executorPoolThreads > 0))
+            {
+                pTaskPool = new TaskPool(config.executorPoolThreads);
+            }
+        };
+
+    ~Executor()
+    {
+        if (pTaskPool != NULL)
+        {
+            delete pTaskPool;
+        }
+    };
 
     // Full version: all polynomials are evaluated, in all evaluations
     void execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::CommitPols & commitPols);
@@ -0,0 +1,131 @@
+#ifndef EXECUTOR_STREAM_HPP
+#define EXECUTOR_STREAM_HPP
+
+#include <vector>
+#include <deque>
+#include <iterator>
+#include <pthread.h>
+#include <semaphore.h>
+#include "sm/binary/binary_action.hpp"
+#include "sm/arith/arith_action.hpp"
+#include "sm/mem_align/mem_align_executor.hpp"
+#include "zklog.hpp"
+#include "exit_process.hpp"
+#include "zkmax.hpp"
+
+using namespace std;
+
+/*
+    Bounded single-producer single-consumer queue of action chunks.
+    The main executor (producer) appends actions to its required vector as usual, and periodically
+    publishes the ones appended since the last call as a new chunk; the actions are moved out of the
+    vector, but its size is kept, so that the number of published actions is still size().
+    A secondary executor thread (consumer) pops the chunks in order and processes them while the main
+    executor keeps running.  When the queue is full, the producer waits for the consumer to catch up.
+*/
+
+template <typename T>
+class ExecutorStream
+{
+private:
+    pthread_mutex_t mutex; // Mutex to protect the chunks queue
+    sem_t freeSlots; // Number of chunks that can still be pushed
+    sem_t usedSlots; // Number of chunks that can be popped, plus 1 after close()
+    deque<vector<T>> chunks;
+    uint64_t chunkSize; // Minimum number of actions to publish a new chunk
+    uint64_t published; // Number of actions of the producer vector already published
+    bool bClosed;
+
+public:
+    uint64_t producerWaits; // Number of times the producer found the queue full
+
+    ExecutorStream (uint64_t chunkSize_, uint64_t maxChunks) :
+        chunkSize(zkmax(chunkSize_, 1)),
+        published(0),
+        bClosed(false),
+        producerWaits(0)
+    {
+        pthread_mutex_init(&mutex, NULL);
+        sem_init(&freeSlots, 0, zkmax(maxChunks, 1));
+        sem_init(&usedSlots, 0, 0);
+    }
+
+    ~ExecutorStream ()
+    {
+        sem_destroy(&freeSlots);
+        sem_destroy(&usedSlots);
+        pthread_mutex_destroy(&mutex);
+    }
+
+    // Producer: publishes the actions appended to source since the last call, if there are at least
+    // chunkSize of them or if bFlush is set
+    void publish (vector<T> &source, bool bFlush)
+    {
+        uint64_t pending = source.size() - published;
+        if ((pending == 0) || (!bFlush && (pending < chunkSize)))
+        {
+            return;
+        }
+        if (bClosed)
+        {
+            zklog.error("ExecutorStream::publish() called after close()");
+            exitProcess();
+        }
+
+        vector<T> chunk(make_move_iterator(source.begin() + published), make_move_iterator(source.end()));
+        published = source.size();
+
+        if (sem_trywait(&freeSlots) != 0)
+        {
+            producerWaits++;
+            sem_wait(&freeSlots);
+        }
+        pthread_mutex_lock(&mutex);
+        chunks.push_back(vector<T>());
+        chunks.back().swap(chunk);
+        pthread_mutex_unlock(&mutex);
+        sem_post(&usedSlots);
+    }
+
+    // Producer: signals that no more chunks will be published
+    void close (void)
+    {
+        bClosed = true;
+        sem_post(&usedSlots);
+    }
+
+    // Consumer: waits for the next chunk and returns true, or returns false if the stream is closed and empty
+    bool pop (vector<T> &chunk)
+    {
+        sem_wait(&usedSlots);
+        pthread_mutex_lock(&mutex);
+        if (chunks.empty())
+        {
+            pthread_mutex_unlock(&mutex);
+            return false;
+        }
+        chunk.swap(chunks.front());
+        chunks.pop_front();
+        pthread_mutex_unlock(&mutex);
+        sem_post(&freeSlots);
+        return true;
+    }
+
+    uint64_t getPublished (void) const { return published; };
+};
+
+// Streams of the secondary state machines that can execute their actions in order, as they come
+class MainExecStreams
+{
+public:
+    ExecutorStream<BinaryAction> Binary;
+    ExecutorStream<ArithAction> Arith;
+    ExecutorStream<MemAlignAction> MemAlign;
+
+    MainExecStreams (uint64_t chunkSize, uint64_t maxChunks) :
+        Binary(chunkSize, maxChunks),
+        Arith(chunkSize, maxChunks),
+        MemAlign(chunkSize, maxChunks) {};
+};
+
+#endif
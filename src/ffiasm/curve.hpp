@@ -2,12 +2,15 @@
 
 #include "exp.hpp"
 #include "multiexp.hpp"
+#include "multiexp_ba.hpp"
 
 template <typename BaseField>
 class Curve {
 
     void mulByA(typename BaseField::Element &r, typename BaseField::Element &ab);
 public:
+    typedef BaseField Field;
+
     struct Point {
         typename BaseField::Element x;
         typename BaseField::Element y;
@@ -116,12 +119,12 @@ public:
     }
 
     void multiMulByScalar(Point &r, PointAffine *bases, uint8_t* scalars, unsigned int scalarSize, unsigned int n, unsigned int nThreads=0) {
-        ParallelMultiexp<Curve<BaseField>> pm(*this);
+        BatchAffineMultiexp<Curve<BaseField>> pm(*this);
         pm.multiexp(r, bases, scalars, scalarSize, n, nThreads);
     }
     void multiMulByScalar(Point &r, PointAffine *bases, uint8_t* scalars, unsigned int scalarSize, unsigned int n,
                           uint32_t nx, uint64_t x[],  unsigned int nThreads=0) {
-        ParallelMultiexp<Curve<BaseField>> pm(*this);
+        BatchAffineMultiexp<Curve<BaseField>> pm(*this);
         pm.multiexp(r, bases, scalars, scalarSize, n, nx, x, nThreads);
     }
 #ifdef COUNT_OPS
@@ -31,6 +31,7 @@ static inline u_int64_t BR(u_int64_t x, u_int64_t domainPow)
 template <typename Field>
 FFT<Field>::FFT(u_int64_t maxDomainSize, uint32_t _nThreads) {
     nThreads = _nThreads==0 ? omp_get_max_threads() : _nThreads;
+    blocked = blockedDefault;
     f = Field::field;
 
     u_int32_t domainPow = log2(maxDomainSize);
@@ -173,6 +174,15 @@ void FFT<Field>::reversePermutation(Element *a, u_int64_t n) {
 
 template <typename Field>
 void FFT<Field>::fft(Element *a, u_int64_t n) {
+    if (blocked) {
+        fftBlocked(a, n);
+    } else {
+        fftClassic(a, n);
+    }
+}
+
+template <typename Field>
+void FFT<Field>::fftClassic(Element *a, u_int64_t n) {
     reversePermutation(a, n);
     u_int64_t domainPow =log2(n);
     assert(((u_int64_t)1 << domainPow) == n);
@@ -194,6 +204,72 @@ void FFT<Field>::fft(Element *a, u_int64_t n) {
     }
 }
 
+/*
+    Same butterflies as fftClassic(), in a different order.  After the bit reversal, the first FFT_BLOCK_BITS
+    levels only mix elements of the same block of 2^FFT_BLOCK_BITS contiguous elements, so every block is
+    transformed in cache.  Then, the levels s0+1 to s0+b of a pass, where stride=2^s0, only mix elements of the
+    same group of stride*2^b elements whose index has the same value modulo stride, i.e. the same column, so
+    every pass is split in tiles of FFT_PASS_COLUMNS contiguous columns of a group, whose 2^b*FFT_PASS_COLUMNS
+    elements are transformed in cache.
+*/
+template <typename Field>
+void FFT<Field>::fftBlocked(Element *a, u_int64_t n) {
+    reversePermutation(a, n);
+    u_int64_t domainPow = log2(n);
+    assert(((u_int64_t)1 << domainPow) == n);
+
+    u_int64_t blockBits = domainPow < FFT_BLOCK_BITS ? domainPow : FFT_BLOCK_BITS;
+    u_int64_t blockSize = (u_int64_t)1 << blockBits;
+    #pragma omp parallel for
+    for (u_int64_t block=0; block<n; block+=blockSize) {
+        Element *b = &a[block];
+        for (u_int32_t s=1; s<=blockBits; s++) {
+            u_int64_t mdiv2 = (u_int64_t)1 << (s-1);
+            for (u_int64_t k=0; k<blockSize; k+=2*mdiv2) {
+                for (u_int64_t j=0; j<mdiv2; j++) {
+                    Element t;
+                    Element u;
+                    f.mul(t, root(s, j), b[k+j+mdiv2]);
+                    f.copy(u, b[k+j]);
+                    f.add(b[k+j], t, u);
+                    f.sub(b[k+j+mdiv2], u, t);
+                }
+            }
+        }
+    }
+
+    for (u_int64_t s0=blockBits; s0<domainPow; s0+=FFT_PASS_BITS) {
+        u_int64_t passBits = (domainPow - s0 < FFT_PASS_BITS) ? domainPow - s0 : FFT_PASS_BITS;
+        u_int64_t stride = (u_int64_t)1 << s0;
+        u_int64_t groupSize = stride << passBits;
+        u_int64_t nColumns = stride < FFT_PASS_COLUMNS ? stride : FFT_PASS_COLUMNS;
+        u_int64_t tilesPerGroup = stride / nColumns;
+        u_int64_t nTiles = (n / groupSize) * tilesPerGroup;
+        #pragma omp parallel for
+        for (u_int64_t tile=0; tile<nTiles; tile++) {
+            Element *g = &a[(tile / tilesPerGroup) * groupSize];
+            u_int64_t column = (tile % tilesPerGroup) * nColumns;
+            for (u_int32_t l=1; l<=passBits; l++) {
+                u_int32_t s = s0 + l;
+                u_int64_t mdiv2 = stride << (l-1);
+                for (u_int64_t k=0; k<groupSize; k+=2*mdiv2) {
+                    for (u_int64_t q=0; q<mdiv2; q+=stride) {
+                        for (u_int64_t c=0; c<nColumns; c++) {
+                            Element t;
+                            Element u;
+                            u_int64_t j = q + column + c;
+                            f.mul(t, root(s, j), g[k+j+mdiv2]);
+                            f.copy(u, g[k+j]);
+                            f.add(g[k+j], t, u);
+                            f.sub(g[k+j+mdiv2], u, t);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
 template <typename Field>
 void FFT<Field>::ifft(Element *a, u_int64_t n ) {
     fft(a, n);
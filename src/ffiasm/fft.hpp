@@ -1,6 +1,10 @@
 #ifndef FFT_H
 #define FFT_H
 
+#define FFT_BLOCK_BITS 12 // First levels are computed per block of 2^FFT_BLOCK_BITS contiguous elements
+#define FFT_PASS_BITS 8 // Next levels are computed in passes of up to FFT_PASS_BITS levels
+#define FFT_PASS_COLUMNS 16 // Contiguous elements per butterfly column tile of a pass
+
 template <typename Field>
 class FFT {
     Field f;
@@ -11,11 +15,15 @@ class FFT {
     Element *roots;
     Element *powTwoInv;
     u_int32_t nThreads;
+    bool blocked;
+    static bool blockedDefault;
 
     void reversePermutationInnerLoop(Element *a, u_int64_t from, u_int64_t to, u_int32_t domainPow);
     void reversePermutation(Element *a, u_int64_t n);
     void fftInnerLoop(Element *a, u_int64_t from, u_int64_t to, u_int32_t s);
     void finalInverseInner(Element *a, u_int64_t from, u_int64_t to, u_int32_t domainPow);
+    void fftClassic(Element *a, u_int64_t n);
+    void fftBlocked(Element *a, u_int64_t n);
 
 public:
 
@@ -24,6 +32,12 @@ public:
     void fft(Element *a, u_int64_t n );
     void ifft(Element *a, u_int64_t n );
 
+    // The blocked fft computes the same butterflies as the classic one, but in cache sized blocks and tiles of
+    // several levels, instead of one pass over the whole array per level
+    void setBlocked(bool _blocked) { blocked = _blocked; }
+    bool isBlocked() { return blocked; }
+    static void setBlockedDefault(bool _blocked) { blockedDefault = _blocked; } // For the FFT objects created afterwards
+
     u_int32_t log2(u_int64_t n);
     inline Element &root(u_int32_t domainPow, u_int64_t idx) { return roots[ idx << (s-domainPow)]; }
 
@@ -31,6 +45,9 @@ public:
 
 };
 
+template <typename Field>
+bool FFT<Field>::blockedDefault = false;
+
 #include "fft.c.hpp"
 
 #endif // FFT_H
\ No newline at end of file
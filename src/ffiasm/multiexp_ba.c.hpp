@@ -0,0 +1,326 @@
+#include <omp.h>
+#include <memory.h>
+#include <algorithm>
+#include "misc.hpp"
+#include "naf.hpp"
+
+template <typename Curve>
+bool BatchAffineMultiexp<Curve>::isIncluded(uint64_t i) {
+    if (nx == 0) return true;
+    uint32_t mod = i % nx;
+    uint32_t len = x[mod] - 1;
+    return i <= len * nx + mod;
+}
+
+template <typename Curve>
+void BatchAffineMultiexp<Curve>::initState() {
+    #pragma omp parallel for
+    for (uint64_t i=0; i<n; i++) {
+        state[i] = (isIncluded(i) && !g.isZero(bases[i])) ? 0 : PMEBA_STATE_SKIP;
+    }
+}
+
+template <typename Curve>
+void BatchAffineMultiexp<Curve>::computeDigits(uint64_t idxWindow) {
+    #pragma omp parallel for
+    for (uint64_t i=0; i<n; i++) {
+        if (state[i] & PMEBA_STATE_SKIP) {
+            digits[i] = 0;
+            continue;
+        }
+        bool carry = state[i] & PMEBA_STATE_CARRY;
+        int64_t digit = getSignedWindow(scalars + i*scalarSize, scalarSize, bitsPerWindow, idxWindow, carry);
+        state[i] = carry ? PMEBA_STATE_CARRY : 0;
+        digits[i] = (digit < 0) ? (uint32_t(-digit) | PMEBA_SIGN) : uint32_t(digit);
+    }
+}
+
+template <typename Curve>
+void BatchAffineMultiexp<Curve>::sortEntries() {
+    uint64_t nCounts = nBuckets + 1;
+
+    #pragma omp parallel for schedule(static, 1)
+    for (uint64_t t=0; t<nThreads; t++) {
+        uint64_t *counts = &threadCounts[t*nCounts];
+        memset(counts, 0, nCounts*sizeof(uint64_t));
+        uint64_t end = (t+1)*n/nThreads;
+        for (uint64_t i=t*n/nThreads; i<end; i++) {
+            if (digits[i]) counts[digits[i] & ~PMEBA_SIGN]++;
+        }
+    }
+
+    // Every thread writes its entries of a bucket after the ones of the previous threads
+    uint64_t total = 0;
+    for (uint64_t b=0; b<nCounts; b++) {
+        bucketStart[b] = total;
+        for (uint64_t t=0; t<nThreads; t++) {
+            uint64_t count = threadCounts[t*nCounts + b];
+            threadCounts[t*nCounts + b] = total;
+            total += count;
+        }
+    }
+    bucketStart[nCounts] = total;
+
+    #pragma omp parallel for schedule(static, 1)
+    for (uint64_t t=0; t<nThreads; t++) {
+        uint64_t *positions = &threadCounts[t*nCounts];
+        uint64_t end = (t+1)*n/nThreads;
+        for (uint64_t i=t*n/nThreads; i<end; i++) {
+            if (digits[i]) entries[positions[digits[i] & ~PMEBA_SIGN]++] = uint32_t(i) | (digits[i] & PMEBA_SIGN);
+        }
+    }
+}
+
+// Adds the points of every segment of the slice, until the sum of every segment is at its first point
+template <typename Curve>
+void BatchAffineMultiexp<Curve>::reduceSlice(typename Curve::PointAffine *points, uint64_t *segStart, uint64_t *segLen, uint64_t nSegs, FieldElement *dens, FieldElement *invs) {
+    for (;;) {
+        // Denominators x2-x1 of the pairs, and their prefix products; pairs with a zero point or with the same
+        // x, i.e. a doubling or a zero sum, are added in projective coordinates instead
+        uint64_t nPairs = 0;
+        uint64_t nAffinePairs = 0;
+        for (uint64_t s=0; s<nSegs; s++) {
+            typename Curve::PointAffine *p = &points[segStart[s]];
+            uint64_t pairs = segLen[s] / 2;
+            nPairs += pairs;
+            for (uint64_t j=0; j<pairs; j++) {
+                if (g.isZero(p[2*j]) || g.isZero(p[2*j+1]) || g.F.eq(p[2*j].x, p[2*j+1].x)) continue;
+                g.F.sub(dens[nAffinePairs], p[2*j+1].x, p[2*j].x);
+                if (nAffinePairs == 0) {
+                    g.F.copy(invs[0], dens[0]);
+                } else {
+                    g.F.mul(invs[nAffinePairs], invs[nAffinePairs-1], dens[nAffinePairs]);
+                }
+                nAffinePairs++;
+            }
+        }
+        if (nPairs == 0) return;
+
+        // Montgomery batch inversion: a single inversion of the product of all the denominators
+        if (nAffinePairs > 0) {
+            FieldElement inv, tmp;
+            g.F.inv(inv, invs[nAffinePairs-1]);
+            for (uint64_t k=nAffinePairs-1; k>0; k--) {
+                g.F.mul(tmp, inv, invs[k-1]);
+                g.F.mul(inv, inv, dens[k]);
+                g.F.copy(invs[k], tmp);
+            }
+            g.F.copy(invs[0], inv);
+        }
+
+        // The sum of pair j is written to point j of the segment, which has already been read
+        uint64_t k = 0;
+        for (uint64_t s=0; s<nSegs; s++) {
+            typename Curve::PointAffine *p = &points[segStart[s]];
+            uint64_t pairs = segLen[s] / 2;
+            for (uint64_t j=0; j<pairs; j++) {
+                typename Curve::PointAffine &p1 = p[2*j];
+                typename Curve::PointAffine &p2 = p[2*j+1];
+                if (g.isZero(p1) || g.isZero(p2) || g.F.eq(p1.x, p2.x)) {
+                    typename Curve::Point tmp;
+                    g.add(tmp, p1, p2);
+                    g.copy(p[j], tmp);
+                    continue;
+                }
+                // lambda = (y2-y1)/(x2-x1), x3 = lambda^2-x1-x2, y3 = lambda*(x1-x3)-y1
+                FieldElement lambda, dy, x3, y3, tmp;
+                g.F.sub(dy, p2.y, p1.y);
+                g.F.mul(lambda, dy, invs[k++]);
+                g.F.square(tmp, lambda);
+                g.F.sub(tmp, tmp, p1.x);
+                g.F.sub(x3, tmp, p2.x);
+                g.F.sub(tmp, p1.x, x3);
+                g.F.mul(y3, tmp, lambda);
+                g.F.sub(y3, y3, p1.y);
+                g.F.copy(p[j].x, x3);
+                g.F.copy(p[j].y, y3);
+            }
+            if (segLen[s] & 1) g.copy(p[pairs], p[segLen[s]-1]);
+            segLen[s] = pairs + (segLen[s] & 1);
+        }
+    }
+}
+
+// Computes sum(bucket*B_bucket) of the points of the sorted entries [entryBegin, entryEnd)
+template <typename Curve>
+void BatchAffineMultiexp<Curve>::processTask(typename Curve::Point &res, uint64_t entryBegin, uint64_t entryEnd) {
+    g.copy(res, g.zero());
+    if (entryBegin >= entryEnd) return;
+
+    uint64_t bucketFirst = std::upper_bound(bucketStart, bucketStart + nBuckets + 2, entryBegin) - bucketStart - 1;
+    uint64_t bucketLast = std::upper_bound(bucketStart, bucketStart + nBuckets + 2, entryEnd - 1) - bucketStart - 1;
+    uint64_t nTaskBuckets = bucketLast - bucketFirst + 1;
+
+    typename Curve::Point *buckets = new typename Curve::Point[nTaskBuckets];
+    for (uint64_t b=0; b<nTaskBuckets; b++) g.copy(buckets[b], g.zero());
+
+    typename Curve::PointAffine *points = new typename Curve::PointAffine[PMEBA_SLICE_SIZE];
+    uint64_t *segStart = new uint64_t[PMEBA_SLICE_SIZE];
+    uint64_t *segLen = new uint64_t[PMEBA_SLICE_SIZE];
+    uint64_t *segBucket = new uint64_t[PMEBA_SLICE_SIZE];
+    FieldElement *dens = new FieldElement[PMEBA_SLICE_SIZE/2];
+    FieldElement *invs = new FieldElement[PMEBA_SLICE_SIZE/2];
+
+    uint64_t bucket = bucketFirst;
+    for (uint64_t sliceBegin=entryBegin; sliceBegin<entryEnd; sliceBegin+=PMEBA_SLICE_SIZE) {
+        uint64_t sliceEnd = std::min(sliceBegin + PMEBA_SLICE_SIZE, entryEnd);
+
+        // Load the points of the slice, with a segment per bucket
+        uint64_t nSegs = 0;
+        for (uint64_t e=sliceBegin; e<sliceEnd; e++) {
+            while (e >= bucketStart[bucket+1]) bucket++;
+            if ((nSegs == 0) || (segBucket[nSegs-1] != bucket)) {
+                segStart[nSegs] = e - sliceBegin;
+                segLen[nSegs] = 0;
+                segBucket[nSegs] = bucket;
+                nSegs++;
+            }
+            segLen[nSegs-1]++;
+            uint32_t entry = entries[e];
+            if (entry & PMEBA_SIGN) {
+                g.neg(points[e - sliceBegin], bases[entry & ~PMEBA_SIGN]);
+            } else {
+                g.copy(points[e - sliceBegin], bases[entry]);
+            }
+        }
+
+        reduceSlice(points, segStart, segLen, nSegs, dens, invs);
+
+        for (uint64_t s=0; s<nSegs; s++) {
+            g.add(buckets[segBucket[s] - bucketFirst], buckets[segBucket[s] - bucketFirst], points[segStart[s]]);
+        }
+    }
+
+    // Running sum from the last bucket: sum = sum((b-bucketFirst+1)*B_b), acc = sum(B_b)
+    typename Curve::Point acc, sum;
+    g.copy(acc, g.zero());
+    g.copy(sum, g.zero());
+    for (int64_t b=nTaskBuckets-1; b>=0; b--) {
+        g.add(acc, acc, buckets[b]);
+        g.add(sum, sum, acc);
+    }
+    if (bucketFirst > 1) {
+        typename Curve::Point tmp;
+        uint64_t k = bucketFirst - 1;
+        g.mulByScalar(tmp, acc, (uint8_t *)&k, sizeof(k));
+        g.add(sum, sum, tmp);
+    }
+    g.copy(res, sum);
+
+    delete[] buckets;
+    delete[] points;
+    delete[] segStart;
+    delete[] segLen;
+    delete[] segBucket;
+    delete[] dens;
+    delete[] invs;
+}
+
+template <typename Curve>
+void BatchAffineMultiexp<Curve>::processWindow(typename Curve::Point &res, uint64_t idxWindow) {
+    computeDigits(idxWindow);
+    sortEntries();
+
+    uint64_t nEntries = bucketStart[nBuckets + 1];
+    uint64_t nTasks = nThreads*PMEBA_TASKS_PER_THREAD;
+    typename Curve::Point *taskResults = new typename Curve::Point[nTasks];
+
+    #pragma omp parallel for schedule(dynamic)
+    for (uint64_t t=0; t<nTasks; t++) {
+        processTask(taskResults[t], t*nEntries/nTasks, (t+1)*nEntries/nTasks);
+    }
+
+    g.copy(res, g.zero());
+    for (uint64_t t=0; t<nTasks; t++) {
+        g.add(res, res, taskResults[t]);
+    }
+
+    delete[] taskResults;
+}
+
+template <typename Curve>
+void BatchAffineMultiexp<Curve>::run(typename Curve::Point &r, uint64_t _nThreads) {
+    nThreads = _nThreads==0 ? omp_get_max_threads() : _nThreads;
+
+    ThreadLimit threadLimit (nThreads);
+
+    if (n==0) {
+        g.copy(r, g.zero());
+        return;
+    }
+    if (n==1) {
+        g.mulByScalar(r, bases[0], scalars, scalarSize);
+        return;
+    }
+    // Entries keep the base index in 31 bits
+    if (n >= PMEBA_SIGN) {
+        ParallelMultiexp<Curve> pm(g);
+        if (nx == 0) {
+            pm.multiexp(r, bases, scalars, scalarSize, n, nThreads);
+        } else {
+            pm.multiexp(r, bases, scalars, scalarSize, n, nx, x, nThreads);
+        }
+        return;
+    }
+
+    bitsPerWindow = log2((uint32_t)(n / PMEBA_PACK_FACTOR));
+    if (bitsPerWindow > PMEBA_MAX_WINDOW_BITS) bitsPerWindow = PMEBA_MAX_WINDOW_BITS;
+    if (bitsPerWindow < PMEBA_MIN_WINDOW_BITS) bitsPerWindow = PMEBA_MIN_WINDOW_BITS;
+    nBuckets = 1 << (bitsPerWindow - 1);
+    nWindows = (scalarSize*8) / bitsPerWindow + 1; // The last window only holds the carry of the previous one
+
+    state = new uint8_t[n];
+    digits = new uint32_t[n];
+    entries = new uint32_t[n];
+    bucketStart = new uint64_t[nBuckets + 2];
+    threadCounts = new uint64_t[nThreads*(nBuckets + 1)];
+    typename Curve::Point *windowResults = new typename Curve::Point[nWindows];
+
+    initState();
+    for (uint64_t i=0; i<nWindows; i++) {
+        processWindow(windowResults[i], i);
+    }
+
+    delete[] state;
+    delete[] digits;
+    delete[] entries;
+    delete[] bucketStart;
+    delete[] threadCounts;
+
+    g.copy(r, windowResults[nWindows-1]);
+    for (int64_t j=nWindows-2; j>=0; j--) {
+        for (uint64_t k=0; k<bitsPerWindow; k++) g.dbl(r, r);
+        g.add(r, r, windowResults[j]);
+    }
+
+    delete[] windowResults;
+}
+
+template <typename Curve>
+void BatchAffineMultiexp<Curve>::multiexp(typename Curve::Point &r, typename Curve::PointAffine *_bases, uint8_t* _scalars, uint64_t _scalarSize, uint64_t _n, uint64_t _nThreads) {
+    bases = _bases;
+    scalars = _scalars;
+    scalarSize = _scalarSize;
+    n = _n;
+    nx = 0;
+    x = NULL;
+    run(r, _nThreads);
+}
+
+template <typename Curve>
+void BatchAffineMultiexp<Curve>::multiexp(typename Curve::Point &r,
+                                          typename Curve::PointAffine *_bases,
+                                          uint8_t* _scalars,
+                                          uint64_t _scalarSize,
+                                          uint64_t _n,
+                                          uint64_t _nx,
+                                          uint64_t _x[],
+                                          uint64_t _nThreads) {
+    bases = _bases;
+    scalars = _scalars;
+    scalarSize = _scalarSize;
+    n = _n;
+    nx = _nx;
+    x = _x;
+    run(r, _nThreads);
+}
@@ -0,0 +1,78 @@
+#ifndef BATCH_AFFINE_MULTIEXP
+#define BATCH_AFFINE_MULTIEXP
+
+#include <cstdint>
+#include "multiexp.hpp"
+
+#define PMEBA_PACK_FACTOR 2
+#define PMEBA_MAX_WINDOW_BITS 16
+#define PMEBA_MIN_WINDOW_BITS 2
+#define PMEBA_SLICE_SIZE 4096 // Max number of points added together with a single batch inversion per round
+#define PMEBA_TASKS_PER_THREAD 4
+#define PMEBA_SIGN 0x80000000 // Sign bit of the digits and sorted entries
+#define PMEBA_STATE_CARRY 0x1 // Carry of the signed digit of the previous window
+#define PMEBA_STATE_SKIP 0x2 // Zero base, or base excluded by x
+
+/*
+    Pippenger multiexponentiation with signed digit windows and batch affine bucket accumulation.
+
+    Every window of the scalars is recoded as a signed digit (getSignedWindow() in naf.cpp), so a window of
+    bitsPerWindow bits only needs 2^(bitsPerWindow-1) buckets, and a negative digit adds the negated base.
+
+    For every window, the bases are partitioned by bucket with a counting sort of their indexes, so that every
+    base of a window is read once, by the thread that owns its bucket, instead of every thread keeping a copy
+    of all the buckets that must be merged afterwards.  The sorted entries are split in tasks of the same size,
+    and every task sums the points of its buckets in slices: the points of every bucket of a slice are added in
+    pairs, in affine coordinates, sharing a single Montgomery batch inversion per round, until one point per
+    bucket remains.  A bucket split across tasks is just summed partially by each of them, since the window sum,
+    i.e. sum(bucket*B_bucket), is linear in the bucket points.
+*/
+template <typename Curve>
+class BatchAffineMultiexp {
+
+    typedef typename Curve::Field::Element FieldElement;
+
+    typename Curve::PointAffine *bases;
+    uint8_t* scalars;
+    uint64_t scalarSize;
+    uint64_t n;
+    uint64_t nx;
+    uint64_t *x;
+    uint64_t nThreads;
+    uint64_t bitsPerWindow;
+    uint64_t nBuckets;
+    uint64_t nWindows;
+    Curve &g;
+
+    uint8_t *state; // Per base: PMEBA_STATE_CARRY and PMEBA_STATE_SKIP flags
+    uint32_t *digits; // Per base: bucket of the current window, plus PMEBA_SIGN if negative; 0 if none
+    uint32_t *entries; // Base indexes, plus PMEBA_SIGN if negative, sorted by bucket
+    uint64_t *bucketStart; // First entry of every bucket, plus the number of entries at nBuckets+1
+    uint64_t *threadCounts; // Entries of every bucket found by every thread
+
+    bool isIncluded(uint64_t i);
+    void initState();
+    void computeDigits(uint64_t idxWindow);
+    void sortEntries();
+    void reduceSlice(typename Curve::PointAffine *points, uint64_t *segStart, uint64_t *segLen, uint64_t nSegs, FieldElement *dens, FieldElement *invs);
+    void processTask(typename Curve::Point &res, uint64_t entryBegin, uint64_t entryEnd);
+    void processWindow(typename Curve::Point &res, uint64_t idxWindow);
+    void run(typename Curve::Point &r, uint64_t _nThreads);
+
+public:
+    BatchAffineMultiexp(Curve &_g): g(_g) {}
+    void multiexp(typename Curve::Point &r, typename Curve::PointAffine *_bases, uint8_t* _scalars, uint64_t _scalarSize, uint64_t _n, uint64_t _nThreads=0);
+    void multiexp(typename Curve::Point &r,
+                  typename Curve::PointAffine *_bases,
+                  uint8_t* _scalars,
+                  uint64_t _scalarSize,
+                  uint64_t _n,
+                  uint64_t _nx,
+                  uint64_t _x[],
+                  uint64_t _nThreads=0);
+
+};
+
+#include "multiexp_ba.c.hpp"
+
+#endif // BATCH_AFFINE_MULTIEXP
@@ -74,3 +74,28 @@ void buildNaf(uint8_t *r, uint8_t* scalar, unsigned int scalarSize) {
 }
 
 static bool tableBulded = buildNafTable();
+
+int64_t getSignedWindow(uint8_t* scalar, unsigned int scalarSize, unsigned int bitsPerWindow, unsigned int idxWindow, bool &carry) {
+    uint64_t bitStart = (uint64_t)idxWindow*bitsPerWindow;
+    uint64_t scalarBits = (uint64_t)scalarSize*8;
+    uint64_t v = 0;
+
+    if (bitStart < scalarBits) {
+        uint64_t byteStart = bitStart/8;
+        uint64_t nBytes = scalarSize - byteStart;
+        if (nBytes > 8) nBytes = 8;
+        for (uint64_t i=0; i<nBytes; i++) v |= ((uint64_t)scalar[byteStart + i]) << (i*8);
+        v = v >> (bitStart - byteStart*8);
+        uint64_t efectiveBits = scalarBits - bitStart;
+        if (efectiveBits > bitsPerWindow) efectiveBits = bitsPerWindow;
+        v = v & ((1ULL << efectiveBits) - 1);
+    }
+    if (carry) v++;
+
+    if (v > (1ULL << (bitsPerWindow-1))) {
+        carry = true;
+        return (int64_t)v - (int64_t)(1ULL << bitsPerWindow);
+    }
+    carry = false;
+    return (int64_t)v;
+}
@@ -1,3 +1,8 @@
 #include <stdint.h>
 
 void buildNaf(uint8_t *r, uint8_t* scalar, unsigned int scalarSize);
+
+// Signed digit of window idxWindow of bitsPerWindow bits of the little endian scalar, in the range
+// [-2^(bitsPerWindow-1)+1, 2^(bitsPerWindow-1)]; carry is the carry of the previous window on input, and the
+// carry of this window on output, so windows must be computed from the lowest one, starting with carry=false
+int64_t getSignedWindow(uint8_t* scalar, unsigned int scalarSize, unsigned int bitsPerWindow, unsigned int idxWindow, bool &carry);
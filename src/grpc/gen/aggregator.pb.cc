@@ -27,7 +27,7 @@ extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::inte
 extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetProofRequest_aggregator_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetProofResponse_aggregator_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetStatusRequest_aggregator_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetStatusResponse_aggregator_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetStatusResponse_aggregator_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_InputProver_aggregator_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_InputProver_ContractsBytecodeEntry_DoNotUse_aggregator_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_InputProver_DbEntry_DoNotUse_aggregator_2eproto;
@@ -35,6 +35,7 @@ extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::inte
 extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_PublicInputs_aggregator_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_PublicInputs_L1InfoTreeDataEntry_DoNotUse_aggregator_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_PublicInputsExtended_aggregator_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RequestQueueStatus_aggregator_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_StatelessInputProver_aggregator_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_StatelessPublicInputs_aggregator_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_aggregator_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_StatelessPublicInputs_L1InfoTreeDataEntry_DoNotUse_aggregator_2eproto;
@@ -97,6 +98,10 @@ class GetStatusResponseDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetStatusResponse> _instance;
 } _GetStatusResponse_default_instance_;
+class RequestQueueStatusDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RequestQueueStatus> _instance;
+} _RequestQueueStatus_default_instance_;
 class GenBatchProofResponseDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GenBatchProofResponse> _instance;
@@ -383,8 +388,9 @@ static void InitDefaultsscc_info_GetStatusResponse_aggregator_2eproto() {
   ::aggregator::v1::GetStatusResponse::InitAsDefaultInstance();
 }
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetStatusResponse_aggregator_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GetStatusResponse_aggregator_2eproto}, {}};
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetStatusResponse_aggregator_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GetStatusResponse_aggregator_2eproto}, {
+      &scc_info_RequestQueueStatus_aggregator_2eproto.base,}};
 
 static void InitDefaultsscc_info_InputProver_aggregator_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -507,6 +513,20 @@ static void InitDefaultsscc_info_PublicInputsExtended_aggregator_2eproto() {
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_PublicInputsExtended_aggregator_2eproto}, {
       &scc_info_PublicInputs_aggregator_2eproto.base,}};
 
+static void InitDefaultsscc_info_RequestQueueStatus_aggregator_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::aggregator::v1::_RequestQueueStatus_default_instance_;
+    new (ptr) ::aggregator::v1::RequestQueueStatus();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::aggregator::v1::RequestQueueStatus::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RequestQueueStatus_aggregator_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RequestQueueStatus_aggregator_2eproto}, {}};
+
 static void InitDefaultsscc_info_StatelessInputProver_aggregator_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -565,7 +585,7 @@ static void InitDefaultsscc_info_Version_aggregator_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Version_aggregator_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Version_aggregator_2eproto}, {}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_aggregator_2eproto[27];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_aggregator_2eproto[28];
 static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_aggregator_2eproto[3];
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_aggregator_2eproto = nullptr;
 
@@ -614,12 +634,14 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_aggregator_2eproto::offsets[]
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenBatchProofRequest, input_),
+  PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenBatchProofRequest, deadline_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenStatelessBatchProofRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenStatelessBatchProofRequest, input_),
+  PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenStatelessBatchProofRequest, deadline_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenAggregatedProofRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -627,6 +649,7 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_aggregator_2eproto::offsets[]
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenAggregatedProofRequest, recursive_proof_1_),
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenAggregatedProofRequest, recursive_proof_2_),
+  PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenAggregatedProofRequest, deadline_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenFinalProofRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -634,6 +657,7 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_aggregator_2eproto::offsets[]
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenFinalProofRequest, recursive_proof_),
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenFinalProofRequest, aggregator_addr_),
+  PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenFinalProofRequest, deadline_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::CancelRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -666,6 +690,17 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_aggregator_2eproto::offsets[]
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GetStatusResponse, total_memory_),
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GetStatusResponse, free_memory_),
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GetStatusResponse, fork_id_),
+  PROTOBUF_FIELD_OFFSET(::aggregator::v1::GetStatusResponse, request_queue_status_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::aggregator::v1::RequestQueueStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::aggregator::v1::RequestQueueStatus, request_type_),
+  PROTOBUF_FIELD_OFFSET(::aggregator::v1::RequestQueueStatus, depth_),
+  PROTOBUF_FIELD_OFFSET(::aggregator::v1::RequestQueueStatus, oldest_wait_time_),
+  PROTOBUF_FIELD_OFFSET(::aggregator::v1::RequestQueueStatus, average_wait_time_),
+  PROTOBUF_FIELD_OFFSET(::aggregator::v1::RequestQueueStatus, average_service_time_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::aggregator::v1::GenBatchProofResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -818,28 +853,29 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 20, -1, sizeof(::aggregator::v1::ProverMessage)},
   { 33, -1, sizeof(::aggregator::v1::GetStatusRequest)},
   { 38, -1, sizeof(::aggregator::v1::GenBatchProofRequest)},
-  { 44, -1, sizeof(::aggregator::v1::GenStatelessBatchProofRequest)},
-  { 50, -1, sizeof(::aggregator::v1::GenAggregatedProofRequest)},
-  { 57, -1, sizeof(::aggregator::v1::GenFinalProofRequest)},
-  { 64, -1, sizeof(::aggregator::v1::CancelRequest)},
-  { 70, -1, sizeof(::aggregator::v1::GetProofRequest)},
-  { 77, -1, sizeof(::aggregator::v1::GetStatusResponse)},
-  { 96, -1, sizeof(::aggregator::v1::GenBatchProofResponse)},
-  { 103, -1, sizeof(::aggregator::v1::GenAggregatedProofResponse)},
-  { 110, -1, sizeof(::aggregator::v1::GenFinalProofResponse)},
-  { 117, -1, sizeof(::aggregator::v1::CancelResponse)},
-  { 123, -1, sizeof(::aggregator::v1::GetProofResponse)},
-  { 134, -1, sizeof(::aggregator::v1::FinalProof)},
-  { 141, 148, sizeof(::aggregator::v1::PublicInputs_L1InfoTreeDataEntry_DoNotUse)},
-  { 150, -1, sizeof(::aggregator::v1::PublicInputs)},
-  { 167, 174, sizeof(::aggregator::v1::StatelessPublicInputs_L1InfoTreeDataEntry_DoNotUse)},
-  { 176, -1, sizeof(::aggregator::v1::StatelessPublicInputs)},
-  { 190, -1, sizeof(::aggregator::v1::L1Data)},
-  { 199, 206, sizeof(::aggregator::v1::InputProver_DbEntry_DoNotUse)},
-  { 208, 215, sizeof(::aggregator::v1::InputProver_ContractsBytecodeEntry_DoNotUse)},
-  { 217, -1, sizeof(::aggregator::v1::InputProver)},
-  { 225, -1, sizeof(::aggregator::v1::StatelessInputProver)},
-  { 231, -1, sizeof(::aggregator::v1::PublicInputsExtended)},
+  { 45, -1, sizeof(::aggregator::v1::GenStatelessBatchProofRequest)},
+  { 52, -1, sizeof(::aggregator::v1::GenAggregatedProofRequest)},
+  { 60, -1, sizeof(::aggregator::v1::GenFinalProofRequest)},
+  { 68, -1, sizeof(::aggregator::v1::CancelRequest)},
+  { 74, -1, sizeof(::aggregator::v1::GetProofRequest)},
+  { 81, -1, sizeof(::aggregator::v1::GetStatusResponse)},
+  { 101, -1, sizeof(::aggregator::v1::RequestQueueStatus)},
+  { 111, -1, sizeof(::aggregator::v1::GenBatchProofResponse)},
+  { 118, -1, sizeof(::aggregator::v1::GenAggregatedProofResponse)},
+  { 125, -1, sizeof(::aggregator::v1::GenFinalProofResponse)},
+  { 132, -1, sizeof(::aggregator::v1::CancelResponse)},
+  { 138, -1, sizeof(::aggregator::v1::GetProofResponse)},
+  { 149, -1, sizeof(::aggregator::v1::FinalProof)},
+  { 156, 163, sizeof(::aggregator::v1::PublicInputs_L1InfoTreeDataEntry_DoNotUse)},
+  { 165, -1, sizeof(::aggregator::v1::PublicInputs)},
+  { 182, 189, sizeof(::aggregator::v1::StatelessPublicInputs_L1InfoTreeDataEntry_DoNotUse)},
+  { 191, -1, sizeof(::aggregator::v1::StatelessPublicInputs)},
+  { 205, -1, sizeof(::aggregator::v1::L1Data)},
+  { 214, 221, sizeof(::aggregator::v1::InputProver_DbEntry_DoNotUse)},
+  { 223, 230, sizeof(::aggregator::v1::InputProver_ContractsBytecodeEntry_DoNotUse)},
+  { 232, -1, sizeof(::aggregator::v1::InputProver)},
+  { 240, -1, sizeof(::aggregator::v1::StatelessInputProver)},
+  { 246, -1, sizeof(::aggregator::v1::PublicInputsExtended)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -854,6 +890,7 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::aggregator::v1::_CancelRequest_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::aggregator::v1::_GetProofRequest_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::aggregator::v1::_GetStatusResponse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::aggregator::v1::_RequestQueueStatus_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::aggregator::v1::_GenBatchProofResponse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::aggregator::v1::_GenAggregatedProofResponse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::aggregator::v1::_GenFinalProofResponse_default_instance_),
@@ -900,30 +937,37 @@ const char descriptor_table_protodef_aggregator_2eproto[] PROTOBUF_SECTION_VARIA
   "regator.v1.CancelResponseH\000\022=\n\022get_proof"
   "_response\030\007 \001(\0132\037.aggregator.v1.GetProof"
   "ResponseH\000B\n\n\010response\"\022\n\020GetStatusReque"
-  "st\"A\n\024GenBatchProofRequest\022)\n\005input\030\001 \001("
-  "\0132\032.aggregator.v1.InputProver\"S\n\035GenStat"
-  "elessBatchProofRequest\0222\n\005input\030\001 \001(\0132#."
-  "aggregator.v1.StatelessInputProver\"Q\n\031Ge"
-  "nAggregatedProofRequest\022\031\n\021recursive_pro"
-  "of_1\030\001 \001(\t\022\031\n\021recursive_proof_2\030\002 \001(\t\"H\n"
-  "\024GenFinalProofRequest\022\027\n\017recursive_proof"
-  "\030\001 \001(\t\022\027\n\017aggregator_addr\030\002 \001(\t\"\033\n\rCance"
-  "lRequest\022\n\n\002id\030\001 \001(\t\".\n\017GetProofRequest\022"
-  "\n\n\002id\030\001 \001(\t\022\017\n\007timeout\030\002 \001(\004\"\227\004\n\021GetStat"
-  "usResponse\0227\n\006status\030\001 \001(\0162\'.aggregator."
-  "v1.GetStatusResponse.Status\022 \n\030last_comp"
-  "uted_request_id\030\002 \001(\t\022\036\n\026last_computed_e"
-  "nd_time\030\003 \001(\004\022$\n\034current_computing_reque"
-  "st_id\030\004 \001(\t\022$\n\034current_computing_start_t"
-  "ime\030\005 \001(\004\022\025\n\rversion_proto\030\006 \001(\t\022\026\n\016vers"
-  "ion_server\030\007 \001(\t\022!\n\031pending_request_queu"
-  "e_ids\030\010 \003(\t\022\023\n\013prover_name\030\t \001(\t\022\021\n\tprov"
-  "er_id\030\n \001(\t\022\027\n\017number_of_cores\030\013 \001(\004\022\024\n\014"
-  "total_memory\030\014 \001(\004\022\023\n\013free_memory\030\r \001(\004\022"
-  "\017\n\007fork_id\030\016 \001(\004\"l\n\006Status\022\026\n\022STATUS_UNS"
-  "PECIFIED\020\000\022\022\n\016STATUS_BOOTING\020\001\022\024\n\020STATUS"
-  "_COMPUTING\020\002\022\017\n\013STATUS_IDLE\020\003\022\017\n\013STATUS_"
-  "HALT\020\004\"J\n\025GenBatchProofResponse\022\n\n\002id\030\001 "
+  "st\"S\n\024GenBatchProofRequest\022)\n\005input\030\001 \001("
+  "\0132\032.aggregator.v1.InputProver\022\020\n\010deadlin"
+  "e\030\002 \001(\004\"e\n\035GenStatelessBatchProofRequest"
+  "\0222\n\005input\030\001 \001(\0132#.aggregator.v1.Stateles"
+  "sInputProver\022\020\n\010deadline\030\002 \001(\004\"c\n\031GenAgg"
+  "regatedProofRequest\022\031\n\021recursive_proof_1"
+  "\030\001 \001(\t\022\031\n\021recursive_proof_2\030\002 \001(\t\022\020\n\010dea"
+  "dline\030\003 \001(\004\"Z\n\024GenFinalProofRequest\022\027\n\017r"
+  "ecursive_proof\030\001 \001(\t\022\027\n\017aggregator_addr\030"
+  "\002 \001(\t\022\020\n\010deadline\030\003 \001(\004\"\033\n\rCancelRequest"
+  "\022\n\n\002id\030\001 \001(\t\".\n\017GetProofRequest\022\n\n\002id\030\001 "
+  "\001(\t\022\017\n\007timeout\030\002 \001(\004\"\330\004\n\021GetStatusRespon"
+  "se\0227\n\006status\030\001 \001(\0162\'.aggregator.v1.GetSt"
+  "atusResponse.Status\022 \n\030last_computed_req"
+  "uest_id\030\002 \001(\t\022\036\n\026last_computed_end_time\030"
+  "\003 \001(\004\022$\n\034current_computing_request_id\030\004 "
+  "\001(\t\022$\n\034current_computing_start_time\030\005 \001("
+  "\004\022\025\n\rversion_proto\030\006 \001(\t\022\026\n\016version_serv"
+  "er\030\007 \001(\t\022!\n\031pending_request_queue_ids\030\010 "
+  "\003(\t\022\023\n\013prover_name\030\t \001(\t\022\021\n\tprover_id\030\n "
+  "\001(\t\022\027\n\017number_of_cores\030\013 \001(\004\022\024\n\014total_me"
+  "mory\030\014 \001(\004\022\023\n\013free_memory\030\r \001(\004\022\017\n\007fork_"
+  "id\030\016 \001(\004\022\?\n\024request_queue_status\030\017 \003(\0132!"
+  ".aggregator.v1.RequestQueueStatus\"l\n\006Sta"
+  "tus\022\026\n\022STATUS_UNSPECIFIED\020\000\022\022\n\016STATUS_BO"
+  "OTING\020\001\022\024\n\020STATUS_COMPUTING\020\002\022\017\n\013STATUS_"
+  "IDLE\020\003\022\017\n\013STATUS_HALT\020\004\"\214\001\n\022RequestQueue"
+  "Status\022\024\n\014request_type\030\001 \001(\t\022\r\n\005depth\030\002 "
+  "\001(\004\022\030\n\020oldest_wait_time\030\003 \001(\004\022\031\n\021average"
+  "_wait_time\030\004 \001(\004\022\034\n\024average_service_time"
+  "\030\005 \001(\004\"J\n\025GenBatchProofResponse\022\n\n\002id\030\001 "
   "\001(\t\022%\n\006result\030\002 \001(\0162\025.aggregator.v1.Resu"
   "lt\"O\n\032GenAggregatedProofResponse\022\n\n\002id\030\001"
   " \001(\t\022%\n\006result\030\002 \001(\0162\025.aggregator.v1.Res"
@@ -989,7 +1033,7 @@ const char descriptor_table_protodef_aggregator_2eproto[] PROTOBUF_SECTION_VARIA
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_aggregator_2eproto_deps[1] = {
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_aggregator_2eproto_sccs[27] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_aggregator_2eproto_sccs[28] = {
   &scc_info_AggregatorMessage_aggregator_2eproto.base,
   &scc_info_CancelRequest_aggregator_2eproto.base,
   &scc_info_CancelResponse_aggregator_2eproto.base,
@@ -1013,6 +1057,7 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_agg
   &scc_info_PublicInputs_aggregator_2eproto.base,
   &scc_info_PublicInputs_L1InfoTreeDataEntry_DoNotUse_aggregator_2eproto.base,
   &scc_info_PublicInputsExtended_aggregator_2eproto.base,
+  &scc_info_RequestQueueStatus_aggregator_2eproto.base,
   &scc_info_StatelessInputProver_aggregator_2eproto.base,
   &scc_info_StatelessPublicInputs_aggregator_2eproto.base,
   &scc_info_StatelessPublicInputs_L1InfoTreeDataEntry_DoNotUse_aggregator_2eproto.base,
@@ -1020,10 +1065,10 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_agg
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_aggregator_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_aggregator_2eproto = {
-  false, false, descriptor_table_protodef_aggregator_2eproto, "aggregator.proto", 4484,
-  &descriptor_table_aggregator_2eproto_once, descriptor_table_aggregator_2eproto_sccs, descriptor_table_aggregator_2eproto_deps, 27, 0,
+  false, false, descriptor_table_protodef_aggregator_2eproto, "aggregator.proto", 4764,
+  &descriptor_table_aggregator_2eproto_once, descriptor_table_aggregator_2eproto_sccs, descriptor_table_aggregator_2eproto_deps, 28, 0,
   schemas, file_default_instances, TableStruct_aggregator_2eproto::offsets,
-  file_level_metadata_aggregator_2eproto, 27, file_level_enum_descriptors_aggregator_2eproto, file_level_service_descriptors_aggregator_2eproto,
+  file_level_metadata_aggregator_2eproto, 28, file_level_enum_descriptors_aggregator_2eproto, file_level_service_descriptors_aggregator_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -2748,12 +2793,15 @@ GenBatchProofRequest::GenBatchProofRequest(const GenBatchProofRequest& from)
   } else {
     input_ = nullptr;
   }
+  deadline_ = from.deadline_;
   // @@protoc_insertion_point(copy_constructor:aggregator.v1.GenBatchProofRequest)
 }
 
 void GenBatchProofRequest::SharedCtor() {
   ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GenBatchProofRequest_aggregator_2eproto.base);
-  input_ = nullptr;
+  ::memset(&input_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&deadline_) -
+      reinterpret_cast<char*>(&input_)) + sizeof(deadline_));
 }
 
 GenBatchProofRequest::~GenBatchProofRequest() {
@@ -2792,6 +2840,7 @@ void GenBatchProofRequest::Clear() {
     delete input_;
   }
   input_ = nullptr;
+  deadline_ = PROTOBUF_ULONGLONG(0);
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -2810,6 +2859,13 @@ const char* GenBatchProofRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAM
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // uint64 deadline = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          deadline_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -2846,6 +2902,12 @@ failure:
         1, _Internal::input(this), target, stream);
   }
 
+  // uint64 deadline = 2;
+  if (this->deadline() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(2, this->_internal_deadline(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2869,6 +2931,13 @@ size_t GenBatchProofRequest::ByteSizeLong() const {
         *input_);
   }
 
+  // uint64 deadline = 2;
+  if (this->deadline() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_deadline());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -2903,6 +2972,9 @@ void GenBatchProofRequest::MergeFrom(const GenBatchProofRequest& from) {
   if (from.has_input()) {
     _internal_mutable_input()->::aggregator::v1::InputProver::MergeFrom(from._internal_input());
   }
+  if (from.deadline() != 0) {
+    _internal_set_deadline(from._internal_deadline());
+  }
 }
 
 void GenBatchProofRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -2926,7 +2998,12 @@ bool GenBatchProofRequest::IsInitialized() const {
 void GenBatchProofRequest::InternalSwap(GenBatchProofRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(input_, other->input_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GenBatchProofRequest, deadline_)
+      + sizeof(GenBatchProofRequest::deadline_)
+      - PROTOBUF_FIELD_OFFSET(GenBatchProofRequest, input_)>(
+          reinterpret_cast<char*>(&input_),
+          reinterpret_cast<char*>(&other->input_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GenBatchProofRequest::GetMetadata() const {
@@ -2963,12 +3040,15 @@ GenStatelessBatchProofRequest::GenStatelessBatchProofRequest(const GenStatelessB
   } else {
     input_ = nullptr;
   }
+  deadline_ = from.deadline_;
   // @@protoc_insertion_point(copy_constructor:aggregator.v1.GenStatelessBatchProofRequest)
 }
 
 void GenStatelessBatchProofRequest::SharedCtor() {
   ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GenStatelessBatchProofRequest_aggregator_2eproto.base);
-  input_ = nullptr;
+  ::memset(&input_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&deadline_) -
+      reinterpret_cast<char*>(&input_)) + sizeof(deadline_));
 }
 
 GenStatelessBatchProofRequest::~GenStatelessBatchProofRequest() {
@@ -3007,6 +3087,7 @@ void GenStatelessBatchProofRequest::Clear() {
     delete input_;
   }
   input_ = nullptr;
+  deadline_ = PROTOBUF_ULONGLONG(0);
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -3025,6 +3106,13 @@ const char* GenStatelessBatchProofRequest::_InternalParse(const char* ptr, ::PRO
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // uint64 deadline = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          deadline_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -3061,6 +3149,12 @@ failure:
         1, _Internal::input(this), target, stream);
   }
 
+  // uint64 deadline = 2;
+  if (this->deadline() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(2, this->_internal_deadline(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3084,6 +3178,13 @@ size_t GenStatelessBatchProofRequest::ByteSizeLong() const {
         *input_);
   }
 
+  // uint64 deadline = 2;
+  if (this->deadline() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_deadline());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -3118,6 +3219,9 @@ void GenStatelessBatchProofRequest::MergeFrom(const GenStatelessBatchProofReques
   if (from.has_input()) {
     _internal_mutable_input()->::aggregator::v1::StatelessInputProver::MergeFrom(from._internal_input());
   }
+  if (from.deadline() != 0) {
+    _internal_set_deadline(from._internal_deadline());
+  }
 }
 
 void GenStatelessBatchProofRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -3141,7 +3245,12 @@ bool GenStatelessBatchProofRequest::IsInitialized() const {
 void GenStatelessBatchProofRequest::InternalSwap(GenStatelessBatchProofRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(input_, other->input_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GenStatelessBatchProofRequest, deadline_)
+      + sizeof(GenStatelessBatchProofRequest::deadline_)
+      - PROTOBUF_FIELD_OFFSET(GenStatelessBatchProofRequest, input_)>(
+          reinterpret_cast<char*>(&input_),
+          reinterpret_cast<char*>(&other->input_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GenStatelessBatchProofRequest::GetMetadata() const {
@@ -3176,6 +3285,7 @@ GenAggregatedProofRequest::GenAggregatedProofRequest(const GenAggregatedProofReq
     recursive_proof_2_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_recursive_proof_2(),
       GetArena());
   }
+  deadline_ = from.deadline_;
   // @@protoc_insertion_point(copy_constructor:aggregator.v1.GenAggregatedProofRequest)
 }
 
@@ -3183,6 +3293,7 @@ void GenAggregatedProofRequest::SharedCtor() {
   ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GenAggregatedProofRequest_aggregator_2eproto.base);
   recursive_proof_1_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   recursive_proof_2_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  deadline_ = PROTOBUF_ULONGLONG(0);
 }
 
 GenAggregatedProofRequest::~GenAggregatedProofRequest() {
@@ -3220,6 +3331,7 @@ void GenAggregatedProofRequest::Clear() {
 
   recursive_proof_1_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   recursive_proof_2_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  deadline_ = PROTOBUF_ULONGLONG(0);
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -3249,6 +3361,13 @@ const char* GenAggregatedProofRequest::_InternalParse(const char* ptr, ::PROTOBU
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // uint64 deadline = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          deadline_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -3297,6 +3416,12 @@ failure:
         2, this->_internal_recursive_proof_2(), target);
   }
 
+  // uint64 deadline = 3;
+  if (this->deadline() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(3, this->_internal_deadline(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3327,6 +3452,13 @@ size_t GenAggregatedProofRequest::ByteSizeLong() const {
         this->_internal_recursive_proof_2());
   }
 
+  // uint64 deadline = 3;
+  if (this->deadline() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_deadline());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -3364,6 +3496,9 @@ void GenAggregatedProofRequest::MergeFrom(const GenAggregatedProofRequest& from)
   if (from.recursive_proof_2().size() > 0) {
     _internal_set_recursive_proof_2(from._internal_recursive_proof_2());
   }
+  if (from.deadline() != 0) {
+    _internal_set_deadline(from._internal_deadline());
+  }
 }
 
 void GenAggregatedProofRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -3389,6 +3524,7 @@ void GenAggregatedProofRequest::InternalSwap(GenAggregatedProofRequest* other) {
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   recursive_proof_1_.Swap(&other->recursive_proof_1_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   recursive_proof_2_.Swap(&other->recursive_proof_2_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(deadline_, other->deadline_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GenAggregatedProofRequest::GetMetadata() const {
@@ -3423,6 +3559,7 @@ GenFinalProofRequest::GenFinalProofRequest(const GenFinalProofRequest& from)
     aggregator_addr_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_aggregator_addr(),
       GetArena());
   }
+  deadline_ = from.deadline_;
   // @@protoc_insertion_point(copy_constructor:aggregator.v1.GenFinalProofRequest)
 }
 
@@ -3430,6 +3567,7 @@ void GenFinalProofRequest::SharedCtor() {
   ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GenFinalProofRequest_aggregator_2eproto.base);
   recursive_proof_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   aggregator_addr_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  deadline_ = PROTOBUF_ULONGLONG(0);
 }
 
 GenFinalProofRequest::~GenFinalProofRequest() {
@@ -3467,6 +3605,7 @@ void GenFinalProofRequest::Clear() {
 
   recursive_proof_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   aggregator_addr_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  deadline_ = PROTOBUF_ULONGLONG(0);
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -3496,6 +3635,13 @@ const char* GenFinalProofRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAM
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // uint64 deadline = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          deadline_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -3544,6 +3690,12 @@ failure:
         2, this->_internal_aggregator_addr(), target);
   }
 
+  // uint64 deadline = 3;
+  if (this->deadline() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(3, this->_internal_deadline(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3574,6 +3726,13 @@ size_t GenFinalProofRequest::ByteSizeLong() const {
         this->_internal_aggregator_addr());
   }
 
+  // uint64 deadline = 3;
+  if (this->deadline() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_deadline());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -3611,6 +3770,9 @@ void GenFinalProofRequest::MergeFrom(const GenFinalProofRequest& from) {
   if (from.aggregator_addr().size() > 0) {
     _internal_set_aggregator_addr(from._internal_aggregator_addr());
   }
+  if (from.deadline() != 0) {
+    _internal_set_deadline(from._internal_deadline());
+  }
 }
 
 void GenFinalProofRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -3636,6 +3798,7 @@ void GenFinalProofRequest::InternalSwap(GenFinalProofRequest* other) {
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   recursive_proof_.Swap(&other->recursive_proof_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   aggregator_addr_.Swap(&other->aggregator_addr_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(deadline_, other->deadline_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GenFinalProofRequest::GetMetadata() const {
@@ -4098,14 +4261,16 @@ class GetStatusResponse::_Internal {
 
 GetStatusResponse::GetStatusResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  pending_request_queue_ids_(arena) {
+  pending_request_queue_ids_(arena),
+  request_queue_status_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
   // @@protoc_insertion_point(arena_constructor:aggregator.v1.GetStatusResponse)
 }
 GetStatusResponse::GetStatusResponse(const GetStatusResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
-      pending_request_queue_ids_(from.pending_request_queue_ids_) {
+      pending_request_queue_ids_(from.pending_request_queue_ids_),
+      request_queue_status_(from.request_queue_status_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   last_computed_request_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   if (!from._internal_last_computed_request_id().empty()) {
@@ -4194,6 +4359,7 @@ void GetStatusResponse::Clear() {
   (void) cached_has_bits;
 
   pending_request_queue_ids_.Clear();
+  request_queue_status_.Clear();
   last_computed_request_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   current_computing_request_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   version_proto_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
@@ -4332,6 +4498,18 @@ const char* GetStatusResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESP
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // repeated .aggregator.v1.RequestQueueStatus request_queue_status = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_request_queue_status(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<122>(ptr));
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -4473,6 +4651,14 @@ failure:
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(14, this->_internal_fork_id(), target);
   }
 
+  // repeated .aggregator.v1.RequestQueueStatus request_queue_status = 15;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_request_queue_status_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(15, this->_internal_request_queue_status(i), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -4497,6 +4683,13 @@ size_t GetStatusResponse::ByteSizeLong() const {
       pending_request_queue_ids_.Get(i));
   }
 
+  // repeated .aggregator.v1.RequestQueueStatus request_queue_status = 15;
+  total_size += 1UL * this->_internal_request_queue_status_size();
+  for (const auto& msg : this->request_queue_status_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   // string last_computed_request_id = 2;
   if (this->last_computed_request_id().size() > 0) {
     total_size += 1 +
@@ -4619,6 +4812,7 @@ void GetStatusResponse::MergeFrom(const GetStatusResponse& from) {
   (void) cached_has_bits;
 
   pending_request_queue_ids_.MergeFrom(from.pending_request_queue_ids_);
+  request_queue_status_.MergeFrom(from.request_queue_status_);
   if (from.last_computed_request_id().size() > 0) {
     _internal_set_last_computed_request_id(from._internal_last_computed_request_id());
   }
@@ -4682,6 +4876,7 @@ void GetStatusResponse::InternalSwap(GetStatusResponse* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   pending_request_queue_ids_.InternalSwap(&other->pending_request_queue_ids_);
+  request_queue_status_.InternalSwap(&other->request_queue_status_);
   last_computed_request_id_.Swap(&other->last_computed_request_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   current_computing_request_id_.Swap(&other->current_computing_request_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   version_proto_.Swap(&other->version_proto_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
@@ -4701,6 +4896,322 @@ void GetStatusResponse::InternalSwap(GetStatusResponse* other) {
 }
 
 
+// ===================================================================
+
+void RequestQueueStatus::InitAsDefaultInstance() {
+}
+class RequestQueueStatus::_Internal {
+ public:
+};
+
+RequestQueueStatus::RequestQueueStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:aggregator.v1.RequestQueueStatus)
+}
+RequestQueueStatus::RequestQueueStatus(const RequestQueueStatus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  request_type_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_request_type().empty()) {
+    request_type_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_request_type(),
+      GetArena());
+  }
+  ::memcpy(&depth_, &from.depth_,
+    static_cast<size_t>(reinterpret_cast<char*>(&average_service_time_) -
+    reinterpret_cast<char*>(&depth_)) + sizeof(average_service_time_));
+  // @@protoc_insertion_point(copy_constructor:aggregator.v1.RequestQueueStatus)
+}
+
+void RequestQueueStatus::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RequestQueueStatus_aggregator_2eproto.base);
+  request_type_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&depth_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&average_service_time_) -
+      reinterpret_cast<char*>(&depth_)) + sizeof(average_service_time_));
+}
+
+RequestQueueStatus::~RequestQueueStatus() {
+  // @@protoc_insertion_point(destructor:aggregator.v1.RequestQueueStatus)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void RequestQueueStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  request_type_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void RequestQueueStatus::ArenaDtor(void* object) {
+  RequestQueueStatus* _this = reinterpret_cast< RequestQueueStatus* >(object);
+  (void)_this;
+}
+void RequestQueueStatus::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void RequestQueueStatus::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const RequestQueueStatus& RequestQueueStatus::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RequestQueueStatus_aggregator_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void RequestQueueStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:aggregator.v1.RequestQueueStatus)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  request_type_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::memset(&depth_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&average_service_time_) -
+      reinterpret_cast<char*>(&depth_)) + sizeof(average_service_time_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestQueueStatus::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string request_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_request_type();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "aggregator.v1.RequestQueueStatus.request_type"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 depth = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 oldest_wait_time = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          oldest_wait_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 average_wait_time = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          average_wait_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 average_service_time = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          average_service_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* RequestQueueStatus::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:aggregator.v1.RequestQueueStatus)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string request_type = 1;
+  if (this->request_type().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_request_type().data(), static_cast<int>(this->_internal_request_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "aggregator.v1.RequestQueueStatus.request_type");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_request_type(), target);
+  }
+
+  // uint64 depth = 2;
+  if (this->depth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(2, this->_internal_depth(), target);
+  }
+
+  // uint64 oldest_wait_time = 3;
+  if (this->oldest_wait_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(3, this->_internal_oldest_wait_time(), target);
+  }
+
+  // uint64 average_wait_time = 4;
+  if (this->average_wait_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(4, this->_internal_average_wait_time(), target);
+  }
+
+  // uint64 average_service_time = 5;
+  if (this->average_service_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(5, this->_internal_average_service_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:aggregator.v1.RequestQueueStatus)
+  return target;
+}
+
+size_t RequestQueueStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:aggregator.v1.RequestQueueStatus)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string request_type = 1;
+  if (this->request_type().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_request_type());
+  }
+
+  // uint64 depth = 2;
+  if (this->depth() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_depth());
+  }
+
+  // uint64 oldest_wait_time = 3;
+  if (this->oldest_wait_time() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_oldest_wait_time());
+  }
+
+  // uint64 average_wait_time = 4;
+  if (this->average_wait_time() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_average_wait_time());
+  }
+
+  // uint64 average_service_time = 5;
+  if (this->average_service_time() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_average_service_time());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RequestQueueStatus::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:aggregator.v1.RequestQueueStatus)
+  GOOGLE_DCHECK_NE(&from, this);
+  const RequestQueueStatus* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RequestQueueStatus>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:aggregator.v1.RequestQueueStatus)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:aggregator.v1.RequestQueueStatus)
+    MergeFrom(*source);
+  }
+}
+
+void RequestQueueStatus::MergeFrom(const RequestQueueStatus& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:aggregator.v1.RequestQueueStatus)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.request_type().size() > 0) {
+    _internal_set_request_type(from._internal_request_type());
+  }
+  if (from.depth() != 0) {
+    _internal_set_depth(from._internal_depth());
+  }
+  if (from.oldest_wait_time() != 0) {
+    _internal_set_oldest_wait_time(from._internal_oldest_wait_time());
+  }
+  if (from.average_wait_time() != 0) {
+    _internal_set_average_wait_time(from._internal_average_wait_time());
+  }
+  if (from.average_service_time() != 0) {
+    _internal_set_average_service_time(from._internal_average_service_time());
+  }
+}
+
+void RequestQueueStatus::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:aggregator.v1.RequestQueueStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void RequestQueueStatus::CopyFrom(const RequestQueueStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:aggregator.v1.RequestQueueStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestQueueStatus::IsInitialized() const {
+  return true;
+}
+
+void RequestQueueStatus::InternalSwap(RequestQueueStatus* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  request_type_.Swap(&other->request_type_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestQueueStatus, average_service_time_)
+      + sizeof(RequestQueueStatus::average_service_time_)
+      - PROTOBUF_FIELD_OFFSET(RequestQueueStatus, depth_)>(
+          reinterpret_cast<char*>(&depth_),
+          reinterpret_cast<char*>(&other->depth_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestQueueStatus::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
 // ===================================================================
 
 void GenBatchProofResponse::InitAsDefaultInstance() {
@@ -8661,6 +9172,9 @@ template<> PROTOBUF_NOINLINE ::aggregator::v1::GetProofRequest* Arena::CreateMay
 template<> PROTOBUF_NOINLINE ::aggregator::v1::GetStatusResponse* Arena::CreateMaybeMessage< ::aggregator::v1::GetStatusResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::aggregator::v1::GetStatusResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::aggregator::v1::RequestQueueStatus* Arena::CreateMaybeMessage< ::aggregator::v1::RequestQueueStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::aggregator::v1::RequestQueueStatus >(arena);
+}
 template<> PROTOBUF_NOINLINE ::aggregator::v1::GenBatchProofResponse* Arena::CreateMaybeMessage< ::aggregator::v1::GenBatchProofResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::aggregator::v1::GenBatchProofResponse >(arena);
 }
@@ -51,7 +51,7 @@ struct TableStruct_aggregator_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[27]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[28]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -129,6 +129,9 @@ extern PublicInputsExtendedDefaultTypeInternal _PublicInputsExtended_default_ins
 class PublicInputs_L1InfoTreeDataEntry_DoNotUse;
 class PublicInputs_L1InfoTreeDataEntry_DoNotUseDefaultTypeInternal;
 extern PublicInputs_L1InfoTreeDataEntry_DoNotUseDefaultTypeInternal _PublicInputs_L1InfoTreeDataEntry_DoNotUse_default_instance_;
+class RequestQueueStatus;
+class RequestQueueStatusDefaultTypeInternal;
+extern RequestQueueStatusDefaultTypeInternal _RequestQueueStatus_default_instance_;
 class StatelessInputProver;
 class StatelessInputProverDefaultTypeInternal;
 extern StatelessInputProverDefaultTypeInternal _StatelessInputProver_default_instance_;
@@ -167,6 +170,7 @@ template<> ::aggregator::v1::ProverMessage* Arena::CreateMaybeMessage<::aggregat
 template<> ::aggregator::v1::PublicInputs* Arena::CreateMaybeMessage<::aggregator::v1::PublicInputs>(Arena*);
 template<> ::aggregator::v1::PublicInputsExtended* Arena::CreateMaybeMessage<::aggregator::v1::PublicInputsExtended>(Arena*);
 template<> ::aggregator::v1::PublicInputs_L1InfoTreeDataEntry_DoNotUse* Arena::CreateMaybeMessage<::aggregator::v1::PublicInputs_L1InfoTreeDataEntry_DoNotUse>(Arena*);
+template<> ::aggregator::v1::RequestQueueStatus* Arena::CreateMaybeMessage<::aggregator::v1::RequestQueueStatus>(Arena*);
 template<> ::aggregator::v1::StatelessInputProver* Arena::CreateMaybeMessage<::aggregator::v1::StatelessInputProver>(Arena*);
 template<> ::aggregator::v1::StatelessPublicInputs* Arena::CreateMaybeMessage<::aggregator::v1::StatelessPublicInputs>(Arena*);
 template<> ::aggregator::v1::StatelessPublicInputs_L1InfoTreeDataEntry_DoNotUse* Arena::CreateMaybeMessage<::aggregator::v1::StatelessPublicInputs_L1InfoTreeDataEntry_DoNotUse>(Arena*);
@@ -1273,6 +1277,7 @@ class GenBatchProofRequest PROTOBUF_FINAL :
 
   enum : int {
     kInputFieldNumber = 1,
+    kDeadlineFieldNumber = 2,
   };
   // .aggregator.v1.InputProver input = 1;
   bool has_input() const;
@@ -1292,6 +1297,15 @@ class GenBatchProofRequest PROTOBUF_FINAL :
       ::aggregator::v1::InputProver* input);
   ::aggregator::v1::InputProver* unsafe_arena_release_input();
 
+  // uint64 deadline = 2;
+  void clear_deadline();
+  ::PROTOBUF_NAMESPACE_ID::uint64 deadline() const;
+  void set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_deadline() const;
+  void _internal_set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
   // @@protoc_insertion_point(class_scope:aggregator.v1.GenBatchProofRequest)
  private:
   class _Internal;
@@ -1300,6 +1314,7 @@ class GenBatchProofRequest PROTOBUF_FINAL :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   ::aggregator::v1::InputProver* input_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 deadline_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_aggregator_2eproto;
 };
@@ -1419,6 +1434,7 @@ class GenStatelessBatchProofRequest PROTOBUF_FINAL :
 
   enum : int {
     kInputFieldNumber = 1,
+    kDeadlineFieldNumber = 2,
   };
   // .aggregator.v1.StatelessInputProver input = 1;
   bool has_input() const;
@@ -1438,6 +1454,15 @@ class GenStatelessBatchProofRequest PROTOBUF_FINAL :
       ::aggregator::v1::StatelessInputProver* input);
   ::aggregator::v1::StatelessInputProver* unsafe_arena_release_input();
 
+  // uint64 deadline = 2;
+  void clear_deadline();
+  ::PROTOBUF_NAMESPACE_ID::uint64 deadline() const;
+  void set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_deadline() const;
+  void _internal_set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
   // @@protoc_insertion_point(class_scope:aggregator.v1.GenStatelessBatchProofRequest)
  private:
   class _Internal;
@@ -1446,6 +1471,7 @@ class GenStatelessBatchProofRequest PROTOBUF_FINAL :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   ::aggregator::v1::StatelessInputProver* input_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 deadline_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_aggregator_2eproto;
 };
@@ -1566,6 +1592,7 @@ class GenAggregatedProofRequest PROTOBUF_FINAL :
   enum : int {
     kRecursiveProof1FieldNumber = 1,
     kRecursiveProof2FieldNumber = 2,
+    kDeadlineFieldNumber = 3,
   };
   // string recursive_proof_1 = 1;
   void clear_recursive_proof_1();
@@ -1617,6 +1644,15 @@ class GenAggregatedProofRequest PROTOBUF_FINAL :
   std::string* _internal_mutable_recursive_proof_2();
   public:
 
+  // uint64 deadline = 3;
+  void clear_deadline();
+  ::PROTOBUF_NAMESPACE_ID::uint64 deadline() const;
+  void set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_deadline() const;
+  void _internal_set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
   // @@protoc_insertion_point(class_scope:aggregator.v1.GenAggregatedProofRequest)
  private:
   class _Internal;
@@ -1626,6 +1662,7 @@ class GenAggregatedProofRequest PROTOBUF_FINAL :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recursive_proof_1_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recursive_proof_2_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 deadline_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_aggregator_2eproto;
 };
@@ -1746,6 +1783,7 @@ class GenFinalProofRequest PROTOBUF_FINAL :
   enum : int {
     kRecursiveProofFieldNumber = 1,
     kAggregatorAddrFieldNumber = 2,
+    kDeadlineFieldNumber = 3,
   };
   // string recursive_proof = 1;
   void clear_recursive_proof();
@@ -1797,6 +1835,15 @@ class GenFinalProofRequest PROTOBUF_FINAL :
   std::string* _internal_mutable_aggregator_addr();
   public:
 
+  // uint64 deadline = 3;
+  void clear_deadline();
+  ::PROTOBUF_NAMESPACE_ID::uint64 deadline() const;
+  void set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_deadline() const;
+  void _internal_set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
   // @@protoc_insertion_point(class_scope:aggregator.v1.GenFinalProofRequest)
  private:
   class _Internal;
@@ -1806,6 +1853,7 @@ class GenFinalProofRequest PROTOBUF_FINAL :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recursive_proof_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr aggregator_addr_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 deadline_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_aggregator_2eproto;
 };
@@ -2278,6 +2326,7 @@ class GetStatusResponse PROTOBUF_FINAL :
 
   enum : int {
     kPendingRequestQueueIdsFieldNumber = 8,
+    kRequestQueueStatusFieldNumber = 15,
     kLastComputedRequestIdFieldNumber = 2,
     kCurrentComputingRequestIdFieldNumber = 4,
     kVersionProtoFieldNumber = 6,
@@ -2316,6 +2365,24 @@ class GetStatusResponse PROTOBUF_FINAL :
   std::string* _internal_add_pending_request_queue_ids();
   public:
 
+  // repeated .aggregator.v1.RequestQueueStatus request_queue_status = 15;
+  int request_queue_status_size() const;
+  private:
+  int _internal_request_queue_status_size() const;
+  public:
+  void clear_request_queue_status();
+  ::aggregator::v1::RequestQueueStatus* mutable_request_queue_status(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aggregator::v1::RequestQueueStatus >*
+      mutable_request_queue_status();
+  private:
+  const ::aggregator::v1::RequestQueueStatus& _internal_request_queue_status(int index) const;
+  ::aggregator::v1::RequestQueueStatus* _internal_add_request_queue_status();
+  public:
+  const ::aggregator::v1::RequestQueueStatus& request_queue_status(int index) const;
+  ::aggregator::v1::RequestQueueStatus* add_request_queue_status();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aggregator::v1::RequestQueueStatus >&
+      request_queue_status() const;
+
   // string last_computed_request_id = 2;
   void clear_last_computed_request_id();
   const std::string& last_computed_request_id() const;
@@ -2537,6 +2604,7 @@ class GetStatusResponse PROTOBUF_FINAL :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> pending_request_queue_ids_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aggregator::v1::RequestQueueStatus > request_queue_status_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr last_computed_request_id_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr current_computing_request_id_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr version_proto_;
@@ -2555,6 +2623,203 @@ class GetStatusResponse PROTOBUF_FINAL :
 };
 // -------------------------------------------------------------------
 
+class RequestQueueStatus PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:aggregator.v1.RequestQueueStatus) */ {
+ public:
+  inline RequestQueueStatus() : RequestQueueStatus(nullptr) {};
+  virtual ~RequestQueueStatus();
+
+  RequestQueueStatus(const RequestQueueStatus& from);
+  RequestQueueStatus(RequestQueueStatus&& from) noexcept
+    : RequestQueueStatus() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestQueueStatus& operator=(const RequestQueueStatus& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestQueueStatus& operator=(RequestQueueStatus&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const RequestQueueStatus& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const RequestQueueStatus* internal_default_instance() {
+    return reinterpret_cast<const RequestQueueStatus*>(
+               &_RequestQueueStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(RequestQueueStatus& a, RequestQueueStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestQueueStatus* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestQueueStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline RequestQueueStatus* New() const final {
+    return CreateMaybeMessage<RequestQueueStatus>(nullptr);
+  }
+
+  RequestQueueStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<RequestQueueStatus>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const RequestQueueStatus& from);
+  void MergeFrom(const RequestQueueStatus& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestQueueStatus* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "aggregator.v1.RequestQueueStatus";
+  }
+  protected:
+  explicit RequestQueueStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_aggregator_2eproto);
+    return ::descriptor_table_aggregator_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestTypeFieldNumber = 1,
+    kDepthFieldNumber = 2,
+    kOldestWaitTimeFieldNumber = 3,
+    kAverageWaitTimeFieldNumber = 4,
+    kAverageServiceTimeFieldNumber = 5,
+  };
+  // string request_type = 1;
+  void clear_request_type();
+  const std::string& request_type() const;
+  void set_request_type(const std::string& value);
+  void set_request_type(std::string&& value);
+  void set_request_type(const char* value);
+  void set_request_type(const char* value, size_t size);
+  std::string* mutable_request_type();
+  std::string* release_request_type();
+  void set_allocated_request_type(std::string* request_type);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_request_type();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_request_type(
+      std::string* request_type);
+  private:
+  const std::string& _internal_request_type() const;
+  void _internal_set_request_type(const std::string& value);
+  std::string* _internal_mutable_request_type();
+  public:
+
+  // uint64 depth = 2;
+  void clear_depth();
+  ::PROTOBUF_NAMESPACE_ID::uint64 depth() const;
+  void set_depth(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_depth() const;
+  void _internal_set_depth(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 oldest_wait_time = 3;
+  void clear_oldest_wait_time();
+  ::PROTOBUF_NAMESPACE_ID::uint64 oldest_wait_time() const;
+  void set_oldest_wait_time(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_oldest_wait_time() const;
+  void _internal_set_oldest_wait_time(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 average_wait_time = 4;
+  void clear_average_wait_time();
+  ::PROTOBUF_NAMESPACE_ID::uint64 average_wait_time() const;
+  void set_average_wait_time(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_average_wait_time() const;
+  void _internal_set_average_wait_time(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 average_service_time = 5;
+  void clear_average_service_time();
+  ::PROTOBUF_NAMESPACE_ID::uint64 average_service_time() const;
+  void set_average_service_time(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_average_service_time() const;
+  void _internal_set_average_service_time(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:aggregator.v1.RequestQueueStatus)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr request_type_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 depth_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 oldest_wait_time_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 average_wait_time_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 average_service_time_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_aggregator_2eproto;
+};
+// -------------------------------------------------------------------
+
 class GenBatchProofResponse PROTOBUF_FINAL :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:aggregator.v1.GenBatchProofResponse) */ {
  public:
@@ -2597,7 +2862,7 @@ class GenBatchProofResponse PROTOBUF_FINAL :
                &_GenBatchProofResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    12;
 
   friend void swap(GenBatchProofResponse& a, GenBatchProofResponse& b) {
     a.Swap(&b);
@@ -2761,7 +3026,7 @@ class GenAggregatedProofResponse PROTOBUF_FINAL :
                &_GenAggregatedProofResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    13;
 
   friend void swap(GenAggregatedProofResponse& a, GenAggregatedProofResponse& b) {
     a.Swap(&b);
@@ -2925,7 +3190,7 @@ class GenFinalProofResponse PROTOBUF_FINAL :
                &_GenFinalProofResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    13;
+    14;
 
   friend void swap(GenFinalProofResponse& a, GenFinalProofResponse& b) {
     a.Swap(&b);
@@ -3089,7 +3354,7 @@ class CancelResponse PROTOBUF_FINAL :
                &_CancelResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    14;
+    15;
 
   friend void swap(CancelResponse& a, CancelResponse& b) {
     a.Swap(&b);
@@ -3232,7 +3497,7 @@ class GetProofResponse PROTOBUF_FINAL :
                &_GetProofResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    15;
+    16;
 
   friend void swap(GetProofResponse& a, GetProofResponse& b) {
     a.Swap(&b);
@@ -3525,7 +3790,7 @@ class FinalProof PROTOBUF_FINAL :
                &_FinalProof_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    16;
+    17;
 
   friend void swap(FinalProof& a, FinalProof& b) {
     a.Swap(&b);
@@ -3728,7 +3993,7 @@ class PublicInputs PROTOBUF_FINAL :
                &_PublicInputs_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    18;
+    19;
 
   friend void swap(PublicInputs& a, PublicInputs& b) {
     a.Swap(&b);
@@ -4142,7 +4407,7 @@ class StatelessPublicInputs PROTOBUF_FINAL :
                &_StatelessPublicInputs_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    20;
+    21;
 
   friend void swap(StatelessPublicInputs& a, StatelessPublicInputs& b) {
     a.Swap(&b);
@@ -4493,7 +4758,7 @@ class L1Data PROTOBUF_FINAL :
                &_L1Data_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    21;
+    22;
 
   friend void swap(L1Data& a, L1Data& b) {
     a.Swap(&b);
@@ -4778,7 +5043,7 @@ class InputProver PROTOBUF_FINAL :
                &_InputProver_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    24;
+    25;
 
   friend void swap(InputProver& a, InputProver& b) {
     a.Swap(&b);
@@ -4973,7 +5238,7 @@ class StatelessInputProver PROTOBUF_FINAL :
                &_StatelessInputProver_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    25;
+    26;
 
   friend void swap(StatelessInputProver& a, StatelessInputProver& b) {
     a.Swap(&b);
@@ -5119,7 +5384,7 @@ class PublicInputsExtended PROTOBUF_FINAL :
                &_PublicInputsExtended_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    26;
+    27;
 
   friend void swap(PublicInputsExtended& a, PublicInputsExtended& b) {
     a.Swap(&b);
@@ -6631,6 +6896,26 @@ inline void GenBatchProofRequest::set_allocated_input(::aggregator::v1::InputPro
   // @@protoc_insertion_point(field_set_allocated:aggregator.v1.GenBatchProofRequest.input)
 }
 
+// uint64 deadline = 2;
+inline void GenBatchProofRequest::clear_deadline() {
+  deadline_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GenBatchProofRequest::_internal_deadline() const {
+  return deadline_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GenBatchProofRequest::deadline() const {
+  // @@protoc_insertion_point(field_get:aggregator.v1.GenBatchProofRequest.deadline)
+  return _internal_deadline();
+}
+inline void GenBatchProofRequest::_internal_set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  deadline_ = value;
+}
+inline void GenBatchProofRequest::set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_deadline(value);
+  // @@protoc_insertion_point(field_set:aggregator.v1.GenBatchProofRequest.deadline)
+}
+
 // -------------------------------------------------------------------
 
 // GenStatelessBatchProofRequest
@@ -6716,6 +7001,26 @@ inline void GenStatelessBatchProofRequest::set_allocated_input(::aggregator::v1:
   // @@protoc_insertion_point(field_set_allocated:aggregator.v1.GenStatelessBatchProofRequest.input)
 }
 
+// uint64 deadline = 2;
+inline void GenStatelessBatchProofRequest::clear_deadline() {
+  deadline_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GenStatelessBatchProofRequest::_internal_deadline() const {
+  return deadline_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GenStatelessBatchProofRequest::deadline() const {
+  // @@protoc_insertion_point(field_get:aggregator.v1.GenStatelessBatchProofRequest.deadline)
+  return _internal_deadline();
+}
+inline void GenStatelessBatchProofRequest::_internal_set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  deadline_ = value;
+}
+inline void GenStatelessBatchProofRequest::set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_deadline(value);
+  // @@protoc_insertion_point(field_set:aggregator.v1.GenStatelessBatchProofRequest.deadline)
+}
+
 // -------------------------------------------------------------------
 
 // GenAggregatedProofRequest
@@ -6882,6 +7187,26 @@ inline void GenAggregatedProofRequest::unsafe_arena_set_allocated_recursive_proo
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aggregator.v1.GenAggregatedProofRequest.recursive_proof_2)
 }
 
+// uint64 deadline = 3;
+inline void GenAggregatedProofRequest::clear_deadline() {
+  deadline_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GenAggregatedProofRequest::_internal_deadline() const {
+  return deadline_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GenAggregatedProofRequest::deadline() const {
+  // @@protoc_insertion_point(field_get:aggregator.v1.GenAggregatedProofRequest.deadline)
+  return _internal_deadline();
+}
+inline void GenAggregatedProofRequest::_internal_set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  deadline_ = value;
+}
+inline void GenAggregatedProofRequest::set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_deadline(value);
+  // @@protoc_insertion_point(field_set:aggregator.v1.GenAggregatedProofRequest.deadline)
+}
+
 // -------------------------------------------------------------------
 
 // GenFinalProofRequest
@@ -7048,6 +7373,26 @@ inline void GenFinalProofRequest::unsafe_arena_set_allocated_aggregator_addr(
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aggregator.v1.GenFinalProofRequest.aggregator_addr)
 }
 
+// uint64 deadline = 3;
+inline void GenFinalProofRequest::clear_deadline() {
+  deadline_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GenFinalProofRequest::_internal_deadline() const {
+  return deadline_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GenFinalProofRequest::deadline() const {
+  // @@protoc_insertion_point(field_get:aggregator.v1.GenFinalProofRequest.deadline)
+  return _internal_deadline();
+}
+inline void GenFinalProofRequest::_internal_set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  deadline_ = value;
+}
+inline void GenFinalProofRequest::set_deadline(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_deadline(value);
+  // @@protoc_insertion_point(field_set:aggregator.v1.GenFinalProofRequest.deadline)
+}
+
 // -------------------------------------------------------------------
 
 // CancelRequest
@@ -7942,6 +8287,210 @@ inline void GetStatusResponse::set_fork_id(::PROTOBUF_NAMESPACE_ID::uint64 value
   // @@protoc_insertion_point(field_set:aggregator.v1.GetStatusResponse.fork_id)
 }
 
+// repeated .aggregator.v1.RequestQueueStatus request_queue_status = 15;
+inline int GetStatusResponse::_internal_request_queue_status_size() const {
+  return request_queue_status_.size();
+}
+inline int GetStatusResponse::request_queue_status_size() const {
+  return _internal_request_queue_status_size();
+}
+inline void GetStatusResponse::clear_request_queue_status() {
+  request_queue_status_.Clear();
+}
+inline ::aggregator::v1::RequestQueueStatus* GetStatusResponse::mutable_request_queue_status(int index) {
+  // @@protoc_insertion_point(field_mutable:aggregator.v1.GetStatusResponse.request_queue_status)
+  return request_queue_status_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aggregator::v1::RequestQueueStatus >*
+GetStatusResponse::mutable_request_queue_status() {
+  // @@protoc_insertion_point(field_mutable_list:aggregator.v1.GetStatusResponse.request_queue_status)
+  return &request_queue_status_;
+}
+inline const ::aggregator::v1::RequestQueueStatus& GetStatusResponse::_internal_request_queue_status(int index) const {
+  return request_queue_status_.Get(index);
+}
+inline const ::aggregator::v1::RequestQueueStatus& GetStatusResponse::request_queue_status(int index) const {
+  // @@protoc_insertion_point(field_get:aggregator.v1.GetStatusResponse.request_queue_status)
+  return _internal_request_queue_status(index);
+}
+inline ::aggregator::v1::RequestQueueStatus* GetStatusResponse::_internal_add_request_queue_status() {
+  return request_queue_status_.Add();
+}
+inline ::aggregator::v1::RequestQueueStatus* GetStatusResponse::add_request_queue_status() {
+  // @@protoc_insertion_point(field_add:aggregator.v1.GetStatusResponse.request_queue_status)
+  return _internal_add_request_queue_status();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::aggregator::v1::RequestQueueStatus >&
+GetStatusResponse::request_queue_status() const {
+  // @@protoc_insertion_point(field_list:aggregator.v1.GetStatusResponse.request_queue_status)
+  return request_queue_status_;
+}
+
+// -------------------------------------------------------------------
+
+// RequestQueueStatus
+
+// string request_type = 1;
+inline void RequestQueueStatus::clear_request_type() {
+  request_type_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& RequestQueueStatus::request_type() const {
+  // @@protoc_insertion_point(field_get:aggregator.v1.RequestQueueStatus.request_type)
+  return _internal_request_type();
+}
+inline void RequestQueueStatus::set_request_type(const std::string& value) {
+  _internal_set_request_type(value);
+  // @@protoc_insertion_point(field_set:aggregator.v1.RequestQueueStatus.request_type)
+}
+inline std::string* RequestQueueStatus::mutable_request_type() {
+  // @@protoc_insertion_point(field_mutable:aggregator.v1.RequestQueueStatus.request_type)
+  return _internal_mutable_request_type();
+}
+inline const std::string& RequestQueueStatus::_internal_request_type() const {
+  return request_type_.Get();
+}
+inline void RequestQueueStatus::_internal_set_request_type(const std::string& value) {
+  
+  request_type_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void RequestQueueStatus::set_request_type(std::string&& value) {
+  
+  request_type_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:aggregator.v1.RequestQueueStatus.request_type)
+}
+inline void RequestQueueStatus::set_request_type(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  request_type_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:aggregator.v1.RequestQueueStatus.request_type)
+}
+inline void RequestQueueStatus::set_request_type(const char* value,
+    size_t size) {
+  
+  request_type_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:aggregator.v1.RequestQueueStatus.request_type)
+}
+inline std::string* RequestQueueStatus::_internal_mutable_request_type() {
+  
+  return request_type_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* RequestQueueStatus::release_request_type() {
+  // @@protoc_insertion_point(field_release:aggregator.v1.RequestQueueStatus.request_type)
+  return request_type_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void RequestQueueStatus::set_allocated_request_type(std::string* request_type) {
+  if (request_type != nullptr) {
+    
+  } else {
+    
+  }
+  request_type_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), request_type,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:aggregator.v1.RequestQueueStatus.request_type)
+}
+inline std::string* RequestQueueStatus::unsafe_arena_release_request_type() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:aggregator.v1.RequestQueueStatus.request_type)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return request_type_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void RequestQueueStatus::unsafe_arena_set_allocated_request_type(
+    std::string* request_type) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (request_type != nullptr) {
+    
+  } else {
+    
+  }
+  request_type_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      request_type, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:aggregator.v1.RequestQueueStatus.request_type)
+}
+
+// uint64 depth = 2;
+inline void RequestQueueStatus::clear_depth() {
+  depth_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RequestQueueStatus::_internal_depth() const {
+  return depth_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RequestQueueStatus::depth() const {
+  // @@protoc_insertion_point(field_get:aggregator.v1.RequestQueueStatus.depth)
+  return _internal_depth();
+}
+inline void RequestQueueStatus::_internal_set_depth(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  depth_ = value;
+}
+inline void RequestQueueStatus::set_depth(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_depth(value);
+  // @@protoc_insertion_point(field_set:aggregator.v1.RequestQueueStatus.depth)
+}
+
+// uint64 oldest_wait_time = 3;
+inline void RequestQueueStatus::clear_oldest_wait_time() {
+  oldest_wait_time_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RequestQueueStatus::_internal_oldest_wait_time() const {
+  return oldest_wait_time_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RequestQueueStatus::oldest_wait_time() const {
+  // @@protoc_insertion_point(field_get:aggregator.v1.RequestQueueStatus.oldest_wait_time)
+  return _internal_oldest_wait_time();
+}
+inline void RequestQueueStatus::_internal_set_oldest_wait_time(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  oldest_wait_time_ = value;
+}
+inline void RequestQueueStatus::set_oldest_wait_time(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_oldest_wait_time(value);
+  // @@protoc_insertion_point(field_set:aggregator.v1.RequestQueueStatus.oldest_wait_time)
+}
+
+// uint64 average_wait_time = 4;
+inline void RequestQueueStatus::clear_average_wait_time() {
+  average_wait_time_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RequestQueueStatus::_internal_average_wait_time() const {
+  return average_wait_time_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RequestQueueStatus::average_wait_time() const {
+  // @@protoc_insertion_point(field_get:aggregator.v1.RequestQueueStatus.average_wait_time)
+  return _internal_average_wait_time();
+}
+inline void RequestQueueStatus::_internal_set_average_wait_time(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  average_wait_time_ = value;
+}
+inline void RequestQueueStatus::set_average_wait_time(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_average_wait_time(value);
+  // @@protoc_insertion_point(field_set:aggregator.v1.RequestQueueStatus.average_wait_time)
+}
+
+// uint64 average_service_time = 5;
+inline void RequestQueueStatus::clear_average_service_time() {
+  average_service_time_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RequestQueueStatus::_internal_average_service_time() const {
+  return average_service_time_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 RequestQueueStatus::average_service_time() const {
+  // @@protoc_insertion_point(field_get:aggregator.v1.RequestQueueStatus.average_service_time)
+  return _internal_average_service_time();
+}
+inline void RequestQueueStatus::_internal_set_average_service_time(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  average_service_time_ = value;
+}
+inline void RequestQueueStatus::set_average_service_time(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_average_service_time(value);
+  // @@protoc_insertion_point(field_set:aggregator.v1.RequestQueueStatus.average_service_time)
+}
+
 // -------------------------------------------------------------------
 
 // GenBatchProofResponse
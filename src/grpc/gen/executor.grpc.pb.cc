@@ -25,6 +25,7 @@ namespace v1 {
 static const char* ExecutorService_method_names[] = {
   "/executor.v1.ExecutorService/ProcessBatch",
   "/executor.v1.ExecutorService/ProcessBatchV2",
+  "/executor.v1.ExecutorService/ProcessBatchV2Stream",
   "/executor.v1.ExecutorService/ProcessStatelessBatchV2",
   "/executor.v1.ExecutorService/GetFlushStatus",
 };
@@ -38,8 +39,9 @@ std::unique_ptr< ExecutorService::Stub> ExecutorService::NewStub(const std::shar
 ExecutorService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel)
   : channel_(channel), rpcmethod_ProcessBatch_(ExecutorService_method_names[0], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_ProcessBatchV2_(ExecutorService_method_names[1], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ProcessStatelessBatchV2_(ExecutorService_method_names[2], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetFlushStatus_(ExecutorService_method_names[3], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ProcessBatchV2Stream_(ExecutorService_method_names[2], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_ProcessStatelessBatchV2_(ExecutorService_method_names[3], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetFlushStatus_(ExecutorService_method_names[4], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status ExecutorService::Stub::ProcessBatch(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::executor::v1::ProcessBatchResponse* response) {
@@ -98,6 +100,22 @@ void ExecutorService::Stub::experimental_async::ProcessBatchV2(::grpc::ClientCon
   return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::executor::v1::ProcessBatchResponseV2>::Create(channel_.get(), cq, rpcmethod_ProcessBatchV2_, context, request, false);
 }
 
+::grpc::ClientReader< ::executor::v1::ProcessBatchV2StreamResponse>* ExecutorService::Stub::ProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request) {
+  return ::grpc_impl::internal::ClientReaderFactory< ::executor::v1::ProcessBatchV2StreamResponse>::Create(channel_.get(), rpcmethod_ProcessBatchV2Stream_, context, request);
+}
+
+void ExecutorService::Stub::experimental_async::ProcessBatchV2Stream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequestV2* request, ::grpc::experimental::ClientReadReactor< ::executor::v1::ProcessBatchV2StreamResponse>* reactor) {
+  ::grpc_impl::internal::ClientCallbackReaderFactory< ::executor::v1::ProcessBatchV2StreamResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_ProcessBatchV2Stream_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchV2StreamResponse>* ExecutorService::Stub::AsyncProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc_impl::internal::ClientAsyncReaderFactory< ::executor::v1::ProcessBatchV2StreamResponse>::Create(channel_.get(), cq, rpcmethod_ProcessBatchV2Stream_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchV2StreamResponse>* ExecutorService::Stub::PrepareAsyncProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncReaderFactory< ::executor::v1::ProcessBatchV2StreamResponse>::Create(channel_.get(), cq, rpcmethod_ProcessBatchV2Stream_, context, request, false, nullptr);
+}
+
 ::grpc::Status ExecutorService::Stub::ProcessStatelessBatchV2(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2& request, ::executor::v1::ProcessBatchResponseV2* response) {
   return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_ProcessStatelessBatchV2_, context, request, response);
 }
@@ -177,6 +195,16 @@ ExecutorService::Service::Service() {
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       ExecutorService_method_names[2],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< ExecutorService::Service, ::executor::v1::ProcessBatchRequestV2, ::executor::v1::ProcessBatchV2StreamResponse>(
+          [](ExecutorService::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             const ::executor::v1::ProcessBatchRequestV2* req,
+             ::grpc_impl::ServerWriter<::executor::v1::ProcessBatchV2StreamResponse>* writer) {
+               return service->ProcessBatchV2Stream(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ExecutorService_method_names[3],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< ExecutorService::Service, ::executor::v1::ProcessStatelessBatchRequestV2, ::executor::v1::ProcessBatchResponseV2>(
           [](ExecutorService::Service* service,
@@ -186,7 +214,7 @@ ExecutorService::Service::Service() {
                return service->ProcessStatelessBatchV2(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      ExecutorService_method_names[3],
+      ExecutorService_method_names[4],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< ExecutorService::Service, ::google::protobuf::Empty, ::executor::v1::GetFlushStatusResponse>(
           [](ExecutorService::Service* service,
@@ -214,6 +242,13 @@ ExecutorService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status ExecutorService::Service::ProcessBatchV2Stream(::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status ExecutorService::Service::ProcessStatelessBatchV2(::grpc::ServerContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response) {
   (void) context;
   (void) request;
@@ -52,6 +52,16 @@ class ExecutorService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponseV2>> PrepareAsyncProcessBatchV2(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponseV2>>(PrepareAsyncProcessBatchV2Raw(context, request, cq));
     }
+    // / Processes a batch, streaming every block response as soon as the block is finished
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::executor::v1::ProcessBatchV2StreamResponse>> ProcessBatchV2Stream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::executor::v1::ProcessBatchV2StreamResponse>>(ProcessBatchV2StreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchV2StreamResponse>> AsyncProcessBatchV2Stream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchV2StreamResponse>>(AsyncProcessBatchV2StreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchV2StreamResponse>> PrepareAsyncProcessBatchV2Stream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchV2StreamResponse>>(PrepareAsyncProcessBatchV2StreamRaw(context, request, cq));
+    }
     virtual ::grpc::Status ProcessStatelessBatchV2(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2& request, ::executor::v1::ProcessBatchResponseV2* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponseV2>> AsyncProcessStatelessBatchV2(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponseV2>>(AsyncProcessStatelessBatchV2Raw(context, request, cq));
@@ -94,6 +104,12 @@ class ExecutorService final {
       #else
       virtual void ProcessBatchV2(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::executor::v1::ProcessBatchResponseV2* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
       #endif
+      // / Processes a batch, streaming every block response as soon as the block is finished
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void ProcessBatchV2Stream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ClientReadReactor< ::executor::v1::ProcessBatchV2StreamResponse>* reactor) = 0;
+      #else
+      virtual void ProcessBatchV2Stream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequestV2* request, ::grpc::experimental::ClientReadReactor< ::executor::v1::ProcessBatchV2StreamResponse>* reactor) = 0;
+      #endif
       virtual void ProcessStatelessBatchV2(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response, std::function<void(::grpc::Status)>) = 0;
       virtual void ProcessStatelessBatchV2(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::executor::v1::ProcessBatchResponseV2* response, std::function<void(::grpc::Status)>) = 0;
       #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -131,6 +147,9 @@ class ExecutorService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponse>* PrepareAsyncProcessBatchRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponseV2>* AsyncProcessBatchV2Raw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponseV2>* PrepareAsyncProcessBatchV2Raw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::executor::v1::ProcessBatchV2StreamResponse>* ProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchV2StreamResponse>* AsyncProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchV2StreamResponse>* PrepareAsyncProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponseV2>* AsyncProcessStatelessBatchV2Raw(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponseV2>* PrepareAsyncProcessStatelessBatchV2Raw(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::GetFlushStatusResponse>* AsyncGetFlushStatusRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
@@ -153,6 +172,15 @@ class ExecutorService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponseV2>> PrepareAsyncProcessBatchV2(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponseV2>>(PrepareAsyncProcessBatchV2Raw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::executor::v1::ProcessBatchV2StreamResponse>> ProcessBatchV2Stream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::executor::v1::ProcessBatchV2StreamResponse>>(ProcessBatchV2StreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchV2StreamResponse>> AsyncProcessBatchV2Stream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchV2StreamResponse>>(AsyncProcessBatchV2StreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchV2StreamResponse>> PrepareAsyncProcessBatchV2Stream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchV2StreamResponse>>(PrepareAsyncProcessBatchV2StreamRaw(context, request, cq));
+    }
     ::grpc::Status ProcessStatelessBatchV2(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2& request, ::executor::v1::ProcessBatchResponseV2* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponseV2>> AsyncProcessStatelessBatchV2(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponseV2>>(AsyncProcessStatelessBatchV2Raw(context, request, cq));
@@ -194,6 +222,11 @@ class ExecutorService final {
       #else
       void ProcessBatchV2(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::executor::v1::ProcessBatchResponseV2* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
       #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void ProcessBatchV2Stream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ClientReadReactor< ::executor::v1::ProcessBatchV2StreamResponse>* reactor) override;
+      #else
+      void ProcessBatchV2Stream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequestV2* request, ::grpc::experimental::ClientReadReactor< ::executor::v1::ProcessBatchV2StreamResponse>* reactor) override;
+      #endif
       void ProcessStatelessBatchV2(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response, std::function<void(::grpc::Status)>) override;
       void ProcessStatelessBatchV2(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::executor::v1::ProcessBatchResponseV2* response, std::function<void(::grpc::Status)>) override;
       #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -233,12 +266,16 @@ class ExecutorService final {
     ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponse>* PrepareAsyncProcessBatchRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponseV2>* AsyncProcessBatchV2Raw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponseV2>* PrepareAsyncProcessBatchV2Raw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::executor::v1::ProcessBatchV2StreamResponse>* ProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request) override;
+    ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchV2StreamResponse>* AsyncProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchV2StreamResponse>* PrepareAsyncProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponseV2>* AsyncProcessStatelessBatchV2Raw(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponseV2>* PrepareAsyncProcessStatelessBatchV2Raw(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::executor::v1::GetFlushStatusResponse>* AsyncGetFlushStatusRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::executor::v1::GetFlushStatusResponse>* PrepareAsyncGetFlushStatusRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_ProcessBatch_;
     const ::grpc::internal::RpcMethod rpcmethod_ProcessBatchV2_;
+    const ::grpc::internal::RpcMethod rpcmethod_ProcessBatchV2Stream_;
     const ::grpc::internal::RpcMethod rpcmethod_ProcessStatelessBatchV2_;
     const ::grpc::internal::RpcMethod rpcmethod_GetFlushStatus_;
   };
@@ -251,6 +288,8 @@ class ExecutorService final {
     // / Processes a batch
     virtual ::grpc::Status ProcessBatch(::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequest* request, ::executor::v1::ProcessBatchResponse* response);
     virtual ::grpc::Status ProcessBatchV2(::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response);
+    // / Processes a batch, streaming every block response as soon as the block is finished
+    virtual ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse>* writer);
     virtual ::grpc::Status ProcessStatelessBatchV2(::grpc::ServerContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response);
     virtual ::grpc::Status GetFlushStatus(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::executor::v1::GetFlushStatusResponse* response);
   };
@@ -295,12 +334,32 @@ class ExecutorService final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_ProcessBatchV2Stream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ProcessBatchV2Stream() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_ProcessBatchV2Stream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestProcessBatchV2Stream(::grpc::ServerContext* context, ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ServerAsyncWriter< ::executor::v1::ProcessBatchV2StreamResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(2, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_ProcessStatelessBatchV2 : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_ProcessStatelessBatchV2() {
-      ::grpc::Service::MarkMethodAsync(2);
+      ::grpc::Service::MarkMethodAsync(3);
     }
     ~WithAsyncMethod_ProcessStatelessBatchV2() override {
       BaseClassMustBeDerivedFromService(this);
@@ -311,7 +370,7 @@ class ExecutorService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestProcessStatelessBatchV2(::grpc::ServerContext* context, ::executor::v1::ProcessStatelessBatchRequestV2* request, ::grpc::ServerAsyncResponseWriter< ::executor::v1::ProcessBatchResponseV2>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -320,7 +379,7 @@ class ExecutorService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_GetFlushStatus() {
-      ::grpc::Service::MarkMethodAsync(3);
+      ::grpc::Service::MarkMethodAsync(4);
     }
     ~WithAsyncMethod_GetFlushStatus() override {
       BaseClassMustBeDerivedFromService(this);
@@ -331,10 +390,10 @@ class ExecutorService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestGetFlushStatus(::grpc::ServerContext* context, ::google::protobuf::Empty* request, ::grpc::ServerAsyncResponseWriter< ::executor::v1::GetFlushStatusResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_ProcessBatch<WithAsyncMethod_ProcessBatchV2<WithAsyncMethod_ProcessStatelessBatchV2<WithAsyncMethod_GetFlushStatus<Service > > > > AsyncService;
+  typedef WithAsyncMethod_ProcessBatch<WithAsyncMethod_ProcessBatchV2<WithAsyncMethod_ProcessBatchV2Stream<WithAsyncMethod_ProcessStatelessBatchV2<WithAsyncMethod_GetFlushStatus<Service > > > > > AsyncService;
   template <class BaseClass>
   class ExperimentalWithCallbackMethod_ProcessBatch : public BaseClass {
    private:
@@ -430,6 +489,44 @@ class ExecutorService final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithCallbackMethod_ProcessBatchV2Stream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_ProcessBatchV2Stream() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(2,
+          new ::grpc_impl::internal::CallbackServerStreamingHandler< ::executor::v1::ProcessBatchRequestV2, ::executor::v1::ProcessBatchV2StreamResponse>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const::executor::v1::ProcessBatchRequestV2* request) { return this->ProcessBatchV2Stream(context, request); }));
+    }
+    ~ExperimentalWithCallbackMethod_ProcessBatchV2Stream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerWriteReactor< ::executor::v1::ProcessBatchV2StreamResponse>* ProcessBatchV2Stream(
+      ::grpc::CallbackServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/)
+    #else
+    virtual ::grpc::experimental::ServerWriteReactor< ::executor::v1::ProcessBatchV2StreamResponse>* ProcessBatchV2Stream(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class ExperimentalWithCallbackMethod_ProcessStatelessBatchV2 : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -440,7 +537,7 @@ class ExecutorService final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodCallback(2,
+        MarkMethodCallback(3,
           new ::grpc_impl::internal::CallbackUnaryHandler< ::executor::v1::ProcessStatelessBatchRequestV2, ::executor::v1::ProcessBatchResponseV2>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -452,9 +549,9 @@ class ExecutorService final {
     void SetMessageAllocatorFor_ProcessStatelessBatchV2(
         ::grpc::experimental::MessageAllocator< ::executor::v1::ProcessStatelessBatchRequestV2, ::executor::v1::ProcessBatchResponseV2>* allocator) {
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
     #else
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(2);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(3);
     #endif
       static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::executor::v1::ProcessStatelessBatchRequestV2, ::executor::v1::ProcessBatchResponseV2>*>(handler)
               ->SetMessageAllocator(allocator);
@@ -487,7 +584,7 @@ class ExecutorService final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodCallback(3,
+        MarkMethodCallback(4,
           new ::grpc_impl::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::executor::v1::GetFlushStatusResponse>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -499,9 +596,9 @@ class ExecutorService final {
     void SetMessageAllocatorFor_GetFlushStatus(
         ::grpc::experimental::MessageAllocator< ::google::protobuf::Empty, ::executor::v1::GetFlushStatusResponse>* allocator) {
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
     #else
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(3);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(4);
     #endif
       static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::executor::v1::GetFlushStatusResponse>*>(handler)
               ->SetMessageAllocator(allocator);
@@ -524,10 +621,10 @@ class ExecutorService final {
       { return nullptr; }
   };
   #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-  typedef ExperimentalWithCallbackMethod_ProcessBatch<ExperimentalWithCallbackMethod_ProcessBatchV2<ExperimentalWithCallbackMethod_ProcessStatelessBatchV2<ExperimentalWithCallbackMethod_GetFlushStatus<Service > > > > CallbackService;
+  typedef ExperimentalWithCallbackMethod_ProcessBatch<ExperimentalWithCallbackMethod_ProcessBatchV2<ExperimentalWithCallbackMethod_ProcessBatchV2Stream<ExperimentalWithCallbackMethod_ProcessStatelessBatchV2<ExperimentalWithCallbackMethod_GetFlushStatus<Service > > > > > CallbackService;
   #endif
 
-  typedef ExperimentalWithCallbackMethod_ProcessBatch<ExperimentalWithCallbackMethod_ProcessBatchV2<ExperimentalWithCallbackMethod_ProcessStatelessBatchV2<ExperimentalWithCallbackMethod_GetFlushStatus<Service > > > > ExperimentalCallbackService;
+  typedef ExperimentalWithCallbackMethod_ProcessBatch<ExperimentalWithCallbackMethod_ProcessBatchV2<ExperimentalWithCallbackMethod_ProcessBatchV2Stream<ExperimentalWithCallbackMethod_ProcessStatelessBatchV2<ExperimentalWithCallbackMethod_GetFlushStatus<Service > > > > > ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_ProcessBatch : public BaseClass {
    private:
@@ -563,12 +660,29 @@ class ExecutorService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_ProcessBatchV2Stream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ProcessBatchV2Stream() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_ProcessBatchV2Stream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_ProcessStatelessBatchV2 : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_ProcessStatelessBatchV2() {
-      ::grpc::Service::MarkMethodGeneric(2);
+      ::grpc::Service::MarkMethodGeneric(3);
     }
     ~WithGenericMethod_ProcessStatelessBatchV2() override {
       BaseClassMustBeDerivedFromService(this);
@@ -585,7 +699,7 @@ class ExecutorService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_GetFlushStatus() {
-      ::grpc::Service::MarkMethodGeneric(3);
+      ::grpc::Service::MarkMethodGeneric(4);
     }
     ~WithGenericMethod_GetFlushStatus() override {
       BaseClassMustBeDerivedFromService(this);
@@ -637,12 +751,32 @@ class ExecutorService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_ProcessBatchV2Stream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ProcessBatchV2Stream() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_ProcessBatchV2Stream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestProcessBatchV2Stream(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(2, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_ProcessStatelessBatchV2 : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_ProcessStatelessBatchV2() {
-      ::grpc::Service::MarkMethodRaw(2);
+      ::grpc::Service::MarkMethodRaw(3);
     }
     ~WithRawMethod_ProcessStatelessBatchV2() override {
       BaseClassMustBeDerivedFromService(this);
@@ -653,7 +787,7 @@ class ExecutorService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestProcessStatelessBatchV2(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -662,7 +796,7 @@ class ExecutorService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_GetFlushStatus() {
-      ::grpc::Service::MarkMethodRaw(3);
+      ::grpc::Service::MarkMethodRaw(4);
     }
     ~WithRawMethod_GetFlushStatus() override {
       BaseClassMustBeDerivedFromService(this);
@@ -673,7 +807,7 @@ class ExecutorService final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestGetFlushStatus(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -753,6 +887,44 @@ class ExecutorService final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_ProcessBatchV2Stream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_ProcessBatchV2Stream() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(2,
+          new ::grpc_impl::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const::grpc::ByteBuffer* request) { return this->ProcessBatchV2Stream(context, request); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_ProcessBatchV2Stream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* ProcessBatchV2Stream(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)
+    #else
+    virtual ::grpc::experimental::ServerWriteReactor< ::grpc::ByteBuffer>* ProcessBatchV2Stream(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class ExperimentalWithRawCallbackMethod_ProcessStatelessBatchV2 : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -763,7 +935,7 @@ class ExecutorService final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodRawCallback(2,
+        MarkMethodRawCallback(3,
           new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -801,7 +973,7 @@ class ExecutorService final {
     #else
       ::grpc::Service::experimental().
     #endif
-        MarkMethodRawCallback(3,
+        MarkMethodRawCallback(4,
           new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
@@ -888,7 +1060,7 @@ class ExecutorService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_ProcessStatelessBatchV2() {
-      ::grpc::Service::MarkMethodStreamed(2,
+      ::grpc::Service::MarkMethodStreamed(3,
         new ::grpc::internal::StreamedUnaryHandler<
           ::executor::v1::ProcessStatelessBatchRequestV2, ::executor::v1::ProcessBatchResponseV2>(
             [this](::grpc_impl::ServerContext* context,
@@ -915,7 +1087,7 @@ class ExecutorService final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_GetFlushStatus() {
-      ::grpc::Service::MarkMethodStreamed(3,
+      ::grpc::Service::MarkMethodStreamed(4,
         new ::grpc::internal::StreamedUnaryHandler<
           ::google::protobuf::Empty, ::executor::v1::GetFlushStatusResponse>(
             [this](::grpc_impl::ServerContext* context,
@@ -937,8 +1109,35 @@ class ExecutorService final {
     virtual ::grpc::Status StreamedGetFlushStatus(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::google::protobuf::Empty,::executor::v1::GetFlushStatusResponse>* server_unary_streamer) = 0;
   };
   typedef WithStreamedUnaryMethod_ProcessBatch<WithStreamedUnaryMethod_ProcessBatchV2<WithStreamedUnaryMethod_ProcessStatelessBatchV2<WithStreamedUnaryMethod_GetFlushStatus<Service > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_ProcessBatch<WithStreamedUnaryMethod_ProcessBatchV2<WithStreamedUnaryMethod_ProcessStatelessBatchV2<WithStreamedUnaryMethod_GetFlushStatus<Service > > > > StreamedService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_ProcessBatchV2Stream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_ProcessBatchV2Stream() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::executor::v1::ProcessBatchRequestV2, ::executor::v1::ProcessBatchV2StreamResponse>(
+            [this](::grpc_impl::ServerContext* context,
+                   ::grpc_impl::ServerSplitStreamer<
+                     ::executor::v1::ProcessBatchRequestV2, ::executor::v1::ProcessBatchV2StreamResponse>* streamer) {
+                       return this->StreamedProcessBatchV2Stream(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_ProcessBatchV2Stream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedProcessBatchV2Stream(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::executor::v1::ProcessBatchRequestV2,::executor::v1::ProcessBatchV2StreamResponse>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_ProcessBatchV2Stream<Service > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_ProcessBatch<WithStreamedUnaryMethod_ProcessBatchV2<WithSplitStreamingMethod_ProcessBatchV2Stream<WithStreamedUnaryMethod_ProcessStatelessBatchV2<WithStreamedUnaryMethod_GetFlushStatus<Service > > > > > StreamedService;
 };
 
 }  // namespace v1
@@ -39,6 +39,7 @@ extern PROTOBUF_INTERNAL_EXPORT_executor_2eproto ::PROTOBUF_NAMESPACE_ID::intern
 extern PROTOBUF_INTERNAL_EXPORT_executor_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ProcessBatchRequestV2_L1InfoTreeDataEntry_DoNotUse_executor_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_executor_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ProcessBatchRequestV2_StateOverrideEntry_DoNotUse_executor_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_executor_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ProcessBatchResponse_ReadWriteAddressesEntry_DoNotUse_executor_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_executor_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_ProcessBatchResponseV2_executor_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_executor_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ProcessBatchResponseV2_ReadWriteAddressesEntry_DoNotUse_executor_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_executor_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_ProcessBlockResponseV2_executor_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_executor_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_ProcessTransactionResponse_executor_2eproto;
@@ -170,6 +171,12 @@ class ProcessBatchResponseV2DefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ProcessBatchResponseV2> _instance;
 } _ProcessBatchResponseV2_default_instance_;
+class ProcessBatchV2StreamResponseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ProcessBatchV2StreamResponse> _instance;
+  const ::executor::v1::ProcessBlockResponseV2* block_response_;
+  const ::executor::v1::ProcessBatchResponseV2* batch_response_;
+} _ProcessBatchV2StreamResponse_default_instance_;
 class ResponseDebugDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ResponseDebug> _instance;
@@ -681,6 +688,22 @@ static void InitDefaultsscc_info_ProcessBatchResponseV2_ReadWriteAddressesEntry_
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_ProcessBatchResponseV2_ReadWriteAddressesEntry_DoNotUse_executor_2eproto}, {
       &scc_info_InfoReadWriteV2_executor_2eproto.base,}};
 
+static void InitDefaultsscc_info_ProcessBatchV2StreamResponse_executor_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::executor::v1::_ProcessBatchV2StreamResponse_default_instance_;
+    new (ptr) ::executor::v1::ProcessBatchV2StreamResponse();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::executor::v1::ProcessBatchV2StreamResponse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_ProcessBatchV2StreamResponse_executor_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_ProcessBatchV2StreamResponse_executor_2eproto}, {
+      &scc_info_ProcessBlockResponseV2_executor_2eproto.base,
+      &scc_info_ProcessBatchResponseV2_executor_2eproto.base,}};
+
 static void InitDefaultsscc_info_ProcessBlockResponseV2_executor_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -872,7 +895,7 @@ static void InitDefaultsscc_info_TransactionStepV2_StorageEntry_DoNotUse_executo
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TransactionStepV2_StorageEntry_DoNotUse_executor_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TransactionStepV2_StorageEntry_DoNotUse_executor_2eproto}, {}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_executor_2eproto[44];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_executor_2eproto[45];
 static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_executor_2eproto[2];
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_executor_2eproto = nullptr;
 
@@ -1262,6 +1285,14 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_executor_2eproto::offsets[] PR
   PROTOBUF_FIELD_OFFSET(::executor::v1::ProcessBatchResponseV2, old_state_root_),
   PROTOBUF_FIELD_OFFSET(::executor::v1::ProcessBatchResponseV2, debug_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::executor::v1::ProcessBatchV2StreamResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::executor::v1::ProcessBatchV2StreamResponse, _oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  offsetof(::executor::v1::ProcessBatchV2StreamResponseDefaultTypeInternal, block_response_),
+  offsetof(::executor::v1::ProcessBatchV2StreamResponseDefaultTypeInternal, batch_response_),
+  PROTOBUF_FIELD_OFFSET(::executor::v1::ProcessBatchV2StreamResponse, response_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::executor::v1::ResponseDebug, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -1480,21 +1511,22 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 326, -1, sizeof(::executor::v1::DebugV2)},
   { 336, 343, sizeof(::executor::v1::ProcessBatchResponseV2_ReadWriteAddressesEntry_DoNotUse)},
   { 345, -1, sizeof(::executor::v1::ProcessBatchResponseV2)},
-  { 384, -1, sizeof(::executor::v1::ResponseDebug)},
-  { 390, -1, sizeof(::executor::v1::TraceConfigV2)},
-  { 400, 407, sizeof(::executor::v1::OverrideAccountV2_StateEntry_DoNotUse)},
-  { 409, 416, sizeof(::executor::v1::OverrideAccountV2_StateDiffEntry_DoNotUse)},
-  { 418, -1, sizeof(::executor::v1::OverrideAccountV2)},
-  { 428, 435, sizeof(::executor::v1::InfoReadWriteV2_ScStorageEntry_DoNotUse)},
-  { 437, -1, sizeof(::executor::v1::InfoReadWriteV2)},
-  { 447, -1, sizeof(::executor::v1::FullTraceV2)},
-  { 454, -1, sizeof(::executor::v1::TransactionContextV2)},
-  { 474, 481, sizeof(::executor::v1::TransactionStepV2_StorageEntry_DoNotUse)},
-  { 483, -1, sizeof(::executor::v1::TransactionStepV2)},
-  { 503, -1, sizeof(::executor::v1::ContractV2)},
-  { 514, -1, sizeof(::executor::v1::ProcessBlockResponseV2)},
-  { 532, -1, sizeof(::executor::v1::ProcessTransactionResponseV2)},
-  { 558, -1, sizeof(::executor::v1::LogV2)},
+  { 384, -1, sizeof(::executor::v1::ProcessBatchV2StreamResponse)},
+  { 392, -1, sizeof(::executor::v1::ResponseDebug)},
+  { 398, -1, sizeof(::executor::v1::TraceConfigV2)},
+  { 408, 415, sizeof(::executor::v1::OverrideAccountV2_StateEntry_DoNotUse)},
+  { 417, 424, sizeof(::executor::v1::OverrideAccountV2_StateDiffEntry_DoNotUse)},
+  { 426, -1, sizeof(::executor::v1::OverrideAccountV2)},
+  { 436, 443, sizeof(::executor::v1::InfoReadWriteV2_ScStorageEntry_DoNotUse)},
+  { 445, -1, sizeof(::executor::v1::InfoReadWriteV2)},
+  { 455, -1, sizeof(::executor::v1::FullTraceV2)},
+  { 462, -1, sizeof(::executor::v1::TransactionContextV2)},
+  { 482, 489, sizeof(::executor::v1::TransactionStepV2_StorageEntry_DoNotUse)},
+  { 491, -1, sizeof(::executor::v1::TransactionStepV2)},
+  { 511, -1, sizeof(::executor::v1::ContractV2)},
+  { 522, -1, sizeof(::executor::v1::ProcessBlockResponseV2)},
+  { 540, -1, sizeof(::executor::v1::ProcessTransactionResponseV2)},
+  { 566, -1, sizeof(::executor::v1::LogV2)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -1527,6 +1559,7 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::executor::v1::_DebugV2_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::executor::v1::_ProcessBatchResponseV2_ReadWriteAddressesEntry_DoNotUse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::executor::v1::_ProcessBatchResponseV2_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::executor::v1::_ProcessBatchV2StreamResponse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::executor::v1::_ResponseDebug_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::executor::v1::_TraceConfigV2_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::executor::v1::_OverrideAccountV2_StateEntry_DoNotUse_default_instance_),
@@ -1705,266 +1738,273 @@ const char descriptor_table_protodef_executor_2eproto[] PROTOBUF_SECTION_VARIABL
   "tate_root\030! \001(\014\022)\n\005debug\030\" \001(\0132\032.executo"
   "r.v1.ResponseDebug\032W\n\027ReadWriteAddresses"
   "Entry\022\013\n\003key\030\001 \001(\t\022+\n\005value\030\002 \001(\0132\034.exec"
-  "utor.v1.InfoReadWriteV2:\0028\001\"\"\n\rResponseD"
-  "ebug\022\021\n\terror_log\030\001 \001(\t\"\232\001\n\rTraceConfigV"
-  "2\022\027\n\017disable_storage\030\001 \001(\r\022\025\n\rdisable_st"
-  "ack\030\002 \001(\r\022\025\n\renable_memory\030\003 \001(\r\022\032\n\022enab"
-  "le_return_data\030\004 \001(\r\022&\n\036tx_hash_to_gener"
-  "ate_full_trace\030\005 \001(\014\"\236\002\n\021OverrideAccount"
-  "V2\022\017\n\007balance\030\001 \001(\014\022\r\n\005nonce\030\002 \001(\004\022\014\n\004co"
-  "de\030\003 \001(\014\0228\n\005state\030\004 \003(\0132).executor.v1.Ov"
-  "errideAccountV2.StateEntry\022A\n\nstate_diff"
-  "\030\005 \003(\0132-.executor.v1.OverrideAccountV2.S"
-  "tateDiffEntry\032,\n\nStateEntry\022\013\n\003key\030\001 \001(\t"
-  "\022\r\n\005value\030\002 \001(\t:\0028\001\0320\n\016StateDiffEntry\022\013\n"
-  "\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"\310\001\n\017InfoRe"
-  "adWriteV2\022\r\n\005nonce\030\001 \001(\t\022\017\n\007balance\030\002 \001("
-  "\t\022\017\n\007sc_code\030\003 \001(\t\022\?\n\nsc_storage\030\004 \003(\0132+"
-  ".executor.v1.InfoReadWriteV2.ScStorageEn"
-  "try\022\021\n\tsc_length\030\005 \001(\t\0320\n\016ScStorageEntry"
-  "\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"p\n\013Full"
-  "TraceV2\0222\n\007context\030\001 \001(\0132!.executor.v1.T"
-  "ransactionContextV2\022-\n\005steps\030\002 \003(\0132\036.exe"
-  "cutor.v1.TransactionStepV2\"\224\002\n\024Transacti"
-  "onContextV2\022\014\n\004type\030\001 \001(\t\022\014\n\004from\030\002 \001(\t\022"
-  "\n\n\002to\030\003 \001(\t\022\014\n\004data\030\004 \001(\014\022\013\n\003gas\030\005 \001(\004\022\r"
-  "\n\005value\030\006 \001(\t\022\022\n\nblock_hash\030\007 \001(\014\022\016\n\006out"
-  "put\030\010 \001(\014\022\020\n\010gas_used\030\t \001(\004\022\021\n\tgas_price"
-  "\030\n \001(\t\022\026\n\016execution_time\030\013 \001(\r\022\026\n\016old_st"
-  "ate_root\030\014 \001(\014\022\r\n\005nonce\030\r \001(\004\022\020\n\010tx_inde"
-  "x\030\016 \001(\004\022\020\n\010chain_id\030\017 \001(\004\"\240\003\n\021Transactio"
-  "nStepV2\022\022\n\nstate_root\030\001 \001(\014\022\r\n\005depth\030\002 \001"
-  "(\r\022\n\n\002pc\030\003 \001(\004\022\013\n\003gas\030\004 \001(\004\022\020\n\010gas_cost\030"
-  "\005 \001(\004\022\022\n\ngas_refund\030\006 \001(\004\022\n\n\002op\030\007 \001(\r\022\r\n"
-  "\005stack\030\010 \003(\t\022\016\n\006memory\030\t \001(\014\022\023\n\013memory_s"
-  "ize\030\n \001(\r\022\025\n\rmemory_offset\030\013 \001(\r\022\023\n\013retu"
-  "rn_data\030\014 \001(\014\022)\n\010contract\030\r \001(\0132\027.execut"
-  "or.v1.ContractV2\022$\n\005error\030\016 \001(\0162\025.execut"
-  "or.v1.RomError\022<\n\007storage\030\017 \003(\0132+.execut"
-  "or.v1.TransactionStepV2.StorageEntry\032.\n\014"
-  "StorageEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t"
-  ":\0028\001\"e\n\nContractV2\022\017\n\007address\030\001 \001(\t\022\016\n\006c"
-  "aller\030\002 \001(\t\022\r\n\005value\030\003 \001(\t\022\014\n\004data\030\004 \001(\014"
-  "\022\013\n\003gas\030\005 \001(\004\022\014\n\004type\030\006 \001(\t\"\344\002\n\026ProcessB"
-  "lockResponseV2\022\023\n\013parent_hash\030\001 \001(\014\022\020\n\010c"
-  "oinbase\030\002 \001(\t\022\021\n\tgas_limit\030\003 \001(\004\022\024\n\014bloc"
-  "k_number\030\004 \001(\004\022\021\n\ttimestamp\030\005 \001(\004\022\013\n\003ger"
-  "\030\006 \001(\014\022\025\n\rblock_hash_l1\030\007 \001(\014\022\020\n\010gas_use"
-  "d\030\010 \001(\004\022\027\n\017block_info_root\030\t \001(\014\022\022\n\nbloc"
-  "k_hash\030\n \001(\014\022<\n\tresponses\030\013 \003(\0132).execut"
-  "or.v1.ProcessTransactionResponseV2\022 \n\004lo"
-  "gs\030\014 \003(\0132\022.executor.v1.LogV2\022$\n\005error\030\r "
-  "\001(\0162\025.executor.v1.RomError\"\236\004\n\034ProcessTr"
-  "ansactionResponseV2\022\017\n\007tx_hash\030\001 \001(\014\022\022\n\n"
-  "tx_hash_l2\030\002 \001(\014\022\016\n\006rlp_tx\030\003 \001(\014\022\022\n\nbloc"
-  "k_hash\030\004 \001(\014\022\024\n\014block_number\030\005 \001(\004\022\014\n\004ty"
-  "pe\030\006 \001(\r\022\024\n\014return_value\030\007 \001(\014\022\020\n\010gas_le"
-  "ft\030\010 \001(\004\022\020\n\010gas_used\030\t \001(\004\022\033\n\023cumulative"
-  "_gas_used\030\n \001(\004\022\024\n\014gas_refunded\030\013 \001(\004\022$\n"
-  "\005error\030\014 \001(\0162\025.executor.v1.RomError\022\026\n\016c"
-  "reate_address\030\r \001(\t\022\022\n\nstate_root\030\016 \001(\014\022"
-  " \n\004logs\030\017 \003(\0132\022.executor.v1.LogV2\022,\n\nful"
-  "l_trace\030\020 \001(\0132\030.executor.v1.FullTraceV2\022"
-  "\033\n\023effective_gas_price\030\021 \001(\t\022\034\n\024effectiv"
-  "e_percentage\030\022 \001(\r\022\033\n\023has_gasprice_opcod"
-  "e\030\023 \001(\r\022\032\n\022has_balance_opcode\030\024 \001(\r\022\016\n\006s"
-  "tatus\030\025 \001(\r\"\246\001\n\005LogV2\022\017\n\007address\030\001 \001(\t\022\016"
-  "\n\006topics\030\002 \003(\014\022\014\n\004data\030\003 \001(\014\022\024\n\014block_nu"
-  "mber\030\004 \001(\004\022\017\n\007tx_hash\030\005 \001(\014\022\022\n\ntx_hash_l"
-  "2\030\006 \001(\014\022\020\n\010tx_index\030\007 \001(\r\022\022\n\nblock_hash\030"
-  "\010 \001(\014\022\r\n\005index\030\t \001(\r*\347\n\n\010RomError\022\031\n\025ROM"
-  "_ERROR_UNSPECIFIED\020\000\022\026\n\022ROM_ERROR_NO_ERR"
-  "OR\020\001\022\030\n\024ROM_ERROR_OUT_OF_GAS\020\002\022\034\n\030ROM_ER"
-  "ROR_STACK_OVERFLOW\020\003\022\035\n\031ROM_ERROR_STACK_"
-  "UNDERFLOW\020\004\022$\n ROM_ERROR_MAX_CODE_SIZE_E"
-  "XCEEDED\020\005\022(\n$ROM_ERROR_CONTRACT_ADDRESS_"
-  "COLLISION\020\006\022 \n\034ROM_ERROR_EXECUTION_REVER"
-  "TED\020\007\022\"\n\036ROM_ERROR_OUT_OF_COUNTERS_STEP\020"
-  "\010\022$\n ROM_ERROR_OUT_OF_COUNTERS_KECCAK\020\t\022"
-  "$\n ROM_ERROR_OUT_OF_COUNTERS_BINARY\020\n\022!\n"
-  "\035ROM_ERROR_OUT_OF_COUNTERS_MEM\020\013\022#\n\037ROM_"
-  "ERROR_OUT_OF_COUNTERS_ARITH\020\014\022%\n!ROM_ERR"
-  "OR_OUT_OF_COUNTERS_PADDING\020\r\022&\n\"ROM_ERRO"
-  "R_OUT_OF_COUNTERS_POSEIDON\020\016\022!\n\035ROM_ERRO"
-  "R_OUT_OF_COUNTERS_SHA\020\017\022\032\n\026ROM_ERROR_INV"
-  "ALID_JUMP\020\020\022\034\n\030ROM_ERROR_INVALID_OPCODE\020"
-  "\021\022\034\n\030ROM_ERROR_INVALID_STATIC\020\022\022(\n$ROM_E"
-  "RROR_INVALID_BYTECODE_STARTS_EF\020\023\022)\n%ROM"
-  "_ERROR_INTRINSIC_INVALID_SIGNATURE\020\024\022(\n$"
-  "ROM_ERROR_INTRINSIC_INVALID_CHAIN_ID\020\025\022%"
-  "\n!ROM_ERROR_INTRINSIC_INVALID_NONCE\020\026\022)\n"
-  "%ROM_ERROR_INTRINSIC_INVALID_GAS_LIMIT\020\027"
-  "\022\'\n#ROM_ERROR_INTRINSIC_INVALID_BALANCE\020"
-  "\030\022/\n+ROM_ERROR_INTRINSIC_INVALID_BATCH_G"
-  "AS_LIMIT\020\031\022+\n\'ROM_ERROR_INTRINSIC_INVALI"
-  "D_SENDER_CODE\020\032\022\'\n#ROM_ERROR_INTRINSIC_T"
-  "X_GAS_OVERFLOW\020\033\022 \n\034ROM_ERROR_BATCH_DATA"
-  "_TOO_BIG\020\034\022!\n\035ROM_ERROR_UNSUPPORTED_FORK"
-  "_ID\020\035\022\031\n\025ROM_ERROR_INVALID_RLP\020\036\022,\n(ROM_"
-  "ERROR_INVALID_DECODE_CHANGE_L2_BLOCK\020\037\0222"
-  "\n.ROM_ERROR_INVALID_NOT_FIRST_TX_CHANGE_"
-  "L2_BLOCK\020 \0228\n4ROM_ERROR_INVALID_TX_CHANG"
-  "E_L2_BLOCK_LIMIT_TIMESTAMP\020!\0226\n2ROM_ERRO"
-  "R_INVALID_TX_CHANGE_L2_BLOCK_MIN_TIMESTA"
-  "MP\020\"\022(\n$ROM_ERROR_INVALID_L1_INFO_TREE_I"
-  "NDEX\020#*\355+\n\rExecutorError\022\036\n\032EXECUTOR_ERR"
-  "OR_UNSPECIFIED\020\000\022\033\n\027EXECUTOR_ERROR_NO_ER"
-  "ROR\020\001\022\033\n\027EXECUTOR_ERROR_DB_ERROR\020\002\0222\n.EX"
-  "ECUTOR_ERROR_SM_MAIN_COUNTERS_OVERFLOW_S"
-  "TEPS\020\003\0223\n/EXECUTOR_ERROR_SM_MAIN_COUNTER"
-  "S_OVERFLOW_KECCAK\020\004\0223\n/EXECUTOR_ERROR_SM"
-  "_MAIN_COUNTERS_OVERFLOW_BINARY\020\005\0220\n,EXEC"
-  "UTOR_ERROR_SM_MAIN_COUNTERS_OVERFLOW_MEM"
-  "\020\006\0222\n.EXECUTOR_ERROR_SM_MAIN_COUNTERS_OV"
-  "ERFLOW_ARITH\020\007\0224\n0EXECUTOR_ERROR_SM_MAIN"
-  "_COUNTERS_OVERFLOW_PADDING\020\010\0225\n1EXECUTOR"
-  "_ERROR_SM_MAIN_COUNTERS_OVERFLOW_POSEIDO"
-  "N\020\t\022&\n\"EXECUTOR_ERROR_UNSUPPORTED_FORK_I"
-  "D\020\n\022#\n\037EXECUTOR_ERROR_BALANCE_MISMATCH\020\013"
-  "\022\035\n\031EXECUTOR_ERROR_FEA2SCALAR\020\014\022\030\n\024EXECU"
-  "TOR_ERROR_TOS32\020\r\022.\n*EXECUTOR_ERROR_SM_M"
-  "AIN_INVALID_UNSIGNED_TX\020\016\022.\n*EXECUTOR_ER"
-  "ROR_SM_MAIN_INVALID_NO_COUNTERS\020\017\0229\n5EXE"
-  "CUTOR_ERROR_SM_MAIN_ARITH_ECRECOVER_DIVI"
-  "DE_BY_ZERO\020\020\022/\n+EXECUTOR_ERROR_SM_MAIN_A"
-  "DDRESS_OUT_OF_RANGE\020\021\022+\n\'EXECUTOR_ERROR_"
-  "SM_MAIN_ADDRESS_NEGATIVE\020\022\022.\n*EXECUTOR_E"
-  "RROR_SM_MAIN_STORAGE_INVALID_KEY\020\023\022 \n\034EX"
-  "ECUTOR_ERROR_SM_MAIN_HASHK\020\024\0222\n.EXECUTOR"
-  "_ERROR_SM_MAIN_HASHK_SIZE_OUT_OF_RANGE\020\025"
-  "\0222\n.EXECUTOR_ERROR_SM_MAIN_HASHK_POSITIO"
-  "N_NEGATIVE\020\026\022@\n<EXECUTOR_ERROR_SM_MAIN_H"
-  "ASHK_POSITION_PLUS_SIZE_OUT_OF_RANGE\020\027\0228"
-  "\n4EXECUTOR_ERROR_SM_MAIN_HASHKDIGEST_ADD"
-  "RESS_NOT_FOUND\020\030\0224\n0EXECUTOR_ERROR_SM_MA"
-  "IN_HASHKDIGEST_NOT_COMPLETED\020\031\022 \n\034EXECUT"
-  "OR_ERROR_SM_MAIN_HASHP\020\032\0222\n.EXECUTOR_ERR"
-  "OR_SM_MAIN_HASHP_SIZE_OUT_OF_RANGE\020\033\0222\n."
-  "EXECUTOR_ERROR_SM_MAIN_HASHP_POSITION_NE"
-  "GATIVE\020\034\022@\n<EXECUTOR_ERROR_SM_MAIN_HASHP"
-  "_POSITION_PLUS_SIZE_OUT_OF_RANGE\020\035\0228\n4EX"
-  "ECUTOR_ERROR_SM_MAIN_HASHPDIGEST_ADDRESS"
-  "_NOT_FOUND\020\036\0224\n0EXECUTOR_ERROR_SM_MAIN_H"
-  "ASHPDIGEST_NOT_COMPLETED\020\037\0227\n3EXECUTOR_E"
-  "RROR_SM_MAIN_MEMALIGN_OFFSET_OUT_OF_RANG"
-  "E\020 \022*\n&EXECUTOR_ERROR_SM_MAIN_MULTIPLE_F"
-  "REEIN\020!\022!\n\035EXECUTOR_ERROR_SM_MAIN_ASSERT"
-  "\020\"\022!\n\035EXECUTOR_ERROR_SM_MAIN_MEMORY\020#\0220\n"
-  ",EXECUTOR_ERROR_SM_MAIN_STORAGE_READ_MIS"
-  "MATCH\020$\0221\n-EXECUTOR_ERROR_SM_MAIN_STORAG"
-  "E_WRITE_MISMATCH\020%\022/\n+EXECUTOR_ERROR_SM_"
-  "MAIN_HASHK_VALUE_MISMATCH\020&\0221\n-EXECUTOR_"
-  "ERROR_SM_MAIN_HASHK_PADDING_MISMATCH\020\'\022."
-  "\n*EXECUTOR_ERROR_SM_MAIN_HASHK_SIZE_MISM"
-  "ATCH\020(\0223\n/EXECUTOR_ERROR_SM_MAIN_HASHKLE"
-  "N_LENGTH_MISMATCH\020)\0220\n,EXECUTOR_ERROR_SM"
-  "_MAIN_HASHKLEN_CALLED_TWICE\020*\0220\n,EXECUTO"
-  "R_ERROR_SM_MAIN_HASHKDIGEST_NOT_FOUND\020+\022"
-  "6\n2EXECUTOR_ERROR_SM_MAIN_HASHKDIGEST_DI"
-  "GEST_MISMATCH\020,\0223\n/EXECUTOR_ERROR_SM_MAI"
-  "N_HASHKDIGEST_CALLED_TWICE\020-\022/\n+EXECUTOR"
-  "_ERROR_SM_MAIN_HASHP_VALUE_MISMATCH\020.\0221\n"
-  "-EXECUTOR_ERROR_SM_MAIN_HASHP_PADDING_MI"
-  "SMATCH\020/\022.\n*EXECUTOR_ERROR_SM_MAIN_HASHP"
-  "_SIZE_MISMATCH\0200\0223\n/EXECUTOR_ERROR_SM_MA"
-  "IN_HASHPLEN_LENGTH_MISMATCH\0201\0220\n,EXECUTO"
-  "R_ERROR_SM_MAIN_HASHPLEN_CALLED_TWICE\0202\022"
-  "6\n2EXECUTOR_ERROR_SM_MAIN_HASHPDIGEST_DI"
-  "GEST_MISMATCH\0203\0223\n/EXECUTOR_ERROR_SM_MAI"
-  "N_HASHPDIGEST_CALLED_TWICE\0204\022)\n%EXECUTOR"
-  "_ERROR_SM_MAIN_ARITH_MISMATCH\0205\0223\n/EXECU"
-  "TOR_ERROR_SM_MAIN_ARITH_ECRECOVER_MISMAT"
-  "CH\0206\022.\n*EXECUTOR_ERROR_SM_MAIN_BINARY_AD"
-  "D_MISMATCH\0207\022.\n*EXECUTOR_ERROR_SM_MAIN_B"
-  "INARY_SUB_MISMATCH\0208\022-\n)EXECUTOR_ERROR_S"
-  "M_MAIN_BINARY_LT_MISMATCH\0209\022.\n*EXECUTOR_"
-  "ERROR_SM_MAIN_BINARY_SLT_MISMATCH\020:\022-\n)E"
-  "XECUTOR_ERROR_SM_MAIN_BINARY_EQ_MISMATCH"
-  "\020;\022.\n*EXECUTOR_ERROR_SM_MAIN_BINARY_AND_"
-  "MISMATCH\020<\022-\n)EXECUTOR_ERROR_SM_MAIN_BIN"
-  "ARY_OR_MISMATCH\020=\022.\n*EXECUTOR_ERROR_SM_M"
-  "AIN_BINARY_XOR_MISMATCH\020>\0222\n.EXECUTOR_ER"
-  "ROR_SM_MAIN_MEMALIGN_WRITE_MISMATCH\020\?\0223\n"
-  "/EXECUTOR_ERROR_SM_MAIN_MEMALIGN_WRITE8_"
-  "MISMATCH\020@\0221\n-EXECUTOR_ERROR_SM_MAIN_MEM"
-  "ALIGN_READ_MISMATCH\020A\022,\n(EXECUTOR_ERROR_"
-  "SM_MAIN_JMPN_OUT_OF_RANGE\020B\0222\n.EXECUTOR_"
-  "ERROR_SM_MAIN_HASHK_READ_OUT_OF_RANGE\020C\022"
-  "2\n.EXECUTOR_ERROR_SM_MAIN_HASHP_READ_OUT"
-  "_OF_RANGE\020D\022)\n%EXECUTOR_ERROR_INVALID_OL"
-  "D_STATE_ROOT\020E\022-\n)EXECUTOR_ERROR_INVALID"
-  "_OLD_ACC_INPUT_HASH\020F\022#\n\037EXECUTOR_ERROR_"
-  "INVALID_CHAIN_ID\020G\022(\n$EXECUTOR_ERROR_INV"
-  "ALID_BATCH_L2_DATA\020H\022+\n\'EXECUTOR_ERROR_I"
-  "NVALID_GLOBAL_EXIT_ROOT\020I\022#\n\037EXECUTOR_ER"
-  "ROR_INVALID_COINBASE\020J\022\037\n\033EXECUTOR_ERROR"
-  "_INVALID_FROM\020K\022!\n\035EXECUTOR_ERROR_INVALI"
-  "D_DB_KEY\020L\022#\n\037EXECUTOR_ERROR_INVALID_DB_"
-  "VALUE\020M\0221\n-EXECUTOR_ERROR_INVALID_CONTRA"
-  "CTS_BYTECODE_KEY\020N\0223\n/EXECUTOR_ERROR_INV"
-  "ALID_CONTRACTS_BYTECODE_VALUE\020O\022\"\n\036EXECU"
-  "TOR_ERROR_INVALID_GET_KEY\020P\0223\n/EXECUTOR_"
-  "ERROR_SM_MAIN_COUNTERS_OVERFLOW_SHA256\020Q"
-  "\022 \n\034EXECUTOR_ERROR_SM_MAIN_HASHS\020R\0222\n.EX"
-  "ECUTOR_ERROR_SM_MAIN_HASHS_SIZE_OUT_OF_R"
-  "ANGE\020S\0222\n.EXECUTOR_ERROR_SM_MAIN_HASHS_P"
-  "OSITION_NEGATIVE\020T\022@\n<EXECUTOR_ERROR_SM_"
-  "MAIN_HASHS_POSITION_PLUS_SIZE_OUT_OF_RAN"
-  "GE\020U\0228\n4EXECUTOR_ERROR_SM_MAIN_HASHSDIGE"
-  "ST_ADDRESS_NOT_FOUND\020V\0224\n0EXECUTOR_ERROR"
-  "_SM_MAIN_HASHSDIGEST_NOT_COMPLETED\020W\022/\n+"
-  "EXECUTOR_ERROR_SM_MAIN_HASHS_VALUE_MISMA"
-  "TCH\020X\0221\n-EXECUTOR_ERROR_SM_MAIN_HASHS_PA"
-  "DDING_MISMATCH\020Y\022.\n*EXECUTOR_ERROR_SM_MA"
-  "IN_HASHS_SIZE_MISMATCH\020Z\0223\n/EXECUTOR_ERR"
-  "OR_SM_MAIN_HASHSLEN_LENGTH_MISMATCH\020[\0220\n"
-  ",EXECUTOR_ERROR_SM_MAIN_HASHSLEN_CALLED_"
-  "TWICE\020\\\0220\n,EXECUTOR_ERROR_SM_MAIN_HASHSD"
-  "IGEST_NOT_FOUND\020]\0226\n2EXECUTOR_ERROR_SM_M"
-  "AIN_HASHSDIGEST_DIGEST_MISMATCH\020^\0223\n/EXE"
-  "CUTOR_ERROR_SM_MAIN_HASHSDIGEST_CALLED_T"
-  "WICE\020_\0222\n.EXECUTOR_ERROR_SM_MAIN_HASHS_R"
-  "EAD_OUT_OF_RANGE\020`\022\'\n#EXECUTOR_ERROR_INV"
-  "ALID_L1_INFO_ROOT\020a\022.\n*EXECUTOR_ERROR_IN"
-  "VALID_FORCED_BLOCKHASH_L1\020b\0226\n2EXECUTOR_"
-  "ERROR_INVALID_L1_DATA_V2_GLOBAL_EXIT_ROO"
-  "T\020c\0223\n/EXECUTOR_ERROR_INVALID_L1_DATA_V2"
-  "_BLOCK_HASH_L1\020d\022\'\n#EXECUTOR_ERROR_INVAL"
-  "ID_L1_SMT_PROOF\020e\022\"\n\036EXECUTOR_ERROR_INVA"
-  "LID_BALANCE\020f\022.\n*EXECUTOR_ERROR_SM_MAIN_"
-  "BINARY_LT4_MISMATCH\020g\022)\n%EXECUTOR_ERROR_"
-  "INVALID_NEW_STATE_ROOT\020h\022-\n)EXECUTOR_ERR"
-  "OR_INVALID_NEW_ACC_INPUT_HASH\020i\022.\n*EXECU"
-  "TOR_ERROR_INVALID_NEW_LOCAL_EXIT_ROOT\020j\022"
-  "#\n\037EXECUTOR_ERROR_DB_KEY_NOT_FOUND\020k\022(\n$"
-  "EXECUTOR_ERROR_SMT_INVALID_DATA_SIZE\020l\022$"
-  "\n EXECUTOR_ERROR_HASHDB_GRPC_ERROR\020m\022 \n\034"
-  "EXECUTOR_ERROR_STATE_MANAGER\020n\022-\n)EXECUT"
-  "OR_ERROR_INVALID_L1_INFO_TREE_INDEX\020o\0227\n"
-  "3EXECUTOR_ERROR_INVALID_L1_INFO_TREE_SMT"
-  "_PROOF_VALUE\020p\022\"\n\036EXECUTOR_ERROR_INVALID"
-  "_WITNESS\020q\022\037\n\033EXECUTOR_ERROR_INVALID_CBO"
-  "R\020r\022&\n\"EXECUTOR_ERROR_INVALID_DATA_STREA"
-  "M\020s\022-\n)EXECUTOR_ERROR_INVALID_UPDATE_MER"
-  "KLE_TREE\020t\0222\n.EXECUTOR_ERROR_SM_MAIN_INV"
-  "ALID_TX_STATUS_ERROR\020u2\205\003\n\017ExecutorServi"
-  "ce\022U\n\014ProcessBatch\022 .executor.v1.Process"
-  "BatchRequest\032!.executor.v1.ProcessBatchR"
-  "esponse\"\000\022[\n\016ProcessBatchV2\022\".executor.v"
-  "1.ProcessBatchRequestV2\032#.executor.v1.Pr"
-  "ocessBatchResponseV2\"\000\022m\n\027ProcessStatele"
-  "ssBatchV2\022+.executor.v1.ProcessStateless"
-  "BatchRequestV2\032#.executor.v1.ProcessBatc"
-  "hResponseV2\"\000\022O\n\016GetFlushStatus\022\026.google"
-  ".protobuf.Empty\032#.executor.v1.GetFlushSt"
-  "atusResponse\"\000B>Z<github.com/0xPolygonHe"
-  "rmez/zkevm-node/state/runtime/executorb\006"
-  "proto3"
+  "utor.v1.InfoReadWriteV2:\0028\001\"\250\001\n\034ProcessB"
+  "atchV2StreamResponse\022=\n\016block_response\030\001"
+  " \001(\0132#.executor.v1.ProcessBlockResponseV"
+  "2H\000\022=\n\016batch_response\030\002 \001(\0132#.executor.v"
+  "1.ProcessBatchResponseV2H\000B\n\n\010response\"\""
+  "\n\rResponseDebug\022\021\n\terror_log\030\001 \001(\t\"\232\001\n\rT"
+  "raceConfigV2\022\027\n\017disable_storage\030\001 \001(\r\022\025\n"
+  "\rdisable_stack\030\002 \001(\r\022\025\n\renable_memory\030\003 "
+  "\001(\r\022\032\n\022enable_return_data\030\004 \001(\r\022&\n\036tx_ha"
+  "sh_to_generate_full_trace\030\005 \001(\014\"\236\002\n\021Over"
+  "rideAccountV2\022\017\n\007balance\030\001 \001(\014\022\r\n\005nonce\030"
+  "\002 \001(\004\022\014\n\004code\030\003 \001(\014\0228\n\005state\030\004 \003(\0132).exe"
+  "cutor.v1.OverrideAccountV2.StateEntry\022A\n"
+  "\nstate_diff\030\005 \003(\0132-.executor.v1.Override"
+  "AccountV2.StateDiffEntry\032,\n\nStateEntry\022\013"
+  "\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\0320\n\016StateD"
+  "iffEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001"
+  "\"\310\001\n\017InfoReadWriteV2\022\r\n\005nonce\030\001 \001(\t\022\017\n\007b"
+  "alance\030\002 \001(\t\022\017\n\007sc_code\030\003 \001(\t\022\?\n\nsc_stor"
+  "age\030\004 \003(\0132+.executor.v1.InfoReadWriteV2."
+  "ScStorageEntry\022\021\n\tsc_length\030\005 \001(\t\0320\n\016ScS"
+  "torageEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:"
+  "\0028\001\"p\n\013FullTraceV2\0222\n\007context\030\001 \001(\0132!.ex"
+  "ecutor.v1.TransactionContextV2\022-\n\005steps\030"
+  "\002 \003(\0132\036.executor.v1.TransactionStepV2\"\224\002"
+  "\n\024TransactionContextV2\022\014\n\004type\030\001 \001(\t\022\014\n\004"
+  "from\030\002 \001(\t\022\n\n\002to\030\003 \001(\t\022\014\n\004data\030\004 \001(\014\022\013\n\003"
+  "gas\030\005 \001(\004\022\r\n\005value\030\006 \001(\t\022\022\n\nblock_hash\030\007"
+  " \001(\014\022\016\n\006output\030\010 \001(\014\022\020\n\010gas_used\030\t \001(\004\022\021"
+  "\n\tgas_price\030\n \001(\t\022\026\n\016execution_time\030\013 \001("
+  "\r\022\026\n\016old_state_root\030\014 \001(\014\022\r\n\005nonce\030\r \001(\004"
+  "\022\020\n\010tx_index\030\016 \001(\004\022\020\n\010chain_id\030\017 \001(\004\"\240\003\n"
+  "\021TransactionStepV2\022\022\n\nstate_root\030\001 \001(\014\022\r"
+  "\n\005depth\030\002 \001(\r\022\n\n\002pc\030\003 \001(\004\022\013\n\003gas\030\004 \001(\004\022\020"
+  "\n\010gas_cost\030\005 \001(\004\022\022\n\ngas_refund\030\006 \001(\004\022\n\n\002"
+  "op\030\007 \001(\r\022\r\n\005stack\030\010 \003(\t\022\016\n\006memory\030\t \001(\014\022"
+  "\023\n\013memory_size\030\n \001(\r\022\025\n\rmemory_offset\030\013 "
+  "\001(\r\022\023\n\013return_data\030\014 \001(\014\022)\n\010contract\030\r \001"
+  "(\0132\027.executor.v1.ContractV2\022$\n\005error\030\016 \001"
+  "(\0162\025.executor.v1.RomError\022<\n\007storage\030\017 \003"
+  "(\0132+.executor.v1.TransactionStepV2.Stora"
+  "geEntry\032.\n\014StorageEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005"
+  "value\030\002 \001(\t:\0028\001\"e\n\nContractV2\022\017\n\007address"
+  "\030\001 \001(\t\022\016\n\006caller\030\002 \001(\t\022\r\n\005value\030\003 \001(\t\022\014\n"
+  "\004data\030\004 \001(\014\022\013\n\003gas\030\005 \001(\004\022\014\n\004type\030\006 \001(\t\"\344"
+  "\002\n\026ProcessBlockResponseV2\022\023\n\013parent_hash"
+  "\030\001 \001(\014\022\020\n\010coinbase\030\002 \001(\t\022\021\n\tgas_limit\030\003 "
+  "\001(\004\022\024\n\014block_number\030\004 \001(\004\022\021\n\ttimestamp\030\005"
+  " \001(\004\022\013\n\003ger\030\006 \001(\014\022\025\n\rblock_hash_l1\030\007 \001(\014"
+  "\022\020\n\010gas_used\030\010 \001(\004\022\027\n\017block_info_root\030\t "
+  "\001(\014\022\022\n\nblock_hash\030\n \001(\014\022<\n\tresponses\030\013 \003"
+  "(\0132).executor.v1.ProcessTransactionRespo"
+  "nseV2\022 \n\004logs\030\014 \003(\0132\022.executor.v1.LogV2\022"
+  "$\n\005error\030\r \001(\0162\025.executor.v1.RomError\"\236\004"
+  "\n\034ProcessTransactionResponseV2\022\017\n\007tx_has"
+  "h\030\001 \001(\014\022\022\n\ntx_hash_l2\030\002 \001(\014\022\016\n\006rlp_tx\030\003 "
+  "\001(\014\022\022\n\nblock_hash\030\004 \001(\014\022\024\n\014block_number\030"
+  "\005 \001(\004\022\014\n\004type\030\006 \001(\r\022\024\n\014return_value\030\007 \001("
+  "\014\022\020\n\010gas_left\030\010 \001(\004\022\020\n\010gas_used\030\t \001(\004\022\033\n"
+  "\023cumulative_gas_used\030\n \001(\004\022\024\n\014gas_refund"
+  "ed\030\013 \001(\004\022$\n\005error\030\014 \001(\0162\025.executor.v1.Ro"
+  "mError\022\026\n\016create_address\030\r \001(\t\022\022\n\nstate_"
+  "root\030\016 \001(\014\022 \n\004logs\030\017 \003(\0132\022.executor.v1.L"
+  "ogV2\022,\n\nfull_trace\030\020 \001(\0132\030.executor.v1.F"
+  "ullTraceV2\022\033\n\023effective_gas_price\030\021 \001(\t\022"
+  "\034\n\024effective_percentage\030\022 \001(\r\022\033\n\023has_gas"
+  "price_opcode\030\023 \001(\r\022\032\n\022has_balance_opcode"
+  "\030\024 \001(\r\022\016\n\006status\030\025 \001(\r\"\246\001\n\005LogV2\022\017\n\007addr"
+  "ess\030\001 \001(\t\022\016\n\006topics\030\002 \003(\014\022\014\n\004data\030\003 \001(\014\022"
+  "\024\n\014block_number\030\004 \001(\004\022\017\n\007tx_hash\030\005 \001(\014\022\022"
+  "\n\ntx_hash_l2\030\006 \001(\014\022\020\n\010tx_index\030\007 \001(\r\022\022\n\n"
+  "block_hash\030\010 \001(\014\022\r\n\005index\030\t \001(\r*\347\n\n\010RomE"
+  "rror\022\031\n\025ROM_ERROR_UNSPECIFIED\020\000\022\026\n\022ROM_E"
+  "RROR_NO_ERROR\020\001\022\030\n\024ROM_ERROR_OUT_OF_GAS\020"
+  "\002\022\034\n\030ROM_ERROR_STACK_OVERFLOW\020\003\022\035\n\031ROM_E"
+  "RROR_STACK_UNDERFLOW\020\004\022$\n ROM_ERROR_MAX_"
+  "CODE_SIZE_EXCEEDED\020\005\022(\n$ROM_ERROR_CONTRA"
+  "CT_ADDRESS_COLLISION\020\006\022 \n\034ROM_ERROR_EXEC"
+  "UTION_REVERTED\020\007\022\"\n\036ROM_ERROR_OUT_OF_COU"
+  "NTERS_STEP\020\010\022$\n ROM_ERROR_OUT_OF_COUNTER"
+  "S_KECCAK\020\t\022$\n ROM_ERROR_OUT_OF_COUNTERS_"
+  "BINARY\020\n\022!\n\035ROM_ERROR_OUT_OF_COUNTERS_ME"
+  "M\020\013\022#\n\037ROM_ERROR_OUT_OF_COUNTERS_ARITH\020\014"
+  "\022%\n!ROM_ERROR_OUT_OF_COUNTERS_PADDING\020\r\022"
+  "&\n\"ROM_ERROR_OUT_OF_COUNTERS_POSEIDON\020\016\022"
+  "!\n\035ROM_ERROR_OUT_OF_COUNTERS_SHA\020\017\022\032\n\026RO"
+  "M_ERROR_INVALID_JUMP\020\020\022\034\n\030ROM_ERROR_INVA"
+  "LID_OPCODE\020\021\022\034\n\030ROM_ERROR_INVALID_STATIC"
+  "\020\022\022(\n$ROM_ERROR_INVALID_BYTECODE_STARTS_"
+  "EF\020\023\022)\n%ROM_ERROR_INTRINSIC_INVALID_SIGN"
+  "ATURE\020\024\022(\n$ROM_ERROR_INTRINSIC_INVALID_C"
+  "HAIN_ID\020\025\022%\n!ROM_ERROR_INTRINSIC_INVALID"
+  "_NONCE\020\026\022)\n%ROM_ERROR_INTRINSIC_INVALID_"
+  "GAS_LIMIT\020\027\022\'\n#ROM_ERROR_INTRINSIC_INVAL"
+  "ID_BALANCE\020\030\022/\n+ROM_ERROR_INTRINSIC_INVA"
+  "LID_BATCH_GAS_LIMIT\020\031\022+\n\'ROM_ERROR_INTRI"
+  "NSIC_INVALID_SENDER_CODE\020\032\022\'\n#ROM_ERROR_"
+  "INTRINSIC_TX_GAS_OVERFLOW\020\033\022 \n\034ROM_ERROR"
+  "_BATCH_DATA_TOO_BIG\020\034\022!\n\035ROM_ERROR_UNSUP"
+  "PORTED_FORK_ID\020\035\022\031\n\025ROM_ERROR_INVALID_RL"
+  "P\020\036\022,\n(ROM_ERROR_INVALID_DECODE_CHANGE_L"
+  "2_BLOCK\020\037\0222\n.ROM_ERROR_INVALID_NOT_FIRST"
+  "_TX_CHANGE_L2_BLOCK\020 \0228\n4ROM_ERROR_INVAL"
+  "ID_TX_CHANGE_L2_BLOCK_LIMIT_TIMESTAMP\020!\022"
+  "6\n2ROM_ERROR_INVALID_TX_CHANGE_L2_BLOCK_"
+  "MIN_TIMESTAMP\020\"\022(\n$ROM_ERROR_INVALID_L1_"
+  "INFO_TREE_INDEX\020#*\355+\n\rExecutorError\022\036\n\032E"
+  "XECUTOR_ERROR_UNSPECIFIED\020\000\022\033\n\027EXECUTOR_"
+  "ERROR_NO_ERROR\020\001\022\033\n\027EXECUTOR_ERROR_DB_ER"
+  "ROR\020\002\0222\n.EXECUTOR_ERROR_SM_MAIN_COUNTERS"
+  "_OVERFLOW_STEPS\020\003\0223\n/EXECUTOR_ERROR_SM_M"
+  "AIN_COUNTERS_OVERFLOW_KECCAK\020\004\0223\n/EXECUT"
+  "OR_ERROR_SM_MAIN_COUNTERS_OVERFLOW_BINAR"
+  "Y\020\005\0220\n,EXECUTOR_ERROR_SM_MAIN_COUNTERS_O"
+  "VERFLOW_MEM\020\006\0222\n.EXECUTOR_ERROR_SM_MAIN_"
+  "COUNTERS_OVERFLOW_ARITH\020\007\0224\n0EXECUTOR_ER"
+  "ROR_SM_MAIN_COUNTERS_OVERFLOW_PADDING\020\010\022"
+  "5\n1EXECUTOR_ERROR_SM_MAIN_COUNTERS_OVERF"
+  "LOW_POSEIDON\020\t\022&\n\"EXECUTOR_ERROR_UNSUPPO"
+  "RTED_FORK_ID\020\n\022#\n\037EXECUTOR_ERROR_BALANCE"
+  "_MISMATCH\020\013\022\035\n\031EXECUTOR_ERROR_FEA2SCALAR"
+  "\020\014\022\030\n\024EXECUTOR_ERROR_TOS32\020\r\022.\n*EXECUTOR"
+  "_ERROR_SM_MAIN_INVALID_UNSIGNED_TX\020\016\022.\n*"
+  "EXECUTOR_ERROR_SM_MAIN_INVALID_NO_COUNTE"
+  "RS\020\017\0229\n5EXECUTOR_ERROR_SM_MAIN_ARITH_ECR"
+  "ECOVER_DIVIDE_BY_ZERO\020\020\022/\n+EXECUTOR_ERRO"
+  "R_SM_MAIN_ADDRESS_OUT_OF_RANGE\020\021\022+\n\'EXEC"
+  "UTOR_ERROR_SM_MAIN_ADDRESS_NEGATIVE\020\022\022.\n"
+  "*EXECUTOR_ERROR_SM_MAIN_STORAGE_INVALID_"
+  "KEY\020\023\022 \n\034EXECUTOR_ERROR_SM_MAIN_HASHK\020\024\022"
+  "2\n.EXECUTOR_ERROR_SM_MAIN_HASHK_SIZE_OUT"
+  "_OF_RANGE\020\025\0222\n.EXECUTOR_ERROR_SM_MAIN_HA"
+  "SHK_POSITION_NEGATIVE\020\026\022@\n<EXECUTOR_ERRO"
+  "R_SM_MAIN_HASHK_POSITION_PLUS_SIZE_OUT_O"
+  "F_RANGE\020\027\0228\n4EXECUTOR_ERROR_SM_MAIN_HASH"
+  "KDIGEST_ADDRESS_NOT_FOUND\020\030\0224\n0EXECUTOR_"
+  "ERROR_SM_MAIN_HASHKDIGEST_NOT_COMPLETED\020"
+  "\031\022 \n\034EXECUTOR_ERROR_SM_MAIN_HASHP\020\032\0222\n.E"
+  "XECUTOR_ERROR_SM_MAIN_HASHP_SIZE_OUT_OF_"
+  "RANGE\020\033\0222\n.EXECUTOR_ERROR_SM_MAIN_HASHP_"
+  "POSITION_NEGATIVE\020\034\022@\n<EXECUTOR_ERROR_SM"
+  "_MAIN_HASHP_POSITION_PLUS_SIZE_OUT_OF_RA"
+  "NGE\020\035\0228\n4EXECUTOR_ERROR_SM_MAIN_HASHPDIG"
+  "EST_ADDRESS_NOT_FOUND\020\036\0224\n0EXECUTOR_ERRO"
+  "R_SM_MAIN_HASHPDIGEST_NOT_COMPLETED\020\037\0227\n"
+  "3EXECUTOR_ERROR_SM_MAIN_MEMALIGN_OFFSET_"
+  "OUT_OF_RANGE\020 \022*\n&EXECUTOR_ERROR_SM_MAIN"
+  "_MULTIPLE_FREEIN\020!\022!\n\035EXECUTOR_ERROR_SM_"
+  "MAIN_ASSERT\020\"\022!\n\035EXECUTOR_ERROR_SM_MAIN_"
+  "MEMORY\020#\0220\n,EXECUTOR_ERROR_SM_MAIN_STORA"
+  "GE_READ_MISMATCH\020$\0221\n-EXECUTOR_ERROR_SM_"
+  "MAIN_STORAGE_WRITE_MISMATCH\020%\022/\n+EXECUTO"
+  "R_ERROR_SM_MAIN_HASHK_VALUE_MISMATCH\020&\0221"
+  "\n-EXECUTOR_ERROR_SM_MAIN_HASHK_PADDING_M"
+  "ISMATCH\020\'\022.\n*EXECUTOR_ERROR_SM_MAIN_HASH"
+  "K_SIZE_MISMATCH\020(\0223\n/EXECUTOR_ERROR_SM_M"
+  "AIN_HASHKLEN_LENGTH_MISMATCH\020)\0220\n,EXECUT"
+  "OR_ERROR_SM_MAIN_HASHKLEN_CALLED_TWICE\020*"
+  "\0220\n,EXECUTOR_ERROR_SM_MAIN_HASHKDIGEST_N"
+  "OT_FOUND\020+\0226\n2EXECUTOR_ERROR_SM_MAIN_HAS"
+  "HKDIGEST_DIGEST_MISMATCH\020,\0223\n/EXECUTOR_E"
+  "RROR_SM_MAIN_HASHKDIGEST_CALLED_TWICE\020-\022"
+  "/\n+EXECUTOR_ERROR_SM_MAIN_HASHP_VALUE_MI"
+  "SMATCH\020.\0221\n-EXECUTOR_ERROR_SM_MAIN_HASHP"
+  "_PADDING_MISMATCH\020/\022.\n*EXECUTOR_ERROR_SM"
+  "_MAIN_HASHP_SIZE_MISMATCH\0200\0223\n/EXECUTOR_"
+  "ERROR_SM_MAIN_HASHPLEN_LENGTH_MISMATCH\0201"
+  "\0220\n,EXECUTOR_ERROR_SM_MAIN_HASHPLEN_CALL"
+  "ED_TWICE\0202\0226\n2EXECUTOR_ERROR_SM_MAIN_HAS"
+  "HPDIGEST_DIGEST_MISMATCH\0203\0223\n/EXECUTOR_E"
+  "RROR_SM_MAIN_HASHPDIGEST_CALLED_TWICE\0204\022"
+  ")\n%EXECUTOR_ERROR_SM_MAIN_ARITH_MISMATCH"
+  "\0205\0223\n/EXECUTOR_ERROR_SM_MAIN_ARITH_ECREC"
+  "OVER_MISMATCH\0206\022.\n*EXECUTOR_ERROR_SM_MAI"
+  "N_BINARY_ADD_MISMATCH\0207\022.\n*EXECUTOR_ERRO"
+  "R_SM_MAIN_BINARY_SUB_MISMATCH\0208\022-\n)EXECU"
+  "TOR_ERROR_SM_MAIN_BINARY_LT_MISMATCH\0209\022."
+  "\n*EXECUTOR_ERROR_SM_MAIN_BINARY_SLT_MISM"
+  "ATCH\020:\022-\n)EXECUTOR_ERROR_SM_MAIN_BINARY_"
+  "EQ_MISMATCH\020;\022.\n*EXECUTOR_ERROR_SM_MAIN_"
+  "BINARY_AND_MISMATCH\020<\022-\n)EXECUTOR_ERROR_"
+  "SM_MAIN_BINARY_OR_MISMATCH\020=\022.\n*EXECUTOR"
+  "_ERROR_SM_MAIN_BINARY_XOR_MISMATCH\020>\0222\n."
+  "EXECUTOR_ERROR_SM_MAIN_MEMALIGN_WRITE_MI"
+  "SMATCH\020\?\0223\n/EXECUTOR_ERROR_SM_MAIN_MEMAL"
+  "IGN_WRITE8_MISMATCH\020@\0221\n-EXECUTOR_ERROR_"
+  "SM_MAIN_MEMALIGN_READ_MISMATCH\020A\022,\n(EXEC"
+  "UTOR_ERROR_SM_MAIN_JMPN_OUT_OF_RANGE\020B\0222"
+  "\n.EXECUTOR_ERROR_SM_MAIN_HASHK_READ_OUT_"
+  "OF_RANGE\020C\0222\n.EXECUTOR_ERROR_SM_MAIN_HAS"
+  "HP_READ_OUT_OF_RANGE\020D\022)\n%EXECUTOR_ERROR"
+  "_INVALID_OLD_STATE_ROOT\020E\022-\n)EXECUTOR_ER"
+  "ROR_INVALID_OLD_ACC_INPUT_HASH\020F\022#\n\037EXEC"
+  "UTOR_ERROR_INVALID_CHAIN_ID\020G\022(\n$EXECUTO"
+  "R_ERROR_INVALID_BATCH_L2_DATA\020H\022+\n\'EXECU"
+  "TOR_ERROR_INVALID_GLOBAL_EXIT_ROOT\020I\022#\n\037"
+  "EXECUTOR_ERROR_INVALID_COINBASE\020J\022\037\n\033EXE"
+  "CUTOR_ERROR_INVALID_FROM\020K\022!\n\035EXECUTOR_E"
+  "RROR_INVALID_DB_KEY\020L\022#\n\037EXECUTOR_ERROR_"
+  "INVALID_DB_VALUE\020M\0221\n-EXECUTOR_ERROR_INV"
+  "ALID_CONTRACTS_BYTECODE_KEY\020N\0223\n/EXECUTO"
+  "R_ERROR_INVALID_CONTRACTS_BYTECODE_VALUE"
+  "\020O\022\"\n\036EXECUTOR_ERROR_INVALID_GET_KEY\020P\0223"
+  "\n/EXECUTOR_ERROR_SM_MAIN_COUNTERS_OVERFL"
+  "OW_SHA256\020Q\022 \n\034EXECUTOR_ERROR_SM_MAIN_HA"
+  "SHS\020R\0222\n.EXECUTOR_ERROR_SM_MAIN_HASHS_SI"
+  "ZE_OUT_OF_RANGE\020S\0222\n.EXECUTOR_ERROR_SM_M"
+  "AIN_HASHS_POSITION_NEGATIVE\020T\022@\n<EXECUTO"
+  "R_ERROR_SM_MAIN_HASHS_POSITION_PLUS_SIZE"
+  "_OUT_OF_RANGE\020U\0228\n4EXECUTOR_ERROR_SM_MAI"
+  "N_HASHSDIGEST_ADDRESS_NOT_FOUND\020V\0224\n0EXE"
+  "CUTOR_ERROR_SM_MAIN_HASHSDIGEST_NOT_COMP"
+  "LETED\020W\022/\n+EXECUTOR_ERROR_SM_MAIN_HASHS_"
+  "VALUE_MISMATCH\020X\0221\n-EXECUTOR_ERROR_SM_MA"
+  "IN_HASHS_PADDING_MISMATCH\020Y\022.\n*EXECUTOR_"
+  "ERROR_SM_MAIN_HASHS_SIZE_MISMATCH\020Z\0223\n/E"
+  "XECUTOR_ERROR_SM_MAIN_HASHSLEN_LENGTH_MI"
+  "SMATCH\020[\0220\n,EXECUTOR_ERROR_SM_MAIN_HASHS"
+  "LEN_CALLED_TWICE\020\\\0220\n,EXECUTOR_ERROR_SM_"
+  "MAIN_HASHSDIGEST_NOT_FOUND\020]\0226\n2EXECUTOR"
+  "_ERROR_SM_MAIN_HASHSDIGEST_DIGEST_MISMAT"
+  "CH\020^\0223\n/EXECUTOR_ERROR_SM_MAIN_HASHSDIGE"
+  "ST_CALLED_TWICE\020_\0222\n.EXECUTOR_ERROR_SM_M"
+  "AIN_HASHS_READ_OUT_OF_RANGE\020`\022\'\n#EXECUTO"
+  "R_ERROR_INVALID_L1_INFO_ROOT\020a\022.\n*EXECUT"
+  "OR_ERROR_INVALID_FORCED_BLOCKHASH_L1\020b\0226"
+  "\n2EXECUTOR_ERROR_INVALID_L1_DATA_V2_GLOB"
+  "AL_EXIT_ROOT\020c\0223\n/EXECUTOR_ERROR_INVALID"
+  "_L1_DATA_V2_BLOCK_HASH_L1\020d\022\'\n#EXECUTOR_"
+  "ERROR_INVALID_L1_SMT_PROOF\020e\022\"\n\036EXECUTOR"
+  "_ERROR_INVALID_BALANCE\020f\022.\n*EXECUTOR_ERR"
+  "OR_SM_MAIN_BINARY_LT4_MISMATCH\020g\022)\n%EXEC"
+  "UTOR_ERROR_INVALID_NEW_STATE_ROOT\020h\022-\n)E"
+  "XECUTOR_ERROR_INVALID_NEW_ACC_INPUT_HASH"
+  "\020i\022.\n*EXECUTOR_ERROR_INVALID_NEW_LOCAL_E"
+  "XIT_ROOT\020j\022#\n\037EXECUTOR_ERROR_DB_KEY_NOT_"
+  "FOUND\020k\022(\n$EXECUTOR_ERROR_SMT_INVALID_DA"
+  "TA_SIZE\020l\022$\n EXECUTOR_ERROR_HASHDB_GRPC_"
+  "ERROR\020m\022 \n\034EXECUTOR_ERROR_STATE_MANAGER\020"
+  "n\022-\n)EXECUTOR_ERROR_INVALID_L1_INFO_TREE"
+  "_INDEX\020o\0227\n3EXECUTOR_ERROR_INVALID_L1_IN"
+  "FO_TREE_SMT_PROOF_VALUE\020p\022\"\n\036EXECUTOR_ER"
+  "ROR_INVALID_WITNESS\020q\022\037\n\033EXECUTOR_ERROR_"
+  "INVALID_CBOR\020r\022&\n\"EXECUTOR_ERROR_INVALID"
+  "_DATA_STREAM\020s\022-\n)EXECUTOR_ERROR_INVALID"
+  "_UPDATE_MERKLE_TREE\020t\0222\n.EXECUTOR_ERROR_"
+  "SM_MAIN_INVALID_TX_STATUS_ERROR\020u2\360\003\n\017Ex"
+  "ecutorService\022U\n\014ProcessBatch\022 .executor"
+  ".v1.ProcessBatchRequest\032!.executor.v1.Pr"
+  "ocessBatchResponse\"\000\022[\n\016ProcessBatchV2\022\""
+  ".executor.v1.ProcessBatchRequestV2\032#.exe"
+  "cutor.v1.ProcessBatchResponseV2\"\000\022i\n\024Pro"
+  "cessBatchV2Stream\022\".executor.v1.ProcessB"
+  "atchRequestV2\032).executor.v1.ProcessBatch"
+  "V2StreamResponse\"\0000\001\022m\n\027ProcessStateless"
+  "BatchV2\022+.executor.v1.ProcessStatelessBa"
+  "tchRequestV2\032#.executor.v1.ProcessBatchR"
+  "esponseV2\"\000\022O\n\016GetFlushStatus\022\026.google.p"
+  "rotobuf.Empty\032#.executor.v1.GetFlushStat"
+  "usResponse\"\000B>Z<github.com/0xPolygonHerm"
+  "ez/zkevm-node/state/runtime/executorb\006pr"
+  "oto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_executor_2eproto_deps[1] = {
   &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_executor_2eproto_sccs[44] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_executor_2eproto_sccs[45] = {
   &scc_info_Contract_executor_2eproto.base,
   &scc_info_ContractV2_executor_2eproto.base,
   &scc_info_DebugV2_executor_2eproto.base,
@@ -1996,6 +2036,7 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_exe
   &scc_info_ProcessBatchResponse_ReadWriteAddressesEntry_DoNotUse_executor_2eproto.base,
   &scc_info_ProcessBatchResponseV2_executor_2eproto.base,
   &scc_info_ProcessBatchResponseV2_ReadWriteAddressesEntry_DoNotUse_executor_2eproto.base,
+  &scc_info_ProcessBatchV2StreamResponse_executor_2eproto.base,
   &scc_info_ProcessBlockResponseV2_executor_2eproto.base,
   &scc_info_ProcessStatelessBatchRequestV2_executor_2eproto.base,
   &scc_info_ProcessTransactionResponse_executor_2eproto.base,
@@ -2012,10 +2053,10 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_exe
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_executor_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_executor_2eproto = {
-  false, false, descriptor_table_protodef_executor_2eproto, "executor.proto", 16566,
-  &descriptor_table_executor_2eproto_once, descriptor_table_executor_2eproto_sccs, descriptor_table_executor_2eproto_deps, 44, 1,
+  false, false, descriptor_table_protodef_executor_2eproto, "executor.proto", 16844,
+  &descriptor_table_executor_2eproto_once, descriptor_table_executor_2eproto_sccs, descriptor_table_executor_2eproto_deps, 45, 1,
   schemas, file_default_instances, TableStruct_executor_2eproto::offsets,
-  file_level_metadata_executor_2eproto, 44, file_level_enum_descriptors_executor_2eproto, file_level_service_descriptors_executor_2eproto,
+  file_level_metadata_executor_2eproto, 45, file_level_enum_descriptors_executor_2eproto, file_level_service_descriptors_executor_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -11499,6 +11540,327 @@ void ProcessBatchResponseV2::InternalSwap(ProcessBatchResponseV2* other) {
 }
 
 
+// ===================================================================
+
+void ProcessBatchV2StreamResponse::InitAsDefaultInstance() {
+  ::executor::v1::_ProcessBatchV2StreamResponse_default_instance_.block_response_ = const_cast< ::executor::v1::ProcessBlockResponseV2*>(
+      ::executor::v1::ProcessBlockResponseV2::internal_default_instance());
+  ::executor::v1::_ProcessBatchV2StreamResponse_default_instance_.batch_response_ = const_cast< ::executor::v1::ProcessBatchResponseV2*>(
+      ::executor::v1::ProcessBatchResponseV2::internal_default_instance());
+}
+class ProcessBatchV2StreamResponse::_Internal {
+ public:
+  static const ::executor::v1::ProcessBlockResponseV2& block_response(const ProcessBatchV2StreamResponse* msg);
+  static const ::executor::v1::ProcessBatchResponseV2& batch_response(const ProcessBatchV2StreamResponse* msg);
+};
+
+const ::executor::v1::ProcessBlockResponseV2&
+ProcessBatchV2StreamResponse::_Internal::block_response(const ProcessBatchV2StreamResponse* msg) {
+  return *msg->response_.block_response_;
+}
+const ::executor::v1::ProcessBatchResponseV2&
+ProcessBatchV2StreamResponse::_Internal::batch_response(const ProcessBatchV2StreamResponse* msg) {
+  return *msg->response_.batch_response_;
+}
+void ProcessBatchV2StreamResponse::set_allocated_block_response(::executor::v1::ProcessBlockResponseV2* block_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_response();
+  if (block_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(block_response);
+    if (message_arena != submessage_arena) {
+      block_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, block_response, submessage_arena);
+    }
+    set_has_block_response();
+    response_.block_response_ = block_response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:executor.v1.ProcessBatchV2StreamResponse.block_response)
+}
+void ProcessBatchV2StreamResponse::set_allocated_batch_response(::executor::v1::ProcessBatchResponseV2* batch_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  clear_response();
+  if (batch_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(batch_response);
+    if (message_arena != submessage_arena) {
+      batch_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batch_response, submessage_arena);
+    }
+    set_has_batch_response();
+    response_.batch_response_ = batch_response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:executor.v1.ProcessBatchV2StreamResponse.batch_response)
+}
+ProcessBatchV2StreamResponse::ProcessBatchV2StreamResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:executor.v1.ProcessBatchV2StreamResponse)
+}
+ProcessBatchV2StreamResponse::ProcessBatchV2StreamResponse(const ProcessBatchV2StreamResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_response();
+  switch (from.response_case()) {
+    case kBlockResponse: {
+      _internal_mutable_block_response()->::executor::v1::ProcessBlockResponseV2::MergeFrom(from._internal_block_response());
+      break;
+    }
+    case kBatchResponse: {
+      _internal_mutable_batch_response()->::executor::v1::ProcessBatchResponseV2::MergeFrom(from._internal_batch_response());
+      break;
+    }
+    case RESPONSE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:executor.v1.ProcessBatchV2StreamResponse)
+}
+
+void ProcessBatchV2StreamResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ProcessBatchV2StreamResponse_executor_2eproto.base);
+  clear_has_response();
+}
+
+ProcessBatchV2StreamResponse::~ProcessBatchV2StreamResponse() {
+  // @@protoc_insertion_point(destructor:executor.v1.ProcessBatchV2StreamResponse)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void ProcessBatchV2StreamResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (has_response()) {
+    clear_response();
+  }
+}
+
+void ProcessBatchV2StreamResponse::ArenaDtor(void* object) {
+  ProcessBatchV2StreamResponse* _this = reinterpret_cast< ProcessBatchV2StreamResponse* >(object);
+  (void)_this;
+}
+void ProcessBatchV2StreamResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ProcessBatchV2StreamResponse::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const ProcessBatchV2StreamResponse& ProcessBatchV2StreamResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ProcessBatchV2StreamResponse_executor_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void ProcessBatchV2StreamResponse::clear_response() {
+// @@protoc_insertion_point(one_of_clear_start:executor.v1.ProcessBatchV2StreamResponse)
+  switch (response_case()) {
+    case kBlockResponse: {
+      if (GetArena() == nullptr) {
+        delete response_.block_response_;
+      }
+      break;
+    }
+    case kBatchResponse: {
+      if (GetArena() == nullptr) {
+        delete response_.batch_response_;
+      }
+      break;
+    }
+    case RESPONSE_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = RESPONSE_NOT_SET;
+}
+
+
+void ProcessBatchV2StreamResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:executor.v1.ProcessBatchV2StreamResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_response();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProcessBatchV2StreamResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .executor.v1.ProcessBlockResponseV2 block_response = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_block_response(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .executor.v1.ProcessBatchResponseV2 batch_response = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batch_response(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ProcessBatchV2StreamResponse::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:executor.v1.ProcessBatchV2StreamResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .executor.v1.ProcessBlockResponseV2 block_response = 1;
+  if (_internal_has_block_response()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::block_response(this), target, stream);
+  }
+
+  // .executor.v1.ProcessBatchResponseV2 batch_response = 2;
+  if (_internal_has_batch_response()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::batch_response(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:executor.v1.ProcessBatchV2StreamResponse)
+  return target;
+}
+
+size_t ProcessBatchV2StreamResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:executor.v1.ProcessBatchV2StreamResponse)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (response_case()) {
+    // .executor.v1.ProcessBlockResponseV2 block_response = 1;
+    case kBlockResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *response_.block_response_);
+      break;
+    }
+    // .executor.v1.ProcessBatchResponseV2 batch_response = 2;
+    case kBatchResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *response_.batch_response_);
+      break;
+    }
+    case RESPONSE_NOT_SET: {
+      break;
+    }
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ProcessBatchV2StreamResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:executor.v1.ProcessBatchV2StreamResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const ProcessBatchV2StreamResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ProcessBatchV2StreamResponse>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:executor.v1.ProcessBatchV2StreamResponse)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:executor.v1.ProcessBatchV2StreamResponse)
+    MergeFrom(*source);
+  }
+}
+
+void ProcessBatchV2StreamResponse::MergeFrom(const ProcessBatchV2StreamResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:executor.v1.ProcessBatchV2StreamResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.response_case()) {
+    case kBlockResponse: {
+      _internal_mutable_block_response()->::executor::v1::ProcessBlockResponseV2::MergeFrom(from._internal_block_response());
+      break;
+    }
+    case kBatchResponse: {
+      _internal_mutable_batch_response()->::executor::v1::ProcessBatchResponseV2::MergeFrom(from._internal_batch_response());
+      break;
+    }
+    case RESPONSE_NOT_SET: {
+      break;
+    }
+  }
+}
+
+void ProcessBatchV2StreamResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:executor.v1.ProcessBatchV2StreamResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ProcessBatchV2StreamResponse::CopyFrom(const ProcessBatchV2StreamResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:executor.v1.ProcessBatchV2StreamResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProcessBatchV2StreamResponse::IsInitialized() const {
+  return true;
+}
+
+void ProcessBatchV2StreamResponse::InternalSwap(ProcessBatchV2StreamResponse* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(response_, other->response_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProcessBatchV2StreamResponse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
 // ===================================================================
 
 void ResponseDebug::InitAsDefaultInstance() {
@@ -16711,6 +17073,9 @@ template<> PROTOBUF_NOINLINE ::executor::v1::ProcessBatchResponseV2_ReadWriteAdd
 template<> PROTOBUF_NOINLINE ::executor::v1::ProcessBatchResponseV2* Arena::CreateMaybeMessage< ::executor::v1::ProcessBatchResponseV2 >(Arena* arena) {
   return Arena::CreateMessageInternal< ::executor::v1::ProcessBatchResponseV2 >(arena);
 }
+template<> PROTOBUF_NOINLINE ::executor::v1::ProcessBatchV2StreamResponse* Arena::CreateMaybeMessage< ::executor::v1::ProcessBatchV2StreamResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::executor::v1::ProcessBatchV2StreamResponse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::executor::v1::ResponseDebug* Arena::CreateMaybeMessage< ::executor::v1::ResponseDebug >(Arena* arena) {
   return Arena::CreateMessageInternal< ::executor::v1::ResponseDebug >(arena);
 }
@@ -52,7 +52,7 @@ struct TableStruct_executor_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[44]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[45]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -154,6 +154,9 @@ extern ProcessBatchResponseV2_ReadWriteAddressesEntry_DoNotUseDefaultTypeInterna
 class ProcessBatchResponse_ReadWriteAddressesEntry_DoNotUse;
 class ProcessBatchResponse_ReadWriteAddressesEntry_DoNotUseDefaultTypeInternal;
 extern ProcessBatchResponse_ReadWriteAddressesEntry_DoNotUseDefaultTypeInternal _ProcessBatchResponse_ReadWriteAddressesEntry_DoNotUse_default_instance_;
+class ProcessBatchV2StreamResponse;
+class ProcessBatchV2StreamResponseDefaultTypeInternal;
+extern ProcessBatchV2StreamResponseDefaultTypeInternal _ProcessBatchV2StreamResponse_default_instance_;
 class ProcessBlockResponseV2;
 class ProcessBlockResponseV2DefaultTypeInternal;
 extern ProcessBlockResponseV2DefaultTypeInternal _ProcessBlockResponseV2_default_instance_;
@@ -227,6 +230,7 @@ template<> ::executor::v1::ProcessBatchResponse* Arena::CreateMaybeMessage<::exe
 template<> ::executor::v1::ProcessBatchResponseV2* Arena::CreateMaybeMessage<::executor::v1::ProcessBatchResponseV2>(Arena*);
 template<> ::executor::v1::ProcessBatchResponseV2_ReadWriteAddressesEntry_DoNotUse* Arena::CreateMaybeMessage<::executor::v1::ProcessBatchResponseV2_ReadWriteAddressesEntry_DoNotUse>(Arena*);
 template<> ::executor::v1::ProcessBatchResponse_ReadWriteAddressesEntry_DoNotUse* Arena::CreateMaybeMessage<::executor::v1::ProcessBatchResponse_ReadWriteAddressesEntry_DoNotUse>(Arena*);
+template<> ::executor::v1::ProcessBatchV2StreamResponse* Arena::CreateMaybeMessage<::executor::v1::ProcessBatchV2StreamResponse>(Arena*);
 template<> ::executor::v1::ProcessBlockResponseV2* Arena::CreateMaybeMessage<::executor::v1::ProcessBlockResponseV2>(Arena*);
 template<> ::executor::v1::ProcessStatelessBatchRequestV2* Arena::CreateMaybeMessage<::executor::v1::ProcessStatelessBatchRequestV2>(Arena*);
 template<> ::executor::v1::ProcessTransactionResponse* Arena::CreateMaybeMessage<::executor::v1::ProcessTransactionResponse>(Arena*);
@@ -6534,6 +6538,190 @@ class ProcessBatchResponseV2 PROTOBUF_FINAL :
 };
 // -------------------------------------------------------------------
 
+class ProcessBatchV2StreamResponse PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:executor.v1.ProcessBatchV2StreamResponse) */ {
+ public:
+  inline ProcessBatchV2StreamResponse() : ProcessBatchV2StreamResponse(nullptr) {};
+  virtual ~ProcessBatchV2StreamResponse();
+
+  ProcessBatchV2StreamResponse(const ProcessBatchV2StreamResponse& from);
+  ProcessBatchV2StreamResponse(ProcessBatchV2StreamResponse&& from) noexcept
+    : ProcessBatchV2StreamResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ProcessBatchV2StreamResponse& operator=(const ProcessBatchV2StreamResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProcessBatchV2StreamResponse& operator=(ProcessBatchV2StreamResponse&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const ProcessBatchV2StreamResponse& default_instance();
+
+  enum ResponseCase {
+    kBlockResponse = 1,
+    kBatchResponse = 2,
+    RESPONSE_NOT_SET = 0,
+  };
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ProcessBatchV2StreamResponse* internal_default_instance() {
+    return reinterpret_cast<const ProcessBatchV2StreamResponse*>(
+               &_ProcessBatchV2StreamResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(ProcessBatchV2StreamResponse& a, ProcessBatchV2StreamResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProcessBatchV2StreamResponse* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProcessBatchV2StreamResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ProcessBatchV2StreamResponse* New() const final {
+    return CreateMaybeMessage<ProcessBatchV2StreamResponse>(nullptr);
+  }
+
+  ProcessBatchV2StreamResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ProcessBatchV2StreamResponse>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const ProcessBatchV2StreamResponse& from);
+  void MergeFrom(const ProcessBatchV2StreamResponse& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProcessBatchV2StreamResponse* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "executor.v1.ProcessBatchV2StreamResponse";
+  }
+  protected:
+  explicit ProcessBatchV2StreamResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_executor_2eproto);
+    return ::descriptor_table_executor_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBlockResponseFieldNumber = 1,
+    kBatchResponseFieldNumber = 2,
+  };
+  // .executor.v1.ProcessBlockResponseV2 block_response = 1;
+  bool has_block_response() const;
+  private:
+  bool _internal_has_block_response() const;
+  public:
+  void clear_block_response();
+  const ::executor::v1::ProcessBlockResponseV2& block_response() const;
+  ::executor::v1::ProcessBlockResponseV2* release_block_response();
+  ::executor::v1::ProcessBlockResponseV2* mutable_block_response();
+  void set_allocated_block_response(::executor::v1::ProcessBlockResponseV2* block_response);
+  private:
+  const ::executor::v1::ProcessBlockResponseV2& _internal_block_response() const;
+  ::executor::v1::ProcessBlockResponseV2* _internal_mutable_block_response();
+  public:
+  void unsafe_arena_set_allocated_block_response(
+      ::executor::v1::ProcessBlockResponseV2* block_response);
+  ::executor::v1::ProcessBlockResponseV2* unsafe_arena_release_block_response();
+
+  // .executor.v1.ProcessBatchResponseV2 batch_response = 2;
+  bool has_batch_response() const;
+  private:
+  bool _internal_has_batch_response() const;
+  public:
+  void clear_batch_response();
+  const ::executor::v1::ProcessBatchResponseV2& batch_response() const;
+  ::executor::v1::ProcessBatchResponseV2* release_batch_response();
+  ::executor::v1::ProcessBatchResponseV2* mutable_batch_response();
+  void set_allocated_batch_response(::executor::v1::ProcessBatchResponseV2* batch_response);
+  private:
+  const ::executor::v1::ProcessBatchResponseV2& _internal_batch_response() const;
+  ::executor::v1::ProcessBatchResponseV2* _internal_mutable_batch_response();
+  public:
+  void unsafe_arena_set_allocated_batch_response(
+      ::executor::v1::ProcessBatchResponseV2* batch_response);
+  ::executor::v1::ProcessBatchResponseV2* unsafe_arena_release_batch_response();
+
+  void clear_response();
+  ResponseCase response_case() const;
+  // @@protoc_insertion_point(class_scope:executor.v1.ProcessBatchV2StreamResponse)
+ private:
+  class _Internal;
+  void set_has_block_response();
+  void set_has_batch_response();
+
+  inline bool has_response() const;
+  inline void clear_has_response();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  union ResponseUnion {
+    ResponseUnion() {}
+    ::executor::v1::ProcessBlockResponseV2* block_response_;
+    ::executor::v1::ProcessBatchResponseV2* batch_response_;
+  } response_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+
+  friend struct ::TableStruct_executor_2eproto;
+};
+// -------------------------------------------------------------------
+
 class ResponseDebug PROTOBUF_FINAL :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:executor.v1.ResponseDebug) */ {
  public:
@@ -6576,7 +6764,7 @@ class ResponseDebug PROTOBUF_FINAL :
                &_ResponseDebug_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    29;
+    30;
 
   friend void swap(ResponseDebug& a, ResponseDebug& b) {
     a.Swap(&b);
@@ -6729,7 +6917,7 @@ class TraceConfigV2 PROTOBUF_FINAL :
                &_TraceConfigV2_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    30;
+    31;
 
   friend void swap(TraceConfigV2& a, TraceConfigV2& b) {
     a.Swap(&b);
@@ -6994,7 +7182,7 @@ class OverrideAccountV2 PROTOBUF_FINAL :
                &_OverrideAccountV2_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    33;
+    34;
 
   friend void swap(OverrideAccountV2& a, OverrideAccountV2& b) {
     a.Swap(&b);
@@ -7268,7 +7456,7 @@ class InfoReadWriteV2 PROTOBUF_FINAL :
                &_InfoReadWriteV2_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    35;
+    36;
 
   friend void swap(InfoReadWriteV2& a, InfoReadWriteV2& b) {
     a.Swap(&b);
@@ -7527,7 +7715,7 @@ class FullTraceV2 PROTOBUF_FINAL :
                &_FullTraceV2_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    36;
+    37;
 
   friend void swap(FullTraceV2& a, FullTraceV2& b) {
     a.Swap(&b);
@@ -7693,7 +7881,7 @@ class TransactionContextV2 PROTOBUF_FINAL :
                &_TransactionContextV2_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    37;
+    38;
 
   friend void swap(TransactionContextV2& a, TransactionContextV2& b) {
     a.Swap(&b);
@@ -8162,7 +8350,7 @@ class TransactionStepV2 PROTOBUF_FINAL :
                &_TransactionStepV2_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    39;
+    40;
 
   friend void swap(TransactionStepV2& a, TransactionStepV2& b) {
     a.Swap(&b);
@@ -8539,7 +8727,7 @@ class ContractV2 PROTOBUF_FINAL :
                &_ContractV2_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    40;
+    41;
 
   friend void swap(ContractV2& a, ContractV2& b) {
     a.Swap(&b);
@@ -8811,7 +8999,7 @@ class ProcessBlockResponseV2 PROTOBUF_FINAL :
                &_ProcessBlockResponseV2_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    41;
+    42;
 
   friend void swap(ProcessBlockResponseV2& a, ProcessBlockResponseV2& b) {
     a.Swap(&b);
@@ -9194,7 +9382,7 @@ class ProcessTransactionResponseV2 PROTOBUF_FINAL :
                &_ProcessTransactionResponseV2_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    42;
+    43;
 
   friend void swap(ProcessTransactionResponseV2& a, ProcessTransactionResponseV2& b) {
     a.Swap(&b);
@@ -9697,7 +9885,7 @@ class LogV2 PROTOBUF_FINAL :
                &_LogV2_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    43;
+    44;
 
   friend void swap(LogV2& a, LogV2& b) {
     a.Swap(&b);
@@ -19045,6 +19233,165 @@ inline void ProcessBatchResponseV2::set_allocated_debug(::executor::v1::Response
 
 // -------------------------------------------------------------------
 
+// ProcessBatchV2StreamResponse
+
+// .executor.v1.ProcessBlockResponseV2 block_response = 1;
+inline bool ProcessBatchV2StreamResponse::_internal_has_block_response() const {
+  return response_case() == kBlockResponse;
+}
+inline bool ProcessBatchV2StreamResponse::has_block_response() const {
+  return _internal_has_block_response();
+}
+inline void ProcessBatchV2StreamResponse::set_has_block_response() {
+  _oneof_case_[0] = kBlockResponse;
+}
+inline void ProcessBatchV2StreamResponse::clear_block_response() {
+  if (_internal_has_block_response()) {
+    if (GetArena() == nullptr) {
+      delete response_.block_response_;
+    }
+    clear_has_response();
+  }
+}
+inline ::executor::v1::ProcessBlockResponseV2* ProcessBatchV2StreamResponse::release_block_response() {
+  // @@protoc_insertion_point(field_release:executor.v1.ProcessBatchV2StreamResponse.block_response)
+  if (_internal_has_block_response()) {
+    clear_has_response();
+      ::executor::v1::ProcessBlockResponseV2* temp = response_.block_response_;
+    if (GetArena() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    response_.block_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::executor::v1::ProcessBlockResponseV2& ProcessBatchV2StreamResponse::_internal_block_response() const {
+  return _internal_has_block_response()
+      ? *response_.block_response_
+      : *reinterpret_cast< ::executor::v1::ProcessBlockResponseV2*>(&::executor::v1::_ProcessBlockResponseV2_default_instance_);
+}
+inline const ::executor::v1::ProcessBlockResponseV2& ProcessBatchV2StreamResponse::block_response() const {
+  // @@protoc_insertion_point(field_get:executor.v1.ProcessBatchV2StreamResponse.block_response)
+  return _internal_block_response();
+}
+inline ::executor::v1::ProcessBlockResponseV2* ProcessBatchV2StreamResponse::unsafe_arena_release_block_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:executor.v1.ProcessBatchV2StreamResponse.block_response)
+  if (_internal_has_block_response()) {
+    clear_has_response();
+    ::executor::v1::ProcessBlockResponseV2* temp = response_.block_response_;
+    response_.block_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ProcessBatchV2StreamResponse::unsafe_arena_set_allocated_block_response(::executor::v1::ProcessBlockResponseV2* block_response) {
+  clear_response();
+  if (block_response) {
+    set_has_block_response();
+    response_.block_response_ = block_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:executor.v1.ProcessBatchV2StreamResponse.block_response)
+}
+inline ::executor::v1::ProcessBlockResponseV2* ProcessBatchV2StreamResponse::_internal_mutable_block_response() {
+  if (!_internal_has_block_response()) {
+    clear_response();
+    set_has_block_response();
+    response_.block_response_ = CreateMaybeMessage< ::executor::v1::ProcessBlockResponseV2 >(GetArena());
+  }
+  return response_.block_response_;
+}
+inline ::executor::v1::ProcessBlockResponseV2* ProcessBatchV2StreamResponse::mutable_block_response() {
+  // @@protoc_insertion_point(field_mutable:executor.v1.ProcessBatchV2StreamResponse.block_response)
+  return _internal_mutable_block_response();
+}
+
+// .executor.v1.ProcessBatchResponseV2 batch_response = 2;
+inline bool ProcessBatchV2StreamResponse::_internal_has_batch_response() const {
+  return response_case() == kBatchResponse;
+}
+inline bool ProcessBatchV2StreamResponse::has_batch_response() const {
+  return _internal_has_batch_response();
+}
+inline void ProcessBatchV2StreamResponse::set_has_batch_response() {
+  _oneof_case_[0] = kBatchResponse;
+}
+inline void ProcessBatchV2StreamResponse::clear_batch_response() {
+  if (_internal_has_batch_response()) {
+    if (GetArena() == nullptr) {
+      delete response_.batch_response_;
+    }
+    clear_has_response();
+  }
+}
+inline ::executor::v1::ProcessBatchResponseV2* ProcessBatchV2StreamResponse::release_batch_response() {
+  // @@protoc_insertion_point(field_release:executor.v1.ProcessBatchV2StreamResponse.batch_response)
+  if (_internal_has_batch_response()) {
+    clear_has_response();
+      ::executor::v1::ProcessBatchResponseV2* temp = response_.batch_response_;
+    if (GetArena() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    response_.batch_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::executor::v1::ProcessBatchResponseV2& ProcessBatchV2StreamResponse::_internal_batch_response() const {
+  return _internal_has_batch_response()
+      ? *response_.batch_response_
+      : *reinterpret_cast< ::executor::v1::ProcessBatchResponseV2*>(&::executor::v1::_ProcessBatchResponseV2_default_instance_);
+}
+inline const ::executor::v1::ProcessBatchResponseV2& ProcessBatchV2StreamResponse::batch_response() const {
+  // @@protoc_insertion_point(field_get:executor.v1.ProcessBatchV2StreamResponse.batch_response)
+  return _internal_batch_response();
+}
+inline ::executor::v1::ProcessBatchResponseV2* ProcessBatchV2StreamResponse::unsafe_arena_release_batch_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:executor.v1.ProcessBatchV2StreamResponse.batch_response)
+  if (_internal_has_batch_response()) {
+    clear_has_response();
+    ::executor::v1::ProcessBatchResponseV2* temp = response_.batch_response_;
+    response_.batch_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ProcessBatchV2StreamResponse::unsafe_arena_set_allocated_batch_response(::executor::v1::ProcessBatchResponseV2* batch_response) {
+  clear_response();
+  if (batch_response) {
+    set_has_batch_response();
+    response_.batch_response_ = batch_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:executor.v1.ProcessBatchV2StreamResponse.batch_response)
+}
+inline ::executor::v1::ProcessBatchResponseV2* ProcessBatchV2StreamResponse::_internal_mutable_batch_response() {
+  if (!_internal_has_batch_response()) {
+    clear_response();
+    set_has_batch_response();
+    response_.batch_response_ = CreateMaybeMessage< ::executor::v1::ProcessBatchResponseV2 >(GetArena());
+  }
+  return response_.batch_response_;
+}
+inline ::executor::v1::ProcessBatchResponseV2* ProcessBatchV2StreamResponse::mutable_batch_response() {
+  // @@protoc_insertion_point(field_mutable:executor.v1.ProcessBatchV2StreamResponse.batch_response)
+  return _internal_mutable_batch_response();
+}
+
+inline bool ProcessBatchV2StreamResponse::has_response() const {
+  return response_case() != RESPONSE_NOT_SET;
+}
+inline void ProcessBatchV2StreamResponse::clear_has_response() {
+  _oneof_case_[0] = RESPONSE_NOT_SET;
+}
+inline ProcessBatchV2StreamResponse::ResponseCase ProcessBatchV2StreamResponse::response_case() const {
+  return ProcessBatchV2StreamResponse::ResponseCase(_oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
 // ResponseDebug
 
 // string error_log = 1;
@@ -26,6 +26,8 @@ static const char* HashDBService_method_names[] = {
   "/hashdb.v1.HashDBService/GetLatestStateRoot",
   "/hashdb.v1.HashDBService/Set",
   "/hashdb.v1.HashDBService/Get",
+  "/hashdb.v1.HashDBService/SetBatch",
+  "/hashdb.v1.HashDBService/GetBatch",
   "/hashdb.v1.HashDBService/SetProgram",
   "/hashdb.v1.HashDBService/GetProgram",
   "/hashdb.v1.HashDBService/LoadDB",
@@ -53,21 +55,23 @@ HashDBService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   : channel_(channel), rpcmethod_GetLatestStateRoot_(HashDBService_method_names[0], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_Set_(HashDBService_method_names[1], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_Get_(HashDBService_method_names[2], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SetProgram_(HashDBService_method_names[3], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetProgram_(HashDBService_method_names[4], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_LoadDB_(HashDBService_method_names[5], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_LoadProgramDB_(HashDBService_method_names[6], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_FinishTx_(HashDBService_method_names[7], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_StartBlock_(HashDBService_method_names[8], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_FinishBlock_(HashDBService_method_names[9], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_Flush_(HashDBService_method_names[10], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetFlushStatus_(HashDBService_method_names[11], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetFlushData_(HashDBService_method_names[12], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ConsolidateState_(HashDBService_method_names[13], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_Purge_(HashDBService_method_names[14], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ReadTree_(HashDBService_method_names[15], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_CancelBatch_(HashDBService_method_names[16], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ResetDB_(HashDBService_method_names[17], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetBatch_(HashDBService_method_names[3], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetBatch_(HashDBService_method_names[4], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetProgram_(HashDBService_method_names[5], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetProgram_(HashDBService_method_names[6], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_LoadDB_(HashDBService_method_names[7], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_LoadProgramDB_(HashDBService_method_names[8], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_FinishTx_(HashDBService_method_names[9], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_StartBlock_(HashDBService_method_names[10], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_FinishBlock_(HashDBService_method_names[11], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Flush_(HashDBService_method_names[12], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetFlushStatus_(HashDBService_method_names[13], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetFlushData_(HashDBService_method_names[14], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ConsolidateState_(HashDBService_method_names[15], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Purge_(HashDBService_method_names[16], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ReadTree_(HashDBService_method_names[17], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_CancelBatch_(HashDBService_method_names[18], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ResetDB_(HashDBService_method_names[19], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status HashDBService::Stub::GetLatestStateRoot(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::hashdb::v1::GetLatestStateRootResponse* response) {
@@ -154,6 +158,62 @@ void HashDBService::Stub::experimental_async::Get(::grpc::ClientContext* context
   return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::hashdb::v1::GetResponse>::Create(channel_.get(), cq, rpcmethod_Get_, context, request, false);
 }
 
+::grpc::Status HashDBService::Stub::SetBatch(::grpc::ClientContext* context, const ::hashdb::v1::SetBatchRequest& request, ::hashdb::v1::SetBatchResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_SetBatch_, context, request, response);
+}
+
+void HashDBService::Stub::experimental_async::SetBatch(::grpc::ClientContext* context, const ::hashdb::v1::SetBatchRequest* request, ::hashdb::v1::SetBatchResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SetBatch_, context, request, response, std::move(f));
+}
+
+void HashDBService::Stub::experimental_async::SetBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::SetBatchResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SetBatch_, context, request, response, std::move(f));
+}
+
+void HashDBService::Stub::experimental_async::SetBatch(::grpc::ClientContext* context, const ::hashdb::v1::SetBatchRequest* request, ::hashdb::v1::SetBatchResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_SetBatch_, context, request, response, reactor);
+}
+
+void HashDBService::Stub::experimental_async::SetBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::SetBatchResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_SetBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::hashdb::v1::SetBatchResponse>* HashDBService::Stub::AsyncSetBatchRaw(::grpc::ClientContext* context, const ::hashdb::v1::SetBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::hashdb::v1::SetBatchResponse>::Create(channel_.get(), cq, rpcmethod_SetBatch_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::hashdb::v1::SetBatchResponse>* HashDBService::Stub::PrepareAsyncSetBatchRaw(::grpc::ClientContext* context, const ::hashdb::v1::SetBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::hashdb::v1::SetBatchResponse>::Create(channel_.get(), cq, rpcmethod_SetBatch_, context, request, false);
+}
+
+::grpc::Status HashDBService::Stub::GetBatch(::grpc::ClientContext* context, const ::hashdb::v1::GetBatchRequest& request, ::hashdb::v1::GetBatchResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetBatch_, context, request, response);
+}
+
+void HashDBService::Stub::experimental_async::GetBatch(::grpc::ClientContext* context, const ::hashdb::v1::GetBatchRequest* request, ::hashdb::v1::GetBatchResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetBatch_, context, request, response, std::move(f));
+}
+
+void HashDBService::Stub::experimental_async::GetBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::GetBatchResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetBatch_, context, request, response, std::move(f));
+}
+
+void HashDBService::Stub::experimental_async::GetBatch(::grpc::ClientContext* context, const ::hashdb::v1::GetBatchRequest* request, ::hashdb::v1::GetBatchResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_GetBatch_, context, request, response, reactor);
+}
+
+void HashDBService::Stub::experimental_async::GetBatch(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::GetBatchResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_GetBatch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::hashdb::v1::GetBatchResponse>* HashDBService::Stub::AsyncGetBatchRaw(::grpc::ClientContext* context, const ::hashdb::v1::GetBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::hashdb::v1::GetBatchResponse>::Create(channel_.get(), cq, rpcmethod_GetBatch_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::hashdb::v1::GetBatchResponse>* HashDBService::Stub::PrepareAsyncGetBatchRaw(::grpc::ClientContext* context, const ::hashdb::v1::GetBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::hashdb::v1::GetBatchResponse>::Create(channel_.get(), cq, rpcmethod_GetBatch_, context, request, false);
+}
+
 ::grpc::Status HashDBService::Stub::SetProgram(::grpc::ClientContext* context, const ::hashdb::v1::SetProgramRequest& request, ::hashdb::v1::SetProgramResponse* response) {
   return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_SetProgram_, context, request, response);
 }
@@ -608,6 +668,26 @@ HashDBService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       HashDBService_method_names[3],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::SetBatchRequest, ::hashdb::v1::SetBatchResponse>(
+          [](HashDBService::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             const ::hashdb::v1::SetBatchRequest* req,
+             ::hashdb::v1::SetBatchResponse* resp) {
+               return service->SetBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      HashDBService_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::GetBatchRequest, ::hashdb::v1::GetBatchResponse>(
+          [](HashDBService::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             const ::hashdb::v1::GetBatchRequest* req,
+             ::hashdb::v1::GetBatchResponse* resp) {
+               return service->GetBatch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      HashDBService_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::SetProgramRequest, ::hashdb::v1::SetProgramResponse>(
           [](HashDBService::Service* service,
              ::grpc_impl::ServerContext* ctx,
@@ -616,7 +696,7 @@ HashDBService::Service::Service() {
                return service->SetProgram(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[4],
+      HashDBService_method_names[6],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::GetProgramRequest, ::hashdb::v1::GetProgramResponse>(
           [](HashDBService::Service* service,
@@ -626,7 +706,7 @@ HashDBService::Service::Service() {
                return service->GetProgram(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[5],
+      HashDBService_method_names[7],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::LoadDBRequest, ::google::protobuf::Empty>(
           [](HashDBService::Service* service,
@@ -636,7 +716,7 @@ HashDBService::Service::Service() {
                return service->LoadDB(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[6],
+      HashDBService_method_names[8],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::LoadProgramDBRequest, ::google::protobuf::Empty>(
           [](HashDBService::Service* service,
@@ -646,7 +726,7 @@ HashDBService::Service::Service() {
                return service->LoadProgramDB(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[7],
+      HashDBService_method_names[9],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::FinishTxRequest, ::google::protobuf::Empty>(
           [](HashDBService::Service* service,
@@ -656,7 +736,7 @@ HashDBService::Service::Service() {
                return service->FinishTx(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[8],
+      HashDBService_method_names[10],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::StartBlockRequest, ::google::protobuf::Empty>(
           [](HashDBService::Service* service,
@@ -666,7 +746,7 @@ HashDBService::Service::Service() {
                return service->StartBlock(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[9],
+      HashDBService_method_names[11],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::FinishBlockRequest, ::google::protobuf::Empty>(
           [](HashDBService::Service* service,
@@ -676,7 +756,7 @@ HashDBService::Service::Service() {
                return service->FinishBlock(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[10],
+      HashDBService_method_names[12],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::FlushRequest, ::hashdb::v1::FlushResponse>(
           [](HashDBService::Service* service,
@@ -686,7 +766,7 @@ HashDBService::Service::Service() {
                return service->Flush(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[11],
+      HashDBService_method_names[13],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::google::protobuf::Empty, ::hashdb::v1::GetFlushStatusResponse>(
           [](HashDBService::Service* service,
@@ -696,7 +776,7 @@ HashDBService::Service::Service() {
                return service->GetFlushStatus(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[12],
+      HashDBService_method_names[14],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::GetFlushDataRequest, ::hashdb::v1::GetFlushDataResponse>(
           [](HashDBService::Service* service,
@@ -706,7 +786,7 @@ HashDBService::Service::Service() {
                return service->GetFlushData(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[13],
+      HashDBService_method_names[15],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::ConsolidateStateRequest, ::hashdb::v1::ConsolidateStateResponse>(
           [](HashDBService::Service* service,
@@ -716,7 +796,7 @@ HashDBService::Service::Service() {
                return service->ConsolidateState(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[14],
+      HashDBService_method_names[16],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::PurgeRequest, ::hashdb::v1::PurgeResponse>(
           [](HashDBService::Service* service,
@@ -726,7 +806,7 @@ HashDBService::Service::Service() {
                return service->Purge(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[15],
+      HashDBService_method_names[17],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::ReadTreeRequest, ::hashdb::v1::ReadTreeResponse>(
           [](HashDBService::Service* service,
@@ -736,7 +816,7 @@ HashDBService::Service::Service() {
                return service->ReadTree(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[16],
+      HashDBService_method_names[18],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::CancelBatchRequest, ::hashdb::v1::CancelBatchResponse>(
           [](HashDBService::Service* service,
@@ -746,7 +826,7 @@ HashDBService::Service::Service() {
                return service->CancelBatch(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      HashDBService_method_names[17],
+      HashDBService_method_names[19],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::google::protobuf::Empty, ::hashdb::v1::ResetDBResponse>(
           [](HashDBService::Service* service,
@@ -781,6 +861,20 @@ HashDBService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status HashDBService::Service::SetBatch(::grpc::ServerContext* context, const ::hashdb::v1::SetBatchRequest* request, ::hashdb::v1::SetBatchResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status HashDBService::Service::GetBatch(::grpc::ServerContext* context, const ::hashdb::v1::GetBatchRequest* request, ::hashdb::v1::GetBatchResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status HashDBService::Service::SetProgram(::grpc::ServerContext* context, const ::hashdb::v1::SetProgramRequest* request, ::hashdb::v1::SetProgramResponse* response) {
   (void) context;
   (void) request;
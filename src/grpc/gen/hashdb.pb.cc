@@ -19,6 +19,8 @@ extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Fea12_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetFlushDataResponse_NodesEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetFlushDataResponse_ProgramEntry_DoNotUse_hashdb_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetRequest_hashdb_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<4> scc_info_GetResponse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetResponse_SiblingsEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_HashValueGL_hashdb_2eproto;
@@ -26,6 +28,8 @@ extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_LoadDBRequest_InputDbEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_LoadProgramDBRequest_InputProgramDbEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ResultCode_hashdb_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_SetRequest_hashdb_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<4> scc_info_SetResponse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_SetResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_SetResponse_SiblingsEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SiblingList_hashdb_2eproto;
@@ -43,6 +47,14 @@ class GetRequestDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetRequest> _instance;
 } _GetRequest_default_instance_;
+class SetBatchRequestDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SetBatchRequest> _instance;
+} _SetBatchRequest_default_instance_;
+class GetBatchRequestDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetBatchRequest> _instance;
+} _GetBatchRequest_default_instance_;
 class SetProgramRequestDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SetProgramRequest> _instance;
@@ -131,6 +143,14 @@ class GetResponseDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetResponse> _instance;
 } _GetResponse_default_instance_;
+class SetBatchResponseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SetBatchResponse> _instance;
+} _SetBatchResponse_default_instance_;
+class GetBatchResponseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetBatchResponse> _instance;
+} _GetBatchResponse_default_instance_;
 class SetProgramResponseDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SetProgramResponse> _instance;
@@ -368,6 +388,37 @@ static void InitDefaultsscc_info_FlushResponse_hashdb_2eproto() {
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_FlushResponse_hashdb_2eproto}, {
       &scc_info_ResultCode_hashdb_2eproto.base,}};
 
+static void InitDefaultsscc_info_GetBatchRequest_hashdb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::hashdb::v1::_GetBatchRequest_default_instance_;
+    new (ptr) ::hashdb::v1::GetBatchRequest();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::hashdb::v1::GetBatchRequest::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetBatchRequest_hashdb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GetBatchRequest_hashdb_2eproto}, {
+      &scc_info_GetRequest_hashdb_2eproto.base,}};
+
+static void InitDefaultsscc_info_GetBatchResponse_hashdb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::hashdb::v1::_GetBatchResponse_default_instance_;
+    new (ptr) ::hashdb::v1::GetBatchResponse();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::hashdb::v1::GetBatchResponse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_GetBatchResponse_hashdb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_GetBatchResponse_hashdb_2eproto}, {
+      &scc_info_GetResponse_hashdb_2eproto.base,
+      &scc_info_ResultCode_hashdb_2eproto.base,}};
+
 static void InitDefaultsscc_info_GetFlushDataRequest_hashdb_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -726,6 +777,37 @@ static void InitDefaultsscc_info_ResultCode_hashdb_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ResultCode_hashdb_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_ResultCode_hashdb_2eproto}, {}};
 
+static void InitDefaultsscc_info_SetBatchRequest_hashdb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::hashdb::v1::_SetBatchRequest_default_instance_;
+    new (ptr) ::hashdb::v1::SetBatchRequest();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::hashdb::v1::SetBatchRequest::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_SetBatchRequest_hashdb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_SetBatchRequest_hashdb_2eproto}, {
+      &scc_info_SetRequest_hashdb_2eproto.base,}};
+
+static void InitDefaultsscc_info_SetBatchResponse_hashdb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::hashdb::v1::_SetBatchResponse_default_instance_;
+    new (ptr) ::hashdb::v1::SetBatchResponse();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::hashdb::v1::SetBatchResponse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_SetBatchResponse_hashdb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_SetBatchResponse_hashdb_2eproto}, {
+      &scc_info_SetResponse_hashdb_2eproto.base,
+      &scc_info_ResultCode_hashdb_2eproto.base,}};
+
 static void InitDefaultsscc_info_SetProgramRequest_hashdb_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -859,7 +941,7 @@ static void InitDefaultsscc_info_Version_hashdb_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Version_hashdb_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Version_hashdb_2eproto}, {}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_hashdb_2eproto[44];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_hashdb_2eproto[48];
 static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_hashdb_2eproto[2];
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_hashdb_2eproto = nullptr;
 
@@ -895,6 +977,19 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_hashdb_2eproto::offsets[] PROT
   PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetRequest, get_db_read_log_),
   PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetRequest, batch_uuid_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetBatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetBatchRequest, requests_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetBatchRequest, chain_roots_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetBatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetBatchRequest, requests_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetProgramRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -1090,6 +1185,20 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_hashdb_2eproto::offsets[] PROT
   PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetResponse, db_read_log_),
   PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetResponse, result_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetBatchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetBatchResponse, responses_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetBatchResponse, result_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetBatchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetBatchResponse, responses_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetBatchResponse, result_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetProgramResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -1249,53 +1358,59 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 0, -1, sizeof(::hashdb::v1::Version)},
   { 6, -1, sizeof(::hashdb::v1::SetRequest)},
   { 20, -1, sizeof(::hashdb::v1::GetRequest)},
-  { 30, -1, sizeof(::hashdb::v1::SetProgramRequest)},
-  { 41, -1, sizeof(::hashdb::v1::GetProgramRequest)},
-  { 48, 55, sizeof(::hashdb::v1::LoadDBRequest_InputDbEntry_DoNotUse)},
-  { 57, -1, sizeof(::hashdb::v1::LoadDBRequest)},
-  { 65, 72, sizeof(::hashdb::v1::LoadProgramDBRequest_InputProgramDbEntry_DoNotUse)},
-  { 74, -1, sizeof(::hashdb::v1::LoadProgramDBRequest)},
-  { 81, -1, sizeof(::hashdb::v1::FlushRequest)},
-  { 89, -1, sizeof(::hashdb::v1::FinishTxRequest)},
-  { 97, -1, sizeof(::hashdb::v1::StartBlockRequest)},
-  { 105, -1, sizeof(::hashdb::v1::FinishBlockRequest)},
-  { 113, -1, sizeof(::hashdb::v1::GetFlushDataRequest)},
-  { 119, -1, sizeof(::hashdb::v1::ConsolidateStateRequest)},
-  { 126, -1, sizeof(::hashdb::v1::PurgeRequest)},
-  { 134, -1, sizeof(::hashdb::v1::ReadTreeRequest)},
-  { 141, -1, sizeof(::hashdb::v1::CancelBatchRequest)},
-  { 147, -1, sizeof(::hashdb::v1::GetLatestStateRootResponse)},
-  { 154, 161, sizeof(::hashdb::v1::SetResponse_SiblingsEntry_DoNotUse)},
-  { 163, 170, sizeof(::hashdb::v1::SetResponse_DbReadLogEntry_DoNotUse)},
-  { 172, -1, sizeof(::hashdb::v1::SetResponse)},
-  { 192, 199, sizeof(::hashdb::v1::GetResponse_SiblingsEntry_DoNotUse)},
-  { 201, 208, sizeof(::hashdb::v1::GetResponse_DbReadLogEntry_DoNotUse)},
-  { 210, -1, sizeof(::hashdb::v1::GetResponse)},
-  { 225, -1, sizeof(::hashdb::v1::SetProgramResponse)},
-  { 231, -1, sizeof(::hashdb::v1::GetProgramResponse)},
-  { 238, -1, sizeof(::hashdb::v1::FlushResponse)},
-  { 246, -1, sizeof(::hashdb::v1::GetFlushStatusResponse)},
-  { 259, 266, sizeof(::hashdb::v1::GetFlushDataResponse_NodesEntry_DoNotUse)},
-  { 268, 275, sizeof(::hashdb::v1::GetFlushDataResponse_ProgramEntry_DoNotUse)},
-  { 277, -1, sizeof(::hashdb::v1::GetFlushDataResponse)},
-  { 287, -1, sizeof(::hashdb::v1::ConsolidateStateResponse)},
-  { 296, -1, sizeof(::hashdb::v1::PurgeResponse)},
-  { 302, -1, sizeof(::hashdb::v1::ReadTreeResponse)},
-  { 310, -1, sizeof(::hashdb::v1::CancelBatchResponse)},
-  { 316, -1, sizeof(::hashdb::v1::ResetDBResponse)},
-  { 322, -1, sizeof(::hashdb::v1::Fea)},
-  { 331, -1, sizeof(::hashdb::v1::Fea12)},
-  { 348, -1, sizeof(::hashdb::v1::HashValueGL)},
-  { 355, -1, sizeof(::hashdb::v1::KeyValue)},
-  { 362, -1, sizeof(::hashdb::v1::FeList)},
-  { 368, -1, sizeof(::hashdb::v1::SiblingList)},
-  { 374, -1, sizeof(::hashdb::v1::ResultCode)},
+  { 30, -1, sizeof(::hashdb::v1::SetBatchRequest)},
+  { 37, -1, sizeof(::hashdb::v1::GetBatchRequest)},
+  { 43, -1, sizeof(::hashdb::v1::SetProgramRequest)},
+  { 54, -1, sizeof(::hashdb::v1::GetProgramRequest)},
+  { 61, 68, sizeof(::hashdb::v1::LoadDBRequest_InputDbEntry_DoNotUse)},
+  { 70, -1, sizeof(::hashdb::v1::LoadDBRequest)},
+  { 78, 85, sizeof(::hashdb::v1::LoadProgramDBRequest_InputProgramDbEntry_DoNotUse)},
+  { 87, -1, sizeof(::hashdb::v1::LoadProgramDBRequest)},
+  { 94, -1, sizeof(::hashdb::v1::FlushRequest)},
+  { 102, -1, sizeof(::hashdb::v1::FinishTxRequest)},
+  { 110, -1, sizeof(::hashdb::v1::StartBlockRequest)},
+  { 118, -1, sizeof(::hashdb::v1::FinishBlockRequest)},
+  { 126, -1, sizeof(::hashdb::v1::GetFlushDataRequest)},
+  { 132, -1, sizeof(::hashdb::v1::ConsolidateStateRequest)},
+  { 139, -1, sizeof(::hashdb::v1::PurgeRequest)},
+  { 147, -1, sizeof(::hashdb::v1::ReadTreeRequest)},
+  { 154, -1, sizeof(::hashdb::v1::CancelBatchRequest)},
+  { 160, -1, sizeof(::hashdb::v1::GetLatestStateRootResponse)},
+  { 167, 174, sizeof(::hashdb::v1::SetResponse_SiblingsEntry_DoNotUse)},
+  { 176, 183, sizeof(::hashdb::v1::SetResponse_DbReadLogEntry_DoNotUse)},
+  { 185, -1, sizeof(::hashdb::v1::SetResponse)},
+  { 205, 212, sizeof(::hashdb::v1::GetResponse_SiblingsEntry_DoNotUse)},
+  { 214, 221, sizeof(::hashdb::v1::GetResponse_DbReadLogEntry_DoNotUse)},
+  { 223, -1, sizeof(::hashdb::v1::GetResponse)},
+  { 238, -1, sizeof(::hashdb::v1::SetBatchResponse)},
+  { 245, -1, sizeof(::hashdb::v1::GetBatchResponse)},
+  { 252, -1, sizeof(::hashdb::v1::SetProgramResponse)},
+  { 258, -1, sizeof(::hashdb::v1::GetProgramResponse)},
+  { 265, -1, sizeof(::hashdb::v1::FlushResponse)},
+  { 273, -1, sizeof(::hashdb::v1::GetFlushStatusResponse)},
+  { 286, 293, sizeof(::hashdb::v1::GetFlushDataResponse_NodesEntry_DoNotUse)},
+  { 295, 302, sizeof(::hashdb::v1::GetFlushDataResponse_ProgramEntry_DoNotUse)},
+  { 304, -1, sizeof(::hashdb::v1::GetFlushDataResponse)},
+  { 314, -1, sizeof(::hashdb::v1::ConsolidateStateResponse)},
+  { 323, -1, sizeof(::hashdb::v1::PurgeResponse)},
+  { 329, -1, sizeof(::hashdb::v1::ReadTreeResponse)},
+  { 337, -1, sizeof(::hashdb::v1::CancelBatchResponse)},
+  { 343, -1, sizeof(::hashdb::v1::ResetDBResponse)},
+  { 349, -1, sizeof(::hashdb::v1::Fea)},
+  { 358, -1, sizeof(::hashdb::v1::Fea12)},
+  { 375, -1, sizeof(::hashdb::v1::HashValueGL)},
+  { 382, -1, sizeof(::hashdb::v1::KeyValue)},
+  { 389, -1, sizeof(::hashdb::v1::FeList)},
+  { 395, -1, sizeof(::hashdb::v1::SiblingList)},
+  { 401, -1, sizeof(::hashdb::v1::ResultCode)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_Version_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_SetRequest_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_GetRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_SetBatchRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_GetBatchRequest_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_SetProgramRequest_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_GetProgramRequest_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_LoadDBRequest_InputDbEntry_DoNotUse_default_instance_),
@@ -1318,6 +1433,8 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_GetResponse_SiblingsEntry_DoNotUse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_GetResponse_DbReadLogEntry_DoNotUse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_GetResponse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_SetBatchResponse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_GetBatchResponse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_SetProgramResponse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_GetProgramResponse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_FlushResponse_default_instance_),
@@ -1351,164 +1468,176 @@ const char descriptor_table_protodef_hashdb_2eproto[] PROTOBUF_SECTION_VARIABLE(
   "\"\205\001\n\nGetRequest\022\034\n\004root\030\001 \001(\0132\016.hashdb.v"
   "1.Fea\022\033\n\003key\030\002 \001(\0132\016.hashdb.v1.Fea\022\017\n\007de"
   "tails\030\003 \001(\010\022\027\n\017get_db_read_log\030\004 \001(\010\022\022\n\n"
-  "batch_uuid\030\005 \001(\t\"\246\001\n\021SetProgramRequest\022\033"
-  "\n\003key\030\001 \001(\0132\016.hashdb.v1.Fea\022\014\n\004data\030\002 \001("
-  "\014\022+\n\013persistence\030\003 \001(\0162\026.hashdb.v1.Persi"
-  "stence\022\022\n\nbatch_uuid\030\004 \001(\t\022\020\n\010tx_index\030\005"
-  " \001(\004\022\023\n\013block_index\030\006 \001(\004\"D\n\021GetProgramR"
-  "equest\022\033\n\003key\030\001 \001(\0132\016.hashdb.v1.Fea\022\022\n\nb"
-  "atch_uuid\030\002 \001(\t\"\303\001\n\rLoadDBRequest\0227\n\010inp"
-  "ut_db\030\001 \003(\0132%.hashdb.v1.LoadDBRequest.In"
-  "putDbEntry\022\022\n\npersistent\030\002 \001(\010\022\"\n\nstate_"
-  "root\030\003 \001(\0132\016.hashdb.v1.Fea\032A\n\014InputDbEnt"
-  "ry\022\013\n\003key\030\001 \001(\t\022 \n\005value\030\002 \001(\0132\021.hashdb."
-  "v1.FeList:\0028\001\"\260\001\n\024LoadProgramDBRequest\022M"
-  "\n\020input_program_db\030\001 \003(\01323.hashdb.v1.Loa"
-  "dProgramDBRequest.InputProgramDbEntry\022\022\n"
-  "\npersistent\030\002 \001(\010\0325\n\023InputProgramDbEntry"
-  "\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\014:\0028\001\"g\n\014Flus"
-  "hRequest\022\022\n\nbatch_uuid\030\001 \001(\t\022\026\n\016new_stat"
-  "e_root\030\002 \001(\t\022+\n\013persistence\030\003 \001(\0162\026.hash"
-  "db.v1.Persistence\"j\n\017FinishTxRequest\022\022\n\n"
-  "batch_uuid\030\001 \001(\t\022\026\n\016new_state_root\030\002 \001(\t"
-  "\022+\n\013persistence\030\003 \001(\0162\026.hashdb.v1.Persis"
-  "tence\"l\n\021StartBlockRequest\022\022\n\nbatch_uuid"
-  "\030\001 \001(\t\022\026\n\016old_state_root\030\002 \001(\t\022+\n\013persis"
-  "tence\030\003 \001(\0162\026.hashdb.v1.Persistence\"m\n\022F"
-  "inishBlockRequest\022\022\n\nbatch_uuid\030\001 \001(\t\022\026\n"
+  "batch_uuid\030\005 \001(\t\"O\n\017SetBatchRequest\022\'\n\010r"
+  "equests\030\001 \003(\0132\025.hashdb.v1.SetRequest\022\023\n\013"
+  "chain_roots\030\002 \001(\010\":\n\017GetBatchRequest\022\'\n\010"
+  "requests\030\001 \003(\0132\025.hashdb.v1.GetRequest\"\246\001"
+  "\n\021SetProgramRequest\022\033\n\003key\030\001 \001(\0132\016.hashd"
+  "b.v1.Fea\022\014\n\004data\030\002 \001(\014\022+\n\013persistence\030\003 "
+  "\001(\0162\026.hashdb.v1.Persistence\022\022\n\nbatch_uui"
+  "d\030\004 \001(\t\022\020\n\010tx_index\030\005 \001(\004\022\023\n\013block_index"
+  "\030\006 \001(\004\"D\n\021GetProgramRequest\022\033\n\003key\030\001 \001(\013"
+  "2\016.hashdb.v1.Fea\022\022\n\nbatch_uuid\030\002 \001(\t\"\303\001\n"
+  "\rLoadDBRequest\0227\n\010input_db\030\001 \003(\0132%.hashd"
+  "b.v1.LoadDBRequest.InputDbEntry\022\022\n\npersi"
+  "stent\030\002 \001(\010\022\"\n\nstate_root\030\003 \001(\0132\016.hashdb"
+  ".v1.Fea\032A\n\014InputDbEntry\022\013\n\003key\030\001 \001(\t\022 \n\005"
+  "value\030\002 \001(\0132\021.hashdb.v1.FeList:\0028\001\"\260\001\n\024L"
+  "oadProgramDBRequest\022M\n\020input_program_db\030"
+  "\001 \003(\01323.hashdb.v1.LoadProgramDBRequest.I"
+  "nputProgramDbEntry\022\022\n\npersistent\030\002 \001(\010\0325"
+  "\n\023InputProgramDbEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005va"
+  "lue\030\002 \001(\014:\0028\001\"g\n\014FlushRequest\022\022\n\nbatch_u"
+  "uid\030\001 \001(\t\022\026\n\016new_state_root\030\002 \001(\t\022+\n\013per"
+  "sistence\030\003 \001(\0162\026.hashdb.v1.Persistence\"j"
+  "\n\017FinishTxRequest\022\022\n\nbatch_uuid\030\001 \001(\t\022\026\n"
   "\016new_state_root\030\002 \001(\t\022+\n\013persistence\030\003 \001"
-  "(\0162\026.hashdb.v1.Persistence\"\'\n\023GetFlushDa"
-  "taRequest\022\020\n\010flush_id\030\001 \001(\004\"r\n\027Consolida"
-  "teStateRequest\022*\n\022virtual_state_root\030\001 \001"
-  "(\0132\016.hashdb.v1.Fea\022+\n\013persistence\030\002 \001(\0162"
-  "\026.hashdb.v1.Persistence\"w\n\014PurgeRequest\022"
-  "\022\n\nbatch_uuid\030\001 \001(\t\022&\n\016new_state_root\030\002 "
-  "\001(\0132\016.hashdb.v1.Fea\022+\n\013persistence\030\003 \001(\016"
-  "2\026.hashdb.v1.Persistence\"S\n\017ReadTreeRequ"
-  "est\022\"\n\nstate_root\030\001 \001(\0132\016.hashdb.v1.Fea\022"
-  "\034\n\004keys\030\002 \003(\0132\016.hashdb.v1.Fea\"(\n\022CancelB"
-  "atchRequest\022\022\n\nbatch_uuid\030\001 \001(\t\"h\n\032GetLa"
-  "testStateRootResponse\022#\n\013latest_root\030\001 \001"
-  "(\0132\016.hashdb.v1.Fea\022%\n\006result\030\002 \001(\0132\025.has"
-  "hdb.v1.ResultCode\"\205\005\n\013SetResponse\022 \n\010old"
-  "_root\030\001 \001(\0132\016.hashdb.v1.Fea\022 \n\010new_root\030"
-  "\002 \001(\0132\016.hashdb.v1.Fea\022\033\n\003key\030\003 \001(\0132\016.has"
-  "hdb.v1.Fea\0226\n\010siblings\030\004 \003(\0132$.hashdb.v1"
-  ".SetResponse.SiblingsEntry\022\037\n\007ins_key\030\005 "
-  "\001(\0132\016.hashdb.v1.Fea\022\021\n\tins_value\030\006 \001(\t\022\017"
-  "\n\007is_old0\030\007 \001(\010\022\021\n\told_value\030\010 \001(\t\022\021\n\tne"
-  "w_value\030\t \001(\t\022\014\n\004mode\030\n \001(\t\022\032\n\022proof_has"
-  "h_counter\030\013 \001(\004\022:\n\013db_read_log\030\014 \003(\0132%.h"
-  "ashdb.v1.SetResponse.DbReadLogEntry\022%\n\006r"
-  "esult\030\r \001(\0132\025.hashdb.v1.ResultCode\022*\n\022si"
-  "bling_left_child\030\016 \001(\0132\016.hashdb.v1.Fea\022+"
-  "\n\023sibling_right_child\030\017 \001(\0132\016.hashdb.v1."
-  "Fea\032G\n\rSiblingsEntry\022\013\n\003key\030\001 \001(\004\022%\n\005val"
-  "ue\030\002 \001(\0132\026.hashdb.v1.SiblingList:\0028\001\032C\n\016"
-  "DbReadLogEntry\022\013\n\003key\030\001 \001(\t\022 \n\005value\030\002 \001"
-  "(\0132\021.hashdb.v1.FeList:\0028\001\"\341\003\n\013GetRespons"
-  "e\022\034\n\004root\030\001 \001(\0132\016.hashdb.v1.Fea\022\033\n\003key\030\002"
-  " \001(\0132\016.hashdb.v1.Fea\0226\n\010siblings\030\003 \003(\0132$"
-  ".hashdb.v1.GetResponse.SiblingsEntry\022\037\n\007"
-  "ins_key\030\004 \001(\0132\016.hashdb.v1.Fea\022\021\n\tins_val"
-  "ue\030\005 \001(\t\022\017\n\007is_old0\030\006 \001(\010\022\r\n\005value\030\007 \001(\t"
-  "\022\032\n\022proof_hash_counter\030\010 \001(\004\022:\n\013db_read_"
-  "log\030\t \003(\0132%.hashdb.v1.GetResponse.DbRead"
-  "LogEntry\022%\n\006result\030\n \001(\0132\025.hashdb.v1.Res"
-  "ultCode\032G\n\rSiblingsEntry\022\013\n\003key\030\001 \001(\004\022%\n"
-  "\005value\030\002 \001(\0132\026.hashdb.v1.SiblingList:\0028\001"
-  "\032C\n\016DbReadLogEntry\022\013\n\003key\030\001 \001(\t\022 \n\005value"
-  "\030\002 \001(\0132\021.hashdb.v1.FeList:\0028\001\";\n\022SetProg"
-  "ramResponse\022%\n\006result\030\001 \001(\0132\025.hashdb.v1."
-  "ResultCode\"I\n\022GetProgramResponse\022\014\n\004data"
-  "\030\001 \001(\014\022%\n\006result\030\002 \001(\0132\025.hashdb.v1.Resul"
-  "tCode\"a\n\rFlushResponse\022\020\n\010flush_id\030\001 \001(\004"
-  "\022\027\n\017stored_flush_id\030\002 \001(\004\022%\n\006result\030\003 \001("
-  "\0132\025.hashdb.v1.ResultCode\"\347\001\n\026GetFlushSta"
-  "tusResponse\022\027\n\017stored_flush_id\030\001 \001(\004\022\030\n\020"
-  "storing_flush_id\030\002 \001(\004\022\025\n\rlast_flush_id\030"
-  "\003 \001(\004\022\036\n\026pending_to_flush_nodes\030\004 \001(\004\022 \n"
-  "\030pending_to_flush_program\030\005 \001(\004\022\025\n\rstori"
-  "ng_nodes\030\006 \001(\004\022\027\n\017storing_program\030\007 \001(\004\022"
-  "\021\n\tprover_id\030\010 \001(\t\"\310\002\n\024GetFlushDataRespo"
-  "nse\022\027\n\017stored_flush_id\030\001 \001(\004\0229\n\005nodes\030\002 "
-  "\003(\0132*.hashdb.v1.GetFlushDataResponse.Nod"
-  "esEntry\022=\n\007program\030\003 \003(\0132,.hashdb.v1.Get"
-  "FlushDataResponse.ProgramEntry\022\030\n\020nodes_"
-  "state_root\030\004 \001(\t\022%\n\006result\030\005 \001(\0132\025.hashd"
-  "b.v1.ResultCode\032,\n\nNodesEntry\022\013\n\003key\030\001 \001"
-  "(\t\022\r\n\005value\030\002 \001(\t:\0028\001\032.\n\014ProgramEntry\022\013\n"
-  "\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"\235\001\n\030Consol"
-  "idateStateResponse\022/\n\027consolidated_state"
-  "_root\030\001 \001(\0132\016.hashdb.v1.Fea\022\020\n\010flush_id\030"
-  "\002 \001(\004\022\027\n\017stored_flush_id\030\003 \001(\004\022%\n\006result"
-  "\030\004 \001(\0132\025.hashdb.v1.ResultCode\"6\n\rPurgeRe"
-  "sponse\022%\n\006result\030\001 \001(\0132\025.hashdb.v1.Resul"
-  "tCode\"\215\001\n\020ReadTreeResponse\022&\n\tkey_value\030"
-  "\001 \003(\0132\023.hashdb.v1.KeyValue\022*\n\nhash_value"
-  "\030\002 \003(\0132\026.hashdb.v1.HashValueGL\022%\n\006result"
-  "\030\003 \001(\0132\025.hashdb.v1.ResultCode\"<\n\023CancelB"
-  "atchResponse\022%\n\006result\030\001 \001(\0132\025.hashdb.v1"
-  ".ResultCode\"8\n\017ResetDBResponse\022%\n\006result"
-  "\030\001 \001(\0132\025.hashdb.v1.ResultCode\"9\n\003Fea\022\013\n\003"
-  "fe0\030\001 \001(\004\022\013\n\003fe1\030\002 \001(\004\022\013\n\003fe2\030\003 \001(\004\022\013\n\003f"
-  "e3\030\004 \001(\004\"\245\001\n\005Fea12\022\013\n\003fe0\030\001 \001(\004\022\013\n\003fe1\030\002"
-  " \001(\004\022\013\n\003fe2\030\003 \001(\004\022\013\n\003fe3\030\004 \001(\004\022\013\n\003fe4\030\005 "
-  "\001(\004\022\013\n\003fe5\030\006 \001(\004\022\013\n\003fe6\030\007 \001(\004\022\013\n\003fe7\030\010 \001"
-  "(\004\022\013\n\003fe8\030\t \001(\004\022\013\n\003fe9\030\n \001(\004\022\014\n\004fe10\030\013 \001"
-  "(\004\022\014\n\004fe11\030\014 \001(\004\"L\n\013HashValueGL\022\034\n\004hash\030"
-  "\001 \001(\0132\016.hashdb.v1.Fea\022\037\n\005value\030\002 \001(\0132\020.h"
-  "ashdb.v1.Fea12\"6\n\010KeyValue\022\033\n\003key\030\001 \001(\0132"
-  "\016.hashdb.v1.Fea\022\r\n\005value\030\002 \001(\t\"\024\n\006FeList"
-  "\022\n\n\002fe\030\001 \003(\004\"\036\n\013SiblingList\022\017\n\007sibling\030\001"
-  " \003(\004\"\316\001\n\nResultCode\022(\n\004code\030\001 \001(\0162\032.hash"
-  "db.v1.ResultCode.Code\"\225\001\n\004Code\022\024\n\020CODE_U"
-  "NSPECIFIED\020\000\022\020\n\014CODE_SUCCESS\020\001\022\031\n\025CODE_D"
-  "B_KEY_NOT_FOUND\020\002\022\021\n\rCODE_DB_ERROR\020\003\022\027\n\023"
-  "CODE_INTERNAL_ERROR\020\004\022\036\n\032CODE_SMT_INVALI"
-  "D_DATA_SIZE\020\016*e\n\013Persistence\022!\n\035PERSISTE"
-  "NCE_CACHE_UNSPECIFIED\020\000\022\030\n\024PERSISTENCE_D"
-  "ATABASE\020\001\022\031\n\025PERSISTENCE_TEMPORARY\020\0022\237\n\n"
-  "\rHashDBService\022U\n\022GetLatestStateRoot\022\026.g"
-  "oogle.protobuf.Empty\032%.hashdb.v1.GetLate"
-  "stStateRootResponse\"\000\0226\n\003Set\022\025.hashdb.v1"
-  ".SetRequest\032\026.hashdb.v1.SetResponse\"\000\0226\n"
-  "\003Get\022\025.hashdb.v1.GetRequest\032\026.hashdb.v1."
-  "GetResponse\"\000\022K\n\nSetProgram\022\034.hashdb.v1."
-  "SetProgramRequest\032\035.hashdb.v1.SetProgram"
-  "Response\"\000\022K\n\nGetProgram\022\034.hashdb.v1.Get"
-  "ProgramRequest\032\035.hashdb.v1.GetProgramRes"
-  "ponse\"\000\022<\n\006LoadDB\022\030.hashdb.v1.LoadDBRequ"
-  "est\032\026.google.protobuf.Empty\"\000\022J\n\rLoadPro"
-  "gramDB\022\037.hashdb.v1.LoadProgramDBRequest\032"
-  "\026.google.protobuf.Empty\"\000\022@\n\010FinishTx\022\032."
-  "hashdb.v1.FinishTxRequest\032\026.google.proto"
-  "buf.Empty\"\000\022D\n\nStartBlock\022\034.hashdb.v1.St"
-  "artBlockRequest\032\026.google.protobuf.Empty\""
-  "\000\022F\n\013FinishBlock\022\035.hashdb.v1.FinishBlock"
-  "Request\032\026.google.protobuf.Empty\"\000\022<\n\005Flu"
-  "sh\022\027.hashdb.v1.FlushRequest\032\030.hashdb.v1."
-  "FlushResponse\"\000\022M\n\016GetFlushStatus\022\026.goog"
-  "le.protobuf.Empty\032!.hashdb.v1.GetFlushSt"
-  "atusResponse\"\000\022Q\n\014GetFlushData\022\036.hashdb."
-  "v1.GetFlushDataRequest\032\037.hashdb.v1.GetFl"
-  "ushDataResponse\"\000\022]\n\020ConsolidateState\022\"."
-  "hashdb.v1.ConsolidateStateRequest\032#.hash"
-  "db.v1.ConsolidateStateResponse\"\000\022<\n\005Purg"
-  "e\022\027.hashdb.v1.PurgeRequest\032\030.hashdb.v1.P"
-  "urgeResponse\"\000\022E\n\010ReadTree\022\032.hashdb.v1.R"
-  "eadTreeRequest\032\033.hashdb.v1.ReadTreeRespo"
-  "nse\"\000\022N\n\013CancelBatch\022\035.hashdb.v1.CancelB"
-  "atchRequest\032\036.hashdb.v1.CancelBatchRespo"
-  "nse\"\000\022\?\n\007ResetDB\022\026.google.protobuf.Empty"
-  "\032\032.hashdb.v1.ResetDBResponse\"\000B9Z7github"
-  ".com/0xPolygonHermez/zkevm-node/merkletr"
-  "ee/hashdbb\006proto3"
+  "(\0162\026.hashdb.v1.Persistence\"l\n\021StartBlock"
+  "Request\022\022\n\nbatch_uuid\030\001 \001(\t\022\026\n\016old_state"
+  "_root\030\002 \001(\t\022+\n\013persistence\030\003 \001(\0162\026.hashd"
+  "b.v1.Persistence\"m\n\022FinishBlockRequest\022\022"
+  "\n\nbatch_uuid\030\001 \001(\t\022\026\n\016new_state_root\030\002 \001"
+  "(\t\022+\n\013persistence\030\003 \001(\0162\026.hashdb.v1.Pers"
+  "istence\"\'\n\023GetFlushDataRequest\022\020\n\010flush_"
+  "id\030\001 \001(\004\"r\n\027ConsolidateStateRequest\022*\n\022v"
+  "irtual_state_root\030\001 \001(\0132\016.hashdb.v1.Fea\022"
+  "+\n\013persistence\030\002 \001(\0162\026.hashdb.v1.Persist"
+  "ence\"w\n\014PurgeRequest\022\022\n\nbatch_uuid\030\001 \001(\t"
+  "\022&\n\016new_state_root\030\002 \001(\0132\016.hashdb.v1.Fea"
+  "\022+\n\013persistence\030\003 \001(\0162\026.hashdb.v1.Persis"
+  "tence\"S\n\017ReadTreeRequest\022\"\n\nstate_root\030\001"
+  " \001(\0132\016.hashdb.v1.Fea\022\034\n\004keys\030\002 \003(\0132\016.has"
+  "hdb.v1.Fea\"(\n\022CancelBatchRequest\022\022\n\nbatc"
+  "h_uuid\030\001 \001(\t\"h\n\032GetLatestStateRootRespon"
+  "se\022#\n\013latest_root\030\001 \001(\0132\016.hashdb.v1.Fea\022"
+  "%\n\006result\030\002 \001(\0132\025.hashdb.v1.ResultCode\"\205"
+  "\005\n\013SetResponse\022 \n\010old_root\030\001 \001(\0132\016.hashd"
+  "b.v1.Fea\022 \n\010new_root\030\002 \001(\0132\016.hashdb.v1.F"
+  "ea\022\033\n\003key\030\003 \001(\0132\016.hashdb.v1.Fea\0226\n\010sibli"
+  "ngs\030\004 \003(\0132$.hashdb.v1.SetResponse.Siblin"
+  "gsEntry\022\037\n\007ins_key\030\005 \001(\0132\016.hashdb.v1.Fea"
+  "\022\021\n\tins_value\030\006 \001(\t\022\017\n\007is_old0\030\007 \001(\010\022\021\n\t"
+  "old_value\030\010 \001(\t\022\021\n\tnew_value\030\t \001(\t\022\014\n\004mo"
+  "de\030\n \001(\t\022\032\n\022proof_hash_counter\030\013 \001(\004\022:\n\013"
+  "db_read_log\030\014 \003(\0132%.hashdb.v1.SetRespons"
+  "e.DbReadLogEntry\022%\n\006result\030\r \001(\0132\025.hashd"
+  "b.v1.ResultCode\022*\n\022sibling_left_child\030\016 "
+  "\001(\0132\016.hashdb.v1.Fea\022+\n\023sibling_right_chi"
+  "ld\030\017 \001(\0132\016.hashdb.v1.Fea\032G\n\rSiblingsEntr"
+  "y\022\013\n\003key\030\001 \001(\004\022%\n\005value\030\002 \001(\0132\026.hashdb.v"
+  "1.SiblingList:\0028\001\032C\n\016DbReadLogEntry\022\013\n\003k"
+  "ey\030\001 \001(\t\022 \n\005value\030\002 \001(\0132\021.hashdb.v1.FeLi"
+  "st:\0028\001\"\341\003\n\013GetResponse\022\034\n\004root\030\001 \001(\0132\016.h"
+  "ashdb.v1.Fea\022\033\n\003key\030\002 \001(\0132\016.hashdb.v1.Fe"
+  "a\0226\n\010siblings\030\003 \003(\0132$.hashdb.v1.GetRespo"
+  "nse.SiblingsEntry\022\037\n\007ins_key\030\004 \001(\0132\016.has"
+  "hdb.v1.Fea\022\021\n\tins_value\030\005 \001(\t\022\017\n\007is_old0"
+  "\030\006 \001(\010\022\r\n\005value\030\007 \001(\t\022\032\n\022proof_hash_coun"
+  "ter\030\010 \001(\004\022:\n\013db_read_log\030\t \003(\0132%.hashdb."
+  "v1.GetResponse.DbReadLogEntry\022%\n\006result\030"
+  "\n \001(\0132\025.hashdb.v1.ResultCode\032G\n\rSiblings"
+  "Entry\022\013\n\003key\030\001 \001(\004\022%\n\005value\030\002 \001(\0132\026.hash"
+  "db.v1.SiblingList:\0028\001\032C\n\016DbReadLogEntry\022"
+  "\013\n\003key\030\001 \001(\t\022 \n\005value\030\002 \001(\0132\021.hashdb.v1."
+  "FeList:\0028\001\"d\n\020SetBatchResponse\022)\n\trespon"
+  "ses\030\001 \003(\0132\026.hashdb.v1.SetResponse\022%\n\006res"
+  "ult\030\002 \001(\0132\025.hashdb.v1.ResultCode\"d\n\020GetB"
+  "atchResponse\022)\n\tresponses\030\001 \003(\0132\026.hashdb"
+  ".v1.GetResponse\022%\n\006result\030\002 \001(\0132\025.hashdb"
+  ".v1.ResultCode\";\n\022SetProgramResponse\022%\n\006"
+  "result\030\001 \001(\0132\025.hashdb.v1.ResultCode\"I\n\022G"
+  "etProgramResponse\022\014\n\004data\030\001 \001(\014\022%\n\006resul"
+  "t\030\002 \001(\0132\025.hashdb.v1.ResultCode\"a\n\rFlushR"
+  "esponse\022\020\n\010flush_id\030\001 \001(\004\022\027\n\017stored_flus"
+  "h_id\030\002 \001(\004\022%\n\006result\030\003 \001(\0132\025.hashdb.v1.R"
+  "esultCode\"\347\001\n\026GetFlushStatusResponse\022\027\n\017"
+  "stored_flush_id\030\001 \001(\004\022\030\n\020storing_flush_i"
+  "d\030\002 \001(\004\022\025\n\rlast_flush_id\030\003 \001(\004\022\036\n\026pendin"
+  "g_to_flush_nodes\030\004 \001(\004\022 \n\030pending_to_flu"
+  "sh_program\030\005 \001(\004\022\025\n\rstoring_nodes\030\006 \001(\004\022"
+  "\027\n\017storing_program\030\007 \001(\004\022\021\n\tprover_id\030\010 "
+  "\001(\t\"\310\002\n\024GetFlushDataResponse\022\027\n\017stored_f"
+  "lush_id\030\001 \001(\004\0229\n\005nodes\030\002 \003(\0132*.hashdb.v1"
+  ".GetFlushDataResponse.NodesEntry\022=\n\007prog"
+  "ram\030\003 \003(\0132,.hashdb.v1.GetFlushDataRespon"
+  "se.ProgramEntry\022\030\n\020nodes_state_root\030\004 \001("
+  "\t\022%\n\006result\030\005 \001(\0132\025.hashdb.v1.ResultCode"
+  "\032,\n\nNodesEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001"
+  "(\t:\0028\001\032.\n\014ProgramEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005v"
+  "alue\030\002 \001(\t:\0028\001\"\235\001\n\030ConsolidateStateRespo"
+  "nse\022/\n\027consolidated_state_root\030\001 \001(\0132\016.h"
+  "ashdb.v1.Fea\022\020\n\010flush_id\030\002 \001(\004\022\027\n\017stored"
+  "_flush_id\030\003 \001(\004\022%\n\006result\030\004 \001(\0132\025.hashdb"
+  ".v1.ResultCode\"6\n\rPurgeResponse\022%\n\006resul"
+  "t\030\001 \001(\0132\025.hashdb.v1.ResultCode\"\215\001\n\020ReadT"
+  "reeResponse\022&\n\tkey_value\030\001 \003(\0132\023.hashdb."
+  "v1.KeyValue\022*\n\nhash_value\030\002 \003(\0132\026.hashdb"
+  ".v1.HashValueGL\022%\n\006result\030\003 \001(\0132\025.hashdb"
+  ".v1.ResultCode\"<\n\023CancelBatchResponse\022%\n"
+  "\006result\030\001 \001(\0132\025.hashdb.v1.ResultCode\"8\n\017"
+  "ResetDBResponse\022%\n\006result\030\001 \001(\0132\025.hashdb"
+  ".v1.ResultCode\"9\n\003Fea\022\013\n\003fe0\030\001 \001(\004\022\013\n\003fe"
+  "1\030\002 \001(\004\022\013\n\003fe2\030\003 \001(\004\022\013\n\003fe3\030\004 \001(\004\"\245\001\n\005Fe"
+  "a12\022\013\n\003fe0\030\001 \001(\004\022\013\n\003fe1\030\002 \001(\004\022\013\n\003fe2\030\003 \001"
+  "(\004\022\013\n\003fe3\030\004 \001(\004\022\013\n\003fe4\030\005 \001(\004\022\013\n\003fe5\030\006 \001("
+  "\004\022\013\n\003fe6\030\007 \001(\004\022\013\n\003fe7\030\010 \001(\004\022\013\n\003fe8\030\t \001(\004"
+  "\022\013\n\003fe9\030\n \001(\004\022\014\n\004fe10\030\013 \001(\004\022\014\n\004fe11\030\014 \001("
+  "\004\"L\n\013HashValueGL\022\034\n\004hash\030\001 \001(\0132\016.hashdb."
+  "v1.Fea\022\037\n\005value\030\002 \001(\0132\020.hashdb.v1.Fea12\""
+  "6\n\010KeyValue\022\033\n\003key\030\001 \001(\0132\016.hashdb.v1.Fea"
+  "\022\r\n\005value\030\002 \001(\t\"\024\n\006FeList\022\n\n\002fe\030\001 \003(\004\"\036\n"
+  "\013SiblingList\022\017\n\007sibling\030\001 \003(\004\"\316\001\n\nResult"
+  "Code\022(\n\004code\030\001 \001(\0162\032.hashdb.v1.ResultCod"
+  "e.Code\"\225\001\n\004Code\022\024\n\020CODE_UNSPECIFIED\020\000\022\020\n"
+  "\014CODE_SUCCESS\020\001\022\031\n\025CODE_DB_KEY_NOT_FOUND"
+  "\020\002\022\021\n\rCODE_DB_ERROR\020\003\022\027\n\023CODE_INTERNAL_E"
+  "RROR\020\004\022\036\n\032CODE_SMT_INVALID_DATA_SIZE\020\016*e"
+  "\n\013Persistence\022!\n\035PERSISTENCE_CACHE_UNSPE"
+  "CIFIED\020\000\022\030\n\024PERSISTENCE_DATABASE\020\001\022\031\n\025PE"
+  "RSISTENCE_TEMPORARY\020\0022\255\013\n\rHashDBService\022"
+  "U\n\022GetLatestStateRoot\022\026.google.protobuf."
+  "Empty\032%.hashdb.v1.GetLatestStateRootResp"
+  "onse\"\000\0226\n\003Set\022\025.hashdb.v1.SetRequest\032\026.h"
+  "ashdb.v1.SetResponse\"\000\0226\n\003Get\022\025.hashdb.v"
+  "1.GetRequest\032\026.hashdb.v1.GetResponse\"\000\022E"
+  "\n\010SetBatch\022\032.hashdb.v1.SetBatchRequest\032\033"
+  ".hashdb.v1.SetBatchResponse\"\000\022E\n\010GetBatc"
+  "h\022\032.hashdb.v1.GetBatchRequest\032\033.hashdb.v"
+  "1.GetBatchResponse\"\000\022K\n\nSetProgram\022\034.has"
+  "hdb.v1.SetProgramRequest\032\035.hashdb.v1.Set"
+  "ProgramResponse\"\000\022K\n\nGetProgram\022\034.hashdb"
+  ".v1.GetProgramRequest\032\035.hashdb.v1.GetPro"
+  "gramResponse\"\000\022<\n\006LoadDB\022\030.hashdb.v1.Loa"
+  "dDBRequest\032\026.google.protobuf.Empty\"\000\022J\n\r"
+  "LoadProgramDB\022\037.hashdb.v1.LoadProgramDBR"
+  "equest\032\026.google.protobuf.Empty\"\000\022@\n\010Fini"
+  "shTx\022\032.hashdb.v1.FinishTxRequest\032\026.googl"
+  "e.protobuf.Empty\"\000\022D\n\nStartBlock\022\034.hashd"
+  "b.v1.StartBlockRequest\032\026.google.protobuf"
+  ".Empty\"\000\022F\n\013FinishBlock\022\035.hashdb.v1.Fini"
+  "shBlockRequest\032\026.google.protobuf.Empty\"\000"
+  "\022<\n\005Flush\022\027.hashdb.v1.FlushRequest\032\030.has"
+  "hdb.v1.FlushResponse\"\000\022M\n\016GetFlushStatus"
+  "\022\026.google.protobuf.Empty\032!.hashdb.v1.Get"
+  "FlushStatusResponse\"\000\022Q\n\014GetFlushData\022\036."
+  "hashdb.v1.GetFlushDataRequest\032\037.hashdb.v"
+  "1.GetFlushDataResponse\"\000\022]\n\020ConsolidateS"
+  "tate\022\".hashdb.v1.ConsolidateStateRequest"
+  "\032#.hashdb.v1.ConsolidateStateResponse\"\000\022"
+  "<\n\005Purge\022\027.hashdb.v1.PurgeRequest\032\030.hash"
+  "db.v1.PurgeResponse\"\000\022E\n\010ReadTree\022\032.hash"
+  "db.v1.ReadTreeRequest\032\033.hashdb.v1.ReadTr"
+  "eeResponse\"\000\022N\n\013CancelBatch\022\035.hashdb.v1."
+  "CancelBatchRequest\032\036.hashdb.v1.CancelBat"
+  "chResponse\"\000\022\?\n\007ResetDB\022\026.google.protobu"
+  "f.Empty\032\032.hashdb.v1.ResetDBResponse\"\000B9Z"
+  "7github.com/0xPolygonHermez/zkevm-node/m"
+  "erkletree/hashdbb\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_hashdb_2eproto_deps[1] = {
   &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_hashdb_2eproto_sccs[44] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_hashdb_2eproto_sccs[48] = {
   &scc_info_CancelBatchRequest_hashdb_2eproto.base,
   &scc_info_CancelBatchResponse_hashdb_2eproto.base,
   &scc_info_ConsolidateStateRequest_hashdb_2eproto.base,
@@ -1520,6 +1649,8 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_has
   &scc_info_FinishTxRequest_hashdb_2eproto.base,
   &scc_info_FlushRequest_hashdb_2eproto.base,
   &scc_info_FlushResponse_hashdb_2eproto.base,
+  &scc_info_GetBatchRequest_hashdb_2eproto.base,
+  &scc_info_GetBatchResponse_hashdb_2eproto.base,
   &scc_info_GetFlushDataRequest_hashdb_2eproto.base,
   &scc_info_GetFlushDataResponse_hashdb_2eproto.base,
   &scc_info_GetFlushDataResponse_NodesEntry_DoNotUse_hashdb_2eproto.base,
@@ -1544,6 +1675,8 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_has
   &scc_info_ReadTreeResponse_hashdb_2eproto.base,
   &scc_info_ResetDBResponse_hashdb_2eproto.base,
   &scc_info_ResultCode_hashdb_2eproto.base,
+  &scc_info_SetBatchRequest_hashdb_2eproto.base,
+  &scc_info_SetBatchResponse_hashdb_2eproto.base,
   &scc_info_SetProgramRequest_hashdb_2eproto.base,
   &scc_info_SetProgramResponse_hashdb_2eproto.base,
   &scc_info_SetRequest_hashdb_2eproto.base,
@@ -1556,10 +1689,10 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_has
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_hashdb_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_hashdb_2eproto = {
-  false, false, descriptor_table_protodef_hashdb_2eproto, "hashdb.proto", 6537,
-  &descriptor_table_hashdb_2eproto_once, descriptor_table_hashdb_2eproto_sccs, descriptor_table_hashdb_2eproto_deps, 44, 1,
+  false, false, descriptor_table_protodef_hashdb_2eproto, "hashdb.proto", 7024,
+  &descriptor_table_hashdb_2eproto_once, descriptor_table_hashdb_2eproto_sccs, descriptor_table_hashdb_2eproto_deps, 48, 1,
   schemas, file_default_instances, TableStruct_hashdb_2eproto::offsets,
-  file_level_metadata_hashdb_2eproto, 44, file_level_enum_descriptors_hashdb_2eproto, file_level_service_descriptors_hashdb_2eproto,
+  file_level_metadata_hashdb_2eproto, 48, file_level_enum_descriptors_hashdb_2eproto, file_level_service_descriptors_hashdb_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -2630,105 +2763,69 @@ void GetRequest::InternalSwap(GetRequest* other) {
 
 // ===================================================================
 
-void SetProgramRequest::InitAsDefaultInstance() {
-  ::hashdb::v1::_SetProgramRequest_default_instance_._instance.get_mutable()->key_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
+void SetBatchRequest::InitAsDefaultInstance() {
 }
-class SetProgramRequest::_Internal {
+class SetBatchRequest::_Internal {
  public:
-  static const ::hashdb::v1::Fea& key(const SetProgramRequest* msg);
 };
 
-const ::hashdb::v1::Fea&
-SetProgramRequest::_Internal::key(const SetProgramRequest* msg) {
-  return *msg->key_;
-}
-SetProgramRequest::SetProgramRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+SetBatchRequest::SetBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  requests_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.SetProgramRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.SetBatchRequest)
 }
-SetProgramRequest::SetProgramRequest(const SetProgramRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+SetBatchRequest::SetBatchRequest(const SetBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      requests_(from.requests_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_data().empty()) {
-    data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_data(),
-      GetArena());
-  }
-  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_batch_uuid().empty()) {
-    batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
-      GetArena());
-  }
-  if (from._internal_has_key()) {
-    key_ = new ::hashdb::v1::Fea(*from.key_);
-  } else {
-    key_ = nullptr;
-  }
-  ::memcpy(&tx_index_, &from.tx_index_,
-    static_cast<size_t>(reinterpret_cast<char*>(&persistence_) -
-    reinterpret_cast<char*>(&tx_index_)) + sizeof(persistence_));
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.SetProgramRequest)
+  chain_roots_ = from.chain_roots_;
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.SetBatchRequest)
 }
 
-void SetProgramRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SetProgramRequest_hashdb_2eproto.base);
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&key_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&persistence_) -
-      reinterpret_cast<char*>(&key_)) + sizeof(persistence_));
+void SetBatchRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SetBatchRequest_hashdb_2eproto.base);
+  chain_roots_ = false;
 }
 
-SetProgramRequest::~SetProgramRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.SetProgramRequest)
+SetBatchRequest::~SetBatchRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.SetBatchRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SetProgramRequest::SharedDtor() {
+void SetBatchRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete key_;
 }
 
-void SetProgramRequest::ArenaDtor(void* object) {
-  SetProgramRequest* _this = reinterpret_cast< SetProgramRequest* >(object);
+void SetBatchRequest::ArenaDtor(void* object) {
+  SetBatchRequest* _this = reinterpret_cast< SetBatchRequest* >(object);
   (void)_this;
 }
-void SetProgramRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void SetBatchRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void SetProgramRequest::SetCachedSize(int size) const {
+void SetBatchRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const SetProgramRequest& SetProgramRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SetProgramRequest_hashdb_2eproto.base);
+const SetBatchRequest& SetBatchRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SetBatchRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void SetProgramRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.SetProgramRequest)
+void SetBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.SetBatchRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  if (GetArena() == nullptr && key_ != nullptr) {
-    delete key_;
-  }
-  key_ = nullptr;
-  ::memset(&tx_index_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&persistence_) -
-      reinterpret_cast<char*>(&tx_index_)) + sizeof(persistence_));
+  requests_.Clear();
+  chain_roots_ = false;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetProgramRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* SetBatchRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -2736,49 +2833,22 @@ const char* SetProgramRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESP
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // .hashdb.v1.Fea key = 1;
+      // repeated .hashdb.v1.SetRequest requests = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_key(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_requests(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else goto handle_unusual;
         continue;
-      // bytes data = 2;
+      // bool chain_roots = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_data();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .hashdb.v1.Persistence persistence = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-          _internal_set_persistence(static_cast<::hashdb::v1::Persistence>(val));
-        } else goto handle_unusual;
-        continue;
-      // string batch_uuid = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          auto str = _internal_mutable_batch_uuid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.SetProgramRequest.batch_uuid"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint64 tx_index = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          tx_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint64 block_index = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          block_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          chain_roots_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -2804,110 +2874,52 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* SetProgramRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* SetBatchRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.SetProgramRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.SetBatchRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .hashdb.v1.Fea key = 1;
-  if (this->has_key()) {
+  // repeated .hashdb.v1.SetRequest requests = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_requests_size()); i < n; i++) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::key(this), target, stream);
-  }
-
-  // bytes data = 2;
-  if (this->data().size() > 0) {
-    target = stream->WriteBytesMaybeAliased(
-        2, this->_internal_data(), target);
-  }
-
-  // .hashdb.v1.Persistence persistence = 3;
-  if (this->persistence() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      3, this->_internal_persistence(), target);
-  }
-
-  // string batch_uuid = 4;
-  if (this->batch_uuid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.SetProgramRequest.batch_uuid");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_batch_uuid(), target);
-  }
-
-  // uint64 tx_index = 5;
-  if (this->tx_index() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(5, this->_internal_tx_index(), target);
+      InternalWriteMessage(1, this->_internal_requests(i), target, stream);
   }
 
-  // uint64 block_index = 6;
-  if (this->block_index() != 0) {
+  // bool chain_roots = 2;
+  if (this->chain_roots() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(6, this->_internal_block_index(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_chain_roots(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.SetProgramRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.SetBatchRequest)
   return target;
 }
 
-size_t SetProgramRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.SetProgramRequest)
+size_t SetBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.SetBatchRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bytes data = 2;
-  if (this->data().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_data());
-  }
-
-  // string batch_uuid = 4;
-  if (this->batch_uuid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_batch_uuid());
-  }
-
-  // .hashdb.v1.Fea key = 1;
-  if (this->has_key()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *key_);
-  }
-
-  // uint64 tx_index = 5;
-  if (this->tx_index() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->_internal_tx_index());
-  }
-
-  // uint64 block_index = 6;
-  if (this->block_index() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->_internal_block_index());
+  // repeated .hashdb.v1.SetRequest requests = 1;
+  total_size += 1UL * this->_internal_requests_size();
+  for (const auto& msg : this->requests_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // .hashdb.v1.Persistence persistence = 3;
-  if (this->persistence() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_persistence());
+  // bool chain_roots = 2;
+  if (this->chain_roots() != 0) {
+    total_size += 1 + 1;
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -2919,169 +2931,126 @@ size_t SetProgramRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void SetProgramRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.SetProgramRequest)
+void SetBatchRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.SetBatchRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const SetProgramRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SetProgramRequest>(
+  const SetBatchRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SetBatchRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.SetProgramRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.SetBatchRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.SetProgramRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.SetBatchRequest)
     MergeFrom(*source);
   }
 }
 
-void SetProgramRequest::MergeFrom(const SetProgramRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.SetProgramRequest)
+void SetBatchRequest::MergeFrom(const SetBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.SetBatchRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.data().size() > 0) {
-    _internal_set_data(from._internal_data());
-  }
-  if (from.batch_uuid().size() > 0) {
-    _internal_set_batch_uuid(from._internal_batch_uuid());
-  }
-  if (from.has_key()) {
-    _internal_mutable_key()->::hashdb::v1::Fea::MergeFrom(from._internal_key());
-  }
-  if (from.tx_index() != 0) {
-    _internal_set_tx_index(from._internal_tx_index());
-  }
-  if (from.block_index() != 0) {
-    _internal_set_block_index(from._internal_block_index());
-  }
-  if (from.persistence() != 0) {
-    _internal_set_persistence(from._internal_persistence());
+  requests_.MergeFrom(from.requests_);
+  if (from.chain_roots() != 0) {
+    _internal_set_chain_roots(from._internal_chain_roots());
   }
 }
 
-void SetProgramRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.SetProgramRequest)
+void SetBatchRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.SetBatchRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void SetProgramRequest::CopyFrom(const SetProgramRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.SetProgramRequest)
+void SetBatchRequest::CopyFrom(const SetBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.SetBatchRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetProgramRequest::IsInitialized() const {
+bool SetBatchRequest::IsInitialized() const {
   return true;
 }
 
-void SetProgramRequest::InternalSwap(SetProgramRequest* other) {
+void SetBatchRequest::InternalSwap(SetBatchRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  data_.Swap(&other->data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetProgramRequest, persistence_)
-      + sizeof(SetProgramRequest::persistence_)
-      - PROTOBUF_FIELD_OFFSET(SetProgramRequest, key_)>(
-          reinterpret_cast<char*>(&key_),
-          reinterpret_cast<char*>(&other->key_));
+  requests_.InternalSwap(&other->requests_);
+  swap(chain_roots_, other->chain_roots_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetProgramRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetBatchRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void GetProgramRequest::InitAsDefaultInstance() {
-  ::hashdb::v1::_GetProgramRequest_default_instance_._instance.get_mutable()->key_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
+void GetBatchRequest::InitAsDefaultInstance() {
 }
-class GetProgramRequest::_Internal {
+class GetBatchRequest::_Internal {
  public:
-  static const ::hashdb::v1::Fea& key(const GetProgramRequest* msg);
 };
 
-const ::hashdb::v1::Fea&
-GetProgramRequest::_Internal::key(const GetProgramRequest* msg) {
-  return *msg->key_;
-}
-GetProgramRequest::GetProgramRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+GetBatchRequest::GetBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  requests_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.GetProgramRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.GetBatchRequest)
 }
-GetProgramRequest::GetProgramRequest(const GetProgramRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+GetBatchRequest::GetBatchRequest(const GetBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      requests_(from.requests_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_batch_uuid().empty()) {
-    batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
-      GetArena());
-  }
-  if (from._internal_has_key()) {
-    key_ = new ::hashdb::v1::Fea(*from.key_);
-  } else {
-    key_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.GetProgramRequest)
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.GetBatchRequest)
 }
 
-void GetProgramRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetProgramRequest_hashdb_2eproto.base);
-  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  key_ = nullptr;
+void GetBatchRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetBatchRequest_hashdb_2eproto.base);
 }
 
-GetProgramRequest::~GetProgramRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.GetProgramRequest)
+GetBatchRequest::~GetBatchRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.GetBatchRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void GetProgramRequest::SharedDtor() {
+void GetBatchRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete key_;
 }
 
-void GetProgramRequest::ArenaDtor(void* object) {
-  GetProgramRequest* _this = reinterpret_cast< GetProgramRequest* >(object);
+void GetBatchRequest::ArenaDtor(void* object) {
+  GetBatchRequest* _this = reinterpret_cast< GetBatchRequest* >(object);
   (void)_this;
 }
-void GetProgramRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void GetBatchRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void GetProgramRequest::SetCachedSize(int size) const {
+void GetBatchRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const GetProgramRequest& GetProgramRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetProgramRequest_hashdb_2eproto.base);
+const GetBatchRequest& GetBatchRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetBatchRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void GetProgramRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.GetProgramRequest)
+void GetBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.GetBatchRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  if (GetArena() == nullptr && key_ != nullptr) {
-    delete key_;
-  }
-  key_ = nullptr;
+  requests_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetProgramRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GetBatchRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -3089,20 +3058,16 @@ const char* GetProgramRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESP
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // .hashdb.v1.Fea key = 1;
+      // repeated .hashdb.v1.GetRequest requests = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_key(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string batch_uuid = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_batch_uuid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.GetProgramRequest.batch_uuid"));
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_requests(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else goto handle_unusual;
         continue;
       default: {
@@ -3127,58 +3092,41 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GetProgramRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* GetBatchRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.GetProgramRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.GetBatchRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .hashdb.v1.Fea key = 1;
-  if (this->has_key()) {
+  // repeated .hashdb.v1.GetRequest requests = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_requests_size()); i < n; i++) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::key(this), target, stream);
-  }
-
-  // string batch_uuid = 2;
-  if (this->batch_uuid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.GetProgramRequest.batch_uuid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_batch_uuid(), target);
+      InternalWriteMessage(1, this->_internal_requests(i), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.GetProgramRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.GetBatchRequest)
   return target;
 }
 
-size_t GetProgramRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.GetProgramRequest)
+size_t GetBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.GetBatchRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string batch_uuid = 2;
-  if (this->batch_uuid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_batch_uuid());
-  }
-
-  // .hashdb.v1.Fea key = 1;
-  if (this->has_key()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *key_);
+  // repeated .hashdb.v1.GetRequest requests = 1;
+  total_size += 1UL * this->_internal_requests_size();
+  for (const auto& msg : this->requests_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -3190,167 +3138,161 @@ size_t GetProgramRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void GetProgramRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.GetProgramRequest)
+void GetBatchRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.GetBatchRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetProgramRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetProgramRequest>(
+  const GetBatchRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetBatchRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.GetProgramRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.GetBatchRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.GetProgramRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.GetBatchRequest)
     MergeFrom(*source);
   }
 }
 
-void GetProgramRequest::MergeFrom(const GetProgramRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.GetProgramRequest)
+void GetBatchRequest::MergeFrom(const GetBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.GetBatchRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.batch_uuid().size() > 0) {
-    _internal_set_batch_uuid(from._internal_batch_uuid());
-  }
-  if (from.has_key()) {
-    _internal_mutable_key()->::hashdb::v1::Fea::MergeFrom(from._internal_key());
-  }
+  requests_.MergeFrom(from.requests_);
 }
 
-void GetProgramRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.GetProgramRequest)
+void GetBatchRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.GetBatchRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetProgramRequest::CopyFrom(const GetProgramRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.GetProgramRequest)
+void GetBatchRequest::CopyFrom(const GetBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.GetBatchRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetProgramRequest::IsInitialized() const {
+bool GetBatchRequest::IsInitialized() const {
   return true;
 }
 
-void GetProgramRequest::InternalSwap(GetProgramRequest* other) {
+void GetBatchRequest::InternalSwap(GetBatchRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(key_, other->key_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata GetProgramRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  requests_.InternalSwap(&other->requests_);
 }
 
-
-// ===================================================================
-
-LoadDBRequest_InputDbEntry_DoNotUse::LoadDBRequest_InputDbEntry_DoNotUse() {}
-LoadDBRequest_InputDbEntry_DoNotUse::LoadDBRequest_InputDbEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : SuperType(arena) {}
-void LoadDBRequest_InputDbEntry_DoNotUse::MergeFrom(const LoadDBRequest_InputDbEntry_DoNotUse& other) {
-  MergeFromInternal(other);
-}
-::PROTOBUF_NAMESPACE_ID::Metadata LoadDBRequest_InputDbEntry_DoNotUse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata GetBatchRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
-void LoadDBRequest_InputDbEntry_DoNotUse::MergeFrom(
-    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
-  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
-}
 
 
 // ===================================================================
 
-void LoadDBRequest::InitAsDefaultInstance() {
-  ::hashdb::v1::_LoadDBRequest_default_instance_._instance.get_mutable()->state_root_ = const_cast< ::hashdb::v1::Fea*>(
+void SetProgramRequest::InitAsDefaultInstance() {
+  ::hashdb::v1::_SetProgramRequest_default_instance_._instance.get_mutable()->key_ = const_cast< ::hashdb::v1::Fea*>(
       ::hashdb::v1::Fea::internal_default_instance());
 }
-class LoadDBRequest::_Internal {
+class SetProgramRequest::_Internal {
  public:
-  static const ::hashdb::v1::Fea& state_root(const LoadDBRequest* msg);
+  static const ::hashdb::v1::Fea& key(const SetProgramRequest* msg);
 };
 
 const ::hashdb::v1::Fea&
-LoadDBRequest::_Internal::state_root(const LoadDBRequest* msg) {
-  return *msg->state_root_;
+SetProgramRequest::_Internal::key(const SetProgramRequest* msg) {
+  return *msg->key_;
 }
-LoadDBRequest::LoadDBRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  input_db_(arena) {
+SetProgramRequest::SetProgramRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.LoadDBRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.SetProgramRequest)
 }
-LoadDBRequest::LoadDBRequest(const LoadDBRequest& from)
+SetProgramRequest::SetProgramRequest(const SetProgramRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  input_db_.MergeFrom(from.input_db_);
-  if (from._internal_has_state_root()) {
-    state_root_ = new ::hashdb::v1::Fea(*from.state_root_);
+  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_data().empty()) {
+    data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_data(),
+      GetArena());
+  }
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_batch_uuid().empty()) {
+    batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
+      GetArena());
+  }
+  if (from._internal_has_key()) {
+    key_ = new ::hashdb::v1::Fea(*from.key_);
   } else {
-    state_root_ = nullptr;
+    key_ = nullptr;
   }
-  persistent_ = from.persistent_;
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.LoadDBRequest)
+  ::memcpy(&tx_index_, &from.tx_index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&persistence_) -
+    reinterpret_cast<char*>(&tx_index_)) + sizeof(persistence_));
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.SetProgramRequest)
 }
 
-void LoadDBRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_LoadDBRequest_hashdb_2eproto.base);
-  ::memset(&state_root_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&persistent_) -
-      reinterpret_cast<char*>(&state_root_)) + sizeof(persistent_));
+void SetProgramRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SetProgramRequest_hashdb_2eproto.base);
+  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&key_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&persistence_) -
+      reinterpret_cast<char*>(&key_)) + sizeof(persistence_));
 }
 
-LoadDBRequest::~LoadDBRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.LoadDBRequest)
+SetProgramRequest::~SetProgramRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.SetProgramRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void LoadDBRequest::SharedDtor() {
+void SetProgramRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete state_root_;
+  data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete key_;
 }
 
-void LoadDBRequest::ArenaDtor(void* object) {
-  LoadDBRequest* _this = reinterpret_cast< LoadDBRequest* >(object);
+void SetProgramRequest::ArenaDtor(void* object) {
+  SetProgramRequest* _this = reinterpret_cast< SetProgramRequest* >(object);
   (void)_this;
 }
-void LoadDBRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void SetProgramRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void LoadDBRequest::SetCachedSize(int size) const {
+void SetProgramRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const LoadDBRequest& LoadDBRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_LoadDBRequest_hashdb_2eproto.base);
+const SetProgramRequest& SetProgramRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SetProgramRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void LoadDBRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.LoadDBRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void SetProgramRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.SetProgramRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  input_db_.Clear();
-  if (GetArena() == nullptr && state_root_ != nullptr) {
-    delete state_root_;
+  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (GetArena() == nullptr && key_ != nullptr) {
+    delete key_;
   }
-  state_root_ = nullptr;
-  persistent_ = false;
+  key_ = nullptr;
+  ::memset(&tx_index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&persistence_) -
+      reinterpret_cast<char*>(&tx_index_)) + sizeof(persistence_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* LoadDBRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* SetProgramRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -3358,29 +3300,49 @@ const char* LoadDBRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // map<string, .hashdb.v1.FeList> input_db = 1;
+      // .hashdb.v1.Fea key = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(&input_db_, ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+          ptr = ctx->ParseMessage(_internal_mutable_key(), ptr);
+          CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // bool persistent = 2;
+      // bytes data = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          persistent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          auto str = _internal_mutable_data();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // .hashdb.v1.Fea state_root = 3;
+      // .hashdb.v1.Persistence persistence = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_state_root(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_persistence(static_cast<::hashdb::v1::Persistence>(val));
+        } else goto handle_unusual;
+        continue;
+      // string batch_uuid = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          auto str = _internal_mutable_batch_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.SetProgramRequest.batch_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 tx_index = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          tx_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 block_index = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          block_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -3406,102 +3368,110 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* LoadDBRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* SetProgramRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.LoadDBRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.SetProgramRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // map<string, .hashdb.v1.FeList> input_db = 1;
-  if (!this->_internal_input_db().empty()) {
-    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_pointer
-        ConstPtr;
-    typedef ConstPtr SortItem;
-    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
-    struct Utf8Check {
-      static void Check(ConstPtr p) {
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-          p->first.data(), static_cast<int>(p->first.length()),
-          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-          "hashdb.v1.LoadDBRequest.InputDbEntry.key");
-      }
-    };
+  // .hashdb.v1.Fea key = 1;
+  if (this->has_key()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::key(this), target, stream);
+  }
 
-    if (stream->IsSerializationDeterministic() &&
-        this->_internal_input_db().size() > 1) {
-      ::std::unique_ptr<SortItem[]> items(
-          new SortItem[this->_internal_input_db().size()]);
-      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::size_type size_type;
-      size_type n = 0;
-      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
-          it = this->_internal_input_db().begin();
-          it != this->_internal_input_db().end(); ++it, ++n) {
-        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
-      for (size_type i = 0; i < n; i++) {
-        target = LoadDBRequest_InputDbEntry_DoNotUse::Funcs::InternalSerialize(1, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
-        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
-      }
-    } else {
-      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
-          it = this->_internal_input_db().begin();
-          it != this->_internal_input_db().end(); ++it) {
-        target = LoadDBRequest_InputDbEntry_DoNotUse::Funcs::InternalSerialize(1, it->first, it->second, target, stream);
-        Utf8Check::Check(&(*it));
-      }
-    }
+  // bytes data = 2;
+  if (this->data().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_data(), target);
   }
 
-  // bool persistent = 2;
-  if (this->persistent() != 0) {
+  // .hashdb.v1.Persistence persistence = 3;
+  if (this->persistence() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_persistent(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_persistence(), target);
   }
 
-  // .hashdb.v1.Fea state_root = 3;
-  if (this->has_state_root()) {
+  // string batch_uuid = 4;
+  if (this->batch_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.SetProgramRequest.batch_uuid");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_batch_uuid(), target);
+  }
+
+  // uint64 tx_index = 5;
+  if (this->tx_index() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::state_root(this), target, stream);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(5, this->_internal_tx_index(), target);
+  }
+
+  // uint64 block_index = 6;
+  if (this->block_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(6, this->_internal_block_index(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.LoadDBRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.SetProgramRequest)
   return target;
 }
 
-size_t LoadDBRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.LoadDBRequest)
+size_t SetProgramRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.SetProgramRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // map<string, .hashdb.v1.FeList> input_db = 1;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_input_db_size());
-  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
-      it = this->_internal_input_db().begin();
-      it != this->_internal_input_db().end(); ++it) {
-    total_size += LoadDBRequest_InputDbEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  // bytes data = 2;
+  if (this->data().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
-  // .hashdb.v1.Fea state_root = 3;
-  if (this->has_state_root()) {
+  // string batch_uuid = 4;
+  if (this->batch_uuid().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_batch_uuid());
+  }
+
+  // .hashdb.v1.Fea key = 1;
+  if (this->has_key()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *state_root_);
+        *key_);
   }
 
-  // bool persistent = 2;
-  if (this->persistent() != 0) {
-    total_size += 1 + 1;
+  // uint64 tx_index = 5;
+  if (this->tx_index() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_tx_index());
+  }
+
+  // uint64 block_index = 6;
+  if (this->block_index() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_block_index());
+  }
+
+  // .hashdb.v1.Persistence persistence = 3;
+  if (this->persistence() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_persistence());
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -3513,154 +3483,169 @@ size_t LoadDBRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void LoadDBRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.LoadDBRequest)
+void SetProgramRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.SetProgramRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const LoadDBRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<LoadDBRequest>(
+  const SetProgramRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SetProgramRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.LoadDBRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.SetProgramRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.LoadDBRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.SetProgramRequest)
     MergeFrom(*source);
   }
 }
 
-void LoadDBRequest::MergeFrom(const LoadDBRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.LoadDBRequest)
+void SetProgramRequest::MergeFrom(const SetProgramRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.SetProgramRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  input_db_.MergeFrom(from.input_db_);
-  if (from.has_state_root()) {
-    _internal_mutable_state_root()->::hashdb::v1::Fea::MergeFrom(from._internal_state_root());
+  if (from.data().size() > 0) {
+    _internal_set_data(from._internal_data());
   }
-  if (from.persistent() != 0) {
-    _internal_set_persistent(from._internal_persistent());
+  if (from.batch_uuid().size() > 0) {
+    _internal_set_batch_uuid(from._internal_batch_uuid());
+  }
+  if (from.has_key()) {
+    _internal_mutable_key()->::hashdb::v1::Fea::MergeFrom(from._internal_key());
+  }
+  if (from.tx_index() != 0) {
+    _internal_set_tx_index(from._internal_tx_index());
+  }
+  if (from.block_index() != 0) {
+    _internal_set_block_index(from._internal_block_index());
+  }
+  if (from.persistence() != 0) {
+    _internal_set_persistence(from._internal_persistence());
   }
 }
 
-void LoadDBRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.LoadDBRequest)
+void SetProgramRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.SetProgramRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void LoadDBRequest::CopyFrom(const LoadDBRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.LoadDBRequest)
+void SetProgramRequest::CopyFrom(const SetProgramRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.SetProgramRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LoadDBRequest::IsInitialized() const {
+bool SetProgramRequest::IsInitialized() const {
   return true;
 }
 
-void LoadDBRequest::InternalSwap(LoadDBRequest* other) {
+void SetProgramRequest::InternalSwap(SetProgramRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  input_db_.Swap(&other->input_db_);
+  data_.Swap(&other->data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(LoadDBRequest, persistent_)
-      + sizeof(LoadDBRequest::persistent_)
-      - PROTOBUF_FIELD_OFFSET(LoadDBRequest, state_root_)>(
-          reinterpret_cast<char*>(&state_root_),
-          reinterpret_cast<char*>(&other->state_root_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata LoadDBRequest::GetMetadata() const {
-  return GetMetadataStatic();
+      PROTOBUF_FIELD_OFFSET(SetProgramRequest, persistence_)
+      + sizeof(SetProgramRequest::persistence_)
+      - PROTOBUF_FIELD_OFFSET(SetProgramRequest, key_)>(
+          reinterpret_cast<char*>(&key_),
+          reinterpret_cast<char*>(&other->key_));
 }
 
-
-// ===================================================================
-
-LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::LoadProgramDBRequest_InputProgramDbEntry_DoNotUse() {}
-LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::LoadProgramDBRequest_InputProgramDbEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : SuperType(arena) {}
-void LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::MergeFrom(const LoadProgramDBRequest_InputProgramDbEntry_DoNotUse& other) {
-  MergeFromInternal(other);
-}
-::PROTOBUF_NAMESPACE_ID::Metadata LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetProgramRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
-void LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::MergeFrom(
-    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
-  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
-}
 
 
 // ===================================================================
 
-void LoadProgramDBRequest::InitAsDefaultInstance() {
+void GetProgramRequest::InitAsDefaultInstance() {
+  ::hashdb::v1::_GetProgramRequest_default_instance_._instance.get_mutable()->key_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
 }
-class LoadProgramDBRequest::_Internal {
+class GetProgramRequest::_Internal {
  public:
+  static const ::hashdb::v1::Fea& key(const GetProgramRequest* msg);
 };
 
-LoadProgramDBRequest::LoadProgramDBRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  input_program_db_(arena) {
+const ::hashdb::v1::Fea&
+GetProgramRequest::_Internal::key(const GetProgramRequest* msg) {
+  return *msg->key_;
+}
+GetProgramRequest::GetProgramRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.LoadProgramDBRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.GetProgramRequest)
 }
-LoadProgramDBRequest::LoadProgramDBRequest(const LoadProgramDBRequest& from)
+GetProgramRequest::GetProgramRequest(const GetProgramRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  input_program_db_.MergeFrom(from.input_program_db_);
-  persistent_ = from.persistent_;
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.LoadProgramDBRequest)
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_batch_uuid().empty()) {
+    batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
+      GetArena());
+  }
+  if (from._internal_has_key()) {
+    key_ = new ::hashdb::v1::Fea(*from.key_);
+  } else {
+    key_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.GetProgramRequest)
 }
 
-void LoadProgramDBRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_LoadProgramDBRequest_hashdb_2eproto.base);
-  persistent_ = false;
+void GetProgramRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetProgramRequest_hashdb_2eproto.base);
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  key_ = nullptr;
 }
 
-LoadProgramDBRequest::~LoadProgramDBRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.LoadProgramDBRequest)
+GetProgramRequest::~GetProgramRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.GetProgramRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void LoadProgramDBRequest::SharedDtor() {
+void GetProgramRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
+  batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete key_;
 }
 
-void LoadProgramDBRequest::ArenaDtor(void* object) {
-  LoadProgramDBRequest* _this = reinterpret_cast< LoadProgramDBRequest* >(object);
+void GetProgramRequest::ArenaDtor(void* object) {
+  GetProgramRequest* _this = reinterpret_cast< GetProgramRequest* >(object);
   (void)_this;
 }
-void LoadProgramDBRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void GetProgramRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void LoadProgramDBRequest::SetCachedSize(int size) const {
+void GetProgramRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const LoadProgramDBRequest& LoadProgramDBRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_LoadProgramDBRequest_hashdb_2eproto.base);
+const GetProgramRequest& GetProgramRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetProgramRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void LoadProgramDBRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.LoadProgramDBRequest)
+void GetProgramRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.GetProgramRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  input_program_db_.Clear();
-  persistent_ = false;
+  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (GetArena() == nullptr && key_ != nullptr) {
+    delete key_;
+  }
+  key_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* LoadProgramDBRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GetProgramRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -3668,22 +3653,19 @@ const char* LoadProgramDBRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAM
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // map<string, bytes> input_program_db = 1;
+      // .hashdb.v1.Fea key = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(&input_program_db_, ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+          ptr = ctx->ParseMessage(_internal_mutable_key(), ptr);
+          CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // bool persistent = 2;
+      // string batch_uuid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          persistent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          auto str = _internal_mutable_batch_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.GetProgramRequest.batch_uuid"));
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -3709,87 +3691,58 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* LoadProgramDBRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* GetProgramRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.LoadProgramDBRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.GetProgramRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // map<string, bytes> input_program_db = 1;
-  if (!this->_internal_input_program_db().empty()) {
-    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_pointer
-        ConstPtr;
-    typedef ConstPtr SortItem;
-    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
-    struct Utf8Check {
-      static void Check(ConstPtr p) {
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-          p->first.data(), static_cast<int>(p->first.length()),
-          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-          "hashdb.v1.LoadProgramDBRequest.InputProgramDbEntry.key");
-      }
-    };
-
-    if (stream->IsSerializationDeterministic() &&
-        this->_internal_input_program_db().size() > 1) {
-      ::std::unique_ptr<SortItem[]> items(
-          new SortItem[this->_internal_input_program_db().size()]);
-      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::size_type size_type;
-      size_type n = 0;
-      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
-          it = this->_internal_input_program_db().begin();
-          it != this->_internal_input_program_db().end(); ++it, ++n) {
-        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
-      for (size_type i = 0; i < n; i++) {
-        target = LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::Funcs::InternalSerialize(1, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
-        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
-      }
-    } else {
-      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
-          it = this->_internal_input_program_db().begin();
-          it != this->_internal_input_program_db().end(); ++it) {
-        target = LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::Funcs::InternalSerialize(1, it->first, it->second, target, stream);
-        Utf8Check::Check(&(*it));
-      }
-    }
+  // .hashdb.v1.Fea key = 1;
+  if (this->has_key()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::key(this), target, stream);
   }
 
-  // bool persistent = 2;
-  if (this->persistent() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_persistent(), target);
+  // string batch_uuid = 2;
+  if (this->batch_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.GetProgramRequest.batch_uuid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_batch_uuid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.LoadProgramDBRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.GetProgramRequest)
   return target;
 }
 
-size_t LoadProgramDBRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.LoadProgramDBRequest)
+size_t GetProgramRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.GetProgramRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // map<string, bytes> input_program_db = 1;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_input_program_db_size());
-  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
-      it = this->_internal_input_program_db().begin();
-      it != this->_internal_input_program_db().end(); ++it) {
-    total_size += LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  // string batch_uuid = 2;
+  if (this->batch_uuid().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_batch_uuid());
   }
 
-  // bool persistent = 2;
-  if (this->persistent() != 0) {
-    total_size += 1 + 1;
+  // .hashdb.v1.Fea key = 1;
+  if (this->has_key()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *key_);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -3801,142 +3754,167 @@ size_t LoadProgramDBRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void LoadProgramDBRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.LoadProgramDBRequest)
+void GetProgramRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.GetProgramRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const LoadProgramDBRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<LoadProgramDBRequest>(
+  const GetProgramRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetProgramRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.LoadProgramDBRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.GetProgramRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.LoadProgramDBRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.GetProgramRequest)
     MergeFrom(*source);
   }
 }
 
-void LoadProgramDBRequest::MergeFrom(const LoadProgramDBRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.LoadProgramDBRequest)
+void GetProgramRequest::MergeFrom(const GetProgramRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.GetProgramRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  input_program_db_.MergeFrom(from.input_program_db_);
-  if (from.persistent() != 0) {
-    _internal_set_persistent(from._internal_persistent());
+  if (from.batch_uuid().size() > 0) {
+    _internal_set_batch_uuid(from._internal_batch_uuid());
+  }
+  if (from.has_key()) {
+    _internal_mutable_key()->::hashdb::v1::Fea::MergeFrom(from._internal_key());
   }
 }
 
-void LoadProgramDBRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.LoadProgramDBRequest)
+void GetProgramRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.GetProgramRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void LoadProgramDBRequest::CopyFrom(const LoadProgramDBRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.LoadProgramDBRequest)
+void GetProgramRequest::CopyFrom(const GetProgramRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.GetProgramRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LoadProgramDBRequest::IsInitialized() const {
+bool GetProgramRequest::IsInitialized() const {
   return true;
 }
 
-void LoadProgramDBRequest::InternalSwap(LoadProgramDBRequest* other) {
+void GetProgramRequest::InternalSwap(GetProgramRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  input_program_db_.Swap(&other->input_program_db_);
-  swap(persistent_, other->persistent_);
+  batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(key_, other->key_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata LoadProgramDBRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata GetProgramRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void FlushRequest::InitAsDefaultInstance() {
+LoadDBRequest_InputDbEntry_DoNotUse::LoadDBRequest_InputDbEntry_DoNotUse() {}
+LoadDBRequest_InputDbEntry_DoNotUse::LoadDBRequest_InputDbEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void LoadDBRequest_InputDbEntry_DoNotUse::MergeFrom(const LoadDBRequest_InputDbEntry_DoNotUse& other) {
+  MergeFromInternal(other);
 }
-class FlushRequest::_Internal {
+::PROTOBUF_NAMESPACE_ID::Metadata LoadDBRequest_InputDbEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void LoadDBRequest_InputDbEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void LoadDBRequest::InitAsDefaultInstance() {
+  ::hashdb::v1::_LoadDBRequest_default_instance_._instance.get_mutable()->state_root_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+}
+class LoadDBRequest::_Internal {
  public:
+  static const ::hashdb::v1::Fea& state_root(const LoadDBRequest* msg);
 };
 
-FlushRequest::FlushRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+const ::hashdb::v1::Fea&
+LoadDBRequest::_Internal::state_root(const LoadDBRequest* msg) {
+  return *msg->state_root_;
+}
+LoadDBRequest::LoadDBRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  input_db_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.FlushRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.LoadDBRequest)
 }
-FlushRequest::FlushRequest(const FlushRequest& from)
+LoadDBRequest::LoadDBRequest(const LoadDBRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_batch_uuid().empty()) {
-    batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
-      GetArena());
-  }
-  new_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_new_state_root().empty()) {
-    new_state_root_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_new_state_root(),
-      GetArena());
+  input_db_.MergeFrom(from.input_db_);
+  if (from._internal_has_state_root()) {
+    state_root_ = new ::hashdb::v1::Fea(*from.state_root_);
+  } else {
+    state_root_ = nullptr;
   }
-  persistence_ = from.persistence_;
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.FlushRequest)
+  persistent_ = from.persistent_;
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.LoadDBRequest)
 }
 
-void FlushRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_FlushRequest_hashdb_2eproto.base);
-  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  new_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  persistence_ = 0;
+void LoadDBRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_LoadDBRequest_hashdb_2eproto.base);
+  ::memset(&state_root_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&persistent_) -
+      reinterpret_cast<char*>(&state_root_)) + sizeof(persistent_));
 }
 
-FlushRequest::~FlushRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.FlushRequest)
+LoadDBRequest::~LoadDBRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.LoadDBRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void FlushRequest::SharedDtor() {
+void LoadDBRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  new_state_root_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete state_root_;
 }
 
-void FlushRequest::ArenaDtor(void* object) {
-  FlushRequest* _this = reinterpret_cast< FlushRequest* >(object);
+void LoadDBRequest::ArenaDtor(void* object) {
+  LoadDBRequest* _this = reinterpret_cast< LoadDBRequest* >(object);
   (void)_this;
 }
-void FlushRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void LoadDBRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void FlushRequest::SetCachedSize(int size) const {
+void LoadDBRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const FlushRequest& FlushRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FlushRequest_hashdb_2eproto.base);
+const LoadDBRequest& LoadDBRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_LoadDBRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void FlushRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.FlushRequest)
+void LoadDBRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.LoadDBRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  new_state_root_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  persistence_ = 0;
+  input_db_.Clear();
+  if (GetArena() == nullptr && state_root_ != nullptr) {
+    delete state_root_;
+  }
+  state_root_ = nullptr;
+  persistent_ = false;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* FlushRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* LoadDBRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -3944,30 +3922,30 @@ const char* FlushRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_I
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // string batch_uuid = 1;
+      // map<string, .hashdb.v1.FeList> input_db = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_batch_uuid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.FlushRequest.batch_uuid"));
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&input_db_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else goto handle_unusual;
         continue;
-      // string new_state_root = 2;
+      // bool persistent = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_new_state_root();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.FlushRequest.new_state_root"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          persistent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // .hashdb.v1.Persistence persistence = 3;
+      // .hashdb.v1.Fea state_root = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_root(), ptr);
           CHK_(ptr);
-          _internal_set_persistence(static_cast<::hashdb::v1::Persistence>(val));
         } else goto handle_unusual;
         continue;
       default: {
@@ -3992,73 +3970,102 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* FlushRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* LoadDBRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.FlushRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.LoadDBRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string batch_uuid = 1;
-  if (this->batch_uuid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.FlushRequest.batch_uuid");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_batch_uuid(), target);
+  // map<string, .hashdb.v1.FeList> input_db = 1;
+  if (!this->_internal_input_db().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "hashdb.v1.LoadDBRequest.InputDbEntry.key");
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_input_db().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_input_db().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
+          it = this->_internal_input_db().begin();
+          it != this->_internal_input_db().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = LoadDBRequest_InputDbEntry_DoNotUse::Funcs::InternalSerialize(1, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
+          it = this->_internal_input_db().begin();
+          it != this->_internal_input_db().end(); ++it) {
+        target = LoadDBRequest_InputDbEntry_DoNotUse::Funcs::InternalSerialize(1, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
   }
 
-  // string new_state_root = 2;
-  if (this->new_state_root().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_new_state_root().data(), static_cast<int>(this->_internal_new_state_root().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.FlushRequest.new_state_root");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_new_state_root(), target);
+  // bool persistent = 2;
+  if (this->persistent() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_persistent(), target);
   }
 
-  // .hashdb.v1.Persistence persistence = 3;
-  if (this->persistence() != 0) {
+  // .hashdb.v1.Fea state_root = 3;
+  if (this->has_state_root()) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      3, this->_internal_persistence(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::state_root(this), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.FlushRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.LoadDBRequest)
   return target;
 }
 
-size_t FlushRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.FlushRequest)
+size_t LoadDBRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.LoadDBRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string batch_uuid = 1;
-  if (this->batch_uuid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_batch_uuid());
+  // map<string, .hashdb.v1.FeList> input_db = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_input_db_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
+      it = this->_internal_input_db().begin();
+      it != this->_internal_input_db().end(); ++it) {
+    total_size += LoadDBRequest_InputDbEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
-  // string new_state_root = 2;
-  if (this->new_state_root().size() > 0) {
+  // .hashdb.v1.Fea state_root = 3;
+  if (this->has_state_root()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_new_state_root());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *state_root_);
   }
 
-  // .hashdb.v1.Persistence persistence = 3;
-  if (this->persistence() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_persistence());
+  // bool persistent = 2;
+  if (this->persistent() != 0) {
+    total_size += 1 + 1;
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -4070,148 +4077,154 @@ size_t FlushRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void FlushRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.FlushRequest)
+void LoadDBRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.LoadDBRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const FlushRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FlushRequest>(
+  const LoadDBRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<LoadDBRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.FlushRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.LoadDBRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.FlushRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.LoadDBRequest)
     MergeFrom(*source);
   }
 }
 
-void FlushRequest::MergeFrom(const FlushRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.FlushRequest)
+void LoadDBRequest::MergeFrom(const LoadDBRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.LoadDBRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.batch_uuid().size() > 0) {
-    _internal_set_batch_uuid(from._internal_batch_uuid());
-  }
-  if (from.new_state_root().size() > 0) {
-    _internal_set_new_state_root(from._internal_new_state_root());
+  input_db_.MergeFrom(from.input_db_);
+  if (from.has_state_root()) {
+    _internal_mutable_state_root()->::hashdb::v1::Fea::MergeFrom(from._internal_state_root());
   }
-  if (from.persistence() != 0) {
-    _internal_set_persistence(from._internal_persistence());
+  if (from.persistent() != 0) {
+    _internal_set_persistent(from._internal_persistent());
   }
 }
 
-void FlushRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.FlushRequest)
+void LoadDBRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.LoadDBRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void FlushRequest::CopyFrom(const FlushRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.FlushRequest)
+void LoadDBRequest::CopyFrom(const LoadDBRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.LoadDBRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool FlushRequest::IsInitialized() const {
+bool LoadDBRequest::IsInitialized() const {
   return true;
 }
 
-void FlushRequest::InternalSwap(FlushRequest* other) {
+void LoadDBRequest::InternalSwap(LoadDBRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  new_state_root_.Swap(&other->new_state_root_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(persistence_, other->persistence_);
+  input_db_.Swap(&other->input_db_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LoadDBRequest, persistent_)
+      + sizeof(LoadDBRequest::persistent_)
+      - PROTOBUF_FIELD_OFFSET(LoadDBRequest, state_root_)>(
+          reinterpret_cast<char*>(&state_root_),
+          reinterpret_cast<char*>(&other->state_root_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata FlushRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata LoadDBRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void FinishTxRequest::InitAsDefaultInstance() {
+LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::LoadProgramDBRequest_InputProgramDbEntry_DoNotUse() {}
+LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::LoadProgramDBRequest_InputProgramDbEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::MergeFrom(const LoadProgramDBRequest_InputProgramDbEntry_DoNotUse& other) {
+  MergeFromInternal(other);
 }
-class FinishTxRequest::_Internal {
+::PROTOBUF_NAMESPACE_ID::Metadata LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void LoadProgramDBRequest::InitAsDefaultInstance() {
+}
+class LoadProgramDBRequest::_Internal {
  public:
 };
 
-FinishTxRequest::FinishTxRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+LoadProgramDBRequest::LoadProgramDBRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  input_program_db_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.FinishTxRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.LoadProgramDBRequest)
 }
-FinishTxRequest::FinishTxRequest(const FinishTxRequest& from)
+LoadProgramDBRequest::LoadProgramDBRequest(const LoadProgramDBRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_batch_uuid().empty()) {
-    batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
-      GetArena());
-  }
-  new_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_new_state_root().empty()) {
-    new_state_root_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_new_state_root(),
-      GetArena());
-  }
-  persistence_ = from.persistence_;
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.FinishTxRequest)
+  input_program_db_.MergeFrom(from.input_program_db_);
+  persistent_ = from.persistent_;
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.LoadProgramDBRequest)
 }
 
-void FinishTxRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_FinishTxRequest_hashdb_2eproto.base);
-  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  new_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  persistence_ = 0;
+void LoadProgramDBRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_LoadProgramDBRequest_hashdb_2eproto.base);
+  persistent_ = false;
 }
 
-FinishTxRequest::~FinishTxRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.FinishTxRequest)
+LoadProgramDBRequest::~LoadProgramDBRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.LoadProgramDBRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void FinishTxRequest::SharedDtor() {
+void LoadProgramDBRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  new_state_root_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void FinishTxRequest::ArenaDtor(void* object) {
-  FinishTxRequest* _this = reinterpret_cast< FinishTxRequest* >(object);
+void LoadProgramDBRequest::ArenaDtor(void* object) {
+  LoadProgramDBRequest* _this = reinterpret_cast< LoadProgramDBRequest* >(object);
   (void)_this;
 }
-void FinishTxRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void LoadProgramDBRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void FinishTxRequest::SetCachedSize(int size) const {
+void LoadProgramDBRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const FinishTxRequest& FinishTxRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FinishTxRequest_hashdb_2eproto.base);
+const LoadProgramDBRequest& LoadProgramDBRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_LoadProgramDBRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void FinishTxRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.FinishTxRequest)
+void LoadProgramDBRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.LoadProgramDBRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  new_state_root_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  persistence_ = 0;
+  input_program_db_.Clear();
+  persistent_ = false;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* FinishTxRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* LoadProgramDBRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -4219,30 +4232,23 @@ const char* FinishTxRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // string batch_uuid = 1;
+      // map<string, bytes> input_program_db = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_batch_uuid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.FinishTxRequest.batch_uuid"));
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&input_program_db_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else goto handle_unusual;
         continue;
-      // string new_state_root = 2;
+      // bool persistent = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_new_state_root();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.FinishTxRequest.new_state_root"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .hashdb.v1.Persistence persistence = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          persistent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          _internal_set_persistence(static_cast<::hashdb::v1::Persistence>(val));
         } else goto handle_unusual;
         continue;
       default: {
@@ -4267,73 +4273,87 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* FinishTxRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* LoadProgramDBRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.FinishTxRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.LoadProgramDBRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string batch_uuid = 1;
-  if (this->batch_uuid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.FinishTxRequest.batch_uuid");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_batch_uuid(), target);
-  }
+  // map<string, bytes> input_program_db = 1;
+  if (!this->_internal_input_program_db().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "hashdb.v1.LoadProgramDBRequest.InputProgramDbEntry.key");
+      }
+    };
 
-  // string new_state_root = 2;
-  if (this->new_state_root().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_new_state_root().data(), static_cast<int>(this->_internal_new_state_root().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.FinishTxRequest.new_state_root");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_new_state_root(), target);
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_input_program_db().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_input_program_db().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+          it = this->_internal_input_program_db().begin();
+          it != this->_internal_input_program_db().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::Funcs::InternalSerialize(1, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+          it = this->_internal_input_program_db().begin();
+          it != this->_internal_input_program_db().end(); ++it) {
+        target = LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::Funcs::InternalSerialize(1, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
   }
 
-  // .hashdb.v1.Persistence persistence = 3;
-  if (this->persistence() != 0) {
+  // bool persistent = 2;
+  if (this->persistent() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      3, this->_internal_persistence(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_persistent(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.FinishTxRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.LoadProgramDBRequest)
   return target;
 }
 
-size_t FinishTxRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.FinishTxRequest)
+size_t LoadProgramDBRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.LoadProgramDBRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string batch_uuid = 1;
-  if (this->batch_uuid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_batch_uuid());
-  }
-
-  // string new_state_root = 2;
-  if (this->new_state_root().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_new_state_root());
+  // map<string, bytes> input_program_db = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_input_program_db_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_input_program_db().begin();
+      it != this->_internal_input_program_db().end(); ++it) {
+    total_size += LoadProgramDBRequest_InputProgramDbEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
-  // .hashdb.v1.Persistence persistence = 3;
-  if (this->persistence() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_persistence());
+  // bool persistent = 2;
+  if (this->persistent() != 0) {
+    total_size += 1 + 1;
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -4345,85 +4365,79 @@ size_t FinishTxRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void FinishTxRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.FinishTxRequest)
+void LoadProgramDBRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.LoadProgramDBRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const FinishTxRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FinishTxRequest>(
+  const LoadProgramDBRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<LoadProgramDBRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.FinishTxRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.LoadProgramDBRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.FinishTxRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.LoadProgramDBRequest)
     MergeFrom(*source);
   }
 }
 
-void FinishTxRequest::MergeFrom(const FinishTxRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.FinishTxRequest)
+void LoadProgramDBRequest::MergeFrom(const LoadProgramDBRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.LoadProgramDBRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.batch_uuid().size() > 0) {
-    _internal_set_batch_uuid(from._internal_batch_uuid());
-  }
-  if (from.new_state_root().size() > 0) {
-    _internal_set_new_state_root(from._internal_new_state_root());
-  }
-  if (from.persistence() != 0) {
-    _internal_set_persistence(from._internal_persistence());
+  input_program_db_.MergeFrom(from.input_program_db_);
+  if (from.persistent() != 0) {
+    _internal_set_persistent(from._internal_persistent());
   }
 }
 
-void FinishTxRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.FinishTxRequest)
+void LoadProgramDBRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.LoadProgramDBRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void FinishTxRequest::CopyFrom(const FinishTxRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.FinishTxRequest)
+void LoadProgramDBRequest::CopyFrom(const LoadProgramDBRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.LoadProgramDBRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool FinishTxRequest::IsInitialized() const {
+bool LoadProgramDBRequest::IsInitialized() const {
   return true;
 }
 
-void FinishTxRequest::InternalSwap(FinishTxRequest* other) {
+void LoadProgramDBRequest::InternalSwap(LoadProgramDBRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  new_state_root_.Swap(&other->new_state_root_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(persistence_, other->persistence_);
+  input_program_db_.Swap(&other->input_program_db_);
+  swap(persistent_, other->persistent_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata FinishTxRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata LoadProgramDBRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void StartBlockRequest::InitAsDefaultInstance() {
+void FlushRequest::InitAsDefaultInstance() {
 }
-class StartBlockRequest::_Internal {
+class FlushRequest::_Internal {
  public:
 };
 
-StartBlockRequest::StartBlockRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+FlushRequest::FlushRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.StartBlockRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.FlushRequest)
 }
-StartBlockRequest::StartBlockRequest(const StartBlockRequest& from)
+FlushRequest::FlushRequest(const FlushRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
@@ -4431,62 +4445,62 @@ StartBlockRequest::StartBlockRequest(const StartBlockRequest& from)
     batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
       GetArena());
   }
-  old_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_old_state_root().empty()) {
-    old_state_root_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_old_state_root(),
+  new_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_new_state_root().empty()) {
+    new_state_root_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_new_state_root(),
       GetArena());
   }
   persistence_ = from.persistence_;
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.StartBlockRequest)
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.FlushRequest)
 }
 
-void StartBlockRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_StartBlockRequest_hashdb_2eproto.base);
+void FlushRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_FlushRequest_hashdb_2eproto.base);
   batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  old_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  new_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   persistence_ = 0;
 }
 
-StartBlockRequest::~StartBlockRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.StartBlockRequest)
+FlushRequest::~FlushRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.FlushRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void StartBlockRequest::SharedDtor() {
+void FlushRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
   batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  old_state_root_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  new_state_root_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void StartBlockRequest::ArenaDtor(void* object) {
-  StartBlockRequest* _this = reinterpret_cast< StartBlockRequest* >(object);
+void FlushRequest::ArenaDtor(void* object) {
+  FlushRequest* _this = reinterpret_cast< FlushRequest* >(object);
   (void)_this;
 }
-void StartBlockRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void FlushRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void StartBlockRequest::SetCachedSize(int size) const {
+void FlushRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const StartBlockRequest& StartBlockRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_StartBlockRequest_hashdb_2eproto.base);
+const FlushRequest& FlushRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FlushRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void StartBlockRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.StartBlockRequest)
+void FlushRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.FlushRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  old_state_root_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  new_state_root_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   persistence_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* StartBlockRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* FlushRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -4499,16 +4513,16 @@ const char* StartBlockRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESP
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
           auto str = _internal_mutable_batch_uuid();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.StartBlockRequest.batch_uuid"));
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.FlushRequest.batch_uuid"));
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // string old_state_root = 2;
+      // string new_state_root = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_old_state_root();
+          auto str = _internal_mutable_new_state_root();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.StartBlockRequest.old_state_root"));
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.FlushRequest.new_state_root"));
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -4542,9 +4556,9 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* StartBlockRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* FlushRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.StartBlockRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.FlushRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4553,19 +4567,19 @@ failure:
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.StartBlockRequest.batch_uuid");
+      "hashdb.v1.FlushRequest.batch_uuid");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_batch_uuid(), target);
   }
 
-  // string old_state_root = 2;
-  if (this->old_state_root().size() > 0) {
+  // string new_state_root = 2;
+  if (this->new_state_root().size() > 0) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_old_state_root().data(), static_cast<int>(this->_internal_old_state_root().length()),
+      this->_internal_new_state_root().data(), static_cast<int>(this->_internal_new_state_root().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.StartBlockRequest.old_state_root");
+      "hashdb.v1.FlushRequest.new_state_root");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_old_state_root(), target);
+        2, this->_internal_new_state_root(), target);
   }
 
   // .hashdb.v1.Persistence persistence = 3;
@@ -4579,12 +4593,12 @@ failure:
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.StartBlockRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.FlushRequest)
   return target;
 }
 
-size_t StartBlockRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.StartBlockRequest)
+size_t FlushRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.FlushRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
@@ -4598,11 +4612,11 @@ size_t StartBlockRequest::ByteSizeLong() const {
         this->_internal_batch_uuid());
   }
 
-  // string old_state_root = 2;
-  if (this->old_state_root().size() > 0) {
+  // string new_state_root = 2;
+  if (this->new_state_root().size() > 0) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_old_state_root());
+        this->_internal_new_state_root());
   }
 
   // .hashdb.v1.Persistence persistence = 3;
@@ -4620,23 +4634,23 @@ size_t StartBlockRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void StartBlockRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.StartBlockRequest)
+void FlushRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.FlushRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const StartBlockRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<StartBlockRequest>(
+  const FlushRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FlushRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.StartBlockRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.FlushRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.StartBlockRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.FlushRequest)
     MergeFrom(*source);
   }
 }
 
-void StartBlockRequest::MergeFrom(const StartBlockRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.StartBlockRequest)
+void FlushRequest::MergeFrom(const FlushRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.FlushRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
@@ -4645,60 +4659,60 @@ void StartBlockRequest::MergeFrom(const StartBlockRequest& from) {
   if (from.batch_uuid().size() > 0) {
     _internal_set_batch_uuid(from._internal_batch_uuid());
   }
-  if (from.old_state_root().size() > 0) {
-    _internal_set_old_state_root(from._internal_old_state_root());
+  if (from.new_state_root().size() > 0) {
+    _internal_set_new_state_root(from._internal_new_state_root());
   }
   if (from.persistence() != 0) {
     _internal_set_persistence(from._internal_persistence());
   }
 }
 
-void StartBlockRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.StartBlockRequest)
+void FlushRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.FlushRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void StartBlockRequest::CopyFrom(const StartBlockRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.StartBlockRequest)
+void FlushRequest::CopyFrom(const FlushRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.FlushRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool StartBlockRequest::IsInitialized() const {
+bool FlushRequest::IsInitialized() const {
   return true;
 }
 
-void StartBlockRequest::InternalSwap(StartBlockRequest* other) {
+void FlushRequest::InternalSwap(FlushRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  old_state_root_.Swap(&other->old_state_root_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  new_state_root_.Swap(&other->new_state_root_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   swap(persistence_, other->persistence_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata StartBlockRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata FlushRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void FinishBlockRequest::InitAsDefaultInstance() {
+void FinishTxRequest::InitAsDefaultInstance() {
 }
-class FinishBlockRequest::_Internal {
+class FinishTxRequest::_Internal {
  public:
 };
 
-FinishBlockRequest::FinishBlockRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+FinishTxRequest::FinishTxRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.FinishBlockRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.FinishTxRequest)
 }
-FinishBlockRequest::FinishBlockRequest(const FinishBlockRequest& from)
+FinishTxRequest::FinishTxRequest(const FinishTxRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
@@ -4712,45 +4726,45 @@ FinishBlockRequest::FinishBlockRequest(const FinishBlockRequest& from)
       GetArena());
   }
   persistence_ = from.persistence_;
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.FinishBlockRequest)
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.FinishTxRequest)
 }
 
-void FinishBlockRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_FinishBlockRequest_hashdb_2eproto.base);
+void FinishTxRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_FinishTxRequest_hashdb_2eproto.base);
   batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   new_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   persistence_ = 0;
 }
 
-FinishBlockRequest::~FinishBlockRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.FinishBlockRequest)
+FinishTxRequest::~FinishTxRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.FinishTxRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void FinishBlockRequest::SharedDtor() {
+void FinishTxRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
   batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   new_state_root_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void FinishBlockRequest::ArenaDtor(void* object) {
-  FinishBlockRequest* _this = reinterpret_cast< FinishBlockRequest* >(object);
+void FinishTxRequest::ArenaDtor(void* object) {
+  FinishTxRequest* _this = reinterpret_cast< FinishTxRequest* >(object);
   (void)_this;
 }
-void FinishBlockRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void FinishTxRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void FinishBlockRequest::SetCachedSize(int size) const {
+void FinishTxRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const FinishBlockRequest& FinishBlockRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FinishBlockRequest_hashdb_2eproto.base);
+const FinishTxRequest& FinishTxRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FinishTxRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void FinishBlockRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.FinishBlockRequest)
+void FinishTxRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.FinishTxRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -4761,7 +4775,7 @@ void FinishBlockRequest::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* FinishBlockRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* FinishTxRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -4774,7 +4788,7 @@ const char* FinishBlockRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMES
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
           auto str = _internal_mutable_batch_uuid();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.FinishBlockRequest.batch_uuid"));
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.FinishTxRequest.batch_uuid"));
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -4783,7 +4797,7 @@ const char* FinishBlockRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMES
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
           auto str = _internal_mutable_new_state_root();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.FinishBlockRequest.new_state_root"));
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.FinishTxRequest.new_state_root"));
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -4817,9 +4831,9 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* FinishBlockRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* FinishTxRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.FinishBlockRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.FinishTxRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4828,7 +4842,7 @@ failure:
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.FinishBlockRequest.batch_uuid");
+      "hashdb.v1.FinishTxRequest.batch_uuid");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_batch_uuid(), target);
   }
@@ -4838,7 +4852,7 @@ failure:
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_new_state_root().data(), static_cast<int>(this->_internal_new_state_root().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.FinishBlockRequest.new_state_root");
+      "hashdb.v1.FinishTxRequest.new_state_root");
     target = stream->WriteStringMaybeAliased(
         2, this->_internal_new_state_root(), target);
   }
@@ -4854,12 +4868,12 @@ failure:
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.FinishBlockRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.FinishTxRequest)
   return target;
 }
 
-size_t FinishBlockRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.FinishBlockRequest)
+size_t FinishTxRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.FinishTxRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
@@ -4895,23 +4909,23 @@ size_t FinishBlockRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void FinishBlockRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.FinishBlockRequest)
+void FinishTxRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.FinishTxRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const FinishBlockRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FinishBlockRequest>(
+  const FinishTxRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FinishTxRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.FinishBlockRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.FinishTxRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.FinishBlockRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.FinishTxRequest)
     MergeFrom(*source);
   }
 }
 
-void FinishBlockRequest::MergeFrom(const FinishBlockRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.FinishBlockRequest)
+void FinishTxRequest::MergeFrom(const FinishTxRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.FinishTxRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
@@ -4928,25 +4942,25 @@ void FinishBlockRequest::MergeFrom(const FinishBlockRequest& from) {
   }
 }
 
-void FinishBlockRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.FinishBlockRequest)
+void FinishTxRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.FinishTxRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void FinishBlockRequest::CopyFrom(const FinishBlockRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.FinishBlockRequest)
+void FinishTxRequest::CopyFrom(const FinishTxRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.FinishTxRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool FinishBlockRequest::IsInitialized() const {
+bool FinishTxRequest::IsInitialized() const {
   return true;
 }
 
-void FinishBlockRequest::InternalSwap(FinishBlockRequest* other) {
+void FinishTxRequest::InternalSwap(FinishTxRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
@@ -4954,72 +4968,89 @@ void FinishBlockRequest::InternalSwap(FinishBlockRequest* other) {
   swap(persistence_, other->persistence_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata FinishBlockRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata FinishTxRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void GetFlushDataRequest::InitAsDefaultInstance() {
+void StartBlockRequest::InitAsDefaultInstance() {
 }
-class GetFlushDataRequest::_Internal {
+class StartBlockRequest::_Internal {
  public:
 };
 
-GetFlushDataRequest::GetFlushDataRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+StartBlockRequest::StartBlockRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.GetFlushDataRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.StartBlockRequest)
 }
-GetFlushDataRequest::GetFlushDataRequest(const GetFlushDataRequest& from)
+StartBlockRequest::StartBlockRequest(const StartBlockRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  flush_id_ = from.flush_id_;
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.GetFlushDataRequest)
-}
-
-void GetFlushDataRequest::SharedCtor() {
-  flush_id_ = PROTOBUF_ULONGLONG(0);
-}
-
-GetFlushDataRequest::~GetFlushDataRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.GetFlushDataRequest)
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_batch_uuid().empty()) {
+    batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
+      GetArena());
+  }
+  old_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_old_state_root().empty()) {
+    old_state_root_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_old_state_root(),
+      GetArena());
+  }
+  persistence_ = from.persistence_;
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.StartBlockRequest)
+}
+
+void StartBlockRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_StartBlockRequest_hashdb_2eproto.base);
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  old_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  persistence_ = 0;
+}
+
+StartBlockRequest::~StartBlockRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.StartBlockRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void GetFlushDataRequest::SharedDtor() {
+void StartBlockRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
+  batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  old_state_root_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void GetFlushDataRequest::ArenaDtor(void* object) {
-  GetFlushDataRequest* _this = reinterpret_cast< GetFlushDataRequest* >(object);
+void StartBlockRequest::ArenaDtor(void* object) {
+  StartBlockRequest* _this = reinterpret_cast< StartBlockRequest* >(object);
   (void)_this;
 }
-void GetFlushDataRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void StartBlockRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void GetFlushDataRequest::SetCachedSize(int size) const {
+void StartBlockRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const GetFlushDataRequest& GetFlushDataRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetFlushDataRequest_hashdb_2eproto.base);
+const StartBlockRequest& StartBlockRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_StartBlockRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void GetFlushDataRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.GetFlushDataRequest)
+void StartBlockRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.StartBlockRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  flush_id_ = PROTOBUF_ULONGLONG(0);
+  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  old_state_root_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  persistence_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetFlushDataRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* StartBlockRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -5027,11 +5058,30 @@ const char* GetFlushDataRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAME
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // uint64 flush_id = 1;
+      // string batch_uuid = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          flush_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_batch_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.StartBlockRequest.batch_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string old_state_root = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          auto str = _internal_mutable_old_state_root();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.StartBlockRequest.old_state_root"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.Persistence persistence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_persistence(static_cast<::hashdb::v1::Persistence>(val));
         } else goto handle_unusual;
         continue;
       default: {
@@ -5056,39 +5106,73 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GetFlushDataRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* StartBlockRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.GetFlushDataRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.StartBlockRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint64 flush_id = 1;
-  if (this->flush_id() != 0) {
+  // string batch_uuid = 1;
+  if (this->batch_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.StartBlockRequest.batch_uuid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_batch_uuid(), target);
+  }
+
+  // string old_state_root = 2;
+  if (this->old_state_root().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_old_state_root().data(), static_cast<int>(this->_internal_old_state_root().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.StartBlockRequest.old_state_root");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_old_state_root(), target);
+  }
+
+  // .hashdb.v1.Persistence persistence = 3;
+  if (this->persistence() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(1, this->_internal_flush_id(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_persistence(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.GetFlushDataRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.StartBlockRequest)
   return target;
 }
 
-size_t GetFlushDataRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.GetFlushDataRequest)
+size_t StartBlockRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.StartBlockRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // uint64 flush_id = 1;
-  if (this->flush_id() != 0) {
+  // string batch_uuid = 1;
+  if (this->batch_uuid().size() > 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->_internal_flush_id());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_batch_uuid());
+  }
+
+  // string old_state_root = 2;
+  if (this->old_state_root().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_old_state_root());
+  }
+
+  // .hashdb.v1.Persistence persistence = 3;
+  if (this->persistence() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_persistence());
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -5100,143 +5184,148 @@ size_t GetFlushDataRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void GetFlushDataRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.GetFlushDataRequest)
+void StartBlockRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.StartBlockRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetFlushDataRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetFlushDataRequest>(
+  const StartBlockRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<StartBlockRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.GetFlushDataRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.StartBlockRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.GetFlushDataRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.StartBlockRequest)
     MergeFrom(*source);
   }
 }
 
-void GetFlushDataRequest::MergeFrom(const GetFlushDataRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.GetFlushDataRequest)
+void StartBlockRequest::MergeFrom(const StartBlockRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.StartBlockRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.flush_id() != 0) {
-    _internal_set_flush_id(from._internal_flush_id());
+  if (from.batch_uuid().size() > 0) {
+    _internal_set_batch_uuid(from._internal_batch_uuid());
+  }
+  if (from.old_state_root().size() > 0) {
+    _internal_set_old_state_root(from._internal_old_state_root());
+  }
+  if (from.persistence() != 0) {
+    _internal_set_persistence(from._internal_persistence());
   }
 }
 
-void GetFlushDataRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.GetFlushDataRequest)
+void StartBlockRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.StartBlockRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetFlushDataRequest::CopyFrom(const GetFlushDataRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.GetFlushDataRequest)
+void StartBlockRequest::CopyFrom(const StartBlockRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.StartBlockRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetFlushDataRequest::IsInitialized() const {
+bool StartBlockRequest::IsInitialized() const {
   return true;
 }
 
-void GetFlushDataRequest::InternalSwap(GetFlushDataRequest* other) {
+void StartBlockRequest::InternalSwap(StartBlockRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(flush_id_, other->flush_id_);
+  batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  old_state_root_.Swap(&other->old_state_root_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(persistence_, other->persistence_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GetFlushDataRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata StartBlockRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void ConsolidateStateRequest::InitAsDefaultInstance() {
-  ::hashdb::v1::_ConsolidateStateRequest_default_instance_._instance.get_mutable()->virtual_state_root_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
+void FinishBlockRequest::InitAsDefaultInstance() {
 }
-class ConsolidateStateRequest::_Internal {
+class FinishBlockRequest::_Internal {
  public:
-  static const ::hashdb::v1::Fea& virtual_state_root(const ConsolidateStateRequest* msg);
 };
 
-const ::hashdb::v1::Fea&
-ConsolidateStateRequest::_Internal::virtual_state_root(const ConsolidateStateRequest* msg) {
-  return *msg->virtual_state_root_;
-}
-ConsolidateStateRequest::ConsolidateStateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+FinishBlockRequest::FinishBlockRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.ConsolidateStateRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.FinishBlockRequest)
 }
-ConsolidateStateRequest::ConsolidateStateRequest(const ConsolidateStateRequest& from)
+FinishBlockRequest::FinishBlockRequest(const FinishBlockRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_virtual_state_root()) {
-    virtual_state_root_ = new ::hashdb::v1::Fea(*from.virtual_state_root_);
-  } else {
-    virtual_state_root_ = nullptr;
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_batch_uuid().empty()) {
+    batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
+      GetArena());
+  }
+  new_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_new_state_root().empty()) {
+    new_state_root_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_new_state_root(),
+      GetArena());
   }
   persistence_ = from.persistence_;
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.ConsolidateStateRequest)
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.FinishBlockRequest)
 }
 
-void ConsolidateStateRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ConsolidateStateRequest_hashdb_2eproto.base);
-  ::memset(&virtual_state_root_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&persistence_) -
-      reinterpret_cast<char*>(&virtual_state_root_)) + sizeof(persistence_));
+void FinishBlockRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_FinishBlockRequest_hashdb_2eproto.base);
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  new_state_root_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  persistence_ = 0;
 }
 
-ConsolidateStateRequest::~ConsolidateStateRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.ConsolidateStateRequest)
+FinishBlockRequest::~FinishBlockRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.FinishBlockRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ConsolidateStateRequest::SharedDtor() {
+void FinishBlockRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete virtual_state_root_;
+  batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  new_state_root_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void ConsolidateStateRequest::ArenaDtor(void* object) {
-  ConsolidateStateRequest* _this = reinterpret_cast< ConsolidateStateRequest* >(object);
+void FinishBlockRequest::ArenaDtor(void* object) {
+  FinishBlockRequest* _this = reinterpret_cast< FinishBlockRequest* >(object);
   (void)_this;
 }
-void ConsolidateStateRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void FinishBlockRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void ConsolidateStateRequest::SetCachedSize(int size) const {
+void FinishBlockRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const ConsolidateStateRequest& ConsolidateStateRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ConsolidateStateRequest_hashdb_2eproto.base);
+const FinishBlockRequest& FinishBlockRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FinishBlockRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void ConsolidateStateRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.ConsolidateStateRequest)
+void FinishBlockRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.FinishBlockRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArena() == nullptr && virtual_state_root_ != nullptr) {
-    delete virtual_state_root_;
-  }
-  virtual_state_root_ = nullptr;
+  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  new_state_root_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   persistence_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ConsolidateStateRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* FinishBlockRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -5244,16 +5333,27 @@ const char* ConsolidateStateRequest::_InternalParse(const char* ptr, ::PROTOBUF_
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // .hashdb.v1.Fea virtual_state_root = 1;
+      // string batch_uuid = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_virtual_state_root(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
+          auto str = _internal_mutable_batch_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.FinishBlockRequest.batch_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
         continue;
-      // .hashdb.v1.Persistence persistence = 2;
+      // string new_state_root = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          auto str = _internal_mutable_new_state_root();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.FinishBlockRequest.new_state_root"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.Persistence persistence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
           ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_persistence(static_cast<::hashdb::v1::Persistence>(val));
@@ -5281,51 +5381,70 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ConsolidateStateRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* FinishBlockRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.ConsolidateStateRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.FinishBlockRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .hashdb.v1.Fea virtual_state_root = 1;
-  if (this->has_virtual_state_root()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::virtual_state_root(this), target, stream);
+  // string batch_uuid = 1;
+  if (this->batch_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.FinishBlockRequest.batch_uuid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_batch_uuid(), target);
   }
 
-  // .hashdb.v1.Persistence persistence = 2;
+  // string new_state_root = 2;
+  if (this->new_state_root().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_new_state_root().data(), static_cast<int>(this->_internal_new_state_root().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.FinishBlockRequest.new_state_root");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_new_state_root(), target);
+  }
+
+  // .hashdb.v1.Persistence persistence = 3;
   if (this->persistence() != 0) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      2, this->_internal_persistence(), target);
+      3, this->_internal_persistence(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.ConsolidateStateRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.FinishBlockRequest)
   return target;
 }
 
-size_t ConsolidateStateRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.ConsolidateStateRequest)
+size_t FinishBlockRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.FinishBlockRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .hashdb.v1.Fea virtual_state_root = 1;
-  if (this->has_virtual_state_root()) {
+  // string batch_uuid = 1;
+  if (this->batch_uuid().size() > 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *virtual_state_root_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_batch_uuid());
   }
 
-  // .hashdb.v1.Persistence persistence = 2;
+  // string new_state_root = 2;
+  if (this->new_state_root().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_new_state_root());
+  }
+
+  // .hashdb.v1.Persistence persistence = 3;
   if (this->persistence() != 0) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_persistence());
@@ -5340,159 +5459,131 @@ size_t ConsolidateStateRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void ConsolidateStateRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.ConsolidateStateRequest)
+void FinishBlockRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.FinishBlockRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const ConsolidateStateRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ConsolidateStateRequest>(
+  const FinishBlockRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FinishBlockRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.ConsolidateStateRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.FinishBlockRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.ConsolidateStateRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.FinishBlockRequest)
     MergeFrom(*source);
   }
 }
 
-void ConsolidateStateRequest::MergeFrom(const ConsolidateStateRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.ConsolidateStateRequest)
+void FinishBlockRequest::MergeFrom(const FinishBlockRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.FinishBlockRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_virtual_state_root()) {
-    _internal_mutable_virtual_state_root()->::hashdb::v1::Fea::MergeFrom(from._internal_virtual_state_root());
+  if (from.batch_uuid().size() > 0) {
+    _internal_set_batch_uuid(from._internal_batch_uuid());
+  }
+  if (from.new_state_root().size() > 0) {
+    _internal_set_new_state_root(from._internal_new_state_root());
   }
   if (from.persistence() != 0) {
     _internal_set_persistence(from._internal_persistence());
   }
 }
 
-void ConsolidateStateRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.ConsolidateStateRequest)
+void FinishBlockRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.FinishBlockRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ConsolidateStateRequest::CopyFrom(const ConsolidateStateRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.ConsolidateStateRequest)
+void FinishBlockRequest::CopyFrom(const FinishBlockRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.FinishBlockRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ConsolidateStateRequest::IsInitialized() const {
+bool FinishBlockRequest::IsInitialized() const {
   return true;
 }
 
-void ConsolidateStateRequest::InternalSwap(ConsolidateStateRequest* other) {
+void FinishBlockRequest::InternalSwap(FinishBlockRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ConsolidateStateRequest, persistence_)
-      + sizeof(ConsolidateStateRequest::persistence_)
-      - PROTOBUF_FIELD_OFFSET(ConsolidateStateRequest, virtual_state_root_)>(
-          reinterpret_cast<char*>(&virtual_state_root_),
-          reinterpret_cast<char*>(&other->virtual_state_root_));
+  batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  new_state_root_.Swap(&other->new_state_root_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  swap(persistence_, other->persistence_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ConsolidateStateRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata FinishBlockRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void PurgeRequest::InitAsDefaultInstance() {
-  ::hashdb::v1::_PurgeRequest_default_instance_._instance.get_mutable()->new_state_root_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
+void GetFlushDataRequest::InitAsDefaultInstance() {
 }
-class PurgeRequest::_Internal {
+class GetFlushDataRequest::_Internal {
  public:
-  static const ::hashdb::v1::Fea& new_state_root(const PurgeRequest* msg);
 };
 
-const ::hashdb::v1::Fea&
-PurgeRequest::_Internal::new_state_root(const PurgeRequest* msg) {
-  return *msg->new_state_root_;
-}
-PurgeRequest::PurgeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+GetFlushDataRequest::GetFlushDataRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.PurgeRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.GetFlushDataRequest)
 }
-PurgeRequest::PurgeRequest(const PurgeRequest& from)
+GetFlushDataRequest::GetFlushDataRequest(const GetFlushDataRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_batch_uuid().empty()) {
-    batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
-      GetArena());
-  }
-  if (from._internal_has_new_state_root()) {
-    new_state_root_ = new ::hashdb::v1::Fea(*from.new_state_root_);
-  } else {
-    new_state_root_ = nullptr;
-  }
-  persistence_ = from.persistence_;
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.PurgeRequest)
+  flush_id_ = from.flush_id_;
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.GetFlushDataRequest)
 }
 
-void PurgeRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_PurgeRequest_hashdb_2eproto.base);
-  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&new_state_root_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&persistence_) -
-      reinterpret_cast<char*>(&new_state_root_)) + sizeof(persistence_));
+void GetFlushDataRequest::SharedCtor() {
+  flush_id_ = PROTOBUF_ULONGLONG(0);
 }
 
-PurgeRequest::~PurgeRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.PurgeRequest)
+GetFlushDataRequest::~GetFlushDataRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.GetFlushDataRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void PurgeRequest::SharedDtor() {
+void GetFlushDataRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete new_state_root_;
 }
 
-void PurgeRequest::ArenaDtor(void* object) {
-  PurgeRequest* _this = reinterpret_cast< PurgeRequest* >(object);
+void GetFlushDataRequest::ArenaDtor(void* object) {
+  GetFlushDataRequest* _this = reinterpret_cast< GetFlushDataRequest* >(object);
   (void)_this;
 }
-void PurgeRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void GetFlushDataRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void PurgeRequest::SetCachedSize(int size) const {
+void GetFlushDataRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const PurgeRequest& PurgeRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PurgeRequest_hashdb_2eproto.base);
+const GetFlushDataRequest& GetFlushDataRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetFlushDataRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void PurgeRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.PurgeRequest)
+void GetFlushDataRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.GetFlushDataRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  if (GetArena() == nullptr && new_state_root_ != nullptr) {
-    delete new_state_root_;
-  }
-  new_state_root_ = nullptr;
-  persistence_ = 0;
+  flush_id_ = PROTOBUF_ULONGLONG(0);
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* PurgeRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GetFlushDataRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -5500,28 +5591,11 @@ const char* PurgeRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_I
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // string batch_uuid = 1;
+      // uint64 flush_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_batch_uuid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.PurgeRequest.batch_uuid"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .hashdb.v1.Fea new_state_root = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_new_state_root(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .hashdb.v1.Persistence persistence = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          flush_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          _internal_set_persistence(static_cast<::hashdb::v1::Persistence>(val));
         } else goto handle_unusual;
         continue;
       default: {
@@ -5546,71 +5620,39 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* PurgeRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* GetFlushDataRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.PurgeRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.GetFlushDataRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string batch_uuid = 1;
-  if (this->batch_uuid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.PurgeRequest.batch_uuid");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_batch_uuid(), target);
-  }
-
-  // .hashdb.v1.Fea new_state_root = 2;
-  if (this->has_new_state_root()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::new_state_root(this), target, stream);
-  }
-
-  // .hashdb.v1.Persistence persistence = 3;
-  if (this->persistence() != 0) {
+  // uint64 flush_id = 1;
+  if (this->flush_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      3, this->_internal_persistence(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(1, this->_internal_flush_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.PurgeRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.GetFlushDataRequest)
   return target;
 }
 
-size_t PurgeRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.PurgeRequest)
+size_t GetFlushDataRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.GetFlushDataRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string batch_uuid = 1;
-  if (this->batch_uuid().size() > 0) {
+  // uint64 flush_id = 1;
+  if (this->flush_id() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_batch_uuid());
-  }
-
-  // .hashdb.v1.Fea new_state_root = 2;
-  if (this->has_new_state_root()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *new_state_root_);
-  }
-
-  // .hashdb.v1.Persistence persistence = 3;
-  if (this->persistence() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_persistence());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_flush_id());
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -5622,154 +5664,143 @@ size_t PurgeRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void PurgeRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.PurgeRequest)
+void GetFlushDataRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.GetFlushDataRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const PurgeRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PurgeRequest>(
+  const GetFlushDataRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetFlushDataRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.PurgeRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.GetFlushDataRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.PurgeRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.GetFlushDataRequest)
     MergeFrom(*source);
   }
 }
 
-void PurgeRequest::MergeFrom(const PurgeRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.PurgeRequest)
+void GetFlushDataRequest::MergeFrom(const GetFlushDataRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.GetFlushDataRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.batch_uuid().size() > 0) {
-    _internal_set_batch_uuid(from._internal_batch_uuid());
-  }
-  if (from.has_new_state_root()) {
-    _internal_mutable_new_state_root()->::hashdb::v1::Fea::MergeFrom(from._internal_new_state_root());
-  }
-  if (from.persistence() != 0) {
-    _internal_set_persistence(from._internal_persistence());
+  if (from.flush_id() != 0) {
+    _internal_set_flush_id(from._internal_flush_id());
   }
 }
 
-void PurgeRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.PurgeRequest)
+void GetFlushDataRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.GetFlushDataRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void PurgeRequest::CopyFrom(const PurgeRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.PurgeRequest)
+void GetFlushDataRequest::CopyFrom(const GetFlushDataRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.GetFlushDataRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PurgeRequest::IsInitialized() const {
+bool GetFlushDataRequest::IsInitialized() const {
   return true;
 }
 
-void PurgeRequest::InternalSwap(PurgeRequest* other) {
+void GetFlushDataRequest::InternalSwap(GetFlushDataRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(PurgeRequest, persistence_)
-      + sizeof(PurgeRequest::persistence_)
-      - PROTOBUF_FIELD_OFFSET(PurgeRequest, new_state_root_)>(
-          reinterpret_cast<char*>(&new_state_root_),
-          reinterpret_cast<char*>(&other->new_state_root_));
+  swap(flush_id_, other->flush_id_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata PurgeRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata GetFlushDataRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void ReadTreeRequest::InitAsDefaultInstance() {
-  ::hashdb::v1::_ReadTreeRequest_default_instance_._instance.get_mutable()->state_root_ = const_cast< ::hashdb::v1::Fea*>(
+void ConsolidateStateRequest::InitAsDefaultInstance() {
+  ::hashdb::v1::_ConsolidateStateRequest_default_instance_._instance.get_mutable()->virtual_state_root_ = const_cast< ::hashdb::v1::Fea*>(
       ::hashdb::v1::Fea::internal_default_instance());
 }
-class ReadTreeRequest::_Internal {
+class ConsolidateStateRequest::_Internal {
  public:
-  static const ::hashdb::v1::Fea& state_root(const ReadTreeRequest* msg);
+  static const ::hashdb::v1::Fea& virtual_state_root(const ConsolidateStateRequest* msg);
 };
 
 const ::hashdb::v1::Fea&
-ReadTreeRequest::_Internal::state_root(const ReadTreeRequest* msg) {
-  return *msg->state_root_;
+ConsolidateStateRequest::_Internal::virtual_state_root(const ConsolidateStateRequest* msg) {
+  return *msg->virtual_state_root_;
 }
-ReadTreeRequest::ReadTreeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  keys_(arena) {
+ConsolidateStateRequest::ConsolidateStateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.ReadTreeRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.ConsolidateStateRequest)
 }
-ReadTreeRequest::ReadTreeRequest(const ReadTreeRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      keys_(from.keys_) {
+ConsolidateStateRequest::ConsolidateStateRequest(const ConsolidateStateRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_state_root()) {
-    state_root_ = new ::hashdb::v1::Fea(*from.state_root_);
+  if (from._internal_has_virtual_state_root()) {
+    virtual_state_root_ = new ::hashdb::v1::Fea(*from.virtual_state_root_);
   } else {
-    state_root_ = nullptr;
+    virtual_state_root_ = nullptr;
   }
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.ReadTreeRequest)
+  persistence_ = from.persistence_;
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.ConsolidateStateRequest)
 }
 
-void ReadTreeRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ReadTreeRequest_hashdb_2eproto.base);
-  state_root_ = nullptr;
+void ConsolidateStateRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ConsolidateStateRequest_hashdb_2eproto.base);
+  ::memset(&virtual_state_root_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&persistence_) -
+      reinterpret_cast<char*>(&virtual_state_root_)) + sizeof(persistence_));
 }
 
-ReadTreeRequest::~ReadTreeRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.ReadTreeRequest)
+ConsolidateStateRequest::~ConsolidateStateRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.ConsolidateStateRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ReadTreeRequest::SharedDtor() {
+void ConsolidateStateRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete state_root_;
+  if (this != internal_default_instance()) delete virtual_state_root_;
 }
 
-void ReadTreeRequest::ArenaDtor(void* object) {
-  ReadTreeRequest* _this = reinterpret_cast< ReadTreeRequest* >(object);
+void ConsolidateStateRequest::ArenaDtor(void* object) {
+  ConsolidateStateRequest* _this = reinterpret_cast< ConsolidateStateRequest* >(object);
   (void)_this;
 }
-void ReadTreeRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void ConsolidateStateRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void ReadTreeRequest::SetCachedSize(int size) const {
+void ConsolidateStateRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const ReadTreeRequest& ReadTreeRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ReadTreeRequest_hashdb_2eproto.base);
+const ConsolidateStateRequest& ConsolidateStateRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ConsolidateStateRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void ReadTreeRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.ReadTreeRequest)
+void ConsolidateStateRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.ConsolidateStateRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  keys_.Clear();
-  if (GetArena() == nullptr && state_root_ != nullptr) {
-    delete state_root_;
+  if (GetArena() == nullptr && virtual_state_root_ != nullptr) {
+    delete virtual_state_root_;
   }
-  state_root_ = nullptr;
+  virtual_state_root_ = nullptr;
+  persistence_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ReadTreeRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ConsolidateStateRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -5777,23 +5808,19 @@ const char* ReadTreeRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // .hashdb.v1.Fea state_root = 1;
+      // .hashdb.v1.Fea virtual_state_root = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_state_root(), ptr);
+          ptr = ctx->ParseMessage(_internal_mutable_virtual_state_root(), ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // repeated .hashdb.v1.Fea keys = 2;
+      // .hashdb.v1.Persistence persistence = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_keys(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_persistence(static_cast<::hashdb::v1::Persistence>(val));
         } else goto handle_unusual;
         continue;
       default: {
@@ -5818,56 +5845,54 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ReadTreeRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* ConsolidateStateRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.ReadTreeRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.ConsolidateStateRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .hashdb.v1.Fea state_root = 1;
-  if (this->has_state_root()) {
+  // .hashdb.v1.Fea virtual_state_root = 1;
+  if (this->has_virtual_state_root()) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
       InternalWriteMessage(
-        1, _Internal::state_root(this), target, stream);
+        1, _Internal::virtual_state_root(this), target, stream);
   }
 
-  // repeated .hashdb.v1.Fea keys = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_keys_size()); i < n; i++) {
+  // .hashdb.v1.Persistence persistence = 2;
+  if (this->persistence() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_keys(i), target, stream);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_persistence(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.ReadTreeRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.ConsolidateStateRequest)
   return target;
 }
 
-size_t ReadTreeRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.ReadTreeRequest)
+size_t ConsolidateStateRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.ConsolidateStateRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .hashdb.v1.Fea keys = 2;
-  total_size += 1UL * this->_internal_keys_size();
-  for (const auto& msg : this->keys_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // .hashdb.v1.Fea virtual_state_root = 1;
+  if (this->has_virtual_state_root()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *virtual_state_root_);
   }
 
-  // .hashdb.v1.Fea state_root = 1;
-  if (this->has_state_root()) {
+  // .hashdb.v1.Persistence persistence = 2;
+  if (this->persistence() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *state_root_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_persistence());
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -5879,79 +5904,92 @@ size_t ReadTreeRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void ReadTreeRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.ReadTreeRequest)
+void ConsolidateStateRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.ConsolidateStateRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const ReadTreeRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ReadTreeRequest>(
+  const ConsolidateStateRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ConsolidateStateRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.ReadTreeRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.ConsolidateStateRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.ReadTreeRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.ConsolidateStateRequest)
     MergeFrom(*source);
   }
 }
 
-void ReadTreeRequest::MergeFrom(const ReadTreeRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.ReadTreeRequest)
+void ConsolidateStateRequest::MergeFrom(const ConsolidateStateRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.ConsolidateStateRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  keys_.MergeFrom(from.keys_);
-  if (from.has_state_root()) {
-    _internal_mutable_state_root()->::hashdb::v1::Fea::MergeFrom(from._internal_state_root());
+  if (from.has_virtual_state_root()) {
+    _internal_mutable_virtual_state_root()->::hashdb::v1::Fea::MergeFrom(from._internal_virtual_state_root());
+  }
+  if (from.persistence() != 0) {
+    _internal_set_persistence(from._internal_persistence());
   }
 }
 
-void ReadTreeRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.ReadTreeRequest)
+void ConsolidateStateRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.ConsolidateStateRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ReadTreeRequest::CopyFrom(const ReadTreeRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.ReadTreeRequest)
+void ConsolidateStateRequest::CopyFrom(const ConsolidateStateRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.ConsolidateStateRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReadTreeRequest::IsInitialized() const {
+bool ConsolidateStateRequest::IsInitialized() const {
   return true;
 }
 
-void ReadTreeRequest::InternalSwap(ReadTreeRequest* other) {
+void ConsolidateStateRequest::InternalSwap(ConsolidateStateRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  keys_.InternalSwap(&other->keys_);
-  swap(state_root_, other->state_root_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConsolidateStateRequest, persistence_)
+      + sizeof(ConsolidateStateRequest::persistence_)
+      - PROTOBUF_FIELD_OFFSET(ConsolidateStateRequest, virtual_state_root_)>(
+          reinterpret_cast<char*>(&virtual_state_root_),
+          reinterpret_cast<char*>(&other->virtual_state_root_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ReadTreeRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ConsolidateStateRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void CancelBatchRequest::InitAsDefaultInstance() {
+void PurgeRequest::InitAsDefaultInstance() {
+  ::hashdb::v1::_PurgeRequest_default_instance_._instance.get_mutable()->new_state_root_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
 }
-class CancelBatchRequest::_Internal {
+class PurgeRequest::_Internal {
  public:
+  static const ::hashdb::v1::Fea& new_state_root(const PurgeRequest* msg);
 };
 
-CancelBatchRequest::CancelBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+const ::hashdb::v1::Fea&
+PurgeRequest::_Internal::new_state_root(const PurgeRequest* msg) {
+  return *msg->new_state_root_;
+}
+PurgeRequest::PurgeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.CancelBatchRequest)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.PurgeRequest)
 }
-CancelBatchRequest::CancelBatchRequest(const CancelBatchRequest& from)
+PurgeRequest::PurgeRequest(const PurgeRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
@@ -5959,51 +5997,66 @@ CancelBatchRequest::CancelBatchRequest(const CancelBatchRequest& from)
     batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
       GetArena());
   }
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.CancelBatchRequest)
+  if (from._internal_has_new_state_root()) {
+    new_state_root_ = new ::hashdb::v1::Fea(*from.new_state_root_);
+  } else {
+    new_state_root_ = nullptr;
+  }
+  persistence_ = from.persistence_;
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.PurgeRequest)
 }
 
-void CancelBatchRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_CancelBatchRequest_hashdb_2eproto.base);
+void PurgeRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_PurgeRequest_hashdb_2eproto.base);
   batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&new_state_root_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&persistence_) -
+      reinterpret_cast<char*>(&new_state_root_)) + sizeof(persistence_));
 }
 
-CancelBatchRequest::~CancelBatchRequest() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.CancelBatchRequest)
+PurgeRequest::~PurgeRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.PurgeRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CancelBatchRequest::SharedDtor() {
+void PurgeRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
   batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete new_state_root_;
 }
 
-void CancelBatchRequest::ArenaDtor(void* object) {
-  CancelBatchRequest* _this = reinterpret_cast< CancelBatchRequest* >(object);
+void PurgeRequest::ArenaDtor(void* object) {
+  PurgeRequest* _this = reinterpret_cast< PurgeRequest* >(object);
   (void)_this;
 }
-void CancelBatchRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void PurgeRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void CancelBatchRequest::SetCachedSize(int size) const {
+void PurgeRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const CancelBatchRequest& CancelBatchRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_CancelBatchRequest_hashdb_2eproto.base);
+const PurgeRequest& PurgeRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PurgeRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void CancelBatchRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.CancelBatchRequest)
+void PurgeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.PurgeRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (GetArena() == nullptr && new_state_root_ != nullptr) {
+    delete new_state_root_;
+  }
+  new_state_root_ = nullptr;
+  persistence_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* CancelBatchRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* PurgeRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -6016,8 +6069,23 @@ const char* CancelBatchRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMES
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
           auto str = _internal_mutable_batch_uuid();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.CancelBatchRequest.batch_uuid"));
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.PurgeRequest.batch_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.Fea new_state_root = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_new_state_root(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.Persistence persistence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_persistence(static_cast<::hashdb::v1::Persistence>(val));
         } else goto handle_unusual;
         continue;
       default: {
@@ -6042,9 +6110,9 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* CancelBatchRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* PurgeRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.CancelBatchRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.PurgeRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -6053,21 +6121,36 @@ failure:
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.CancelBatchRequest.batch_uuid");
+      "hashdb.v1.PurgeRequest.batch_uuid");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_batch_uuid(), target);
   }
 
+  // .hashdb.v1.Fea new_state_root = 2;
+  if (this->has_new_state_root()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::new_state_root(this), target, stream);
+  }
+
+  // .hashdb.v1.Persistence persistence = 3;
+  if (this->persistence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_persistence(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.CancelBatchRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.PurgeRequest)
   return target;
 }
 
-size_t CancelBatchRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.CancelBatchRequest)
+size_t PurgeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.PurgeRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
@@ -6081,6 +6164,19 @@ size_t CancelBatchRequest::ByteSizeLong() const {
         this->_internal_batch_uuid());
   }
 
+  // .hashdb.v1.Fea new_state_root = 2;
+  if (this->has_new_state_root()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *new_state_root_);
+  }
+
+  // .hashdb.v1.Persistence persistence = 3;
+  if (this->persistence() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_persistence());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -6090,23 +6186,23 @@ size_t CancelBatchRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void CancelBatchRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.CancelBatchRequest)
+void PurgeRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.PurgeRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const CancelBatchRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CancelBatchRequest>(
+  const PurgeRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PurgeRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.CancelBatchRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.PurgeRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.CancelBatchRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.PurgeRequest)
     MergeFrom(*source);
   }
 }
 
-void CancelBatchRequest::MergeFrom(const CancelBatchRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.CancelBatchRequest)
+void PurgeRequest::MergeFrom(const PurgeRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.PurgeRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
@@ -6115,133 +6211,129 @@ void CancelBatchRequest::MergeFrom(const CancelBatchRequest& from) {
   if (from.batch_uuid().size() > 0) {
     _internal_set_batch_uuid(from._internal_batch_uuid());
   }
+  if (from.has_new_state_root()) {
+    _internal_mutable_new_state_root()->::hashdb::v1::Fea::MergeFrom(from._internal_new_state_root());
+  }
+  if (from.persistence() != 0) {
+    _internal_set_persistence(from._internal_persistence());
+  }
 }
 
-void CancelBatchRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.CancelBatchRequest)
+void PurgeRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.PurgeRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CancelBatchRequest::CopyFrom(const CancelBatchRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.CancelBatchRequest)
+void PurgeRequest::CopyFrom(const PurgeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.PurgeRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CancelBatchRequest::IsInitialized() const {
+bool PurgeRequest::IsInitialized() const {
   return true;
 }
 
-void CancelBatchRequest::InternalSwap(CancelBatchRequest* other) {
+void PurgeRequest::InternalSwap(PurgeRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PurgeRequest, persistence_)
+      + sizeof(PurgeRequest::persistence_)
+      - PROTOBUF_FIELD_OFFSET(PurgeRequest, new_state_root_)>(
+          reinterpret_cast<char*>(&new_state_root_),
+          reinterpret_cast<char*>(&other->new_state_root_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata CancelBatchRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata PurgeRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void GetLatestStateRootResponse::InitAsDefaultInstance() {
-  ::hashdb::v1::_GetLatestStateRootResponse_default_instance_._instance.get_mutable()->latest_root_ = const_cast< ::hashdb::v1::Fea*>(
+void ReadTreeRequest::InitAsDefaultInstance() {
+  ::hashdb::v1::_ReadTreeRequest_default_instance_._instance.get_mutable()->state_root_ = const_cast< ::hashdb::v1::Fea*>(
       ::hashdb::v1::Fea::internal_default_instance());
-  ::hashdb::v1::_GetLatestStateRootResponse_default_instance_._instance.get_mutable()->result_ = const_cast< ::hashdb::v1::ResultCode*>(
-      ::hashdb::v1::ResultCode::internal_default_instance());
 }
-class GetLatestStateRootResponse::_Internal {
+class ReadTreeRequest::_Internal {
  public:
-  static const ::hashdb::v1::Fea& latest_root(const GetLatestStateRootResponse* msg);
-  static const ::hashdb::v1::ResultCode& result(const GetLatestStateRootResponse* msg);
+  static const ::hashdb::v1::Fea& state_root(const ReadTreeRequest* msg);
 };
 
 const ::hashdb::v1::Fea&
-GetLatestStateRootResponse::_Internal::latest_root(const GetLatestStateRootResponse* msg) {
-  return *msg->latest_root_;
-}
-const ::hashdb::v1::ResultCode&
-GetLatestStateRootResponse::_Internal::result(const GetLatestStateRootResponse* msg) {
-  return *msg->result_;
+ReadTreeRequest::_Internal::state_root(const ReadTreeRequest* msg) {
+  return *msg->state_root_;
 }
-GetLatestStateRootResponse::GetLatestStateRootResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+ReadTreeRequest::ReadTreeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  keys_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.GetLatestStateRootResponse)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.ReadTreeRequest)
 }
-GetLatestStateRootResponse::GetLatestStateRootResponse(const GetLatestStateRootResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+ReadTreeRequest::ReadTreeRequest(const ReadTreeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      keys_(from.keys_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_latest_root()) {
-    latest_root_ = new ::hashdb::v1::Fea(*from.latest_root_);
-  } else {
-    latest_root_ = nullptr;
-  }
-  if (from._internal_has_result()) {
-    result_ = new ::hashdb::v1::ResultCode(*from.result_);
+  if (from._internal_has_state_root()) {
+    state_root_ = new ::hashdb::v1::Fea(*from.state_root_);
   } else {
-    result_ = nullptr;
+    state_root_ = nullptr;
   }
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.GetLatestStateRootResponse)
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.ReadTreeRequest)
 }
 
-void GetLatestStateRootResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetLatestStateRootResponse_hashdb_2eproto.base);
-  ::memset(&latest_root_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&result_) -
-      reinterpret_cast<char*>(&latest_root_)) + sizeof(result_));
+void ReadTreeRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ReadTreeRequest_hashdb_2eproto.base);
+  state_root_ = nullptr;
 }
 
-GetLatestStateRootResponse::~GetLatestStateRootResponse() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.GetLatestStateRootResponse)
+ReadTreeRequest::~ReadTreeRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.ReadTreeRequest)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void GetLatestStateRootResponse::SharedDtor() {
+void ReadTreeRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete latest_root_;
-  if (this != internal_default_instance()) delete result_;
+  if (this != internal_default_instance()) delete state_root_;
 }
 
-void GetLatestStateRootResponse::ArenaDtor(void* object) {
-  GetLatestStateRootResponse* _this = reinterpret_cast< GetLatestStateRootResponse* >(object);
+void ReadTreeRequest::ArenaDtor(void* object) {
+  ReadTreeRequest* _this = reinterpret_cast< ReadTreeRequest* >(object);
   (void)_this;
 }
-void GetLatestStateRootResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void ReadTreeRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void GetLatestStateRootResponse::SetCachedSize(int size) const {
+void ReadTreeRequest::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const GetLatestStateRootResponse& GetLatestStateRootResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetLatestStateRootResponse_hashdb_2eproto.base);
+const ReadTreeRequest& ReadTreeRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ReadTreeRequest_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void GetLatestStateRootResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.GetLatestStateRootResponse)
+void ReadTreeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.ReadTreeRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArena() == nullptr && latest_root_ != nullptr) {
-    delete latest_root_;
-  }
-  latest_root_ = nullptr;
-  if (GetArena() == nullptr && result_ != nullptr) {
-    delete result_;
+  keys_.Clear();
+  if (GetArena() == nullptr && state_root_ != nullptr) {
+    delete state_root_;
   }
-  result_ = nullptr;
+  state_root_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetLatestStateRootResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ReadTreeRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -6249,18 +6341,23 @@ const char* GetLatestStateRootResponse::_InternalParse(const char* ptr, ::PROTOB
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // .hashdb.v1.Fea latest_root = 1;
+      // .hashdb.v1.Fea state_root = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_latest_root(), ptr);
+          ptr = ctx->ParseMessage(_internal_mutable_state_root(), ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // .hashdb.v1.ResultCode result = 2;
+      // repeated .hashdb.v1.Fea keys = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_keys(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
         } else goto handle_unusual;
         continue;
       default: {
@@ -6285,56 +6382,56 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GetLatestStateRootResponse::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* ReadTreeRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.GetLatestStateRootResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.ReadTreeRequest)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .hashdb.v1.Fea latest_root = 1;
-  if (this->has_latest_root()) {
+  // .hashdb.v1.Fea state_root = 1;
+  if (this->has_state_root()) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
       InternalWriteMessage(
-        1, _Internal::latest_root(this), target, stream);
+        1, _Internal::state_root(this), target, stream);
   }
 
-  // .hashdb.v1.ResultCode result = 2;
-  if (this->has_result()) {
+  // repeated .hashdb.v1.Fea keys = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_keys_size()); i < n; i++) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::result(this), target, stream);
+      InternalWriteMessage(2, this->_internal_keys(i), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.GetLatestStateRootResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.ReadTreeRequest)
   return target;
 }
 
-size_t GetLatestStateRootResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.GetLatestStateRootResponse)
+size_t ReadTreeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.ReadTreeRequest)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .hashdb.v1.Fea latest_root = 1;
-  if (this->has_latest_root()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *latest_root_);
+  // repeated .hashdb.v1.Fea keys = 2;
+  total_size += 1UL * this->_internal_keys_size();
+  for (const auto& msg : this->keys_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // .hashdb.v1.ResultCode result = 2;
-  if (this->has_result()) {
+  // .hashdb.v1.Fea state_root = 1;
+  if (this->has_state_root()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *result_);
+        *state_root_);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -6346,170 +6443,1450 @@ size_t GetLatestStateRootResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void GetLatestStateRootResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.GetLatestStateRootResponse)
+void ReadTreeRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.ReadTreeRequest)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetLatestStateRootResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetLatestStateRootResponse>(
+  const ReadTreeRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ReadTreeRequest>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.GetLatestStateRootResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.ReadTreeRequest)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.GetLatestStateRootResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.ReadTreeRequest)
     MergeFrom(*source);
   }
 }
 
-void GetLatestStateRootResponse::MergeFrom(const GetLatestStateRootResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.GetLatestStateRootResponse)
+void ReadTreeRequest::MergeFrom(const ReadTreeRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.ReadTreeRequest)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_latest_root()) {
-    _internal_mutable_latest_root()->::hashdb::v1::Fea::MergeFrom(from._internal_latest_root());
-  }
-  if (from.has_result()) {
-    _internal_mutable_result()->::hashdb::v1::ResultCode::MergeFrom(from._internal_result());
+  keys_.MergeFrom(from.keys_);
+  if (from.has_state_root()) {
+    _internal_mutable_state_root()->::hashdb::v1::Fea::MergeFrom(from._internal_state_root());
   }
 }
 
-void GetLatestStateRootResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.GetLatestStateRootResponse)
+void ReadTreeRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.ReadTreeRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetLatestStateRootResponse::CopyFrom(const GetLatestStateRootResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.GetLatestStateRootResponse)
+void ReadTreeRequest::CopyFrom(const ReadTreeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.ReadTreeRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetLatestStateRootResponse::IsInitialized() const {
+bool ReadTreeRequest::IsInitialized() const {
   return true;
 }
 
-void GetLatestStateRootResponse::InternalSwap(GetLatestStateRootResponse* other) {
+void ReadTreeRequest::InternalSwap(ReadTreeRequest* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetLatestStateRootResponse, result_)
-      + sizeof(GetLatestStateRootResponse::result_)
-      - PROTOBUF_FIELD_OFFSET(GetLatestStateRootResponse, latest_root_)>(
-          reinterpret_cast<char*>(&latest_root_),
-          reinterpret_cast<char*>(&other->latest_root_));
+  keys_.InternalSwap(&other->keys_);
+  swap(state_root_, other->state_root_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GetLatestStateRootResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ReadTreeRequest::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-SetResponse_SiblingsEntry_DoNotUse::SetResponse_SiblingsEntry_DoNotUse() {}
-SetResponse_SiblingsEntry_DoNotUse::SetResponse_SiblingsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : SuperType(arena) {}
-void SetResponse_SiblingsEntry_DoNotUse::MergeFrom(const SetResponse_SiblingsEntry_DoNotUse& other) {
-  MergeFromInternal(other);
+void CancelBatchRequest::InitAsDefaultInstance() {
 }
-::PROTOBUF_NAMESPACE_ID::Metadata SetResponse_SiblingsEntry_DoNotUse::GetMetadata() const {
-  return GetMetadataStatic();
+class CancelBatchRequest::_Internal {
+ public:
+};
+
+CancelBatchRequest::CancelBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.CancelBatchRequest)
 }
-void SetResponse_SiblingsEntry_DoNotUse::MergeFrom(
-    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
-  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+CancelBatchRequest::CancelBatchRequest(const CancelBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_batch_uuid().empty()) {
+    batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.CancelBatchRequest)
 }
 
+void CancelBatchRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_CancelBatchRequest_hashdb_2eproto.base);
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
 
-// ===================================================================
+CancelBatchRequest::~CancelBatchRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.CancelBatchRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-SetResponse_DbReadLogEntry_DoNotUse::SetResponse_DbReadLogEntry_DoNotUse() {}
-SetResponse_DbReadLogEntry_DoNotUse::SetResponse_DbReadLogEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : SuperType(arena) {}
-void SetResponse_DbReadLogEntry_DoNotUse::MergeFrom(const SetResponse_DbReadLogEntry_DoNotUse& other) {
-  MergeFromInternal(other);
+void CancelBatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-::PROTOBUF_NAMESPACE_ID::Metadata SetResponse_DbReadLogEntry_DoNotUse::GetMetadata() const {
-  return GetMetadataStatic();
+
+void CancelBatchRequest::ArenaDtor(void* object) {
+  CancelBatchRequest* _this = reinterpret_cast< CancelBatchRequest* >(object);
+  (void)_this;
 }
-void SetResponse_DbReadLogEntry_DoNotUse::MergeFrom(
-    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
-  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+void CancelBatchRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void CancelBatchRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const CancelBatchRequest& CancelBatchRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_CancelBatchRequest_hashdb_2eproto.base);
+  return *internal_default_instance();
 }
 
 
-// ===================================================================
+void CancelBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.CancelBatchRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void SetResponse::InitAsDefaultInstance() {
-  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->old_root_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
-  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->new_root_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
-  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->key_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
-  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->ins_key_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
-  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->result_ = const_cast< ::hashdb::v1::ResultCode*>(
-      ::hashdb::v1::ResultCode::internal_default_instance());
-  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->sibling_left_child_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
-  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->sibling_right_child_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
+  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-class SetResponse::_Internal {
- public:
-  static const ::hashdb::v1::Fea& old_root(const SetResponse* msg);
-  static const ::hashdb::v1::Fea& new_root(const SetResponse* msg);
-  static const ::hashdb::v1::Fea& key(const SetResponse* msg);
-  static const ::hashdb::v1::Fea& ins_key(const SetResponse* msg);
-  static const ::hashdb::v1::ResultCode& result(const SetResponse* msg);
-  static const ::hashdb::v1::Fea& sibling_left_child(const SetResponse* msg);
-  static const ::hashdb::v1::Fea& sibling_right_child(const SetResponse* msg);
-};
 
-const ::hashdb::v1::Fea&
-SetResponse::_Internal::old_root(const SetResponse* msg) {
-  return *msg->old_root_;
-}
-const ::hashdb::v1::Fea&
-SetResponse::_Internal::new_root(const SetResponse* msg) {
-  return *msg->new_root_;
-}
-const ::hashdb::v1::Fea&
-SetResponse::_Internal::key(const SetResponse* msg) {
-  return *msg->key_;
+const char* CancelBatchRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string batch_uuid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_batch_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.CancelBatchRequest.batch_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
 }
-const ::hashdb::v1::Fea&
-SetResponse::_Internal::ins_key(const SetResponse* msg) {
-  return *msg->ins_key_;
+
+::PROTOBUF_NAMESPACE_ID::uint8* CancelBatchRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.CancelBatchRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string batch_uuid = 1;
+  if (this->batch_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.CancelBatchRequest.batch_uuid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_batch_uuid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.CancelBatchRequest)
+  return target;
 }
-const ::hashdb::v1::ResultCode&
-SetResponse::_Internal::result(const SetResponse* msg) {
+
+size_t CancelBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.CancelBatchRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string batch_uuid = 1;
+  if (this->batch_uuid().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_batch_uuid());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void CancelBatchRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.CancelBatchRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const CancelBatchRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CancelBatchRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.CancelBatchRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.CancelBatchRequest)
+    MergeFrom(*source);
+  }
+}
+
+void CancelBatchRequest::MergeFrom(const CancelBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.CancelBatchRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.batch_uuid().size() > 0) {
+    _internal_set_batch_uuid(from._internal_batch_uuid());
+  }
+}
+
+void CancelBatchRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.CancelBatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CancelBatchRequest::CopyFrom(const CancelBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.CancelBatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CancelBatchRequest::IsInitialized() const {
+  return true;
+}
+
+void CancelBatchRequest::InternalSwap(CancelBatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CancelBatchRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void GetLatestStateRootResponse::InitAsDefaultInstance() {
+  ::hashdb::v1::_GetLatestStateRootResponse_default_instance_._instance.get_mutable()->latest_root_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+  ::hashdb::v1::_GetLatestStateRootResponse_default_instance_._instance.get_mutable()->result_ = const_cast< ::hashdb::v1::ResultCode*>(
+      ::hashdb::v1::ResultCode::internal_default_instance());
+}
+class GetLatestStateRootResponse::_Internal {
+ public:
+  static const ::hashdb::v1::Fea& latest_root(const GetLatestStateRootResponse* msg);
+  static const ::hashdb::v1::ResultCode& result(const GetLatestStateRootResponse* msg);
+};
+
+const ::hashdb::v1::Fea&
+GetLatestStateRootResponse::_Internal::latest_root(const GetLatestStateRootResponse* msg) {
+  return *msg->latest_root_;
+}
+const ::hashdb::v1::ResultCode&
+GetLatestStateRootResponse::_Internal::result(const GetLatestStateRootResponse* msg) {
   return *msg->result_;
 }
+GetLatestStateRootResponse::GetLatestStateRootResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.GetLatestStateRootResponse)
+}
+GetLatestStateRootResponse::GetLatestStateRootResponse(const GetLatestStateRootResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_latest_root()) {
+    latest_root_ = new ::hashdb::v1::Fea(*from.latest_root_);
+  } else {
+    latest_root_ = nullptr;
+  }
+  if (from._internal_has_result()) {
+    result_ = new ::hashdb::v1::ResultCode(*from.result_);
+  } else {
+    result_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.GetLatestStateRootResponse)
+}
+
+void GetLatestStateRootResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetLatestStateRootResponse_hashdb_2eproto.base);
+  ::memset(&latest_root_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&result_) -
+      reinterpret_cast<char*>(&latest_root_)) + sizeof(result_));
+}
+
+GetLatestStateRootResponse::~GetLatestStateRootResponse() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.GetLatestStateRootResponse)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void GetLatestStateRootResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete latest_root_;
+  if (this != internal_default_instance()) delete result_;
+}
+
+void GetLatestStateRootResponse::ArenaDtor(void* object) {
+  GetLatestStateRootResponse* _this = reinterpret_cast< GetLatestStateRootResponse* >(object);
+  (void)_this;
+}
+void GetLatestStateRootResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void GetLatestStateRootResponse::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const GetLatestStateRootResponse& GetLatestStateRootResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetLatestStateRootResponse_hashdb_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void GetLatestStateRootResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.GetLatestStateRootResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArena() == nullptr && latest_root_ != nullptr) {
+    delete latest_root_;
+  }
+  latest_root_ = nullptr;
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetLatestStateRootResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .hashdb.v1.Fea latest_root = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_latest_root(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.ResultCode result = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* GetLatestStateRootResponse::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.GetLatestStateRootResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .hashdb.v1.Fea latest_root = 1;
+  if (this->has_latest_root()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::latest_root(this), target, stream);
+  }
+
+  // .hashdb.v1.ResultCode result = 2;
+  if (this->has_result()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::result(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.GetLatestStateRootResponse)
+  return target;
+}
+
+size_t GetLatestStateRootResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.GetLatestStateRootResponse)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .hashdb.v1.Fea latest_root = 1;
+  if (this->has_latest_root()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *latest_root_);
+  }
+
+  // .hashdb.v1.ResultCode result = 2;
+  if (this->has_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *result_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void GetLatestStateRootResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.GetLatestStateRootResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const GetLatestStateRootResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetLatestStateRootResponse>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.GetLatestStateRootResponse)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.GetLatestStateRootResponse)
+    MergeFrom(*source);
+  }
+}
+
+void GetLatestStateRootResponse::MergeFrom(const GetLatestStateRootResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.GetLatestStateRootResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_latest_root()) {
+    _internal_mutable_latest_root()->::hashdb::v1::Fea::MergeFrom(from._internal_latest_root());
+  }
+  if (from.has_result()) {
+    _internal_mutable_result()->::hashdb::v1::ResultCode::MergeFrom(from._internal_result());
+  }
+}
+
+void GetLatestStateRootResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.GetLatestStateRootResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GetLatestStateRootResponse::CopyFrom(const GetLatestStateRootResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.GetLatestStateRootResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetLatestStateRootResponse::IsInitialized() const {
+  return true;
+}
+
+void GetLatestStateRootResponse::InternalSwap(GetLatestStateRootResponse* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetLatestStateRootResponse, result_)
+      + sizeof(GetLatestStateRootResponse::result_)
+      - PROTOBUF_FIELD_OFFSET(GetLatestStateRootResponse, latest_root_)>(
+          reinterpret_cast<char*>(&latest_root_),
+          reinterpret_cast<char*>(&other->latest_root_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetLatestStateRootResponse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+SetResponse_SiblingsEntry_DoNotUse::SetResponse_SiblingsEntry_DoNotUse() {}
+SetResponse_SiblingsEntry_DoNotUse::SetResponse_SiblingsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void SetResponse_SiblingsEntry_DoNotUse::MergeFrom(const SetResponse_SiblingsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata SetResponse_SiblingsEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void SetResponse_SiblingsEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+SetResponse_DbReadLogEntry_DoNotUse::SetResponse_DbReadLogEntry_DoNotUse() {}
+SetResponse_DbReadLogEntry_DoNotUse::SetResponse_DbReadLogEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void SetResponse_DbReadLogEntry_DoNotUse::MergeFrom(const SetResponse_DbReadLogEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata SetResponse_DbReadLogEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void SetResponse_DbReadLogEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void SetResponse::InitAsDefaultInstance() {
+  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->old_root_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->new_root_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->key_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->ins_key_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->result_ = const_cast< ::hashdb::v1::ResultCode*>(
+      ::hashdb::v1::ResultCode::internal_default_instance());
+  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->sibling_left_child_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+  ::hashdb::v1::_SetResponse_default_instance_._instance.get_mutable()->sibling_right_child_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+}
+class SetResponse::_Internal {
+ public:
+  static const ::hashdb::v1::Fea& old_root(const SetResponse* msg);
+  static const ::hashdb::v1::Fea& new_root(const SetResponse* msg);
+  static const ::hashdb::v1::Fea& key(const SetResponse* msg);
+  static const ::hashdb::v1::Fea& ins_key(const SetResponse* msg);
+  static const ::hashdb::v1::ResultCode& result(const SetResponse* msg);
+  static const ::hashdb::v1::Fea& sibling_left_child(const SetResponse* msg);
+  static const ::hashdb::v1::Fea& sibling_right_child(const SetResponse* msg);
+};
+
+const ::hashdb::v1::Fea&
+SetResponse::_Internal::old_root(const SetResponse* msg) {
+  return *msg->old_root_;
+}
+const ::hashdb::v1::Fea&
+SetResponse::_Internal::new_root(const SetResponse* msg) {
+  return *msg->new_root_;
+}
+const ::hashdb::v1::Fea&
+SetResponse::_Internal::key(const SetResponse* msg) {
+  return *msg->key_;
+}
+const ::hashdb::v1::Fea&
+SetResponse::_Internal::ins_key(const SetResponse* msg) {
+  return *msg->ins_key_;
+}
+const ::hashdb::v1::ResultCode&
+SetResponse::_Internal::result(const SetResponse* msg) {
+  return *msg->result_;
+}
+const ::hashdb::v1::Fea&
+SetResponse::_Internal::sibling_left_child(const SetResponse* msg) {
+  return *msg->sibling_left_child_;
+}
+const ::hashdb::v1::Fea&
+SetResponse::_Internal::sibling_right_child(const SetResponse* msg) {
+  return *msg->sibling_right_child_;
+}
+SetResponse::SetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  siblings_(arena),
+  db_read_log_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.SetResponse)
+}
+SetResponse::SetResponse(const SetResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  siblings_.MergeFrom(from.siblings_);
+  db_read_log_.MergeFrom(from.db_read_log_);
+  ins_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_ins_value().empty()) {
+    ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_ins_value(),
+      GetArena());
+  }
+  old_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_old_value().empty()) {
+    old_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_old_value(),
+      GetArena());
+  }
+  new_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_new_value().empty()) {
+    new_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_new_value(),
+      GetArena());
+  }
+  mode_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_mode().empty()) {
+    mode_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_mode(),
+      GetArena());
+  }
+  if (from._internal_has_old_root()) {
+    old_root_ = new ::hashdb::v1::Fea(*from.old_root_);
+  } else {
+    old_root_ = nullptr;
+  }
+  if (from._internal_has_new_root()) {
+    new_root_ = new ::hashdb::v1::Fea(*from.new_root_);
+  } else {
+    new_root_ = nullptr;
+  }
+  if (from._internal_has_key()) {
+    key_ = new ::hashdb::v1::Fea(*from.key_);
+  } else {
+    key_ = nullptr;
+  }
+  if (from._internal_has_ins_key()) {
+    ins_key_ = new ::hashdb::v1::Fea(*from.ins_key_);
+  } else {
+    ins_key_ = nullptr;
+  }
+  if (from._internal_has_result()) {
+    result_ = new ::hashdb::v1::ResultCode(*from.result_);
+  } else {
+    result_ = nullptr;
+  }
+  if (from._internal_has_sibling_left_child()) {
+    sibling_left_child_ = new ::hashdb::v1::Fea(*from.sibling_left_child_);
+  } else {
+    sibling_left_child_ = nullptr;
+  }
+  if (from._internal_has_sibling_right_child()) {
+    sibling_right_child_ = new ::hashdb::v1::Fea(*from.sibling_right_child_);
+  } else {
+    sibling_right_child_ = nullptr;
+  }
+  ::memcpy(&proof_hash_counter_, &from.proof_hash_counter_,
+    static_cast<size_t>(reinterpret_cast<char*>(&is_old0_) -
+    reinterpret_cast<char*>(&proof_hash_counter_)) + sizeof(is_old0_));
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.SetResponse)
+}
+
+void SetResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SetResponse_hashdb_2eproto.base);
+  ins_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  old_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  new_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  mode_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&old_root_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&is_old0_) -
+      reinterpret_cast<char*>(&old_root_)) + sizeof(is_old0_));
+}
+
+SetResponse::~SetResponse() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.SetResponse)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void SetResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  ins_value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  old_value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  new_value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  mode_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete old_root_;
+  if (this != internal_default_instance()) delete new_root_;
+  if (this != internal_default_instance()) delete key_;
+  if (this != internal_default_instance()) delete ins_key_;
+  if (this != internal_default_instance()) delete result_;
+  if (this != internal_default_instance()) delete sibling_left_child_;
+  if (this != internal_default_instance()) delete sibling_right_child_;
+}
+
+void SetResponse::ArenaDtor(void* object) {
+  SetResponse* _this = reinterpret_cast< SetResponse* >(object);
+  (void)_this;
+}
+void SetResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void SetResponse::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const SetResponse& SetResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SetResponse_hashdb_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void SetResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.SetResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  siblings_.Clear();
+  db_read_log_.Clear();
+  ins_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  old_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  new_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  mode_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (GetArena() == nullptr && old_root_ != nullptr) {
+    delete old_root_;
+  }
+  old_root_ = nullptr;
+  if (GetArena() == nullptr && new_root_ != nullptr) {
+    delete new_root_;
+  }
+  new_root_ = nullptr;
+  if (GetArena() == nullptr && key_ != nullptr) {
+    delete key_;
+  }
+  key_ = nullptr;
+  if (GetArena() == nullptr && ins_key_ != nullptr) {
+    delete ins_key_;
+  }
+  ins_key_ = nullptr;
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
+  if (GetArena() == nullptr && sibling_left_child_ != nullptr) {
+    delete sibling_left_child_;
+  }
+  sibling_left_child_ = nullptr;
+  if (GetArena() == nullptr && sibling_right_child_ != nullptr) {
+    delete sibling_right_child_;
+  }
+  sibling_right_child_ = nullptr;
+  ::memset(&proof_hash_counter_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&is_old0_) -
+      reinterpret_cast<char*>(&proof_hash_counter_)) + sizeof(is_old0_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .hashdb.v1.Fea old_root = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_old_root(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.Fea new_root = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_new_root(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.Fea key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_key(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // map<uint64, .hashdb.v1.SiblingList> siblings = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&siblings_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.Fea ins_key = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ins_key(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string ins_value = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          auto str = _internal_mutable_ins_value();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.SetResponse.ins_value"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bool is_old0 = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+          is_old0_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string old_value = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          auto str = _internal_mutable_old_value();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.SetResponse.old_value"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string new_value = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          auto str = _internal_mutable_new_value();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.SetResponse.new_value"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string mode = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+          auto str = _internal_mutable_mode();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.SetResponse.mode"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 proof_hash_counter = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 88)) {
+          proof_hash_counter_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // map<string, .hashdb.v1.FeList> db_read_log = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&db_read_log_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.ResultCode result = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.Fea sibling_left_child = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sibling_left_child(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.Fea sibling_right_child = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sibling_right_child(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* SetResponse::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.SetResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .hashdb.v1.Fea old_root = 1;
+  if (this->has_old_root()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::old_root(this), target, stream);
+  }
+
+  // .hashdb.v1.Fea new_root = 2;
+  if (this->has_new_root()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::new_root(this), target, stream);
+  }
+
+  // .hashdb.v1.Fea key = 3;
+  if (this->has_key()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::key(this), target, stream);
+  }
+
+  // map<uint64, .hashdb.v1.SiblingList> siblings = 4;
+  if (!this->_internal_siblings().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::const_pointer
+        ConstPtr;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint64, ConstPtr > SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_siblings().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_siblings().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::const_iterator
+          it = this->_internal_siblings().begin();
+          it != this->_internal_siblings().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = SetResponse_SiblingsEntry_DoNotUse::Funcs::InternalSerialize(4, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::const_iterator
+          it = this->_internal_siblings().begin();
+          it != this->_internal_siblings().end(); ++it) {
+        target = SetResponse_SiblingsEntry_DoNotUse::Funcs::InternalSerialize(4, it->first, it->second, target, stream);
+      }
+    }
+  }
+
+  // .hashdb.v1.Fea ins_key = 5;
+  if (this->has_ins_key()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::ins_key(this), target, stream);
+  }
+
+  // string ins_value = 6;
+  if (this->ins_value().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_ins_value().data(), static_cast<int>(this->_internal_ins_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.SetResponse.ins_value");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_ins_value(), target);
+  }
+
+  // bool is_old0 = 7;
+  if (this->is_old0() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(7, this->_internal_is_old0(), target);
+  }
+
+  // string old_value = 8;
+  if (this->old_value().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_old_value().data(), static_cast<int>(this->_internal_old_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.SetResponse.old_value");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_old_value(), target);
+  }
+
+  // string new_value = 9;
+  if (this->new_value().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_new_value().data(), static_cast<int>(this->_internal_new_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.SetResponse.new_value");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_new_value(), target);
+  }
+
+  // string mode = 10;
+  if (this->mode().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_mode().data(), static_cast<int>(this->_internal_mode().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.SetResponse.mode");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_mode(), target);
+  }
+
+  // uint64 proof_hash_counter = 11;
+  if (this->proof_hash_counter() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(11, this->_internal_proof_hash_counter(), target);
+  }
+
+  // map<string, .hashdb.v1.FeList> db_read_log = 12;
+  if (!this->_internal_db_read_log().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "hashdb.v1.SetResponse.DbReadLogEntry.key");
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_db_read_log().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_db_read_log().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
+          it = this->_internal_db_read_log().begin();
+          it != this->_internal_db_read_log().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = SetResponse_DbReadLogEntry_DoNotUse::Funcs::InternalSerialize(12, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
+          it = this->_internal_db_read_log().begin();
+          it != this->_internal_db_read_log().end(); ++it) {
+        target = SetResponse_DbReadLogEntry_DoNotUse::Funcs::InternalSerialize(12, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  // .hashdb.v1.ResultCode result = 13;
+  if (this->has_result()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        13, _Internal::result(this), target, stream);
+  }
+
+  // .hashdb.v1.Fea sibling_left_child = 14;
+  if (this->has_sibling_left_child()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        14, _Internal::sibling_left_child(this), target, stream);
+  }
+
+  // .hashdb.v1.Fea sibling_right_child = 15;
+  if (this->has_sibling_right_child()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        15, _Internal::sibling_right_child(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.SetResponse)
+  return target;
+}
+
+size_t SetResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.SetResponse)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<uint64, .hashdb.v1.SiblingList> siblings = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_siblings_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::const_iterator
+      it = this->_internal_siblings().begin();
+      it != this->_internal_siblings().end(); ++it) {
+    total_size += SetResponse_SiblingsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<string, .hashdb.v1.FeList> db_read_log = 12;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_db_read_log_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
+      it = this->_internal_db_read_log().begin();
+      it != this->_internal_db_read_log().end(); ++it) {
+    total_size += SetResponse_DbReadLogEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // string ins_value = 6;
+  if (this->ins_value().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ins_value());
+  }
+
+  // string old_value = 8;
+  if (this->old_value().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_old_value());
+  }
+
+  // string new_value = 9;
+  if (this->new_value().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_new_value());
+  }
+
+  // string mode = 10;
+  if (this->mode().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_mode());
+  }
+
+  // .hashdb.v1.Fea old_root = 1;
+  if (this->has_old_root()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *old_root_);
+  }
+
+  // .hashdb.v1.Fea new_root = 2;
+  if (this->has_new_root()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *new_root_);
+  }
+
+  // .hashdb.v1.Fea key = 3;
+  if (this->has_key()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *key_);
+  }
+
+  // .hashdb.v1.Fea ins_key = 5;
+  if (this->has_ins_key()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *ins_key_);
+  }
+
+  // .hashdb.v1.ResultCode result = 13;
+  if (this->has_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *result_);
+  }
+
+  // .hashdb.v1.Fea sibling_left_child = 14;
+  if (this->has_sibling_left_child()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *sibling_left_child_);
+  }
+
+  // .hashdb.v1.Fea sibling_right_child = 15;
+  if (this->has_sibling_right_child()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *sibling_right_child_);
+  }
+
+  // uint64 proof_hash_counter = 11;
+  if (this->proof_hash_counter() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_proof_hash_counter());
+  }
+
+  // bool is_old0 = 7;
+  if (this->is_old0() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SetResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.SetResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SetResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SetResponse>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.SetResponse)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.SetResponse)
+    MergeFrom(*source);
+  }
+}
+
+void SetResponse::MergeFrom(const SetResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.SetResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  siblings_.MergeFrom(from.siblings_);
+  db_read_log_.MergeFrom(from.db_read_log_);
+  if (from.ins_value().size() > 0) {
+    _internal_set_ins_value(from._internal_ins_value());
+  }
+  if (from.old_value().size() > 0) {
+    _internal_set_old_value(from._internal_old_value());
+  }
+  if (from.new_value().size() > 0) {
+    _internal_set_new_value(from._internal_new_value());
+  }
+  if (from.mode().size() > 0) {
+    _internal_set_mode(from._internal_mode());
+  }
+  if (from.has_old_root()) {
+    _internal_mutable_old_root()->::hashdb::v1::Fea::MergeFrom(from._internal_old_root());
+  }
+  if (from.has_new_root()) {
+    _internal_mutable_new_root()->::hashdb::v1::Fea::MergeFrom(from._internal_new_root());
+  }
+  if (from.has_key()) {
+    _internal_mutable_key()->::hashdb::v1::Fea::MergeFrom(from._internal_key());
+  }
+  if (from.has_ins_key()) {
+    _internal_mutable_ins_key()->::hashdb::v1::Fea::MergeFrom(from._internal_ins_key());
+  }
+  if (from.has_result()) {
+    _internal_mutable_result()->::hashdb::v1::ResultCode::MergeFrom(from._internal_result());
+  }
+  if (from.has_sibling_left_child()) {
+    _internal_mutable_sibling_left_child()->::hashdb::v1::Fea::MergeFrom(from._internal_sibling_left_child());
+  }
+  if (from.has_sibling_right_child()) {
+    _internal_mutable_sibling_right_child()->::hashdb::v1::Fea::MergeFrom(from._internal_sibling_right_child());
+  }
+  if (from.proof_hash_counter() != 0) {
+    _internal_set_proof_hash_counter(from._internal_proof_hash_counter());
+  }
+  if (from.is_old0() != 0) {
+    _internal_set_is_old0(from._internal_is_old0());
+  }
+}
+
+void SetResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.SetResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SetResponse::CopyFrom(const SetResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.SetResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetResponse::IsInitialized() const {
+  return true;
+}
+
+void SetResponse::InternalSwap(SetResponse* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  siblings_.Swap(&other->siblings_);
+  db_read_log_.Swap(&other->db_read_log_);
+  ins_value_.Swap(&other->ins_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  old_value_.Swap(&other->old_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  new_value_.Swap(&other->new_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  mode_.Swap(&other->mode_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetResponse, is_old0_)
+      + sizeof(SetResponse::is_old0_)
+      - PROTOBUF_FIELD_OFFSET(SetResponse, old_root_)>(
+          reinterpret_cast<char*>(&old_root_),
+          reinterpret_cast<char*>(&other->old_root_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetResponse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+GetResponse_SiblingsEntry_DoNotUse::GetResponse_SiblingsEntry_DoNotUse() {}
+GetResponse_SiblingsEntry_DoNotUse::GetResponse_SiblingsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void GetResponse_SiblingsEntry_DoNotUse::MergeFrom(const GetResponse_SiblingsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata GetResponse_SiblingsEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void GetResponse_SiblingsEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+GetResponse_DbReadLogEntry_DoNotUse::GetResponse_DbReadLogEntry_DoNotUse() {}
+GetResponse_DbReadLogEntry_DoNotUse::GetResponse_DbReadLogEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void GetResponse_DbReadLogEntry_DoNotUse::MergeFrom(const GetResponse_DbReadLogEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata GetResponse_DbReadLogEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void GetResponse_DbReadLogEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void GetResponse::InitAsDefaultInstance() {
+  ::hashdb::v1::_GetResponse_default_instance_._instance.get_mutable()->root_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+  ::hashdb::v1::_GetResponse_default_instance_._instance.get_mutable()->key_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+  ::hashdb::v1::_GetResponse_default_instance_._instance.get_mutable()->ins_key_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+  ::hashdb::v1::_GetResponse_default_instance_._instance.get_mutable()->result_ = const_cast< ::hashdb::v1::ResultCode*>(
+      ::hashdb::v1::ResultCode::internal_default_instance());
+}
+class GetResponse::_Internal {
+ public:
+  static const ::hashdb::v1::Fea& root(const GetResponse* msg);
+  static const ::hashdb::v1::Fea& key(const GetResponse* msg);
+  static const ::hashdb::v1::Fea& ins_key(const GetResponse* msg);
+  static const ::hashdb::v1::ResultCode& result(const GetResponse* msg);
+};
+
 const ::hashdb::v1::Fea&
-SetResponse::_Internal::sibling_left_child(const SetResponse* msg) {
-  return *msg->sibling_left_child_;
+GetResponse::_Internal::root(const GetResponse* msg) {
+  return *msg->root_;
 }
 const ::hashdb::v1::Fea&
-SetResponse::_Internal::sibling_right_child(const SetResponse* msg) {
-  return *msg->sibling_right_child_;
+GetResponse::_Internal::key(const GetResponse* msg) {
+  return *msg->key_;
 }
-SetResponse::SetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+const ::hashdb::v1::Fea&
+GetResponse::_Internal::ins_key(const GetResponse* msg) {
+  return *msg->ins_key_;
+}
+const ::hashdb::v1::ResultCode&
+GetResponse::_Internal::result(const GetResponse* msg) {
+  return *msg->result_;
+}
+GetResponse::GetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena),
   siblings_(arena),
   db_read_log_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.SetResponse)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.GetResponse)
 }
-SetResponse::SetResponse(const SetResponse& from)
+GetResponse::GetResponse(const GetResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   siblings_.MergeFrom(from.siblings_);
@@ -6519,30 +7896,15 @@ SetResponse::SetResponse(const SetResponse& from)
     ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_ins_value(),
       GetArena());
   }
-  old_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_old_value().empty()) {
-    old_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_old_value(),
-      GetArena());
-  }
-  new_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_new_value().empty()) {
-    new_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_new_value(),
-      GetArena());
-  }
-  mode_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_mode().empty()) {
-    mode_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_mode(),
+  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_value().empty()) {
+    value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_value(),
       GetArena());
   }
-  if (from._internal_has_old_root()) {
-    old_root_ = new ::hashdb::v1::Fea(*from.old_root_);
-  } else {
-    old_root_ = nullptr;
-  }
-  if (from._internal_has_new_root()) {
-    new_root_ = new ::hashdb::v1::Fea(*from.new_root_);
+  if (from._internal_has_root()) {
+    root_ = new ::hashdb::v1::Fea(*from.root_);
   } else {
-    new_root_ = nullptr;
+    root_ = nullptr;
   }
   if (from._internal_has_key()) {
     key_ = new ::hashdb::v1::Fea(*from.key_);
@@ -6559,71 +7921,54 @@ SetResponse::SetResponse(const SetResponse& from)
   } else {
     result_ = nullptr;
   }
-  if (from._internal_has_sibling_left_child()) {
-    sibling_left_child_ = new ::hashdb::v1::Fea(*from.sibling_left_child_);
-  } else {
-    sibling_left_child_ = nullptr;
-  }
-  if (from._internal_has_sibling_right_child()) {
-    sibling_right_child_ = new ::hashdb::v1::Fea(*from.sibling_right_child_);
-  } else {
-    sibling_right_child_ = nullptr;
-  }
   ::memcpy(&proof_hash_counter_, &from.proof_hash_counter_,
     static_cast<size_t>(reinterpret_cast<char*>(&is_old0_) -
     reinterpret_cast<char*>(&proof_hash_counter_)) + sizeof(is_old0_));
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.SetResponse)
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.GetResponse)
 }
 
-void SetResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SetResponse_hashdb_2eproto.base);
+void GetResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetResponse_hashdb_2eproto.base);
   ins_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  old_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  new_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  mode_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&old_root_, 0, static_cast<size_t>(
+  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&root_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&is_old0_) -
-      reinterpret_cast<char*>(&old_root_)) + sizeof(is_old0_));
+      reinterpret_cast<char*>(&root_)) + sizeof(is_old0_));
 }
 
-SetResponse::~SetResponse() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.SetResponse)
+GetResponse::~GetResponse() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.GetResponse)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SetResponse::SharedDtor() {
+void GetResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
   ins_value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  old_value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  new_value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  mode_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete old_root_;
-  if (this != internal_default_instance()) delete new_root_;
+  value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete root_;
   if (this != internal_default_instance()) delete key_;
   if (this != internal_default_instance()) delete ins_key_;
   if (this != internal_default_instance()) delete result_;
-  if (this != internal_default_instance()) delete sibling_left_child_;
-  if (this != internal_default_instance()) delete sibling_right_child_;
 }
 
-void SetResponse::ArenaDtor(void* object) {
-  SetResponse* _this = reinterpret_cast< SetResponse* >(object);
+void GetResponse::ArenaDtor(void* object) {
+  GetResponse* _this = reinterpret_cast< GetResponse* >(object);
   (void)_this;
 }
-void SetResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void GetResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void SetResponse::SetCachedSize(int size) const {
+void GetResponse::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const SetResponse& SetResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SetResponse_hashdb_2eproto.base);
+const GetResponse& GetResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetResponse_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void SetResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.SetResponse)
+void GetResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.GetResponse)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -6631,17 +7976,11 @@ void SetResponse::Clear() {
   siblings_.Clear();
   db_read_log_.Clear();
   ins_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  old_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  new_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  mode_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  if (GetArena() == nullptr && old_root_ != nullptr) {
-    delete old_root_;
-  }
-  old_root_ = nullptr;
-  if (GetArena() == nullptr && new_root_ != nullptr) {
-    delete new_root_;
+  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (GetArena() == nullptr && root_ != nullptr) {
+    delete root_;
   }
-  new_root_ = nullptr;
+  root_ = nullptr;
   if (GetArena() == nullptr && key_ != nullptr) {
     delete key_;
   }
@@ -6654,21 +7993,13 @@ void SetResponse::Clear() {
     delete result_;
   }
   result_ = nullptr;
-  if (GetArena() == nullptr && sibling_left_child_ != nullptr) {
-    delete sibling_left_child_;
-  }
-  sibling_left_child_ = nullptr;
-  if (GetArena() == nullptr && sibling_right_child_ != nullptr) {
-    delete sibling_right_child_;
-  }
-  sibling_right_child_ = nullptr;
   ::memset(&proof_hash_counter_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&is_old0_) -
       reinterpret_cast<char*>(&proof_hash_counter_)) + sizeof(is_old0_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GetResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -6676,129 +8007,90 @@ const char* SetResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // .hashdb.v1.Fea old_root = 1;
+      // .hashdb.v1.Fea root = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_old_root(), ptr);
+          ptr = ctx->ParseMessage(_internal_mutable_root(), ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // .hashdb.v1.Fea new_root = 2;
+      // .hashdb.v1.Fea key = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_new_root(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .hashdb.v1.Fea key = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
           ptr = ctx->ParseMessage(_internal_mutable_key(), ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // map<uint64, .hashdb.v1.SiblingList> siblings = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+      // map<uint64, .hashdb.v1.SiblingList> siblings = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(&siblings_, ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
         } else goto handle_unusual;
         continue;
-      // .hashdb.v1.Fea ins_key = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+      // .hashdb.v1.Fea ins_key = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
           ptr = ctx->ParseMessage(_internal_mutable_ins_key(), ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // string ins_value = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+      // string ins_value = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
           auto str = _internal_mutable_ins_value();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.SetResponse.ins_value"));
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.GetResponse.ins_value"));
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // bool is_old0 = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+      // bool is_old0 = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
           is_old0_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // string old_value = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
-          auto str = _internal_mutable_old_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.SetResponse.old_value"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string new_value = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
-          auto str = _internal_mutable_new_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.SetResponse.new_value"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string mode = 10;
-      case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
-          auto str = _internal_mutable_mode();
+      // string value = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          auto str = _internal_mutable_value();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.SetResponse.mode"));
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.GetResponse.value"));
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // uint64 proof_hash_counter = 11;
-      case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 88)) {
+      // uint64 proof_hash_counter = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
           proof_hash_counter_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // map<string, .hashdb.v1.FeList> db_read_log = 12;
-      case 12:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+      // map<string, .hashdb.v1.FeList> db_read_log = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
           ptr -= 1;
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(&db_read_log_, ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
         } else goto handle_unusual;
         continue;
-      // .hashdb.v1.ResultCode result = 13;
-      case 13:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+      // .hashdb.v1.ResultCode result = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
           ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // .hashdb.v1.Fea sibling_left_child = 14;
-      case 14:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
-          ptr = ctx->ParseMessage(_internal_mutable_sibling_left_child(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .hashdb.v1.Fea sibling_right_child = 15;
-      case 15:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
-          ptr = ctx->ParseMessage(_internal_mutable_sibling_right_child(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -6821,37 +8113,29 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* SetResponse::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* GetResponse::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.SetResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.GetResponse)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .hashdb.v1.Fea old_root = 1;
-  if (this->has_old_root()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::old_root(this), target, stream);
-  }
-
-  // .hashdb.v1.Fea new_root = 2;
-  if (this->has_new_root()) {
+  // .hashdb.v1.Fea root = 1;
+  if (this->has_root()) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
       InternalWriteMessage(
-        2, _Internal::new_root(this), target, stream);
+        1, _Internal::root(this), target, stream);
   }
 
-  // .hashdb.v1.Fea key = 3;
+  // .hashdb.v1.Fea key = 2;
   if (this->has_key()) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
       InternalWriteMessage(
-        3, _Internal::key(this), target, stream);
+        2, _Internal::key(this), target, stream);
   }
 
-  // map<uint64, .hashdb.v1.SiblingList> siblings = 4;
+  // map<uint64, .hashdb.v1.SiblingList> siblings = 3;
   if (!this->_internal_siblings().empty()) {
     typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::const_pointer
         ConstPtr;
@@ -6871,78 +8155,58 @@ failure:
       }
       ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
       for (size_type i = 0; i < n; i++) {
-        target = SetResponse_SiblingsEntry_DoNotUse::Funcs::InternalSerialize(4, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+        target = GetResponse_SiblingsEntry_DoNotUse::Funcs::InternalSerialize(3, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
       }
     } else {
       for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::const_iterator
           it = this->_internal_siblings().begin();
           it != this->_internal_siblings().end(); ++it) {
-        target = SetResponse_SiblingsEntry_DoNotUse::Funcs::InternalSerialize(4, it->first, it->second, target, stream);
+        target = GetResponse_SiblingsEntry_DoNotUse::Funcs::InternalSerialize(3, it->first, it->second, target, stream);
       }
     }
   }
 
-  // .hashdb.v1.Fea ins_key = 5;
+  // .hashdb.v1.Fea ins_key = 4;
   if (this->has_ins_key()) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
       InternalWriteMessage(
-        5, _Internal::ins_key(this), target, stream);
+        4, _Internal::ins_key(this), target, stream);
   }
 
-  // string ins_value = 6;
+  // string ins_value = 5;
   if (this->ins_value().size() > 0) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_ins_value().data(), static_cast<int>(this->_internal_ins_value().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.SetResponse.ins_value");
+      "hashdb.v1.GetResponse.ins_value");
     target = stream->WriteStringMaybeAliased(
-        6, this->_internal_ins_value(), target);
+        5, this->_internal_ins_value(), target);
   }
 
-  // bool is_old0 = 7;
+  // bool is_old0 = 6;
   if (this->is_old0() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(7, this->_internal_is_old0(), target);
-  }
-
-  // string old_value = 8;
-  if (this->old_value().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_old_value().data(), static_cast<int>(this->_internal_old_value().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.SetResponse.old_value");
-    target = stream->WriteStringMaybeAliased(
-        8, this->_internal_old_value(), target);
-  }
-
-  // string new_value = 9;
-  if (this->new_value().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_new_value().data(), static_cast<int>(this->_internal_new_value().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.SetResponse.new_value");
-    target = stream->WriteStringMaybeAliased(
-        9, this->_internal_new_value(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(6, this->_internal_is_old0(), target);
   }
 
-  // string mode = 10;
-  if (this->mode().size() > 0) {
+  // string value = 7;
+  if (this->value().size() > 0) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_mode().data(), static_cast<int>(this->_internal_mode().length()),
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.SetResponse.mode");
+      "hashdb.v1.GetResponse.value");
     target = stream->WriteStringMaybeAliased(
-        10, this->_internal_mode(), target);
+        7, this->_internal_value(), target);
   }
 
-  // uint64 proof_hash_counter = 11;
+  // uint64 proof_hash_counter = 8;
   if (this->proof_hash_counter() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(11, this->_internal_proof_hash_counter(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(8, this->_internal_proof_hash_counter(), target);
   }
 
-  // map<string, .hashdb.v1.FeList> db_read_log = 12;
+  // map<string, .hashdb.v1.FeList> db_read_log = 9;
   if (!this->_internal_db_read_log().empty()) {
     typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_pointer
         ConstPtr;
@@ -6953,7 +8217,7 @@ failure:
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
           p->first.data(), static_cast<int>(p->first.length()),
           ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-          "hashdb.v1.SetResponse.DbReadLogEntry.key");
+          "hashdb.v1.GetResponse.DbReadLogEntry.key");
       }
     };
 
@@ -6970,162 +8234,111 @@ failure:
       }
       ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
       for (size_type i = 0; i < n; i++) {
-        target = SetResponse_DbReadLogEntry_DoNotUse::Funcs::InternalSerialize(12, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        target = GetResponse_DbReadLogEntry_DoNotUse::Funcs::InternalSerialize(9, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
         Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
       }
     } else {
       for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
           it = this->_internal_db_read_log().begin();
           it != this->_internal_db_read_log().end(); ++it) {
-        target = SetResponse_DbReadLogEntry_DoNotUse::Funcs::InternalSerialize(12, it->first, it->second, target, stream);
+        target = GetResponse_DbReadLogEntry_DoNotUse::Funcs::InternalSerialize(9, it->first, it->second, target, stream);
         Utf8Check::Check(&(*it));
       }
     }
   }
 
-  // .hashdb.v1.ResultCode result = 13;
+  // .hashdb.v1.ResultCode result = 10;
   if (this->has_result()) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
       InternalWriteMessage(
-        13, _Internal::result(this), target, stream);
-  }
-
-  // .hashdb.v1.Fea sibling_left_child = 14;
-  if (this->has_sibling_left_child()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        14, _Internal::sibling_left_child(this), target, stream);
-  }
-
-  // .hashdb.v1.Fea sibling_right_child = 15;
-  if (this->has_sibling_right_child()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        15, _Internal::sibling_right_child(this), target, stream);
+        10, _Internal::result(this), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.SetResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.GetResponse)
   return target;
 }
 
-size_t SetResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.SetResponse)
+size_t GetResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.GetResponse)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // map<uint64, .hashdb.v1.SiblingList> siblings = 4;
+  // map<uint64, .hashdb.v1.SiblingList> siblings = 3;
   total_size += 1 *
       ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_siblings_size());
   for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::const_iterator
       it = this->_internal_siblings().begin();
       it != this->_internal_siblings().end(); ++it) {
-    total_size += SetResponse_SiblingsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+    total_size += GetResponse_SiblingsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
-  // map<string, .hashdb.v1.FeList> db_read_log = 12;
+  // map<string, .hashdb.v1.FeList> db_read_log = 9;
   total_size += 1 *
       ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_db_read_log_size());
   for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
       it = this->_internal_db_read_log().begin();
       it != this->_internal_db_read_log().end(); ++it) {
-    total_size += SetResponse_DbReadLogEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+    total_size += GetResponse_DbReadLogEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
-  // string ins_value = 6;
+  // string ins_value = 5;
   if (this->ins_value().size() > 0) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_ins_value());
   }
 
-  // string old_value = 8;
-  if (this->old_value().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_old_value());
-  }
-
-  // string new_value = 9;
-  if (this->new_value().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_new_value());
-  }
-
-  // string mode = 10;
-  if (this->mode().size() > 0) {
+  // string value = 7;
+  if (this->value().size() > 0) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_mode());
-  }
-
-  // .hashdb.v1.Fea old_root = 1;
-  if (this->has_old_root()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *old_root_);
-  }
-
-  // .hashdb.v1.Fea new_root = 2;
-  if (this->has_new_root()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *new_root_);
-  }
-
-  // .hashdb.v1.Fea key = 3;
-  if (this->has_key()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *key_);
+        this->_internal_value());
   }
 
-  // .hashdb.v1.Fea ins_key = 5;
-  if (this->has_ins_key()) {
+  // .hashdb.v1.Fea root = 1;
+  if (this->has_root()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *ins_key_);
+        *root_);
   }
 
-  // .hashdb.v1.ResultCode result = 13;
-  if (this->has_result()) {
+  // .hashdb.v1.Fea key = 2;
+  if (this->has_key()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *result_);
+        *key_);
   }
 
-  // .hashdb.v1.Fea sibling_left_child = 14;
-  if (this->has_sibling_left_child()) {
+  // .hashdb.v1.Fea ins_key = 4;
+  if (this->has_ins_key()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *sibling_left_child_);
+        *ins_key_);
   }
 
-  // .hashdb.v1.Fea sibling_right_child = 15;
-  if (this->has_sibling_right_child()) {
+  // .hashdb.v1.ResultCode result = 10;
+  if (this->has_result()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *sibling_right_child_);
+        *result_);
   }
 
-  // uint64 proof_hash_counter = 11;
+  // uint64 proof_hash_counter = 8;
   if (this->proof_hash_counter() != 0) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
         this->_internal_proof_hash_counter());
   }
 
-  // bool is_old0 = 7;
+  // bool is_old0 = 6;
   if (this->is_old0() != 0) {
     total_size += 1 + 1;
   }
@@ -7139,23 +8352,23 @@ size_t SetResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void SetResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.SetResponse)
+void GetResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.GetResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const SetResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SetResponse>(
+  const GetResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetResponse>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.SetResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.GetResponse)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.SetResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.GetResponse)
     MergeFrom(*source);
   }
 }
 
-void SetResponse::MergeFrom(const SetResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.SetResponse)
+void GetResponse::MergeFrom(const GetResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.GetResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
@@ -7166,20 +8379,11 @@ void SetResponse::MergeFrom(const SetResponse& from) {
   if (from.ins_value().size() > 0) {
     _internal_set_ins_value(from._internal_ins_value());
   }
-  if (from.old_value().size() > 0) {
-    _internal_set_old_value(from._internal_old_value());
-  }
-  if (from.new_value().size() > 0) {
-    _internal_set_new_value(from._internal_new_value());
-  }
-  if (from.mode().size() > 0) {
-    _internal_set_mode(from._internal_mode());
-  }
-  if (from.has_old_root()) {
-    _internal_mutable_old_root()->::hashdb::v1::Fea::MergeFrom(from._internal_old_root());
+  if (from.value().size() > 0) {
+    _internal_set_value(from._internal_value());
   }
-  if (from.has_new_root()) {
-    _internal_mutable_new_root()->::hashdb::v1::Fea::MergeFrom(from._internal_new_root());
+  if (from.has_root()) {
+    _internal_mutable_root()->::hashdb::v1::Fea::MergeFrom(from._internal_root());
   }
   if (from.has_key()) {
     _internal_mutable_key()->::hashdb::v1::Fea::MergeFrom(from._internal_key());
@@ -7190,252 +8394,379 @@ void SetResponse::MergeFrom(const SetResponse& from) {
   if (from.has_result()) {
     _internal_mutable_result()->::hashdb::v1::ResultCode::MergeFrom(from._internal_result());
   }
-  if (from.has_sibling_left_child()) {
-    _internal_mutable_sibling_left_child()->::hashdb::v1::Fea::MergeFrom(from._internal_sibling_left_child());
-  }
-  if (from.has_sibling_right_child()) {
-    _internal_mutable_sibling_right_child()->::hashdb::v1::Fea::MergeFrom(from._internal_sibling_right_child());
-  }
-  if (from.proof_hash_counter() != 0) {
-    _internal_set_proof_hash_counter(from._internal_proof_hash_counter());
-  }
-  if (from.is_old0() != 0) {
-    _internal_set_is_old0(from._internal_is_old0());
-  }
+  if (from.proof_hash_counter() != 0) {
+    _internal_set_proof_hash_counter(from._internal_proof_hash_counter());
+  }
+  if (from.is_old0() != 0) {
+    _internal_set_is_old0(from._internal_is_old0());
+  }
+}
+
+void GetResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.GetResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GetResponse::CopyFrom(const GetResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.GetResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetResponse::IsInitialized() const {
+  return true;
+}
+
+void GetResponse::InternalSwap(GetResponse* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  siblings_.Swap(&other->siblings_);
+  db_read_log_.Swap(&other->db_read_log_);
+  ins_value_.Swap(&other->ins_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  value_.Swap(&other->value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetResponse, is_old0_)
+      + sizeof(GetResponse::is_old0_)
+      - PROTOBUF_FIELD_OFFSET(GetResponse, root_)>(
+          reinterpret_cast<char*>(&root_),
+          reinterpret_cast<char*>(&other->root_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetResponse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void SetBatchResponse::InitAsDefaultInstance() {
+  ::hashdb::v1::_SetBatchResponse_default_instance_._instance.get_mutable()->result_ = const_cast< ::hashdb::v1::ResultCode*>(
+      ::hashdb::v1::ResultCode::internal_default_instance());
+}
+class SetBatchResponse::_Internal {
+ public:
+  static const ::hashdb::v1::ResultCode& result(const SetBatchResponse* msg);
+};
+
+const ::hashdb::v1::ResultCode&
+SetBatchResponse::_Internal::result(const SetBatchResponse* msg) {
+  return *msg->result_;
+}
+SetBatchResponse::SetBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  responses_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.SetBatchResponse)
+}
+SetBatchResponse::SetBatchResponse(const SetBatchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      responses_(from.responses_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_result()) {
+    result_ = new ::hashdb::v1::ResultCode(*from.result_);
+  } else {
+    result_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.SetBatchResponse)
+}
+
+void SetBatchResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SetBatchResponse_hashdb_2eproto.base);
+  result_ = nullptr;
+}
+
+SetBatchResponse::~SetBatchResponse() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.SetBatchResponse)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void SetBatchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete result_;
+}
+
+void SetBatchResponse::ArenaDtor(void* object) {
+  SetBatchResponse* _this = reinterpret_cast< SetBatchResponse* >(object);
+  (void)_this;
+}
+void SetBatchResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void SetBatchResponse::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const SetBatchResponse& SetBatchResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SetBatchResponse_hashdb_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void SetBatchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.SetBatchResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  responses_.Clear();
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetBatchResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated .hashdb.v1.SetResponse responses = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_responses(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.ResultCode result = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* SetBatchResponse::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.SetBatchResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .hashdb.v1.SetResponse responses = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_responses_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_responses(i), target, stream);
+  }
+
+  // .hashdb.v1.ResultCode result = 2;
+  if (this->has_result()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::result(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.SetBatchResponse)
+  return target;
+}
+
+size_t SetBatchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.SetBatchResponse)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .hashdb.v1.SetResponse responses = 1;
+  total_size += 1UL * this->_internal_responses_size();
+  for (const auto& msg : this->responses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .hashdb.v1.ResultCode result = 2;
+  if (this->has_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *result_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SetBatchResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.SetBatchResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SetBatchResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SetBatchResponse>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.SetBatchResponse)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.SetBatchResponse)
+    MergeFrom(*source);
+  }
+}
+
+void SetBatchResponse::MergeFrom(const SetBatchResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.SetBatchResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  responses_.MergeFrom(from.responses_);
+  if (from.has_result()) {
+    _internal_mutable_result()->::hashdb::v1::ResultCode::MergeFrom(from._internal_result());
+  }
 }
 
-void SetResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.SetResponse)
+void SetBatchResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.SetBatchResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void SetResponse::CopyFrom(const SetResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.SetResponse)
+void SetBatchResponse::CopyFrom(const SetBatchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.SetBatchResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetResponse::IsInitialized() const {
+bool SetBatchResponse::IsInitialized() const {
   return true;
 }
 
-void SetResponse::InternalSwap(SetResponse* other) {
+void SetBatchResponse::InternalSwap(SetBatchResponse* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  siblings_.Swap(&other->siblings_);
-  db_read_log_.Swap(&other->db_read_log_);
-  ins_value_.Swap(&other->ins_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  old_value_.Swap(&other->old_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  new_value_.Swap(&other->new_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  mode_.Swap(&other->mode_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetResponse, is_old0_)
-      + sizeof(SetResponse::is_old0_)
-      - PROTOBUF_FIELD_OFFSET(SetResponse, old_root_)>(
-          reinterpret_cast<char*>(&old_root_),
-          reinterpret_cast<char*>(&other->old_root_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata SetResponse::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-GetResponse_SiblingsEntry_DoNotUse::GetResponse_SiblingsEntry_DoNotUse() {}
-GetResponse_SiblingsEntry_DoNotUse::GetResponse_SiblingsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : SuperType(arena) {}
-void GetResponse_SiblingsEntry_DoNotUse::MergeFrom(const GetResponse_SiblingsEntry_DoNotUse& other) {
-  MergeFromInternal(other);
-}
-::PROTOBUF_NAMESPACE_ID::Metadata GetResponse_SiblingsEntry_DoNotUse::GetMetadata() const {
-  return GetMetadataStatic();
-}
-void GetResponse_SiblingsEntry_DoNotUse::MergeFrom(
-    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
-  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+  responses_.InternalSwap(&other->responses_);
+  swap(result_, other->result_);
 }
 
-
-// ===================================================================
-
-GetResponse_DbReadLogEntry_DoNotUse::GetResponse_DbReadLogEntry_DoNotUse() {}
-GetResponse_DbReadLogEntry_DoNotUse::GetResponse_DbReadLogEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : SuperType(arena) {}
-void GetResponse_DbReadLogEntry_DoNotUse::MergeFrom(const GetResponse_DbReadLogEntry_DoNotUse& other) {
-  MergeFromInternal(other);
-}
-::PROTOBUF_NAMESPACE_ID::Metadata GetResponse_DbReadLogEntry_DoNotUse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetBatchResponse::GetMetadata() const {
   return GetMetadataStatic();
 }
-void GetResponse_DbReadLogEntry_DoNotUse::MergeFrom(
-    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
-  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
-}
 
 
 // ===================================================================
 
-void GetResponse::InitAsDefaultInstance() {
-  ::hashdb::v1::_GetResponse_default_instance_._instance.get_mutable()->root_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
-  ::hashdb::v1::_GetResponse_default_instance_._instance.get_mutable()->key_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
-  ::hashdb::v1::_GetResponse_default_instance_._instance.get_mutable()->ins_key_ = const_cast< ::hashdb::v1::Fea*>(
-      ::hashdb::v1::Fea::internal_default_instance());
-  ::hashdb::v1::_GetResponse_default_instance_._instance.get_mutable()->result_ = const_cast< ::hashdb::v1::ResultCode*>(
+void GetBatchResponse::InitAsDefaultInstance() {
+  ::hashdb::v1::_GetBatchResponse_default_instance_._instance.get_mutable()->result_ = const_cast< ::hashdb::v1::ResultCode*>(
       ::hashdb::v1::ResultCode::internal_default_instance());
 }
-class GetResponse::_Internal {
+class GetBatchResponse::_Internal {
  public:
-  static const ::hashdb::v1::Fea& root(const GetResponse* msg);
-  static const ::hashdb::v1::Fea& key(const GetResponse* msg);
-  static const ::hashdb::v1::Fea& ins_key(const GetResponse* msg);
-  static const ::hashdb::v1::ResultCode& result(const GetResponse* msg);
+  static const ::hashdb::v1::ResultCode& result(const GetBatchResponse* msg);
 };
 
-const ::hashdb::v1::Fea&
-GetResponse::_Internal::root(const GetResponse* msg) {
-  return *msg->root_;
-}
-const ::hashdb::v1::Fea&
-GetResponse::_Internal::key(const GetResponse* msg) {
-  return *msg->key_;
-}
-const ::hashdb::v1::Fea&
-GetResponse::_Internal::ins_key(const GetResponse* msg) {
-  return *msg->ins_key_;
-}
 const ::hashdb::v1::ResultCode&
-GetResponse::_Internal::result(const GetResponse* msg) {
+GetBatchResponse::_Internal::result(const GetBatchResponse* msg) {
   return *msg->result_;
 }
-GetResponse::GetResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+GetBatchResponse::GetBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  siblings_(arena),
-  db_read_log_(arena) {
+  responses_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:hashdb.v1.GetResponse)
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.GetBatchResponse)
 }
-GetResponse::GetResponse(const GetResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+GetBatchResponse::GetBatchResponse(const GetBatchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      responses_(from.responses_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  siblings_.MergeFrom(from.siblings_);
-  db_read_log_.MergeFrom(from.db_read_log_);
-  ins_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_ins_value().empty()) {
-    ins_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_ins_value(),
-      GetArena());
-  }
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_value().empty()) {
-    value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_value(),
-      GetArena());
-  }
-  if (from._internal_has_root()) {
-    root_ = new ::hashdb::v1::Fea(*from.root_);
-  } else {
-    root_ = nullptr;
-  }
-  if (from._internal_has_key()) {
-    key_ = new ::hashdb::v1::Fea(*from.key_);
-  } else {
-    key_ = nullptr;
-  }
-  if (from._internal_has_ins_key()) {
-    ins_key_ = new ::hashdb::v1::Fea(*from.ins_key_);
-  } else {
-    ins_key_ = nullptr;
-  }
   if (from._internal_has_result()) {
     result_ = new ::hashdb::v1::ResultCode(*from.result_);
   } else {
     result_ = nullptr;
   }
-  ::memcpy(&proof_hash_counter_, &from.proof_hash_counter_,
-    static_cast<size_t>(reinterpret_cast<char*>(&is_old0_) -
-    reinterpret_cast<char*>(&proof_hash_counter_)) + sizeof(is_old0_));
-  // @@protoc_insertion_point(copy_constructor:hashdb.v1.GetResponse)
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.GetBatchResponse)
 }
 
-void GetResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetResponse_hashdb_2eproto.base);
-  ins_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&root_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&is_old0_) -
-      reinterpret_cast<char*>(&root_)) + sizeof(is_old0_));
+void GetBatchResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetBatchResponse_hashdb_2eproto.base);
+  result_ = nullptr;
 }
 
-GetResponse::~GetResponse() {
-  // @@protoc_insertion_point(destructor:hashdb.v1.GetResponse)
+GetBatchResponse::~GetBatchResponse() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.GetBatchResponse)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void GetResponse::SharedDtor() {
+void GetBatchResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  ins_value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete root_;
-  if (this != internal_default_instance()) delete key_;
-  if (this != internal_default_instance()) delete ins_key_;
   if (this != internal_default_instance()) delete result_;
 }
 
-void GetResponse::ArenaDtor(void* object) {
-  GetResponse* _this = reinterpret_cast< GetResponse* >(object);
+void GetBatchResponse::ArenaDtor(void* object) {
+  GetBatchResponse* _this = reinterpret_cast< GetBatchResponse* >(object);
   (void)_this;
 }
-void GetResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void GetBatchResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void GetResponse::SetCachedSize(int size) const {
+void GetBatchResponse::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const GetResponse& GetResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetResponse_hashdb_2eproto.base);
+const GetBatchResponse& GetBatchResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetBatchResponse_hashdb_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void GetResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:hashdb.v1.GetResponse)
+void GetBatchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.GetBatchResponse)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  siblings_.Clear();
-  db_read_log_.Clear();
-  ins_value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  if (GetArena() == nullptr && root_ != nullptr) {
-    delete root_;
-  }
-  root_ = nullptr;
-  if (GetArena() == nullptr && key_ != nullptr) {
-    delete key_;
-  }
-  key_ = nullptr;
-  if (GetArena() == nullptr && ins_key_ != nullptr) {
-    delete ins_key_;
-  }
-  ins_key_ = nullptr;
+  responses_.Clear();
   if (GetArena() == nullptr && result_ != nullptr) {
     delete result_;
   }
   result_ = nullptr;
-  ::memset(&proof_hash_counter_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&is_old0_) -
-      reinterpret_cast<char*>(&proof_hash_counter_)) + sizeof(is_old0_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GetBatchResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
@@ -7443,86 +8774,21 @@ const char* GetResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // .hashdb.v1.Fea root = 1;
+      // repeated .hashdb.v1.GetResponse responses = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_root(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .hashdb.v1.Fea key = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_key(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // map<uint64, .hashdb.v1.SiblingList> siblings = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(&siblings_, ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
-        } else goto handle_unusual;
-        continue;
-      // .hashdb.v1.Fea ins_key = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_ins_key(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string ins_value = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          auto str = _internal_mutable_ins_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.GetResponse.ins_value"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // bool is_old0 = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          is_old0_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string value = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
-          auto str = _internal_mutable_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.GetResponse.value"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint64 proof_hash_counter = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
-          proof_hash_counter_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // map<string, .hashdb.v1.FeList> db_read_log = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(&db_read_log_, ptr);
+            ptr = ctx->ParseMessage(_internal_add_responses(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else goto handle_unusual;
         continue;
-      // .hashdb.v1.ResultCode result = 10;
-      case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+      // .hashdb.v1.ResultCode result = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
           CHK_(ptr);
         } else goto handle_unusual;
@@ -7549,236 +8815,58 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GetResponse::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* GetBatchResponse::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.GetResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.GetBatchResponse)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .hashdb.v1.Fea root = 1;
-  if (this->has_root()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::root(this), target, stream);
-  }
-
-  // .hashdb.v1.Fea key = 2;
-  if (this->has_key()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::key(this), target, stream);
-  }
-
-  // map<uint64, .hashdb.v1.SiblingList> siblings = 3;
-  if (!this->_internal_siblings().empty()) {
-    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::const_pointer
-        ConstPtr;
-    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint64, ConstPtr > SortItem;
-    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
-
-    if (stream->IsSerializationDeterministic() &&
-        this->_internal_siblings().size() > 1) {
-      ::std::unique_ptr<SortItem[]> items(
-          new SortItem[this->_internal_siblings().size()]);
-      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::size_type size_type;
-      size_type n = 0;
-      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::const_iterator
-          it = this->_internal_siblings().begin();
-          it != this->_internal_siblings().end(); ++it, ++n) {
-        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
-      for (size_type i = 0; i < n; i++) {
-        target = GetResponse_SiblingsEntry_DoNotUse::Funcs::InternalSerialize(3, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
-      }
-    } else {
-      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::const_iterator
-          it = this->_internal_siblings().begin();
-          it != this->_internal_siblings().end(); ++it) {
-        target = GetResponse_SiblingsEntry_DoNotUse::Funcs::InternalSerialize(3, it->first, it->second, target, stream);
-      }
-    }
-  }
-
-  // .hashdb.v1.Fea ins_key = 4;
-  if (this->has_ins_key()) {
+  // repeated .hashdb.v1.GetResponse responses = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_responses_size()); i < n; i++) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::ins_key(this), target, stream);
-  }
-
-  // string ins_value = 5;
-  if (this->ins_value().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_ins_value().data(), static_cast<int>(this->_internal_ins_value().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.GetResponse.ins_value");
-    target = stream->WriteStringMaybeAliased(
-        5, this->_internal_ins_value(), target);
-  }
-
-  // bool is_old0 = 6;
-  if (this->is_old0() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(6, this->_internal_is_old0(), target);
-  }
-
-  // string value = 7;
-  if (this->value().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "hashdb.v1.GetResponse.value");
-    target = stream->WriteStringMaybeAliased(
-        7, this->_internal_value(), target);
-  }
-
-  // uint64 proof_hash_counter = 8;
-  if (this->proof_hash_counter() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(8, this->_internal_proof_hash_counter(), target);
-  }
-
-  // map<string, .hashdb.v1.FeList> db_read_log = 9;
-  if (!this->_internal_db_read_log().empty()) {
-    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_pointer
-        ConstPtr;
-    typedef ConstPtr SortItem;
-    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
-    struct Utf8Check {
-      static void Check(ConstPtr p) {
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-          p->first.data(), static_cast<int>(p->first.length()),
-          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-          "hashdb.v1.GetResponse.DbReadLogEntry.key");
-      }
-    };
-
-    if (stream->IsSerializationDeterministic() &&
-        this->_internal_db_read_log().size() > 1) {
-      ::std::unique_ptr<SortItem[]> items(
-          new SortItem[this->_internal_db_read_log().size()]);
-      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::size_type size_type;
-      size_type n = 0;
-      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
-          it = this->_internal_db_read_log().begin();
-          it != this->_internal_db_read_log().end(); ++it, ++n) {
-        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
-      for (size_type i = 0; i < n; i++) {
-        target = GetResponse_DbReadLogEntry_DoNotUse::Funcs::InternalSerialize(9, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
-        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
-      }
-    } else {
-      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
-          it = this->_internal_db_read_log().begin();
-          it != this->_internal_db_read_log().end(); ++it) {
-        target = GetResponse_DbReadLogEntry_DoNotUse::Funcs::InternalSerialize(9, it->first, it->second, target, stream);
-        Utf8Check::Check(&(*it));
-      }
-    }
+      InternalWriteMessage(1, this->_internal_responses(i), target, stream);
   }
 
-  // .hashdb.v1.ResultCode result = 10;
+  // .hashdb.v1.ResultCode result = 2;
   if (this->has_result()) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
       InternalWriteMessage(
-        10, _Internal::result(this), target, stream);
+        2, _Internal::result(this), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.GetResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.GetBatchResponse)
   return target;
 }
 
-size_t GetResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.GetResponse)
+size_t GetBatchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.GetBatchResponse)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // map<uint64, .hashdb.v1.SiblingList> siblings = 3;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_siblings_size());
-  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList >::const_iterator
-      it = this->_internal_siblings().begin();
-      it != this->_internal_siblings().end(); ++it) {
-    total_size += GetResponse_SiblingsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
-  }
-
-  // map<string, .hashdb.v1.FeList> db_read_log = 9;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_db_read_log_size());
-  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
-      it = this->_internal_db_read_log().begin();
-      it != this->_internal_db_read_log().end(); ++it) {
-    total_size += GetResponse_DbReadLogEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
-  }
-
-  // string ins_value = 5;
-  if (this->ins_value().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_ins_value());
-  }
-
-  // string value = 7;
-  if (this->value().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_value());
-  }
-
-  // .hashdb.v1.Fea root = 1;
-  if (this->has_root()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *root_);
-  }
-
-  // .hashdb.v1.Fea key = 2;
-  if (this->has_key()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *key_);
-  }
-
-  // .hashdb.v1.Fea ins_key = 4;
-  if (this->has_ins_key()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *ins_key_);
+  // repeated .hashdb.v1.GetResponse responses = 1;
+  total_size += 1UL * this->_internal_responses_size();
+  for (const auto& msg : this->responses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // .hashdb.v1.ResultCode result = 10;
+  // .hashdb.v1.ResultCode result = 2;
   if (this->has_result()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
         *result_);
   }
 
-  // uint64 proof_hash_counter = 8;
-  if (this->proof_hash_counter() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->_internal_proof_hash_counter());
-  }
-
-  // bool is_old0 = 6;
-  if (this->is_old0() != 0) {
-    total_size += 1 + 1;
-  }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -7788,90 +8876,60 @@ size_t GetResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void GetResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.GetResponse)
+void GetBatchResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.GetBatchResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const GetResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetResponse>(
+  const GetBatchResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetBatchResponse>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.GetResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.GetBatchResponse)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.GetResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.GetBatchResponse)
     MergeFrom(*source);
   }
 }
 
-void GetResponse::MergeFrom(const GetResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.GetResponse)
+void GetBatchResponse::MergeFrom(const GetBatchResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.GetBatchResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  siblings_.MergeFrom(from.siblings_);
-  db_read_log_.MergeFrom(from.db_read_log_);
-  if (from.ins_value().size() > 0) {
-    _internal_set_ins_value(from._internal_ins_value());
-  }
-  if (from.value().size() > 0) {
-    _internal_set_value(from._internal_value());
-  }
-  if (from.has_root()) {
-    _internal_mutable_root()->::hashdb::v1::Fea::MergeFrom(from._internal_root());
-  }
-  if (from.has_key()) {
-    _internal_mutable_key()->::hashdb::v1::Fea::MergeFrom(from._internal_key());
-  }
-  if (from.has_ins_key()) {
-    _internal_mutable_ins_key()->::hashdb::v1::Fea::MergeFrom(from._internal_ins_key());
-  }
+  responses_.MergeFrom(from.responses_);
   if (from.has_result()) {
     _internal_mutable_result()->::hashdb::v1::ResultCode::MergeFrom(from._internal_result());
   }
-  if (from.proof_hash_counter() != 0) {
-    _internal_set_proof_hash_counter(from._internal_proof_hash_counter());
-  }
-  if (from.is_old0() != 0) {
-    _internal_set_is_old0(from._internal_is_old0());
-  }
 }
 
-void GetResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.GetResponse)
+void GetBatchResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.GetBatchResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void GetResponse::CopyFrom(const GetResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.GetResponse)
+void GetBatchResponse::CopyFrom(const GetBatchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.GetBatchResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetResponse::IsInitialized() const {
+bool GetBatchResponse::IsInitialized() const {
   return true;
 }
 
-void GetResponse::InternalSwap(GetResponse* other) {
+void GetBatchResponse::InternalSwap(GetBatchResponse* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  siblings_.Swap(&other->siblings_);
-  db_read_log_.Swap(&other->db_read_log_);
-  ins_value_.Swap(&other->ins_value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  value_.Swap(&other->value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetResponse, is_old0_)
-      + sizeof(GetResponse::is_old0_)
-      - PROTOBUF_FIELD_OFFSET(GetResponse, root_)>(
-          reinterpret_cast<char*>(&root_),
-          reinterpret_cast<char*>(&other->root_));
+  responses_.InternalSwap(&other->responses_);
+  swap(result_, other->result_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GetResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata GetBatchResponse::GetMetadata() const {
   return GetMetadataStatic();
 }
 
@@ -12583,6 +13641,12 @@ template<> PROTOBUF_NOINLINE ::hashdb::v1::SetRequest* Arena::CreateMaybeMessage
 template<> PROTOBUF_NOINLINE ::hashdb::v1::GetRequest* Arena::CreateMaybeMessage< ::hashdb::v1::GetRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::hashdb::v1::GetRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::hashdb::v1::SetBatchRequest* Arena::CreateMaybeMessage< ::hashdb::v1::SetBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::SetBatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetBatchRequest* Arena::CreateMaybeMessage< ::hashdb::v1::GetBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetBatchRequest >(arena);
+}
 template<> PROTOBUF_NOINLINE ::hashdb::v1::SetProgramRequest* Arena::CreateMaybeMessage< ::hashdb::v1::SetProgramRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::hashdb::v1::SetProgramRequest >(arena);
 }
@@ -12649,6 +13713,12 @@ template<> PROTOBUF_NOINLINE ::hashdb::v1::GetResponse_DbReadLogEntry_DoNotUse*
 template<> PROTOBUF_NOINLINE ::hashdb::v1::GetResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::hashdb::v1::GetResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::hashdb::v1::SetBatchResponse* Arena::CreateMaybeMessage< ::hashdb::v1::SetBatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::SetBatchResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetBatchResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetBatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetBatchResponse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::hashdb::v1::SetProgramResponse* Arena::CreateMaybeMessage< ::hashdb::v1::SetProgramResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::hashdb::v1::SetProgramResponse >(arena);
 }
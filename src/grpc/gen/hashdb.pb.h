@@ -52,7 +52,7 @@ struct TableStruct_hashdb_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[44]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[48]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -94,6 +94,12 @@ extern FlushRequestDefaultTypeInternal _FlushRequest_default_instance_;
 class FlushResponse;
 class FlushResponseDefaultTypeInternal;
 extern FlushResponseDefaultTypeInternal _FlushResponse_default_instance_;
+class GetBatchRequest;
+class GetBatchRequestDefaultTypeInternal;
+extern GetBatchRequestDefaultTypeInternal _GetBatchRequest_default_instance_;
+class GetBatchResponse;
+class GetBatchResponseDefaultTypeInternal;
+extern GetBatchResponseDefaultTypeInternal _GetBatchResponse_default_instance_;
 class GetFlushDataRequest;
 class GetFlushDataRequestDefaultTypeInternal;
 extern GetFlushDataRequestDefaultTypeInternal _GetFlushDataRequest_default_instance_;
@@ -166,6 +172,12 @@ extern ResetDBResponseDefaultTypeInternal _ResetDBResponse_default_instance_;
 class ResultCode;
 class ResultCodeDefaultTypeInternal;
 extern ResultCodeDefaultTypeInternal _ResultCode_default_instance_;
+class SetBatchRequest;
+class SetBatchRequestDefaultTypeInternal;
+extern SetBatchRequestDefaultTypeInternal _SetBatchRequest_default_instance_;
+class SetBatchResponse;
+class SetBatchResponseDefaultTypeInternal;
+extern SetBatchResponseDefaultTypeInternal _SetBatchResponse_default_instance_;
 class SetProgramRequest;
 class SetProgramRequestDefaultTypeInternal;
 extern SetProgramRequestDefaultTypeInternal _SetProgramRequest_default_instance_;
@@ -207,6 +219,8 @@ template<> ::hashdb::v1::FinishBlockRequest* Arena::CreateMaybeMessage<::hashdb:
 template<> ::hashdb::v1::FinishTxRequest* Arena::CreateMaybeMessage<::hashdb::v1::FinishTxRequest>(Arena*);
 template<> ::hashdb::v1::FlushRequest* Arena::CreateMaybeMessage<::hashdb::v1::FlushRequest>(Arena*);
 template<> ::hashdb::v1::FlushResponse* Arena::CreateMaybeMessage<::hashdb::v1::FlushResponse>(Arena*);
+template<> ::hashdb::v1::GetBatchRequest* Arena::CreateMaybeMessage<::hashdb::v1::GetBatchRequest>(Arena*);
+template<> ::hashdb::v1::GetBatchResponse* Arena::CreateMaybeMessage<::hashdb::v1::GetBatchResponse>(Arena*);
 template<> ::hashdb::v1::GetFlushDataRequest* Arena::CreateMaybeMessage<::hashdb::v1::GetFlushDataRequest>(Arena*);
 template<> ::hashdb::v1::GetFlushDataResponse* Arena::CreateMaybeMessage<::hashdb::v1::GetFlushDataResponse>(Arena*);
 template<> ::hashdb::v1::GetFlushDataResponse_NodesEntry_DoNotUse* Arena::CreateMaybeMessage<::hashdb::v1::GetFlushDataResponse_NodesEntry_DoNotUse>(Arena*);
@@ -231,6 +245,8 @@ template<> ::hashdb::v1::ReadTreeRequest* Arena::CreateMaybeMessage<::hashdb::v1
 template<> ::hashdb::v1::ReadTreeResponse* Arena::CreateMaybeMessage<::hashdb::v1::ReadTreeResponse>(Arena*);
 template<> ::hashdb::v1::ResetDBResponse* Arena::CreateMaybeMessage<::hashdb::v1::ResetDBResponse>(Arena*);
 template<> ::hashdb::v1::ResultCode* Arena::CreateMaybeMessage<::hashdb::v1::ResultCode>(Arena*);
+template<> ::hashdb::v1::SetBatchRequest* Arena::CreateMaybeMessage<::hashdb::v1::SetBatchRequest>(Arena*);
+template<> ::hashdb::v1::SetBatchResponse* Arena::CreateMaybeMessage<::hashdb::v1::SetBatchResponse>(Arena*);
 template<> ::hashdb::v1::SetProgramRequest* Arena::CreateMaybeMessage<::hashdb::v1::SetProgramRequest>(Arena*);
 template<> ::hashdb::v1::SetProgramResponse* Arena::CreateMaybeMessage<::hashdb::v1::SetProgramResponse>(Arena*);
 template<> ::hashdb::v1::SetRequest* Arena::CreateMaybeMessage<::hashdb::v1::SetRequest>(Arena*);
@@ -944,6 +960,309 @@ class GetRequest PROTOBUF_FINAL :
 };
 // -------------------------------------------------------------------
 
+class SetBatchRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hashdb.v1.SetBatchRequest) */ {
+ public:
+  inline SetBatchRequest() : SetBatchRequest(nullptr) {};
+  virtual ~SetBatchRequest();
+
+  SetBatchRequest(const SetBatchRequest& from);
+  SetBatchRequest(SetBatchRequest&& from) noexcept
+    : SetBatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SetBatchRequest& operator=(const SetBatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetBatchRequest& operator=(SetBatchRequest&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const SetBatchRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const SetBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const SetBatchRequest*>(
+               &_SetBatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(SetBatchRequest& a, SetBatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetBatchRequest* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetBatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline SetBatchRequest* New() const final {
+    return CreateMaybeMessage<SetBatchRequest>(nullptr);
+  }
+
+  SetBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<SetBatchRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const SetBatchRequest& from);
+  void MergeFrom(const SetBatchRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetBatchRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hashdb.v1.SetBatchRequest";
+  }
+  protected:
+  explicit SetBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_hashdb_2eproto);
+    return ::descriptor_table_hashdb_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestsFieldNumber = 1,
+    kChainRootsFieldNumber = 2,
+  };
+  // repeated .hashdb.v1.SetRequest requests = 1;
+  int requests_size() const;
+  private:
+  int _internal_requests_size() const;
+  public:
+  void clear_requests();
+  ::hashdb::v1::SetRequest* mutable_requests(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetRequest >*
+      mutable_requests();
+  private:
+  const ::hashdb::v1::SetRequest& _internal_requests(int index) const;
+  ::hashdb::v1::SetRequest* _internal_add_requests();
+  public:
+  const ::hashdb::v1::SetRequest& requests(int index) const;
+  ::hashdb::v1::SetRequest* add_requests();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetRequest >&
+      requests() const;
+
+  // bool chain_roots = 2;
+  void clear_chain_roots();
+  bool chain_roots() const;
+  void set_chain_roots(bool value);
+  private:
+  bool _internal_chain_roots() const;
+  void _internal_set_chain_roots(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hashdb.v1.SetBatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetRequest > requests_;
+  bool chain_roots_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_hashdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetBatchRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hashdb.v1.GetBatchRequest) */ {
+ public:
+  inline GetBatchRequest() : GetBatchRequest(nullptr) {};
+  virtual ~GetBatchRequest();
+
+  GetBatchRequest(const GetBatchRequest& from);
+  GetBatchRequest(GetBatchRequest&& from) noexcept
+    : GetBatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetBatchRequest& operator=(const GetBatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetBatchRequest& operator=(GetBatchRequest&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GetBatchRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const GetBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const GetBatchRequest*>(
+               &_GetBatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(GetBatchRequest& a, GetBatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetBatchRequest* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetBatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetBatchRequest* New() const final {
+    return CreateMaybeMessage<GetBatchRequest>(nullptr);
+  }
+
+  GetBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GetBatchRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GetBatchRequest& from);
+  void MergeFrom(const GetBatchRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetBatchRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hashdb.v1.GetBatchRequest";
+  }
+  protected:
+  explicit GetBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_hashdb_2eproto);
+    return ::descriptor_table_hashdb_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestsFieldNumber = 1,
+  };
+  // repeated .hashdb.v1.GetRequest requests = 1;
+  int requests_size() const;
+  private:
+  int _internal_requests_size() const;
+  public:
+  void clear_requests();
+  ::hashdb::v1::GetRequest* mutable_requests(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetRequest >*
+      mutable_requests();
+  private:
+  const ::hashdb::v1::GetRequest& _internal_requests(int index) const;
+  ::hashdb::v1::GetRequest* _internal_add_requests();
+  public:
+  const ::hashdb::v1::GetRequest& requests(int index) const;
+  ::hashdb::v1::GetRequest* add_requests();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetRequest >&
+      requests() const;
+
+  // @@protoc_insertion_point(class_scope:hashdb.v1.GetBatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetRequest > requests_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_hashdb_2eproto;
+};
+// -------------------------------------------------------------------
+
 class SetProgramRequest PROTOBUF_FINAL :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hashdb.v1.SetProgramRequest) */ {
  public:
@@ -986,7 +1305,7 @@ class SetProgramRequest PROTOBUF_FINAL :
                &_SetProgramRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    5;
 
   friend void swap(SetProgramRequest& a, SetProgramRequest& b) {
     a.Swap(&b);
@@ -1219,7 +1538,7 @@ class GetProgramRequest PROTOBUF_FINAL :
                &_GetProgramRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    6;
 
   friend void swap(GetProgramRequest& a, GetProgramRequest& b) {
     a.Swap(&b);
@@ -1424,7 +1743,7 @@ class LoadDBRequest PROTOBUF_FINAL :
                &_LoadDBRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    8;
 
   friend void swap(LoadDBRequest& a, LoadDBRequest& b) {
     a.Swap(&b);
@@ -1638,7 +1957,7 @@ class LoadProgramDBRequest PROTOBUF_FINAL :
                &_LoadProgramDBRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    10;
 
   friend void swap(LoadProgramDBRequest& a, LoadProgramDBRequest& b) {
     a.Swap(&b);
@@ -1800,7 +2119,7 @@ class FlushRequest PROTOBUF_FINAL :
                &_FlushRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    11;
 
   friend void swap(FlushRequest& a, FlushRequest& b) {
     a.Swap(&b);
@@ -1991,7 +2310,7 @@ class FinishTxRequest PROTOBUF_FINAL :
                &_FinishTxRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    12;
 
   friend void swap(FinishTxRequest& a, FinishTxRequest& b) {
     a.Swap(&b);
@@ -2182,7 +2501,7 @@ class StartBlockRequest PROTOBUF_FINAL :
                &_StartBlockRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    13;
 
   friend void swap(StartBlockRequest& a, StartBlockRequest& b) {
     a.Swap(&b);
@@ -2373,7 +2692,7 @@ class FinishBlockRequest PROTOBUF_FINAL :
                &_FinishBlockRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    14;
 
   friend void swap(FinishBlockRequest& a, FinishBlockRequest& b) {
     a.Swap(&b);
@@ -2564,7 +2883,7 @@ class GetFlushDataRequest PROTOBUF_FINAL :
                &_GetFlushDataRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    13;
+    15;
 
   friend void swap(GetFlushDataRequest& a, GetFlushDataRequest& b) {
     a.Swap(&b);
@@ -2701,7 +3020,7 @@ class ConsolidateStateRequest PROTOBUF_FINAL :
                &_ConsolidateStateRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    14;
+    16;
 
   friend void swap(ConsolidateStateRequest& a, ConsolidateStateRequest& b) {
     a.Swap(&b);
@@ -2858,7 +3177,7 @@ class PurgeRequest PROTOBUF_FINAL :
                &_PurgeRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    15;
+    17;
 
   friend void swap(PurgeRequest& a, PurgeRequest& b) {
     a.Swap(&b);
@@ -3042,7 +3361,7 @@ class ReadTreeRequest PROTOBUF_FINAL :
                &_ReadTreeRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    16;
+    18;
 
   friend void swap(ReadTreeRequest& a, ReadTreeRequest& b) {
     a.Swap(&b);
@@ -3208,7 +3527,7 @@ class CancelBatchRequest PROTOBUF_FINAL :
                &_CancelBatchRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    17;
+    19;
 
   friend void swap(CancelBatchRequest& a, CancelBatchRequest& b) {
     a.Swap(&b);
@@ -3361,7 +3680,7 @@ class GetLatestStateRootResponse PROTOBUF_FINAL :
                &_GetLatestStateRootResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    18;
+    20;
 
   friend void swap(GetLatestStateRootResponse& a, GetLatestStateRootResponse& b) {
     a.Swap(&b);
@@ -3589,7 +3908,7 @@ class SetResponse PROTOBUF_FINAL :
                &_SetResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    21;
+    23;
 
   friend void swap(SetResponse& a, SetResponse& b) {
     a.Swap(&b);
@@ -4096,7 +4415,7 @@ class GetResponse PROTOBUF_FINAL :
                &_GetResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    24;
+    26;
 
   friend void swap(GetResponse& a, GetResponse& b) {
     a.Swap(&b);
@@ -4335,51 +4654,383 @@ class GetResponse PROTOBUF_FINAL :
       ::hashdb::v1::ResultCode* result);
   ::hashdb::v1::ResultCode* unsafe_arena_release_result();
 
-  // uint64 proof_hash_counter = 8;
-  void clear_proof_hash_counter();
-  ::PROTOBUF_NAMESPACE_ID::uint64 proof_hash_counter() const;
-  void set_proof_hash_counter(::PROTOBUF_NAMESPACE_ID::uint64 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_proof_hash_counter() const;
-  void _internal_set_proof_hash_counter(::PROTOBUF_NAMESPACE_ID::uint64 value);
-  public:
-
-  // bool is_old0 = 6;
-  void clear_is_old0();
-  bool is_old0() const;
-  void set_is_old0(bool value);
-  private:
-  bool _internal_is_old0() const;
-  void _internal_set_is_old0(bool value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:hashdb.v1.GetResponse)
+  // uint64 proof_hash_counter = 8;
+  void clear_proof_hash_counter();
+  ::PROTOBUF_NAMESPACE_ID::uint64 proof_hash_counter() const;
+  void set_proof_hash_counter(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_proof_hash_counter() const;
+  void _internal_set_proof_hash_counter(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // bool is_old0 = 6;
+  void clear_is_old0();
+  bool is_old0() const;
+  void set_is_old0(bool value);
+  private:
+  bool _internal_is_old0() const;
+  void _internal_set_is_old0(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hashdb.v1.GetResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      GetResponse_SiblingsEntry_DoNotUse,
+      ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > siblings_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      GetResponse_DbReadLogEntry_DoNotUse,
+      std::string, ::hashdb::v1::FeList,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > db_read_log_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ins_value_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  ::hashdb::v1::Fea* root_;
+  ::hashdb::v1::Fea* key_;
+  ::hashdb::v1::Fea* ins_key_;
+  ::hashdb::v1::ResultCode* result_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 proof_hash_counter_;
+  bool is_old0_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_hashdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetBatchResponse PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hashdb.v1.SetBatchResponse) */ {
+ public:
+  inline SetBatchResponse() : SetBatchResponse(nullptr) {};
+  virtual ~SetBatchResponse();
+
+  SetBatchResponse(const SetBatchResponse& from);
+  SetBatchResponse(SetBatchResponse&& from) noexcept
+    : SetBatchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SetBatchResponse& operator=(const SetBatchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetBatchResponse& operator=(SetBatchResponse&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const SetBatchResponse& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const SetBatchResponse* internal_default_instance() {
+    return reinterpret_cast<const SetBatchResponse*>(
+               &_SetBatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(SetBatchResponse& a, SetBatchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetBatchResponse* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetBatchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline SetBatchResponse* New() const final {
+    return CreateMaybeMessage<SetBatchResponse>(nullptr);
+  }
+
+  SetBatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<SetBatchResponse>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const SetBatchResponse& from);
+  void MergeFrom(const SetBatchResponse& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetBatchResponse* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hashdb.v1.SetBatchResponse";
+  }
+  protected:
+  explicit SetBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_hashdb_2eproto);
+    return ::descriptor_table_hashdb_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponsesFieldNumber = 1,
+    kResultFieldNumber = 2,
+  };
+  // repeated .hashdb.v1.SetResponse responses = 1;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::hashdb::v1::SetResponse* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetResponse >*
+      mutable_responses();
+  private:
+  const ::hashdb::v1::SetResponse& _internal_responses(int index) const;
+  ::hashdb::v1::SetResponse* _internal_add_responses();
+  public:
+  const ::hashdb::v1::SetResponse& responses(int index) const;
+  ::hashdb::v1::SetResponse* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetResponse >&
+      responses() const;
+
+  // .hashdb.v1.ResultCode result = 2;
+  bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
+  void clear_result();
+  const ::hashdb::v1::ResultCode& result() const;
+  ::hashdb::v1::ResultCode* release_result();
+  ::hashdb::v1::ResultCode* mutable_result();
+  void set_allocated_result(::hashdb::v1::ResultCode* result);
+  private:
+  const ::hashdb::v1::ResultCode& _internal_result() const;
+  ::hashdb::v1::ResultCode* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::hashdb::v1::ResultCode* result);
+  ::hashdb::v1::ResultCode* unsafe_arena_release_result();
+
+  // @@protoc_insertion_point(class_scope:hashdb.v1.SetBatchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetResponse > responses_;
+  ::hashdb::v1::ResultCode* result_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_hashdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetBatchResponse PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hashdb.v1.GetBatchResponse) */ {
+ public:
+  inline GetBatchResponse() : GetBatchResponse(nullptr) {};
+  virtual ~GetBatchResponse();
+
+  GetBatchResponse(const GetBatchResponse& from);
+  GetBatchResponse(GetBatchResponse&& from) noexcept
+    : GetBatchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetBatchResponse& operator=(const GetBatchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetBatchResponse& operator=(GetBatchResponse&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GetBatchResponse& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const GetBatchResponse* internal_default_instance() {
+    return reinterpret_cast<const GetBatchResponse*>(
+               &_GetBatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(GetBatchResponse& a, GetBatchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetBatchResponse* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetBatchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetBatchResponse* New() const final {
+    return CreateMaybeMessage<GetBatchResponse>(nullptr);
+  }
+
+  GetBatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GetBatchResponse>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GetBatchResponse& from);
+  void MergeFrom(const GetBatchResponse& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetBatchResponse* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hashdb.v1.GetBatchResponse";
+  }
+  protected:
+  explicit GetBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_hashdb_2eproto);
+    return ::descriptor_table_hashdb_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponsesFieldNumber = 1,
+    kResultFieldNumber = 2,
+  };
+  // repeated .hashdb.v1.GetResponse responses = 1;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::hashdb::v1::GetResponse* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetResponse >*
+      mutable_responses();
+  private:
+  const ::hashdb::v1::GetResponse& _internal_responses(int index) const;
+  ::hashdb::v1::GetResponse* _internal_add_responses();
+  public:
+  const ::hashdb::v1::GetResponse& responses(int index) const;
+  ::hashdb::v1::GetResponse* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetResponse >&
+      responses() const;
+
+  // .hashdb.v1.ResultCode result = 2;
+  bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
+  void clear_result();
+  const ::hashdb::v1::ResultCode& result() const;
+  ::hashdb::v1::ResultCode* release_result();
+  ::hashdb::v1::ResultCode* mutable_result();
+  void set_allocated_result(::hashdb::v1::ResultCode* result);
+  private:
+  const ::hashdb::v1::ResultCode& _internal_result() const;
+  ::hashdb::v1::ResultCode* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::hashdb::v1::ResultCode* result);
+  ::hashdb::v1::ResultCode* unsafe_arena_release_result();
+
+  // @@protoc_insertion_point(class_scope:hashdb.v1.GetBatchResponse)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-      GetResponse_SiblingsEntry_DoNotUse,
-      ::PROTOBUF_NAMESPACE_ID::uint64, ::hashdb::v1::SiblingList,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
-      0 > siblings_;
-  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-      GetResponse_DbReadLogEntry_DoNotUse,
-      std::string, ::hashdb::v1::FeList,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
-      0 > db_read_log_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ins_value_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  ::hashdb::v1::Fea* root_;
-  ::hashdb::v1::Fea* key_;
-  ::hashdb::v1::Fea* ins_key_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetResponse > responses_;
   ::hashdb::v1::ResultCode* result_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 proof_hash_counter_;
-  bool is_old0_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_hashdb_2eproto;
 };
@@ -4427,7 +5078,7 @@ class SetProgramResponse PROTOBUF_FINAL :
                &_SetProgramResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    25;
+    29;
 
   friend void swap(SetProgramResponse& a, SetProgramResponse& b) {
     a.Swap(&b);
@@ -4573,7 +5224,7 @@ class GetProgramResponse PROTOBUF_FINAL :
                &_GetProgramResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    26;
+    30;
 
   friend void swap(GetProgramResponse& a, GetProgramResponse& b) {
     a.Swap(&b);
@@ -4746,7 +5397,7 @@ class FlushResponse PROTOBUF_FINAL :
                &_FlushResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    27;
+    31;
 
   friend void swap(FlushResponse& a, FlushResponse& b) {
     a.Swap(&b);
@@ -4914,7 +5565,7 @@ class GetFlushStatusResponse PROTOBUF_FINAL :
                &_GetFlushStatusResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    28;
+    32;
 
   friend void swap(GetFlushStatusResponse& a, GetFlushStatusResponse& b) {
     a.Swap(&b);
@@ -5212,7 +5863,7 @@ class GetFlushDataResponse PROTOBUF_FINAL :
                &_GetFlushDataResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    31;
+    35;
 
   friend void swap(GetFlushDataResponse& a, GetFlushDataResponse& b) {
     a.Swap(&b);
@@ -5445,7 +6096,7 @@ class ConsolidateStateResponse PROTOBUF_FINAL :
                &_ConsolidateStateResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    32;
+    36;
 
   friend void swap(ConsolidateStateResponse& a, ConsolidateStateResponse& b) {
     a.Swap(&b);
@@ -5633,7 +6284,7 @@ class PurgeResponse PROTOBUF_FINAL :
                &_PurgeResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    33;
+    37;
 
   friend void swap(PurgeResponse& a, PurgeResponse& b) {
     a.Swap(&b);
@@ -5779,7 +6430,7 @@ class ReadTreeResponse PROTOBUF_FINAL :
                &_ReadTreeResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    34;
+    38;
 
   friend void swap(ReadTreeResponse& a, ReadTreeResponse& b) {
     a.Swap(&b);
@@ -5965,7 +6616,7 @@ class CancelBatchResponse PROTOBUF_FINAL :
                &_CancelBatchResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    35;
+    39;
 
   friend void swap(CancelBatchResponse& a, CancelBatchResponse& b) {
     a.Swap(&b);
@@ -6111,7 +6762,7 @@ class ResetDBResponse PROTOBUF_FINAL :
                &_ResetDBResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    36;
+    40;
 
   friend void swap(ResetDBResponse& a, ResetDBResponse& b) {
     a.Swap(&b);
@@ -6257,7 +6908,7 @@ class Fea PROTOBUF_FINAL :
                &_Fea_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    37;
+    41;
 
   friend void swap(Fea& a, Fea& b) {
     a.Swap(&b);
@@ -6427,7 +7078,7 @@ class Fea12 PROTOBUF_FINAL :
                &_Fea12_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    38;
+    42;
 
   friend void swap(Fea12& a, Fea12& b) {
     a.Swap(&b);
@@ -6685,7 +7336,7 @@ class HashValueGL PROTOBUF_FINAL :
                &_HashValueGL_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    39;
+    43;
 
   friend void swap(HashValueGL& a, HashValueGL& b) {
     a.Swap(&b);
@@ -6851,7 +7502,7 @@ class KeyValue PROTOBUF_FINAL :
                &_KeyValue_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    40;
+    44;
 
   friend void swap(KeyValue& a, KeyValue& b) {
     a.Swap(&b);
@@ -7024,7 +7675,7 @@ class FeList PROTOBUF_FINAL :
                &_FeList_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    41;
+    45;
 
   friend void swap(FeList& a, FeList& b) {
     a.Swap(&b);
@@ -7175,7 +7826,7 @@ class SiblingList PROTOBUF_FINAL :
                &_SiblingList_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    42;
+    46;
 
   friend void swap(SiblingList& a, SiblingList& b) {
     a.Swap(&b);
@@ -7326,7 +7977,7 @@ class ResultCode PROTOBUF_FINAL :
                &_ResultCode_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    43;
+    47;
 
   friend void swap(ResultCode& a, ResultCode& b) {
     a.Swap(&b);
@@ -8266,6 +8917,112 @@ inline void GetRequest::unsafe_arena_set_allocated_batch_uuid(
 
 // -------------------------------------------------------------------
 
+// SetBatchRequest
+
+// repeated .hashdb.v1.SetRequest requests = 1;
+inline int SetBatchRequest::_internal_requests_size() const {
+  return requests_.size();
+}
+inline int SetBatchRequest::requests_size() const {
+  return _internal_requests_size();
+}
+inline void SetBatchRequest::clear_requests() {
+  requests_.Clear();
+}
+inline ::hashdb::v1::SetRequest* SetBatchRequest::mutable_requests(int index) {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.SetBatchRequest.requests)
+  return requests_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetRequest >*
+SetBatchRequest::mutable_requests() {
+  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.SetBatchRequest.requests)
+  return &requests_;
+}
+inline const ::hashdb::v1::SetRequest& SetBatchRequest::_internal_requests(int index) const {
+  return requests_.Get(index);
+}
+inline const ::hashdb::v1::SetRequest& SetBatchRequest::requests(int index) const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetBatchRequest.requests)
+  return _internal_requests(index);
+}
+inline ::hashdb::v1::SetRequest* SetBatchRequest::_internal_add_requests() {
+  return requests_.Add();
+}
+inline ::hashdb::v1::SetRequest* SetBatchRequest::add_requests() {
+  // @@protoc_insertion_point(field_add:hashdb.v1.SetBatchRequest.requests)
+  return _internal_add_requests();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetRequest >&
+SetBatchRequest::requests() const {
+  // @@protoc_insertion_point(field_list:hashdb.v1.SetBatchRequest.requests)
+  return requests_;
+}
+
+// bool chain_roots = 2;
+inline void SetBatchRequest::clear_chain_roots() {
+  chain_roots_ = false;
+}
+inline bool SetBatchRequest::_internal_chain_roots() const {
+  return chain_roots_;
+}
+inline bool SetBatchRequest::chain_roots() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetBatchRequest.chain_roots)
+  return _internal_chain_roots();
+}
+inline void SetBatchRequest::_internal_set_chain_roots(bool value) {
+  
+  chain_roots_ = value;
+}
+inline void SetBatchRequest::set_chain_roots(bool value) {
+  _internal_set_chain_roots(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.SetBatchRequest.chain_roots)
+}
+
+// -------------------------------------------------------------------
+
+// GetBatchRequest
+
+// repeated .hashdb.v1.GetRequest requests = 1;
+inline int GetBatchRequest::_internal_requests_size() const {
+  return requests_.size();
+}
+inline int GetBatchRequest::requests_size() const {
+  return _internal_requests_size();
+}
+inline void GetBatchRequest::clear_requests() {
+  requests_.Clear();
+}
+inline ::hashdb::v1::GetRequest* GetBatchRequest::mutable_requests(int index) {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetBatchRequest.requests)
+  return requests_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetRequest >*
+GetBatchRequest::mutable_requests() {
+  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.GetBatchRequest.requests)
+  return &requests_;
+}
+inline const ::hashdb::v1::GetRequest& GetBatchRequest::_internal_requests(int index) const {
+  return requests_.Get(index);
+}
+inline const ::hashdb::v1::GetRequest& GetBatchRequest::requests(int index) const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetBatchRequest.requests)
+  return _internal_requests(index);
+}
+inline ::hashdb::v1::GetRequest* GetBatchRequest::_internal_add_requests() {
+  return requests_.Add();
+}
+inline ::hashdb::v1::GetRequest* GetBatchRequest::add_requests() {
+  // @@protoc_insertion_point(field_add:hashdb.v1.GetBatchRequest.requests)
+  return _internal_add_requests();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetRequest >&
+GetBatchRequest::requests() const {
+  // @@protoc_insertion_point(field_list:hashdb.v1.GetBatchRequest.requests)
+  return requests_;
+}
+
+// -------------------------------------------------------------------
+
 // SetProgramRequest
 
 // .hashdb.v1.Fea key = 1;
@@ -11953,6 +12710,254 @@ inline void GetResponse::set_allocated_result(::hashdb::v1::ResultCode* result)
 
 // -------------------------------------------------------------------
 
+// SetBatchResponse
+
+// repeated .hashdb.v1.SetResponse responses = 1;
+inline int SetBatchResponse::_internal_responses_size() const {
+  return responses_.size();
+}
+inline int SetBatchResponse::responses_size() const {
+  return _internal_responses_size();
+}
+inline void SetBatchResponse::clear_responses() {
+  responses_.Clear();
+}
+inline ::hashdb::v1::SetResponse* SetBatchResponse::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.SetBatchResponse.responses)
+  return responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetResponse >*
+SetBatchResponse::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.SetBatchResponse.responses)
+  return &responses_;
+}
+inline const ::hashdb::v1::SetResponse& SetBatchResponse::_internal_responses(int index) const {
+  return responses_.Get(index);
+}
+inline const ::hashdb::v1::SetResponse& SetBatchResponse::responses(int index) const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetBatchResponse.responses)
+  return _internal_responses(index);
+}
+inline ::hashdb::v1::SetResponse* SetBatchResponse::_internal_add_responses() {
+  return responses_.Add();
+}
+inline ::hashdb::v1::SetResponse* SetBatchResponse::add_responses() {
+  // @@protoc_insertion_point(field_add:hashdb.v1.SetBatchResponse.responses)
+  return _internal_add_responses();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetResponse >&
+SetBatchResponse::responses() const {
+  // @@protoc_insertion_point(field_list:hashdb.v1.SetBatchResponse.responses)
+  return responses_;
+}
+
+// .hashdb.v1.ResultCode result = 2;
+inline bool SetBatchResponse::_internal_has_result() const {
+  return this != internal_default_instance() && result_ != nullptr;
+}
+inline bool SetBatchResponse::has_result() const {
+  return _internal_has_result();
+}
+inline void SetBatchResponse::clear_result() {
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
+}
+inline const ::hashdb::v1::ResultCode& SetBatchResponse::_internal_result() const {
+  const ::hashdb::v1::ResultCode* p = result_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
+      &::hashdb::v1::_ResultCode_default_instance_);
+}
+inline const ::hashdb::v1::ResultCode& SetBatchResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetBatchResponse.result)
+  return _internal_result();
+}
+inline void SetBatchResponse::unsafe_arena_set_allocated_result(
+    ::hashdb::v1::ResultCode* result) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+  }
+  result_ = result;
+  if (result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.SetBatchResponse.result)
+}
+inline ::hashdb::v1::ResultCode* SetBatchResponse::release_result() {
+  auto temp = unsafe_arena_release_result();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::hashdb::v1::ResultCode* SetBatchResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.SetBatchResponse.result)
+  
+  ::hashdb::v1::ResultCode* temp = result_;
+  result_ = nullptr;
+  return temp;
+}
+inline ::hashdb::v1::ResultCode* SetBatchResponse::_internal_mutable_result() {
+  
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
+    result_ = p;
+  }
+  return result_;
+}
+inline ::hashdb::v1::ResultCode* SetBatchResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.SetBatchResponse.result)
+  return _internal_mutable_result();
+}
+inline void SetBatchResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.SetBatchResponse.result)
+}
+
+// -------------------------------------------------------------------
+
+// GetBatchResponse
+
+// repeated .hashdb.v1.GetResponse responses = 1;
+inline int GetBatchResponse::_internal_responses_size() const {
+  return responses_.size();
+}
+inline int GetBatchResponse::responses_size() const {
+  return _internal_responses_size();
+}
+inline void GetBatchResponse::clear_responses() {
+  responses_.Clear();
+}
+inline ::hashdb::v1::GetResponse* GetBatchResponse::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetBatchResponse.responses)
+  return responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetResponse >*
+GetBatchResponse::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.GetBatchResponse.responses)
+  return &responses_;
+}
+inline const ::hashdb::v1::GetResponse& GetBatchResponse::_internal_responses(int index) const {
+  return responses_.Get(index);
+}
+inline const ::hashdb::v1::GetResponse& GetBatchResponse::responses(int index) const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetBatchResponse.responses)
+  return _internal_responses(index);
+}
+inline ::hashdb::v1::GetResponse* GetBatchResponse::_internal_add_responses() {
+  return responses_.Add();
+}
+inline ::hashdb::v1::GetResponse* GetBatchResponse::add_responses() {
+  // @@protoc_insertion_point(field_add:hashdb.v1.GetBatchResponse.responses)
+  return _internal_add_responses();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetResponse >&
+GetBatchResponse::responses() const {
+  // @@protoc_insertion_point(field_list:hashdb.v1.GetBatchResponse.responses)
+  return responses_;
+}
+
+// .hashdb.v1.ResultCode result = 2;
+inline bool GetBatchResponse::_internal_has_result() const {
+  return this != internal_default_instance() && result_ != nullptr;
+}
+inline bool GetBatchResponse::has_result() const {
+  return _internal_has_result();
+}
+inline void GetBatchResponse::clear_result() {
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
+}
+inline const ::hashdb::v1::ResultCode& GetBatchResponse::_internal_result() const {
+  const ::hashdb::v1::ResultCode* p = result_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
+      &::hashdb::v1::_ResultCode_default_instance_);
+}
+inline const ::hashdb::v1::ResultCode& GetBatchResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetBatchResponse.result)
+  return _internal_result();
+}
+inline void GetBatchResponse::unsafe_arena_set_allocated_result(
+    ::hashdb::v1::ResultCode* result) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+  }
+  result_ = result;
+  if (result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetBatchResponse.result)
+}
+inline ::hashdb::v1::ResultCode* GetBatchResponse::release_result() {
+  auto temp = unsafe_arena_release_result();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::hashdb::v1::ResultCode* GetBatchResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.GetBatchResponse.result)
+  
+  ::hashdb::v1::ResultCode* temp = result_;
+  result_ = nullptr;
+  return temp;
+}
+inline ::hashdb::v1::ResultCode* GetBatchResponse::_internal_mutable_result() {
+  
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
+    result_ = p;
+  }
+  return result_;
+}
+inline ::hashdb::v1::ResultCode* GetBatchResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetBatchResponse.result)
+  return _internal_mutable_result();
+}
+inline void GetBatchResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetBatchResponse.result)
+}
+
+// -------------------------------------------------------------------
+
 // SetProgramResponse
 
 // .hashdb.v1.ResultCode result = 1;
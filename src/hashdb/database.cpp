@@ -33,6 +33,7 @@ bool Database::useAssociativeCache = false;
 
 // Helper functions
 string removeBSXIfExists(string s) {return ((s.at(0) == '\\') && (s.at(1) == 'x')) ? s.substr(2) : s;}
+static string normalizeKey(const string &key) { return stringToLower(NormalizeToNFormat(key, 64)); }
 
 Database::Database (Goldilocks &fr, const Config &config) :
         fr(fr),
@@ -123,29 +124,30 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
 
     zkresult r = ZKR_UNSPECIFIED;
 
-    // Normalize key format
-    string key = NormalizeToNFormat(_key, 64);
-    key = stringToLower(key);
+    // In-memory lookups use the binary key; the normalized hex key is only built for the SQL
+    // database and the read log
+    DatabaseKey binaryKey(vkey);
+    string key;
 
 #ifdef DATABASE_USE_CACHE
     // If the key is found in local database (cached) simply return it
     if(usingAssociativeCache() && dbMTACache.findKey(vkey,value)){
 
-        if (dbReadLog != NULL) dbReadLog->add(key, value, true, TimeDiff(t));
+        if (dbReadLog != NULL) dbReadLog->add(normalizeKey(_key), value, true, TimeDiff(t));
         r = ZKR_SUCCESS;
 
-    } else if( dbMTCache.enabled() && dbMTCache.find(key, value)){
+    } else if( dbMTCache.enabled() && dbMTCache.find(binaryKey, value)){
         
-        if (dbReadLog != NULL) dbReadLog->add(key, value, true, TimeDiff(t));
+        if (dbReadLog != NULL) dbReadLog->add(normalizeKey(_key), value, true, TimeDiff(t));
         r = ZKR_SUCCESS;
     }
     else
 #endif
     // If the key is pending to be stored in database, but already deleted from cache
-    if (config.dbMultiWrite && multiWrite.findNode(key, value))
+    if (config.dbMultiWrite && multiWrite.findNode(binaryKey, value))
     {
         // Add to the read log
-        if (dbReadLog != NULL) dbReadLog->add(key, value, true, TimeDiff(t));
+        if (dbReadLog != NULL) dbReadLog->add(normalizeKey(_key), value, true, TimeDiff(t));
 
 #ifdef DATABASE_USE_CACHE
         // Store it locally to avoid any future remote access for this key
@@ -153,7 +155,7 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
             dbMTACache.addKeyValue(vkey, value, false);
         }
         else if(dbMTCache.enabled()){                
-            dbMTCache.add(key, value, false);
+            dbMTCache.add(binaryKey, value, false);
         }
 #endif
         r = ZKR_SUCCESS;
@@ -161,6 +163,9 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
     // If get tree is configured, read the tree from the branch (key hash) to the leaf (keys since level)
     else if (useRemoteDB && config.dbGetTree && (keys != NULL))
     {
+        // Normalize key format
+        key = normalizeKey(_key);
+
         // Get the tree
         uint64_t numberOfFields;
         r = readTreeRemote(key, keys, level, numberOfFields);
@@ -204,7 +209,7 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
             if (usingAssociativeCache() && dbMTACache.findKey(vkey,value)){
                 if (dbReadLog != NULL) dbReadLog->add(key, value, true, TimeDiff(t));
                 r = ZKR_SUCCESS;
-            }else if(dbMTCache.enabled() && dbMTCache.find(key, value)){
+            }else if(dbMTCache.enabled() && dbMTCache.find(binaryKey, value)){
                 if (dbReadLog != NULL) dbReadLog->add(key, value, true, TimeDiff(t));
                 r = ZKR_SUCCESS;                
             }
@@ -225,6 +230,9 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
             flush(); // TODO: manage this situation
         }*/
 
+        // Normalize key format
+        if (key.empty()) key = normalizeKey(_key);
+
         // Otherwise, read it remotelly, up to two times
         string sData;
         r = readRemote(false, key, sData);
@@ -253,7 +261,7 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
             if(usingAssociativeCache()){
                 dbMTACache.addKeyValue(vkey, value, update);
             }else if (dbMTCache.enabled()){
-                dbMTCache.add(key, value, update);
+                dbMTCache.add(binaryKey, value, update);
             }
 #endif
 
@@ -265,7 +273,7 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
     // If we could not find the value, report the error
     if (r == ZKR_UNSPECIFIED)
     {
-        zklog.error("Database::read() requested a key that does not exist (ZKR_DB_KEY_NOT_FOUND): " + key);
+        zklog.error("Database::read() requested a key that does not exist (ZKR_DB_KEY_NOT_FOUND): " + normalizeKey(_key));
         r = ZKR_DB_KEY_NOT_FOUND;
     }
 
@@ -274,7 +282,7 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
         string s = "Database::read()";
         if (r != ZKR_SUCCESS)
             s += " ERROR=" + zkresult2string(r);
-        s += " key=" + key;
+        s += " key=" + normalizeKey(_key);
         s += " value=";
         for (uint64_t i = 0; i < value.size(); i++)
             s += fr.toString(value[i], 16) + ":";
@@ -286,6 +294,23 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
 }
 
 zkresult Database::write(const string &_key, const Goldilocks::Element* vkey, const vector<Goldilocks::Element> &value, const bool persistent)
+{
+    // Get the binary key, parsing the hex string only if the field elements were not provided
+    DatabaseKey binaryKey;
+    if (vkey != NULL)
+    {
+        binaryKey.fromFea(vkey);
+    }
+    else if (!binaryKey.fromString(_key))
+    {
+        zklog.error("Database::write() got an invalid key=" + _key);
+        return ZKR_DB_ERROR;
+    }
+
+    return write(binaryKey, vkey, value, persistent);
+}
+
+zkresult Database::write(const DatabaseKey &key, const Goldilocks::Element* vkey, const vector<Goldilocks::Element> &value, const bool persistent)
 {
     // Check that it has  been initialized before
     if (!bInitialized)
@@ -302,25 +327,13 @@ zkresult Database::write(const string &_key, const Goldilocks::Element* vkey, co
 
     zkresult r;
 
-    // Normalize key format
-    string key = NormalizeToNFormat(_key, 64);
-    key = stringToLower(key);
-
     if ( useRemoteDB
 #ifdef DATABASE_USE_CACHE
          && persistent
 #endif
          )
     {
-        // Prepare the query
-        string valueString = "";
-        string aux;
-        for (uint64_t i = 0; i < value.size(); i++)
-        {
-            valueString += PrependZeros(fr.toString(value[i], 16), 16);
-        }
-
-        r = writeRemote(false, key, valueString);
+        r = writeRemoteNode(key, value);
     }
     else
     {
@@ -333,7 +346,7 @@ zkresult Database::write(const string &_key, const Goldilocks::Element* vkey, co
         if(usingAssociativeCache()){
             Goldilocks::Element vkeyf[4];
             if(vkey == NULL){
-                string2fea(fr, key, vkeyf);
+                key.toFea(vkeyf);
             }else{
                 vkeyf[0] = vkey[0];
                 vkeyf[1] = vkey[1];
@@ -352,7 +365,7 @@ zkresult Database::write(const string &_key, const Goldilocks::Element* vkey, co
         string s = "Database::write()";
         if (r != ZKR_SUCCESS)
             s += " ERROR=" + zkresult2string(r);
-        s += " key=" + key;
+        s += " key=" + key.toString();
         s += " value=";
         for (uint64_t i = 0; i < value.size(); i++)
             s += fr.toString(value[i], 16) + ":";
@@ -702,7 +715,11 @@ zkresult Database::readTreeRemote(const string &key, bool *keys, uint64_t level,
                     string2fea(fr, hash, vhash);   
                     dbMTACache.addKeyValue(vhash, value, false);
                 }else{
-                    dbMTCache.add(hash, value, false);
+                    DatabaseKey binaryHash;
+                    if (binaryHash.fromString(hash))
+                    {
+                        dbMTCache.add(binaryHash, value, false);
+                    }
               }
             }
 #endif
@@ -745,7 +762,18 @@ zkresult Database::writeRemote(bool bProgram, const string &key, const string &v
         }
         else
         {
-            multiWrite.data[multiWrite.pendingToFlushDataIndex].nodesIntray[key] = value;
+            DatabaseKey binaryKey;
+            if (binaryKey.fromString(key))
+            {
+                vector<Goldilocks::Element> fea;
+                string2fea(fr, value, fea);
+                multiWrite.data[multiWrite.pendingToFlushDataIndex].nodesIntray[binaryKey] = fea;
+            }
+            else
+            {
+                zklog.error("Database::writeRemote() got an invalid key=" + key);
+                result = ZKR_DB_ERROR;
+            }
         }
 
         multiWrite.Unlock();
@@ -791,6 +819,20 @@ zkresult Database::writeRemote(bool bProgram, const string &key, const string &v
     return result;
 }
 
+zkresult Database::writeRemoteNode(const DatabaseKey &key, const vector<Goldilocks::Element> &value)
+{
+    // Multi write keeps the binary key and value until the SQL query is built in sendData()
+    if (config.dbMultiWrite)
+    {
+        multiWrite.Lock();
+        multiWrite.data[multiWrite.pendingToFlushDataIndex].nodesIntray[key] = value;
+        multiWrite.Unlock();
+        return ZKR_SUCCESS;
+    }
+
+    return writeRemote(false, key.toString(), dbValue2string(value));
+}
+
 zkresult Database::createStateRoot(void)
 {
     // Copy the state root in the first 4 elements of dbValue
@@ -938,7 +980,8 @@ zkresult Database::updateStateRoot(const Goldilocks::Element (&stateRoot)[4])
         if(usingAssociativeCache()){
                 dbMTACache.addKeyValue(dbStateRootvKey, value, true);
         }else{
-                dbMTCache.add(dbStateRootKey, value, true);
+                // Use the same binary key that read() derives from dbStateRootvKey
+                dbMTCache.add(DatabaseKey(dbStateRootvKey), value, true);
         }
     }
 #endif
@@ -1401,8 +1444,8 @@ zkresult Database::sendData (void)
             // If there are nodes add the corresponding query
             if (data.nodes.size() > 0)
             {
-                it = data.nodes.begin();
-                while (it != data.nodes.end())
+                DatabaseKeyMap<vector<Goldilocks::Element>>::const_iterator nodesIt = data.nodes.begin();
+                while (nodesIt != data.nodes.end())
                 {
                     // If queries is empty or last query is full, add a new query
                     if ( (data.multiQuery.queries.size() == 0) || (data.multiQuery.queries[currentQuery].full))
@@ -1414,16 +1457,16 @@ zkresult Database::sendData (void)
 
                     data.multiQuery.queries[currentQuery].query += "INSERT INTO " + config.dbNodesTableName + " ( hash, data ) VALUES ";
                     firstValue = true;
-                    for (; it != data.nodes.end(); it++)
+                    for (; nodesIt != data.nodes.end(); nodesIt++)
                     {
                         if (!firstValue)
                         {
                             data.multiQuery.queries[currentQuery].query += ", ";
                         }
                         firstValue = false;
-                        data.multiQuery.queries[currentQuery].query += "( E\'\\\\x" + it->first + "\', E\'\\\\x" + it->second + "\' ) ";
+                        data.multiQuery.queries[currentQuery].query += "( E\'\\\\x" + nodesIt->first.toString() + "\', E\'\\\\x" + dbValue2string(nodesIt->second) + "\' ) ";
 #ifdef LOG_DB_SEND_DATA
-                        zklog.info("Database::sendData() inserting node key=" + it->first + " value=" + it->second);
+                        zklog.info("Database::sendData() inserting node key=" + nodesIt->first.toString() + " value=" + dbValue2string(nodesIt->second));
 #endif
                         if (data.multiQuery.queries[currentQuery].query.size() >= config.dbMultiWriteSingleQuerySize)
                         {
@@ -1610,7 +1653,12 @@ zkresult Database::getFlushData(uint64_t flushId, uint64_t &storedFlushId, unord
 
     if (data.nodes.size() > 0)
     {
-        nodes = data.nodes;
+        nodes.reserve(data.nodes.size());
+        DatabaseKeyMap<vector<Goldilocks::Element>>::const_iterator it;
+        for (it = data.nodes.begin(); it != data.nodes.end(); it++)
+        {
+            nodes[it->first.toString()] = dbValue2string(it->second);
+        }
     }
 
     if (data.program.size() > 0)
@@ -1660,7 +1708,7 @@ void Database::printTree(const string &root, string prefix)
     string key = root;
     vector<Goldilocks::Element> value;
     Goldilocks::Element vKey[4];
-    if(Database::useAssociativeCache) string2fea(fr, key, vKey);  
+    string2fea(fr, NormalizeToNFormat(key, 64), vKey);
     read(key,vKey,value, NULL);
 
     if (value.size() != 12)
@@ -2052,7 +2100,7 @@ void loadDb2MemCache(const Config &config)
             dbValue.clear();
             Goldilocks::Element vhash[4];
             string hashNorm = NormalizeToNFormat(hash, 64);
-            if(pHashDB->db.usingAssociativeCache()) string2fea(fr, hashNorm, vhash);
+            string2fea(fr, hashNorm, vhash);
             zkresult zkr = pHashDB->db.read(hash, vhash, dbValue, NULL, true);
 
             if (zkr != ZKR_SUCCESS)
@@ -2102,8 +2150,8 @@ void loadDb2MemCache(const Config &config)
                     if (rightHash != "0")
                     {
                         //zklog.info("loadDb2MemCache() level=" + to_string(level) + " found value rightHash=" + rightHash);
-                        dbValue.clear();
                         Goldilocks::Element vRightHash[4]={dbValue[4], dbValue[5], dbValue[6], dbValue[7]};
+                        dbValue.clear();
                         zkresult zkr = pHashDB->db.read(rightHash, vRightHash, dbValue, NULL, true);
                         if (zkr != ZKR_SUCCESS)
                         {
@@ -15,6 +15,7 @@
 #include "zkassert.hpp"
 #include "multi_write.hpp"
 #include "database_associative_cache.hpp"
+#include "database_key.hpp"
 
 using namespace std;
 
@@ -63,6 +64,7 @@ private:
     zkresult readRemote(bool bProgram, const string &key, string &value);
     zkresult readTreeRemote(const string &key, bool *keys, uint64_t level, uint64_t &numberOfFields);
     zkresult writeRemote(bool bProgram, const string &key, const string &value);
+    zkresult writeRemoteNode(const DatabaseKey &key, const vector<Goldilocks::Element> &value);
     zkresult writeGetTreeFunction(void);
 
 public:
@@ -89,6 +91,7 @@ public:
     void init(void);
     zkresult read(const string &_key, Goldilocks::Element (&vkey)[4], vector<Goldilocks::Element> &value, DatabaseMap *dbReadLog, const bool update = false, bool *keys = NULL , uint64_t level=0);
     zkresult write(const string &_key, const Goldilocks::Element* vkey, const vector<Goldilocks::Element> &value, const bool persistent);
+    zkresult write(const DatabaseKey &key, const Goldilocks::Element* vkey, const vector<Goldilocks::Element> &value, const bool persistent); // vkey can be NULL
     zkresult getProgram(const string &_key, vector<uint8_t> &value, DatabaseMap *dbReadLog);
     zkresult setProgram(const string &_key, const vector<uint8_t> &value, const bool persistent);
     inline bool usingAssociativeCache(void){ return useAssociativeCache; };
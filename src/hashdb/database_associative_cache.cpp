@@ -11,8 +11,15 @@
 
 
 
+// Relaxed atomic accessors, since optimistic readers can run concurrently with the (single) writer
+static inline uint64_t loadFe(const Goldilocks::Element &fe) { return __atomic_load_n(&fe.fe, __ATOMIC_RELAXED); };
+static inline void storeFe(Goldilocks::Element &fe, uint64_t value) { __atomic_store_n(&fe.fe, value, __ATOMIC_RELAXED); };
+static inline uint32_t loadIndex(const uint32_t &index) { return __atomic_load_n(&index, __ATOMIC_RELAXED); };
+static inline void storeIndex(uint32_t &index, uint32_t value) { __atomic_store_n(&index, value, __ATOMIC_RELAXED); };
+
 DatabaseMTAssociativeCache::DatabaseMTAssociativeCache()
 {
+    sequence = 0;
     log2IndexesSize = 0;
     indexesSize = 0;
     log2CacheSize = 0;
@@ -21,12 +28,11 @@ DatabaseMTAssociativeCache::DatabaseMTAssociativeCache()
     keys = NULL;
     values = NULL;
     currentCacheIndex = 0;
-    attempts = 0;
-    hits = 0;
+    resetStats();
     name = "";
 };
 
-DatabaseMTAssociativeCache::DatabaseMTAssociativeCache(int log2IndexesSize_, int cacheSize_, string name_)
+DatabaseMTAssociativeCache::DatabaseMTAssociativeCache(int log2IndexesSize_, int cacheSize_, string name_) : DatabaseMTAssociativeCache()
 {
     postConstruct(log2IndexesSize_, cacheSize_, name_);
 };
@@ -44,7 +50,7 @@ DatabaseMTAssociativeCache::~DatabaseMTAssociativeCache()
 
 void DatabaseMTAssociativeCache::postConstruct(int log2IndexesSize_, int log2CacheSize_, string name_)
 {
-    lock_guard<recursive_mutex> guard(mlock);
+    lock_guard<mutex> guard(mlock);
     log2IndexesSize = log2IndexesSize_;
     if (log2IndexesSize_ > 32)
     {
@@ -63,32 +69,62 @@ void DatabaseMTAssociativeCache::postConstruct(int log2IndexesSize_, int log2Cac
 
     if(indexes != NULL) delete[] indexes;
     indexes = new uint32_t[indexesSize];
-    //initialization of indexes array
-    uint32_t initValue = UINT32_MAX-cacheSize-(uint32_t)1;
-    #pragma omp parallel for schedule(static) num_threads(4)
-    for (size_t i = 0; i < indexesSize; i++)
-    {
-        indexes[i] = initValue;
-    }
+    
     if(keys != NULL) delete[] keys;
     keys = new Goldilocks::Element[4 * cacheSize];
 
     if(values != NULL) delete[] values;
     values = new Goldilocks::Element[12 * cacheSize];
 
-    currentCacheIndex = 0;
-    attempts = 0;
-    hits = 0;
-    name = name_;
-    
     //masks for fast module, note cache size and indexes size must be power of 2
     cacheMask = cacheSize - 1;
     indexesMask = indexesSize - 1;
+
+    initIndexes();
+    resetStats();
+    name = name_;
 };
 
+void DatabaseMTAssociativeCache::initIndexes(void)
+{
+    //initialization of indexes array
+    uint32_t initValue = UINT32_MAX-cacheSize-(uint32_t)1;
+    #pragma omp parallel for schedule(static) num_threads(4)
+    for (size_t i = 0; i < indexesSize; i++)
+    {
+        storeIndex(indexes[i], initValue);
+    }
+    __atomic_store_n(&currentCacheIndex, 0, __ATOMIC_RELAXED);
+}
+
+void DatabaseMTAssociativeCache::clear(void)
+{
+    if (!enabled()) return;
+
+    lock_guard<mutex> guard(mlock);
+
+    // Invalidate all entries without reallocating, since optimistic readers could be accessing the arrays
+    uint64_t seq = sequence.load(memory_order_relaxed);
+    sequence.store(seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    initIndexes();
+    sequence.store(seq + 2, memory_order_release);
+
+    resetStats();
+}
+
 void DatabaseMTAssociativeCache::addKeyValue(Goldilocks::Element (&key)[4], const vector<Goldilocks::Element> &value, bool update)
 {
-    lock_guard<recursive_mutex> guard(mlock);
+    CounterStripe &counter = stripe(key);
+    counter.writes.fetch_add(1, memory_order_relaxed);
+
+    unique_lock<mutex> guard(mlock, try_to_lock);
+    if (!guard.owns_lock())
+    {
+        counter.writeContentions.fetch_add(1, memory_order_relaxed);
+        guard.lock();
+    }
+
     bool emptySlot = false;
     bool present = false;
     uint32_t cacheIndex;
@@ -119,15 +155,22 @@ void DatabaseMTAssociativeCache::addKeyValue(Goldilocks::Element (&key)[4], cons
         }
     }
 
+    //
+    // Start modifying the arrays: from now on optimistic readers will retry
+    //
+    uint64_t seq = sequence.load(memory_order_relaxed);
+    sequence.store(seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
     //
     // Evaluate cacheIndexKey and 
     //
     if(!present){
         if(emptySlot == true){
-            indexes[tableIndexEmpty] = currentCacheIndex;
+            storeIndex(indexes[tableIndexEmpty], currentCacheIndex);
         }
         cacheIndex = (uint32_t)(currentCacheIndex & cacheMask);
-        currentCacheIndex = (currentCacheIndex == UINT32_MAX) ? 0 : (currentCacheIndex + 1);
+        __atomic_store_n(&currentCacheIndex, (currentCacheIndex == UINT32_MAX) ? 0 : (currentCacheIndex + 1), __ATOMIC_RELAXED);
     }
     uint64_t cacheIndexKey, cacheIndexValue;
     cacheIndexKey = cacheIndex * 4;
@@ -136,29 +179,25 @@ void DatabaseMTAssociativeCache::addKeyValue(Goldilocks::Element (&key)[4], cons
     //
     // Add value
     //
-    keys[cacheIndexKey + 0].fe = key[0].fe;
-    keys[cacheIndexKey + 1].fe = key[1].fe;
-    keys[cacheIndexKey + 2].fe = key[2].fe;
-    keys[cacheIndexKey + 3].fe = key[3].fe;
-    values[cacheIndexValue + 0] = value[0];
-    values[cacheIndexValue + 1] = value[1];
-    values[cacheIndexValue + 2] = value[2];
-    values[cacheIndexValue + 3] = value[3];
-    values[cacheIndexValue + 4] = value[4];
-    values[cacheIndexValue + 5] = value[5];
-    values[cacheIndexValue + 6] = value[6];
-    values[cacheIndexValue + 7] = value[7];
+    storeFe(keys[cacheIndexKey + 0], key[0].fe);
+    storeFe(keys[cacheIndexKey + 1], key[1].fe);
+    storeFe(keys[cacheIndexKey + 2], key[2].fe);
+    storeFe(keys[cacheIndexKey + 3], key[3].fe);
+    for (uint64_t i = 0; i < 8; i++)
+    {
+        storeFe(values[cacheIndexValue + i], value[i].fe);
+    }
     if (value.size() > 8)
     {
-        values[cacheIndexValue + 8] = value[8];
-        values[cacheIndexValue + 9] = value[9];
-        values[cacheIndexValue + 10] = value[10];
-        values[cacheIndexValue + 11] = value[11];
+        for (uint64_t i = 8; i < 12; i++)
+        {
+            storeFe(values[cacheIndexValue + i], value[i].fe);
+        }
     }else{
-        values[cacheIndexValue + 8] = Goldilocks::zero();
-        values[cacheIndexValue + 9] = Goldilocks::zero();
-        values[cacheIndexValue + 10] = Goldilocks::zero();
-        values[cacheIndexValue + 11] = Goldilocks::zero();
+        for (uint64_t i = 8; i < 12; i++)
+        {
+            storeFe(values[cacheIndexValue + i], 0);
+        }
     }
             
     //
@@ -170,6 +209,8 @@ void DatabaseMTAssociativeCache::addKeyValue(Goldilocks::Element (&key)[4], cons
         usedRawCacheIndexes[0] = currentCacheIndex-1;
         forcedInsertion(usedRawCacheIndexes, iters);
     }
+
+    sequence.store(seq + 2, memory_order_release);
 }
 
 void DatabaseMTAssociativeCache::forcedInsertion(uint32_t (&usedRawCacheIndexes)[10], int &iters)
@@ -197,7 +238,7 @@ void DatabaseMTAssociativeCache::forcedInsertion(uint32_t (&usedRawCacheIndexes)
         uint32_t rawCacheIndex_ = (uint32_t)(indexes[tableIndex_]);
         if (emptyCacheSlot(rawCacheIndex_))
         {
-            indexes[tableIndex_] = inputRawCacheIndex;
+            storeIndex(indexes[tableIndex_], inputRawCacheIndex);
             return;
         }
         else
@@ -223,56 +264,116 @@ void DatabaseMTAssociativeCache::forcedInsertion(uint32_t (&usedRawCacheIndexes)
         zklog.error("forcedInsertion() could not continue the recursion: " + to_string(inputRawCacheIndex));
         exitProcess();
     } 
-    indexes[(uint32_t)(inputKey[pos].fe & indexesMask)] = inputRawCacheIndex;
+    storeIndex(indexes[(uint32_t)(inputKey[pos].fe & indexesMask)], inputRawCacheIndex);
     usedRawCacheIndexes[iters] = minRawCacheIndex; //new cache element to add in the indexes table
     forcedInsertion(usedRawCacheIndexes, iters);
     
 }
 
-bool DatabaseMTAssociativeCache::findKey(const Goldilocks::Element (&key)[4], vector<Goldilocks::Element> &value)
+bool DatabaseMTAssociativeCache::lookup(const Goldilocks::Element (&key)[4], Goldilocks::Element (&value)[12]) const
 {
-    lock_guard<recursive_mutex> guard(mlock);
-    attempts++; 
-    //
-    //  Statistics
-    //
-    if (attempts<<40 == 0)
-    {
-        zklog.info("DatabaseMTAssociativeCache::findKey() name=" + name + " indexesSize=" + to_string(indexesSize) + " cacheSize=" + to_string(cacheSize) + " attempts=" + to_string(attempts) + " hits=" + to_string(hits) + " hit ratio=" + to_string(double(hits) * 100.0 / double(zkmax(attempts, 1))) + "%");
-    }
-    //
-    // Find the value
-    //
+    uint32_t currentCacheIndex_ = __atomic_load_n(&currentCacheIndex, __ATOMIC_RELAXED);
     for (int i = 0; i < 4; i++)
     {
-        uint32_t cacheIndexRaw = indexes[key[i].fe & indexesMask];
-        if (emptyCacheSlot(cacheIndexRaw)) continue;
+        uint32_t cacheIndexRaw = loadIndex(indexes[key[i].fe & indexesMask]);
+        if (emptyCacheSlot(cacheIndexRaw, currentCacheIndex_)) continue;
         
         uint32_t cacheIndex = cacheIndexRaw  & cacheMask;
         uint32_t cacheIndexKey = cacheIndex * 4;
 
-        if (keys[cacheIndexKey + 0].fe == key[0].fe &&
-            keys[cacheIndexKey + 1].fe == key[1].fe &&
-            keys[cacheIndexKey + 2].fe == key[2].fe &&
-            keys[cacheIndexKey + 3].fe == key[3].fe)
+        if (loadFe(keys[cacheIndexKey + 0]) == key[0].fe &&
+            loadFe(keys[cacheIndexKey + 1]) == key[1].fe &&
+            loadFe(keys[cacheIndexKey + 2]) == key[2].fe &&
+            loadFe(keys[cacheIndexKey + 3]) == key[3].fe)
         {
             uint32_t cacheIndexValue = cacheIndex * 12;
-            ++hits;
-            value.resize(12);
-            value[0] = values[cacheIndexValue];
-            value[1] = values[cacheIndexValue + 1];
-            value[2] = values[cacheIndexValue + 2];
-            value[3] = values[cacheIndexValue + 3];
-            value[4] = values[cacheIndexValue + 4];
-            value[5] = values[cacheIndexValue + 5];
-            value[6] = values[cacheIndexValue + 6];
-            value[7] = values[cacheIndexValue + 7];
-            value[8] = values[cacheIndexValue + 8];
-            value[9] = values[cacheIndexValue + 9];
-            value[10] = values[cacheIndexValue + 10];
-            value[11] = values[cacheIndexValue + 11];
+            for (uint64_t j = 0; j < 12; j++)
+            {
+                value[j].fe = loadFe(values[cacheIndexValue + j]);
+            }
             return true;
         }
     }
     return false;
 }
+
+bool DatabaseMTAssociativeCache::findKey(const Goldilocks::Element (&key)[4], vector<Goldilocks::Element> &value)
+{
+    CounterStripe &counter = stripe(key);
+    uint64_t attempts = counter.attempts.fetch_add(1, memory_order_relaxed) + 1;
+    //
+    //  Statistics
+    //
+    if ((&counter == &counters[0]) && ((attempts<<40) == 0))
+    {
+        DatabaseMTAssociativeCacheStats stats;
+        getStats(stats);
+        zklog.info("DatabaseMTAssociativeCache::findKey() name=" + name + " indexesSize=" + to_string(indexesSize) + " cacheSize=" + to_string(cacheSize) + " attempts=" + to_string(stats.attempts) + " hits=" + to_string(stats.hits) + " hit ratio=" + to_string(stats.hitRatio()) + "%" +
+            " readRetries=" + to_string(stats.readRetries) + " readLocks=" + to_string(stats.readLocks) + " writes=" + to_string(stats.writes) + " writeContentions=" + to_string(stats.writeContentions));
+    }
+    //
+    // Find the value, optimistically
+    //
+    Goldilocks::Element auxValue[12];
+    bool found = false;
+    bool consistent = false;
+    for (uint64_t retry = 0; retry < DATABASE_MT_ASSOCIATIVE_CACHE_READ_RETRIES; retry++)
+    {
+        uint64_t seq = sequence.load(memory_order_acquire);
+        if ((seq & 1) == 0)
+        {
+            found = lookup(key, auxValue);
+            atomic_thread_fence(memory_order_acquire);
+            if (sequence.load(memory_order_relaxed) == seq)
+            {
+                consistent = true;
+                break;
+            }
+        }
+        counter.readRetries.fetch_add(1, memory_order_relaxed);
+    }
+
+    //
+    // If writers kept interfering, read under the lock
+    //
+    if (!consistent)
+    {
+        lock_guard<mutex> guard(mlock);
+        counter.readLocks.fetch_add(1, memory_order_relaxed);
+        found = lookup(key, auxValue);
+    }
+
+    if (found)
+    {
+        counter.hits.fetch_add(1, memory_order_relaxed);
+        value.assign(auxValue, auxValue + 12);
+    }
+    return found;
+}
+
+void DatabaseMTAssociativeCache::getStats(DatabaseMTAssociativeCacheStats &stats)
+{
+    stats = DatabaseMTAssociativeCacheStats();
+    for (uint64_t i = 0; i < DATABASE_MT_ASSOCIATIVE_CACHE_COUNTER_STRIPES; i++)
+    {
+        stats.attempts += counters[i].attempts.load(memory_order_relaxed);
+        stats.hits += counters[i].hits.load(memory_order_relaxed);
+        stats.readRetries += counters[i].readRetries.load(memory_order_relaxed);
+        stats.readLocks += counters[i].readLocks.load(memory_order_relaxed);
+        stats.writes += counters[i].writes.load(memory_order_relaxed);
+        stats.writeContentions += counters[i].writeContentions.load(memory_order_relaxed);
+    }
+}
+
+void DatabaseMTAssociativeCache::resetStats(void)
+{
+    for (uint64_t i = 0; i < DATABASE_MT_ASSOCIATIVE_CACHE_COUNTER_STRIPES; i++)
+    {
+        counters[i].attempts = 0;
+        counters[i].hits = 0;
+        counters[i].readRetries = 0;
+        counters[i].readLocks = 0;
+        counters[i].writes = 0;
+        counters[i].writeContentions = 0;
+    }
+}
@@ -1,6 +1,7 @@
 #ifndef DATABASE_ASSOCIATIVE_CACHE_HPP
 #define DATABASE_ASSOCIATIVE_CACHE_HPP
 #include <vector>
+#include <atomic>
 #include "goldilocks_base_field.hpp"
 #include <nlohmann/json.hpp>
 #include <mutex>
@@ -8,10 +9,36 @@
 #include "zkmax.hpp"
 
 using namespace std;
+
+#define DATABASE_MT_ASSOCIATIVE_CACHE_COUNTER_STRIPES 16 // Must be a power of 2
+#define DATABASE_MT_ASSOCIATIVE_CACHE_READ_RETRIES 8 // Optimistic read attempts before falling back to the lock
+
+class DatabaseMTAssociativeCacheStats
+{
+public:
+    uint64_t attempts; // Calls to findKey()
+    uint64_t hits; // Calls to findKey() that found the key
+    uint64_t readRetries; // Optimistic reads that had to be repeated because a writer was active
+    uint64_t readLocks; // Reads that gave up optimistic reading and took the writer lock
+    uint64_t writes; // Calls to addKeyValue()
+    uint64_t writeContentions; // Writes that found the writer lock taken
+    DatabaseMTAssociativeCacheStats() : attempts(0), hits(0), readRetries(0), readLocks(0), writes(0), writeContentions(0) {};
+    double hitRatio (void) const { return double(hits)*100.0/double(zkmax(attempts, 1)); };
+};
+
+/*
+    Concurrency model: writers are serialized by a mutex and bump a sequence counter before (odd)
+    and after (even) modifying the indexes, keys and values arrays, i.e. a seqlock.  Readers never
+    block writers: they read optimistically and retry if the sequence counter changed in between,
+    taking the lock only after DATABASE_MT_ASSOCIATIVE_CACHE_READ_RETRIES failed attempts.
+    Statistics are kept in cache-line-aligned stripes to avoid turning them into a contention point.
+*/
+
 class DatabaseMTAssociativeCache
 {
     private:
-        recursive_mutex mlock;
+        mutex mlock;
+        atomic<uint64_t> sequence;
 
         int log2IndexesSize;
         uint32_t indexesSize;
@@ -21,10 +48,18 @@ class DatabaseMTAssociativeCache
         uint32_t *indexes;
         Goldilocks::Element *keys;
         Goldilocks::Element *values;
-        uint32_t currentCacheIndex; 
+        uint32_t currentCacheIndex;
 
-        uint64_t attempts;
-        uint64_t hits;
+        struct alignas(64) CounterStripe
+        {
+            atomic<uint64_t> attempts;
+            atomic<uint64_t> hits;
+            atomic<uint64_t> readRetries;
+            atomic<uint64_t> readLocks;
+            atomic<uint64_t> writes;
+            atomic<uint64_t> writeContentions;
+        };
+        CounterStripe counters[DATABASE_MT_ASSOCIATIVE_CACHE_COUNTER_STRIPES];
         string name;
 
         uint64_t indexesMask;
@@ -43,17 +78,19 @@ class DatabaseMTAssociativeCache
         inline bool enabled() const { return (log2IndexesSize > 0); };
         inline uint32_t getCacheSize()  const { return cacheSize; };
         inline uint32_t getIndexesSize() const { return indexesSize; };
-        inline void clear(){
-            if(enabled()){
-                postConstruct(log2IndexesSize, log2CacheSize, name);                
-            }
-        }
+        void clear(void);
+        void getStats(DatabaseMTAssociativeCacheStats &stats);
+        void resetStats(void);
 
     private:
-        inline bool emptyCacheSlot(uint32_t cacheIndexRaw) const { 
-            return (currentCacheIndex >= cacheIndexRaw &&  currentCacheIndex - cacheIndexRaw > cacheSize) ||
-            (currentCacheIndex < cacheIndexRaw && UINT32_MAX - cacheIndexRaw + currentCacheIndex > cacheSize);
+        inline bool emptyCacheSlot(uint32_t cacheIndexRaw, uint32_t currentCacheIndex_) const {
+            return (currentCacheIndex_ >= cacheIndexRaw &&  currentCacheIndex_ - cacheIndexRaw > cacheSize) ||
+            (currentCacheIndex_ < cacheIndexRaw && UINT32_MAX - cacheIndexRaw + currentCacheIndex_ > cacheSize);
          };
+        inline bool emptyCacheSlot(uint32_t cacheIndexRaw) const { return emptyCacheSlot(cacheIndexRaw, currentCacheIndex); };
+        inline CounterStripe &stripe(const Goldilocks::Element (&key)[4]) { return counters[key[0].fe & (DATABASE_MT_ASSOCIATIVE_CACHE_COUNTER_STRIPES - 1)]; };
+        bool lookup(const Goldilocks::Element (&key)[4], Goldilocks::Element (&value)[12]) const;
+        void initIndexes(void);
         void forcedInsertion(uint32_t (&usedRawCacheIndexes)[10], int &iters);
 };
-#endif
\ No newline at end of file
+#endif
@@ -8,7 +8,7 @@
 // DatabaseCache class implementation
 
 // Add a record in the head of the cache. Returns true if the cache is full (or no cache), false otherwise
-bool DatabaseCache::addKeyValue(const string &key, const void * value, const bool update) 
+bool DatabaseCache::addKeyValue(const DatabaseKey &key, const void * value, const bool update) 
 {
     if (maxSize == 0)
     {
@@ -76,7 +76,7 @@ bool DatabaseCache::addKeyValue(const string &key, const void * value, const boo
     return full;
 }
 
-bool DatabaseCache::findKey(const string &key, DatabaseCacheRecord* &record) 
+bool DatabaseCache::findKey(const DatabaseKey &key, DatabaseCacheRecord* &record) 
 {
     attempts++;
 
@@ -85,12 +85,12 @@ bool DatabaseCache::findKey(const string &key, DatabaseCacheRecord* &record)
         zklog.info("DatabaseCache::addKeyValue() name=" + name + " count=" + to_string(cacheMap.size()) + " maxSize=" + to_string(maxSize) + " currentSize=" + to_string(currentSize) + " attempts=" + to_string(attempts) + " hits=" + to_string(hits) + " hit ratio=" + to_string(double(hits)*100.0/double(zkmax(attempts,1))) + "%");
     }
     
-    unordered_map<string, DatabaseCacheRecord*>::iterator it = cacheMap.find(key);
+    DatabaseCacheRecord** ppRecord = cacheMap.findValue(key);
 
-    if (it != cacheMap.end())
+    if (ppRecord != NULL)
     {
         hits++;
-        record = (DatabaseCacheRecord*)it->second;
+        record = *ppRecord;
 
         // Move cache record to the top/head (if it's not the current head)
         if (head != record) 
@@ -118,8 +118,8 @@ void DatabaseCache::print(bool printContent)
     zklog.info("DatabaseCache::print() printContent=" + to_string(printContent) + " name=" + name);
     zklog.info("Cache current size: " + to_string(currentSize));
     zklog.info("Cache max size: " + to_string(maxSize));
-    zklog.info("Head: " + (head != NULL ? head->key : "NULL"));
-    zklog.info("Last: " + (last != NULL ? last->key : "NULL"));
+    zklog.info("Head: " + (head != NULL ? head->key.toString() : "NULL"));
+    zklog.info("Last: " + (last != NULL ? last->key.toString() : "NULL"));
     
     DatabaseCacheRecord* record = head;
     uint64_t count = 0;
@@ -128,7 +128,7 @@ void DatabaseCache::print(bool printContent)
     {
         if (printContent)
         {
-            zklog.info("key:" + record->key + " size=" + to_string(record->size) + " prev=" + to_string((uint64_t)record->prev) + " next=" + to_string((uint64_t)record->next));
+            zklog.info("key:" + record->key.toString() + " size=" + to_string(record->size) + " prev=" + to_string((uint64_t)record->prev) + " next=" + to_string((uint64_t)record->next));
         }
         count++;
         size += record->size;
@@ -177,7 +177,7 @@ DatabaseMTCache::~DatabaseMTCache()
 }
 
 // Add a record in the head of the MT cache. Returns true if the cache is full (or no cache), false otherwise
-bool DatabaseMTCache::add(const string &key, const vector<Goldilocks::Element> &value, const bool update)
+bool DatabaseMTCache::add(const DatabaseKey &key, const vector<Goldilocks::Element> &value, const bool update)
 {
     lock_guard<recursive_mutex> guard(mlock);
 
@@ -186,7 +186,7 @@ bool DatabaseMTCache::add(const string &key, const vector<Goldilocks::Element> &
     return addKeyValue(key, (const void *)&value, update);
 }
 
-bool DatabaseMTCache::find(const string &key, vector<Goldilocks::Element> &value)
+bool DatabaseMTCache::find(const DatabaseKey &key, vector<Goldilocks::Element> &value)
 {
     lock_guard<recursive_mutex> guard(mlock);
 
@@ -202,7 +202,29 @@ bool DatabaseMTCache::find(const string &key, vector<Goldilocks::Element> &value
     return found;
 }
 
-DatabaseCacheRecord * DatabaseMTCache::allocRecord(const string key, const void * value)
+// String key versions, for callers at the hex boundary (e.g. gRPC); invalid keys are never cached
+bool DatabaseMTCache::add(const string &key, const vector<Goldilocks::Element> &value, const bool update)
+{
+    DatabaseKey binaryKey;
+    if (!binaryKey.fromString(key))
+    {
+        zklog.error("DatabaseMTCache::add() got an invalid key=" + key);
+        return false;
+    }
+    return add(binaryKey, value, update);
+}
+
+bool DatabaseMTCache::find(const string &key, vector<Goldilocks::Element> &value)
+{
+    DatabaseKey binaryKey;
+    if (!binaryKey.fromString(key))
+    {
+        return false;
+    }
+    return find(binaryKey, value);
+}
+
+DatabaseCacheRecord * DatabaseMTCache::allocRecord(const DatabaseKey &key, const void * value)
 {
     // Allocate memory
     DatabaseCacheRecord * pRecord = new(DatabaseCacheRecord);
@@ -226,7 +248,7 @@ DatabaseCacheRecord * DatabaseMTCache::allocRecord(const string key, const void
     pRecord->key = key;
     pRecord->size = 2*(
         sizeof(DatabaseCacheRecord)+
-        (pRecord->key.capacity()+1)+
+        sizeof(DatabaseKeyMap<DatabaseCacheRecord*>::value_type)+
         sizeof(vector<Goldilocks::Element>)+
         sizeof(Goldilocks::Element)*pValue->capacity() );
         
@@ -254,7 +276,7 @@ DatabaseProgramCache::~DatabaseProgramCache()
 }
 
 // Add a record in the head of the Program cache. Returns true if the cache is full (or no cache), false otherwise
-bool DatabaseProgramCache::add(const string &key, const vector<uint8_t> &value, const bool update)
+bool DatabaseProgramCache::add(const DatabaseKey &key, const vector<uint8_t> &value, const bool update)
 {
     lock_guard<recursive_mutex> guard(mlock);
 
@@ -263,7 +285,7 @@ bool DatabaseProgramCache::add(const string &key, const vector<uint8_t> &value,
     return addKeyValue(key, (const void *)&value, update);
 }
 
-bool DatabaseProgramCache::find(const string &key, vector<uint8_t> &value)
+bool DatabaseProgramCache::find(const DatabaseKey &key, vector<uint8_t> &value)
 {
     lock_guard<recursive_mutex> guard(mlock);
 
@@ -279,7 +301,29 @@ bool DatabaseProgramCache::find(const string &key, vector<uint8_t> &value)
     return found;
 }
 
-DatabaseCacheRecord * DatabaseProgramCache::allocRecord(const string key, const void * value)
+// String key versions, for callers at the hex boundary (e.g. gRPC); invalid keys are never cached
+bool DatabaseProgramCache::add(const string &key, const vector<uint8_t> &value, const bool update)
+{
+    DatabaseKey binaryKey;
+    if (!binaryKey.fromString(key))
+    {
+        zklog.error("DatabaseProgramCache::add() got an invalid key=" + key);
+        return false;
+    }
+    return add(binaryKey, value, update);
+}
+
+bool DatabaseProgramCache::find(const string &key, vector<uint8_t> &value)
+{
+    DatabaseKey binaryKey;
+    if (!binaryKey.fromString(key))
+    {
+        return false;
+    }
+    return find(binaryKey, value);
+}
+
+DatabaseCacheRecord * DatabaseProgramCache::allocRecord(const DatabaseKey &key, const void * value)
 {
     // Allocate memory
     DatabaseCacheRecord * pRecord = new(DatabaseCacheRecord);
@@ -303,7 +347,7 @@ DatabaseCacheRecord * DatabaseProgramCache::allocRecord(const string key, const
     pRecord->key = key;
     pRecord->size = 2*(
         sizeof(DatabaseCacheRecord)+
-        (pRecord->key.capacity()+1)+
+        sizeof(DatabaseKeyMap<DatabaseCacheRecord*>::value_type)+
         sizeof(vector<uint8_t>)+
         sizeof(uint8_t)*pValue->capacity() );
         
@@ -6,12 +6,13 @@
 #include <nlohmann/json.hpp>
 #include <mutex>
 #include "zklog.hpp"
+#include "database_key.hpp"
 
 using namespace std;
 using json = nlohmann::json;
 
 struct DatabaseCacheRecord {
-    string key; // TODO: use *char instead? it uses less memory than a string, but we need to convert
+    DatabaseKey key;
     void* value;
     DatabaseCacheRecord* next;
     DatabaseCacheRecord* prev;
@@ -24,7 +25,7 @@ protected:
     recursive_mutex mlock;
     uint64_t maxSize;
     uint64_t currentSize;
-    unordered_map<string, DatabaseCacheRecord*> cacheMap;
+    DatabaseKeyMap<DatabaseCacheRecord*> cacheMap;
     DatabaseCacheRecord * head;
     DatabaseCacheRecord * last;
     uint64_t attempts;
@@ -40,11 +41,11 @@ protected:
         hits(0)
         {};
     ~DatabaseCache();
-    bool addKeyValue(const string &key, const void * value, const bool update); // returns true if cache is full
-    bool findKey(const string &key, DatabaseCacheRecord* &record);
+    bool addKeyValue(const DatabaseKey &key, const void * value, const bool update); // returns true if cache is full
+    bool findKey(const DatabaseKey &key, DatabaseCacheRecord* &record);
 
 public:
-    virtual DatabaseCacheRecord* allocRecord(const string key, const void * value) = 0;
+    virtual DatabaseCacheRecord* allocRecord(const DatabaseKey &key, const void * value) = 0;
     virtual void freeRecord(DatabaseCacheRecord* record) = 0;
     virtual void updateRecord(DatabaseCacheRecord* record, const void * value) = 0;
 
@@ -62,9 +63,11 @@ class DatabaseMTCache : public DatabaseCache
 {
 public:
     ~DatabaseMTCache();
+    bool add(const DatabaseKey &key, const vector<Goldilocks::Element> &value, const bool update); // returns true if cache is full
+    bool find(const DatabaseKey &key, vector<Goldilocks::Element> &value);
     bool add(const string &key, const vector<Goldilocks::Element> &value, const bool update); // returns true if cache is full
     bool find(const string &key, vector<Goldilocks::Element> &value);
-    DatabaseCacheRecord* allocRecord(const string key, const void * value) override;
+    DatabaseCacheRecord* allocRecord(const DatabaseKey &key, const void * value) override;
     void freeRecord(DatabaseCacheRecord* record) override;
     void updateRecord(DatabaseCacheRecord* record, const void * value) override;
 };
@@ -73,9 +76,11 @@ class DatabaseProgramCache : public DatabaseCache
 {
 public:  
     ~DatabaseProgramCache();
+    bool add(const DatabaseKey &key, const vector<uint8_t> &value, const bool update); // returns true if cache is full
+    bool find(const DatabaseKey &key, vector<uint8_t> &value);
     bool add(const string &key, const vector<uint8_t> &value, const bool update); // returns true if cache is full
     bool find(const string &key, vector<uint8_t> &value);
-    DatabaseCacheRecord* allocRecord(const string key, const void * value) override;
+    DatabaseCacheRecord* allocRecord(const DatabaseKey &key, const void * value) override;
     void freeRecord(DatabaseCacheRecord* record) override;
     void updateRecord(DatabaseCacheRecord* record, const void * value) override;
 };
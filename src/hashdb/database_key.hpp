@@ -0,0 +1,137 @@
+#ifndef DATABASE_KEY_HPP
+#define DATABASE_KEY_HPP
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstring>
+#include "goldilocks_base_field.hpp"
+#include "zklog.hpp"
+#include "exit_process.hpp"
+#include "flat_hash_map.hpp"
+
+using namespace std;
+
+/*
+    Binary representation of a 256-bit hash DB key, i.e. 4 field elements in canonical form.
+    fe[0] is the least significant element, following the same order as Goldilocks::Element key[4],
+    so the hex string representation is fe[3]|fe[2]|fe[1]|fe[0], 16 nibbles each.
+    Hex strings are only required at the boundaries (SQL queries, logs, gRPC, read log).
+*/
+
+class DatabaseKey
+{
+public:
+    uint64_t fe[4];
+
+    DatabaseKey () {};
+
+    DatabaseKey (const Goldilocks::Element (&key)[4])
+    {
+        fromFea(key);
+    }
+
+    void fromFea (const Goldilocks::Element *key)
+    {
+        fe[0] = Goldilocks::toU64(key[0]);
+        fe[1] = Goldilocks::toU64(key[1]);
+        fe[2] = Goldilocks::toU64(key[2]);
+        fe[3] = Goldilocks::toU64(key[3]);
+    }
+
+    void toFea (Goldilocks::Element (&key)[4]) const
+    {
+        key[0] = Goldilocks::fromU64(fe[0]);
+        key[1] = Goldilocks::fromU64(fe[1]);
+        key[2] = Goldilocks::fromU64(fe[2]);
+        key[3] = Goldilocks::fromU64(fe[3]);
+    }
+
+    // Parses a hex string of up to 64 nibbles, with or without 0x prefix; returns false if invalid
+    bool fromString (const string &s)
+    {
+        uint64_t begin = 0;
+        if ((s.size() >= 2) && (s[0] == '0') && ((s[1] == 'x') || (s[1] == 'X')))
+        {
+            begin = 2;
+        }
+        uint64_t length = s.size() - begin;
+        if ((length == 0) || (length > 64))
+        {
+            return false;
+        }
+        fe[0] = fe[1] = fe[2] = fe[3] = 0;
+
+        // Parse from the least significant nibble
+        for (uint64_t i=0; i<length; i++)
+        {
+            char c = s[s.size() - 1 - i];
+            uint64_t nibble;
+            if ((c >= '0') && (c <= '9')) nibble = c - '0';
+            else if ((c >= 'a') && (c <= 'f')) nibble = c - 'a' + 10;
+            else if ((c >= 'A') && (c <= 'F')) nibble = c - 'A' + 10;
+            else return false;
+            fe[i/16] |= nibble << ((i%16)*4);
+        }
+        return true;
+    }
+
+    // Returns the normalized 64-nibble lower case hex string, as used by the SQL database
+    string toString (void) const
+    {
+        static const char hexDigits[] = "0123456789abcdef";
+        string s(64, '0');
+        for (uint64_t i=0; i<64; i++)
+        {
+            s[63 - i] = hexDigits[(fe[i/16] >> ((i%16)*4)) & 0xF];
+        }
+        return s;
+    }
+
+    bool operator== (const DatabaseKey &other) const
+    {
+        return (fe[0] == other.fe[0]) && (fe[1] == other.fe[1]) && (fe[2] == other.fe[2]) && (fe[3] == other.fe[3]);
+    }
+
+    bool operator!= (const DatabaseKey &other) const
+    {
+        return !(*this == other);
+    }
+
+    // Keys are poseidon hashes, so they are already well distributed; just fold them into 64 bits
+    uint64_t hash (void) const
+    {
+        uint64_t h = fe[0] ^ (fe[1] * 0x9E3779B97F4A7C15ULL) ^ fe[2] ^ (fe[3] * 0xC2B2AE3D27D4EB4FULL);
+        return h ^ (h >> 29);
+    }
+};
+
+// Converts a node value to the hex string stored in the SQL database, 16 nibbles per field element
+inline string dbValue2string (const vector<Goldilocks::Element> &value)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    string s(value.size()*16, '0');
+    for (uint64_t i=0; i<value.size(); i++)
+    {
+        uint64_t fe = Goldilocks::toU64(value[i]);
+        for (uint64_t j=0; j<16; j++)
+        {
+            s[i*16 + 15 - j] = hexDigits[(fe >> (j*4)) & 0xF];
+        }
+    }
+    return s;
+}
+
+struct DatabaseKeyHash
+{
+    size_t operator() (const DatabaseKey &key) const
+    {
+        return key.hash();
+    }
+};
+
+// Flat hash table indexed by DatabaseKey, see FlatHashMap
+template <typename T>
+using DatabaseKeyMap = FlatHashMap<DatabaseKey, T, DatabaseKeyHash>;
+
+#endif
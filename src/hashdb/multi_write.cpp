@@ -32,63 +32,41 @@ string MultiWrite::print(void)
         " synchronizingDataIndex=" + to_string(synchronizingDataIndex);
 }
 
-bool MultiWrite::findNode(const string &key, vector<Goldilocks::Element> &value)
+bool MultiWrite::findNode(const DatabaseKey &key, vector<Goldilocks::Element> &value)
 {
     value.clear();
     bool bResult = false;
     Lock();
 
-    unordered_map<string, string>::const_iterator it;
+    vector<Goldilocks::Element> *pValue = NULL;
 
     // Search in data[pendingToFlushDataIndex].nodes
     if (bResult == false)
     {
-        it = data[pendingToFlushDataIndex].nodes.find(key);
-        if (it != data[pendingToFlushDataIndex].nodes.end())
+        pValue = data[pendingToFlushDataIndex].nodes.findValue(key);
+        if (pValue != NULL)
         {
-            if ((it->second.size() % 16) != 0)
-            {
-                zklog.error("MultiWrite::findNode() data[pendingToFlushDataIndex].nodes found invalid node size=" + to_string(it->second.size()) + " for key=" + key);
-            }
-            else
-            {
-                for (uint64_t i=0; i<it->second.size(); i+=16)
-                {
-                    Goldilocks::Element fe = fr.fromString(it->second.substr(i, 16), 16);
-                    value.push_back(fe);
-                }
-                bResult = true;
+            value = *pValue;
+            bResult = true;
 
 #ifdef LOG_DB_MULTI_WRITE_FIND_NODES
-                zklog.info("MultiWrite::findNodes() data[pendingToFlushDataIndex].nodes found key=" + key + " value=" + it->second);
+            zklog.info("MultiWrite::findNodes() data[pendingToFlushDataIndex].nodes found key=" + key.toString());
 #endif
-            }
         }
     }
 
     // Search in data[pendingToFlushDataIndex].nodesIntray
     if (bResult == false)
     {
-        it = data[pendingToFlushDataIndex].nodesIntray.find(key);
-        if (it != data[pendingToFlushDataIndex].nodesIntray.end())
+        pValue = data[pendingToFlushDataIndex].nodesIntray.findValue(key);
+        if (pValue != NULL)
         {
-            if ((it->second.size() % 16) != 0)
-            {
-                zklog.error("MultiWrite::findNode() data[pendingToFlushDataIndex].nodesIntray found invalid node size=" + to_string(it->second.size()) + " for key=" + key);
-            }
-            else
-            {
-                for (uint64_t i=0; i<it->second.size(); i+=16)
-                {
-                    Goldilocks::Element fe = fr.fromString(it->second.substr(i, 16), 16);
-                    value.push_back(fe);
-                }
-                bResult = true;
+            value = *pValue;
+            bResult = true;
 
 #ifdef LOG_DB_MULTI_WRITE_FIND_NODES
-                zklog.info("MultiWrite::findNodes() data[pendingToFlushDataIndex].nodesIntray found key=" + key + " value=" + it->second);
+            zklog.info("MultiWrite::findNodes() data[pendingToFlushDataIndex].nodesIntray found key=" + key.toString());
 #endif
-            }
         }
     }
 
@@ -99,25 +77,15 @@ bool MultiWrite::findNode(const string &key, vector<Goldilocks::Element> &value)
         // Search in data[storingDataIndex].nodes
         if (bResult == false)
         {
-            it = data[storingDataIndex].nodes.find(key);
-            if (it != data[storingDataIndex].nodes.end())
+            pValue = data[storingDataIndex].nodes.findValue(key);
+            if (pValue != NULL)
             {
-                if ((it->second.size() % 16) != 0)
-                {
-                    zklog.error("MultiWrite::findNode() data[storingDataIndex].nodes found invalid node size=" + to_string(it->second.size()) + " for key=" + key);
-                }
-                else
-                {
-                    for (uint64_t i=0; i<it->second.size(); i+=16)
-                    {
-                        Goldilocks::Element fe = fr.fromString(it->second.substr(i, 16), 16);
-                        value.push_back(fe);
-                    }
-                    bResult = true;
+                value = *pValue;
+                bResult = true;
+
 #ifdef LOG_DB_MULTI_WRITE_FIND_NODES
-                    zklog.info("MultiWrite::findNodes() data[pendingToFlushDataIndex].nodes found key=" + key + " value=" + it->second);
+                zklog.info("MultiWrite::findNodes() data[storingDataIndex].nodes found key=" + key.toString());
 #endif
-                }
             }
         }
 
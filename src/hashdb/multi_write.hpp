@@ -33,7 +33,7 @@ public:
     bool IsEmpty(void) { return data[0].IsEmpty() && data[1].IsEmpty() && data[2].IsEmpty(); };
     string print(void);
 
-    bool findNode(const string &key, vector<Goldilocks::Element> &value);
+    bool findNode(const DatabaseKey &key, vector<Goldilocks::Element> &value);
     bool findProgram(const string &key, vector<uint8_t> &value);
 };
 
@@ -6,6 +6,7 @@
 #include "definitions.hpp"
 #include "zklog.hpp"
 #include "multi_query.hpp"
+#include "database_key.hpp"
 
 using namespace std;
 
@@ -15,8 +16,8 @@ public:
     // Flush data
     unordered_map<string, string> program;
     unordered_map<string, string> programIntray;
-    unordered_map<string, string> nodes;
-    unordered_map<string, string> nodesIntray;
+    DatabaseKeyMap<vector<Goldilocks::Element>> nodes; // Binary key and value; converted to hex only when building the SQL query
+    DatabaseKeyMap<vector<Goldilocks::Element>> nodesIntray;
     string nodesStateRoot;
 
     // SQL queries, including all data to store in database
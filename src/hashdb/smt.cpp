@@ -79,7 +79,7 @@ zkresult Smt::set (const string &batchUUID, uint64_t block, uint64_t tx, Databas
         dbres = ZKR_UNSPECIFIED;
         if (bUseStateManager)
         {
-            dbres = stateManager.readNode(batchUUID, rootString, dbValue, dbReadLog);
+            dbres = stateManager.readNode(batchUUID, r, dbValue, dbReadLog);
         }
         if (dbres != ZKR_SUCCESS)
         {
@@ -118,7 +118,7 @@ zkresult Smt::set (const string &batchUUID, uint64_t block, uint64_t tx, Databas
             dbres = ZKR_UNSPECIFIED;
             if (bUseStateManager)
             {
-                dbres = stateManager.readNode(batchUUID, foundValueHashString, dbValue, dbReadLog);
+                dbres = stateManager.readNode(batchUUID, foundValueHash, dbValue, dbReadLog);
             }
             if (dbres != ZKR_SUCCESS)
             {
@@ -240,7 +240,7 @@ zkresult Smt::set (const string &batchUUID, uint64_t block, uint64_t tx, Databas
                             nodeToDeleteString = fea2string(fr, nodeToDelete);
                             if (nodeToDeleteString != "0")
                             {
-                                stateManager.deleteNode(batchUUID, block, tx, nodeToDeleteString, persistence);
+                                stateManager.deleteNode(batchUUID, block, tx, nodeToDelete, persistence);
                             }
                         }
                     }
@@ -472,7 +472,7 @@ zkresult Smt::set (const string &batchUUID, uint64_t block, uint64_t tx, Databas
                         nodeToDeleteString = fea2string(fr, nodeToDelete);
                         if (nodeToDeleteString != "0")
                         {
-                            stateManager.deleteNode(batchUUID, block, tx, nodeToDeleteString, persistence);
+                            stateManager.deleteNode(batchUUID, block, tx, nodeToDelete, persistence);
                         }
                     }
                 }
@@ -516,7 +516,7 @@ zkresult Smt::set (const string &batchUUID, uint64_t block, uint64_t tx, Databas
                     nodeToDeleteString = fea2string(fr, nodeToDelete);
                     if (nodeToDeleteString != "0")
                     {
-                        stateManager.deleteNode(batchUUID, block, tx, nodeToDeleteString, persistence);
+                        stateManager.deleteNode(batchUUID, block, tx, nodeToDelete, persistence);
                     }
                 }
                 else
@@ -546,7 +546,7 @@ zkresult Smt::set (const string &batchUUID, uint64_t block, uint64_t tx, Databas
                     dbres = ZKR_UNSPECIFIED;
                     if (bUseStateManager)
                     {
-                        dbres = stateManager.readNode(batchUUID, auxString, dbValue, dbReadLog);
+                        dbres = stateManager.readNode(batchUUID, auxFea, dbValue, dbReadLog);
                     }
                     if (dbres != ZKR_SUCCESS)
                     {
@@ -573,7 +573,7 @@ zkresult Smt::set (const string &batchUUID, uint64_t block, uint64_t tx, Databas
                         dbres = ZKR_UNSPECIFIED;
                         if (bUseStateManager)
                         {
-                            dbres = stateManager.readNode(batchUUID, valHString, dbValue, dbReadLog);
+                            dbres = stateManager.readNode(batchUUID, valH, dbValue, dbReadLog);
                         }
                         if (dbres != ZKR_SUCCESS)
                         {
@@ -686,7 +686,7 @@ zkresult Smt::set (const string &batchUUID, uint64_t block, uint64_t tx, Databas
                     dbres = ZKR_UNSPECIFIED;
                     if (bUseStateManager)
                     {
-                        dbres = stateManager.readNode(batchUUID, siblingRootString, dbValue, dbReadLog);
+                        dbres = stateManager.readNode(batchUUID, siblingRoot, dbValue, dbReadLog);
                     }
                     if (dbres != ZKR_SUCCESS)
                     {
@@ -790,7 +790,7 @@ zkresult Smt::set (const string &batchUUID, uint64_t block, uint64_t tx, Databas
                     nodeToDeleteString = fea2string(fr, nodeToDelete);
                     if (nodeToDeleteString != "0")
                     {
-                        stateManager.deleteNode(batchUUID, block, tx, nodeToDeleteString, persistence);
+                        stateManager.deleteNode(batchUUID, block, tx, nodeToDelete, persistence);
                     }
                 }
             }
@@ -920,7 +920,7 @@ zkresult Smt::get (const string &batchUUID, Database &db, const Goldilocks::Elem
         dbres = ZKR_UNSPECIFIED;
         if (bUseStateManager)
         {
-            dbres = stateManager.readNode(batchUUID, rString, dbValue, dbReadLog);
+            dbres = stateManager.readNode(batchUUID, r, dbValue, dbReadLog);
         }
         if (dbres != ZKR_SUCCESS)
         {
@@ -948,7 +948,7 @@ zkresult Smt::get (const string &batchUUID, Database &db, const Goldilocks::Elem
             dbres = ZKR_UNSPECIFIED;
             if (bUseStateManager)
             {
-                dbres = stateManager.readNode(batchUUID, foundValueHashString, dbValue, dbReadLog);
+                dbres = stateManager.readNode(batchUUID, valueHashFea, dbValue, dbReadLog);
             }
             if (dbres != ZKR_SUCCESS)
             {
@@ -1082,7 +1082,7 @@ zkresult Smt::hashSave ( const SmtContext &ctx, const Goldilocks::Element (&v)[1
 
     if (ctx.bUseStateManager)
     {
-        zkr = stateManager.writeNode(ctx.batchUUID, ctx.block, ctx.tx, hashString, dbValue, ctx.persistence);
+        zkr = stateManager.writeNode(ctx.batchUUID, ctx.block, ctx.tx, hash, dbValue, ctx.persistence);
         if (zkr != ZKR_SUCCESS)
         {
             zklog.error("Smt::hashSave() failed calling stateManager.write() key=" + hashString + " result=" + to_string(zkr) + "=" + zkresult2string(zkr));
@@ -217,25 +217,21 @@ zkresult StateManager::setStateRoot (const string &batchUUID, uint64_t block, ui
 
 }
 
-zkresult StateManager::writeNode (const string &batchUUID, uint64_t block, uint64_t tx, const string &_key, const vector<Goldilocks::Element> &value, const Persistence persistence)
+zkresult StateManager::writeNode (const string &batchUUID, uint64_t block, uint64_t tx, const DatabaseKey &key, const vector<Goldilocks::Element> &value, const Persistence persistence)
 {
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
     struct timeval t;
     gettimeofday(&t, NULL);
 #endif
 
-    // Normalize key format
-    string key = NormalizeToNFormat(_key, 64);
-    key = stringToLower(key);
-
 #ifdef LOG_STATE_MANAGER_WRITE
-    zklog.info("StateManager::writeNode() batchUUID=" + batchUUID + " block=" + to_string(block) + " tx=" + to_string(tx) + " key=" + key + " persistence=" + persistence2string(persistence));
+    zklog.info("StateManager::writeNode() batchUUID=" + batchUUID + " block=" + to_string(block) + " tx=" + to_string(tx) + " key=" + key.toString() + " persistence=" + persistence2string(persistence));
 #endif
 
     // Check persistence range
     if (persistence >= PERSISTENCE_SIZE)
     {
-        zklog.error("StateManager::writeNode() wrong persistence batchUUID=" + batchUUID + " block=" + to_string(block) + " tx=" + to_string(tx) + " key=" + key + " persistence=" + persistence2string(persistence));
+        zklog.error("StateManager::writeNode() wrong persistence batchUUID=" + batchUUID + " block=" + to_string(block) + " tx=" + to_string(tx) + " key=" + key.toString() + " persistence=" + persistence2string(persistence));
         return ZKR_STATE_MANAGER;
     }
 
@@ -303,25 +299,21 @@ zkresult StateManager::writeNode (const string &batchUUID, uint64_t block, uint6
     return ZKR_SUCCESS;
 }
 
-zkresult StateManager::deleteNode (const string &batchUUID, uint64_t block, uint64_t tx, const string &_key, const Persistence persistence)
+zkresult StateManager::deleteNode (const string &batchUUID, uint64_t block, uint64_t tx, const DatabaseKey &key, const Persistence persistence)
 {
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
     struct timeval t;
     gettimeofday(&t, NULL);
 #endif
 
-    // Normalize key format
-    string key = NormalizeToNFormat(_key, 64);
-    key = stringToLower(key);
-
 #ifdef LOG_STATE_MANAGER_DELETE_NODE
-    zklog.info("StateManager::deleteNode() batchUUID=" + batchUUID + " block=" + to_string(block) + " tx=" + to_string(tx) + " key=" + key + " persistence=" + persistence2string(persistence));
+    zklog.info("StateManager::deleteNode() batchUUID=" + batchUUID + " block=" + to_string(block) + " tx=" + to_string(tx) + " key=" + key.toString() + " persistence=" + persistence2string(persistence));
 #endif
 
     // Check persistence range
     if (persistence >= PERSISTENCE_SIZE)
     {
-        zklog.error("StateManager::deleteNode() invalid persistence batchUUID=" + batchUUID + " tx=" + to_string(tx) + " key=" + key + " persistence=" + persistence2string(persistence));
+        zklog.error("StateManager::deleteNode() invalid persistence batchUUID=" + batchUUID + " tx=" + to_string(tx) + " key=" + key.toString() + " persistence=" + persistence2string(persistence));
         return ZKR_STATE_MANAGER;
     }
 
@@ -377,12 +369,9 @@ zkresult StateManager::deleteNode (const string &batchUUID, uint64_t block, uint
     TxSubState &txSubState = txState.persistence[persistence].subState[txState.persistence[persistence].currentSubState];
 
     // Delete this key in the surrent TX sub-state
-    /*unordered_map<string, vector<Goldilocks::Element>>::iterator dbIt;
-    dbIt = txSubState.dbWrite.find(key);
-    if (dbIt != txSubState.dbWrite.end())
+    /*if (txSubState.dbWriteNodes.erase(key))
     {
-        txSubState.dbWrite.erase(dbIt);
-        zklog.info("StateManager::deleteNode() batchUUID=" + batchUUID + " tx=" + to_string(tx) + " key=" + key);
+        zklog.info("StateManager::deleteNode() batchUUID=" + batchUUID + " tx=" + to_string(tx) + " key=" + key.toString());
     }*/
 
     txSubState.dbDeleteNodes.emplace_back(key);
@@ -396,15 +385,11 @@ zkresult StateManager::deleteNode (const string &batchUUID, uint64_t block, uint
     return ZKR_SUCCESS;
 }
 
-zkresult StateManager::readNode (const string &batchUUID, const string &_key, vector<Goldilocks::Element> &value, DatabaseMap *dbReadLog)
+zkresult StateManager::readNode (const string &batchUUID, const DatabaseKey &key, vector<Goldilocks::Element> &value, DatabaseMap *dbReadLog)
 {
     struct timeval t;
     gettimeofday(&t, NULL);
 
-    // Normalize key format
-    string key = NormalizeToNFormat(_key, 64);
-    key = stringToLower(key);
-
     Lock();
 
     // Find batch state for this uuid
@@ -419,17 +404,16 @@ zkresult StateManager::readNode (const string &batchUUID, const string &_key, ve
     BatchState &batchState = it->second;
 
     // Search in the common write list
-    unordered_map<string, vector<Goldilocks::Element>>::iterator dbIt;
-    dbIt = batchState.dbWriteNodes.find(key);
-    if (dbIt != batchState.dbWriteNodes.end())
+    vector<Goldilocks::Element> *pValue = batchState.dbWriteNodes.findValue(key);
+    if (pValue != NULL)
     {
-        value = dbIt->second;
+        value = *pValue;
                         
         // Add to the read log
-        if (dbReadLog != NULL) dbReadLog->add(key, value, true, TimeDiff(t));
+        if (dbReadLog != NULL) dbReadLog->add(key.toString(), value, true, TimeDiff(t));
 
 #ifdef LOG_STATE_MANAGER_READ
-        zklog.info("StateManager::readNode() batchUUID=" + batchUUID + " key=" + key);
+        zklog.info("StateManager::readNode() batchUUID=" + batchUUID + " key=" + key.toString());
 #endif
 
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
@@ -974,7 +958,7 @@ zkresult StateManager::flush (const string &batchUUID, const string &_newStateRo
         BlockState &blockState = batchState.blockState[block];
 
         // Data to write to database
-        unordered_map<string, vector<Goldilocks::Element>> dbWriteNodes;
+        DatabaseKeyMap<vector<Goldilocks::Element>> dbWriteNodes;
 
         // For all tx sub-states, purge the data to write
         for (uint64_t tx=0; tx<blockState.txState.size(); tx++)
@@ -1113,15 +1097,20 @@ zkresult StateManager::flush (const string &batchUUID, const string &_newStateRo
                     }
 
                     // Add node keys to dbWriteNodes
-                    dbWriteNodes.insert( txState.persistence[persistence].subState[ss].dbWriteNodes.begin(),
-                                         txState.persistence[persistence].subState[ss].dbWriteNodes.end());
+                    DatabaseKeyMap<vector<Goldilocks::Element>>::const_iterator nodesIt;
+                    for ( nodesIt = txState.persistence[persistence].subState[ss].dbWriteNodes.begin();
+                          nodesIt != txState.persistence[persistence].subState[ss].dbWriteNodes.end();
+                          nodesIt++ )
+                    {
+                        dbWriteNodes.insert(nodesIt->first, nodesIt->second);
+                    }
 
                     // Delete node keys (if purge is active)
                     if (db.config.stateManagerPurge)
                     {
                         for (uint64_t k = 0; k < txState.persistence[persistence].subState[ss].dbDeleteNodes.size(); k++)
                         {
-                            //zklog.info("StateManager::flush() deleting key=" + txState.persistence[persistence].subState[ss].dbDeleteNodes[k] + " at block=" + to_string(block) + " with stateRoot=" + batchState.blockState[block].currentStateRoot);
+                            //zklog.info("StateManager::flush() deleting key=" + txState.persistence[persistence].subState[ss].dbDeleteNodes[k].toString() + " at block=" + to_string(block) + " with stateRoot=" + batchState.blockState[block].currentStateRoot);
                             dbWriteNodes.erase(txState.persistence[persistence].subState[ss].dbDeleteNodes[k]);
                         }
                     }
@@ -1171,7 +1160,7 @@ zkresult StateManager::flush (const string &batchUUID, const string &_newStateRo
         }
 
         // Write remaining nodes of this block to database
-        unordered_map<string, vector<Goldilocks::Element>>::const_iterator writeIt;
+        DatabaseKeyMap<vector<Goldilocks::Element>>::const_iterator writeIt;
         for (writeIt = dbWriteNodes.begin(); writeIt != dbWriteNodes.end(); writeIt++)
         {
             zkr = db.write(writeIt->first, NULL, writeIt->second, _persistence == PERSISTENCE_DATABASE ? 1 : 0);
@@ -1338,10 +1327,10 @@ void StateManager::print (bool bDbContent)
                         totalDbWrites[persistence] += txSubState.dbWriteNodes.size();
                         if (bDbContent)
                         {
-                            unordered_map<string, vector<Goldilocks::Element>>::const_iterator dbIt;
+                            DatabaseKeyMap<vector<Goldilocks::Element>>::const_iterator dbIt;
                             for (dbIt = txSubState.dbWriteNodes.begin(); dbIt != txSubState.dbWriteNodes.end(); dbIt++)
                             {
-                                zklog.info("                " + dbIt->first);
+                                zklog.info("                " + dbIt->first.toString());
                             }
                         }
                         zklog.info("              dbDeleteNodes.size=" + to_string(txSubState.dbDeleteNodes.size()));
@@ -1350,7 +1339,7 @@ void StateManager::print (bool bDbContent)
                         {
                             for (uint64_t j=0; j<txSubState.dbDeleteNodes.size(); j++)
                             {
-                                zklog.info("                " + txSubState.dbDeleteNodes[j]);
+                                zklog.info("                " + txSubState.dbDeleteNodes[j].toString());
                             }
                         }
                     }
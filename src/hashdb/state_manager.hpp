@@ -9,6 +9,7 @@
 #include "database_map.hpp"
 #include "persistence.hpp"
 #include "database.hpp"
+#include "database_key.hpp"
 #include "utils/time_metric.hpp"
 
 using namespace std;
@@ -20,8 +21,8 @@ public:
     string newStateRoot;
     uint64_t previousSubState;
     bool bValid;
-    unordered_map<string, vector<Goldilocks::Element>> dbWriteNodes;
-    vector<string> dbDeleteNodes;
+    DatabaseKeyMap<vector<Goldilocks::Element>> dbWriteNodes;
+    vector<DatabaseKey> dbDeleteNodes;
     TxSubState() : previousSubState(0), bValid(false)
     {
         dbWriteNodes.reserve(128);
@@ -70,7 +71,7 @@ public:
     string currentStateRoot;
     uint64_t currentBlock;
     vector<BlockState> blockState;
-    unordered_map<string, vector<Goldilocks::Element>> dbWriteNodes;
+    DatabaseKeyMap<vector<Goldilocks::Element>> dbWriteNodes;
     unordered_map<string, vector<uint8_t>> dbWritePrograms;
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
     TimeMetricStorage timeMetricStorage;
@@ -111,9 +112,9 @@ public:
     {
         return setStateRoot(batchUUID, block, tx, stateRoot, false, persistence);
     }
-    zkresult writeNode (const string &batchUUID, uint64_t block, uint64_t tx, const string &_key, const vector<Goldilocks::Element> &value, const Persistence persistence);
-    zkresult deleteNode (const string &batchUUID, uint64_t block, uint64_t tx, const string &_key, const Persistence persistence);
-    zkresult readNode (const string &batchUUID, const string &_key, vector<Goldilocks::Element> &value, DatabaseMap *dbReadLog);
+    zkresult writeNode (const string &batchUUID, uint64_t block, uint64_t tx, const DatabaseKey &key, const vector<Goldilocks::Element> &value, const Persistence persistence);
+    zkresult deleteNode (const string &batchUUID, uint64_t block, uint64_t tx, const DatabaseKey &key, const Persistence persistence);
+    zkresult readNode (const string &batchUUID, const DatabaseKey &key, vector<Goldilocks::Element> &value, DatabaseMap *dbReadLog);
     zkresult writeProgram (const string &batchUUID, uint64_t block, uint64_t tx, const string &_key, const vector<uint8_t> &value, const Persistence persistence);
     zkresult readProgram (const string &batchUUID, const string &_key, vector<uint8_t> &value, DatabaseMap *dbReadLog);
     zkresult finishTx (const string &batchUUID, const string &newStateRoot, const Persistence persistence);
@@ -27,10 +27,11 @@
 // Helper functions
 string removeBSXIfExists64(string s) {return ((s.at(0) == '\\') && (s.at(1) == 'x')) ? s.substr(2) : s;}
 
-Database64::Database64 (Goldilocks &fr, const Config &config) : headerPageNumber(0), currentFlushId(0), pageManager(), ctx(pageManager, config)
+Database64::Database64 (Goldilocks &fr, const Config &config) : headerPageNumber(0), currentFlushId(0), pageManager(), ctx(pageManager, config), bStopCompaction(false)
 {
     // Init mutex
     pthread_mutex_init(&mutex, NULL);
+    sem_init(&compactionSem, 0, 0);
 
     zkresult zkr;
     headerPageNumber = 0;
@@ -46,6 +47,14 @@ Database64::Database64 (Goldilocks &fr, const Config &config) : headerPageNumber
 
 Database64::~Database64()
 {
+    // Stop the compaction thread, if any
+    if (bCompactionThread)
+    {
+        bStopCompaction = true;
+        sem_post(&compactionSem);
+        pthread_join(compactionPthread, NULL);
+    }
+    sem_destroy(&compactionSem);
 }
 
 // Database64 class implementation
@@ -60,6 +69,13 @@ void Database64::init(void)
 
     // Mark the database as initialized
     bInitialized = true;
+
+    // Compaction thread creation
+    if (ctx.config.hashDB64CompactionPeriod > 0)
+    {
+        pthread_create(&compactionPthread, NULL, dbCompactionThread64, this);
+        bCompactionThread = true;
+    }
 }
 
 zkresult Database64::getLatestStateRoot (Goldilocks::Element (&stateRoot)[4]){
@@ -97,34 +113,41 @@ zkresult Database64::readKV(const Goldilocks::Element (&root)[4], const Goldiloc
     }
 
     // Convert root to a byte array
-    string rootString = fea2string(fr, root);
-    string rootBa =  string2ba(rootString);
+    uint8_t rootBa[32];
+    fea2ba(fr, rootBa, root);
+
+    // Read from the last flushed header, i.e. page 0, holding the header read lock, so that neither a write nor a
+    // compaction can flush a new header, and then release the pages of this one, until the read is done
+    ctx.pageManager.readLock();
 
     // Get the version associated to this root
     uint64_t version;
-    zkr = HeaderPage::ReadRootVersion(ctx, headerPageNumber, rootBa, version);
+    zkr = HeaderPage::ReadRootVersion(ctx, 0, string((char *)rootBa, 32), version);
     if (zkr != ZKR_SUCCESS)
     {
-        zklog.error("Database64::readKV() failed calling HeaderPage::ReadRootVersion() result=" + zkresult2string(zkr) + " root=" + rootString + " key=" + fea2string(fr, key));
+        zklog.error("Database64::readKV() failed calling HeaderPage::ReadRootVersion() result=" + zkresult2string(zkr) + " root=" + fea2string(fr, root) + " key=" + fea2string(fr, key));
+        ctx.pageManager.readUnlock();
         return zkr;
     }
 
-    // Get the version data
-    VersionDataEntry versionData;
-    zkr = HeaderPage::ReadVersionData(ctx, headerPageNumber, version, versionData);
-    if (zkr != ZKR_SUCCESS)
+    // Pruned versions cannot be read
+    HeaderStruct *headerPage = (HeaderStruct *)ctx.pageManager.getPageAddress(0);
+    if (version < headerPage->compactedVersion)
     {
-        zklog.error("Database64::readKV() failed calling HeaderPage::ReadVersionData() result=" + zkresult2string(zkr) + " root=" + rootString + " key=" + fea2string(fr, key));
-        return zkr;
+        zklog.error("Database64::readKV() found version=" + to_string(version) + " < compactedVersion=" + to_string(headerPage->compactedVersion) + " root=" + fea2string(fr, root) + " key=" + fea2string(fr, key));
+        ctx.pageManager.readUnlock();
+        return ZKR_DB_VERSION_NOT_FOUND_KVDB;
     }
 
-    // Get the value
-    string keyString = fea2string(fr, key);
-    string keyBa = string2ba(keyString);
-    zkr = HeaderPage::KeyValueHistoryRead(ctx, versionData.keyValueHistoryPage, keyBa, version, value, level);
+    // Get the value from the last key value history, which keeps the values of all the versions, since the pages of
+    // the previous versions are released by the writes that follow them; the level is the one the key had at this
+    // version, which can be lower than the current one
+    KeyValueHistoryKey historyKey(key);
+    zkr = HeaderPage::KeyValueHistoryRead(ctx, headerPage->keyValueHistoryPage, historyKey, version, headerPage->lastVersion, value, level);
+    ctx.pageManager.readUnlock();
     if (zkr != ZKR_SUCCESS)
     {
-        zklog.error("Database64::readKV() failed calling HeaderPage::KeyValueHistoryRead() result=" + zkresult2string(zkr) + " root=" + rootString + " key=" + fea2string(fr, key));
+        zklog.error("Database64::readKV() failed calling HeaderPage::KeyValueHistoryRead() result=" + zkresult2string(zkr) + " root=" + fea2string(fr, root) + " key=" + fea2string(fr, key));
         return zkr;
     }
     
@@ -155,9 +178,10 @@ zkresult Database64::readLevel (const Goldilocks::Element (&key)[4], uint64_t &l
     }
 
     // Get the level
-    string keyString = fea2string(fr, key);
-    string keyBa = string2ba(keyString);
-    zkr = HeaderPage::KeyValueHistoryReadLevel(ctx,headerPageNumber, keyBa, level);
+    KeyValueHistoryKey historyKey(key);
+    ctx.pageManager.readLock();
+    zkr = HeaderPage::KeyValueHistoryReadLevel(ctx, 0, historyKey, level);
+    ctx.pageManager.readUnlock();
     if (zkr != ZKR_SUCCESS)
     {
         zklog.error("Database64::readLevel() failed calling HeaderPage::KeyValueHistoryReadLevel() result=" + zkresult2string(zkr) + " key=" + fea2string(fr, key));
@@ -285,6 +309,89 @@ zkresult Database64::resetDB (void)
     return zkr;
 }
 
+zkresult Database64::compactHistory (KeyValueHistoryCompactionCounters &counters)
+{
+    zkresult zkr;
+
+    // Check that it has been initialized before
+    if (!bInitialized)
+    {
+        zklog.error("Database64::compactHistory() called uninitialized");
+        exitProcess();
+    }
+
+    struct timeval t;
+    gettimeofday(&t, NULL);
+
+    uint64_t minVersion = 0;
+    for (uint64_t firstIndex=0; firstIndex<64; firstIndex+=DATABASE64_COMPACTION_ENTRIES_PER_STEP)
+    {
+        zkr = compactHistory(firstIndex, zkmin(firstIndex + DATABASE64_COMPACTION_ENTRIES_PER_STEP, (uint64_t)64), minVersion, counters);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("Database64::compactHistory() failed calling compactHistory() result=" + zkresult2string(zkr) + " firstIndex=" + to_string(firstIndex));
+            return zkr;
+        }
+    }
+
+    uint64_t firstUnusedPage, usedPages;
+    getPagesStats(firstUnusedPage, usedPages);
+    zklog.info("Database64::compactHistory() minVersion=" + to_string(minVersion) +
+        " visitedPages=" + to_string(counters.visitedPages) +
+        " rewrittenPages=" + to_string(counters.rewrittenPages) +
+        " droppedHistoryEntries=" + to_string(counters.droppedHistoryEntries) +
+        " releasedPages=" + to_string(counters.releasedPages) +
+        " fileSize=" + to_string(firstUnusedPage*4096) + "B usedPages=" + to_string(usedPages) +
+        " time=" + to_string(TimeDiff(t)) + "us");
+
+    return ZKR_SUCCESS;
+}
+
+zkresult Database64::compactHistory (const uint64_t firstIndex, const uint64_t lastIndex, uint64_t &minVersion, KeyValueHistoryCompactionCounters &counters)
+{
+    zkresult zkr;
+
+    Lock();
+
+    // Keep the last kvDBMaxVersions versions
+    uint64_t lastVersion = HeaderPage::GetLastVersion(ctx, headerPageNumber);
+    if (lastVersion == 0)
+    {
+        Unlock();
+        return ZKR_SUCCESS;
+    }
+    uint64_t maxVersions = zkmax(ctx.config.kvDBMaxVersions, (uint64_t)1);
+    minVersion = (lastVersion >= maxVersions) ? lastVersion - maxVersions + 1 : 0;
+
+    // Compact, editing the header page only if any page is rewritten
+    zkr = HeaderPage::KeyValueHistoryCompact(ctx, headerPageNumber, minVersion, firstIndex, lastIndex, counters);
+    if (zkr != ZKR_SUCCESS)
+    {
+        zklog.error("Database64::compactHistory() failed calling HeaderPage::KeyValueHistoryCompact() result=" + zkresult2string(zkr) + " minVersion=" + to_string(minVersion));
+        Unlock();
+        return zkr;
+    }
+
+    // Flush all pages to disk, which releases the replaced ones
+    if (headerPageNumber != 0)
+    {
+        ctx.pageManager.flushPages(ctx);
+        headerPageNumber = 0;
+    }
+
+    Unlock();
+
+    return ZKR_SUCCESS;
+}
+
+void Database64::getPagesStats (uint64_t &firstUnusedPage, uint64_t &usedPages)
+{
+    Lock();
+    firstUnusedPage = pageManager.getFirstUnusedPage();
+    usedPages = pageManager.getNumUsedPages();
+    Unlock();
+}
+
 zkresult Database64::consolidateBlock (uint64_t blockNumber)
 {
     return ZKR_UNSPECIFIED;
@@ -301,16 +408,26 @@ zkresult Database64::WriteTree (const Goldilocks::Element (&oldRoot)[4], const v
 
     //HeaderPage::Print(headerPage, true);
 
-    vector<KeyValue> keyValues(_keyValues);
-
-    if (keyValues.size() == 0)
+    if (_keyValues.size() == 0)
     {
         zklog.error("Database64::WriteTree() called with keyValues.size=0");
         return ZKR_DB_ERROR;
     }
 
+    // Convert the keys to the pages format before locking, so that concurrent callers only wait for the writes
+    vector<KeyValueBits> keyValues(_keyValues.size());
+    for (uint64_t i=0; i<_keyValues.size(); i++)
+    {
+        KeyValueHistoryPage::GetKeyBits(_keyValues[i], keyValues[i]);
+    }
+
+    // Copy the old root, since callers can pass the same array as old and new roots, e.g. to write versions in a loop
+    Goldilocks::Element oldRootCopy[4] = {oldRoot[0], oldRoot[1], oldRoot[2], oldRoot[3]};
+
     //HeaderPage::Print(headerPageNumber, true);
 
+    Lock();
+
     uint64_t version = 0;
 
     // Check if the root is zero
@@ -320,6 +437,7 @@ zkresult Database64::WriteTree (const Goldilocks::Element (&oldRoot)[4], const v
         if (lastVersion != 0)
         {
             zklog.error("Database64::WriteTree() called with a zero old state root, but last version=" + to_string(lastVersion) + " oldRoot=" + fea2string(fr, oldRoot));
+            Unlock();
             return ZKR_DB_ERROR;
         }
         version = 1;
@@ -336,6 +454,7 @@ zkresult Database64::WriteTree (const Goldilocks::Element (&oldRoot)[4], const v
         if (zkr != ZKR_SUCCESS)
         {
             zklog.error("Database64::WriteTree() failed calling HeaderPage::ReadRootVersion() result=" + zkresult2string(zkr) + " oldRootString=" + oldRootString);
+            Unlock();
             return zkr;
         }
 
@@ -344,6 +463,7 @@ zkresult Database64::WriteTree (const Goldilocks::Element (&oldRoot)[4], const v
         if (oldRootVersion != lastVersion)
         {
             zklog.error("Database64::WriteTree() found oldRootVersion=" + to_string(oldRootVersion) + " but lastVersion=" + to_string(lastVersion) + " oldRootString=" + oldRootString);
+            Unlock();
             return ZKR_DB_ERROR;
         }
         version = lastVersion + 1;
@@ -354,41 +474,22 @@ zkresult Database64::WriteTree (const Goldilocks::Element (&oldRoot)[4], const v
     HeaderStruct *headerPage = (HeaderStruct *)ctx.pageManager.getPageAddress(headerPageNumber);
 
     // Write all key-values
-    string keyString;
-    string key;
-    for (uint64_t i=0; i<keyValues.size(); i++)
+    zkr = HeaderPage::KeyValueHistoryWrite(ctx, headerPageNumber, keyValues, version, ctx.config.hashDB64WriteThreads);
+    if (zkr != ZKR_SUCCESS)
     {
-        keyString = fea2string(fr, keyValues[i].key);
-        key = string2ba(keyString);
-        zkr = HeaderPage::KeyValueHistoryWrite(ctx, headerPageNumber, key, version, keyValues[i].value);
-        if (zkr != ZKR_SUCCESS)
-        {
-            zklog.error("Database64::WriteTree() failed calling HeaderPage::KeyValueHistoryWrite() result=" + zkresult2string(zkr) + " oldRoot=" + fea2string(fr, oldRoot) + " version=" + to_string(version));
-            return ZKR_DB_ERROR;
-        }
-        /*zklog.info("Database64::WriteTree() called HeaderPage::KeyValueHistoryWrite() oldRoot=" + fea2string(fr, oldRoot) + " version=" + to_string(version) + " key=" + keyString + " value=" + keyValues[i].value.get_str(16));
-        
-        mpz_class readValue;
-        zkr = HeaderPage::KeyValueHistoryRead(headerPageNumber, key, version, readValue);
-        if (zkr != ZKR_SUCCESS)
-        {
-            zklog.error("Database64::WriteTree() failed calling HeaderPage::KeyValueHistoryRead() result=" + zkresult2string(zkr) + " oldRoot=" + fea2string(fr, oldRoot) + " version=" + to_string(version));
-            return ZKR_DB_ERROR;
-        }
-        if (readValue != keyValues[i].value)
-        {
-            zklog.error("Database64::WriteTree() called HeaderPage::KeyValueHistoryRead() readValue=" + readValue.get_str(16) + " expectedValue=" +  keyValues[i].value.get_str(16) + " oldRoot=" + fea2string(fr, oldRoot) + " version=" + to_string(version));
-            return ZKR_DB_ERROR;
-        }*/
+        zklog.error("Database64::WriteTree() failed calling HeaderPage::KeyValueHistoryWrite() result=" + zkresult2string(zkr) + " oldRoot=" + fea2string(fr, oldRoot) + " version=" + to_string(version));
+        Unlock();
+        return ZKR_DB_ERROR;
     }
 
     //HeaderPage::Print(headerPageNumber, true);
 
     // Calculate new state root hash
-    zkr = HeaderPage::KeyValueHistoryCalculateHash(ctx, headerPageNumber, newRoot);
+    zkr = HeaderPage::KeyValueHistoryCalculateHash(ctx, headerPageNumber, newRoot, ctx.config.hashDB64WriteThreads);
     if (zkr != ZKR_SUCCESS)
     {
         zklog.error("Database64::WriteTree() failed calling HeaderPage::KeyValueHistoryCalculateHash() result=" + zkresult2string(zkr) + " oldRoot=" + fea2string(fr, oldRoot));
+        Unlock();
         return ZKR_DB_ERROR;
     }
 
@@ -402,13 +503,14 @@ zkresult Database64::WriteTree (const Goldilocks::Element (&oldRoot)[4], const v
         uint64_t rawDataPage;
         uint64_t rawDataOffset;
     };*/
-    if(newRoot[0].fe != oldRoot[0].fe || newRoot[1].fe != oldRoot[1].fe || newRoot[2].fe != oldRoot[2].fe || newRoot[3].fe != oldRoot[3].fe){
+    if(newRoot[0].fe != oldRootCopy[0].fe || newRoot[1].fe != oldRootCopy[1].fe || newRoot[2].fe != oldRootCopy[2].fe || newRoot[3].fe != oldRootCopy[3].fe){
         
         // Create version data
         VersionDataEntry versionData;
         string newRootBa = string2ba(fea2string(fr, newRoot));
         zkassert(newRootBa.size() == 32);
         memcpy(versionData.root, newRootBa.c_str(), 32);
+        headerPage = (HeaderStruct *)ctx.pageManager.getPageAddress(headerPageNumber);
         versionData.keyValueHistoryPage = headerPage->keyValueHistoryPage;
         versionData.key = version;
         //versionData.rawDataPage = headerPage->rawDataPage;
@@ -418,7 +520,8 @@ zkresult Database64::WriteTree (const Goldilocks::Element (&oldRoot)[4], const v
         zkr = HeaderPage::WriteVersionData(ctx, headerPageNumber, version, versionData);
         if (zkr != ZKR_SUCCESS)
         {
-            zklog.error("Database64::WriteTree() failed calling HeaderPage::WriteVersionData() result=" + zkresult2string(zkr) + " oldRoot=" + fea2string(fr, oldRoot));
+            zklog.error("Database64::WriteTree() failed calling HeaderPage::WriteVersionData() result=" + zkresult2string(zkr) + " oldRoot=" + fea2string(fr, oldRootCopy));
+            Unlock();
             return ZKR_DB_ERROR;
         }
 
@@ -426,7 +529,8 @@ zkresult Database64::WriteTree (const Goldilocks::Element (&oldRoot)[4], const v
         zkr = HeaderPage::WriteRootVersion(ctx, headerPageNumber, newRootBa, version);
         if (zkr != ZKR_SUCCESS)
         {
-            zklog.error("Database64::WriteTree() failed calling HeaderPage::WriteRootVersion() result=" + zkresult2string(zkr) + " oldRoot=" + fea2string(fr, oldRoot));
+            zklog.error("Database64::WriteTree() failed calling HeaderPage::WriteRootVersion() result=" + zkresult2string(zkr) + " oldRoot=" + fea2string(fr, oldRootCopy));
+            Unlock();
             return ZKR_DB_ERROR;
         }
 
@@ -440,6 +544,8 @@ zkresult Database64::WriteTree (const Goldilocks::Element (&oldRoot)[4], const v
     
     //KeyValueHistoryPage::Print(versionData.keyValueHistoryPage, true, "version=" + to_string(version) + " ");
 
+    Unlock();
+
     return ZKR_SUCCESS;
 }
 
@@ -471,26 +577,41 @@ zkresult Database64::ReadTree (const Goldilocks::Element (&root)[4], vector<KeyV
     string rootString = fea2string(fr, root);
     string rootBa = string2ba(rootString);
 
+    // Read from the last flushed header, holding the header read lock, as readKV() does
+    ctx.pageManager.readLock();
+
     // Get the version corresponding to this state root
     uint64_t version = 0;
-    zkr = HeaderPage::ReadRootVersion(ctx, headerPageNumber, rootBa, version);
+    zkr = HeaderPage::ReadRootVersion(ctx, 0, rootBa, version);
     if (zkr != ZKR_SUCCESS)
     {
         zklog.error("Database64::ReadTree() failed calling HeaderPage::ReadRootVersion() result=" + zkresult2string(zkr) + " rootString=" + rootString);
+        ctx.pageManager.readUnlock();
         return zkr;
     }
 
-    // Get the version data
-    VersionDataEntry versionData;
-    zkr = HeaderPage::ReadVersionData(ctx, headerPageNumber, version, versionData);
-    if (zkr != ZKR_SUCCESS)
+    // Pruned versions cannot be read
+    HeaderStruct *headerPage = (HeaderStruct *)ctx.pageManager.getPageAddress(0);
+    if (version < headerPage->compactedVersion)
     {
-        zklog.error("Database64::ReadTree() failed calling HeaderPage::ReadVersionData() result=" + zkresult2string(zkr) + " rootString=" + rootString);
-        return zkr;
+        zklog.error("Database64::ReadTree() found version=" + to_string(version) + " < compactedVersion=" + to_string(headerPage->compactedVersion) + " rootString=" + rootString);
+        ctx.pageManager.readUnlock();
+        return ZKR_DB_VERSION_NOT_FOUND_KVDB;
     }
 
-    // Read all key-values
-    zkr = HeaderPage::KeyValueHistoryReadTree(ctx, versionData.keyValueHistoryPage, version, keyValues, hashValues);
+    // Only the hashes of the intermediate nodes of the last version are kept, so previous versions can only be read
+    // without hashes
+    if ((hashValues != NULL) && (version < headerPage->lastVersion))
+    {
+        zklog.error("Database64::ReadTree() called with hashValues for version=" + to_string(version) + " < lastVersion=" + to_string(headerPage->lastVersion) + " rootString=" + rootString);
+        ctx.pageManager.readUnlock();
+        return ZKR_DB_VERSION_NOT_FOUND_KVDB;
+    }
+
+    // Read all key-values from the last key value history, filtering them by version, since the key value history
+    // page of the version data of a previous version is released by the writes and compactions that follow it
+    zkr = HeaderPage::KeyValueHistoryReadTree(ctx, headerPage->keyValueHistoryPage, version, keyValues, hashValues);
+    ctx.pageManager.readUnlock();
     if (zkr != ZKR_SUCCESS)
     {
         zklog.error("Database64::ReadTree() failed calling HeaderPage::KeyValueHistoryReadTree() result=" + zkresult2string(zkr) + " rootString=" + rootString + " version=" + to_string(version));
@@ -504,4 +625,41 @@ zkresult Database64::PrintTree (const string &root)
 {
     zklog.info("Database64::PrintTree() headerPageNumber=" + to_string(headerPageNumber));
     return HeaderPage::KeyValueHistoryPrint(ctx, headerPageNumber, root);
-}
\ No newline at end of file
+}
+
+void *dbCompactionThread64 (void *arg)
+{
+    Database64 *pDatabase = (Database64 *)arg;
+    zklog.info("dbCompactionThread64() started");
+
+    while (true)
+    {
+        // Wait for the compaction period, or until the thread is stopped
+        struct timespec currentTime;
+        int iResult = clock_gettime(CLOCK_REALTIME, &currentTime);
+        if (iResult == -1)
+        {
+            zklog.error("dbCompactionThread64() failed calling clock_gettime()");
+            exitProcess();
+        }
+        uint64_t nsec = currentTime.tv_nsec + (pDatabase->ctx.config.hashDB64CompactionPeriod % 1000)*1000000;
+        currentTime.tv_sec += pDatabase->ctx.config.hashDB64CompactionPeriod/1000 + nsec/1000000000;
+        currentTime.tv_nsec = nsec % 1000000000;
+        sem_timedwait(&pDatabase->compactionSem, &currentTime);
+
+        if (pDatabase->bStopCompaction)
+        {
+            break;
+        }
+
+        KeyValueHistoryCompactionCounters counters;
+        zkresult zkr = pDatabase->compactHistory(counters);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("dbCompactionThread64() failed calling compactHistory() result=" + zkresult2string(zkr));
+        }
+    }
+
+    zklog.info("dbCompactionThread64() done");
+    return NULL;
+}
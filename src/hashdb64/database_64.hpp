@@ -22,6 +22,10 @@
 
 using namespace std;
 
+class KeyValueHistoryCompactionCounters;
+
+#define DATABASE64_COMPACTION_ENTRIES_PER_STEP 4 // Root page entries whose subtrees are compacted by every locked step
+
 
 /*
 
@@ -73,6 +77,16 @@ private:
     PageManager pageManager;
     PageContext ctx;
 
+    // Background compaction
+    pthread_t compactionPthread; // Compaction thread, started by init() if hashDB64CompactionPeriod > 0
+    sem_t compactionSem; // Posted to stop the compaction thread before its period expires
+    bool bCompactionThread = false;
+    atomic<bool> bStopCompaction;
+    friend void *dbCompactionThread64(void *arg);
+
+    // Compacts the subtrees of the root page entries [firstIndex, lastIndex) in a single flush
+    zkresult compactHistory (const uint64_t firstIndex, const uint64_t lastIndex, uint64_t &minVersion, KeyValueHistoryCompactionCounters &counters);
+
 public:
 
     // Constructor and destructor
@@ -109,9 +123,19 @@ public:
     // Reset database content
     zkresult resetDB (void);
 
+    // Prunes the key value history of the versions older than the last kvDBMaxVersions ones, in steps, so that the
+    // writes are only locked out during one of them at a time
+    zkresult compactHistory (KeyValueHistoryCompactionCounters &counters);
+
+    // Pages stats, e.g. to monitor the file size
+    void getPagesStats (uint64_t &firstUnusedPage, uint64_t &usedPages);
+
     // Lock/Unlock
     void Lock(void) { pthread_mutex_lock(&mutex); };
     void Unlock(void) { pthread_mutex_unlock(&mutex); };
 };
 
+// Thread to compact the key value history periodically
+void *dbCompactionThread64(void *arg);
+
 #endif
\ No newline at end of file
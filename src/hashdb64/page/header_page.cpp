@@ -9,6 +9,7 @@
 #include "page_list_page.hpp"
 #include "root_version_page.hpp"
 #include "version_data_page.hpp"
+#include "zkmax.hpp"
 
 
 zkresult HeaderPage::Check (PageContext &ctx, const uint64_t headerPageNumber)
@@ -126,6 +127,14 @@ void HeaderPage::SetLastVersion (PageContext &ctx, uint64_t &headerPageNumber, c
     page->lastVersion = lastVersion;
 }
 
+uint64_t HeaderPage::GetCompactedVersion (PageContext &ctx, const uint64_t headerPageNumber)
+{
+    // Get the header page
+    HeaderStruct * page = (HeaderStruct *)ctx.pageManager.getPageAddress(headerPageNumber);
+
+    return page->compactedVersion;
+}
+
 zkresult HeaderPage::GetFreePagesContainer (PageContext &ctx, const uint64_t headerPageNumber, vector<uint64_t> (&containerPages))
 {
     // Get header page
@@ -267,13 +276,13 @@ zkresult HeaderPage::WriteVersionData (PageContext &ctx, uint64_t &headerPageNum
     return VersionDataPage::Write(ctx, headerPage->versionDataPage, version, versionData, headerPageNumber);
 }
 
-zkresult HeaderPage::KeyValueHistoryRead (PageContext &ctx, const uint64_t keyValueHistoryPage, const string &key, const uint64_t version, mpz_class &value, uint64_t &keyLevel)
+zkresult HeaderPage::KeyValueHistoryRead (PageContext &ctx, const uint64_t keyValueHistoryPage, const KeyValueHistoryKey &key, const uint64_t version, const uint64_t lastVersion, mpz_class &value, uint64_t &keyLevel)
 {
     // Call the specific method
-    return KeyValueHistoryPage::Read(ctx, keyValueHistoryPage, key, version, value, keyLevel);
+    return KeyValueHistoryPage::Read(ctx, keyValueHistoryPage, key, version, lastVersion, value, keyLevel);
 }
 
-zkresult HeaderPage::KeyValueHistoryReadLevel (PageContext &ctx, const uint64_t &headerPageNumber, const string &key, uint64_t &keyLevel)
+zkresult HeaderPage::KeyValueHistoryReadLevel (PageContext &ctx, const uint64_t &headerPageNumber, const KeyValueHistoryKey &key, uint64_t &keyLevel)
 {
     // Get header page
     HeaderStruct * headerPage = (HeaderStruct *)ctx.pageManager.getPageAddress(headerPageNumber);
@@ -288,7 +297,7 @@ zkresult HeaderPage::KeyValueHistoryReadTree (PageContext &ctx, const uint64_t k
     return KeyValueHistoryPage::ReadTree(ctx, keyValueHistoryPage, version, keyValues, hashValues);
 }
 
-zkresult HeaderPage::KeyValueHistoryWrite (PageContext &ctx, uint64_t &headerPageNumber, const string &key, const uint64_t version, const mpz_class &value)
+zkresult HeaderPage::KeyValueHistoryWrite (PageContext &ctx, uint64_t &headerPageNumber, const KeyValueHistoryKey &key, const uint64_t version, const mpz_class &value)
 {
     // Get an editable page
     headerPageNumber = ctx.pageManager.editPage(headerPageNumber);
@@ -312,6 +321,90 @@ zkresult HeaderPage::KeyValueHistoryCalculateHash (PageContext &ctx, uint64_t &h
     return KeyValueHistoryPage::calculateHash(ctx, headerPage->keyValueHistoryPage, hash, headerPageNumber);
 }
 
+// The key value history page number is kept in a local variable, which the parallel writes update, and stored back
+// into the header page at the end
+zkresult HeaderPage::KeyValueHistoryWrite (PageContext &ctx, uint64_t &headerPageNumber, const vector<KeyValueBits> &keyValues, const uint64_t version, const uint64_t nThreads)
+{
+    // Get an editable page
+    headerPageNumber = ctx.pageManager.editPage(headerPageNumber);
+    
+    // Get header page
+    HeaderStruct * headerPage = (HeaderStruct *)ctx.pageManager.getPageAddress(headerPageNumber);
+    uint64_t keyValueHistoryPage = headerPage->keyValueHistoryPage;
+
+    // Call the specific method
+    zkresult zkr = KeyValueHistoryPage::Write(ctx, keyValueHistoryPage, keyValues, version, headerPageNumber, nThreads);
+
+    headerPage = (HeaderStruct *)ctx.pageManager.getPageAddress(headerPageNumber);
+    headerPage->keyValueHistoryPage = keyValueHistoryPage;
+    return zkr;
+}
+
+zkresult HeaderPage::KeyValueHistoryCalculateHash (PageContext &ctx, uint64_t &headerPageNumber, Goldilocks::Element (&hash)[4], const uint64_t nThreads)
+{
+    // Get an editable page
+    headerPageNumber = ctx.pageManager.editPage(headerPageNumber);
+    
+    // Get header page
+    HeaderStruct * headerPage = (HeaderStruct *)ctx.pageManager.getPageAddress(headerPageNumber);
+    uint64_t keyValueHistoryPage = headerPage->keyValueHistoryPage;
+
+    // Call the specific method
+    zkresult zkr = KeyValueHistoryPage::calculateHash(ctx, keyValueHistoryPage, hash, headerPageNumber, nThreads);
+
+    headerPage = (HeaderStruct *)ctx.pageManager.getPageAddress(headerPageNumber);
+    headerPage->keyValueHistoryPage = keyValueHistoryPage;
+    return zkr;
+}
+
+// The header page is only edited if the compaction rewrites any page, and then the version data of the last version,
+// which points to the key value history page as well, is updated too
+zkresult HeaderPage::KeyValueHistoryCompact (PageContext &ctx, uint64_t &headerPageNumber, const uint64_t minVersion, const uint64_t firstIndex, const uint64_t lastIndex, KeyValueHistoryCompactionCounters &counters)
+{
+    zkresult zkr;
+
+    // Get header page
+    HeaderStruct * headerPage = (HeaderStruct *)ctx.pageManager.getPageAddress(headerPageNumber);
+    uint64_t oldKeyValueHistoryPage = headerPage->keyValueHistoryPage;
+    uint64_t keyValueHistoryPage = oldKeyValueHistoryPage;
+    uint64_t lastVersion = headerPage->lastVersion;
+
+    // Call the specific method
+    zkr = KeyValueHistoryPage::Compact(ctx, keyValueHistoryPage, minVersion, firstIndex, lastIndex, counters);
+    if (zkr != ZKR_SUCCESS)
+    {
+        return zkr;
+    }
+    if (keyValueHistoryPage == oldKeyValueHistoryPage)
+    {
+        return ZKR_SUCCESS;
+    }
+
+    // Get an editable page
+    headerPageNumber = ctx.pageManager.editPage(headerPageNumber);
+    headerPage = (HeaderStruct *)ctx.pageManager.getPageAddress(headerPageNumber);
+    headerPage->keyValueHistoryPage = keyValueHistoryPage;
+    headerPage->compactedVersion = zkmax(headerPage->compactedVersion, minVersion);
+
+    // Update the version data of the last version
+    VersionDataEntry versionData;
+    zkr = ReadVersionData(ctx, headerPageNumber, lastVersion, versionData);
+    if (zkr != ZKR_SUCCESS)
+    {
+        zklog.error("HeaderPage::KeyValueHistoryCompact() failed calling ReadVersionData() result=" + zkresult2string(zkr) + " lastVersion=" + to_string(lastVersion));
+        return zkr;
+    }
+    versionData.keyValueHistoryPage = keyValueHistoryPage;
+    zkr = WriteVersionData(ctx, headerPageNumber, lastVersion, versionData);
+    if (zkr != ZKR_SUCCESS)
+    {
+        zklog.error("HeaderPage::KeyValueHistoryCompact() failed calling WriteVersionData() result=" + zkresult2string(zkr) + " lastVersion=" + to_string(lastVersion));
+        return zkr;
+    }
+
+    return ZKR_SUCCESS;
+}
+
 zkresult HeaderPage::KeyValueHistoryPrint (PageContext &ctx, const uint64_t headerPageNumber, const string &root)
 {
     // Get header page
@@ -11,6 +11,7 @@
 #include "key_value.hpp"
 #include "hash_value_gl.hpp"
 #include "page_context.hpp"
+#include "key_value_history_page.hpp"
 
 struct HeaderStruct
 {
@@ -37,6 +38,9 @@ struct HeaderStruct
     // Free pages list
     uint64_t freePages;
     uint64_t firstUnusedPage;
+
+    // Key -> value history compaction
+    uint64_t compactedVersion; // Versions older than this one have been pruned from the key value history
 };
 
 class HeaderPage
@@ -50,6 +54,7 @@ public:
     static zkresult InitEmptyPage  (PageContext &ctx, const uint64_t  headerPageNumber);
     static uint64_t GetLastVersion (PageContext &ctx, const uint64_t  headerPageNumber);
     static void     SetLastVersion (PageContext &ctx,       uint64_t &headerPageNumber, const uint64_t lastVersion);
+    static uint64_t GetCompactedVersion (PageContext &ctx, const uint64_t  headerPageNumber);
 
     // Free pages list methods
     static zkresult GetFreePagesContainer (PageContext &ctx, const uint64_t  headerPageNumber, vector<uint64_t> (&containerPages));
@@ -68,11 +73,14 @@ public:
     static zkresult WriteVersionData (PageContext &ctx,       uint64_t &headerPageNumber, const uint64_t &version, const VersionDataEntry &versionData);
 
     // Key-Value-History methods
-    static zkresult KeyValueHistoryRead          (PageContext &ctx, const uint64_t  keyValueHistoryPage, const string &key, const uint64_t version,       mpz_class &value, uint64_t &keyLevel);
-    static zkresult KeyValueHistoryReadLevel     (PageContext &ctx, const uint64_t &headerPageNumber,    const string &key, uint64_t &keyLevel);
+    static zkresult KeyValueHistoryRead          (PageContext &ctx, const uint64_t  keyValueHistoryPage, const KeyValueHistoryKey &key, const uint64_t version, const uint64_t lastVersion, mpz_class &value, uint64_t &keyLevel);
+    static zkresult KeyValueHistoryReadLevel     (PageContext &ctx, const uint64_t &headerPageNumber,    const KeyValueHistoryKey &key, uint64_t &keyLevel);
     static zkresult KeyValueHistoryReadTree      (PageContext &ctx, const uint64_t  keyValueHistoryPage, const uint64_t version,    vector<KeyValue> &keyValues, vector<HashValueGL> *hashValues);
-    static zkresult KeyValueHistoryWrite         (PageContext &ctx,       uint64_t &headerPageNumber,    const string &key, const uint64_t version, const mpz_class &value);
+    static zkresult KeyValueHistoryWrite         (PageContext &ctx,       uint64_t &headerPageNumber,    const KeyValueHistoryKey &key, const uint64_t version, const mpz_class &value);
     static zkresult KeyValueHistoryCalculateHash (PageContext &ctx,       uint64_t &headerPageNumber,    Goldilocks::Element (&hash)[4]);
+    static zkresult KeyValueHistoryWrite         (PageContext &ctx,       uint64_t &headerPageNumber,    const vector<KeyValueBits> &keyValues, const uint64_t version, const uint64_t nThreads);
+    static zkresult KeyValueHistoryCalculateHash (PageContext &ctx,       uint64_t &headerPageNumber,    Goldilocks::Element (&hash)[4], const uint64_t nThreads);
+    static zkresult KeyValueHistoryCompact       (PageContext &ctx,       uint64_t &headerPageNumber,    const uint64_t minVersion, const uint64_t firstIndex, const uint64_t lastIndex, KeyValueHistoryCompactionCounters &counters);
     static zkresult KeyValueHistoryPrint         (PageContext &ctx, const uint64_t  headerPageNumber,    const string &root);
 
     // Program page methods
@@ -11,6 +11,26 @@
 #include "constants.hpp"
 #include "tree_chunk.hpp"
 #include "zkmax.hpp"
+#include <omp.h>
+
+void KeyValueHistoryKey::fromFea (const Goldilocks::Element (&key)[4])
+{
+    fea2ba(fr, bytes, key);
+    splitKey6(fr, key, bits);
+}
+
+void KeyValueHistoryKey::fromBa (const uint8_t *keyBa)
+{
+    memcpy(bytes, keyBa, 32);
+    Goldilocks::Element key[4];
+    ba2fea(fr, keyBa, key);
+    splitKey6(fr, key, bits);
+}
+
+string KeyValueHistoryKey::toString (void) const
+{
+    return ba2string(bytes, 32);
+}
 
 zkresult KeyValueHistoryPage::InitEmptyPage (PageContext &ctx, const uint64_t pageNumber)
 {
@@ -20,17 +40,15 @@ zkresult KeyValueHistoryPage::InitEmptyPage (PageContext &ctx, const uint64_t pa
     return ZKR_SUCCESS;
 }
 
-zkresult KeyValueHistoryPage::Read (PageContext &ctx, const uint64_t pageNumber, const string &key, const string &keyBits, const uint64_t version, mpz_class &value, const uint64_t level, uint64_t &keyLevel)
+zkresult KeyValueHistoryPage::Read (PageContext &ctx, const uint64_t pageNumber, const KeyValueHistoryKey &key, const uint64_t version, const uint64_t lastVersion, mpz_class &value, const uint64_t level, uint64_t &keyLevel)
 {
-    zkassert(key.size() == 32);
-    zkassert(keyBits.size() == 43);
     zkassert(level < 43);
 
     zkresult zkr;
 
     // Get the data from this page
     KeyValueHistoryStruct * page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(pageNumber);
-    uint64_t index = keyBits[level];
+    uint64_t index = key.bits[level];
     uint64_t control = page->keyValueEntry[index][0] >> 60;
 
     // Check control
@@ -59,52 +77,29 @@ zkresult KeyValueHistoryPage::Read (PageContext &ctx, const uint64_t pageNumber,
                 {
                     uint64_t rawDataPage = keyValueEntry[1] & U64Mask48;
                     uint64_t rawDataOffset = keyValueEntry[1] >> 48;
-                    string keyValue;
+                    uint8_t keyValue[64];
                     zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 64, keyValue);
                     if (zkr != ZKR_SUCCESS)
                     {
-                        zklog.error("KeyValueHistoryPage::Read() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + ba2string(key) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
-                        return zkr;
-                    }
-                    if (keyValue.size() != 64)
-                    {
-                        zklog.error("KeyValueHistoryPage::Read() called RawDataPage.Read and got invalid length=" + to_string(keyValue.size()) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + ba2string(key) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
+                        zklog.error("KeyValueHistoryPage::Read() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + key.toString() + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
                         return zkr;
                     }
 
                     // If this is a different key, then the key does not exist, i.e. the value is 0
-                    if (memcmp(key.c_str(), keyValue.c_str(), 32) != 0)
+                    if (memcmp(key.bytes, keyValue, 32) != 0)
                     {
-                        //zklog.info("KeyValueHistoryPage::Read() found existing key=" + ba2string(keyValue.substr(0, 32)) + " != key=" + ba2string(key));
+                        //zklog.info("KeyValueHistoryPage::Read() found existing key=" + ba2string(keyValue, 32) + " != key=" + key.toString());
                         value = 0;
 
                         // If keys are different, we need to know how different they are
-                        Goldilocks::Element keyFea[4];
-                        string2fea(fr, ba2string(keyValue.substr(0, 32)), keyFea);
-                        uint8_t foundKeyBitsArray[43];
-                        splitKey6(fr, keyFea, foundKeyBitsArray);
-                        string foundKeyBits;
-                        foundKeyBits.append((char *)foundKeyBitsArray, 43);
-
-                        // Find the first 6-bit set that is different
-                        uint64_t i=0;
-                        for (; i<43; i++)
-                        {
-                            if (keyBits[i] != foundKeyBits[i])
-                            {
-                                break;
-                            }
-                        }
-
-                        // Set the level
-                        zkassertpermanent(i>=level);
-                        keyLevel = (i + 1) * 6;
+                        KeyValueHistoryKey foundKey(keyValue);
+                        keyLevel = KeyLevel(key, foundKey, level);
 
                         return ZKR_SUCCESS;
                     }
 
                     // Convert the value
-                    ba2scalar((uint8_t *)keyValue.c_str() + 32, 32, value);
+                    ba2scalar(keyValue + 32, 32, value);
 
                     // Get the key level
                     keyLevel = (level + 1) * 6;
@@ -112,11 +107,16 @@ zkresult KeyValueHistoryPage::Read (PageContext &ctx, const uint64_t pageNumber,
                     return ZKR_SUCCESS;
                 }
 
-                // Search for 
-                uint64_t previousVersionOffset = (page->keyValueEntry[index][0] >> 48) & U64Mask12;
+                // Search for the previous version of this entry, in this page or in the previous ones
+                zkr = GetPreviousEntry(ctx, page, index, keyValueEntry);
+                if (zkr != ZKR_SUCCESS)
+                {
+                    zklog.error("KeyValueHistoryPage::Read() failed calling GetPreviousEntry() result=" + zkresult2string(zkr) + " pageNumber=" + to_string(pageNumber) + " index=" + to_string(index));
+                    return zkr;
+                }
 
                 // If there is no previous version for this key, then this is a zero
-                if (previousVersionOffset == 0)
+                if (keyValueEntry == NULL)
                 {
                     value = 0;
 
@@ -125,18 +125,6 @@ zkresult KeyValueHistoryPage::Read (PageContext &ctx, const uint64_t pageNumber,
 
                     return ZKR_SUCCESS;
                 }
-
-                // If not zero, then check the range of the previous version
-                if ( (previousVersionOffset < minHistoryOffset) ||
-                     (previousVersionOffset > maxHistoryOffset) ||
-                     (((previousVersionOffset - minHistoryOffset) & (entrySize -1) ) != 0) )
-                {
-                    zklog.error("KeyValueHistoryPage::Read() found invalid previousVersionOffset=" + to_string(previousVersionOffset));
-                    return ZKR_DB_ERROR;
-                }
-
-                // Get the previous version entry
-                keyValueEntry = (uint64_t *)((uint8_t *)page + previousVersionOffset);
             }
         }
 
@@ -144,7 +132,47 @@ zkresult KeyValueHistoryPage::Read (PageContext &ctx, const uint64_t pageNumber,
         case 2:
         {
             uint64_t nextPageNumber = page->keyValueEntry[index][1] & U64Mask48;
-            return Read(ctx, nextPageNumber, key, keyBits, version, value, level + 1, keyLevel);
+            zkr = Read(ctx, nextPageNumber, key, version, lastVersion, value, level + 1, keyLevel);
+            if ((zkr != ZKR_SUCCESS) || (version >= lastVersion))
+            {
+                return zkr;
+            }
+
+            // An entry becomes an intermediate node when a second key is written under it, without recording the
+            // version, so if there were less than 2 keys under it at this version, it was still a leaf node or empty
+            uint64_t nKeys;
+            uint64_t *keyValueEntry;
+            zkr = FindKeys(ctx, nextPageNumber, version, 2, nKeys, keyValueEntry);
+            if (zkr != ZKR_SUCCESS)
+            {
+                zklog.error("KeyValueHistoryPage::Read() failed calling FindKeys() result=" + zkresult2string(zkr) + " pageNumber=" + to_string(nextPageNumber) + " version=" + to_string(version));
+                return zkr;
+            }
+            if (nKeys == 1)
+            {
+                uint64_t rawDataPage = keyValueEntry[1] & U64Mask48;
+                uint64_t rawDataOffset = keyValueEntry[1] >> 48;
+                uint8_t foundKeyBa[32];
+                zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 32, foundKeyBa);
+                if (zkr != ZKR_SUCCESS)
+                {
+                    zklog.error("KeyValueHistoryPage::Read() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + key.toString() + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
+                    return zkr;
+                }
+
+                // If it is a different key, we need to know how different they are
+                if (memcmp(key.bytes, foundKeyBa, 32) != 0)
+                {
+                    KeyValueHistoryKey foundKey(foundKeyBa);
+                    keyLevel = KeyLevel(key, foundKey, level);
+                    return ZKR_SUCCESS;
+                }
+            }
+            if (nKeys < 2)
+            {
+                keyLevel = (level + 1) * 6;
+            }
+            return ZKR_SUCCESS;
         }
 
         default:
@@ -158,33 +186,85 @@ zkresult KeyValueHistoryPage::Read (PageContext &ctx, const uint64_t pageNumber,
     return ZKR_DB_KEY_NOT_FOUND;
 }
 
-zkresult KeyValueHistoryPage::Read (PageContext &ctx, const uint64_t pageNumber, const string &key, const uint64_t version, mpz_class &value, uint64_t &keyLevel)
+zkresult KeyValueHistoryPage::Read (PageContext &ctx, const uint64_t pageNumber, const KeyValueHistoryKey &key, const uint64_t version, const uint64_t lastVersion, mpz_class &value, uint64_t &keyLevel)
 {
-    zkassert(key.size() == 32);
     zkassert((version & U64Mask48) == version);
 
-    // Get 256 key bits in SMT order, in sets of 6 bits
-    Goldilocks::Element keyFea[4];
-    string2fea(fr, ba2string(key), keyFea);
-    uint8_t keyBitsArray[43];
-    splitKey6(fr, keyFea, keyBitsArray);
-    string keyBits;
-    keyBits.append((char *)keyBitsArray, 43);
+    return Read(ctx, pageNumber, key, version, lastVersion, value, 0, keyLevel);
+}
+
+// Counts the keys under a page that had been written at a version, i.e. that have an entry of that version or an older
+// one, up to maxKeys; keyValueEntry is the entry of the last one found.  Previous versions are seldom read, and the
+// search ends as soon as maxKeys are found, but it can visit every key under the page if they are all newer
+zkresult KeyValueHistoryPage::FindKeys (PageContext &ctx, const uint64_t pageNumber, const uint64_t version, const uint64_t maxKeys, uint64_t &nKeys, uint64_t *&keyValueEntry)
+{
+    zkresult zkr;
+    nKeys = 0;
+    keyValueEntry = NULL;
+    for (uint64_t index = 0; (index < 64) && (nKeys < maxKeys); index++)
+    {
+        KeyValueHistoryStruct *page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(pageNumber);
+        uint64_t control = page->keyValueEntry[index][0] >> 60;
+        if (control == 1)
+        {
+            uint64_t *entry = page->keyValueEntry[index];
+            while ((entry != NULL) && ((entry[0] & U64Mask48) > version))
+            {
+                zkr = GetPreviousEntry(ctx, page, index, entry);
+                if (zkr != ZKR_SUCCESS)
+                {
+                    return zkr;
+                }
+            }
+            if (entry != NULL)
+            {
+                nKeys++;
+                keyValueEntry = entry;
+            }
+        }
+        else if (control == 2)
+        {
+            uint64_t nSubtreeKeys;
+            uint64_t *subtreeEntry;
+            zkr = FindKeys(ctx, page->keyValueEntry[index][1] & U64Mask48, version, maxKeys - nKeys, nSubtreeKeys, subtreeEntry);
+            if (zkr != ZKR_SUCCESS)
+            {
+                return zkr;
+            }
+            if (nSubtreeKeys > 0)
+            {
+                nKeys += nSubtreeKeys;
+                keyValueEntry = subtreeEntry;
+            }
+        }
+    }
+    return ZKR_SUCCESS;
+}
 
-    return Read(ctx, pageNumber, key, keyBits, version, value, 0, keyLevel);
+// Gets the level of a key whose entry at level is the one of a different key, i.e. the first 6-bit set that is different
+uint64_t KeyValueHistoryPage::KeyLevel (const KeyValueHistoryKey &key, const KeyValueHistoryKey &foundKey, const uint64_t level)
+{
+    uint64_t i=0;
+    for (; i<43; i++)
+    {
+        if (key.bits[i] != foundKey.bits[i])
+        {
+            break;
+        }
+    }
+    zkassertpermanent(i>=level);
+    return (i + 1) * 6;
 }
 
-zkresult KeyValueHistoryPage::ReadLevel (PageContext &ctx, const uint64_t pageNumber, const string &key, const string &keyBits, const uint64_t level, uint64_t &keyLevel)
+zkresult KeyValueHistoryPage::ReadLevel (PageContext &ctx, const uint64_t pageNumber, const KeyValueHistoryKey &key, const uint64_t level, uint64_t &keyLevel)
 {
-    zkassert(key.size() == 32);
-    zkassert(keyBits.size() == 43);
     zkassert(level < 43);
 
     zkresult zkr;
 
     // Get the data from this page
     KeyValueHistoryStruct * page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(pageNumber);
-    uint64_t index = keyBits[level];
+    uint64_t index = key.bits[level];
     uint64_t control = page->keyValueEntry[index][0] >> 60;
 
     // Check control
@@ -202,21 +282,16 @@ zkresult KeyValueHistoryPage::ReadLevel (PageContext &ctx, const uint64_t pageNu
         {
             uint64_t rawDataPage = page->keyValueEntry[index][1] & U64Mask48;
             uint64_t rawDataOffset = page->keyValueEntry[index][1] >> 48;
-            string keyValue;
+            uint8_t keyValue[64];
             zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 64, keyValue);
             if (zkr != ZKR_SUCCESS)
             {
-                zklog.error("KeyValueHistoryPage::ReadLevel() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + ba2string(key) + " level=" + to_string(level) + " index=" + to_string(index));
-                return zkr;
-            }
-            if (keyValue.size() != 64)
-            {
-                zklog.error("KeyValueHistoryPage::ReadLevel() called RawDataPage.Read and got invalid length=" + to_string(keyValue.size()) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + ba2string(key) + " level=" + to_string(level) + " index=" + to_string(index));
+                zklog.error("KeyValueHistoryPage::ReadLevel() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + key.toString() + " level=" + to_string(level) + " index=" + to_string(index));
                 return zkr;
             }
 
             // If this is the same key
-            if (memcmp(key.c_str(), keyValue.c_str(), 32) == 0)
+            if (memcmp(key.bytes, keyValue, 32) == 0)
             {
                 // Get the key level
                 keyLevel = (level + 1) * 6; 
@@ -225,18 +300,13 @@ zkresult KeyValueHistoryPage::ReadLevel (PageContext &ctx, const uint64_t pageNu
             }
 
             // If keys are different, we need to know how different they are
-            Goldilocks::Element keyFea[4];
-            string2fea(fr, ba2string(keyValue.substr(0, 32)), keyFea);
-            uint8_t foundKeyBitsArray[43];
-            splitKey6(fr, keyFea, foundKeyBitsArray);
-            string foundKeyBits;
-            foundKeyBits.append((char *)foundKeyBitsArray, 43);
+            KeyValueHistoryKey foundKey(keyValue);
 
             // Find the first 6-bit set that is different
             uint64_t i=0;
             for (; i<43; i++)
             {
-                if (keyBits[i] != foundKeyBits[i])
+                if (key.bits[i] != foundKey.bits[i])
                 {
                     break;
                 }
@@ -252,7 +322,7 @@ zkresult KeyValueHistoryPage::ReadLevel (PageContext &ctx, const uint64_t pageNu
         case 2:
         {
             uint64_t nextPageNumber = page->keyValueEntry[index][1] & U64Mask48;
-            return ReadLevel(ctx, nextPageNumber, key, keyBits, level + 1, keyLevel);
+            return ReadLevel(ctx, nextPageNumber, key, level + 1, keyLevel);
         }
 
         default:
@@ -266,32 +336,20 @@ zkresult KeyValueHistoryPage::ReadLevel (PageContext &ctx, const uint64_t pageNu
     return ZKR_DB_KEY_NOT_FOUND;
 }
 
-zkresult KeyValueHistoryPage::ReadLevel (PageContext &ctx, const uint64_t pageNumber, const string &key, uint64_t &keyLevel)
+zkresult KeyValueHistoryPage::ReadLevel (PageContext &ctx, const uint64_t pageNumber, const KeyValueHistoryKey &key, uint64_t &keyLevel)
 {
-    zkassert(key.size() == 32);
-
-    // Get 256 key bits in SMT order, in sets of 6 bits
-    Goldilocks::Element keyFea[4];
-    string2fea(fr, ba2string(key), keyFea);
-    uint8_t keyBitsArray[43];
-    splitKey6(fr, keyFea, keyBitsArray);
-    string keyBits;
-    keyBits.append((char *)keyBitsArray, 43);
-
-    return ReadLevel(ctx, pageNumber, key, keyBits, 0, keyLevel);
+    return ReadLevel(ctx, pageNumber, key, 0, keyLevel);
 }
 
-zkresult KeyValueHistoryPage::ReadTree (PageContext &ctx, const uint64_t pageNumber, const string &key, const string &keyBits, const uint64_t version, mpz_class &value, vector<HashValueGL> *hashValues, const uint64_t level, unordered_map<uint64_t, TreeChunk> &treeChunkMap)
+zkresult KeyValueHistoryPage::ReadTree (PageContext &ctx, const uint64_t pageNumber, const KeyValueHistoryKey &key, const uint64_t version, mpz_class &value, vector<HashValueGL> *hashValues, const uint64_t level, unordered_map<uint64_t, TreeChunk> &treeChunkMap)
 {
-    zkassert(key.size() == 32);
-    zkassert(keyBits.size() == 43);
     zkassert(level < 43);
 
     zkresult zkr;
 
     // Get the data from this page
     KeyValueHistoryStruct * page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(pageNumber);
-    uint64_t index = keyBits[level];
+    uint64_t index = key.bits[level];
     uint64_t control = page->keyValueEntry[index][0] >> 60;
 
     // Create a tree chunk for this page, and store it in treeChunkMap, if it does not exist
@@ -356,23 +414,18 @@ zkresult KeyValueHistoryPage::ReadTree (PageContext &ctx, const uint64_t pageNum
                 {
                     uint64_t rawDataPage = keyValueEntry[1] & U64Mask48;
                     uint64_t rawDataOffset = keyValueEntry[1] >> 48;
-                    string keyValue;
+                    uint8_t keyValue[64];
                     zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 64, keyValue);
                     if (zkr != ZKR_SUCCESS)
                     {
-                        zklog.error("KeyValueHistoryPage::ReadTree() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + ba2string(key) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
-                        return zkr;
-                    }
-                    if (keyValue.size() != 64)
-                    {
-                        zklog.error("KeyValueHistoryPage::ReadTree() called RawDataPage.Read and got invalid length=" + to_string(keyValue.size()) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + ba2string(key) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
+                        zklog.error("KeyValueHistoryPage::ReadTree() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + key.toString() + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
                         return zkr;
                     }
 
                     // If this is a different key, then the key does not exist, i.e. the value is 0
-                    if (memcmp(key.c_str(), keyValue.c_str(), 32) != 0)
+                    if (memcmp(key.bytes, keyValue, 32) != 0)
                     {
-                        //zklog.info("KeyValueHistoryPage::Read() found existing key=" + ba2string(keyValue.substr(0, 32)) + " != key=" + ba2string(key));
+                        //zklog.info("KeyValueHistoryPage::Read() found existing key=" + ba2string(keyValue, 32) + " != key=" + key.toString());
                         value = 0;
 
                         // Get the hash and values
@@ -387,7 +440,7 @@ zkresult KeyValueHistoryPage::ReadTree (PageContext &ctx, const uint64_t pageNum
                     }
 
                     // Convert the value
-                    ba2scalar((uint8_t *)keyValue.c_str() + 32, 32, value);
+                    ba2scalar(keyValue + 32, 32, value);
 
                     // Get the hash and values
                     zkr = treeChunk.getHashValues(index, hashValues);
@@ -400,11 +453,16 @@ zkresult KeyValueHistoryPage::ReadTree (PageContext &ctx, const uint64_t pageNum
                     return ZKR_SUCCESS;
                 }
 
-                // Search for 
-                uint64_t previousVersionOffset = (page->keyValueEntry[index][1] >> 48) & U64Mask12;
+                // Search for the previous version of this entry, in this page or in the previous ones
+                zkr = GetPreviousEntry(ctx, page, index, keyValueEntry);
+                if (zkr != ZKR_SUCCESS)
+                {
+                    zklog.error("KeyValueHistoryPage::ReadTree() failed calling GetPreviousEntry() result=" + zkresult2string(zkr) + " pageNumber=" + to_string(pageNumber) + " index=" + to_string(index));
+                    return zkr;
+                }
 
                 // If there is no previous version for this key, then this is a zero
-                if (previousVersionOffset == 0)
+                if (keyValueEntry == NULL)
                 {
                     value = 0;
 
@@ -418,18 +476,6 @@ zkresult KeyValueHistoryPage::ReadTree (PageContext &ctx, const uint64_t pageNum
 
                     return ZKR_SUCCESS;
                 }
-
-                // If not zero, then check the range of the previous version
-                if ( (previousVersionOffset < minHistoryOffset) ||
-                     (previousVersionOffset > maxHistoryOffset) ||
-                     ((previousVersionOffset & U64Mask4) != 0) )
-                {
-                    zklog.error("KeyValueHistoryPage::ReadTree() found invalid previousVersionOffset=" + to_string(previousVersionOffset));
-                    return ZKR_DB_ERROR;
-                }
-
-                // Get the previous version entry
-                keyValueEntry = (uint64_t *)((uint8_t *)page + previousVersionOffset);
             }
         }
 
@@ -445,7 +491,7 @@ zkresult KeyValueHistoryPage::ReadTree (PageContext &ctx, const uint64_t pageNum
             }
 
             uint64_t nextPageNumber = page->keyValueEntry[index][1] & U64Mask48;
-            return ReadTree(ctx, nextPageNumber, key, keyBits, version, value, hashValues, level + 1, treeChunkMap);
+            return ReadTree(ctx, nextPageNumber, key, version, value, hashValues, level + 1, treeChunkMap);
         }
 
         default:
@@ -469,17 +515,26 @@ zkresult KeyValueHistoryPage::ReadTree (PageContext &ctx, const uint64_t pageNum
 
     for (uint64_t i=0; i<keyValues.size(); i++)
     {
-        uint8_t keyBitsArray[43];
-        splitKey6(fr, keyValues[i].key, keyBitsArray);
-        string keyBits;
-        keyBits.append((char *)keyBitsArray, 43);
-        string keyString = fea2string(fr, keyValues[i].key);
-        string keyBa = string2ba(keyString);
-
-        zkr = ReadTree(ctx, pageNumber, keyBa, keyBits, version, keyValues[i].value, hashValues, 0, treeChunkMap);
+        KeyValueHistoryKey key(keyValues[i].key);
+
+        // The tree chunks are only needed to get the hashes, so the values alone are read as Read() does, which does
+        // not require the hashes of the leaf nodes of previous versions either
+        if (hashValues == NULL)
+        {
+            uint64_t keyLevel;
+            zkr = Read(ctx, pageNumber, key, version, version, keyValues[i].value, keyLevel);
+            if (zkr != ZKR_SUCCESS)
+            {
+                zklog.error("KeyValueHistoryPage::ReadTree() failed calling Read() result=" + zkresult2string(zkr) + " i=" + to_string(i) + " key=" + fea2string(fr, keyValues[i].key));
+                return zkr;
+            }
+            continue;
+        }
+
+        zkr = ReadTree(ctx, pageNumber, key, version, keyValues[i].value, hashValues, 0, treeChunkMap);
         if (zkr != ZKR_SUCCESS)
         {
-            zklog.error("KeyValueHistoryPage::ReadTree() failed calling RedTree() result=" + zkresult2string(zkr) + " i=" + to_string(i) + " key=" + keyString);
+            zklog.error("KeyValueHistoryPage::ReadTree() failed calling RedTree() result=" + zkresult2string(zkr) + " i=" + to_string(i) + " key=" + fea2string(fr, keyValues[i].key));
             return zkr;
         }
     }
@@ -487,10 +542,8 @@ zkresult KeyValueHistoryPage::ReadTree (PageContext &ctx, const uint64_t pageNum
     return ZKR_SUCCESS;
 }
 
-zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, const string &key, const string &keyBits, const uint64_t version, const mpz_class &value, const uint64_t level, uint64_t &headerPageNumber)
+zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, const KeyValueHistoryKey &key, const uint64_t version, const mpz_class &value, const uint64_t level, uint64_t &headerPageNumber)
 {
-    zkassert(key.size() == 32);
-    zkassert(keyBits.size() == 43);
     zkassert(level < 43);
 
     zkresult zkr;
@@ -498,7 +551,7 @@ zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, con
     // Get the data from this page
     pageNumber = ctx.pageManager.editPage(pageNumber);
     KeyValueHistoryStruct * page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(pageNumber);
-    uint64_t index = keyBits[level];
+    uint64_t index = key.bits[level];
     uint64_t control = page->keyValueEntry[index][0] >> 60;
 
     // Check control
@@ -518,11 +571,13 @@ zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, con
             uint64_t insertionRawDataPage = headerPage->rawDataPage;
             uint64_t insertionRawDataOffset = RawDataPage::GetOffset(ctx, insertionRawDataPage);
 
-            string keyAndValue = key + scalar2ba32(value);  // TODO: Check that value size=32
-            zkr = RawDataPage::Write(ctx, headerPage->rawDataPage, keyAndValue);
+            uint8_t keyAndValue[64];
+            memcpy(keyAndValue, key.bytes, 32);
+            scalar2ba32(value, keyAndValue + 32);
+            zkr = RawDataPage::Write(ctx, headerPage->rawDataPage, keyAndValue, 64);
             if (zkr != ZKR_SUCCESS)
             {
-                zklog.error("KeyValueHistoryPage::Write() failed calling RawDataPage.Write result=" + zkresult2string(zkr) + " insertionRawDataPage=" + to_string(insertionRawDataPage) + " insertionRawDataOffset=" + to_string(insertionRawDataOffset) + " key=" + ba2string(key) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
+                zklog.error("KeyValueHistoryPage::Write() failed calling RawDataPage.Write result=" + zkresult2string(zkr) + " insertionRawDataPage=" + to_string(insertionRawDataPage) + " insertionRawDataOffset=" + to_string(insertionRawDataOffset) + " key=" + key.toString() + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
                 return zkr;
             }
 
@@ -549,25 +604,21 @@ zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, con
             // Read the key and value stored in raw data
             uint64_t rawDataPage = page->keyValueEntry[index][1] & U64Mask48;
             uint64_t rawDataOffset = page->keyValueEntry[index][1] >> 48;
-            string keyAndValue;
+            uint8_t keyAndValue[64];
             zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 64, keyAndValue);
             if (zkr != ZKR_SUCCESS)
             {
-                zklog.error("KeyValueHistoryPage::Write() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + ba2string(key) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
-                return zkr;
-            }
-            if (keyAndValue.size() != 64)
-            {
-                zklog.error("KeyValueHistoryPage::Write() called RawDataPage.Read but got invalid keyAndValue.size=" + zkresult2string(keyAndValue.size()) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + ba2string(key) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
+                zklog.error("KeyValueHistoryPage::Write() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + key.toString() + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
                 return zkr;
             }
 
             // If the key is the same
-            if (memcmp(key.c_str(), keyAndValue.c_str(), 32) == 0)
+            if (memcmp(key.bytes, keyAndValue, 32) == 0)
             {
                 // If both the key and value are the same, there's nothing to do, even if versions are not the same (we leave the oldest one)
-                string valueBa = scalar2ba32(value);
-                if (memcmp(valueBa.c_str(), keyAndValue.c_str() + 32, 32) == 0)
+                uint8_t valueBa[32];
+                scalar2ba32(value, valueBa);
+                if (memcmp(valueBa, keyAndValue + 32, 32) == 0)
                 {
                     return ZKR_SUCCESS;
                 }
@@ -576,7 +627,7 @@ zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, con
                 uint64_t currentVersion = page->keyValueEntry[index][0] & U64Mask48;
                 if (version < currentVersion)
                 {
-                    zklog.error("KeyValueHistoryPage::Write() version discrepancy currentVersion=" + to_string(currentVersion) + " key=" + ba2string(key) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
+                    zklog.error("KeyValueHistoryPage::Write() version discrepancy currentVersion=" + to_string(currentVersion) + " key=" + key.toString() + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
                     return ZKR_DB_ERROR;
                 }
 
@@ -587,10 +638,18 @@ zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, con
                     uint64_t newPageNumber = ctx.pageManager.getFreePage();
                     KeyValueHistoryStruct *newPage = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(newPageNumber);
 
-                    // Copy data from the current page to the new one
+                    // Copy data from the current page to the new one; the previous versions stay in the current page, where
+                    // the readers follow them when they reach the end of the history of the new page
                     memcpy(newPage, page, minHistoryOffset);
                     newPage->historyOffset = minHistoryOffset;
                     newPage->previousPage = pageNumber;
+                    for (uint64_t i=0; i<64; i++)
+                    {
+                        if ((newPage->keyValueEntry[i][0] >> 60) == 1)
+                        {
+                            newPage->keyValueEntry[i][0] &= ~(U64Mask12 << 48);
+                        }
+                    }
 
                     // Replace the current page by the new one
                     pageNumber = newPageNumber;
@@ -610,11 +669,11 @@ zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, con
                 uint64_t insertionRawDataPage = headerPage->rawDataPage;
                 uint64_t insertionRawDataOffset = RawDataPage::GetOffset(ctx, headerPage->rawDataPage);
 
-                string keyAndValue = key + valueBa;
-                zkr = RawDataPage::Write(ctx, headerPage->rawDataPage, keyAndValue);
+                memcpy(keyAndValue + 32, valueBa, 32);
+                zkr = RawDataPage::Write(ctx, headerPage->rawDataPage, keyAndValue, 64);
                 if (zkr != ZKR_SUCCESS)
                 {
-                    zklog.error("KeyValueHistoryPage::Write() failed calling RawDataPage.Write result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + ba2string(key) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
+                    zklog.error("KeyValueHistoryPage::Write() failed calling RawDataPage.Write result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " key=" + key.toString() + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
                     return zkr;
                 }
 
@@ -627,19 +686,29 @@ zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, con
             }
 
             // If the key is different, move the key to a new KeyValuePage, and write the new key into the new page
+            KeyValueHistoryKey foundKey(keyAndValue);
+            uint64_t newIndex = foundKey.bits[level+1];
+            uint64_t foundEntry[3];
+            memcpy(foundEntry, page->keyValueEntry[index], entrySize);
+
+            // Get its previous versions, to move them as well
+            vector<uint64_t> histories[64];
+            zkr = GetHistory(ctx, pageNumber, index, 0, histories[newIndex]);
+            if (zkr != ZKR_SUCCESS)
+            {
+                zklog.error("KeyValueHistoryPage::Write() failed calling GetHistory() result=" + zkresult2string(zkr) + " key=" + key.toString() + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
+                return zkr;
+            }
+
             uint64_t newPageNumber = ctx.pageManager.getFreePage();
             KeyValueHistoryPage::InitEmptyPage(ctx, newPageNumber);
             KeyValueHistoryStruct *newPage = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(newPageNumber);
-            Goldilocks::Element keyFea[4];
-            string2fea(fr, ba2string(keyAndValue.substr(0, 32)), keyFea);
-            uint8_t newKeyBits[43];
-            splitKey6(fr, keyFea, newKeyBits);
-            uint64_t newIndex = newKeyBits[level+1];
-            newPage->keyValueEntry[newIndex][0] = page->keyValueEntry[index][0] & (U64Mask4<<60 | U64Mask48);
-            newPage->keyValueEntry[newIndex][1] = page->keyValueEntry[index][1];
+            newPage->keyValueEntry[newIndex][0] = foundEntry[0] & (U64Mask4<<60 | U64Mask48);
+            newPage->keyValueEntry[newIndex][1] = foundEntry[1];
             newPage->keyValueEntry[newIndex][2] = 0; // Invalidate hash, since level has changed
+            WriteHistory(ctx, newPageNumber, histories);
 
-            zkr = Write(ctx, newPageNumber, key, keyBits, version, value, level+1, headerPageNumber);
+            zkr = Write(ctx, newPageNumber, key, version, value, level+1, headerPageNumber);
             if (zkr == ZKR_SUCCESS)
             {
                 page->keyValueEntry[index][0] = uint64_t(2) << 60;
@@ -656,7 +725,7 @@ zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, con
             // Call Write with the next page number, which can be modified in it runs out of history
             uint64_t oldNextPageNumber = page->keyValueEntry[index][1] & U64Mask48;
             uint64_t newNextPageNumber = oldNextPageNumber;
-            zkr = Write(ctx, newNextPageNumber, key, keyBits, version, value, level + 1, headerPageNumber);
+            zkr = Write(ctx, newNextPageNumber, key, version, value, level + 1, headerPageNumber);
             // newNextPageNumber can be modified in the Write call
             page->keyValueEntry[index][1] = newNextPageNumber;
             page->keyValueEntry[index][2] = 0;
@@ -672,21 +741,419 @@ zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, con
     }
 }
 
-zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, const string &key, const uint64_t version, const mpz_class &value, uint64_t &headerPageNumber)
+zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, const KeyValueHistoryKey &key, const uint64_t version, const mpz_class &value, uint64_t &headerPageNumber)
 {
-    zkassert(key.size() == 32);
     zkassert((version & U64Mask48) == version);
 
-    // Get 256 key bits in SMT order, in sets of 6 bits
-    Goldilocks::Element keyFea[4];
-    string2fea(fr, ba2string(key), keyFea);
-    uint8_t keyBitsArray[43];
-    splitKey6(fr, keyFea, keyBitsArray);
-    string keyBits;
-    keyBits.append((char *)keyBitsArray, 43);
-
     // Start searching with level 0
-    return Write(ctx, pageNumber, key, keyBits, version, value, 0, headerPageNumber);
+    return Write(ctx, pageNumber, key, version, value, 0, headerPageNumber);
+}
+
+void KeyValueHistoryPage::GetKeyBits (const KeyValue &keyValue, KeyValueBits &keyValueBits)
+{
+    keyValueBits.key.fromFea(keyValue.key);
+    keyValueBits.value = keyValue.value;
+}
+
+/*
+    Writes all the key-values, in order.  The subtrees of the entries of the root page are disjoint, so once an entry
+    is an intermediate node, writing a key under it only changes its subtree and that entry.  The key-values are
+    partitioned by their root page index, every partition is written serially until its entry becomes an intermediate
+    node, and the rest of the partitions are written in parallel, every thread appending its raw data to its own list
+    of raw data pages, which are appended to the header one at the end.
+*/
+zkresult KeyValueHistoryPage::Write (PageContext &ctx, uint64_t &pageNumber, const vector<KeyValueBits> &keyValues, const uint64_t version, uint64_t &headerPageNumber, const uint64_t nThreads)
+{
+    zkassert((version & U64Mask48) == version);
+
+    zkresult zkr;
+
+    // Partition the key-values by root page index, keeping their order, since a key can be written more than once
+    vector<uint64_t> partitions[64];
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        partitions[keyValues[i].key.bits[0]].emplace_back(i);
+    }
+
+    // Write serially until every partition is an intermediate node, or all of it if there are not enough keys left to
+    // be worth the threads, since every thread leaves the unused space of its last raw data page behind
+    uint64_t firstParallelKey[64];
+    vector<uint64_t> parallelPartitions;
+    uint64_t nParallelKeys = 0;
+    for (uint64_t index = 0; index < 64; index++)
+    {
+        uint64_t i = 0;
+        for (; i < partitions[index].size(); i++)
+        {
+            pageNumber = ctx.pageManager.editPage(pageNumber);
+            KeyValueHistoryStruct *page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(pageNumber);
+            if ((nThreads > 1) && ((page->keyValueEntry[index][0] >> 60) == 2))
+            {
+                break;
+            }
+            const KeyValueBits &keyValue = keyValues[partitions[index][i]];
+            zkr = Write(ctx, pageNumber, keyValue.key, version, keyValue.value, 0, headerPageNumber);
+            if (zkr != ZKR_SUCCESS)
+            {
+                return zkr;
+            }
+        }
+        firstParallelKey[index] = i;
+        if (i < partitions[index].size())
+        {
+            parallelPartitions.emplace_back(index);
+            nParallelKeys += partitions[index].size() - i;
+        }
+    }
+    if (parallelPartitions.size() == 0)
+    {
+        return ZKR_SUCCESS;
+    }
+    uint64_t nParallelThreads = zkmin(nThreads, nParallelKeys / KEY_VALUE_HISTORY_PARALLEL_MIN_KEYS_PER_THREAD);
+    nParallelThreads = zkmin(nParallelThreads, parallelPartitions.size());
+
+    // If not worth it, write the rest of the partitions serially, as intermediate nodes
+    if (nParallelThreads <= 1)
+    {
+        for (uint64_t p = 0; p < parallelPartitions.size(); p++)
+        {
+            uint64_t index = parallelPartitions[p];
+            for (uint64_t i = firstParallelKey[index]; i < partitions[index].size(); i++)
+            {
+                const KeyValueBits &keyValue = keyValues[partitions[index][i]];
+                zkr = Write(ctx, pageNumber, keyValue.key, version, keyValue.value, 0, headerPageNumber);
+                if (zkr != ZKR_SUCCESS)
+                {
+                    return zkr;
+                }
+            }
+        }
+        return ZKR_SUCCESS;
+    }
+
+    // Write the subtrees in parallel, as the intermediate node case of the serial Write() does
+    vector<uint64_t> threadHeaderPages;
+    beginParallelWrite(ctx, nParallelThreads, nParallelKeys*KEY_VALUE_HISTORY_PARALLEL_PAGES_PER_KEY, threadHeaderPages);
+    vector<zkresult> results(parallelPartitions.size(), ZKR_SUCCESS);
+
+    pageNumber = ctx.pageManager.editPage(pageNumber);
+    KeyValueHistoryStruct *page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(pageNumber);
+
+#pragma omp parallel for schedule(dynamic) num_threads(nParallelThreads)
+    for (uint64_t p = 0; p < parallelPartitions.size(); p++)
+    {
+        uint64_t index = parallelPartitions[p];
+        uint64_t &threadHeaderPageNumber = threadHeaderPages[omp_get_thread_num()];
+        uint64_t nextPageNumber = page->keyValueEntry[index][1] & U64Mask48;
+        for (uint64_t i = firstParallelKey[index]; i < partitions[index].size(); i++)
+        {
+            const KeyValueBits &keyValue = keyValues[partitions[index][i]];
+            results[p] = Write(ctx, nextPageNumber, keyValue.key, version, keyValue.value, 1, threadHeaderPageNumber);
+            if (results[p] != ZKR_SUCCESS)
+            {
+                break;
+            }
+        }
+        page->keyValueEntry[index][1] = nextPageNumber;
+        page->keyValueEntry[index][2] = 0;
+    }
+
+    zkr = endParallelWrite(ctx, threadHeaderPages, headerPageNumber);
+    for (uint64_t p = 0; p < parallelPartitions.size(); p++)
+    {
+        if (results[p] != ZKR_SUCCESS)
+        {
+            zklog.error("KeyValueHistoryPage::Write() failed writing the keys of index=" + to_string(parallelPartitions[p]) + " result=" + zkresult2string(results[p]) + " version=" + to_string(version));
+            return results[p];
+        }
+    }
+    return zkr;
+}
+
+// Every thread writes its raw data through a header page of its own, of which only the raw data pages are used, so
+// that the serial Write() and calculatePageHash() can be called from the threads
+void KeyValueHistoryPage::beginParallelWrite (PageContext &ctx, const uint64_t nThreads, const uint64_t nPagesHint, vector<uint64_t> &threadHeaderPages)
+{
+    threadHeaderPages.resize(nThreads);
+    for (uint64_t t = 0; t < nThreads; t++)
+    {
+        threadHeaderPages[t] = ctx.pageManager.getFreePage();
+        HeaderStruct *threadHeaderPage = (HeaderStruct *)ctx.pageManager.getPageAddress(threadHeaderPages[t]);
+        threadHeaderPage->firstRawDataPage = ctx.pageManager.getFreePage();
+        RawDataPage::InitEmptyPage(ctx, threadHeaderPage->firstRawDataPage);
+        threadHeaderPage->rawDataPage = threadHeaderPage->firstRawDataPage;
+    }
+    ctx.pageManager.beginParallelWrites(nThreads, nPagesHint);
+}
+
+zkresult KeyValueHistoryPage::endParallelWrite (PageContext &ctx, const vector<uint64_t> &threadHeaderPages, uint64_t &headerPageNumber)
+{
+    ctx.pageManager.endParallelWrites();
+
+    // Append the raw data pages of every thread to the header ones, and release the thread header pages
+    headerPageNumber = ctx.pageManager.editPage(headerPageNumber);
+    HeaderStruct *headerPage = (HeaderStruct *)ctx.pageManager.getPageAddress(headerPageNumber);
+    zkresult result = ZKR_SUCCESS;
+    for (uint64_t t = 0; t < threadHeaderPages.size(); t++)
+    {
+        HeaderStruct *threadHeaderPage = (HeaderStruct *)ctx.pageManager.getPageAddress(threadHeaderPages[t]);
+        zkresult zkr = RawDataPage::Append(ctx, headerPage->rawDataPage, threadHeaderPage->firstRawDataPage, threadHeaderPage->rawDataPage);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("KeyValueHistoryPage::endParallelWrite() failed calling RawDataPage::Append() result=" + zkresult2string(zkr) + " thread=" + to_string(t));
+            result = zkr;
+        }
+        ctx.pageManager.releasePage(threadHeaderPages[t]);
+    }
+    return result;
+}
+
+// Gets the previous version of a leaf node entry, which is in the history of this page or, when it ends, in the same
+// entry of the previous page; keyValueEntry is set to NULL if there is no previous version
+zkresult KeyValueHistoryPage::GetPreviousEntry (PageContext &ctx, KeyValueHistoryStruct *&page, const uint64_t index, uint64_t *&keyValueEntry)
+{
+    uint64_t previousVersionOffset = (keyValueEntry[0] >> 48) & U64Mask12;
+
+    // If there is no previous version in this page, continue with the previous page, if any
+    if (previousVersionOffset == 0)
+    {
+        if (page->previousPage == 0)
+        {
+            keyValueEntry = NULL;
+            return ZKR_SUCCESS;
+        }
+        page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(page->previousPage);
+        keyValueEntry = ((page->keyValueEntry[index][0] >> 60) == 1) ? page->keyValueEntry[index] : NULL;
+        return ZKR_SUCCESS;
+    }
+
+    // If not zero, then check the range of the previous version
+    if ( (previousVersionOffset < minHistoryOffset) ||
+         (previousVersionOffset >= page->historyOffset) ||
+         (((previousVersionOffset - minHistoryOffset) % entrySize) != 0) )
+    {
+        zklog.error("KeyValueHistoryPage::GetPreviousEntry() found invalid previousVersionOffset=" + to_string(previousVersionOffset));
+        return ZKR_DB_ERROR;
+    }
+
+    // Get the previous version entry
+    keyValueEntry = (uint64_t *)((uint8_t *)page + previousVersionOffset);
+    return ZKR_SUCCESS;
+}
+
+// Gets the previous versions of the leaf node entry of this page index, newest first, down to the one that was valid at
+// minVersion, as 3 words per entry, skipping the copies of the latest entries left behind when a page ran out of history
+zkresult KeyValueHistoryPage::GetHistory (PageContext &ctx, const uint64_t pageNumber, const uint64_t index, const uint64_t minVersion, vector<uint64_t> &history)
+{
+    zkresult zkr;
+
+    history.clear();
+
+    KeyValueHistoryStruct *page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(pageNumber);
+    uint64_t *keyValueEntry = page->keyValueEntry[index];
+    uint64_t lastVersion = keyValueEntry[0] & U64Mask48;
+    uint64_t lastLocation = keyValueEntry[1];
+    while (lastVersion > minVersion)
+    {
+        zkr = GetPreviousEntry(ctx, page, index, keyValueEntry);
+        if (zkr != ZKR_SUCCESS)
+        {
+            return zkr;
+        }
+        if (keyValueEntry == NULL)
+        {
+            break;
+        }
+        uint64_t version = keyValueEntry[0] & U64Mask48;
+        if ((version == lastVersion) && (keyValueEntry[1] == lastLocation))
+        {
+            continue;
+        }
+        history.push_back(keyValueEntry[0] & ~(U64Mask12 << 48));
+        history.push_back(keyValueEntry[1]);
+        history.push_back(keyValueEntry[2]);
+        lastVersion = version;
+        lastLocation = keyValueEntry[1];
+    }
+
+    return ZKR_SUCCESS;
+}
+
+// Writes the previous versions of the leaf node entries of a page that has no history yet, linking them from its entries;
+// the newest ones of every entry are written first, and the ones that do not fit are written into new previous pages
+void KeyValueHistoryPage::WriteHistory (PageContext &ctx, const uint64_t pageNumber, const vector<uint64_t> (&histories)[64])
+{
+    uint64_t written[64] = {0}; // Number of words of every history that have been written
+    uint64_t lastOffset[64] = {0}; // Offset of the last entry written in the current page, or 0 if it is its key value entry
+    uint64_t currentPageNumber = pageNumber;
+    KeyValueHistoryStruct *page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(currentPageNumber);
+    zkassert(page->historyOffset == minHistoryOffset);
+    zkassert(page->previousPage == 0);
+
+    while (true)
+    {
+        // Fill the history of this page, one entry of every key at a time
+        bool bPending = true;
+        while (bPending && (page->historyOffset < maxHistoryOffset))
+        {
+            bPending = false;
+            for (uint64_t i=0; (i<64) && (page->historyOffset < maxHistoryOffset); i++)
+            {
+                if (written[i] == histories[i].size())
+                {
+                    continue;
+                }
+                uint64_t *lastEntry = (lastOffset[i] == 0) ? page->keyValueEntry[i] : (uint64_t *)((uint8_t *)page + lastOffset[i]);
+                lastEntry[0] |= page->historyOffset << 48;
+                memcpy((uint8_t *)page + page->historyOffset, histories[i].data() + written[i], entrySize);
+                lastOffset[i] = page->historyOffset;
+                page->historyOffset += entrySize;
+                written[i] += 3;
+                bPending = true;
+            }
+        }
+
+        // Check if there are entries left
+        bool bDone = true;
+        for (uint64_t i=0; i<64; i++)
+        {
+            bDone &= (written[i] == histories[i].size());
+        }
+        if (bDone)
+        {
+            return;
+        }
+
+        // Continue the pending histories in a new previous page, starting at the same entries
+        uint64_t previousPageNumber = ctx.pageManager.getFreePage();
+        InitEmptyPage(ctx, previousPageNumber);
+        page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(currentPageNumber);
+        page->previousPage = previousPageNumber;
+        currentPageNumber = previousPageNumber;
+        page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(currentPageNumber);
+        for (uint64_t i=0; i<64; i++)
+        {
+            lastOffset[i] = 0;
+            if (written[i] == histories[i].size())
+            {
+                continue;
+            }
+            memcpy(page->keyValueEntry[i], histories[i].data() + written[i], entrySize);
+            written[i] += 3;
+        }
+    }
+}
+
+/*
+    Compacts the history of this page and of the subtrees of its entries [firstIndex, lastIndex), pruning the versions
+    older than minVersion: for every key, only its history entries with a version higher than minVersion are kept, plus
+    the one that was valid at minVersion, and they are rewritten into a copy of the page and, if they do not fit, into
+    new previous pages, so that the entries of moved keys and the previous pages left behind when the history ran out
+    are dropped as well.  The latest entries and their hashes are not changed, so neither are the hashes of the tree.
+    Pages are only rewritten if they change, through editPage(), so the readers of the last flushed header are not
+    affected, and the released previous pages are only freed by the next flush.
+*/
+zkresult KeyValueHistoryPage::Compact (PageContext &ctx, uint64_t &pageNumber, const uint64_t minVersion, const uint64_t firstIndex, const uint64_t lastIndex, KeyValueHistoryCompactionCounters &counters)
+{
+    zkassert(firstIndex <= lastIndex);
+    zkassert(lastIndex <= 64);
+
+    zkresult zkr;
+
+    counters.visitedPages++;
+
+    // Compact the subtrees first, since their page numbers change if they are rewritten
+    KeyValueHistoryStruct *page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(pageNumber);
+    uint64_t nextPageNumbers[64];
+    bool bNextPagesMoved = false;
+    for (uint64_t i=firstIndex; i<lastIndex; i++)
+    {
+        nextPageNumbers[i] = 0;
+        if ((page->keyValueEntry[i][0] >> 60) != 2)
+        {
+            continue;
+        }
+        uint64_t oldNextPageNumber = page->keyValueEntry[i][1] & U64Mask48;
+        nextPageNumbers[i] = oldNextPageNumber;
+        zkr = Compact(ctx, nextPageNumbers[i], minVersion, 0, 64, counters);
+        if (zkr != ZKR_SUCCESS)
+        {
+            return zkr;
+        }
+        bNextPagesMoved |= (nextPageNumbers[i] != oldNextPageNumber);
+    }
+
+    // Get the history entries to keep, and count the stored ones, including the ones of the previous pages
+    uint64_t storedHistoryEntries = (page->historyOffset - minHistoryOffset) / entrySize;
+    uint64_t firstPreviousPage = page->previousPage;
+    for (uint64_t previousPage = firstPreviousPage; previousPage != 0; )
+    {
+        KeyValueHistoryStruct *previous = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(previousPage);
+        storedHistoryEntries += (previous->historyOffset - minHistoryOffset) / entrySize;
+        for (uint64_t i=0; i<64; i++)
+        {
+            storedHistoryEntries += ((previous->keyValueEntry[i][0] >> 60) == 1) ? 1 : 0;
+        }
+        previousPage = previous->previousPage;
+    }
+    vector<uint64_t> histories[64];
+    uint64_t keptHistoryEntries = 0;
+    for (uint64_t i=0; i<64; i++)
+    {
+        if ((page->keyValueEntry[i][0] >> 60) != 1)
+        {
+            continue;
+        }
+        zkr = GetHistory(ctx, pageNumber, i, minVersion, histories[i]);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("KeyValueHistoryPage::Compact() failed calling GetHistory() result=" + zkresult2string(zkr) + " pageNumber=" + to_string(pageNumber) + " index=" + to_string(i));
+            return zkr;
+        }
+        keptHistoryEntries += histories[i].size() / 3;
+    }
+
+    // Leave the page as it is if nothing changed
+    zkassert(storedHistoryEntries >= keptHistoryEntries);
+    uint64_t droppedHistoryEntries = storedHistoryEntries - keptHistoryEntries;
+    if ((droppedHistoryEntries == 0) && !bNextPagesMoved)
+    {
+        return ZKR_SUCCESS;
+    }
+
+    // Replace the page by a copy of it with the kept history
+    pageNumber = ctx.pageManager.editPage(pageNumber);
+    page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(pageNumber);
+    memset((uint8_t *)page + minHistoryOffset, 0, maxHistoryOffset - minHistoryOffset);
+    page->historyOffset = minHistoryOffset;
+    page->previousPage = 0;
+    for (uint64_t i=0; i<64; i++)
+    {
+        uint64_t control = page->keyValueEntry[i][0] >> 60;
+        if (control == 1)
+        {
+            page->keyValueEntry[i][0] &= ~(U64Mask12 << 48);
+        }
+        else if ((control == 2) && (i >= firstIndex) && (i < lastIndex))
+        {
+            page->keyValueEntry[i][1] = nextPageNumbers[i];
+        }
+    }
+    WriteHistory(ctx, pageNumber, histories);
+    counters.rewrittenPages++;
+    counters.droppedHistoryEntries += droppedHistoryEntries;
+
+    // Release the previous pages, which were only referenced by this one
+    while (firstPreviousPage != 0)
+    {
+        KeyValueHistoryStruct *releasedPage = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(firstPreviousPage);
+        uint64_t nextPreviousPage = releasedPage->previousPage;
+        ctx.pageManager.releasePageAfterFlush(firstPreviousPage);
+        counters.releasedPages++;
+        firstPreviousPage = nextPreviousPage;
+    }
+
+    return ZKR_SUCCESS;
 }
 
 zkresult KeyValueHistoryPage::calculateHash (PageContext &ctx, uint64_t &pageNumber, Goldilocks::Element (&hash)[4], uint64_t &headerPageNumber)
@@ -698,6 +1165,77 @@ zkresult KeyValueHistoryPage::calculateHash (PageContext &ctx, uint64_t &pageNum
     return zkr;
 }
 
+// Calculates the hashes of the root page subtrees that changed in parallel, storing them in raw data as
+// calculatePageHash() does for the intermediate nodes, and then the root page hash, which reads them back
+zkresult KeyValueHistoryPage::calculateHash (PageContext &ctx, uint64_t &pageNumber, Goldilocks::Element (&hash)[4], uint64_t &headerPageNumber, const uint64_t nThreads)
+{
+    pageNumber = ctx.pageManager.editPage(pageNumber);
+    KeyValueHistoryStruct *page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(pageNumber);
+
+    vector<uint64_t> indexes;
+    for (uint64_t index = 0; index < 64; index++)
+    {
+        if (((page->keyValueEntry[index][0] >> 60) == 2) && (page->keyValueEntry[index][2] == 0))
+        {
+            indexes.emplace_back(index);
+        }
+    }
+    uint64_t nParallelThreads = zkmin(nThreads, indexes.size() / KEY_VALUE_HISTORY_PARALLEL_MIN_PAGES_PER_THREAD);
+
+    if (nParallelThreads > 1)
+    {
+        // Every hashed page can write up to 64 hashes, i.e. half a page, to raw data
+        vector<uint64_t> threadHeaderPages;
+        beginParallelWrite(ctx, nParallelThreads, ctx.pageManager.getNumEditedPages() + 2*nParallelThreads, threadHeaderPages);
+        vector<zkresult> results(indexes.size(), ZKR_SUCCESS);
+        page = (KeyValueHistoryStruct *)ctx.pageManager.getPageAddress(pageNumber);
+
+#pragma omp parallel for schedule(dynamic) num_threads(nParallelThreads)
+        for (uint64_t i = 0; i < indexes.size(); i++)
+        {
+            uint64_t index = indexes[i];
+            uint64_t &threadHeaderPageNumber = threadHeaderPages[omp_get_thread_num()];
+            uint64_t nextPageNumber = page->keyValueEntry[index][1];
+            Goldilocks::Element childHash[4];
+            results[i] = calculatePageHash(ctx, nextPageNumber, 1, childHash, threadHeaderPageNumber);
+            if (results[i] != ZKR_SUCCESS)
+            {
+                continue;
+            }
+            page->keyValueEntry[index][1] = nextPageNumber;
+
+            // Store the hash in raw page
+            HeaderStruct *threadHeaderPage = (HeaderStruct *)ctx.pageManager.getPageAddress(threadHeaderPageNumber);
+            uint64_t insertionRawDataPage = threadHeaderPage->rawDataPage;
+            uint64_t insertionRawDataOffset = RawDataPage::GetOffset(ctx, insertionRawDataPage);
+            uint8_t hashBa[32];
+            fea2ba(fr, hashBa, childHash);
+            results[i] = RawDataPage::Write(ctx, threadHeaderPage->rawDataPage, hashBa, 32);
+            if (results[i] != ZKR_SUCCESS)
+            {
+                continue;
+            }
+            page->keyValueEntry[index][2] = (insertionRawDataOffset << 48) | (insertionRawDataPage & U64Mask48);
+        }
+
+        zkresult zkr = endParallelWrite(ctx, threadHeaderPages, headerPageNumber);
+        for (uint64_t i = 0; i < indexes.size(); i++)
+        {
+            if (results[i] != ZKR_SUCCESS)
+            {
+                zklog.error("KeyValueHistoryPage::calculateHash() failed hashing the subtree of index=" + to_string(indexes[i]) + " result=" + zkresult2string(results[i]));
+                return results[i];
+            }
+        }
+        if (zkr != ZKR_SUCCESS)
+        {
+            return zkr;
+        }
+    }
+
+    return calculatePageHash(ctx, pageNumber, 0, hash, headerPageNumber);
+}
+
 zkresult KeyValueHistoryPage::calculatePageHash (PageContext &ctx, uint64_t &pageNumber, const uint64_t level, Goldilocks::Element (&hash)[4], uint64_t &headerPageNumber)
 {
     zkassert(level < 43);
@@ -739,24 +1277,19 @@ zkresult KeyValueHistoryPage::calculatePageHash (PageContext &ctx, uint64_t &pag
                 // Read the key and value stored in raw data
                 uint64_t rawDataPage = page->keyValueEntry[index][1] & U64Mask48;
                 uint64_t rawDataOffset = page->keyValueEntry[index][1] >> 48;
-                string keyAndValue;
+                uint8_t keyAndValue[64];
                 zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 64, keyAndValue);
                 if (zkr != ZKR_SUCCESS)
                 {
                     zklog.error("KeyValueHistoryPage::calculatePageHash() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " level=" + to_string(level) + " index=" + to_string(index));
                     return zkr;
                 }
-                if (keyAndValue.size() != 64)
-                {
-                    zklog.error("KeyValueHistoryPage::calculatePageHash() called RawDataPage.Read but got invalid keyAndValue.size=" + zkresult2string(keyAndValue.size()) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " level=" + to_string(level) + " index=" + to_string(index));
-                    return zkr;
-                }
 
                 // Build child
                 Child child;
                 child.type = LEAF;
-                string2fea(fr, ba2string(keyAndValue.substr(0, 32)), child.leaf.key);
-                ba2scalar(child.leaf.value, keyAndValue.substr(32));
+                ba2fea(fr, keyAndValue, child.leaf.key);
+                ba2scalar(keyAndValue + 32, 32, child.leaf.value);
 
                 // Set child
                 treeChunk.setChild(index, child);
@@ -792,10 +1325,9 @@ zkresult KeyValueHistoryPage::calculatePageHash (PageContext &ctx, uint64_t &pag
                     uint64_t insertionRawDataOffset = RawDataPage::GetOffset(ctx, headerPage->rawDataPage);
 
                     // Store the hash in raw page
-                    string hashBa;
-                    hashBa = string2ba(fea2string(fr, hash));
-                    zkassert(hashBa.size() == 32);
-                    zkr = RawDataPage::Write(ctx, headerPage->rawDataPage, hashBa);
+                    uint8_t hashBa[32];
+                    fea2ba(fr, hashBa, hash);
+                    zkr = RawDataPage::Write(ctx, headerPage->rawDataPage, hashBa, 32);
                     if (zkr != ZKR_SUCCESS)
                     {
                         zklog.error("KeyValueHistoryPage::calculatePageHash() failed calling RawDataPage.Write result=" + zkresult2string(zkr) + " insertionRawDataPage=" + to_string(insertionRawDataPage) + " insertionRawDataOffset=" + to_string(insertionRawDataOffset) + " level=" + to_string(level) + " index=" + to_string(index));
@@ -811,14 +1343,14 @@ zkresult KeyValueHistoryPage::calculatePageHash (PageContext &ctx, uint64_t &pag
                 {
                     uint64_t rawDataPage = page->keyValueEntry[index][2] & U64Mask48;
                     uint64_t rawDataOffset = page->keyValueEntry[index][2] >> 48;
-                    string hashString;
-                    zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 32, hashString);
+                    uint8_t hashBa[32];
+                    zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 32, hashBa);
                     if (zkr != ZKR_SUCCESS)
                     {
                         zklog.error("KeyValueHistoryPage::calculatePageHash() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " level=" + to_string(level) + " index=" + to_string(index));
                         return zkr;
                     }
-                    string2fea(fr, ba2string(hashString), hash);
+                    ba2fea(fr, hashBa, hash);
                 }
 
                 // Build child
@@ -866,10 +1398,9 @@ zkresult KeyValueHistoryPage::calculatePageHash (PageContext &ctx, uint64_t &pag
             uint64_t insertionRawDataOffset = RawDataPage::GetOffset(ctx, headerPage->rawDataPage);
 
             // Store the hash in raw page
-            string hashBa;
-            hashBa = string2ba(fea2string(fr, hash));
-            zkassert(hashBa.size() == 32);
-            zkr = RawDataPage::Write(ctx, headerPage->rawDataPage, hashBa);
+            uint8_t hashBa[32];
+            fea2ba(fr, hashBa, hash);
+            zkr = RawDataPage::Write(ctx, headerPage->rawDataPage, hashBa, 32);
             if (zkr != ZKR_SUCCESS)
             {
                 zklog.error("KeyValueHistoryPage::calculatePageHash() failed calling RawDataPage.Write result=" + zkresult2string(zkr) + " insertionRawDataPage=" + to_string(insertionRawDataPage) + " insertionRawDataOffset=" + to_string(insertionRawDataOffset) + " level=" + to_string(level) + " index=" + to_string(index));
@@ -37,6 +37,42 @@ public:
     KeyValueHistoryCounters() : intermediateNodes(0), leafNodes(0), maxLevel(0), intermediateHashes(0), leafHashes(0) {};
 };
 
+class KeyValueHistoryCompactionCounters
+{
+public:
+    uint64_t visitedPages;
+    uint64_t rewrittenPages;
+    uint64_t droppedHistoryEntries;
+    uint64_t releasedPages;
+    KeyValueHistoryCompactionCounters() : visitedPages(0), rewrittenPages(0), droppedHistoryEntries(0), releasedPages(0) {};
+};
+
+#define KEY_VALUE_HISTORY_PARALLEL_MIN_KEYS_PER_THREAD 64 // Minimum number of keys written by every thread of a parallel Write()
+#define KEY_VALUE_HISTORY_PARALLEL_MIN_PAGES_PER_THREAD 8 // Minimum number of root subtrees hashed by every thread of a parallel calculateHash()
+#define KEY_VALUE_HISTORY_PARALLEL_PAGES_PER_KEY 8 // Estimation of the pages that a key write can need, e.g. copies of the pages of its path
+
+// Key of the key-value history pages, computed once per key and passed down the page tree without allocations
+class KeyValueHistoryKey
+{
+public:
+    uint8_t bytes[32]; // Key as stored in raw data, i.e. the big-endian byte array of key[3]..key[0]
+    uint8_t bits[43]; // Key bits in SMT order, in sets of 6 bits, i.e. the entry index of every page level
+    KeyValueHistoryKey () {};
+    KeyValueHistoryKey (const Goldilocks::Element (&key)[4]) { fromFea(key); };
+    KeyValueHistoryKey (const uint8_t *keyBa) { fromBa(keyBa); }; // 32B
+    void fromFea (const Goldilocks::Element (&key)[4]);
+    void fromBa (const uint8_t *keyBa);
+    string toString (void) const;
+};
+
+// Key-value with its key as the pages use it
+class KeyValueBits
+{
+public:
+    KeyValueHistoryKey key;
+    mpz_class value;
+};
+
 class KeyValueHistoryPage
 {
 public:
@@ -44,20 +80,32 @@ public:
     static const uint64_t minHistoryOffset = 8 + 8 + 64*3*8; // 1552
     static const uint64_t maxHistoryOffset = 8 + 8 + 64*3*8 + 106*3*8; // 4096
 private:
-    static zkresult Read          (PageContext &ctx, const uint64_t pageNumber,  const string &key, const string &keyBits, const uint64_t version,       mpz_class &value, const uint64_t level, uint64_t &keyLevel);
-    static zkresult ReadLevel     (PageContext &ctx, const uint64_t pageNumber,  const string &key, const string &keyBits,                                                 const uint64_t level, uint64_t &keyLevel);
-    static zkresult ReadTree      (PageContext &ctx, const uint64_t pageNumber,  const string &key, const string &keyBits, const uint64_t version,       mpz_class &value, vector<HashValueGL> *hashValues, const uint64_t level, unordered_map<uint64_t, TreeChunk> &treeChunkMap);
-    static zkresult Write         (PageContext &ctx,       uint64_t &pageNumber, const string &key, const string &keyBits, const uint64_t version, const mpz_class &value, const uint64_t level, uint64_t &headerPageNumber);
+    static zkresult Read          (PageContext &ctx, const uint64_t pageNumber,  const KeyValueHistoryKey &key, const uint64_t version, const uint64_t lastVersion, mpz_class &value, const uint64_t level, uint64_t &keyLevel);
+    static zkresult FindKeys      (PageContext &ctx, const uint64_t pageNumber,  const uint64_t version, const uint64_t maxKeys, uint64_t &nKeys, uint64_t *&keyValueEntry);
+    static uint64_t KeyLevel      (const KeyValueHistoryKey &key, const KeyValueHistoryKey &foundKey, const uint64_t level);
+    static zkresult ReadLevel     (PageContext &ctx, const uint64_t pageNumber,  const KeyValueHistoryKey &key,                                                 const uint64_t level, uint64_t &keyLevel);
+    static zkresult ReadTree      (PageContext &ctx, const uint64_t pageNumber,  const KeyValueHistoryKey &key, const uint64_t version,       mpz_class &value, vector<HashValueGL> *hashValues, const uint64_t level, unordered_map<uint64_t, TreeChunk> &treeChunkMap);
+    static zkresult Write         (PageContext &ctx,       uint64_t &pageNumber, const KeyValueHistoryKey &key, const uint64_t version, const mpz_class &value, const uint64_t level, uint64_t &headerPageNumber);
 public:
     static zkresult InitEmptyPage (PageContext &ctx, const uint64_t pageNumber);
-    static zkresult Read          (PageContext &ctx, const uint64_t pageNumber,  const string &key, const uint64_t version,       mpz_class &value, uint64_t &keyLevel);
-    static zkresult ReadLevel     (PageContext &ctx, const uint64_t pageNumber,  const string &key,                                                 uint64_t &keyLevel);
+    static zkresult Read          (PageContext &ctx, const uint64_t pageNumber,  const KeyValueHistoryKey &key, const uint64_t version, const uint64_t lastVersion, mpz_class &value, uint64_t &keyLevel);
+    static zkresult ReadLevel     (PageContext &ctx, const uint64_t pageNumber,  const KeyValueHistoryKey &key,                                                 uint64_t &keyLevel);
     static zkresult ReadTree      (PageContext &ctx, const uint64_t pageNumber,  const uint64_t version,  vector<KeyValue> &keyValues, vector<HashValueGL> *hashValues);
-    static zkresult Write         (PageContext &ctx,       uint64_t &pageNumber, const string &key, const uint64_t version, const mpz_class &value, uint64_t &headerPageNumber);
+    static zkresult Write         (PageContext &ctx,       uint64_t &pageNumber, const KeyValueHistoryKey &key, const uint64_t version, const mpz_class &value, uint64_t &headerPageNumber);
+    static void     GetKeyBits    (const KeyValue &keyValue, KeyValueBits &keyValueBits);
+    static zkresult Write         (PageContext &ctx,       uint64_t &pageNumber, const vector<KeyValueBits> &keyValues, const uint64_t version, uint64_t &headerPageNumber, const uint64_t nThreads);
     
+    static zkresult GetPreviousEntry (PageContext &ctx, KeyValueHistoryStruct *&page, const uint64_t index, uint64_t *&keyValueEntry);
+    static zkresult Compact       (PageContext &ctx,       uint64_t &pageNumber, const uint64_t minVersion, const uint64_t firstIndex, const uint64_t lastIndex, KeyValueHistoryCompactionCounters &counters);
+
     static zkresult calculateHash             (PageContext &ctx, uint64_t &pageNumber, Goldilocks::Element (&hash)[4], uint64_t &headerPageNumber);
+    static zkresult calculateHash             (PageContext &ctx, uint64_t &pageNumber, Goldilocks::Element (&hash)[4], uint64_t &headerPageNumber, const uint64_t nThreads);
 private:
     static zkresult calculatePageHash         (PageContext &ctx, uint64_t &pageNumber, const uint64_t level, Goldilocks::Element (&hash)[4], uint64_t &headerPageNumber);
+    static void     beginParallelWrite        (PageContext &ctx, const uint64_t nThreads, const uint64_t nPagesHint, vector<uint64_t> &threadHeaderPages);
+    static zkresult endParallelWrite          (PageContext &ctx, const vector<uint64_t> &threadHeaderPages, uint64_t &headerPageNumber);
+    static zkresult GetHistory                (PageContext &ctx, const uint64_t pageNumber, const uint64_t index, const uint64_t minVersion, vector<uint64_t> &history);
+    static void     WriteHistory              (PageContext &ctx, const uint64_t pageNumber, const vector<uint64_t> (&histories)[64]);
 public:
     static void Print (PageContext &ctx, const uint64_t pageNumber, bool details, const string &prefix, const uint64_t level, KeyValueHistoryCounters &counters);
     static void Print (PageContext &ctx, const uint64_t pageNumber, bool details, const string &prefix);
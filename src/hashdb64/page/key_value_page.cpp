@@ -19,12 +19,12 @@ zkresult KeyValuePage::InitEmptyPage (PageContext &ctx, const uint64_t pageNumbe
     return ZKR_SUCCESS;
 }
 
-zkresult KeyValuePage::Read (PageContext &ctx, const uint64_t pageNumber, const string &key, const vector<uint64_t> &keyBits, string &value, const uint64_t level)
+zkresult KeyValuePage::Read (PageContext &ctx, const uint64_t pageNumber, const string &key, const KeyValuePageKeyBits &keyBits, string &value, const uint64_t level)
 {
     // Check input parameters
-    if (level >= keyBits.size())
+    if (level >= keyBits.size)
     {
-        zklog.error("KeyValuePage::Read() got invalid level=" + to_string(level) + " >= keyBits.size=" + to_string(keyBits.size()));
+        zklog.error("KeyValuePage::Read() got invalid level=" + to_string(level) + " >= keyBits.size=" + to_string(keyBits.size));
         return ZKR_DB_ERROR;
     }
 
@@ -32,7 +32,7 @@ zkresult KeyValuePage::Read (PageContext &ctx, const uint64_t pageNumber, const
 
     // Get control
     KeyValueStruct * page = (KeyValueStruct *)ctx.pageManager.getPageAddress(pageNumber);
-    uint64_t index = keyBits[level];
+    uint64_t index = keyBits.bits[level];
     uint64_t control = page->key[index] >> 60;
 
     switch (control)
@@ -49,21 +49,15 @@ zkresult KeyValuePage::Read (PageContext &ctx, const uint64_t pageNumber, const
         {
             uint64_t rawDataPage = page->key[index] & U64Mask48;
             uint64_t rawDataOffset = (page->key[index] >> 48) & U64Mask12;
-            string lengthBa;
-            zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 4, lengthBa);
+            uint32_t length32;
+            zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 4, (uint8_t *)&length32);
             if (zkr != ZKR_SUCCESS)
             {
                 zklog.error("KeyValuePage::Read() failed calling RawDataPage::Read(4) result=" + zkresult2string(zkr) + " pageNumber=" + to_string(pageNumber) + " index=" + to_string(index) + " level=" + to_string(level) + " key=" + ba2string(key));
                 return zkr;
             }
-            if (lengthBa.size() != 4)
-            {
-                zklog.error("KeyValuePage::Read() called RawDataPage::Read(4) but got invalid size=" + to_string(lengthBa.size()) + " pageNumber=" + to_string(pageNumber) + " index=" + to_string(index) + " level=" + to_string(level) + " key=" + ba2string(key));
-                return zkr;
-            }
 
-            uint64_t length;
-            length = *(uint32_t *)lengthBa.c_str();
+            uint64_t length = length32;
             string rawData;
             zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, length, rawData);
             if (zkr != ZKR_SUCCESS)
@@ -95,7 +89,7 @@ zkresult KeyValuePage::Read (PageContext &ctx, const uint64_t pageNumber, const
                 " rawDataOffset=" + to_string(rawDataOffset));
 #endif
 
-            value = rawData.substr(4 + key.size());
+            value.assign(rawData, 4 + key.size(), string::npos);
 
             return ZKR_SUCCESS;
         }
@@ -131,21 +125,25 @@ zkresult KeyValuePage::Read (PageContext &ctx, const uint64_t pageNumber, const
     value.clear();
 
     // Get key bits
-    vector<uint64_t> keyBits;
-    splitKey9(key, keyBits);
+    KeyValuePageKeyBits keyBits;
+    zkresult zkr = GetKeyBits(key, keyBits);
+    if (zkr != ZKR_SUCCESS)
+    {
+        return zkr;
+    }
 
-    //zklog.info("KeyValuePage::Read() key=" + ba2string(key) + " keyBits=" + to_string(keyBits[0]) + ":" + to_string(keyBits[1]) + ":" + to_string(keyBits[2]));
+    //zklog.info("KeyValuePage::Read() key=" + ba2string(key) + " keyBits=" + to_string(keyBits.bits[0]) + ":" + to_string(keyBits.bits[1]) + ":" + to_string(keyBits.bits[2]));
 
     // Call Read with level=0
     return Read(ctx, pageNumber, key, keyBits, value, 0);
 }
 
-zkresult KeyValuePage::Write (PageContext &ctx, uint64_t &pageNumber, const string &key, const vector<uint64_t> &keyBits, const string &value, const uint64_t level, uint64_t &headerPageNumber)
+zkresult KeyValuePage::Write (PageContext &ctx, uint64_t &pageNumber, const string &key, const KeyValuePageKeyBits &keyBits, const string &value, const uint64_t level, uint64_t &headerPageNumber)
 {
     // Check input parameters
-    if (level >= keyBits.size())
+    if (level >= keyBits.size)
     {
-        zklog.error("KeyValuePage::write() got invalid level=" + to_string(level) + " >= keyBits.size=" + to_string(keyBits.size()));
+        zklog.error("KeyValuePage::write() got invalid level=" + to_string(level) + " >= keyBits.size=" + to_string(keyBits.size));
         return ZKR_DB_ERROR;
     }
 
@@ -154,7 +152,7 @@ zkresult KeyValuePage::Write (PageContext &ctx, uint64_t &pageNumber, const stri
 
     zkresult zkr;
     KeyValueStruct * page = (KeyValueStruct *)ctx.pageManager.getPageAddress(pageNumber);
-    uint64_t index = keyBits[level];
+    uint64_t index = keyBits.bits[level];
 
     uint64_t control = page->key[index] >> 60;
 
@@ -280,14 +278,12 @@ zkresult KeyValuePage::Write (PageContext &ctx, uint64_t &pageNumber, const stri
             KeyValuePage::InitEmptyPage(ctx, newPageNumber);
             KeyValueStruct * newPage = (KeyValueStruct *)ctx.pageManager.getPageAddress(newPageNumber);
             string existingKey = existingLengthAndKey.substr(4);
-            vector<uint64_t> existingKeyBits;
-            splitKey9(existingKey, existingKeyBits);
-            if (existingKeyBits.size() < (level+2))
+            if ((existingKey.size() << 3) <= (level+1)*9)
             {
-                zklog.error("KeyValuePage::Write() found not matching value of existingKeyBits.size=" + to_string(existingKeyBits.size()) + " < level+2=" + to_string(level + 2) + " pageNumber=" + to_string(pageNumber) + " index=" + to_string(index) + " level=" + to_string(level) + " key=" + ba2string(key));
+                zklog.error("KeyValuePage::Write() found not matching value of existingKey.size=" + to_string(existingKey.size()) + " for level+2=" + to_string(level + 2) + " pageNumber=" + to_string(pageNumber) + " index=" + to_string(index) + " level=" + to_string(level) + " key=" + ba2string(key));
                 exitProcess();
             }
-            uint64_t newIndex = existingKeyBits[level+1];
+            uint64_t newIndex = getKeyBits9(existingKey, (level+1)*9);
             newPage->key[newIndex] = page->key[index];
             
 #ifdef LOG_KEY_VALUE_PAGE
@@ -344,15 +340,39 @@ zkresult KeyValuePage::Write (PageContext &ctx, uint64_t &pageNumber, const stri
     }
 
     // Get key bits
-    vector<uint64_t> keyBits;
-    splitKey9(key, keyBits);
+    KeyValuePageKeyBits keyBits;
+    zkresult zkr = GetKeyBits(key, keyBits);
+    if (zkr != ZKR_SUCCESS)
+    {
+        return zkr;
+    }
 
-    //zklog.info("KeyValuePage::Write() key=" + ba2string(key) + " keyBits=" + to_string(keyBits[0]) + ":" + to_string(keyBits[1]) + ":" + to_string(keyBits[2]));
+    //zklog.info("KeyValuePage::Write() key=" + ba2string(key) + " keyBits=" + to_string(keyBits.bits[0]) + ":" + to_string(keyBits.bits[1]) + ":" + to_string(keyBits.bits[2]));
 
     // Call Write with level=0
     return Write(ctx, pageNumber, key, keyBits, value, 0, headerPageNumber);
 }
 
+zkresult KeyValuePage::GetKeyBits (const string &key, KeyValuePageKeyBits &keyBits)
+{
+    if (key.size() > KEY_VALUE_PAGE_MAX_KEY_SIZE)
+    {
+        zklog.error("KeyValuePage::GetKeyBits() found too big key.size=" + to_string(key.size()) + " > " + to_string(KEY_VALUE_PAGE_MAX_KEY_SIZE) + " key=" + ba2string(key));
+        return ZKR_DB_ERROR;
+    }
+
+    // Split the key bits in chunks of 9 bits
+    uint64_t numberOfBits = key.size() << 3;
+    keyBits.size = 0;
+    for (uint64_t i = 0; i < numberOfBits; i += 9)
+    {
+        keyBits.bits[keyBits.size] = getKeyBits9(key, i);
+        keyBits.size++;
+    }
+
+    return ZKR_SUCCESS;
+}
+
 void KeyValuePage::Print (PageContext &ctx, const uint64_t pageNumber, bool details, const string& prefix, const uint64_t keySize)
 {
     zklog.info(prefix + "KeyValuePage::Print() pageNumber=" + to_string(pageNumber));
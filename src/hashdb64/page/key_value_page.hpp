@@ -20,12 +20,24 @@ struct KeyValueStruct
     // For the same KeyValuePage, the length of the key must always be the same, e.g.: 32B for a root-version, 8B for a version-versionData, 32B for a program page, etc.
 };
 
+#define KEY_VALUE_PAGE_MAX_KEY_SIZE 32 // Largest key, i.e. a root or a program hash
+#define KEY_VALUE_PAGE_MAX_KEY_LEVELS ((KEY_VALUE_PAGE_MAX_KEY_SIZE*8 + 8)/9) // 29
+
+// Key bits in sets of 9 bits, i.e. the entry index of every page level, computed once per key
+class KeyValuePageKeyBits
+{
+public:
+    uint16_t bits[KEY_VALUE_PAGE_MAX_KEY_LEVELS];
+    uint64_t size;
+};
+
 class KeyValuePage
 {
 private:
 
-    static zkresult Read          (PageContext &ctx, const uint64_t  pageNumber, const string &key, const vector<uint64_t> &keyBits,       string &value, const uint64_t level);
-    static zkresult Write         (PageContext &ctx,       uint64_t &pageNumber, const string &key, const vector<uint64_t> &keyBits, const string &value, const uint64_t level, uint64_t &headerPageNumber);
+    static zkresult Read          (PageContext &ctx, const uint64_t  pageNumber, const string &key, const KeyValuePageKeyBits &keyBits,       string &value, const uint64_t level);
+    static zkresult Write         (PageContext &ctx,       uint64_t &pageNumber, const string &key, const KeyValuePageKeyBits &keyBits, const string &value, const uint64_t level, uint64_t &headerPageNumber);
+    static zkresult GetKeyBits    (const string &key, KeyValuePageKeyBits &keyBits);
 
 public:
 
@@ -15,6 +15,7 @@
 #include "page_list_page.hpp"
 #include <dirent.h>
 #include <regex>
+#include <algorithm>
 
 PageManager::PageManager() 
 {
@@ -24,6 +25,9 @@ PageManager::PageManager()
     nFiles=0;
     nPages=0;
     numFreePages=0;
+    fullSync=false;
+    parallelWrites=false;
+    parallelNumFreePages=0;
 }
 
 PageManager::~PageManager(void)
@@ -32,9 +36,14 @@ PageManager::~PageManager(void)
         for(uint64_t i=0; i< pages.size(); i++){
             munmap(pages[i], fileSize);
         }
+        for(uint64_t i=0; i< fds.size(); i++){
+            close(fds[i]);
+        }
     }else{
-        if (pages[0] != NULL)
-            free(pages[0]);
+        for(uint64_t i=0; i< pages.size(); i++){
+            if (pages[i] != NULL)
+                free(pages[i]);
+        }
     }
 }
 
@@ -52,7 +61,11 @@ zkresult PageManager::init(PageContext &ctx)
         mappedFile = false;
         dbResizeLock.lock();
         nPages = 0;
-        pages.resize(1);
+        for(uint64_t i=0; i< pages.size(); i++){
+            free(pages[i]);
+        }
+        pages.clear();
+        pagesPerFile = 0;
         dbResizeLock.unlock();
         firstUnusedPage = 2;
         numFreePages = 0;
@@ -94,58 +107,68 @@ zkresult PageManager::init(PageContext &ctx)
         if((dir=opendir(folderName.c_str())) != nullptr){
             nFiles = 0;
             dbResizeLock.lock();
+            for(uint64_t i=0; i< fds.size(); i++){
+                close(fds[i]);
+            }
+            fds.clear();
+            //readdir() does not return the files in any particular order, so they are sorted by number first
+            vector<pair<uint64_t, string>> dbFiles;
             while((ent = readdir(dir)) != nullptr){
                 
                 if (strstr(ent->d_name, ".db") != nullptr) {
 
                     newFile = false;
                     
-                    //check if the file name matches the pattern and is consecutive
+                    //check if the file name matches the pattern
                     string file_name = ent->d_name;
                     std::smatch match;
                     if(std::regex_search(file_name, match, rgx)){
-                        uint64_t file_number = std::stoull(match[1]);
-                        if(file_number != nFiles){
-                            zklog.error("PageManager: found non consecuitve db file: " + file_name + "in folder: " + folderName);
-                            exitProcess();
-                        }
-                        
+                        dbFiles.emplace_back(std::stoull(match[1]), file_name);
                     }else{
                         zklog.error("PageManager: found db file with wrong name: " + file_name + "in folder: " + folderName);
                         exitProcess();
                     }
+                }
+            }
+            sort(dbFiles.begin(), dbFiles.end());
+            for(uint64_t f=0; f< dbFiles.size(); ++f){
+                //check if the file is consecutive
+                string file_name = dbFiles[f].second;
+                if(dbFiles[f].first != nFiles){
+                    zklog.error("PageManager: found non consecuitve db file: " + file_name + "in folder: " + folderName);
+                    exitProcess();
+                }
 
-                    //check that file size is correct
-                    struct stat st;
-                    string file = "";   
-                    if(folderName != "")
-                        file = folderName + "/";
-                    file += file_name;
-                    if(stat(file.c_str(), &st) == -1){
-                        zklog.error("PageManager: failed to stat file: " + file);
-                        exitProcess();
-                    }
-                    if((uint64_t)st.st_size != fileSize){
-                        zklog.error("PageManager: found db file with wrong size: " + file_name + "in folder: " + folderName);
-                        exitProcess();
-                    }
+                //check that file size is correct
+                struct stat st;
+                string file = "";   
+                if(folderName != "")
+                    file = folderName + "/";
+                file += file_name;
+                if(stat(file.c_str(), &st) == -1){
+                    zklog.error("PageManager: failed to stat file: " + file);
+                    exitProcess();
+                }
+                if((uint64_t)st.st_size != fileSize){
+                    zklog.error("PageManager: found db file with wrong size: " + file_name + "in folder: " + folderName);
+                    exitProcess();
+                }
 
-                    //map the file and increase the number of pages
-                    int fd = open(file.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
-                    if (fd == -1) {
-                        zklog.error("PageManager: failed to open file.");
-                        exitProcess();
-                    }
-                    pages.push_back(NULL);
-                    pages[nFiles] = (char *)mmap(NULL, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
-                    if (pages[nFiles] == MAP_FAILED) {
-                        zklog.error("Failed to mmap file: " + (string)strerror(errno));
-                        exitProcess();
-                    }
-                    nPages += pagesPerFile;
-                    close(fd);
-                    nFiles++;
+                //map the file and increase the number of pages
+                int fd = open(file.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+                if (fd == -1) {
+                    zklog.error("PageManager: failed to open file.");
+                    exitProcess();
                 }
+                pages.push_back(NULL);
+                pages[nFiles] = (char *)mmap(NULL, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (pages[nFiles] == MAP_FAILED) {
+                    zklog.error("Failed to mmap file: " + (string)strerror(errno));
+                    exitProcess();
+                }
+                nPages += pagesPerFile;
+                fds.push_back(fd);
+                nFiles++;
             }
             dbResizeLock.unlock();
             //add new file if needed
@@ -191,6 +214,7 @@ zkresult PageManager::reset(PageContext &ctx){
     zkresult zkr=ZKR_UNSPECIFIED;
     numFreePages = 0;
     firstUnusedPage = 2;
+    releasedPages.clear();
     memset(pages[0], 0, 2*4096);
     zkr = HeaderPage::InitEmptyPage(ctx, 0);
     if(zkr != ZKR_SUCCESS){
@@ -205,17 +229,24 @@ zkresult PageManager::addPages(const uint64_t nPages_)
 {
     unique_lock<shared_mutex> guard(dbResizeLock);
     zkassertpermanent(mappedFile == false);
-    char *auxPages = NULL;
-    auxPages = (char *)realloc(pages[0], (nPages + nPages_) * 4096);
-    if (auxPages == NULL)
-    {
-        zklog.error("PageManager::AddPages() failed calling realloc()");
-        exitProcess();
+
+    //Pages are added in chunks of pagesPerFile pages, as the mapped files are, instead of being reallocated, so that
+    //they are never moved, since their addresses are kept by the callers, e.g. by the other threads during parallel
+    //writes; the first chunk sets the chunk size
+    if(pagesPerFile == 0){
+        pagesPerFile = nPages_;
+    }
+    uint64_t nChunks = (nPages_ + pagesPerFile - 1) / pagesPerFile;
+    for(uint64_t i=0; i< nChunks; ++i){
+        char *chunk = (char *)calloc(pagesPerFile, 4096);
+        if (chunk == NULL)
+        {
+            zklog.error("PageManager::AddPages() failed calling calloc()");
+            exitProcess();
+        }
+        pages.push_back(chunk);
+        nPages += pagesPerFile;
     }
-    pages[0] = auxPages;
-    memset(pages[0] + nPages * 4096, 0, nPages_ * 4096);
-    nPages += nPages_;
-    pagesPerFile = nPages;
     return zkresult::ZKR_SUCCESS;
 }
 
@@ -242,12 +273,16 @@ zkresult PageManager::addFile(){
     if (pages[nFiles] == MAP_FAILED) {
         zklog.error("Failed to mmap file: " + (string)strerror(errno));
     }
+    fds.push_back(fd);
     ++nFiles;
     return zkresult::ZKR_SUCCESS;
 }
 
 uint64_t PageManager::getFreePage(void)
 {
+    if(parallelWrites){
+        return getReservedPage();
+    }
 #if MULTIPLE_WRITES
     lock_guard<recursive_mutex> guard_freePages(writePagesLock);
 #endif
@@ -291,9 +326,23 @@ void PageManager::releasePage(const uint64_t pageNumber)
     freePages[numFreePages++]=pageNumber;
 }
 
+void PageManager::releasePageAfterFlush(const uint64_t pageNumber)
+{
+    zkassertpermanent(pageNumber >= 2);  //first two pages cannot be released
+    zkassertpermanent(pageNumber<firstUnusedPage);
+    zkassertpermanent(!parallelWrites);
+#if MULTIPLE_WRITES
+    lock_guard<recursive_mutex> guard_freePages(writePagesLock);
+#endif
+    releasedPages.push_back(pageNumber);
+}
+
 uint64_t PageManager::editPage(const uint64_t pageNumber)
 {
     uint32_t pageNumber_;
+    if(parallelWrites){
+        return editReservedPage(pageNumber);
+    }
 #if MULTIPLE_WRITES
     lock_guard<recursive_mutex> lock(writePagesLock);
 #endif
@@ -308,6 +357,121 @@ uint64_t PageManager::editPage(const uint64_t pageNumber)
     return pageNumber_;
 }
 
+void PageManager::beginParallelWrites(const uint64_t nThreads, const uint64_t nPagesHint){
+
+    lock_guard<recursive_mutex> guard_freePages(writePagesLock);
+    zkassertpermanent(!parallelWrites);
+    zkassertpermanent(nThreads > 0);
+
+    //The in-memory pages that are expected to be needed are added beforehand, so that the threads do not have to add
+    //them while holding the locks
+    if(!mappedFile){
+        dbResizeLock.lock_shared();
+        uint64_t nPages_ = nPages;
+        dbResizeLock.unlock_shared();
+        uint64_t nAvailablePages = numFreePages + nPages_ - firstUnusedPage;
+        if(nAvailablePages < nPagesHint){
+            addPages(max(nPagesHint - nAvailablePages, nPages_));
+        }
+    }
+
+    threadPages.clear();
+    threadPages.resize(nThreads);
+    parallelNumFreePages = numFreePages;
+    parallelWrites = true;
+}
+
+void PageManager::endParallelWrites(){
+
+    lock_guard<recursive_mutex> guard_freePages(writePagesLock);
+    zkassertpermanent(parallelWrites);
+    parallelWrites = false;
+
+    //The free pages reserved by the threads are taken from the end of freePages
+    numFreePages = parallelNumFreePages;
+    for(uint64_t t=0; t< threadPages.size(); ++t){
+        ThreadPages &tp = threadPages[t];
+        for(unordered_map<uint64_t, uint64_t>::const_iterator it = tp.editedPages.begin(); it != tp.editedPages.end(); it++){
+            editedPages[it->first] = it->second;
+        }
+        for(uint64_t i=0; i< tp.reservedPages.size(); ++i){
+            releasePage(tp.reservedPages[i]);
+        }
+    }
+    threadPages.clear();
+}
+
+void PageManager::reservePages(ThreadPages &tp){
+
+    //Take the last free pages, as getFreePage() does, with a compare and swap of the number of free pages left
+    uint64_t n = parallelNumFreePages.load();
+    uint64_t nReserved;
+    do{
+        nReserved = min(n, (uint64_t)PARALLEL_WRITES_RESERVED_PAGES);
+    }while(nReserved > 0 && !parallelNumFreePages.compare_exchange_weak(n, n - nReserved));
+    if(nReserved > 0){
+        tp.reservedPages.insert(tp.reservedPages.end(), freePages.begin() + (n - nReserved), freePages.begin() + n);
+        return;
+    }
+
+    //Otherwise take unused pages, adding a file or a chunk of memory if needed
+    lock_guard<recursive_mutex> guard_freePages(writePagesLock);
+    dbResizeLock.lock_shared();
+    uint64_t nPages_ = nPages;
+    dbResizeLock.unlock_shared();
+    if(firstUnusedPage == nPages_){
+        if(mappedFile){
+            zklog.info("PageManager: adding file");
+            addFile();
+        }else{
+            zklog.info("PageManager: adding pages to memory during parallel writes");
+            addPages(PARALLEL_WRITES_RESERVED_PAGES);
+        }
+        dbResizeLock.lock_shared();
+        nPages_ = nPages;
+        dbResizeLock.unlock_shared();
+    }
+    nReserved = min(nPages_ - firstUnusedPage, (uint64_t)PARALLEL_WRITES_RESERVED_PAGES);
+    for(uint64_t i=0; i< nReserved; ++i){
+        tp.reservedPages.push_back(firstUnusedPage + nReserved - 1 - i);
+    }
+    firstUnusedPage += nReserved;
+}
+
+uint64_t PageManager::getReservedPage(){
+
+    uint64_t thread = omp_get_thread_num();
+    zkassertpermanent(thread < threadPages.size());
+    ThreadPages &tp = threadPages[thread];
+    if(tp.reservedPages.empty()){
+        reservePages(tp);
+    }
+    uint64_t pageNumber = tp.reservedPages.back();
+    tp.reservedPages.pop_back();
+    memset(getPageAddress(pageNumber), 0, 4096);
+    tp.editedPages[pageNumber] = pageNumber;
+    return pageNumber;
+}
+
+uint64_t PageManager::editReservedPage(const uint64_t pageNumber){
+
+    //The pages edited before the parallel writes are only read during them
+    unordered_map<uint64_t, uint64_t>::const_iterator it = editedPages.find(pageNumber);
+    if(it != editedPages.end()){
+        return it->second;
+    }
+    ThreadPages &tp = threadPages[omp_get_thread_num()];
+    it = tp.editedPages.find(pageNumber);
+    if(it != tp.editedPages.end()){
+        return it->second;
+    }
+    zkassertpermanent(pageNumber >= 2); //the header must be edited before the parallel writes
+    uint64_t pageNumber_ = getReservedPage();
+    memcpy(getPageAddress(pageNumber_), getPageAddress(pageNumber), 4096);
+    tp.editedPages[pageNumber] = pageNumber_;
+    return pageNumber_;
+}
+
 void PageManager::flushPages(PageContext &ctx){
 
 #if MULTIPLE_WRITES
@@ -320,13 +484,14 @@ void PageManager::flushPages(PageContext &ctx){
     vector<uint64_t> prevFreePagesContainer;
     HeaderPage::GetFreePagesContainer(ctx, headerPageNum, prevFreePagesContainer);
 
-    //2// get list of edited pages
+    //2// get list of edited pages, plus the released ones, since both are still used by the current header
     vector<uint64_t> copiedPages;
     for(unordered_map<uint64_t, uint64_t>::const_iterator it = editedPages.begin(); it != editedPages.end(); it++){
         if(it->first != it->second && it->first >= 2){
             copiedPages.emplace_back(it->first);
         }
     }
+    copiedPages.insert(copiedPages.end(), releasedPages.begin(), releasedPages.end());
 
     //3// generate new list of freePages
     uint64_t nPrevFreePagesContainer = prevFreePagesContainer.size();
@@ -357,13 +522,17 @@ void PageManager::flushPages(PageContext &ctx){
 
     //4// sync all pages
     if(mappedFile){
-        #pragma omp parallel for schedule(static,1) num_threads(omp_get_num_threads()/2)
-        for(uint64_t k=0; k< pages.size(); ++k){
-            if(k==0){
-                msync(getPageAddress(1), fileSize-4096, MS_SYNC);
-            }else{
-                msync(pages[k], fileSize, MS_SYNC);
+        if(fullSync){
+            #pragma omp parallel for schedule(static,1) num_threads(omp_get_num_threads()/2)
+            for(uint64_t k=0; k< pages.size(); ++k){
+                if(k==0){
+                    msync(getPageAddress(1), fileSize-4096, MS_SYNC);
+                }else{
+                    msync(pages[k], fileSize, MS_SYNC);
+                }
             }
+        }else{
+            syncDirtyPages();
         }
     }
 
@@ -386,5 +555,65 @@ void PageManager::flushPages(PageContext &ctx){
         releasePage(*it);
     }     
     editedPages.clear();
+    releasedPages.clear();
+
+}
 
+void PageManager::syncDirtyPages(){
+
+    // Pages written since the last flush: the copies returned by editPage() and the pages returned by getFreePage(),
+    // plus the header copy, i.e. page 1, which is always rewritten by the flush, and the last raw data page of the
+    // previous flush, which is appended to in place
+    vector<uint64_t> dirtyPages;
+    dirtyPages.reserve(editedPages.size()+2);
+    dirtyPages.push_back(1);
+    uint64_t lastRawDataPage = ((HeaderStruct *)getPageAddress(0))->rawDataPage;
+    if(lastRawDataPage >= 2){
+        dirtyPages.push_back(lastRawDataPage);
+    }
+    for(unordered_map<uint64_t, uint64_t>::const_iterator it = editedPages.begin(); it != editedPages.end(); it++){
+        if(it->second >= 2){
+            dirtyPages.push_back(it->second);
+        }
+    }
+    sort(dirtyPages.begin(), dirtyPages.end());
+
+    // Coalesce them in ranges of consecutive pages of the same file, also across small gaps of clean pages
+    vector<uint64_t> rangeFirst;
+    vector<uint64_t> rangeSize;
+    for(uint64_t i=0; i< dirtyPages.size(); ++i){
+        uint64_t page = dirtyPages[i];
+        if(rangeFirst.size() > 0){
+            uint64_t last = rangeFirst.back() + rangeSize.back() - 1;
+            if(page <= last){
+                continue;
+            }
+            if(page - last <= FLUSH_MAX_GAP_PAGES + 1 && page/pagesPerFile == rangeFirst.back()/pagesPerFile){
+                rangeSize.back() = page - rangeFirst.back() + 1;
+                continue;
+            }
+        }
+        rangeFirst.push_back(page);
+        rangeSize.push_back(1);
+    }
+
+    // Start the write back of every range without waiting for it, so that the device gets all of them at once, as
+    // with a single msync() of the whole file, and then wait for them with a single fdatasync() per file with
+    // dirty pages; files without dirty pages are not synced at all
+    vector<bool> dirtyFiles(fds.size(), false);
+    for(uint64_t k=0; k< rangeFirst.size(); ++k){
+        uint64_t fileId = rangeFirst[k]/pagesPerFile;
+        uint64_t offset = (rangeFirst[k] % pagesPerFile) * 4096;
+        if(sync_file_range(fds[fileId], offset, rangeSize[k]*4096, SYNC_FILE_RANGE_WRITE) != 0){
+            zklog.error("PageManager::syncDirtyPages() failed calling sync_file_range() for " + to_string(rangeSize[k]) + " pages from page " + to_string(rangeFirst[k]) + ": " + strerror(errno));
+            exitProcess();
+        }
+        dirtyFiles[fileId] = true;
+    }
+    for(uint64_t fileId=0; fileId< fds.size(); ++fileId){
+        if(dirtyFiles[fileId] && fdatasync(fds[fileId]) != 0){
+            zklog.error("PageManager::syncDirtyPages() failed calling fdatasync() for file " + to_string(fileId) + ": " + strerror(errno));
+            exitProcess();
+        }
+    }
 }
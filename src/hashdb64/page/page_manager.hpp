@@ -13,8 +13,11 @@
 #include "zkassert.hpp"
 #include <cassert>
 #include <unistd.h>
+#include <atomic>
 
 #define MULTIPLE_WRITES 0
+#define FLUSH_MAX_GAP_PAGES 8 // Clean pages between two dirty ones up to which both are written back as a single range
+#define PARALLEL_WRITES_RESERVED_PAGES 64 // Free pages reserved at once by a thread during parallel writes
 
 class PageContext;
 class PageManager
@@ -29,11 +32,13 @@ public:
     
     uint64_t getFreePage();
     void releasePage(const uint64_t pageNumber);
+    void releasePageAfterFlush(const uint64_t pageNumber); // For pages reachable from the last flushed header
     uint64_t editPage(const uint64_t pageNumber);
     void flushPages(PageContext &ctx);
     inline char *getPageAddress(const uint64_t pageNumber);
     inline uint64_t getNumFreePages();
     inline uint64_t getFirstUnusedPage();
+    inline uint64_t getNumUsedPages();
 
     zkresult addFile();
     zkresult addPages(const uint64_t nPages_);
@@ -41,6 +46,17 @@ public:
     inline void readLock(){ headerLock.lock_shared();}
     inline void readUnlock(){ headerLock.unlock_shared();}
 
+    // Sync the whole mapped files on flush instead of the dirty page ranges only, e.g. to benchmark both
+    inline void setFullSync(const bool fullSync_){ fullSync = fullSync_;}
+
+    // Between beginParallelWrites() and endParallelWrites(), getFreePage() and editPage() can be called concurrently
+    // from up to nThreads OpenMP threads, as long as two threads never edit the same page; every thread gets its pages
+    // from its own reservation, which is refilled from freePages without locks.  nPagesHint is the number of pages
+    // expected to be allocated in the meantime, which are added beforehand in-memory
+    void beginParallelWrites(const uint64_t nThreads, const uint64_t nPagesHint);
+    void endParallelWrites();
+    inline uint64_t getNumEditedPages(){ return editedPages.size();}
+
 private:
 
     bool mappedFile;
@@ -53,15 +69,33 @@ private:
     shared_mutex dbResizeLock;
     uint64_t nPages;
     vector<char *> pages;
+    vector<int> fds; // Open descriptor of every mapped file, used to write back its dirty ranges
 
     recursive_mutex writePagesLock;
     uint64_t firstUnusedPage;
     uint64_t numFreePages;
     vector<uint64_t> freePages;
-    unordered_map<uint64_t, uint64_t> editedPages;
+    unordered_map<uint64_t, uint64_t> editedPages; // Also the dirty pages: every page written since the last flush is a value of it
+    vector<uint64_t> releasedPages; // Pages released by releasePageAfterFlush(), freed as the copied ones by the next flush
 
     shared_mutex headerLock;
 
+    bool fullSync;
+    void syncDirtyPages();
+
+    class ThreadPages
+    {
+    public:
+        vector<uint64_t> reservedPages; // Free pages reserved by this thread and not used yet
+        unordered_map<uint64_t, uint64_t> editedPages; // Pages edited by this thread, merged into editedPages at the end
+    };
+    bool parallelWrites;
+    atomic<uint64_t> parallelNumFreePages; // freePages[0..parallelNumFreePages) are still free during parallel writes
+    vector<ThreadPages> threadPages;
+    void reservePages(ThreadPages &tp);
+    uint64_t getReservedPage();
+    uint64_t editReservedPage(const uint64_t pageNumber);
+
 };
 
 char* PageManager::getPageAddress(const uint64_t pageNumber)
@@ -90,4 +124,12 @@ inline uint64_t PageManager::getFirstUnusedPage(){
         return firstUnusedPage;
 }
 
+//Note: if there is a single writter thread we assume that only the writter thread will call this function! 
+inline uint64_t PageManager::getNumUsedPages(){
+#if MULTIPLE_WRITES
+        lock_guard<recursive_mutex> guard_freePages(writePagesLock);
+#endif
+        return firstUnusedPage - numFreePages;
+}
+
 #endif
\ No newline at end of file
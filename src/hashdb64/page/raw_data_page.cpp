@@ -16,7 +16,7 @@ zkresult RawDataPage::InitEmptyPage (PageContext &ctx, const uint64_t pageNumber
     return ZKR_SUCCESS;
 }
 
-zkresult RawDataPage::Read (PageContext &ctx, const uint64_t _pageNumber, const uint64_t _offset, const uint64_t length, string &data)
+zkresult RawDataPage::Read (PageContext &ctx, const uint64_t _pageNumber, const uint64_t _offset, const uint64_t length, uint8_t *data)
 {
     uint64_t pageNumber = _pageNumber;
     uint64_t offset = _offset;
@@ -72,7 +72,7 @@ zkresult RawDataPage::Read (PageContext &ctx, const uint64_t _pageNumber, const
         uint64_t bytesToCopy = zkmin(pageRemainingBytes, length - copiedBytes);
 
         // Copy data
-        data.append((char *)page + offset, bytesToCopy);
+        memcpy(data + copiedBytes, (uint8_t *)page + offset, bytesToCopy);
 
         // Update counters
         offset += bytesToCopy;
@@ -82,7 +82,20 @@ zkresult RawDataPage::Read (PageContext &ctx, const uint64_t _pageNumber, const
     return ZKR_SUCCESS;
 }
 
-zkresult RawDataPage::Write (PageContext &ctx, uint64_t &pageNumber, const string &data)
+zkresult RawDataPage::Read (PageContext &ctx, const uint64_t pageNumber, const uint64_t offset, const uint64_t length, string &data)
+{
+    // Append the data to the string, as the callers expect
+    uint64_t size = data.size();
+    data.resize(size + length);
+    zkresult zkr = Read(ctx, pageNumber, offset, length, (uint8_t *)data.data() + size);
+    if (zkr != ZKR_SUCCESS)
+    {
+        data.resize(size);
+    }
+    return zkr;
+}
+
+zkresult RawDataPage::Write (PageContext &ctx, uint64_t &pageNumber, const uint8_t *data, const uint64_t length)
 {
     // Get the pointer corresponding to the current page number
     RawDataStruct *page = (RawDataStruct *)ctx.pageManager.getPageAddress(pageNumber);
@@ -94,22 +107,22 @@ zkresult RawDataPage::Write (PageContext &ctx, uint64_t &pageNumber, const strin
     // Check attributes
     if (nextPage != 0)
     {
-        zklog.error("RawDataPage::Write() 1 found non-zero nextPage=" + to_string(nextPage) + " pageNumber=" + to_string(pageNumber) + " length=" + to_string(data.size()));
+        zklog.error("RawDataPage::Write() 1 found non-zero nextPage=" + to_string(nextPage) + " pageNumber=" + to_string(pageNumber) + " length=" + to_string(length));
         return ZKR_DB_ERROR;
     }
     if (offset < minOffset)
     {
-        zklog.error("RawDataPage::Write() 1 found too-small offset=" + to_string(offset) + " pageNumber=" + to_string(pageNumber) + " length=" + to_string(data.size()));
+        zklog.error("RawDataPage::Write() 1 found too-small offset=" + to_string(offset) + " pageNumber=" + to_string(pageNumber) + " length=" + to_string(length));
         return ZKR_DB_ERROR;
     }
     if (offset > maxOffset)
     {
-        zklog.error("RawDataPage::Write() 1 found too-big offset=" + to_string(offset) + " pageNumber=" + to_string(pageNumber) + " length=" + to_string(data.size()));
+        zklog.error("RawDataPage::Write() 1 found too-big offset=" + to_string(offset) + " pageNumber=" + to_string(pageNumber) + " length=" + to_string(length));
         return ZKR_DB_ERROR;
     }
 
     uint64_t copiedBytes = 0;
-    while (copiedBytes < data.size())
+    while (copiedBytes < length)
     {
         // If we run out of space in the current page, get a new one
         if (offset == maxOffset)
@@ -127,28 +140,28 @@ zkresult RawDataPage::Write (PageContext &ctx, uint64_t &pageNumber, const strin
         // Check attributes
         if (nextPage != 0)
         {
-            zklog.error("RawDataPage::Write() 2 found non-zero nextPage=" + to_string(nextPage) + " pageNumber=" + to_string(pageNumber) + " length=" + to_string(data.size()));
+            zklog.error("RawDataPage::Write() 2 found non-zero nextPage=" + to_string(nextPage) + " pageNumber=" + to_string(pageNumber) + " length=" + to_string(length));
             return ZKR_DB_ERROR;
         }
         if (offset < minOffset)
         {
-            zklog.error("RawDataPage::Write() 2 found too-small offset=" + to_string(offset) + " pageNumber=" + to_string(pageNumber) + " length=" + to_string(data.size()));
+            zklog.error("RawDataPage::Write() 2 found too-small offset=" + to_string(offset) + " pageNumber=" + to_string(pageNumber) + " length=" + to_string(length));
             return ZKR_DB_ERROR;
         }
         if (offset > maxOffset)
         {
-            zklog.error("RawDataPage::Write() 2 found too-big offset=" + to_string(offset) + " pageNumber=" + to_string(pageNumber) + " length=" + to_string(data.size()));
+            zklog.error("RawDataPage::Write() 2 found too-big offset=" + to_string(offset) + " pageNumber=" + to_string(pageNumber) + " length=" + to_string(length));
             return ZKR_DB_ERROR;
         }
 
         // Calculate the amount of bytes to write this time
         uint64_t pageRemainingBytes = maxOffset - offset;
         zkassert(pageRemainingBytes > 0);
-        zkassert(copiedBytes < data.size());
-        uint64_t bytesToCopy = zkmin(pageRemainingBytes, data.size() - copiedBytes);
+        zkassert(copiedBytes < length);
+        uint64_t bytesToCopy = zkmin(pageRemainingBytes, length - copiedBytes);
 
         // Copy data
-        memcpy((char *)page + offset, data.c_str() + copiedBytes, bytesToCopy);
+        memcpy((char *)page + offset, data + copiedBytes, bytesToCopy);
         //zklog.info("RawDataPage::Write() wrote bytes=" + to_string(bytesToCopy) + " page=" + to_string(pageNumber) + " offset=" + to_string(offset));
 
         // Update counters
@@ -173,6 +186,47 @@ zkresult RawDataPage::Write (PageContext &ctx, uint64_t &pageNumber, const strin
     return ZKR_SUCCESS;
 }
 
+zkresult RawDataPage::Write (PageContext &ctx, uint64_t &pageNumber, const string &data)
+{
+    return Write(ctx, pageNumber, (const uint8_t *)data.c_str(), data.size());
+}
+
+// Appends the list of pages from firstPageNumber to lastPageNumber, e.g. written by another thread, to the list ending
+// at pageNumber, whose remaining space is left unused, and sets pageNumber to lastPageNumber.  If the appended list is
+// empty, its only page is released instead
+zkresult RawDataPage::Append (PageContext &ctx, uint64_t &pageNumber, const uint64_t firstPageNumber, const uint64_t lastPageNumber)
+{
+    RawDataStruct *page = (RawDataStruct *)ctx.pageManager.getPageAddress(pageNumber);
+    RawDataStruct *firstPage = (RawDataStruct *)ctx.pageManager.getPageAddress(firstPageNumber);
+
+    // Check attributes
+    uint64_t nextPage = page->nextPageNumberAndOffset & U64Mask48;
+    if (nextPage != 0)
+    {
+        zklog.error("RawDataPage::Append() found non-zero nextPage=" + to_string(nextPage) + " pageNumber=" + to_string(pageNumber) + " firstPageNumber=" + to_string(firstPageNumber));
+        return ZKR_DB_ERROR;
+    }
+    if (firstPage->previousPageNumber != 0)
+    {
+        zklog.error("RawDataPage::Append() found non-zero previousPageNumber=" + to_string(firstPage->previousPageNumber) + " pageNumber=" + to_string(pageNumber) + " firstPageNumber=" + to_string(firstPageNumber));
+        return ZKR_DB_ERROR;
+    }
+
+    // If nothing was written, release the page
+    if ((firstPageNumber == lastPageNumber) && ((firstPage->nextPageNumberAndOffset >> 48) == minOffset))
+    {
+        ctx.pageManager.releasePage(firstPageNumber);
+        return ZKR_SUCCESS;
+    }
+
+    // Link both lists, marking the current page as full
+    page->nextPageNumberAndOffset = firstPageNumber | (maxOffset << 48);
+    firstPage->previousPageNumber = pageNumber;
+    pageNumber = lastPageNumber;
+
+    return ZKR_SUCCESS;
+}
+
 uint64_t RawDataPage::GetOffset (PageContext &ctx, const uint64_t pageNumber)
 {
     RawDataStruct * page = (RawDataStruct *)ctx.pageManager.getPageAddress(pageNumber);
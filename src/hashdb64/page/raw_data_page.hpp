@@ -45,7 +45,10 @@ public:
 
     static zkresult InitEmptyPage (PageContext &ctx, const uint64_t  pageNumber);
     static zkresult Read          (PageContext &ctx, const uint64_t  pageNumber, const uint64_t offset, const uint64_t length,       string &data);
+    static zkresult Read          (PageContext &ctx, const uint64_t  pageNumber, const uint64_t offset, const uint64_t length,       uint8_t *data);
     static zkresult Write         (PageContext &ctx,       uint64_t &pageNumber,                                               const string &data);
+    static zkresult Write         (PageContext &ctx,       uint64_t &pageNumber,                        const uint8_t *data, const uint64_t length);
+    static zkresult Append        (PageContext &ctx,       uint64_t &pageNumber, const uint64_t firstPageNumber, const uint64_t lastPageNumber);
     
     static uint64_t GetOffset     (PageContext &ctx, const uint64_t  pageNumber);
     
@@ -330,7 +330,7 @@ zkresult StateManager64::write (const string &batchUUID, uint64_t block, uint64_
     return ZKR_SUCCESS;
 }
 
-zkresult StateManager64::read (const string &batchUUID, const string &key, mpz_class &value, uint64_t &level, DatabaseMap *dbReadLog)
+zkresult StateManager64::read (const string &batchUUID, const Goldilocks::Element (&key)[4], mpz_class &value, uint64_t &level, DatabaseMap *dbReadLog)
 {
     struct timeval t;
     gettimeofday(&t, NULL);
@@ -354,16 +354,14 @@ zkresult StateManager64::read (const string &batchUUID, const string &key, mpz_c
     //if (dbIt != batchState.dbWrite.end())
 
     // Search in the common key-value tree
-    Goldilocks::Element key_[4];
-    string2fea(fr, key, key_);
-    zkresult zkr = batchState.keyValueTree.read(key_, value, level);
+    zkresult zkr = batchState.keyValueTree.read(key, value, level);
     if (zkr == ZKR_SUCCESS)
     {                        
         // Add to the read log
-        if (dbReadLog != NULL) dbReadLog->add(key, value.get_str(16), true, TimeDiff(t));
+        if (dbReadLog != NULL) dbReadLog->add(fea2string(fr, key), value.get_str(16), true, TimeDiff(t));
 
 #ifdef LOG_STATE_MANAGER_READ
-        zklog.info("StateManager64::read() batchUUID=" + batchUUID + " key=" + key);
+        zklog.info("StateManager64::read() batchUUID=" + batchUUID + " key=" + fea2string(fr, key));
 #endif
 
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
@@ -1590,7 +1588,6 @@ zkresult StateManager64::get (const string &batchUUID, Database64 &db, const Gol
 
     bool bUseStateManager = config.stateManager && (batchUUID.size() > 0);
 
-    string keyString = fea2string(fr, key);
     mpz_class value = 0;
     zkresult zkr = ZKR_UNSPECIFIED;
     uint64_t stateManagerLevel = 0;
@@ -1598,7 +1595,7 @@ zkresult StateManager64::get (const string &batchUUID, Database64 &db, const Gol
     uint64_t level = 0;
     if (bUseStateManager)
     {
-        zkr = stateManager64.read(batchUUID, keyString, value, stateManagerLevel, dbReadLog);
+        zkr = stateManager64.read(batchUUID, key, value, stateManagerLevel, dbReadLog);
         if (zkr == ZKR_SUCCESS)
         {
             zkresult dbzkr = db.readLevel(key, databaseLevel);
@@ -134,7 +134,7 @@ public:
         return setStateRoot(batchUUID, block, tx, stateRoot, false, persistence);
     }
     zkresult write (const string &batchUUID, uint64_t block, uint64_t tx, const string &key, const mpz_class &value, const Persistence persistence, uint64_t &level);
-    zkresult read (const string &batchUUID, const string &key, mpz_class &value, uint64_t &level, DatabaseMap *dbReadLog);
+    zkresult read (const string &batchUUID, const Goldilocks::Element (&key)[4], mpz_class &value, uint64_t &level, DatabaseMap *dbReadLog);
     zkresult writeProgram (const string &batchUUID, uint64_t block, uint64_t tx, const string &key, const vector<uint8_t> &value, const Persistence persistence);
     zkresult readProgram (const string &batchUUID, const string &key, vector<uint8_t> &value, DatabaseMap *dbReadLog);
     zkresult finishTx (const string &batchUUID, const string &newStateRoot, const Persistence persistence);
@@ -525,6 +525,7 @@ zkresult TreeChunk::loadFromKeyValueHistoryPage (PageContext &ctx, const uint64_
             // Leaf node
             case 1:
             {
+                KeyValueHistoryStruct *historyPage = page;
                 uint64_t *keyValueEntry = page->keyValueEntry[index];
                 uint64_t foundVersion = 0;
                 while (true)
@@ -545,25 +546,18 @@ zkresult TreeChunk::loadFromKeyValueHistoryPage (PageContext &ctx, const uint64_
                         // Get key and value from raw data
                         uint64_t rawDataPage = keyValueEntry[1] & U64Mask48;
                         uint64_t rawDataOffset = keyValueEntry[1] >> 48;
-                        string keyValue;
+                        uint8_t keyValue[64];
                         zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 64, keyValue);
                         if (zkr != ZKR_SUCCESS)
                         {
                             zklog.error("TreeChunk::loadFromKeyValueHistoryPage() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
                             return zkr;
                         }
-                        if (keyValue.size() != 64)
-                        {
-                            zklog.error("TreeChunk::loadFromKeyValueHistoryPage() called RawDataPage.Read and got invalid length=" + to_string(keyValue.size()) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
-                            return zkr;
-                        }
 
                         // Set key and value in child
-                        string keyBa = keyValue.substr(0, 32);
-                        string keyString = ba2string(keyBa);                        
                         children64[index].type = LEAF;
-                        string2fea(fr, keyString, children64[index].leaf.key); 
-                        ba2scalar((uint8_t *)keyValue.c_str() + 32, 32, children64[index].leaf.value);
+                        ba2fea(fr, keyValue, children64[index].leaf.key);
+                        ba2scalar(keyValue + 32, 32, children64[index].leaf.value);
 
                         // Get hash from raw data
                         rawDataPage = keyValueEntry[2] & U64Mask48;
@@ -573,53 +567,37 @@ zkresult TreeChunk::loadFromKeyValueHistoryPage (PageContext &ctx, const uint64_
                             zklog.error("TreeChunk::loadFromKeyValueHistoryPage() found hash rawDataPage=0 pageNumber=" + to_string(pageNumber) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
                             return ZKR_DB_ERROR;
                         }
-                        string hashBa;
+                        uint8_t hashBa[32];
                         zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 32, hashBa);
                         if (zkr != ZKR_SUCCESS)
                         {
                             zklog.error("TreeChunk::loadFromKeyValueHistoryPage() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
                             return zkr;
                         }
-                        if (hashBa.size() != 32)
-                        {
-                            zklog.error("TreeChunk::loadFromKeyValueHistoryPage() called RawDataPage.Read and got invalid length=" + to_string(keyValue.size()) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
-                            return zkr;
-                        }
 
                         // Set hash in child
-                        string hashString = ba2string(hashBa);
-                        string2fea(fr, hashString, children64[index].leaf.hash);
+                        ba2fea(fr, hashBa, children64[index].leaf.hash);
 
                         break;
                     }
 
-                    if (version > foundVersion)
+                    // Search for the previous version of this entry, in this page or in the previous ones
+                    zkr = KeyValueHistoryPage::GetPreviousEntry(ctx, historyPage, index, keyValueEntry);
+                    if (zkr != ZKR_SUCCESS)
                     {
-                        continue;
+                        zklog.error("TreeChunk::loadFromKeyValueHistoryPage() failed calling KeyValueHistoryPage::GetPreviousEntry() result=" + zkresult2string(zkr) + " pageNumber=" + to_string(pageNumber) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
+                        return zkr;
                     }
-                    
-                    // Search for 
-                    uint64_t previousVersionOffset = (page->keyValueEntry[index][1] >> 48) & U64Mask12;
 
                     // If there is no previous version for this key, then this is a zero
-                    if (previousVersionOffset == 0)
+                    if (keyValueEntry == NULL)
                     {
                         children64[index].type = ZERO;
-                        return ZKR_SUCCESS;
-                    }
-
-                    // If not zero, then check the range of the previous version
-                    if ( (previousVersionOffset < KeyValueHistoryPage::minHistoryOffset) ||
-                        (previousVersionOffset > KeyValueHistoryPage::maxHistoryOffset) ||
-                        ((previousVersionOffset & U64Mask4) != 0) )
-                    {
-                        zklog.error("TreeChunk::loadFromKeyValueHistoryPage() found invalid previousVersionOffset=" + to_string(previousVersionOffset));
-                        return ZKR_DB_ERROR;
+                        break;
                     }
-
-                    // Get the previous version entry
-                    keyValueEntry = (uint64_t *)((uint8_t *)page + previousVersionOffset);
                 }
+
+                continue;
             }
 
             // Intermediate node
@@ -635,23 +613,17 @@ zkresult TreeChunk::loadFromKeyValueHistoryPage (PageContext &ctx, const uint64_
                 // Get hash from raw data
                 uint64_t rawDataPage = page->keyValueEntry[index][2] & U64Mask48;
                 uint64_t rawDataOffset = page->keyValueEntry[index][2] >> 48;
-                string hashBa;
+                uint8_t hashBa[32];
                 zkr = RawDataPage::Read(ctx, rawDataPage, rawDataOffset, 32, hashBa);
                 if (zkr != ZKR_SUCCESS)
                 {
                     zklog.error("TreeChunk::loadFromKeyValueHistoryPage() failed calling RawDataPage.Read result=" + zkresult2string(zkr) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
                     return zkr;
                 }
-                if (hashBa.size() != 32)
-                {
-                    zklog.error("TreeChunk::loadFromKeyValueHistoryPage() called RawDataPage.Read and got invalid length=" + to_string(hashBa.size()) + " rawDataPage=" + to_string(rawDataPage) + " rawDataOffset=" + to_string(rawDataOffset) + " version=" + to_string(version) + " level=" + to_string(level) + " index=" + to_string(index));
-                    return zkr;
-                }
 
                 // Set hash in child
-                string hashString = ba2string(hashBa);
                 children64[index].type = INTERMEDIATE;
-                string2fea(fr, hashString, children64[index].intermediate.hash);
+                ba2fea(fr, hashBa, children64[index].intermediate.hash);
 
                 continue;
             }
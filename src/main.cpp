@@ -49,6 +49,15 @@
 #include "page_manager_test.hpp"
 #include "zkglobals.hpp"
 #include "key_value_tree_test.hpp"
+#include "fri_fold_test.hpp"
+#include "zkin_test.hpp"
+#include "lde_merkle_tree_test.hpp"
+#include "shared_memory_test.hpp"
+#include "chelpers_fused_test.hpp"
+#include "database_associative_cache_test.hpp"
+#include "flat_hash_map_test.hpp"
+#include "multiexp_test.hpp"
+#include "fft_test.hpp"
 
 using namespace std;
 using json = nlohmann::json;
@@ -531,6 +540,60 @@ int main(int argc, char **argv)
         UnitTest(fr, poseidon, config);
     }
 
+    // Test FRI folding
+    if (config.runFRIFoldTest)
+    {
+        FRIFoldTest(config);
+    }
+
+    // Test typed zkin generation
+    if (config.runZkinTest)
+    {
+        ZkinTest();
+    }
+
+    // Test fused low degree extension and merkle tree
+    if (config.runLDEMerkleTreeTest)
+    {
+        LDEMerkleTreeTest();
+    }
+
+    // Test shared memory segments
+    if (config.runSharedMemoryTest)
+    {
+        SharedMemoryTest();
+    }
+
+    // Test the fused step 4 parser
+    if (config.runChelpersFusedTest)
+    {
+        ChelpersFusedTest(config);
+    }
+
+    // Test the database associative cache concurrency
+    if (config.runDatabaseAssociativeCacheTest)
+    {
+        DatabaseAssociativeCacheTest();
+    }
+
+    // Test FlatHashMap
+    if (config.runFlatHashMapTest)
+    {
+        FlatHashMapTest();
+    }
+
+    // Test multiexponentiation
+    if (config.runMultiexpTest)
+    {
+        MultiexpTest();
+    }
+
+    // Test FFT
+    if (config.runFFTTest)
+    {
+        FFTTest(config);
+    }
+
     // If there is nothing else to run, exit normally
     if (!config.runExecutorServer && !config.runExecutorClient && !config.runExecutorClientMultithread &&
         !config.runHashDBServer && !config.runHashDBTest &&
@@ -337,6 +337,16 @@ string generate(const json &rom, uint64_t forkID, string forkNamespace, const st
 
     code += "    Context ctx(mainExecutor.fr, mainExecutor.config, mainExecutor.fec, mainExecutor.fnec, pols, mainExecutor.rom, proverRequest, mainExecutor.pHashDB);\n\n";
 
+    if (!bFastMode && (forkID >= 9))
+    {
+        code += "    // Reserve the required vectors with the sizes reached by the previous execution that used this arena\n";
+        code += "    if (!bProcessBatch)\n";
+        code += "    {\n";
+        code += "        ctx.arena.pRequired = &required;\n";
+        code += "        ctx.arena.requiredSizes.reserve(required);\n";
+        code += "    }\n\n";
+    }
+
     code += "    mainExecutor.initState(ctx);\n\n";
 
     code += "#ifdef LOG_COMPLETED_STEPS_TO_FILE\n";
@@ -411,7 +421,10 @@ string generate(const json &rom, uint64_t forkID, string forkNamespace, const st
     code += "    uint64_t lm;\n";
     code += "    uint64_t lh;\n";
     code += "    mpz_class paddingA;\n";
-    code += "    unordered_map< uint64_t, HashValue >::iterator hashIterator;\n";
+    if (forkID >= 9)
+        code += "    HashValueMap::iterator hashIterator;\n";
+    else
+        code += "    unordered_map< uint64_t, HashValue >::iterator hashIterator;\n";
     code += "    unordered_map<uint64_t, uint64_t>::iterator readsIterator;\n";
     code += "    HashValue emptyHashValue;\n";
 
@@ -468,7 +481,10 @@ string generate(const json &rom, uint64_t forkID, string forkNamespace, const st
         code += "    MemoryAccess memoryAccess;\n";
 
     code += "    std::ofstream outfile;\n";
-    code += "    std::unordered_map<uint64_t, Fea>::iterator memIterator;\n";
+    if (forkID >= 9)
+        code += "    MemMap::iterator memIterator;\n";
+    else
+        code += "    std::unordered_map<uint64_t, Fea>::iterator memIterator;\n";
     code += "\n";
 
     code += "    uint64_t zkPC = 0; // Zero-knowledge program counter\n";
@@ -5949,6 +5965,16 @@ code += "    #endif\n";
             code += "    }\n\n";
         }
 
+        // PUBLISH STREAMED ACTIONS
+        if (!bFastMode && (forkID >= 9))
+        {
+            code += "    // Publish the new Binary, Arith and MemAlign actions to the secondary executors, if streaming\n";
+            code += "    if (required.pStreams != NULL)\n";
+            code += "    {\n";
+            code += "        required.publish(false);\n";
+            code += "    }\n\n";
+        }
+
         code += "#ifdef LOG_COMPLETED_STEPS\n";
         code += "    zklog.info( \"<-- Completed step=\" + to_string(i) + \" zkPC=" + to_string(zkPC) + " op=\" + fr.toString(op7,16) + \":\" + fr.toString(op6,16) + \":\" + fr.toString(op5,16) + \":\" + fr.toString(op4,16) + \":\" + fr.toString(op3,16) + \":\" + fr.toString(op2,16) + \":\" + fr.toString(op1,16) + \":\" + fr.toString(op0,16) + \" ABCDE0=\" + fr.toString(pols.A0[" + string(bFastMode?"0":"nexti") + "],16) + \":\" + fr.toString(pols.B0[" + string(bFastMode?"0":"nexti") + "],16) + \":\" + fr.toString(pols.C0[" + string(bFastMode?"0":"nexti") + "],16) + \":\" + fr.toString(pols.D0[" + string(bFastMode?"0":"nexti") + "],16) + \":\" + fr.toString(pols.E0[" + string(bFastMode?"0":"nexti") + "],16) + \" FREE0:7=\" + fr.toString(fi0,16) + \":\" + fr.toString(fi7,16) + \" addr=\" + to_string(addr));\n";
         /*code += "    zklog.info(\"<-- Completed step=\" + to_string(i) + \" zkPC=" + to_string(zkPC) +
@@ -1060,7 +1060,7 @@ void FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
         singleInfo.gas_refund = auxScalar.get_ui();
         //singleInfo.error = "";
         fea2scalar(ctx.fr, auxScalar, ctx.pols.SR0[*ctx.pStep], ctx.pols.SR1[*ctx.pStep], ctx.pols.SR2[*ctx.pStep], ctx.pols.SR3[*ctx.pStep], ctx.pols.SR4[*ctx.pStep], ctx.pols.SR5[*ctx.pStep], ctx.pols.SR6[*ctx.pStep], ctx.pols.SR7[*ctx.pStep]);
-        singleInfo.state_root = NormalizeTo0xNFormat(auxScalar.get_str(16), 64);
+        singleInfo.state_root = scalar2ba32(auxScalar);
 
         // Add contract info
         getVarFromCtx(ctx, false, ctx.rom.txDestAddrOffset, auxScalar);
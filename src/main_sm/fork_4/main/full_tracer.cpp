@@ -1261,7 +1261,7 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
             zklog.error("FullTracer::onOpcode() failed calling fea2scalar()");
             return ZKR_SM_MAIN_FEA2SCALAR;
         }
-        singleInfo.state_root = NormalizeTo0xNFormat(auxScalar.get_str(16), 64);
+        singleInfo.state_root = scalar2ba32(auxScalar);
 
         // Add contract info
         zkr = getVarFromCtx(ctx, false, ctx.rom.txDestAddrOffset, auxScalar);
@@ -951,8 +951,9 @@ zkresult FullTracer::onFinishBlock (Context &ctx)
         currentBlock.logs.emplace_back(auxLogsIt->second);
     }
 
-    // Append block to final trace
-    finalTrace.block_responses.emplace_back(currentBlock);
+    // Append block to final trace, moving its transaction responses and logs instead of copying them, since the
+    // next block starts without them
+    finalTrace.block_responses.emplace_back(std::move(currentBlock));
     currentBlock.initialized = false;
 
     // Reset logs
@@ -2357,7 +2358,7 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
             zklog.error("FullTracer::onOpcode() failed calling fea2scalar()");
             return ZKR_SM_MAIN_FEA2SCALAR;
         }
-        singleInfo.state_root = NormalizeTo0xNFormat(auxScalar.get_str(16), 64);
+        singleInfo.state_root = scalar2ba32(auxScalar);
 
         // Add contract info
         zkr = getVarFromCtx(ctx, false, ctx.rom.txDestAddrOffset, auxScalar);
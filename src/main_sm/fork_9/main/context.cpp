@@ -1,9 +1,86 @@
 #include "main_sm/fork_9/main/context.hpp"
 #include "zklog.hpp"
+#include "exit_process.hpp"
 
 namespace fork_9
 {
 
+pthread_mutex_t ContextArenaPool::mutex = PTHREAD_MUTEX_INITIALIZER;
+vector<ContextArena *> ContextArenaPool::freeArenas;
+uint64_t ContextArenaPool::created = 0;
+uint64_t ContextArenaPool::reused = 0;
+
+void ContextArena::reset (void)
+{
+    mem.clear();
+    hashK.clear();
+    hashP.clear();
+    hashS.clear();
+    if (pRequired != NULL)
+    {
+        requiredSizes.record(*pRequired);
+        pRequired = NULL;
+    }
+    executions++;
+}
+
+ContextArena & ContextArenaPool::acquire (void)
+{
+    ContextArena * pArena = NULL;
+    pthread_mutex_lock(&mutex);
+    if (freeArenas.empty())
+    {
+        created++;
+    }
+    else
+    {
+        pArena = freeArenas.back();
+        freeArenas.pop_back();
+        reused++;
+    }
+    pthread_mutex_unlock(&mutex);
+
+    if (pArena == NULL)
+    {
+        pArena = new ContextArena();
+        if (pArena == NULL)
+        {
+            zklog.error("ContextArenaPool::acquire() failed calling new ContextArena()");
+            exitProcess();
+        }
+    }
+    return *pArena;
+}
+
+void ContextArenaPool::release (ContextArena &arena)
+{
+    // Do not retain the memory of exceptionally big executions
+    if (arena.getCapacity() > CONTEXT_ARENA_MAX_RETAINED_CAPACITY)
+    {
+        delete &arena;
+        return;
+    }
+
+    arena.reset();
+    pthread_mutex_lock(&mutex);
+    freeArenas.push_back(&arena);
+    pthread_mutex_unlock(&mutex);
+}
+
+void ContextArenaPool::printStats (void)
+{
+    pthread_mutex_lock(&mutex);
+    uint64_t capacity = 0;
+    uint64_t allocations = 0;
+    for (uint64_t i=0; i<freeArenas.size(); i++)
+    {
+        capacity += freeArenas[i]->getCapacity();
+        allocations += freeArenas[i]->getAllocations();
+    }
+    zklog.info("ContextArenaPool::printStats() created=" + to_string(created) + " reused=" + to_string(reused) + " free=" + to_string(freeArenas.size()) + " freeCapacity=" + to_string(capacity) + " freeTableAllocations=" + to_string(allocations));
+    pthread_mutex_unlock(&mutex);
+}
+
 void Context::printRegs(string &log)
 {
     if (pStep == NULL)
@@ -89,7 +166,7 @@ void Context::printMem()
 {
     zklog.info("Memory:");
     uint64_t i = 0;
-    for (unordered_map<uint64_t, Fea>::iterator it = mem.begin(); it != mem.end(); it++)
+    for (MemMap::iterator it = mem.begin(); it != mem.end(); it++)
     {
         mpz_class addr(it->first);
         zklog.info("i: " + to_string(i) + " address:" + addr.get_str(16) + " " + printFea(it->second));
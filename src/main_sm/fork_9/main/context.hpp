@@ -19,6 +19,8 @@
 #include "ffiasm/fnec.hpp"
 #include "prover_request.hpp"
 #include "hashdb_interface.hpp"
+#include "main_sm/fork_9/main/main_exec_required.hpp"
+#include "flat_hash_map.hpp"
 
 using namespace std;
 using json = nlohmann::json;
@@ -139,6 +141,53 @@ public:
     ECRecoverPrecalcBuffer() : filled(false), pos(0), posUsed(0) {};
 };
 
+// Flat hash tables used by the context, indexed by memory address or by hash ID
+typedef FlatHashMap< uint64_t, Fea, FlatHashU64 > MemMap;
+typedef FlatHashMap< uint64_t, HashValue, FlatHashU64 > HashValueMap;
+
+// Arenas retaining more elements than this are freed instead of being reused
+#define CONTEXT_ARENA_MAX_RETAINED_CAPACITY (1 << 22)
+
+/*
+    Memory reused by consecutive executions: the context tables are cleared at the end of every
+    execution, keeping their capacity, and the required vectors are reserved with the sizes reached
+    by the previous execution, so that a warm executor does not allocate them again per request.
+*/
+class ContextArena
+{
+public:
+    MemMap mem;
+    HashValueMap hashK;
+    HashValueMap hashP;
+    HashValueMap hashS;
+
+    MainExecRequired * pRequired; // Required vectors of the current execution, if any
+    MainExecRequiredSizes requiredSizes; // Sizes reached by the previous execution
+
+    uint64_t executions; // Number of executions that used this arena
+    ContextArena() : pRequired(NULL), executions(0) {};
+
+    uint64_t getCapacity (void) const { return mem.getCapacity() + hashK.getCapacity() + hashP.getCapacity() + hashS.getCapacity(); };
+    uint64_t getAllocations (void) const { return mem.getAllocations() + hashK.getAllocations() + hashP.getAllocations() + hashS.getAllocations(); };
+
+    // Clears the tables, keeping their capacity, and records the sizes of the required vectors
+    void reset (void);
+};
+
+// Process-wide pool of arenas, shared by the concurrent executions
+class ContextArenaPool
+{
+private:
+    static pthread_mutex_t mutex; // Mutex to protect the free arenas list
+    static vector<ContextArena *> freeArenas;
+    static uint64_t created; // Arenas allocated since the process started
+    static uint64_t reused; // Acquisitions that got an existing arena
+public:
+    static ContextArena & acquire (void);
+    static void release (ContextArena &arena);
+    static void printStats (void);
+};
+
 class Context
 {
 public:
@@ -190,22 +239,32 @@ public:
         pZKPC(NULL),
         pStep(NULL),
         pEvaluation(NULL),
-        N(0){}; // Constructor, setting references
+        N(0),
+        arena(ContextArenaPool::acquire()),
+        hashK(arena.hashK),
+        hashP(arena.hashP),
+        hashS(arena.hashS),
+        mem(arena.mem){}; // Constructor, setting references
+
+    ~Context() { ContextArenaPool::release(arena); };
+
+    // Tables and vector sizes reused across executions
+    ContextArena &arena;
 
     // HashK database, used in Keccak-f hash instructions hashK, hashK1, hashKLen and hashKDigest
-    unordered_map< uint64_t, HashValue > hashK;
+    HashValueMap &hashK;
 
     // HashP database, used in Poseidon linear hash instructions hashP, hashP1, hashPLen and hashPDigest
-    unordered_map< uint64_t, HashValue > hashP;
+    HashValueMap &hashP;
 
     // HashS database, used in SHA-256 hash instructions hashS, hashS1, hashSLen and hashSDigest
-    unordered_map< uint64_t, HashValue > hashS;
+    HashValueMap &hashS;
 
     // Variables database, used in evalCommand() declareVar/setVar/getVar
     unordered_map< string, mpz_class > vars;
 
     // Memory map, using absolute address as key, and field element array as value
-    unordered_map< uint64_t, Fea > mem; // TODO: Use array<Goldilocks::Element,8> instead of Fea, or declare Fea8, Fea4 at a higher level
+    MemMap &mem; // TODO: Use array<Goldilocks::Element,8> instead of Fea, or declare Fea8, Fea4 at a higher level
 
     // A vector of maps of accessed Ethereum address to sets of keys
     // Every position of the vector represents a context
@@ -3120,7 +3120,7 @@ void eval_MPdiv (Context &ctx, const RomCommand &cmd, CommandResult &cr)
 
     vector<mpz_class> input1;
     vector<mpz_class> input2;
-    unordered_map<uint64_t, fork_9::Fea>::const_iterator it;
+    fork_9::MemMap::const_iterator it;
     mpz_class auxScalar;
     for (uint64_t i = 0; i < len1; i++)
     {
@@ -3213,7 +3213,7 @@ void eval_MPdiv_short (Context &ctx, const RomCommand &cmd, CommandResult &cr)
     mpz_class &input2 = cr.scalar;
 
     vector<mpz_class> input1;
-    unordered_map<uint64_t, fork_9::Fea>::const_iterator it;
+    fork_9::MemMap::const_iterator it;
     mpz_class auxScalar;
     for (uint64_t i = 0; i < len1; i++)
     {
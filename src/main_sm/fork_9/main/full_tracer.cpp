@@ -117,7 +117,7 @@ inline zkresult getFromMemory(Context &ctx, mpz_class &offset, mpz_class &length
     if (init != double(initCeil))
     {
         mpz_class memScalarStart = 0;
-        std::unordered_map<uint64_t, Fea>::iterator it = ctx.mem.find(initFloor);
+        MemMap::iterator it = ctx.mem.find(initFloor);
         if (it != ctx.mem.end())
         {
             if (!fea2scalar(ctx.fr, memScalarStart, it->second.fe0, it->second.fe1, it->second.fe2, it->second.fe3, it->second.fe4, it->second.fe5, it->second.fe6, it->second.fe7))
@@ -149,7 +149,7 @@ inline zkresult getFromMemory(Context &ctx, mpz_class &offset, mpz_class &length
     if (end != double(endFloor))
     {
         mpz_class memScalarEnd = 0;
-        std::unordered_map<uint64_t, Fea>::iterator it = ctx.mem.find(endFloor);
+        MemMap::iterator it = ctx.mem.find(endFloor);
         if (it != ctx.mem.end())
         {
             if (!fea2scalar(ctx.fr, memScalarEnd, it->second.fe0, it->second.fe1, it->second.fe2, it->second.fe3, it->second.fe4, it->second.fe5, it->second.fe6, it->second.fe7))
@@ -177,7 +177,7 @@ inline zkresult getVarFromCtx(Context &ctx, bool global, uint64_t varOffset, mpz
 
     uint64_t offsetCtx = global ? 0 : (pContext != NULL) ? *pContext*0x40000 : ctx.fr.toU64(ctx.pols.CTX[*ctx.pStep])*0x40000;
     uint64_t addressMem = offsetCtx + varOffset;
-    unordered_map<uint64_t, Fea>::iterator memIterator;
+    MemMap::iterator memIterator;
     memIterator = ctx.mem.find(addressMem);
     if (memIterator == ctx.mem.end())
     {
@@ -206,7 +206,7 @@ inline zkresult getCalldataFromStack(Context &ctx, uint64_t offset, uint64_t len
     mpz_class auxScalar;
     result = "0x";
     
-    unordered_map<uint64_t, Fea>::iterator memIterator;
+    MemMap::iterator memIterator;
     uint64_t consumedLength = 0;
     for (uint64_t i = firstAddr; i < lastAddr; i++)
     {
@@ -317,6 +317,20 @@ void getTransactionHash( string    &to,
 /***************/
 
 zkresult FullTracer::handleEvent(Context &ctx, const RomCommand &cmd)
+{
+    // Account the time spent by the tracer, to report its overhead over the execution time
+    if (ctx.config.opcodeTracer)
+    {
+        struct timeval tracerStart;
+        gettimeofday(&tracerStart, NULL);
+        zkresult zkr = processEvent(ctx, cmd);
+        tracerTime += TimeDiff(tracerStart);
+        return zkr;
+    }
+    return processEvent(ctx, cmd);
+}
+
+zkresult FullTracer::processEvent(Context &ctx, const RomCommand &cmd)
 {    
     if (cmd.function == f_storeLog)
     {
@@ -325,7 +339,7 @@ zkresult FullTracer::handleEvent(Context &ctx, const RomCommand &cmd)
     }
     if (cmd.params.size() == 0)
     {
-        zklog.error("FullTracer::handleEvent() got an invalid event with cmd.params.size()==0 cmd.function=" + function2String(cmd.function));
+        zklog.error("FullTracer::processEvent() got an invalid event with cmd.params.size()==0 cmd.function=" + function2String(cmd.function));
         exitProcess();
     }
     if (cmd.params[0]->varName == "onError")
@@ -340,7 +354,7 @@ zkresult FullTracer::handleEvent(Context &ctx, const RomCommand &cmd)
     {
         if ( (oocErrors.find(lastError)==oocErrors.end()) && (ctx.totalTransferredBalance != 0) )
         {
-            zklog.error("FullTracer::handleEvent(onFinishTx) found ctx.totalTransferredBalance=" + ctx.totalTransferredBalance.get_str(10));
+            zklog.error("FullTracer::processEvent(onFinishTx) found ctx.totalTransferredBalance=" + ctx.totalTransferredBalance.get_str(10));
             return ZKR_SM_MAIN_BALANCE_MISMATCH;
         }
         return onFinishTx(ctx, cmd);
@@ -353,7 +367,7 @@ zkresult FullTracer::handleEvent(Context &ctx, const RomCommand &cmd)
     {
         if ( (oocErrors.find(lastError)==oocErrors.end()) && (ctx.totalTransferredBalance != 0) )
         {
-            zklog.error("FullTracer::handleEvent(onFinishBlock) found ctx.totalTransferredBalance=" + ctx.totalTransferredBalance.get_str(10));
+            zklog.error("FullTracer::processEvent(onFinishBlock) found ctx.totalTransferredBalance=" + ctx.totalTransferredBalance.get_str(10));
             return ZKR_SM_MAIN_BALANCE_MISMATCH;
         }
         return onFinishBlock(ctx);
@@ -366,7 +380,7 @@ zkresult FullTracer::handleEvent(Context &ctx, const RomCommand &cmd)
     {
         if ( (oocErrors.find(lastError)==oocErrors.end()) && (ctx.totalTransferredBalance != 0) )
         {
-            zklog.error("FullTracer::handleEvent(onFinishBatch) found ctx.totalTransferredBalance=" + ctx.totalTransferredBalance.get_str(10));
+            zklog.error("FullTracer::processEvent(onFinishBatch) found ctx.totalTransferredBalance=" + ctx.totalTransferredBalance.get_str(10));
             return ZKR_SM_MAIN_BALANCE_MISMATCH;
         }
         return onFinishBatch(ctx, cmd);
@@ -381,7 +395,7 @@ zkresult FullTracer::handleEvent(Context &ctx, const RomCommand &cmd)
         // if (ctx.proverRequest.bNoCounters) return;
         return onUpdateStorage(ctx, *cmd.params[0]);
     }
-    zklog.error("FullTracer::handleEvent() got an invalid event cmd.params[0]->varName=" + cmd.params[0]->varName + " cmd.function=" + function2String(cmd.function));
+    zklog.error("FullTracer::processEvent() got an invalid event cmd.params[0]->varName=" + cmd.params[0]->varName + " cmd.function=" + function2String(cmd.function));
     exitProcess();
     return ZKR_INTERNAL_ERROR;
 }
@@ -804,10 +818,21 @@ zkresult FullTracer::onFinishBlock (Context &ctx)
         currentBlock.logs.emplace_back(auxLogsIt->second);
     }
 
-    // Append block to final trace
-    finalTrace.block_responses.emplace_back(currentBlock);
+    // Append block to final trace, moving its transaction responses and logs instead of copying them, since the
+    // next block starts without them
+    finalTrace.block_responses.emplace_back(std::move(currentBlock));
     currentBlock.initialized = false;
 
+    // Stream the block, if requested; its transaction responses and logs, including the full trace,
+    // have been sent, so only the block header is kept
+    if (ctx.proverRequest.pBlockStreamFunction != NULL)
+    {
+        Block &block = finalTrace.block_responses.back();
+        ctx.proverRequest.pBlockStreamFunction(ctx.proverRequest.pBlockStreamArg, block);
+        vector<ResponseV2>().swap(block.responses);
+        vector<LogV2>().swap(block.logs);
+    }
+
     // Reset logs
     logs.clear();
     
@@ -1121,22 +1146,17 @@ zkresult FullTracer::onUpdateStorage(Context &ctx, const RomCommand &cmd)
             zklog.error("FullTracer::onUpdateStorage() failed calling getVarFromCtx(storageAddr) result=" + zkresult2string(zkr));
             return zkr;
         }
-        string storageAddress = NormalizeTo0xNFormat(auxScalar.get_str(16), 64);
+        // Delta storage is indexed by the 32-bytes binary address; key and value are kept in hex, as they are returned
+        string storageAddress = scalar2ba32(auxScalar);
 
-        // add key/value to deltaStorage, if undefined, create object
-        if (deltaStorage.find(storageAddress) == deltaStorage.end())
-        {
-            unordered_map<string, string> auxMap;
-            deltaStorage[storageAddress] = auxMap;
-        }
-
-        // Add key/value to deltaStorage
-        deltaStorage[storageAddress][key] = value;
+        // Add key/value to deltaStorage, creating the address entry if undefined
+        unordered_map<string, string> &addressStorage = deltaStorage[storageAddress];
+        addressStorage[key] = value;
         
         // Add deltaStorage to current execution_trace opcode info
         if (full_trace.size() > 0)
         {
-            full_trace[full_trace.size() - 1].storage = deltaStorage[storageAddress];
+            full_trace[full_trace.size() - 1].storage = addressStorage;
         }
 
 #ifdef LOG_FULL_TRACER
@@ -1633,8 +1653,6 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
 
     if (ctx.proverRequest.input.traceConfig.bGenerateMemory)
     {
-        string finalMemory;
-        
         // Get context offset
         uint64_t offsetCtx = fr.toU64(ctx.pols.CTX[*ctx.pStep]) * 0x40000;
 
@@ -1643,7 +1661,7 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
 
         uint64_t lengthMemOffset = ctx.rom.memLengthOffset;
         uint64_t lenMemValueFinal = 0;
-        unordered_map< uint64_t, Fea >::iterator it;
+        MemMap::iterator it;
         it = ctx.mem.find(offsetCtx + lengthMemOffset);
         if (it != ctx.mem.end())
         {
@@ -1656,24 +1674,23 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
             lenMemValueFinal = ceil(double(auxScalar.get_ui()) / 32);
         }
 
+        // Build the memory content directly as bytes, 32 per memory slot; missing slots are zeros
+        string baMemory;
+        baMemory.assign(lenMemValueFinal*32, 0);
         for (uint64_t i = 0; i < lenMemValueFinal; i++)
         {
             it = ctx.mem.find(addrMem + i);
             if (it == ctx.mem.end())
             {
-                finalMemory += "0000000000000000000000000000000000000000000000000000000000000000";
                 continue;
             }
-            Fea memValue = it->second;
-            if (!fea2scalar(ctx.fr, auxScalar, memValue.fe0, memValue.fe1, memValue.fe2, memValue.fe3, memValue.fe4, memValue.fe5, memValue.fe6, memValue.fe7))
+            Fea &memValue = it->second;
+            if (!fea2ba(ctx.fr, (uint8_t *)&baMemory[i*32], memValue.fe0, memValue.fe1, memValue.fe2, memValue.fe3, memValue.fe4, memValue.fe5, memValue.fe6, memValue.fe7))
             {
-                zklog.error("FullTracer::onOpcode() failed calling fea2scalar(memValue)");
+                zklog.error("FullTracer::onOpcode() failed calling fea2ba(memValue)");
                 return ZKR_SM_MAIN_FEA2SCALAR;
             }
-            finalMemory += PrependZeros(auxScalar.get_str(16), 64);
         }
-        
-        string baMemory = string2ba(finalMemory);
 
         if (numOpcodes == 0)
         {
@@ -1714,7 +1731,7 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
         uint64_t addr = offsetCtx + 0x10000;
 
         uint16_t sp = fr.toU64(ctx.pols.SP[*ctx.pStep]);
-        unordered_map<uint64_t, Fea>::iterator it;
+        MemMap::iterator it;
         for (uint16_t i = 0; i < sp; i++)
         {
             it = ctx.mem.find(addr + i);
@@ -1758,13 +1775,13 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
 
         //singleInfo.error = "";
         
-        // Set state root
-        if (!fea2scalar(ctx.fr, auxScalar, ctx.pols.SR0[*ctx.pStep], ctx.pols.SR1[*ctx.pStep], ctx.pols.SR2[*ctx.pStep], ctx.pols.SR3[*ctx.pStep], ctx.pols.SR4[*ctx.pStep], ctx.pols.SR5[*ctx.pStep], ctx.pols.SR6[*ctx.pStep], ctx.pols.SR7[*ctx.pStep]))
+        // Set state root, as a 32-bytes binary string
+        singleInfo.state_root.resize(32);
+        if (!fea2ba(ctx.fr, (uint8_t *)&singleInfo.state_root[0], ctx.pols.SR0[*ctx.pStep], ctx.pols.SR1[*ctx.pStep], ctx.pols.SR2[*ctx.pStep], ctx.pols.SR3[*ctx.pStep], ctx.pols.SR4[*ctx.pStep], ctx.pols.SR5[*ctx.pStep], ctx.pols.SR6[*ctx.pStep], ctx.pols.SR7[*ctx.pStep]))
         {
-            zklog.error("FullTracer::onOpcode() failed calling fea2scalar()");
+            zklog.error("FullTracer::onOpcode() failed calling fea2ba()");
             return ZKR_SM_MAIN_FEA2SCALAR;
         }
-        singleInfo.state_root = NormalizeTo0xNFormat(auxScalar.get_str(16), 64);
 
         // Add contract info
         zkr = getVarFromCtx(ctx, false, ctx.rom.txDestAddrOffset, auxScalar);
@@ -2312,7 +2329,12 @@ zkresult FullTracer::fillInReadWriteAddresses (Context &ctx)
     Goldilocks::Element newStateRoot[4];
     string2fea(fr, NormalizeToNFormat(finalTrace.new_state_root, 64), newStateRoot);
 
-    // For all entries in read_write_addresses
+    // Collect the balance and nonce keys of all entries in read_write_addresses, and the strings
+    // to fill in with their values
+    vector<KeyValue> keyValues;
+    vector<string *> targets;
+    keyValues.reserve(read_write_addresses.size()*2);
+    targets.reserve(read_write_addresses.size()*2);
     unordered_map<string, InfoReadWrite>::iterator it;
     for (it = read_write_addresses.begin(); it != read_write_addresses.end(); it++)
     {
@@ -2320,31 +2342,40 @@ zkresult FullTracer::fillInReadWriteAddresses (Context &ctx)
         if (!it->second.balance.empty())
         {
             zkassert(!fr.isZero(it->second.balanceKey[0]) || !fr.isZero(it->second.balanceKey[1]) || !fr.isZero(it->second.balanceKey[2]) || !fr.isZero(it->second.balanceKey[3]));
-            mpz_class balance;
-            zkr = ctx.pHashDB->get(ctx.proverRequest.uuid, newStateRoot, it->second.balanceKey, balance, NULL, NULL);
-            if (zkr != ZKR_SUCCESS)
-            {
-                zklog.error("FullTracer::fillInReadWriteAddresses() failed calling ctx.pHashDB->get(balance) result=" + zkresult2string(zkr));
-                return zkr;
-            }
-            it->second.balance = balance.get_str();
+            KeyValue keyValue;
+            for (uint64_t i=0; i<4; i++) keyValue.key[i] = it->second.balanceKey[i];
+            keyValues.emplace_back(keyValue);
+            targets.emplace_back(&it->second.balance);
         }
 
         // Re-read nonce for this state root
         if (!it->second.nonce.empty())
         {
             zkassert(!fr.isZero(it->second.nonceKey[0]) || !fr.isZero(it->second.nonceKey[1]) || !fr.isZero(it->second.nonceKey[2]) || !fr.isZero(it->second.nonceKey[3]));
-            mpz_class nonce;
-            zkr = ctx.pHashDB->get(ctx.proverRequest.uuid, newStateRoot, it->second.nonceKey, nonce, NULL, NULL);
-            if (zkr != ZKR_SUCCESS)
-            {
-                zklog.error("FullTracer::fillInReadWriteAddresses() failed calling ctx.pHashDB->get(nonce) result=" + zkresult2string(zkr));
-                return zkr;
-            }
-            it->second.nonce = nonce.get_str();
+            KeyValue keyValue;
+            for (uint64_t i=0; i<4; i++) keyValue.key[i] = it->second.nonceKey[i];
+            keyValues.emplace_back(keyValue);
+            targets.emplace_back(&it->second.nonce);
         }
     }
 
+    if (keyValues.size() == 0)
+    {
+        return ZKR_SUCCESS;
+    }
+
+    // Get all of them at once, i.e. in a single call to a remote HashDB
+    zkr = ctx.pHashDB->getBatch(ctx.proverRequest.uuid, newStateRoot, keyValues, NULL);
+    if (zkr != ZKR_SUCCESS)
+    {
+        zklog.error("FullTracer::fillInReadWriteAddresses() failed calling ctx.pHashDB->getBatch() keys=" + to_string(keyValues.size()) + " result=" + zkresult2string(zkr));
+        return zkr;
+    }
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        *targets[i] = keyValues[i].value.get_str();
+    }
+
     return ZKR_SUCCESS;
 }
 
@@ -30,7 +30,7 @@ public:
     uint64_t depth;
     uint64_t prevCTX;
     uint64_t initGas;
-    unordered_map<string,unordered_map<string,string>> deltaStorage;
+    unordered_map<string,unordered_map<string,string>> deltaStorage; // Binary address -> hex key -> hex value
     FinalTraceV2 finalTrace;
     unordered_map<uint64_t,TxGAS> txGAS;
     uint64_t txTime; // in us
@@ -50,6 +50,7 @@ public:
     uint64_t txIndex; // Transaction index in the current block
     Block currentBlock;
     bool isForced;
+    uint64_t tracerTime; // Time spent processing events, in us; only measured if config.opcodeTracer
 #ifdef LOG_TIME_STATISTICS
     TimeMetricStorage tms;
     struct timeval t;
@@ -75,7 +76,7 @@ public:
                                    const Goldilocks::Element (&key)[4] );
     zkresult fillInReadWriteAddresses (Context &ctx);
 
-    FullTracer(Goldilocks &fr) : fr(fr), depth(1), prevCTX(0), initGas(0), txTime(0), accBatchGas(0), numberOfOpcodesInThisTx(0), lastErrorOpcode(0), hasGaspriceOpcode(false), hasBalanceOpcode(false), txIndex(0), isForced(false) { };
+    FullTracer(Goldilocks &fr) : fr(fr), depth(1), prevCTX(0), initGas(0), txTime(0), accBatchGas(0), numberOfOpcodesInThisTx(0), lastErrorOpcode(0), hasGaspriceOpcode(false), hasBalanceOpcode(false), txIndex(0), isForced(false), tracerTime(0) { };
     ~FullTracer()
     {
 #ifdef LOG_TIME_STATISTICS
@@ -85,6 +86,7 @@ public:
     }
     
     zkresult handleEvent (Context &ctx, const RomCommand &cmd);
+    zkresult processEvent (Context &ctx, const RomCommand &cmd);
 
     FullTracer & operator =(const FullTracer & other)
     {
@@ -163,6 +165,10 @@ public:
     {
         return finalTrace.invalid_batch;
     }
+    uint64_t get_tracer_time(void)
+    {
+        return tracerTime;
+    }
 };
 
 void getTransactionHash( string    &to,
@@ -18,6 +18,7 @@
 #include "sm/padding_pg/padding_pg_executor.hpp"
 #include "sm/mem_align/mem_align_executor.hpp"
 #include "sm/climb_key/climb_key_executor.hpp"
+#include "executor_stream.hpp"
 
 using namespace std;
 
@@ -45,6 +46,60 @@ public:
     vector<array<Goldilocks::Element, 17>> PoseidonGFromST; // The 17th fe is the permutation
     vector<ClimbKeyAction> ClimbKey; // The 17th fe is the permutation
     vector<MemAlignAction> MemAlign;
+
+    // If not NULL, the Binary, Arith and MemAlign actions are published to these streams while the main executor runs
+    MainExecStreams * pStreams;
+
+    MainExecRequired () : pStreams(NULL) {};
+
+    // Publishes the new streamed actions once they fill a chunk, or all of them if bFlush is set
+    void publish (bool bFlush)
+    {
+        if (pStreams == NULL)
+        {
+            return;
+        }
+        pStreams->Binary.publish(Binary, bFlush);
+        pStreams->Arith.publish(Arith, bFlush);
+        pStreams->MemAlign.publish(MemAlign, bFlush);
+    }
+};
+
+// Sizes reached by the required vectors, used to reserve them in advance in the next execution
+class MainExecRequiredSizes
+{
+public:
+    uint64_t Storage;
+    uint64_t Memory;
+    uint64_t Binary;
+    uint64_t Arith;
+    uint64_t PoseidonG;
+    uint64_t PaddingPG;
+    uint64_t MemAlign;
+
+    MainExecRequiredSizes () : Storage(0), Memory(0), Binary(0), Arith(0), PoseidonG(0), PaddingPG(0), MemAlign(0) {};
+
+    void record (const MainExecRequired &required)
+    {
+        Storage = required.Storage.size();
+        Memory = required.Memory.size();
+        Binary = required.Binary.size();
+        Arith = required.Arith.size();
+        PoseidonG = required.PoseidonG.size();
+        PaddingPG = required.PaddingPG.size();
+        MemAlign = required.MemAlign.size();
+    }
+
+    void reserve (MainExecRequired &required) const
+    {
+        required.Storage.reserve(Storage);
+        required.Memory.reserve(Memory);
+        required.Binary.reserve(Binary);
+        required.Arith.reserve(Arith);
+        required.PoseidonG.reserve(PoseidonG);
+        required.PaddingPG.reserve(PaddingPG);
+        required.MemAlign.reserve(MemAlign);
+    }
 };
 
 } // namespace
@@ -191,6 +191,13 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
     // Create context and store a finite field reference in it
     Context ctx(fr, config, fec, fnec, pols, rom, proverRequest, pHashDB);
 
+    // Reserve the required vectors with the sizes reached by the previous execution that used this arena
+    if (!bProcessBatch)
+    {
+        ctx.arena.pRequired = &required;
+        ctx.arena.requiredSizes.reserve(required);
+    }
+
     // Init the state of the polynomials first evaluation
     initState(ctx);
 
@@ -912,7 +919,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // Memory read free in: get fi=mem[addr], if it exists
                 if ( (rom.line[zkPC].mOp==1) && (rom.line[zkPC].mWR==0) )
                 {
-                    std::unordered_map<uint64_t, Fea>::iterator memIterator;
+                    MemMap::iterator memIterator;
                     memIterator = ctx.mem.find(addr);
                     if (memIterator != ctx.mem.end()) {
 #ifdef LOG_MEMORY
@@ -1443,7 +1450,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // HashK free in
                 if ( (rom.line[zkPC].hashK == 1) || (rom.line[zkPC].hashK1 == 1) )
                 {
-                    unordered_map< uint64_t, HashValue >::iterator hashKIterator;
+                    HashValueMap::iterator hashKIterator;
 
                     // If there is no entry in the hash database for this address, then create a new one
                     hashKIterator = ctx.hashK.find(addr);
@@ -1509,7 +1516,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // HashKDigest free in
                 if (rom.line[zkPC].hashKDigest == 1)
                 {
-                    unordered_map< uint64_t, HashValue >::iterator hashKIterator;
+                    HashValueMap::iterator hashKIterator;
 
                     // If there is no entry in the hash database for this address, this is an error
                     hashKIterator = ctx.hashK.find(addr);
@@ -1543,7 +1550,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // HashP free in
                 if ( (rom.line[zkPC].hashP == 1) || (rom.line[zkPC].hashP1 == 1) )
                 {
-                    unordered_map< uint64_t, HashValue >::iterator hashPIterator;
+                    HashValueMap::iterator hashPIterator;
 
                     // If there is no entry in the hash database for this address, then create a new one
                     hashPIterator = ctx.hashP.find(addr);
@@ -1605,7 +1612,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // HashPDigest free in
                 if (rom.line[zkPC].hashPDigest == 1)
                 {
-                    unordered_map< uint64_t, HashValue >::iterator hashPIterator;
+                    HashValueMap::iterator hashPIterator;
 
                     // If there is no entry in the hash database for this address, this is an error
                     hashPIterator = ctx.hashP.find(addr);
@@ -1635,7 +1642,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // HashS free in
                 if ( (rom.line[zkPC].hashS == 1) || (rom.line[zkPC].hashS1 == 1) )
                 {
-                    unordered_map< uint64_t, HashValue >::iterator hashSIterator;
+                    HashValueMap::iterator hashSIterator;
 
                     // If there is no entry in the hash database for this address, then create a new one
                     hashSIterator = ctx.hashS.find(addr);
@@ -1701,7 +1708,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // HashSDigest free in
                 if (rom.line[zkPC].hashSDigest == 1)
                 {
-                    unordered_map< uint64_t, HashValue >::iterator hashSIterator;
+                    HashValueMap::iterator hashSIterator;
 
                     // If there is no entry in the hash database for this address, this is an error
                     hashSIterator = ctx.hashS.find(addr);
@@ -2671,7 +2678,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 }
             }
 
-            unordered_map< uint64_t, HashValue >::iterator hashKIterator;
+            HashValueMap::iterator hashKIterator;
 
             // If there is no entry in the hash database for this address, then create a new one
             hashKIterator = ctx.hashK.find(addr);
@@ -2791,7 +2798,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         {
             if (!bProcessBatch) pols.hashKLen[i] = fr.one();
 
-            unordered_map< uint64_t, HashValue >::iterator hashKIterator;
+            HashValueMap::iterator hashKIterator;
 
             // Get the length
             uint64_t lm = fr.toU64(op0);
@@ -2864,7 +2871,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         {
             if (!bProcessBatch) pols.hashKDigest[i] = fr.one();
 
-            unordered_map< uint64_t, HashValue >::iterator hashKIterator;
+            HashValueMap::iterator hashKIterator;
 
             // Find the entry in the hash database for this address
             hashKIterator = ctx.hashK.find(addr);
@@ -2925,7 +2932,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 }
             }
 
-            unordered_map< uint64_t, HashValue >::iterator hashPIterator;
+            HashValueMap::iterator hashPIterator;
 
             // If there is no entry in the hash database for this address, then create a new one
             hashPIterator = ctx.hashP.find(addr);
@@ -3069,7 +3076,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         {
             if (!bProcessBatch) pols.hashPLen[i] = fr.one();
 
-            unordered_map< uint64_t, HashValue >::iterator hashPIterator;
+            HashValueMap::iterator hashPIterator;
 
             // Get the length
             uint64_t lm = fr.toU64(op0);
@@ -3173,7 +3180,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 return;
             }
 
-            unordered_map< uint64_t, HashValue >::iterator hashPIterator;
+            HashValueMap::iterator hashPIterator;
             hashPIterator = ctx.hashP.find(addr);
             if (hashPIterator == ctx.hashP.end())
             {
@@ -3243,7 +3250,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 }
             }
 
-            unordered_map< uint64_t, HashValue >::iterator hashSIterator;
+            HashValueMap::iterator hashSIterator;
 
             // If there is no entry in the hash database for this address, then create a new one
             hashSIterator = ctx.hashS.find(addr);
@@ -3363,7 +3370,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         {
             if (!bProcessBatch) pols.hashSLen[i] = fr.one();
 
-            unordered_map< uint64_t, HashValue >::iterator hashSIterator;
+            HashValueMap::iterator hashSIterator;
 
             // Get the length
             uint64_t lm = fr.toU64(op0);
@@ -3436,7 +3443,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         {
             if (!bProcessBatch) pols.hashSDigest[i] = fr.one();
 
-            unordered_map< uint64_t, HashValue >::iterator hashSIterator;
+            HashValueMap::iterator hashSIterator;
 
             // Find the entry in the hash database for this address
             hashSIterator = ctx.hashS.find(addr);
@@ -5369,6 +5376,12 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
             if (!bProcessBatch) i--;
         }
 
+        // Publish the new Binary, Arith and MemAlign actions to the secondary executors, if streaming
+        if (required.pStreams != NULL)
+        {
+            required.publish(false);
+        }
+
 #ifdef LOG_COMPLETED_STEPS
         zklog.info("<-- Completed step=" + to_string(step) +
             " zkPC=" + to_string(zkPC) +
@@ -5690,7 +5703,8 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         proverRequest.dbReadLog->print();
     }
 
-    zklog.info("MainExecutor::execute() done lastStep=" + to_string(ctx.lastStep) + " (" + to_string((double(ctx.lastStep)*100)/N) + "%)", &proverRequest.tags);
+    zklog.info("MainExecutor::execute() done lastStep=" + to_string(ctx.lastStep) + " (" + to_string((double(ctx.lastStep)*100)/N) + "%)" +
+        " arenaExecutions=" + to_string(ctx.arena.executions) + " arenaCapacity=" + to_string(ctx.arena.getCapacity()) + " arenaAllocations=" + to_string(ctx.arena.getAllocations()), &proverRequest.tags);
 
     TimerStopAndLog(MAIN_EXECUTOR_EXECUTE);
 }
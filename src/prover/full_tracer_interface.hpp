@@ -11,11 +11,16 @@ using namespace std;
 // for each batch and also a log is created for each transaction separatedly. The events are triggered from the zkrom and handled
 // from the zkprover
 
+// Only the per-opcode fields with a bytes type in the executor API are kept in binary (the opcode state root and
+// memory); the per-opcode contract addresses and storage are hex, which is what the string fields of the API carry,
+// and the per-transaction and per-log hashes, state roots and addresses stay in hex, since they are converted once
+// per transaction or log, and they are also used as hex by the trace configuration and the logs
+
 class OpcodeContract
 {
 public:
-    string address;
-    string caller;
+    string address; // Hex, without 0x, as returned by the API
+    string caller; // Hex, without 0x, as returned by the API
     mpz_class value;
     string data;
     uint64_t gas;
@@ -28,7 +33,7 @@ class Opcode
 public:
     uint64_t gas;
     int64_t gas_cost;
-    string state_root;
+    string state_root; // 32 bytes, binary
     uint64_t depth;
     uint64_t pc;
     uint8_t op;
@@ -37,7 +42,7 @@ public:
     string error;
     OpcodeContract contract;
     vector<mpz_class> stack;
-    string memory;
+    string memory; // Binary; the whole memory or its changes since the previous opcode
     uint64_t memory_size;
     uint64_t memory_offset;
     unordered_map<string,string> storage;
@@ -280,6 +285,10 @@ public:
     ReturnFromCreate() : enabled(false), originCTX(0), createCTX(0) {};
 };
 
+// Called by the full tracer every time a block is finished, e.g. to stream it to the client; once
+// it returns, the full tracer can release the transaction responses of the block
+typedef void (*FullTracerBlockFunction) (void * pArg, Block &block);
+
 class FullTracerInterface
 {
 public:
@@ -297,6 +306,7 @@ public:
     virtual uint64_t get_tx_number(void) = 0; // tx number = 0, 1, 2...
     virtual string & get_error(void) = 0;
     virtual bool get_invalid_batch(void) = 0;
+    virtual uint64_t get_tracer_time(void) { return 0; }; // Time spent by the tracer, in us, if measured
 };
 
 #endif
\ No newline at end of file
@@ -38,7 +38,10 @@ Prover::Prover(Goldilocks &fr,
                const Config &config) : fr(fr),
                                        poseidon(poseidon),
                                        executor(fr, config, poseidon),
+                                       pendingRequests(config),
+                                       executedRequests(config),
                                        pCurrentRequest(NULL),
+                                       pExecutingRequest(NULL),
                                        config(config),
                                        lastComputedRequestEndTime(0)
 {
@@ -49,6 +52,8 @@ Prover::Prover(Goldilocks &fr,
     {
         if (config.generateProof())
         {
+            FFT<AltBn128::Engine::Fr>::setBlockedDefault(config.blockedFFT);
+
             zkey = BinFileUtils::openExisting(config.finalStarkZkey, "zkey", 1);
             protocolId = Zkey::getProtocolIdFromZkey(zkey.get());
             if (Zkey::GROTH16_PROTOCOL_ID == protocolId)
@@ -81,10 +86,39 @@ Prover::Prover(Goldilocks &fr,
 
             lastComputedRequestEndTime = 0;
 
+            // Allocate as many committed pols staging buffers as fit in the pipeline memory budget;
+            // each of them allows to execute one batch ahead of the one being proved
+            if (config.proverPipelineMemory > 0)
+            {
+                uint64_t bufferSize = PROVER_FORK_NAMESPACE::CommitPols::pilSize();
+                pipelineBuffersNumber = (config.proverPipelineMemory * 1024 * 1024) / bufferSize;
+                if (pipelineBuffersNumber == 0)
+                {
+                    zklog.warning("Prover::Prover() config.proverPipelineMemory=" + to_string(config.proverPipelineMemory) + "MB is smaller than the committed pols size=" + to_string(bufferSize) + "B, so pipeline mode is disabled");
+                }
+                for (uint64_t i = 0; i < pipelineBuffersNumber; i++)
+                {
+                    void *pBuffer = malloc(bufferSize);
+                    if (pBuffer == NULL)
+                    {
+                        zklog.error("Prover::Prover() failed calling malloc() of size " + to_string(bufferSize) + " for pipeline buffer " + to_string(i));
+                        exitProcess();
+                    }
+                    pipelineBuffers.push_back(pBuffer);
+                }
+                zklog.info("Prover::Prover() pipeline mode enabled with " + to_string(pipelineBuffersNumber) + " staging buffers of " + to_string(bufferSize) + " bytes");
+            }
+
             sem_init(&pendingRequestSem, 0, 0);
+            sem_init(&executedRequestSem, 0, 0);
             pthread_mutex_init(&mutex, NULL);
             pCurrentRequest = NULL;
+            pExecutingRequest = NULL;
             pthread_create(&proverPthread, NULL, proverThread, this);
+            if (pipelineEnabled())
+            {
+                pthread_create(&executorPthread, NULL, executorStageThread, this);
+            }
             pthread_create(&cleanerPthread, NULL, cleanerThread, this);
 
             StarkInfo _starkInfo(config, config.zkevmStarkInfo);
@@ -120,7 +154,7 @@ Prover::Prover(Goldilocks &fr,
             StarkInfo _starkInfoRecursiveF(config, config.recursivefStarkInfo);
             pAddressStarksRecursiveF = (void *)malloc(_starkInfoRecursiveF.mapTotalN * sizeof(Goldilocks::Element));
 
-            starkZkevm = new Starks(config, {config.zkevmConstPols, config.mapConstPolsFile, config.zkevmConstantsTree, config.zkevmStarkInfo}, pAddress);
+            starkZkevm = new Starks(config, {config.zkevmConstPols, config.mapConstPolsFile, config.zkevmConstantsTree, config.zkevmStarkInfo, config.zkevmChelpers}, pAddress);
             starkZkevm->nrowsStepBatch = NROWS_STEPS_;
             starksC12a = new Starks(config, {config.c12aConstPols, config.mapConstPolsFile, config.c12aConstantsTree, config.c12aStarkInfo}, pAddress);
             starksRecursive1 = new Starks(config, {config.recursive1ConstPols, config.mapConstPolsFile, config.recursive1ConstantsTree, config.recursive1StarkInfo}, pAddress);
@@ -169,6 +203,13 @@ Prover::~Prover()
         }
         free(pAddressStarksRecursiveF);
 
+        // Free the committed pols staging buffers
+        for (uint64_t i = 0; i < pipelineBuffers.size(); i++)
+        {
+            free(pipelineBuffers[i]);
+        }
+        pipelineBuffers.clear();
+
         delete prover;
 
         delete starkZkevm;
@@ -186,34 +227,46 @@ void *proverThread(void *arg)
 
     zkassert(pProver->config.generateProof());
 
+    // In pipeline mode, the prover thread consumes the requests that have already been processed by the executor stage thread
+    bool bPipeline = pProver->pipelineEnabled();
+    sem_t *pRequestsSem = bPipeline ? &pProver->executedRequestSem : &pProver->pendingRequestSem;
+
     while (true)
     {
         pProver->lock();
 
-        // Wait for the pending request queue semaphore to be released, if there are no more pending requests
-        if (pProver->pendingRequests.size() == 0)
+        // Wait for the requests queue semaphore to be released, if there are no more requests
+        if ((bPipeline ? pProver->executedRequests.size() : pProver->pendingRequests.size()) == 0)
         {
             pProver->unlock();
-            sem_wait(&pProver->pendingRequestSem);
+            sem_wait(pRequestsSem);
+            pProver->lock();
         }
 
-        // Check that the pending requests queue is not empty
-        if (pProver->pendingRequests.size() == 0)
+        // Check that the requests queue is not empty
+        if ((bPipeline ? pProver->executedRequests.size() : pProver->pendingRequests.size()) == 0)
         {
             pProver->unlock();
-            zklog.info("proverThread() found pending requests queue empty, so ignoring");
+            zklog.info("proverThread() found requests queue empty, so ignoring");
             continue;
         }
 
-        // Extract the first pending request (first in, first out)
-        pProver->pCurrentRequest = pProver->pendingRequests[0];
-        pProver->pCurrentRequest->startTime = time(NULL);
-        pProver->pendingRequests.erase(pProver->pendingRequests.begin());
+        // Extract the next request, as selected by the scheduler of the executed requests in pipeline mode, or of the
+        // pending requests otherwise
+        pProver->pCurrentRequest = bPipeline ? pProver->executedRequests.pop() : pProver->pendingRequests.pop();
+        if (pProver->pCurrentRequest->startTime == 0)
+        {
+            pProver->pCurrentRequest->startTime = time(NULL);
+            pProver->stageMetrics.add("QUEUE", TimeDiff(pProver->pCurrentRequest->submitTime));
+        }
 
         zklog.info("proverThread() starting to process request with UUID: " + pProver->pCurrentRequest->uuid);
 
         pProver->unlock();
 
+        struct timeval proofStartTime;
+        gettimeofday(&proofStartTime, NULL);
+
         // Process the request
         switch (pProver->pCurrentRequest->type)
         {
@@ -234,9 +287,18 @@ void *proverThread(void *arg)
             exitProcess();
         }
 
-        // Move to completed requests
+        uint64_t proofTime = TimeDiff(proofStartTime);
+        pProver->stageMetrics.add("PROOF", proofTime);
+
+        // Move to completed requests; the service time of the pending requests includes the executor stage, if any,
+        // while the one of the executed requests is only what remains after it
         pProver->lock();
         ProverRequest *pProverRequest = pProver->pCurrentRequest;
+        pProver->pendingRequests.addServiceTime(pProverRequest->type, pProverRequest->executorTime + proofTime);
+        if (bPipeline)
+        {
+            pProver->executedRequests.addServiceTime(pProverRequest->type, proofTime);
+        }
         pProverRequest->endTime = time(NULL);
         pProver->lastComputedRequestId = pProverRequest->uuid;
         pProver->lastComputedRequestEndTime = pProverRequest->endTime;
@@ -246,6 +308,7 @@ void *proverThread(void *arg)
         pProver->unlock();
 
         zklog.info("proverThread() done processing request with UUID: " + pProverRequest->uuid);
+        pProver->stageMetrics.print("proverThread() stage metrics");
 
         // Release the prove request semaphore to notify any blocked waiting call
         pProverRequest->notifyCompleted();
@@ -254,6 +317,101 @@ void *proverThread(void *arg)
     return NULL;
 }
 
+void *executorStageThread(void *arg)
+{
+    Prover *pProver = (Prover *)arg;
+    zklog.info("executorStageThread() started");
+
+    zkassert(pProver->config.generateProof());
+    zkassert(pProver->pipelineEnabled());
+
+    while (true)
+    {
+        pProver->lock();
+
+        // Only batch proofs have an executor stage, so the rest of requests are forwarded to the prover thread as they
+        // arrive, without waiting for a staging buffer; the prover thread selects among them by priority and deadline
+        ProverRequest *pForwardedRequest;
+        while ((pForwardedRequest = pProver->pendingRequests.pop(false)) != NULL)
+        {
+            pProver->executedRequests.push(pForwardedRequest);
+            sem_post(&pProver->executedRequestSem);
+        }
+
+        // Admission control: select a batch only once a staging buffer is free, so that we never execute more batches
+        // ahead than fit in memory, and the scheduler selects among all the batches pending by then
+        void *pBuffer = NULL;
+        if (pProver->pendingRequests.size() > 0)
+        {
+            pBuffer = pProver->acquirePipelineBuffer();
+        }
+
+        // Wait for the pending request queue semaphore to be released, by a new request or a released staging buffer
+        if (pBuffer == NULL)
+        {
+            pProver->unlock();
+            sem_wait(&pProver->pendingRequestSem);
+            continue;
+        }
+
+        // Extract the next pending batch, as selected by the scheduler
+        ProverRequest *pProverRequest = pProver->pendingRequests.pop();
+        zkassert(pProverRequest->type == prt_genBatchProof);
+        pProverRequest->startTime = time(NULL);
+        pProver->pExecutingRequest = pProverRequest;
+
+        pProver->unlock();
+
+        pProver->stageMetrics.add("QUEUE", TimeDiff(pProverRequest->submitTime));
+
+        zklog.info("executorStageThread() starting to execute request with UUID: " + pProverRequest->uuid);
+
+        struct timeval executorStartTime;
+        gettimeofday(&executorStartTime, NULL);
+        pProver->executeBatchProof(pProverRequest, pBuffer);
+        pProverRequest->pCmPolsBuffer = pBuffer;
+        pProverRequest->executorTime = TimeDiff(executorStartTime);
+        pProver->stageMetrics.add("EXECUTOR", pProverRequest->executorTime);
+
+        zklog.info("executorStageThread() done executing request with UUID: " + pProverRequest->uuid);
+
+        // Move to executed requests, and notify the prover thread
+        pProver->lock();
+        pProver->executedRequests.push(pProverRequest);
+        pProver->pExecutingRequest = NULL;
+        sem_post(&pProver->executedRequestSem);
+        pProver->unlock();
+    }
+    zklog.info("executorStageThread() done");
+    return NULL;
+}
+
+void *Prover::acquirePipelineBuffer(void)
+{
+    zkassert(pipelineEnabled());
+
+    if (pipelineBuffers.size() == 0)
+    {
+        return NULL;
+    }
+    void *pBuffer = pipelineBuffers.back();
+    pipelineBuffers.pop_back();
+
+    return pBuffer;
+}
+
+void Prover::releasePipelineBuffer(void *pBuffer)
+{
+    zkassert(pipelineEnabled());
+    zkassert(pBuffer != NULL);
+
+    // Wake up the executor stage thread, in case a batch is waiting for a staging buffer
+    lock();
+    pipelineBuffers.push_back(pBuffer);
+    sem_post(&pendingRequestSem);
+    unlock();
+}
+
 void *cleanerThread(void *arg)
 {
     Prover *pProver = (Prover *)arg;
@@ -310,7 +468,8 @@ string Prover::submitRequest(ProverRequest *pProverRequest) // returns UUID for
     // Add the request to the pending requests queue, and release the semaphore to notify the prover thread
     lock();
     requestsMap[uuid] = pProverRequest;
-    pendingRequests.push_back(pProverRequest);
+    gettimeofday(&pProverRequest->submitTime, NULL);
+    pendingRequests.push(pProverRequest);
     sem_post(&pendingRequestSem);
     unlock();
 
@@ -389,23 +548,20 @@ void Prover::processBatch(ProverRequest *pProverRequest)
     //TimerStopAndLog(PROVER_PROCESS_BATCH);
 }
 
-void Prover::genBatchProof(ProverRequest *pProverRequest)
+void Prover::executeBatchProof(ProverRequest *pProverRequest, void *pCmPolsAddress)
 {
     zkassert(config.generateProof());
     zkassert(pProverRequest != NULL);
-
-    TimerStart(PROVER_BATCH_PROOF);
+    zkassert(pCmPolsAddress != NULL);
 
     printMemoryInfo(true);
     printProcessInfo(true);
 
-    zkassert(pProverRequest != NULL);
-
-    zklog.info("Prover::genBatchProof() timestamp: " + pProverRequest->timestamp);
-    zklog.info("Prover::genBatchProof() UUID: " + pProverRequest->uuid);
-    zklog.info("Prover::genBatchProof() input file: " + pProverRequest->inputFile());
-    // zklog.info("Prover::genBatchProof() public file: " + pProverRequest->publicsOutputFile());
-    // zklog.info("Prover::genBatchProof() proof file: " + pProverRequest->proofFile());
+    zklog.info("Prover::executeBatchProof() timestamp: " + pProverRequest->timestamp);
+    zklog.info("Prover::executeBatchProof() UUID: " + pProverRequest->uuid);
+    zklog.info("Prover::executeBatchProof() input file: " + pProverRequest->inputFile());
+    // zklog.info("Prover::executeBatchProof() public file: " + pProverRequest->publicsOutputFile());
+    // zklog.info("Prover::executeBatchProof() proof file: " + pProverRequest->proofFile());
 
     // Save input to <timestamp>.input.json, as provided by client
     if (config.saveInputToFile)
@@ -420,13 +576,19 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
     /************/
     TimerStart(EXECUTOR_EXECUTE_INITIALIZATION);
 
-    PROVER_FORK_NAMESPACE::CommitPols cmPols(pAddress, PROVER_FORK_NAMESPACE::CommitPols::pilDegree());
+    PROVER_FORK_NAMESPACE::CommitPols cmPols(pCmPolsAddress, PROVER_FORK_NAMESPACE::CommitPols::pilDegree());
     uint64_t num_threads = omp_get_max_threads();
-    uint64_t bytes_per_thread = cmPols.size() / num_threads;
+    uint64_t polsSize = cmPols.size();
+    uint64_t bytes_per_thread = (polsSize + num_threads - 1) / num_threads;
 #pragma omp parallel for num_threads(num_threads)
-    for (uint64_t i = 0; i < cmPols.size(); i += bytes_per_thread) // Each iteration processes 64 bytes at a time
+    for (uint64_t i = 0; i < num_threads; i++)
     {
-        memset((uint8_t *)pAddress + i, 0, bytes_per_thread);
+        // The buffer may be exactly pilSize() bytes, so the last chunk must not go past its end
+        uint64_t offset = i * bytes_per_thread;
+        if (offset < polsSize)
+        {
+            memset((uint8_t *)pCmPolsAddress + offset, 0, std::min(bytes_per_thread, polsSize - offset));
+        }
     }
 
     TimerStopAndLog(EXECUTOR_EXECUTE_INITIALIZATION);
@@ -437,12 +599,12 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
 
     uint64_t lastN = cmPols.pilDegree() - 1;
 
-    zklog.info("Prover::genBatchProof() called executor.execute() oldStateRoot=" + pProverRequest->input.publicInputsExtended.publicInputs.oldStateRoot.get_str(16) +
+    zklog.info("Prover::executeBatchProof() called executor.execute() oldStateRoot=" + pProverRequest->input.publicInputsExtended.publicInputs.oldStateRoot.get_str(16) +
         " newStateRoot=" + pProverRequest->pFullTracer->get_new_state_root() +
         " pols.B[0]=" + fea2string(fr, cmPols.Main.B0[0], cmPols.Main.B1[0], cmPols.Main.B2[0], cmPols.Main.B3[0], cmPols.Main.B4[0], cmPols.Main.B5[0], cmPols.Main.B6[0], cmPols.Main.B7[0]) +
         " pols.SR[lastN]=" + fea2string(fr, cmPols.Main.SR0[lastN], cmPols.Main.SR1[lastN], cmPols.Main.SR2[lastN], cmPols.Main.SR3[lastN], cmPols.Main.SR4[lastN], cmPols.Main.SR5[lastN], cmPols.Main.SR6[lastN], cmPols.Main.SR7[lastN]) +
         " lastN=" + to_string(lastN));
-    zklog.info("Prover::genBatchProof() called executor.execute() oldAccInputHash=" + pProverRequest->input.publicInputsExtended.publicInputs.oldAccInputHash.get_str(16) +
+    zklog.info("Prover::executeBatchProof() called executor.execute() oldAccInputHash=" + pProverRequest->input.publicInputsExtended.publicInputs.oldAccInputHash.get_str(16) +
         " newAccInputHash=" + pProverRequest->pFullTracer->get_new_acc_input_hash() +
         " pols.C[0]=" + fea2string(fr, cmPols.Main.C0[0], cmPols.Main.C1[0], cmPols.Main.C2[0], cmPols.Main.C3[0], cmPols.Main.C4[0], cmPols.Main.C5[0], cmPols.Main.C6[0], cmPols.Main.C7[0]) +
         " pols.D[lastN]=" + fea2string(fr, cmPols.Main.D0[lastN], cmPols.Main.D1[lastN], cmPols.Main.D2[lastN], cmPols.Main.D3[lastN], cmPols.Main.D4[lastN], cmPols.Main.D5[lastN], cmPols.Main.D6[lastN], cmPols.Main.D7[lastN]) +
@@ -455,6 +617,45 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         memcpy(pointerCmPols, cmPols.address(), cmPols.size());
         unmapFile(pointerCmPols, cmPols.size());
     }
+}
+
+void Prover::genBatchProof(ProverRequest *pProverRequest)
+{
+    zkassert(config.generateProof());
+    zkassert(pProverRequest != NULL);
+
+    TimerStart(PROVER_BATCH_PROOF);
+
+    if (pProverRequest->pCmPolsBuffer == NULL)
+    {
+        // Serial mode: execute the batch directly into the committed pols area of the prover
+        executeBatchProof(pProverRequest, pAddress);
+    }
+    else
+    {
+        // Pipeline mode: the executor stage thread already filled a staging buffer, so copy it
+        // and release the buffer as soon as possible, so that the next batch can be executed
+        TimerStart(PROVER_BATCH_PROOF_COPY_COMMIT_POLS);
+        uint64_t polsSize = PROVER_FORK_NAMESPACE::CommitPols::pilSize();
+        uint64_t num_threads = omp_get_max_threads();
+        uint64_t bytes_per_thread = (polsSize + num_threads - 1) / num_threads;
+        uint8_t *pSource = (uint8_t *)pProverRequest->pCmPolsBuffer;
+#pragma omp parallel for num_threads(num_threads)
+        for (uint64_t i = 0; i < num_threads; i++)
+        {
+            uint64_t offset = i * bytes_per_thread;
+            if (offset < polsSize)
+            {
+                memcpy((uint8_t *)pAddress + offset, pSource + offset, std::min(bytes_per_thread, polsSize - offset));
+            }
+        }
+        releasePipelineBuffer(pProverRequest->pCmPolsBuffer);
+        pProverRequest->pCmPolsBuffer = NULL;
+        TimerStopAndLog(PROVER_BATCH_PROOF_COPY_COMMIT_POLS);
+    }
+
+    PROVER_FORK_NAMESPACE::CommitPols cmPols(pAddress, PROVER_FORK_NAMESPACE::CommitPols::pilDegree());
+    uint64_t lastN = cmPols.pilDegree() - 1;
 
     if (pProverRequest->result == ZKR_SUCCESS)
     {
@@ -578,15 +779,17 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
 
         TimerStopAndLog(STARK_PROOF_BATCH_PROOF);
         TimerStart(STARK_GEN_AND_CALC_WITNESS_C12A);
-        TimerStart(STARK_JSON_GENERATION_BATCH_PROOF);
+        TimerStart(STARK_ZKIN_GENERATION_BATCH_PROOF);
 
-        nlohmann::ordered_json jProof = fproof.proofs.proof2json();
-        nlohmann::json zkin = proof2zkinStark(jProof);
-        // Generate publics
-        jProof["publics"] = publicStarkJson;
-        zkin["publics"] = publicStarkJson;
+        Zkin zkin;
+        proof2zkinStark(fproof, zkin);
+        ZkinSignal &publicsZkevm = zkin.addSignal("publics");
+        for (uint64_t i = 0; i < starkZkevm->starkInfo.nPublics; i++)
+        {
+            publicsZkevm.add(publics[i]);
+        }
 
-        TimerStopAndLog(STARK_JSON_GENERATION_BATCH_PROOF);
+        TimerStopAndLog(STARK_ZKIN_GENERATION_BATCH_PROOF);
 
         CommitPolsStarks cmPols12a(pAddress, (1 << starksC12a->starkInfo.starkStruct.nBits), starksC12a->starkInfo.nCm1);
 
@@ -610,21 +813,23 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         starksC12a->genProof(fproofC12a, publics, c12aVerkey, &c12aSteps);
 
         TimerStopAndLog(STARK_C12_A_PROOF_BATCH_PROOF);
-        TimerStart(STARK_JSON_GENERATION_BATCH_PROOF_C12A);
+        TimerStart(STARK_ZKIN_GENERATION_BATCH_PROOF_C12A);
 
-        // Save the proof & zkinproof
-        nlohmann::ordered_json jProofc12a = fproofC12a.proofs.proof2json();
-        nlohmann::json zkinC12a = proof2zkinStark(jProofc12a);
+        Zkin zkinC12a;
+        proof2zkinStark(fproofC12a, zkinC12a);
+        ZkinSignal &publicsC12a = zkinC12a.addSignal("publics");
+        for (uint64_t i = 0; i < starkZkevm->starkInfo.nPublics; i++)
+        {
+            publicsC12a.add(publics[i]);
+        }
 
         // Add the recursive2 verification key
-        json rootC;
-        rootC[0] = to_string(recursive2Verkey["constRoot"][0]);
-        rootC[1] = to_string(recursive2Verkey["constRoot"][1]);
-        rootC[2] = to_string(recursive2Verkey["constRoot"][2]);
-        rootC[3] = to_string(recursive2Verkey["constRoot"][3]);
-        zkinC12a["publics"] = publicStarkJson;
-        zkinC12a["rootC"] = rootC;
-        TimerStopAndLog(STARK_JSON_GENERATION_BATCH_PROOF_C12A);
+        ZkinSignal &rootC = zkinC12a.addSignal("rootC");
+        for (uint64_t i = 0; i < 4; i++)
+        {
+            rootC.add(Goldilocks::fromU64(recursive2Verkey["constRoot"][i]));
+        }
+        TimerStopAndLog(STARK_ZKIN_GENERATION_BATCH_PROOF_C12A);
 
         CommitPolsStarks cmPolsRecursive1(pAddress, (1 << starksRecursive1->starkInfo.starkStruct.nBits), starksRecursive1->starkInfo.nCm1);
         CircomRecursive1::getCommitedPols(&cmPolsRecursive1, config.recursive1Verifier, config.recursive1Exec, zkinC12a, (1 << starksRecursive1->starkInfo.starkStruct.nBits), starksRecursive1->starkInfo.nCm1);
@@ -843,7 +1048,6 @@ void Prover::genFinalProof(ProverRequest *pProverRequest)
 
     // Input is pProverRequest->finalProofInput (of type json)
     std::string strAddress = mpz_get_str(0, 16, pProverRequest->input.publicInputsExtended.publicInputs.aggregatorAddress.get_mpz_t());
-    std::string strAddress10 = mpz_get_str(0, 10, pProverRequest->input.publicInputsExtended.publicInputs.aggregatorAddress.get_mpz_t());
 
     json zkinFinal = pProverRequest->finalProofInput;
 
@@ -871,19 +1075,27 @@ void Prover::genFinalProof(ProverRequest *pProverRequest)
     starksRecursiveF->genProof(fproofRecursiveF, publics);
     TimerStopAndLog(STARK_RECURSIVE_F_PROOF_BATCH_PROOF);
 
-    // Save the proof & zkinproof
-    nlohmann::ordered_json jProofRecursiveF = fproofRecursiveF.proofs.proof2json();
-    json zkinRecursiveF = proof2zkinStark(jProofRecursiveF);
-    zkinRecursiveF["publics"] = zkinFinal["publics"];
-    zkinRecursiveF["aggregatorAddr"] = strAddress10;
+    TimerStart(STARK_ZKIN_GENERATION_FINAL_PROOF);
+    Zkin zkinRecursiveF;
+    proof2zkinStark(fproofRecursiveF, zkinRecursiveF);
+    ZkinSignal &publicsRecursiveF = zkinRecursiveF.addSignal("publics");
+    for (uint64_t i = 0; i < starksRecursiveF->starkInfo.nPublics; i++)
+    {
+        publicsRecursiveF.add(publics[i]);
+    }
+    zkinRecursiveF.addSignal("aggregatorAddr", 4).add(pProverRequest->input.publicInputsExtended.publicInputs.aggregatorAddress.get_mpz_t());
+    TimerStopAndLog(STARK_ZKIN_GENERATION_FINAL_PROOF);
 
-    // Save proof to file
+    // Save proof to file; the proof JSON is only generated for it
     if (config.saveProofToFile)
     {
-        json2file(zkinRecursiveF["publics"], pProverRequest->filePrefix + "publics.json");
+        TimerStart(STARK_JSON_GENERATION_FINAL_PROOF);
+        json2file(zkinFinal["publics"], pProverRequest->filePrefix + "publics.json");
 
-        jProofRecursiveF["publics"] = zkinRecursiveF["publics"];
+        nlohmann::ordered_json jProofRecursiveF = fproofRecursiveF.proofs.proof2json();
+        jProofRecursiveF["publics"] = zkinFinal["publics"];
         json2file(jProofRecursiveF, pProverRequest->filePrefix + "recursivef.proof.json");
+        TimerStopAndLog(STARK_JSON_GENERATION_FINAL_PROOF);
     }
 
     //  ----------------------------------------------
@@ -894,16 +1106,16 @@ void Prover::genFinalProof(ProverRequest *pProverRequest)
     CircomFinal::Circom_Circuit *circuitFinal = CircomFinal::loadCircuit(config.finalVerifier);
     TimerStopAndLog(CIRCOM_LOAD_CIRCUIT_FINAL);
 
-    TimerStart(CIRCOM_FINAL_LOAD_JSON);
+    TimerStart(CIRCOM_FINAL_LOAD_ZKIN);
     CircomFinal::Circom_CalcWit *ctxFinal = new CircomFinal::Circom_CalcWit(circuitFinal);
 
-    CircomFinal::loadJsonImpl(ctxFinal, zkinRecursiveF);
+    CircomFinal::loadZkin(ctxFinal, zkinRecursiveF);
     if (ctxFinal->getRemaingInputsToBeSet() != 0)
     {
         zklog.error("Prover::genProof() Not all inputs have been set. Only " + to_string(CircomFinal::get_main_input_signal_no() - ctxFinal->getRemaingInputsToBeSet()) + " out of " + to_string(CircomFinal::get_main_input_signal_no()));
         exitProcess();
     }
-    TimerStopAndLog(CIRCOM_FINAL_LOAD_JSON);
+    TimerStopAndLog(CIRCOM_FINAL_LOAD_ZKIN);
 
     TimerStart(CIRCOM_GET_BIN_WITNESS_FINAL);
     AltBn128::FrElement *pWitnessFinal = NULL;
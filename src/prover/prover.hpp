@@ -13,6 +13,7 @@
 #include "binfile_utils.hpp"
 #include "zkey_utils.hpp"
 #include "prover_request.hpp"
+#include "prover_request_queue.hpp"
 #include "poseidon_goldilocks.hpp"
 #include "executor/executor.hpp"
 #include "sm/pols_generated/constant_pols.hpp"
@@ -23,6 +24,8 @@
 #include "starks.hpp"
 #include "constant_pols_starks.hpp"
 #include "fflonk_prover.hpp"
+#include "time_metric.hpp"
+
 class Prover
 {
     Goldilocks &fr;
@@ -45,20 +48,28 @@ class Prover
 public:
     unordered_map<string, ProverRequest *> requestsMap; // Map uuid -> ProveRequest pointer
 
-    vector<ProverRequest *> pendingRequests;   // Queue of pending requests
+    ProverRequestQueue pendingRequests;        // Queue of pending requests, sorted by priority and deadline
     ProverRequest *pCurrentRequest;            // Request currently being processed by the prover thread in server mode
+    ProverRequest *pExecutingRequest;          // Request currently being processed by the executor stage thread in pipeline mode
+    ProverRequestQueue executedRequests;       // Queue of requests already executed, waiting for the prover thread in pipeline mode, sorted as the pending ones
     vector<ProverRequest *> completedRequests; // Map uuid -> ProveRequest pointer
 
+    TimeMetricStorage stageMetrics; // Accumulated latency of every request processing stage
+
 private:
-    pthread_t proverPthread;  // Prover thread
-    pthread_t cleanerPthread; // Garbage collector
-    pthread_mutex_t mutex;    // Mutex to protect the requests queues
+    pthread_t proverPthread;   // Prover thread
+    pthread_t executorPthread; // Executor stage thread, only in pipeline mode
+    pthread_t cleanerPthread;  // Garbage collector
+    pthread_mutex_t mutex;     // Mutex to protect the requests queues
     void *pAddress = NULL;
+    vector<void *> pipelineBuffers; // Free committed pols staging buffers, only in pipeline mode
+    uint64_t pipelineBuffersNumber = 0; // Total number of committed pols staging buffers; if 0, pipeline mode is disabled
     void *pAddressStarksRecursiveF = NULL;
     int protocolId;
 public:
     const Config &config;
-    sem_t pendingRequestSem; // Semaphore to wakeup prover thread when a new request is available
+    sem_t pendingRequestSem; // Semaphore to wakeup prover thread when a new request is available; in pipeline mode, it wakes up the executor stage thread, also when a staging buffer is released
+    sem_t executedRequestSem; // Semaphore to wakeup prover thread when a new executed request is available, in pipeline mode
     string lastComputedRequestId;
     uint64_t lastComputedRequestEndTime;
 
@@ -68,6 +79,7 @@ public:
 
     ~Prover();
 
+    void executeBatchProof(ProverRequest *pProverRequest, void *pCmPolsAddress);
     void genBatchProof(ProverRequest *pProverRequest);
     void genAggregatedProof(ProverRequest *pProverRequest);
     void genFinalProof(ProverRequest *pProverRequest);
@@ -77,11 +89,16 @@ public:
     string submitRequest(ProverRequest *pProverRequest);                                          // returns UUID for this request
     ProverRequest *waitForRequestToComplete(const string &uuid, const uint64_t timeoutInSeconds); // wait for the request with this UUID to complete; returns NULL if UUID is invalid
 
+    bool pipelineEnabled(void) { return pipelineBuffersNumber > 0; };
+    void *acquirePipelineBuffer(void); // Must be called with the prover locked; returns NULL if all the staging buffers are in use
+    void releasePipelineBuffer(void *pBuffer);
+
     void lock(void) { pthread_mutex_lock(&mutex); };
     void unlock(void) { pthread_mutex_unlock(&mutex); };
 };
 
 void *proverThread(void *arg);
+void *executorStageThread(void *arg);
 void *cleanerThread(void *arg);
 
 #endif
\ No newline at end of file
@@ -17,17 +17,23 @@ ProverRequest::ProverRequest (Goldilocks &fr, const Config &config, tProverReque
     config(config),
     startTime(0),
     endTime(0),
+    deadline(0),
     type(type),
     input(fr),
     flushId(0),
     lastSentFlushId(0),
+    pCmPolsBuffer(NULL),
+    executorTime(0),
     dbReadLog(NULL),
     pFullTracer(NULL),
+    pBlockStreamFunction(NULL),
+    pBlockStreamArg(NULL),
     bCompleted(false),
     bCancelling(false),
     result(ZKR_UNSPECIFIED)
 {
     sem_init(&completedSem, 0, 0);
+    gettimeofday(&submitTime, NULL);
     
     uuid = getUUID();
 
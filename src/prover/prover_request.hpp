@@ -2,6 +2,7 @@
 #define PROVER_REQUEST_HPP
 
 #include <semaphore.h>
+#include <sys/time.h>
 #include <unordered_set>
 #include "input.hpp"
 #include "proof_fflonk.hpp"
@@ -29,6 +30,8 @@ public:
     string timestamp; // Timestamp, when requested, used as a prefix in the output files
     time_t startTime; // Time when the request started being processed
     time_t endTime; // Time when the request ended
+    struct timeval submitTime; // Time when the request was submitted to the prover, used to measure queue latency
+    time_t deadline; // Time by which the request should be completed, as provided by the aggregator; 0 if none
 
     /* Output files prefix */
     string filePrefix;
@@ -57,11 +60,17 @@ public:
     /* genProof and genFinalProof output */
     Proof proof;
 
+    /* Committed pols staging buffer filled by the executor stage in pipeline mode; NULL if the executor has not run yet */
+    void * pCmPolsBuffer;
+    uint64_t executorTime; // Time spent by the executor stage in pipeline mode, in us
+
     /* Execution generated data */
     Counters counters; // Counters of the batch execution
     Counters counters_reserve; // Counters reserve of the batch execution
     DatabaseMap *dbReadLog; // Database reads logs done during the execution (if enabled)
     FullTracerInterface * pFullTracer; // Execution traces interface
+    FullTracerBlockFunction pBlockStreamFunction; // If not NULL, called by the full tracer every time a block is finished
+    void * pBlockStreamArg; // Argument of pBlockStreamFunction
 
     /* State */
     bool bCompleted;
@@ -0,0 +1,141 @@
+#include "prover_request_queue.hpp"
+#include "timer.hpp"
+#include "zklog.hpp"
+#include "zkassert.hpp"
+
+uint64_t ProverRequestQueue::getPriority (tProverRequestType type)
+{
+    switch (type)
+    {
+        case prt_genBatchProof:      return config.proverPriorityBatchProof;
+        case prt_genAggregatedProof: return config.proverPriorityAggregatedProof;
+        case prt_genFinalProof:      return config.proverPriorityFinalProof;
+        default:                     return 0;
+    }
+}
+
+bool ProverRequestQueue::isUrgent (ProverRequest *pProverRequest, const struct timeval &now)
+{
+    if (pProverRequest->deadline == 0)
+    {
+        return false;
+    }
+
+    // A request is urgent if, started now, it would not complete before its deadline
+    uint64_t estimatedEndTime = now.tv_sec + stats[pProverRequest->type].averageServiceTime()/1000000;
+    return estimatedEndTime >= (uint64_t)pProverRequest->deadline;
+}
+
+double ProverRequestQueue::getEffectivePriority (ProverRequest *pProverRequest, const struct timeval &now)
+{
+    double priority = getPriority(pProverRequest->type);
+
+    // Aging: every aging period waited increases the priority by one level, so that low priority requests do not starve
+    if (config.proverRequestAgingPeriod > 0)
+    {
+        priority += double(TimeDiff(pProverRequest->submitTime, now)) / (double(config.proverRequestAgingPeriod) * 1000000);
+    }
+
+    return priority;
+}
+
+void ProverRequestQueue::push (ProverRequest *pProverRequest)
+{
+    zkassert(pProverRequest != NULL);
+    requests.push_back(pProverRequest);
+}
+
+ProverRequest * ProverRequestQueue::pop (bool bBatchProofs)
+{
+    struct timeval now;
+    gettimeofday(&now, NULL);
+
+    // Select the best candidate; since we iterate in arrival order and only replace on strictly better candidates, ties are FIFO
+    uint64_t best = requests.size();
+    bool bestUrgent = false;
+    double bestPriority = 0;
+    for (uint64_t i = 0; i < requests.size(); i++)
+    {
+        ProverRequest *pProverRequest = requests[i];
+        if (!bBatchProofs && (pProverRequest->type == prt_genBatchProof))
+        {
+            continue;
+        }
+        bool urgent = isUrgent(pProverRequest, now);
+        double priority = getEffectivePriority(pProverRequest, now);
+        bool better;
+        if (best == requests.size())
+        {
+            better = true;
+        }
+        else if (urgent != bestUrgent)
+        {
+            better = urgent;
+        }
+        else if (urgent)
+        {
+            better = pProverRequest->deadline < requests[best]->deadline;
+        }
+        else
+        {
+            better = priority > bestPriority;
+        }
+        if (better)
+        {
+            best = i;
+            bestUrgent = urgent;
+            bestPriority = priority;
+        }
+    }
+
+    if (best == requests.size())
+    {
+        return NULL;
+    }
+    ProverRequest *pProverRequest = requests[best];
+    requests.erase(requests.begin() + best);
+
+    // Update the wait time statistics
+    ProverRequestQueueStats &typeStats = stats[pProverRequest->type];
+    typeStats.extracted++;
+    typeStats.totalWaitTime += TimeDiff(pProverRequest->submitTime, now);
+
+    if (bestUrgent || (best != 0))
+    {
+        zklog.info("ProverRequestQueue::pop() selected request with UUID: " + pProverRequest->uuid + " type=" + proverRequestType2string(pProverRequest->type) + " urgent=" + to_string(bestUrgent) + " effectivePriority=" + to_string(bestPriority) + " position=" + to_string(best) + " of " + to_string(requests.size() + 1));
+    }
+
+    return pProverRequest;
+}
+
+void ProverRequestQueue::addServiceTime (tProverRequestType type, uint64_t serviceTime)
+{
+    ProverRequestQueueStats &typeStats = stats[type];
+    typeStats.serviced++;
+    typeStats.totalServiceTime += serviceTime;
+}
+
+void ProverRequestQueue::getStats (map<tProverRequestType, ProverRequestQueueStats> &queueStats)
+{
+    struct timeval now;
+    gettimeofday(&now, NULL);
+
+    // Copy the accumulated statistics, and calculate the current queue depth and oldest wait time of every type
+    queueStats = stats;
+    map<tProverRequestType, ProverRequestQueueStats>::iterator it;
+    for (it = queueStats.begin(); it != queueStats.end(); it++)
+    {
+        it->second.depth = 0;
+        it->second.oldestWaitTime = 0;
+    }
+    for (uint64_t i = 0; i < requests.size(); i++)
+    {
+        ProverRequestQueueStats &typeStats = queueStats[requests[i]->type];
+        typeStats.depth++;
+        uint64_t waitTime = TimeDiff(requests[i]->submitTime, now);
+        if (waitTime > typeStats.oldestWaitTime)
+        {
+            typeStats.oldestWaitTime = waitTime;
+        }
+    }
+}
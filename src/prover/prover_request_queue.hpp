@@ -0,0 +1,61 @@
+#ifndef PROVER_REQUEST_QUEUE_HPP
+#define PROVER_REQUEST_QUEUE_HPP
+
+#include <vector>
+#include <map>
+#include "config.hpp"
+#include "prover_request.hpp"
+#include "prover_request_type.hpp"
+
+using namespace std;
+
+// Statistics of the prover requests of one type
+class ProverRequestQueueStats
+{
+public:
+    uint64_t depth; // Number of requests currently waiting in the queue
+    uint64_t oldestWaitTime; // Time that the oldest request currently in the queue has been waiting, in us
+    uint64_t extracted; // Number of requests extracted from the queue so far
+    uint64_t totalWaitTime; // Accumulated wait time of the extracted requests, in us
+    uint64_t serviced; // Number of requests processed so far
+    uint64_t totalServiceTime; // Accumulated processing time of the processed requests, in us
+
+    ProverRequestQueueStats() : depth(0), oldestWaitTime(0), extracted(0), totalWaitTime(0), serviced(0), totalServiceTime(0) {};
+
+    uint64_t averageWaitTime (void) const { return extracted == 0 ? 0 : totalWaitTime / extracted; };
+    uint64_t averageServiceTime (void) const { return serviced == 0 ? 0 : totalServiceTime / serviced; };
+};
+
+/*
+    Scheduler of the pending prover requests.
+    The next request to process is selected as follows:
+    1. Requests at risk of missing their deadline, i.e. now + average service time of their type >= deadline, go first,
+       earliest deadline first
+    2. Otherwise, the request with the highest effective priority goes first, where
+       effective priority = configured priority of its type + waited time / aging period
+    3. Ties are resolved in arrival order, i.e. first in, first out
+    This class is not thread-safe; the Prover protects it with its own mutex.
+*/
+class ProverRequestQueue
+{
+private:
+    const Config &config;
+    vector<ProverRequest *> requests; // Pending requests, in arrival order
+    map<tProverRequestType, ProverRequestQueueStats> stats; // Per type statistics
+
+    uint64_t getPriority (tProverRequestType type);
+    bool isUrgent (ProverRequest *pProverRequest, const struct timeval &now);
+    double getEffectivePriority (ProverRequest *pProverRequest, const struct timeval &now);
+
+public:
+    ProverRequestQueue (const Config &config) : config(config) {};
+
+    void push (ProverRequest *pProverRequest);
+    ProverRequest * pop (bool bBatchProofs = true); // If bBatchProofs is false, batch proofs are not selected; returns NULL if there is no candidate
+    uint64_t size (void) { return requests.size(); };
+    ProverRequest * at (uint64_t i) { return requests[i]; }; // In arrival order
+    void addServiceTime (tProverRequestType type, uint64_t serviceTime);
+    void getStats (map<tProverRequestType, ProverRequestQueueStats> &queueStats);
+};
+
+#endif
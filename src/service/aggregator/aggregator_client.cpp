@@ -6,6 +6,7 @@
 #include "zklog.hpp"
 #include "witness.hpp"
 #include "data_stream.hpp"
+#include "zkmax.hpp"
 
 using namespace std;
 using json = nlohmann::json;
@@ -46,7 +47,7 @@ bool AggregatorClient::GetStatus (::aggregator::v1::GetStatusResponse &getStatus
     getStatusResponse.set_last_computed_end_time(prover.lastComputedRequestEndTime);
 
     // If computing, set the current request data
-    if ((prover.pCurrentRequest != NULL) || (prover.pendingRequests.size() > 0))
+    if ((prover.pCurrentRequest != NULL) || (prover.pExecutingRequest != NULL) || (prover.pendingRequests.size() > 0) || (prover.executedRequests.size() > 0))
     {
         getStatusResponse.set_status(aggregator::v1::GetStatusResponse_Status_STATUS_COMPUTING);
         if (prover.pCurrentRequest != NULL)
@@ -54,6 +55,11 @@ bool AggregatorClient::GetStatus (::aggregator::v1::GetStatusResponse &getStatus
             getStatusResponse.set_current_computing_request_id(prover.pCurrentRequest->uuid);
             getStatusResponse.set_current_computing_start_time(prover.pCurrentRequest->startTime);
         }
+        else if (prover.pExecutingRequest != NULL)
+        {
+            getStatusResponse.set_current_computing_request_id(prover.pExecutingRequest->uuid);
+            getStatusResponse.set_current_computing_start_time(prover.pExecutingRequest->startTime);
+        }
         else
         {
             getStatusResponse.set_current_computing_request_id("");
@@ -71,10 +77,36 @@ bool AggregatorClient::GetStatus (::aggregator::v1::GetStatusResponse &getStatus
     getStatusResponse.set_version_proto("v0_0_1");
     getStatusResponse.set_version_server("0.0.1");
 
-    // Set the list of pending requests uuids
+    // Set the list of pending requests uuids, including the ones already executed in pipeline mode
+    for (uint64_t i=0; i<prover.executedRequests.size(); i++)
+    {
+        getStatusResponse.add_pending_request_queue_ids(prover.executedRequests.at(i)->uuid);
+    }
     for (uint64_t i=0; i<prover.pendingRequests.size(); i++)
     {
-        getStatusResponse.add_pending_request_queue_ids(prover.pendingRequests[i]->uuid);
+        getStatusResponse.add_pending_request_queue_ids(prover.pendingRequests.at(i)->uuid);
+    }
+
+    // Set the pending requests queue status, per request type, counting the ones already executed in pipeline mode
+    map<tProverRequestType, ProverRequestQueueStats> queueStats;
+    prover.pendingRequests.getStats(queueStats);
+    map<tProverRequestType, ProverRequestQueueStats> executedQueueStats;
+    prover.executedRequests.getStats(executedQueueStats);
+    map<tProverRequestType, ProverRequestQueueStats>::const_iterator it;
+    for (it = executedQueueStats.begin(); it != executedQueueStats.end(); it++)
+    {
+        ProverRequestQueueStats &typeStats = queueStats[it->first];
+        typeStats.depth += it->second.depth;
+        typeStats.oldestWaitTime = zkmax(typeStats.oldestWaitTime, it->second.oldestWaitTime);
+    }
+    for (it = queueStats.begin(); it != queueStats.end(); it++)
+    {
+        aggregator::v1::RequestQueueStatus * pRequestQueueStatus = getStatusResponse.add_request_queue_status();
+        pRequestQueueStatus->set_request_type(proverRequestType2string(it->first));
+        pRequestQueueStatus->set_depth(it->second.depth);
+        pRequestQueueStatus->set_oldest_wait_time(it->second.oldestWaitTime/1000);
+        pRequestQueueStatus->set_average_wait_time(it->second.averageWaitTime()/1000);
+        pRequestQueueStatus->set_average_service_time(it->second.averageServiceTime()/1000);
     }
 
     // Unlock the prover
@@ -128,6 +160,9 @@ bool AggregatorClient::GenBatchProof (const aggregator::v1::GenBatchProofRequest
     }
     ba2scalar(pProverRequest->input.publicInputsExtended.publicInputs.oldStateRoot, genBatchProofRequest.input().public_inputs().old_state_root());
 
+    // Get the deadline, if any
+    pProverRequest->deadline = genBatchProofRequest.deadline();
+
     // Get oldAccInputHash
     if (genBatchProofRequest.input().public_inputs().old_acc_input_hash().size() > 32)
     {
@@ -389,6 +424,9 @@ bool AggregatorClient::GenStatelessBatchProof (const aggregator::v1::GenStateles
     zklog.info("AggregatorClient::GenStatelessBatchProof() created a new prover request: " + to_string((uint64_t)pProverRequest));
 #endif
 
+    // Get the deadline, if any
+    pProverRequest->deadline = genStatelessBatchProofRequest.deadline();
+
     // Parse public inputs
     
     // Get witness
@@ -642,6 +680,9 @@ bool AggregatorClient::GenAggregatedProof (const aggregator::v1::GenAggregatedPr
     pProverRequest->aggregatedProofInput1 = json::parse(genAggregatedProofRequest.recursive_proof_1());
     pProverRequest->aggregatedProofInput2 = json::parse(genAggregatedProofRequest.recursive_proof_2());
 
+    // Set the deadline, if any
+    pProverRequest->deadline = genAggregatedProofRequest.deadline();
+
     // Submit the prover request
     string uuid = prover.submitRequest(pProverRequest);
 
@@ -673,6 +714,9 @@ bool AggregatorClient::GenFinalProof (const aggregator::v1::GenFinalProofRequest
     // Set the input
     pProverRequest->finalProofInput = json::parse(genFinalProofRequest.recursive_proof());
 
+    // Set the deadline, if any
+    pProverRequest->deadline = genFinalProofRequest.deadline();
+
     // Set the aggregator address
     string auxString = Remove0xIfPresent(genFinalProofRequest.aggregator_addr());
     if (auxString.size() > 40)
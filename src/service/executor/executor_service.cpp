@@ -573,7 +573,7 @@ using grpc::Status;
             for (uint64_t step=0; step<responses[tx].full_trace.steps.size(); step++)
             {
                 executor::v1::TransactionStep * pTransactionStep = pFullTrace->add_steps();
-                pTransactionStep->set_state_root(string2ba(responses[tx].full_trace.steps[step].state_root));
+                pTransactionStep->set_state_root(responses[tx].full_trace.steps[step].state_root);
                 pTransactionStep->set_depth(responses[tx].full_trace.steps[step].depth); // Call depth
                 pTransactionStep->set_pc(responses[tx].full_trace.steps[step].pc); // Program counter
                 pTransactionStep->set_gas(responses[tx].full_trace.steps[step].gas); // Remaining gas
@@ -760,6 +760,236 @@ using grpc::Status;
 
 
 ::grpc::Status ExecutorServiceImpl::ProcessBatchV2 (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response)
+{
+    return processBatchV2(context, request, response, NULL);
+}
+
+::grpc::Status ExecutorServiceImpl::ProcessBatchV2Stream (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse>* writer)
+{
+    // Blocks are written by processBatchV2() as they are finished; the batch response is written last
+    ::executor::v1::ProcessBatchV2StreamResponse message;
+    ::grpc::Status status = processBatchV2(context, request, message.mutable_batch_response(), writer);
+    if (!status.ok())
+    {
+        return status;
+    }
+    if (!writer->Write(message))
+    {
+        zklog.error("ExecutorServiceImpl::ProcessBatchV2Stream() failed writing the batch response; the client is gone");
+        return Status::CANCELLED;
+    }
+    return Status::OK;
+}
+
+// Streaming context of a ProcessBatchV2Stream() call
+class ProcessBatchV2StreamContext
+{
+public:
+    ExecutorServiceImpl * pService;
+    const Config * pConfig;
+    ProverRequest * pProverRequest;
+    ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse> * writer;
+    uint64_t streamedBlocks;
+    uint64_t streamedTxs;
+    bool bFailed; // The client is gone, so there is no need to build more messages
+    string streamedMessages; // Debug strings of the streamed messages, if config.saveResponseToFile
+};
+
+// Called by the full tracer every time a block is finished
+void processBatchV2StreamBlock (void * pArg, Block &block)
+{
+    ProcessBatchV2StreamContext * pStreamContext = (ProcessBatchV2StreamContext *)pArg;
+    pStreamContext->streamedBlocks++;
+    pStreamContext->streamedTxs += block.responses.size();
+    if (pStreamContext->bFailed)
+    {
+        return;
+    }
+
+    ProverRequest &proverRequest = *pStreamContext->pProverRequest;
+    const Config &config = *pStreamContext->pConfig;
+
+    ::executor::v1::ProcessBatchV2StreamResponse message;
+    pStreamContext->pService->block2grpc(proverRequest, block, message.mutable_block_response());
+
+    // The full tracer drops the transaction responses of a streamed block, so they are logged and saved now,
+    // as ProcessBatchV2() does with the blocks of its response
+#ifdef LOG_SERVICE_EXECUTOR_OUTPUT
+    if (config.logExecutorServerTxs)
+    {
+        string s = "processBatchV2StreamBlock() streams block number=" + to_string(block.block_number) + " hash=" + block.block_hash + " nTxs=" + to_string(block.responses.size());
+        for (uint64_t tx=0; tx<block.responses.size(); tx++)
+        {
+            s += " tx[" + to_string(tx) + "].hash=" + block.responses[tx].tx_hash +
+                " stateRoot=" + block.responses[tx].state_root +
+                " gasUsed=" + to_string(block.responses[tx].gas_used) +
+                " gasLeft=" + to_string(block.responses[tx].gas_left) +
+                " gasUsed+gasLeft=" + to_string(block.responses[tx].gas_used + block.responses[tx].gas_left) +
+                " gasRefunded=" + to_string(block.responses[tx].gas_refunded) +
+                " result=" + block.responses[tx].error;
+        }
+        zklog.info(s, &proverRequest.tags);
+    }
+#endif
+    if (config.logExecutorServerResponses)
+    {
+        zklog.info("processBatchV2StreamBlock() streams:\n" + message.DebugString(), &proverRequest.tags);
+    }
+    if (config.saveResponseToFile)
+    {
+        pStreamContext->streamedMessages += message.DebugString();
+    }
+
+    if (!pStreamContext->writer->Write(message))
+    {
+        zklog.error("processBatchV2StreamBlock() failed writing block number=" + to_string(block.block_number) + "; the client is gone", &proverRequest.tags);
+        pStreamContext->bFailed = true;
+    }
+}
+
+void ExecutorServiceImpl::block2grpc (ProverRequest &proverRequest, Block &block, executor::v1::ProcessBlockResponseV2 * pProcessBlockResponse)
+{
+    pProcessBlockResponse->set_block_hash(string2ba(block.block_hash));
+    pProcessBlockResponse->set_block_hash_l1(string2ba(block.block_hash_l1));
+    pProcessBlockResponse->set_block_info_root(string2ba(block.block_info_root));
+    pProcessBlockResponse->set_block_number(block.block_number);
+    pProcessBlockResponse->set_coinbase(block.coinbase);
+    pProcessBlockResponse->set_gas_limit(block.gas_limit);
+    pProcessBlockResponse->set_gas_used(block.gas_used);
+    pProcessBlockResponse->set_ger(string2ba(block.ger));
+    pProcessBlockResponse->set_parent_hash(string2ba(block.parent_hash));
+    pProcessBlockResponse->set_timestamp(block.timestamp);
+    pProcessBlockResponse->set_error(string2error(block.error));
+
+    for (uint64_t log=0; log<block.logs.size(); log++)
+    {
+        executor::v1::LogV2 * pLog = pProcessBlockResponse->add_logs();
+        pLog->set_address(block.logs[log].address); // Address of the contract that generated the event
+        for (uint64_t topic=0; topic<block.logs[log].topics.size(); topic++)
+        {
+            std::string * pTopic = pLog->add_topics();
+            *pTopic = string2ba(block.logs[log].topics[topic]); // List of topics provided by the contract
+        }
+        string dataConcatenated;
+        for (uint64_t data=0; data<block.logs[log].data.size(); data++)
+            dataConcatenated += block.logs[log].data[data];
+        pLog->set_data(string2ba(dataConcatenated)); // Supplied by the contract, usually ABI-encoded
+        //pLog->set_batch_number(block.logs[log].batch_number); // Batch in which the transaction was included
+        pLog->set_tx_hash(string2ba(block.logs[log].tx_hash)); // Hash of the transaction
+        pLog->set_tx_hash_l2(string2ba(block.logs[log].tx_hash_l2)); // Hash of the transaction in layer 2
+        pLog->set_tx_index(block.logs[log].tx_index); // Index of the transaction in the block
+        //pLog->set_batch_hash(string2ba(block.logs[log].batch_hash)); // Hash of the batch in which the transaction was included
+        pLog->set_index(block.logs[log].index); // Index of the log in the block
+        pLog->set_block_hash(string2ba(block.logs[log].block_hash));
+        pLog->set_block_number(block.logs[log].block_number);
+    }
+
+    vector<ResponseV2> &responses = block.responses;
+
+    for (uint64_t tx=0; tx<block.responses.size(); tx++)
+    {
+        // Remember the previous memory sent for each TX, and send only increments
+        string previousMemory;
+
+        executor::v1::ProcessTransactionResponseV2 * pProcessTransactionResponse = pProcessBlockResponse->add_responses();
+
+        //executor::v1::ProcessTransactionResponse * pProcessTransactionResponse = response->add_responses();
+        pProcessTransactionResponse->set_tx_hash(string2ba(responses[tx].tx_hash));
+        pProcessTransactionResponse->set_tx_hash_l2(string2ba(responses[tx].tx_hash_l2));
+        pProcessTransactionResponse->set_rlp_tx(responses[tx].rlp_tx);
+        pProcessTransactionResponse->set_type(responses[tx].type); // Type indicates legacy transaction; it will be always 0 (legacy) in the executor
+        pProcessTransactionResponse->set_return_value(string2ba(responses[tx].return_value)); // Returned data from the runtime (function result or data supplied with revert opcode)
+        pProcessTransactionResponse->set_gas_left(responses[tx].gas_left); // Total gas left as result of execution
+        pProcessTransactionResponse->set_gas_used(responses[tx].gas_used); // Total gas used as result of execution or gas estimation
+        pProcessTransactionResponse->set_gas_refunded(responses[tx].gas_refunded); // Total gas refunded as result of execution
+        pProcessTransactionResponse->set_error(string2error(responses[tx].error)); // Any error encountered during the execution
+        pProcessTransactionResponse->set_create_address(responses[tx].create_address); // New SC Address in case of SC creation
+        pProcessTransactionResponse->set_state_root(string2ba(responses[tx].state_root));
+        pProcessTransactionResponse->set_status(responses[tx].status);
+        pProcessTransactionResponse->set_effective_percentage(responses[tx].effective_percentage);
+        pProcessTransactionResponse->set_effective_gas_price(responses[tx].effective_gas_price);
+        pProcessTransactionResponse->set_has_balance_opcode(responses[tx].has_balance_opcode);
+        pProcessTransactionResponse->set_has_gasprice_opcode(responses[tx].has_gasprice_opcode);
+        pProcessTransactionResponse->set_cumulative_gas_used(responses[tx].cumulative_gas_used);
+        
+        for (uint64_t log=0; log<responses[tx].logs.size(); log++)
+        {
+            executor::v1::LogV2 * pLog = pProcessTransactionResponse->add_logs();
+            pLog->set_address(responses[tx].logs[log].address); // Address of the contract that generated the event
+            for (uint64_t topic=0; topic<responses[tx].logs[log].topics.size(); topic++)
+            {
+                std::string * pTopic = pLog->add_topics();
+                *pTopic = string2ba(responses[tx].logs[log].topics[topic]); // List of topics provided by the contract
+            }
+            string dataConcatenated;
+            for (uint64_t data=0; data<responses[tx].logs[log].data.size(); data++)
+                dataConcatenated += responses[tx].logs[log].data[data];
+            pLog->set_data(string2ba(dataConcatenated)); // Supplied by the contract, usually ABI-encoded
+            //pLog->set_batch_number(responses[tx].logs[log].batch_number); // Batch in which the transaction was included
+            pLog->set_tx_hash(string2ba(responses[tx].logs[log].tx_hash)); // Hash of the transaction
+            pLog->set_tx_index(responses[tx].logs[log].tx_index); // Index of the transaction in the block
+            //pLog->set_batch_hash(string2ba(responses[tx].logs[log].batch_hash)); // Hash of the batch in which the transaction was included
+            pLog->set_index(responses[tx].logs[log].index); // Index of the log in the block
+            pLog->set_block_hash(string2ba(responses[tx].logs[log].block_hash));
+            pLog->set_block_number(responses[tx].logs[log].block_number);
+        }
+        if (proverRequest.input.traceConfig.bEnabled && (proverRequest.input.traceConfig.txHashToGenerateFullTrace == responses[tx].tx_hash))
+        {
+            executor::v1::FullTraceV2 * pFullTrace = new executor::v1::FullTraceV2();
+            executor::v1::TransactionContextV2 * pTransactionContext = pFullTrace->mutable_context();
+            pTransactionContext->set_type(responses[tx].full_trace.context.type); // "CALL" or "CREATE"
+            pTransactionContext->set_from(responses[tx].full_trace.context.from); // Sender of the transaction
+            pTransactionContext->set_to(responses[tx].full_trace.context.to); // Target of the transaction
+            pTransactionContext->set_data(string2ba(responses[tx].full_trace.context.data)); // Input data of the transaction
+            pTransactionContext->set_gas(responses[tx].full_trace.context.gas);
+            pTransactionContext->set_gas_price(Add0xIfMissing(responses[tx].full_trace.context.gas_price.get_str(16)));
+            pTransactionContext->set_value(Add0xIfMissing(responses[tx].full_trace.context.value.get_str(16)));
+            //pTransactionContext->set_batch(string2ba(responses[tx].full_trace.context.batch)); // Hash of the batch in which the transaction was included
+            pTransactionContext->set_output(string2ba(responses[tx].full_trace.context.output)); // Returned data from the runtime (function result or data supplied with revert opcode)
+            pTransactionContext->set_gas_used(responses[tx].full_trace.context.gas_used); // Total gas used as result of execution
+            pTransactionContext->set_execution_time(responses[tx].full_trace.context.execution_time);
+            pTransactionContext->set_old_state_root(string2ba(responses[tx].full_trace.context.old_state_root)); // Starting state root
+            pTransactionContext->set_chain_id(responses[tx].full_trace.context.chainId);
+            pTransactionContext->set_tx_index(responses[tx].full_trace.context.txIndex);
+            for (uint64_t step=0; step<responses[tx].full_trace.steps.size(); step++)
+            {
+                executor::v1::TransactionStepV2 * pTransactionStep = pFullTrace->add_steps();
+                pTransactionStep->set_state_root(responses[tx].full_trace.steps[step].state_root);
+                pTransactionStep->set_depth(responses[tx].full_trace.steps[step].depth); // Call depth
+                pTransactionStep->set_pc(responses[tx].full_trace.steps[step].pc); // Program counter
+                pTransactionStep->set_gas(responses[tx].full_trace.steps[step].gas); // Remaining gas
+                pTransactionStep->set_gas_cost(responses[tx].full_trace.steps[step].gas_cost); // Gas cost of the operation
+                pTransactionStep->set_gas_refund(responses[tx].full_trace.steps[step].gas_refund); // Gas refunded during the operation
+                pTransactionStep->set_op(responses[tx].full_trace.steps[step].op); // Opcode
+                for (uint64_t stack=0; stack<responses[tx].full_trace.steps[step].stack.size() ; stack++)
+                    pTransactionStep->add_stack(responses[tx].full_trace.steps[step].stack[stack].get_str(16)); // Content of the stack
+                pTransactionStep->set_memory_size(responses[tx].full_trace.steps[step].memory_size);
+                pTransactionStep->set_memory_offset(responses[tx].full_trace.steps[step].memory_offset);
+                pTransactionStep->set_memory(responses[tx].full_trace.steps[step].memory);
+                string dataConcatenated;
+                for (uint64_t data=0; data<responses[tx].full_trace.steps[step].return_data.size(); data++)
+                    dataConcatenated += responses[tx].full_trace.steps[step].return_data[data];
+                pTransactionStep->set_return_data(string2ba(dataConcatenated));
+                executor::v1::ContractV2 * pContract = pTransactionStep->mutable_contract(); // Contract information
+                pContract->set_address(responses[tx].full_trace.steps[step].contract.address);
+                pContract->set_caller(responses[tx].full_trace.steps[step].contract.caller);
+                pContract->set_value(Add0xIfMissing(responses[tx].full_trace.steps[step].contract.value.get_str(16)));
+                pContract->set_data(string2ba(responses[tx].full_trace.steps[step].contract.data));
+                pContract->set_gas(responses[tx].full_trace.steps[step].contract.gas);
+                pContract->set_type(responses[tx].full_trace.steps[step].contract.type);
+                pTransactionStep->set_error(string2error(responses[tx].full_trace.steps[step].error));
+
+                google::protobuf::Map<std::string, std::string> * pStorage = pTransactionStep->mutable_storage();
+                unordered_map<string,string>::iterator it;
+                for (it=responses[tx].full_trace.steps[step].storage.begin(); it!=responses[tx].full_trace.steps[step].storage.end(); it++)
+                    (*pStorage)[it->first] = it->second; // Content of the storage
+            }
+            pProcessTransactionResponse->set_allocated_full_trace(pFullTrace);
+        }
+    }
+}
+
+::grpc::Status ExecutorServiceImpl::processBatchV2 (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response, ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse>* writer)
 {
     // If the process is exiting, do not start new activities
     if (bExitingProcess)
@@ -1317,6 +1547,21 @@ using grpc::Status;
         zklog.info("ExecutorServiceImpl::ProcessBatchV2() Input=" + inputJsonString, &proverRequest.tags);
     }
 
+    // In streaming mode, the full tracer sends every block as soon as it is finished
+    ProcessBatchV2StreamContext streamContext;
+    streamContext.pService = this;
+    streamContext.pConfig = &config;
+    streamContext.pProverRequest = &proverRequest;
+    streamContext.writer = writer;
+    streamContext.streamedBlocks = 0;
+    streamContext.streamedTxs = 0;
+    streamContext.bFailed = false;
+    if (writer != NULL)
+    {
+        proverRequest.pBlockStreamFunction = processBatchV2StreamBlock;
+        proverRequest.pBlockStreamArg = &streamContext;
+    }
+
     prover.processBatch(&proverRequest);
 
     //TimerStart(EXECUTOR_PROCESS_BATCH_BUILD_RESPONSE);
@@ -1384,149 +1629,22 @@ using grpc::Status;
     vector<Block> &block_responses = proverRequest.pFullTracer->get_block_responses();
     uint64_t nTxs = 0;
 
-    for (uint64_t block=0; block<block_responses.size(); block++)
+    if (writer == NULL)
     {
-        executor::v1::ProcessBlockResponseV2 * pProcessBlockResponse = response->add_block_responses();
-
-        pProcessBlockResponse->set_block_hash(string2ba(block_responses[block].block_hash));
-        pProcessBlockResponse->set_block_hash_l1(string2ba(block_responses[block].block_hash_l1));
-        pProcessBlockResponse->set_block_info_root(string2ba(block_responses[block].block_info_root));
-        pProcessBlockResponse->set_block_number(block_responses[block].block_number);
-        pProcessBlockResponse->set_coinbase(block_responses[block].coinbase);
-        pProcessBlockResponse->set_gas_limit(block_responses[block].gas_limit);
-        pProcessBlockResponse->set_gas_used(block_responses[block].gas_used);
-        pProcessBlockResponse->set_ger(string2ba(block_responses[block].ger));
-        pProcessBlockResponse->set_parent_hash(string2ba(block_responses[block].parent_hash));
-        pProcessBlockResponse->set_timestamp(block_responses[block].timestamp);
-        pProcessBlockResponse->set_error(string2error(block_responses[block].error));
-
-        for (uint64_t log=0; log<block_responses[block].logs.size(); log++)
+        for (uint64_t block=0; block<block_responses.size(); block++)
         {
-            executor::v1::LogV2 * pLog = pProcessBlockResponse->add_logs();
-            pLog->set_address(block_responses[block].logs[log].address); // Address of the contract that generated the event
-            for (uint64_t topic=0; topic<block_responses[block].logs[log].topics.size(); topic++)
-            {
-                std::string * pTopic = pLog->add_topics();
-                *pTopic = string2ba(block_responses[block].logs[log].topics[topic]); // List of topics provided by the contract
-            }
-            string dataConcatenated;
-            for (uint64_t data=0; data<block_responses[block].logs[log].data.size(); data++)
-                dataConcatenated += block_responses[block].logs[log].data[data];
-            pLog->set_data(string2ba(dataConcatenated)); // Supplied by the contract, usually ABI-encoded
-            //pLog->set_batch_number(block_responses[tblockx].logs[log].batch_number); // Batch in which the transaction was included
-            pLog->set_tx_hash(string2ba(block_responses[block].logs[log].tx_hash)); // Hash of the transaction
-            pLog->set_tx_hash_l2(string2ba(block_responses[block].logs[log].tx_hash_l2)); // Hash of the transaction in layer 2
-            pLog->set_tx_index(block_responses[block].logs[log].tx_index); // Index of the transaction in the block
-            //pLog->set_batch_hash(string2ba(block_responses[block].logs[log].batch_hash)); // Hash of the batch in which the transaction was included
-            pLog->set_index(block_responses[block].logs[log].index); // Index of the log in the block
-            pLog->set_block_hash(string2ba(block_responses[block].logs[log].block_hash));
-            pLog->set_block_number(block_responses[block].logs[log].block_number);
+            block2grpc(proverRequest, block_responses[block], response->add_block_responses());
+            nTxs += block_responses[block].responses.size();
         }
-
-        vector<ResponseV2> &responses = block_responses[block].responses;
-        nTxs += responses.size();
-
-        for (uint64_t tx=0; tx<block_responses[block].responses.size(); tx++)
+    }
+    else
+    {
+        // Blocks not streamed during the execution, e.g. by older forks full tracers, are sent now
+        for (uint64_t block=streamContext.streamedBlocks; block<block_responses.size(); block++)
         {
-            // Remember the previous memory sent for each TX, and send only increments
-            string previousMemory;
-
-            executor::v1::ProcessTransactionResponseV2 * pProcessTransactionResponse = pProcessBlockResponse->add_responses();
-
-            //executor::v1::ProcessTransactionResponse * pProcessTransactionResponse = response->add_responses();
-            pProcessTransactionResponse->set_tx_hash(string2ba(responses[tx].tx_hash));
-            pProcessTransactionResponse->set_tx_hash_l2(string2ba(responses[tx].tx_hash_l2));
-            pProcessTransactionResponse->set_rlp_tx(responses[tx].rlp_tx);
-            pProcessTransactionResponse->set_type(responses[tx].type); // Type indicates legacy transaction; it will be always 0 (legacy) in the executor
-            pProcessTransactionResponse->set_return_value(string2ba(responses[tx].return_value)); // Returned data from the runtime (function result or data supplied with revert opcode)
-            pProcessTransactionResponse->set_gas_left(responses[tx].gas_left); // Total gas left as result of execution
-            pProcessTransactionResponse->set_gas_used(responses[tx].gas_used); // Total gas used as result of execution or gas estimation
-            pProcessTransactionResponse->set_gas_refunded(responses[tx].gas_refunded); // Total gas refunded as result of execution
-            pProcessTransactionResponse->set_error(string2error(responses[tx].error)); // Any error encountered during the execution
-            pProcessTransactionResponse->set_create_address(responses[tx].create_address); // New SC Address in case of SC creation
-            pProcessTransactionResponse->set_state_root(string2ba(responses[tx].state_root));
-            pProcessTransactionResponse->set_status(responses[tx].status);
-            pProcessTransactionResponse->set_effective_percentage(responses[tx].effective_percentage);
-            pProcessTransactionResponse->set_effective_gas_price(responses[tx].effective_gas_price);
-            pProcessTransactionResponse->set_has_balance_opcode(responses[tx].has_balance_opcode);
-            pProcessTransactionResponse->set_has_gasprice_opcode(responses[tx].has_gasprice_opcode);
-            pProcessTransactionResponse->set_cumulative_gas_used(responses[tx].cumulative_gas_used);
-            
-            for (uint64_t log=0; log<responses[tx].logs.size(); log++)
-            {
-                executor::v1::LogV2 * pLog = pProcessTransactionResponse->add_logs();
-                pLog->set_address(responses[tx].logs[log].address); // Address of the contract that generated the event
-                for (uint64_t topic=0; topic<responses[tx].logs[log].topics.size(); topic++)
-                {
-                    std::string * pTopic = pLog->add_topics();
-                    *pTopic = string2ba(responses[tx].logs[log].topics[topic]); // List of topics provided by the contract
-                }
-                string dataConcatenated;
-                for (uint64_t data=0; data<responses[tx].logs[log].data.size(); data++)
-                    dataConcatenated += responses[tx].logs[log].data[data];
-                pLog->set_data(string2ba(dataConcatenated)); // Supplied by the contract, usually ABI-encoded
-                //pLog->set_batch_number(responses[tx].logs[log].batch_number); // Batch in which the transaction was included
-                pLog->set_tx_hash(string2ba(responses[tx].logs[log].tx_hash)); // Hash of the transaction
-                pLog->set_tx_index(responses[tx].logs[log].tx_index); // Index of the transaction in the block
-                //pLog->set_batch_hash(string2ba(responses[tx].logs[log].batch_hash)); // Hash of the batch in which the transaction was included
-                pLog->set_index(responses[tx].logs[log].index); // Index of the log in the block
-                pLog->set_block_hash(string2ba(responses[tx].logs[log].block_hash));
-                pLog->set_block_number(responses[tx].logs[log].block_number);
-            }
-            if (proverRequest.input.traceConfig.bEnabled && (proverRequest.input.traceConfig.txHashToGenerateFullTrace == responses[tx].tx_hash))
-            {
-                executor::v1::FullTraceV2 * pFullTrace = new executor::v1::FullTraceV2();
-                executor::v1::TransactionContextV2 * pTransactionContext = pFullTrace->mutable_context();
-                pTransactionContext->set_type(responses[tx].full_trace.context.type); // "CALL" or "CREATE"
-                pTransactionContext->set_from(responses[tx].full_trace.context.from); // Sender of the transaction
-                pTransactionContext->set_to(responses[tx].full_trace.context.to); // Target of the transaction
-                pTransactionContext->set_data(string2ba(responses[tx].full_trace.context.data)); // Input data of the transaction
-                pTransactionContext->set_gas(responses[tx].full_trace.context.gas);
-                pTransactionContext->set_gas_price(Add0xIfMissing(responses[tx].full_trace.context.gas_price.get_str(16)));
-                pTransactionContext->set_value(Add0xIfMissing(responses[tx].full_trace.context.value.get_str(16)));
-                //pTransactionContext->set_batch(string2ba(responses[tx].full_trace.context.batch)); // Hash of the batch in which the transaction was included
-                pTransactionContext->set_output(string2ba(responses[tx].full_trace.context.output)); // Returned data from the runtime (function result or data supplied with revert opcode)
-                pTransactionContext->set_gas_used(responses[tx].full_trace.context.gas_used); // Total gas used as result of execution
-                pTransactionContext->set_execution_time(responses[tx].full_trace.context.execution_time);
-                pTransactionContext->set_old_state_root(string2ba(responses[tx].full_trace.context.old_state_root)); // Starting state root
-                pTransactionContext->set_chain_id(responses[tx].full_trace.context.chainId);
-                pTransactionContext->set_tx_index(responses[tx].full_trace.context.txIndex);
-                for (uint64_t step=0; step<responses[tx].full_trace.steps.size(); step++)
-                {
-                    executor::v1::TransactionStepV2 * pTransactionStep = pFullTrace->add_steps();
-                    pTransactionStep->set_state_root(string2ba(responses[tx].full_trace.steps[step].state_root));
-                    pTransactionStep->set_depth(responses[tx].full_trace.steps[step].depth); // Call depth
-                    pTransactionStep->set_pc(responses[tx].full_trace.steps[step].pc); // Program counter
-                    pTransactionStep->set_gas(responses[tx].full_trace.steps[step].gas); // Remaining gas
-                    pTransactionStep->set_gas_cost(responses[tx].full_trace.steps[step].gas_cost); // Gas cost of the operation
-                    pTransactionStep->set_gas_refund(responses[tx].full_trace.steps[step].gas_refund); // Gas refunded during the operation
-                    pTransactionStep->set_op(responses[tx].full_trace.steps[step].op); // Opcode
-                    for (uint64_t stack=0; stack<responses[tx].full_trace.steps[step].stack.size() ; stack++)
-                        pTransactionStep->add_stack(responses[tx].full_trace.steps[step].stack[stack].get_str(16)); // Content of the stack
-                    pTransactionStep->set_memory_size(responses[tx].full_trace.steps[step].memory_size);
-                    pTransactionStep->set_memory_offset(responses[tx].full_trace.steps[step].memory_offset);
-                    pTransactionStep->set_memory(responses[tx].full_trace.steps[step].memory);
-                    string dataConcatenated;
-                    for (uint64_t data=0; data<responses[tx].full_trace.steps[step].return_data.size(); data++)
-                        dataConcatenated += responses[tx].full_trace.steps[step].return_data[data];
-                    pTransactionStep->set_return_data(string2ba(dataConcatenated));
-                    executor::v1::ContractV2 * pContract = pTransactionStep->mutable_contract(); // Contract information
-                    pContract->set_address(responses[tx].full_trace.steps[step].contract.address);
-                    pContract->set_caller(responses[tx].full_trace.steps[step].contract.caller);
-                    pContract->set_value(Add0xIfMissing(responses[tx].full_trace.steps[step].contract.value.get_str(16)));
-                    pContract->set_data(string2ba(responses[tx].full_trace.steps[step].contract.data));
-                    pContract->set_gas(responses[tx].full_trace.steps[step].contract.gas);
-                    pContract->set_type(responses[tx].full_trace.steps[step].contract.type);
-                    pTransactionStep->set_error(string2error(responses[tx].full_trace.steps[step].error));
-
-                    google::protobuf::Map<std::string, std::string> * pStorage = pTransactionStep->mutable_storage();
-                    unordered_map<string,string>::iterator it;
-                    for (it=responses[tx].full_trace.steps[step].storage.begin(); it!=responses[tx].full_trace.steps[step].storage.end(); it++)
-                        (*pStorage)[it->first] = it->second; // Content of the storage
-                }
-                pProcessTransactionResponse->set_allocated_full_trace(pFullTrace);
-            }
+            processBatchV2StreamBlock(&streamContext, block_responses[block]);
         }
+        nTxs = streamContext.streamedTxs;
     }
 
     // Return accessed keys, if requested
@@ -1612,7 +1730,8 @@ using grpc::Status;
     {
         //TimerStart(EXECUTOR_PROCESS_BATCH_SAVING_RESPONSE_TO_FILE);
         //zklog.info("ExecutorServiceImpl::ProcessBatch() returns response of size=" + to_string(response->ByteSizeLong()), &proverRequest.tags);
-        string2file(response->DebugString(), proverRequest.filePrefix + "executor_response.txt");
+        // In streaming mode, the streamed blocks are saved first, in the order they were sent
+        string2file(streamContext.streamedMessages + response->DebugString(), proverRequest.filePrefix + "executor_response.txt");
         //TimerStopAndLog(EXECUTOR_PROCESS_BATCH_SAVING_RESPONSE_TO_FILE);
     }
 
@@ -1655,6 +1774,11 @@ using grpc::Status;
             s += " TP=" + to_string((double(opcodeTotalGas)*1000000)/double(opcodeTotalDuration)) + "gas/s";
         }
         zklog.info(s, &proverRequest.tags);
+
+        // Full tracer overhead, as a percentage of the whole batch processing time
+        uint64_t tracerTime = proverRequest.pFullTracer->get_tracer_time();
+        uint64_t executionTime = TimeDiff(EXECUTOR_PROCESS_BATCH_start, EXECUTOR_PROCESS_BATCH_stop);
+        zklog.info("Full tracer time=" + to_string(tracerTime) + "us execution time=" + to_string(executionTime) + "us overhead=" + to_string((double(tracerTime)*100)/double(zkmax(executionTime, uint64_t(1)))) + "%", &proverRequest.tags);
     }
 
     // Calculate the throughput, for this ProcessBatch call, and for all calls
@@ -2187,7 +2311,7 @@ using grpc::Status;
                 for (uint64_t step=0; step<responses[tx].full_trace.steps.size(); step++)
                 {
                     executor::v1::TransactionStepV2 * pTransactionStep = pFullTrace->add_steps();
-                    pTransactionStep->set_state_root(string2ba(responses[tx].full_trace.steps[step].state_root));
+                    pTransactionStep->set_state_root(responses[tx].full_trace.steps[step].state_root);
                     pTransactionStep->set_depth(responses[tx].full_trace.steps[step].depth); // Call depth
                     pTransactionStep->set_pc(responses[tx].full_trace.steps[step].pc); // Program counter
                     pTransactionStep->set_gas(responses[tx].full_trace.steps[step].gas); // Remaining gas
@@ -2348,6 +2472,11 @@ using grpc::Status;
             s += " TP=" + to_string((double(opcodeTotalGas)*1000000)/double(opcodeTotalDuration)) + "gas/s";
         }
         zklog.info(s, &proverRequest.tags);
+
+        // Full tracer overhead, as a percentage of the whole batch processing time
+        uint64_t tracerTime = proverRequest.pFullTracer->get_tracer_time();
+        uint64_t executionTime = TimeDiff(EXECUTOR_PROCESS_BATCH_start, EXECUTOR_PROCESS_BATCH_stop);
+        zklog.info("Full tracer time=" + to_string(tracerTime) + "us execution time=" + to_string(executionTime) + "us overhead=" + to_string((double(tracerTime)*100)/double(zkmax(executionTime, uint64_t(1)))) + "%", &proverRequest.tags);
     }
 
     // Calculate the throughput, for this ProcessBatch call, and for all calls
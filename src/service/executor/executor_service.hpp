@@ -10,6 +10,9 @@
 
 //#define PROCESS_BATCH_STREAM
 
+// Called by the full tracer every time a block is finished, to send it to a ProcessBatchV2Stream() client
+void processBatchV2StreamBlock (void * pArg, Block &block);
+
 class ExecutorServiceImpl final : public executor::v1::ExecutorService::Service
 {
     Goldilocks &fr;
@@ -34,6 +37,9 @@ class ExecutorServiceImpl final : public executor::v1::ExecutorService::Service
     double totalTPTX; // Total throughput in TX/s, calculated when time since lastTotalTime > 1s
     pthread_mutex_t mutex; // Mutex to protect the access to the throughput attributes
 
+    // Implements ProcessBatchV2 and, if writer is not NULL, ProcessBatchV2Stream
+    ::grpc::Status processBatchV2 (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response, ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse>* writer);
+
 public:
     ExecutorServiceImpl (Goldilocks &fr, Config &config, Prover &prover) :
         fr(fr),
@@ -72,6 +78,7 @@ public:
     void unlock(void) { pthread_mutex_unlock(&mutex); };
     ::grpc::Status ProcessBatch   (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequest*   request, ::executor::v1::ProcessBatchResponse*   response) override;
     ::grpc::Status ProcessBatchV2 (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response) override;
+    ::grpc::Status ProcessBatchV2Stream (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchV2StreamResponse>* writer) override;
     ::grpc::Status ProcessStatelessBatchV2 (::grpc::ServerContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response) override;
     ::grpc::Status GetFlushStatus (::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::executor::v1::GetFlushStatusResponse* response) override;
 #ifdef PROCESS_BATCH_STREAM
@@ -79,6 +86,7 @@ public:
 #endif    
     ::executor::v1::RomError string2error (string &errorString);
     ::executor::v1::ExecutorError zkresult2error (zkresult &result);
+    void block2grpc (ProverRequest &proverRequest, Block &block, executor::v1::ProcessBlockResponseV2 * pProcessBlockResponse);
 };
 
 #endif
\ No newline at end of file
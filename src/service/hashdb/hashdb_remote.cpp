@@ -23,12 +23,16 @@ HashDBRemote::HashDBRemote (Goldilocks &fr, const Config &config) : fr(fr), conf
 
     // Create stub (i.e. client)
     stub = new hashdb::v1::HashDBService::Stub(channel);
+
+    pthread_mutex_init(&overlayMutex, NULL);
 }
 
 HashDBRemote::~HashDBRemote()
 {
     delete stub;
 
+    pthread_mutex_destroy(&overlayMutex);
+
 #ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
     tms.print("HashDBRemote");
 #endif
@@ -126,15 +130,42 @@ zkresult HashDBRemote::set (const string &batchUUID, uint64_t block, uint64_t tx
         dbReadLog->add(mtMap);
     }
 
+    zkresult zkr = static_cast<zkresult>(response.result().code());
+
+    // In batch mode, record the set, so that later gets of newRoot can be resolved locally
+    if (config.hashDBRemoteBatch && (zkr == ZKR_SUCCESS))
+    {
+        string newRootString = fea2string(fr, newRoot);
+        string keyString = fea2string(fr, key);
+        bool bCreated;
+        lockOverlay();
+        HashDBRemoteOverlay &overlay = getOverlay(batchUUID, bCreated);
+        HashDBRemoteSetEntry &setEntry = overlay.sets[newRootString];
+        setEntry.oldRoot = fea2string(fr, oldRoot);
+        setEntry.key = keyString;
+        setEntry.value = value;
+        overlayTouchKey(overlay, keyString, key);
+        unlockOverlay();
+        if (bCreated)
+        {
+            prefetch(batchUUID, oldRoot);
+        }
+    }
+
 #ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
     tms.add("set", TimeDiff(t));
 #endif
 
-    return static_cast<zkresult>(response.result().code());
+    return zkr;
 }
 
 zkresult HashDBRemote::get (const string &batchUUID, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result, DatabaseMap *dbReadLog)
 {
+    if (config.hashDBRemoteBatch)
+    {
+        return getWithOverlay(batchUUID, root, key, value, result, dbReadLog);
+    }
+
 #ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
     gettimeofday(&t, NULL);
 #endif
@@ -165,28 +196,7 @@ zkresult HashDBRemote::get (const string &batchUUID, const Goldilocks::Element (
 
     if (result != NULL)
     {
-        grpc2fea(fr, response.root(), result->root);
-        grpc2fea(fr, response.key(), result->key);
-        result->value.set_str(response.value(),16);
-
-        google::protobuf::Map<google::protobuf::uint64, hashdb::v1::SiblingList>::iterator it;
-        google::protobuf::Map<google::protobuf::uint64, hashdb::v1::SiblingList> siblings;
-        siblings = *response.mutable_siblings();
-        result->siblings.clear();
-        for (it=siblings.begin(); it!=siblings.end(); it++)
-        {
-            vector<Goldilocks::Element> list;
-            for (int i=0; i<it->second.sibling_size(); i++)
-            {
-                list.push_back(fr.fromU64(it->second.sibling(i)));
-            }
-            result->siblings[it->first]=list;
-        }
-
-        grpc2fea(fr, response.ins_key(), result->insKey);
-        result->insValue.set_str(response.ins_value(),16);
-        result->isOld0 = response.is_old0();
-        result->proofHashCounter = response.proof_hash_counter();
+        grpc2getResult(response, *result);
     }
 
     if (dbReadLog != NULL)
@@ -203,6 +213,406 @@ zkresult HashDBRemote::get (const string &batchUUID, const Goldilocks::Element (
     return static_cast<zkresult>(response.result().code());
 }
 
+void HashDBRemote::grpc2getResult (const ::hashdb::v1::GetResponse &response, SmtGetResult &result)
+{
+    grpc2fea(fr, response.root(), result.root);
+    grpc2fea(fr, response.key(), result.key);
+    result.value.set_str(response.value(),16);
+
+    google::protobuf::Map<google::protobuf::uint64, hashdb::v1::SiblingList>::const_iterator it;
+    result.siblings.clear();
+    for (it=response.siblings().begin(); it!=response.siblings().end(); it++)
+    {
+        vector<Goldilocks::Element> list;
+        for (int i=0; i<it->second.sibling_size(); i++)
+        {
+            list.push_back(fr.fromU64(it->second.sibling(i)));
+        }
+        result.siblings[it->first]=list;
+    }
+
+    grpc2fea(fr, response.ins_key(), result.insKey);
+    result.insValue.set_str(response.ins_value(),16);
+    result.isOld0 = response.is_old0();
+    result.proofHashCounter = response.proof_hash_counter();
+}
+
+zkresult HashDBRemote::getBatch (const string &batchUUID, const Goldilocks::Element (&root)[4], vector<KeyValue> &keyValues, DatabaseMap *dbReadLog)
+{
+    // Servers without the GetBatch service are only used in non-batch mode
+    if (!config.hashDBRemoteBatch)
+    {
+        return HashDBInterface::getBatch(batchUUID, root, keyValues, dbReadLog);
+    }
+
+#ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
+    struct timeval tGetBatch;
+    gettimeofday(&tGetBatch, NULL);
+#endif
+
+    string rootString = fea2string(fr, root);
+    bool bValueOnly = (dbReadLog == NULL);
+
+    // Resolve as many keys as possible from the overlay
+    vector<KeyValue> missing;
+    vector<uint64_t> missingIndexes;
+    bool bCreated;
+    lockOverlay();
+    HashDBRemoteOverlay &overlay = getOverlay(batchUUID, bCreated);
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        string keyString = fea2string(fr, keyValues[i].key);
+        overlayTouchKey(overlay, keyString, keyValues[i].key);
+        if (!bCreated && overlayGet(overlay, rootString, keyString, bValueOnly, keyValues[i].value, NULL, dbReadLog))
+        {
+            overlay.hits++;
+        }
+        else
+        {
+            overlay.misses++;
+            missing.emplace_back(keyValues[i]);
+            missingIndexes.emplace_back(i);
+        }
+    }
+    unlockOverlay();
+
+    if (missing.size() == 0)
+    {
+        return ZKR_SUCCESS;
+    }
+
+    // Get the rest in a single call
+    vector<HashDBRemoteGetEntry> entries;
+    zkresult zkr = remoteGetBatch(batchUUID, root, missing, false, !bValueOnly, entries);
+    if (zkr != ZKR_SUCCESS)
+    {
+        return zkr;
+    }
+    for (uint64_t i=0; i<entries.size(); i++)
+    {
+        keyValues[missingIndexes[i]].value = entries[i].value;
+        if (dbReadLog != NULL)
+        {
+            dbReadLog->add(entries[i].dbReadLog);
+        }
+    }
+
+    // Store the results, so that they serve later value gets
+    lockOverlay();
+    HashDBRemoteOverlay &overlay2 = getOverlay(batchUUID, bCreated);
+    for (uint64_t i=0; i<entries.size(); i++)
+    {
+        string getKey = rootString + fea2string(fr, missing[i].key);
+        if (overlay2.gets.find(getKey) == overlay2.gets.end())
+        {
+            overlay2.gets[getKey] = entries[i];
+        }
+    }
+    unlockOverlay();
+
+#ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
+    tms.add("getBatch", TimeDiff(tGetBatch));
+#endif
+
+    return ZKR_SUCCESS;
+}
+
+zkresult HashDBRemote::remoteGetBatch (const string &batchUUID, const Goldilocks::Element (&root)[4], const vector<KeyValue> &keyValues, bool bComplete, bool bReadLog, vector<HashDBRemoteGetEntry> &entries)
+{
+    ::grpc::ClientContext context;
+    ::hashdb::v1::GetBatchRequest request;
+    ::hashdb::v1::GetBatchResponse response;
+
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        ::hashdb::v1::GetRequest *pGetRequest = request.add_requests();
+        fea2grpc(fr, root, pGetRequest->mutable_root());
+        fea2grpc(fr, keyValues[i].key, pGetRequest->mutable_key());
+        pGetRequest->set_details(bComplete);
+        pGetRequest->set_get_db_read_log(bComplete || bReadLog);
+        pGetRequest->set_batch_uuid(batchUUID);
+    }
+
+    grpc::Status s = stub->GetBatch(&context, request, &response);
+    if (s.error_code() != grpc::StatusCode::OK)
+    {
+        zklog.error("HashDBRemote::remoteGetBatch() GRPC error(" + to_string(s.error_code()) + "): " + s.error_message());
+        return ZKR_HASHDB_GRPC_ERROR;
+    }
+    zkresult zkr = static_cast<zkresult>(response.result().code());
+    if (zkr != ZKR_SUCCESS)
+    {
+        zklog.error("HashDBRemote::remoteGetBatch() failed calling GetBatch() result=" + zkresult2string(zkr));
+        return zkr;
+    }
+    if ((uint64_t)response.responses_size() != keyValues.size())
+    {
+        zklog.error("HashDBRemote::remoteGetBatch() got responses=" + to_string(response.responses_size()) + " different from requests=" + to_string(keyValues.size()));
+        return ZKR_HASHDB_GRPC_ERROR;
+    }
+
+    entries.resize(keyValues.size());
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        const ::hashdb::v1::GetResponse &getResponse = response.responses(i);
+        entries[i].value.set_str(getResponse.value(), 16);
+        entries[i].bComplete = bComplete;
+        if (bComplete)
+        {
+            grpc2getResult(getResponse, entries[i].result);
+        }
+        if (bComplete || bReadLog)
+        {
+            grpc2mtMap(fr, getResponse.db_read_log(), entries[i].dbReadLog);
+        }
+    }
+
+    return ZKR_SUCCESS;
+}
+
+zkresult HashDBRemote::getWithOverlay (const string &batchUUID, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result, DatabaseMap *dbReadLog)
+{
+    string rootString = fea2string(fr, root);
+    string keyString = fea2string(fr, key);
+    bool bValueOnly = (result == NULL) && (dbReadLog == NULL);
+
+    // The first access of a batch prefetches the keys touched by the previous one
+    bool bCreated;
+    lockOverlay();
+    getOverlay(batchUUID, bCreated);
+    unlockOverlay();
+    if (bCreated)
+    {
+        prefetch(batchUUID, root);
+    }
+
+    // Look for the result in the overlay
+    lockOverlay();
+    HashDBRemoteOverlay &overlay = getOverlay(batchUUID, bCreated);
+    overlayTouchKey(overlay, keyString, key);
+    bool bFound = overlayGet(overlay, rootString, keyString, bValueOnly, value, result, dbReadLog);
+    if (bFound)
+    {
+        overlay.hits++;
+    }
+    else
+    {
+        overlay.misses++;
+    }
+    unlockOverlay();
+    if (bFound)
+    {
+        return ZKR_SUCCESS;
+    }
+
+#ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
+    struct timeval tGet;
+    gettimeofday(&tGet, NULL);
+#endif
+
+    // Get it from the server, always complete, so that it can serve any later get of the same root and key
+    HashDBRemoteGetEntry entry;
+    SmtGetResult *pResult = (result != NULL) ? result : &entry.result;
+    DatabaseMap::MTMap mtMap;
+    ::grpc::ClientContext context;
+    ::hashdb::v1::GetRequest request;
+    ::hashdb::v1::GetResponse response;
+    fea2grpc(fr, root, request.mutable_root());
+    fea2grpc(fr, key, request.mutable_key());
+    request.set_details(true);
+    request.set_get_db_read_log(true);
+    request.set_batch_uuid(batchUUID);
+
+    grpc::Status s = stub->Get(&context, request, &response);
+    if (s.error_code() != grpc::StatusCode::OK)
+    {
+        zklog.error("HashDBRemote::getWithOverlay() GRPC error(" + to_string(s.error_code()) + "): " + s.error_message());
+        return ZKR_HASHDB_GRPC_ERROR;
+    }
+    zkresult zkr = static_cast<zkresult>(response.result().code());
+
+    value.set_str(response.value(),16);
+    grpc2getResult(response, *pResult);
+    grpc2mtMap(fr, response.db_read_log(), mtMap);
+    if (dbReadLog != NULL)
+    {
+        dbReadLog->add(mtMap);
+    }
+
+    // Store it in the overlay
+    if (zkr == ZKR_SUCCESS)
+    {
+        entry.value = value;
+        entry.bComplete = true;
+        if (result != NULL)
+        {
+            entry.result = *result;
+        }
+        entry.dbReadLog.swap(mtMap);
+        lockOverlay();
+        HashDBRemoteOverlay &overlay2 = getOverlay(batchUUID, bCreated);
+        overlay2.gets[rootString + keyString] = entry;
+        unlockOverlay();
+    }
+
+#ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
+    tms.add("getWithOverlay", TimeDiff(tGet));
+#endif
+
+    return zkr;
+}
+
+HashDBRemoteOverlay & HashDBRemote::getOverlay (const string &batchUUID, bool &bCreated)
+{
+    unordered_map<string, HashDBRemoteOverlay>::iterator it = overlays.find(batchUUID);
+    if (it != overlays.end())
+    {
+        bCreated = false;
+        return it->second;
+    }
+
+    // Discard an overlay if there are too many, e.g. of batches that were never flushed
+    if (overlays.size() >= HASHDB_REMOTE_MAX_OVERLAYS)
+    {
+        zklog.warning("HashDBRemote::getOverlay() reached " + to_string(overlays.size()) + " overlays; discarding the one of batchUUID=" + overlays.begin()->first);
+        overlays.erase(overlays.begin());
+    }
+
+    bCreated = true;
+    return overlays[batchUUID];
+}
+
+bool HashDBRemote::overlayGet (HashDBRemoteOverlay &overlay, const string &root, const string &key, bool bValueOnly, mpz_class &value, SmtGetResult *result, DatabaseMap *dbReadLog)
+{
+    // A get with details or read log requires a complete entry of this exact root; a value get can
+    // follow the chain of sets done in this batch, from root back to a root with a known value
+    string currentRoot = root;
+    for (uint64_t depth=0; depth<=overlay.sets.size(); depth++)
+    {
+        unordered_map<string, HashDBRemoteGetEntry>::iterator it = overlay.gets.find(currentRoot + key);
+        if (it != overlay.gets.end())
+        {
+            if (bValueOnly)
+            {
+                value = it->second.value;
+                return true;
+            }
+            if (!it->second.bComplete)
+            {
+                return false;
+            }
+            value = it->second.value;
+            if (result != NULL)
+            {
+                *result = it->second.result;
+            }
+            if (dbReadLog != NULL)
+            {
+                dbReadLog->add(it->second.dbReadLog);
+            }
+            return true;
+        }
+        if (!bValueOnly)
+        {
+            return false;
+        }
+
+        unordered_map<string, HashDBRemoteSetEntry>::iterator setIt = overlay.sets.find(currentRoot);
+        if (setIt == overlay.sets.end())
+        {
+            return false;
+        }
+        if (setIt->second.key == key)
+        {
+            value = setIt->second.value;
+            return true;
+        }
+        currentRoot = setIt->second.oldRoot;
+    }
+    return false;
+}
+
+void HashDBRemote::overlayTouchKey (HashDBRemoteOverlay &overlay, const string &keyString, const Goldilocks::Element (&key)[4])
+{
+    if (overlay.touchedKeySet.size() >= config.hashDBRemotePrefetchKeys)
+    {
+        return;
+    }
+    if (overlay.touchedKeySet.insert(keyString).second)
+    {
+        KeyValue keyValue;
+        for (uint64_t i=0; i<4; i++)
+        {
+            keyValue.key[i] = key[i];
+        }
+        overlay.touchedKeys.emplace_back(keyValue);
+    }
+}
+
+void HashDBRemote::prefetch (const string &batchUUID, const Goldilocks::Element (&root)[4])
+{
+    // Batches of the same chain usually touch the same keys, e.g. the sequencer and bridge accounts
+    vector<KeyValue> keyValues;
+    lockOverlay();
+    keyValues = prefetchKeys;
+    unlockOverlay();
+    if (keyValues.size() == 0)
+    {
+        return;
+    }
+
+#ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
+    struct timeval tPrefetch;
+    gettimeofday(&tPrefetch, NULL);
+#endif
+
+    vector<HashDBRemoteGetEntry> entries;
+    zkresult zkr = remoteGetBatch(batchUUID, root, keyValues, true, true, entries);
+    if (zkr != ZKR_SUCCESS)
+    {
+        zklog.warning("HashDBRemote::prefetch() failed prefetching " + to_string(keyValues.size()) + " keys of batchUUID=" + batchUUID + " result=" + zkresult2string(zkr));
+        return;
+    }
+
+    string rootString = fea2string(fr, root);
+    bool bCreated;
+    lockOverlay();
+    HashDBRemoteOverlay &overlay = getOverlay(batchUUID, bCreated);
+    for (uint64_t i=0; i<entries.size(); i++)
+    {
+        overlay.gets[rootString + fea2string(fr, keyValues[i].key)] = entries[i];
+    }
+    overlay.prefetched += entries.size();
+    unlockOverlay();
+
+#ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
+    tms.add("prefetch", TimeDiff(tPrefetch));
+#endif
+}
+
+void HashDBRemote::finishOverlay (const string &batchUUID)
+{
+    lockOverlay();
+    unordered_map<string, HashDBRemoteOverlay>::iterator it = overlays.find(batchUUID);
+    if (it != overlays.end())
+    {
+        HashDBRemoteOverlay &overlay = it->second;
+        uint64_t total = overlay.hits + overlay.misses;
+        zklog.info("HashDBRemote::finishOverlay() batchUUID=" + batchUUID +
+            " hits=" + to_string(overlay.hits) +
+            " misses=" + to_string(overlay.misses) +
+            " hitRatio=" + to_string(total == 0 ? 0 : overlay.hits*100/total) + "%" +
+            " prefetched=" + to_string(overlay.prefetched) +
+            " sets=" + to_string(overlay.sets.size()) +
+            " touchedKeys=" + to_string(overlay.touchedKeys.size()));
+
+        // The keys touched by this batch will be prefetched by the next one
+        prefetchKeys.swap(overlay.touchedKeys);
+        overlays.erase(it);
+    }
+    unlockOverlay();
+}
+
 zkresult HashDBRemote::setProgram (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const Persistence persistence)
 {
 #ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
@@ -392,6 +802,10 @@ zkresult HashDBRemote::flush(const string &batchUUID, const string &newStateRoot
     request.set_new_state_root(newStateRoot);
     request.set_persistence((hashdb::v1::Persistence)persistence);
     ::hashdb::v1::FlushResponse response;
+    if (config.hashDBRemoteBatch)
+    {
+        finishOverlay(batchUUID);
+    }
     grpc::Status s = stub->Flush(&context, request, &response);
     if (s.error_code() != grpc::StatusCode::OK)
     {
@@ -642,6 +1056,10 @@ zkresult HashDBRemote::cancelBatch (const string &batchUUID)
     ::hashdb::v1::CancelBatchRequest request;
     request.set_batch_uuid(batchUUID);
     ::hashdb::v1::CancelBatchResponse response;
+    if (config.hashDBRemoteBatch)
+    {
+        finishOverlay(batchUUID);
+    }
     grpc::Status s = stub->CancelBatch(&context, request, &response);
     if (s.error_code() != grpc::StatusCode::OK)
     {
@@ -7,6 +7,9 @@
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
 #include <sys/time.h>
+#include <pthread.h>
+#include <unordered_map>
+#include <unordered_set>
 #include "hashdb.grpc.pb.h"
 #include "goldilocks_base_field.hpp"
 #include "smt.hpp"
@@ -16,6 +19,43 @@
 #include "timer.hpp"
 #include "database_64.hpp"
 
+// Maximum number of batch overlays, in case some batches are never flushed nor cancelled
+#define HASHDB_REMOTE_MAX_OVERLAYS 64
+
+// Result of a remote get; the result of a given root and key never changes, so it can be reused
+class HashDBRemoteGetEntry
+{
+public:
+    mpz_class value;
+    bool bComplete; // It contains the details and the database read log, so it can serve any get
+    SmtGetResult result;
+    DatabaseMap::MTMap dbReadLog;
+    HashDBRemoteGetEntry() : bComplete(false) {};
+};
+
+// Set done during a batch, so that the value of any key in newRoot can be derived from oldRoot
+class HashDBRemoteSetEntry
+{
+public:
+    string oldRoot;
+    string key;
+    mpz_class value;
+};
+
+// Local overlay of the results of a batch, in batch mode (config.hashDBRemoteBatch)
+class HashDBRemoteOverlay
+{
+public:
+    unordered_map<string, HashDBRemoteGetEntry> gets; // root + key -> get result
+    unordered_map<string, HashDBRemoteSetEntry> sets; // new root -> set
+    vector<KeyValue> touchedKeys; // Keys read or written by this batch, to be prefetched by the next one
+    unordered_set<string> touchedKeySet;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t prefetched;
+    HashDBRemoteOverlay() : hits(0), misses(0), prefetched(0) {};
+};
+
 class HashDBRemote : public HashDBInterface
 {
 private:
@@ -26,6 +66,26 @@ private:
     TimeMetricStorage tms;
     struct timeval t;
 #endif
+
+    // Batch mode attributes
+    pthread_mutex_t overlayMutex; // Mutex to protect overlays and prefetchKeys
+    unordered_map<string, HashDBRemoteOverlay> overlays; // batch UUID -> overlay
+    vector<KeyValue> prefetchKeys; // Keys touched by the last finished batch
+    void lockOverlay (void) { pthread_mutex_lock(&overlayMutex); };
+    void unlockOverlay (void) { pthread_mutex_unlock(&overlayMutex); };
+
+    // Batch mode methods; the overlay ones must be called with the overlay mutex locked
+    HashDBRemoteOverlay & getOverlay (const string &batchUUID, bool &bCreated);
+    bool overlayGet (HashDBRemoteOverlay &overlay, const string &root, const string &key, bool bValueOnly, mpz_class &value, SmtGetResult *result, DatabaseMap *dbReadLog);
+    void overlayTouchKey (HashDBRemoteOverlay &overlay, const string &keyString, const Goldilocks::Element (&key)[4]);
+    zkresult getWithOverlay (const string &batchUUID, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result, DatabaseMap *dbReadLog);
+    zkresult remoteGetBatch (const string &batchUUID, const Goldilocks::Element (&root)[4], const vector<KeyValue> &keyValues, bool bComplete, bool bReadLog, vector<HashDBRemoteGetEntry> &entries);
+    void prefetch (const string &batchUUID, const Goldilocks::Element (&root)[4]);
+    void finishOverlay (const string &batchUUID);
+
+    // Converts the details of a get response
+    void grpc2getResult (const ::hashdb::v1::GetResponse &response, SmtGetResult &result);
+
 public:
     HashDBRemote(Goldilocks &fr, const Config &config);
     ~HashDBRemote();
@@ -35,6 +95,7 @@ public:
     zkresult getLatestStateRoot (Goldilocks::Element (&stateRoot)[4]);
     zkresult set                (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const Persistence persistence, Goldilocks::Element (&newRoot)[4], SmtSetResult *result, DatabaseMap *dbReadLog);
     zkresult get                (const string &batchUUID, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result, DatabaseMap *dbReadLog);
+    zkresult getBatch           (const string &batchUUID, const Goldilocks::Element (&root)[4], vector<KeyValue> &keyValues, DatabaseMap *dbReadLog);
     zkresult setProgram         (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const Persistence persistence);
     zkresult getProgram         (const string &batchUUID, const Goldilocks::Element (&key)[4], vector<uint8_t> &data, DatabaseMap *dbReadLog);
     void     loadDB             (const DatabaseMap::MTMap &input, const bool persistent, const Goldilocks::Element (&stateRoot)[4]);
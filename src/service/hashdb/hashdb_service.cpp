@@ -303,6 +303,72 @@ using grpc::Status;
     return Status::OK;
 }
 
+::grpc::Status HashDBServiceImpl::SetBatch(::grpc::ServerContext* context, const ::hashdb::v1::SetBatchRequest* request, ::hashdb::v1::SetBatchResponse* response)
+{
+#ifdef LOG_HASHDB_SERVICE
+    zklog.info("HashDBServiceImpl::SetBatch() called with " + to_string(request->requests_size()) + " requests chain_roots=" + to_string(request->chain_roots()));
+#endif
+
+    // Execute the sets in order, stopping at the first failure, since the next ones could depend on it
+    zkresult zkr = ZKR_SUCCESS;
+    for (int i=0; i<request->requests_size(); i++)
+    {
+        ::hashdb::v1::SetRequest setRequest = request->requests(i);
+        if (request->chain_roots() && (i > 0))
+        {
+            *setRequest.mutable_old_root() = response->responses(i - 1).new_root();
+        }
+        ::hashdb::v1::SetResponse * setResponse = response->add_responses();
+        ::grpc::Status s = Set(context, &setRequest, setResponse);
+        if (!s.ok())
+        {
+            return s;
+        }
+        zkr = static_cast<zkresult>(setResponse->result().code());
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("HashDBServiceImpl::SetBatch() failed calling Set() of request " + to_string(i) + " of " + to_string(request->requests_size()) + " result=" + zkresult2string(zkr));
+            break;
+        }
+    }
+
+    ::hashdb::v1::ResultCode* rc = new ::hashdb::v1::ResultCode();
+    rc->set_code(static_cast<::hashdb::v1::ResultCode_Code>(zkr));
+    response->set_allocated_result(rc);
+
+    return Status::OK;
+}
+
+::grpc::Status HashDBServiceImpl::GetBatch(::grpc::ServerContext* context, const ::hashdb::v1::GetBatchRequest* request, ::hashdb::v1::GetBatchResponse* response)
+{
+#ifdef LOG_HASHDB_SERVICE
+    zklog.info("HashDBServiceImpl::GetBatch() called with " + to_string(request->requests_size()) + " requests");
+#endif
+
+    // The gets are independent, so all of them are executed and the first failure is reported
+    zkresult zkr = ZKR_SUCCESS;
+    for (int i=0; i<request->requests_size(); i++)
+    {
+        ::hashdb::v1::GetResponse * getResponse = response->add_responses();
+        ::grpc::Status s = Get(context, &request->requests(i), getResponse);
+        if (!s.ok())
+        {
+            return s;
+        }
+        zkresult getResult = static_cast<zkresult>(getResponse->result().code());
+        if ((getResult != ZKR_SUCCESS) && (zkr == ZKR_SUCCESS))
+        {
+            zkr = getResult;
+        }
+    }
+
+    ::hashdb::v1::ResultCode* rc = new ::hashdb::v1::ResultCode();
+    rc->set_code(static_cast<::hashdb::v1::ResultCode_Code>(zkr));
+    response->set_allocated_result(rc);
+
+    return Status::OK;
+}
+
 ::grpc::Status HashDBServiceImpl::SetProgram(::grpc::ServerContext* context, const ::hashdb::v1::SetProgramRequest* request, ::hashdb::v1::SetProgramResponse* response)
 {
     // If the process is exiting, do not start new activities
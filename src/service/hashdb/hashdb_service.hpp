@@ -21,6 +21,8 @@ public:
     ::grpc::Status GetLatestStateRoot (::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::hashdb::v1::GetLatestStateRootResponse* response) override;
     ::grpc::Status Set (::grpc::ServerContext* context, const ::hashdb::v1::SetRequest* request, ::hashdb::v1::SetResponse* response) override;
     ::grpc::Status Get (::grpc::ServerContext* context, const ::hashdb::v1::GetRequest* request, ::hashdb::v1::GetResponse* response) override;
+    ::grpc::Status SetBatch (::grpc::ServerContext* context, const ::hashdb::v1::SetBatchRequest* request, ::hashdb::v1::SetBatchResponse* response) override;
+    ::grpc::Status GetBatch (::grpc::ServerContext* context, const ::hashdb::v1::GetBatchRequest* request, ::hashdb::v1::GetBatchResponse* response) override;
     ::grpc::Status SetProgram (::grpc::ServerContext* context, const ::hashdb::v1::SetProgramRequest* request, ::hashdb::v1::SetProgramResponse* response) override;
     ::grpc::Status GetProgram (::grpc::ServerContext* context, const ::hashdb::v1::GetProgramRequest* request, ::hashdb::v1::GetProgramResponse* response) override;
     ::grpc::Status LoadDB(::grpc::ServerContext* context, const ::hashdb::v1::LoadDBRequest* request, ::google::protobuf::Empty* response);
@@ -27,6 +27,12 @@ const uint16_t chunksPrimeBN254[16] = { 0x3064, 0x4E72, 0xE131, 0xA029, 0xB850,
                                         0x9781, 0x6A91, 0x6871, 0xCA8D, 0x3C20, 0x8C16, 0xD87C, 0xFD47 };
 
 void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
+{
+    executeChunk(action, 0, pols);
+    executeFinal(action.size(), pols);
+}
+
+void ArithExecutor::executeChunk (const vector<ArithAction> &action, uint64_t firstAction, ArithCommitPols &pols)
 {
     // Get a scalar with the bn254 prime
     mpz_class pBN254;
@@ -34,9 +40,9 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
     pBN254++;
 
     // Check that we have enough room in polynomials  TODO: Do this check in JS
-    if (action.size()*32 > N)
+    if ((firstAction + action.size())*32 > N)
     {
-        zklog.error("ArithExecutor::execute() Too many Arith entries=" + to_string(action.size()) + " > N/32=" + to_string(N/32));
+        zklog.error("ArithExecutor::executeChunk() Too many Arith entries=" + to_string(firstAction + action.size()) + " > N/32=" + to_string(N/32));
         exitProcess();
     }
 
@@ -140,7 +146,7 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             fec.sub(aux2, x2, x1);
             if (fec.isZero(aux2))
             {
-                zklog.error("ArithExecutor::execute() divide by zero calculating S for input " + to_string(i));
+                zklog.error("ArithExecutor::executeChunk() divide by zero calculating S for input " + to_string(firstAction + i));
                 exitProcess();
             }
             fec.div(s, aux1, aux2);
@@ -155,13 +161,13 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             q0 = pq0/pFec;
             if ((pq0 - pFec*q0) != 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q0 the residual is not zero (diff point)");
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " with the calculated q0 the residual is not zero (diff point)");
                 exitProcess();
             } 
             q0 += ScalarTwoTo257;
             if(q0 < 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q0 with offset is negative (diff point). Actual value: " + q0.get_str(16));
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " the q0 with offset is negative (diff point). Actual value: " + q0.get_str(16));
                 exitProcess();
             }
         }
@@ -185,13 +191,13 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             q0 = -(pq0/pFec);
             if ((pq0 + pFec*q0) != 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q0 the residual is not zero (same point)");
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " with the calculated q0 the residual is not zero (same point)");
                 exitProcess();
             } 
             q0 += ScalarTwoTo258;
             if(q0 < 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q0 with offset is negative (same point). Actual value: " + q0.get_str(16));
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " the q0 with offset is negative (same point). Actual value: " + q0.get_str(16));
                 exitProcess();
             }
         }
@@ -214,14 +220,14 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             q1 = pq1/pFec;
             if ((pq1 - pFec*q1) != 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q1 the residual is not zero");
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " with the calculated q1 the residual is not zero");
                 exitProcess();
             }
             // offset 
             q1 += 4; //2**2
             if(q1 < 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q1 with offset is negative (point addition). Actual value: " + q1.get_str(16));
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " the q1 with offset is negative (point addition). Actual value: " + q1.get_str(16));
                 exitProcess();
             }
 
@@ -232,14 +238,14 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             q2 = -(pq2/pFec);
             if ((pq2 + pFec*q2) != 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q2 the residual is not zero");
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " with the calculated q2 the residual is not zero");
                 exitProcess();
             }
             //offset 
             q2 += ScalarTwoTo257;
             if(q2 < 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q2 with offset is negative (point addition). Actual value: " + q2.get_str(16));
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " the q2 with offset is negative (point addition). Actual value: " + q2.get_str(16));
                 exitProcess();
             }
 
@@ -253,14 +259,14 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             q1 = -(pq1/pBN254);
             if ((pq1 + pBN254*q1) != 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q1 the residual is not zero");
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " with the calculated q1 the residual is not zero");
                 exitProcess();
             }
             // offset
             q1 += ScalarTwoTo259;
             if(q1 < 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q1 with offset is negative (complex mul). Actual value: " + q1.get_str(16));
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " the q1 with offset is negative (complex mul). Actual value: " + q1.get_str(16));
                 exitProcess();
             }
 
@@ -271,14 +277,14 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             q2 = pq2/pBN254;
             if ((pq2 - pBN254*q2) != 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q2 the residual is not zero");
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " with the calculated q2 the residual is not zero");
                 exitProcess();
             }
             // offset
             q2 += 8; //2**3
             if(q2 < 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q2 with offset is negative (complex mul). Actual value: " + q2.get_str(16));
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " the q2 with offset is negative (complex mul). Actual value: " + q2.get_str(16));
                 exitProcess();
             }
         }
@@ -291,14 +297,14 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             q1 = pq1/pBN254;
             if ((pq1 - pBN254*q1) != 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q1 the residual is not zero");
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " with the calculated q1 the residual is not zero");
                 exitProcess();
             }
             //offset
             q1 += 8; //2**3
             if(q1 < 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q1 with offset is negative (complex add). Actual value: " + q1.get_str(16));
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " the q1 with offset is negative (complex add). Actual value: " + q1.get_str(16));
                 exitProcess();
             }
 
@@ -309,14 +315,14 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             q2 = pq2/pBN254;
             if ((pq2 - pBN254*q2) != 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q2 the residual is not zero");
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " with the calculated q2 the residual is not zero");
                 exitProcess();
             }
             //offset
             q2 += 8; //2**3
             if(q2 < 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q2 with offset is negative (complex add). Actual value: " + q2.get_str(16));
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " the q2 with offset is negative (complex add). Actual value: " + q2.get_str(16));
                 exitProcess();
             }
         }
@@ -329,14 +335,14 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             q1 = -(pq1/pBN254);
             if ((pq1 + pBN254*q1) != 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q1 the residual is not zero");
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " with the calculated q1 the residual is not zero");
                 exitProcess();
             }
             //offset
             q1 += 8; //2**3
             if(q1 < 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q1 with offset is negative (complex sub). Actual value: " + q1.get_str(16));
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " the q1 with offset is negative (complex sub). Actual value: " + q1.get_str(16));
                 exitProcess();
             }
             // Check q2
@@ -347,14 +353,14 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             q2 = -(pq2/pBN254);
             if ((pq2 + pBN254*q2) != 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q2 the residual is not zero");
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " with the calculated q2 the residual is not zero");
                 exitProcess();
             }
             //offset
             q2 += 8; //2**3
             if(q2 < 0)
             {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q2 with offset is negative (complex sub). Actual value: " + q2.get_str(16));
+                zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) + " the q2 with offset is negative (complex sub). Actual value: " + q2.get_str(16));
                 exitProcess();
             }
         }
@@ -383,7 +389,7 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
 //#pragma omp parallel for // TODO: Disabled since OMP decreases performance, probably due to cache invalidations
     for (uint64_t i = 0; i < input.size(); i++)
     {
-        uint64_t offset = i*32;
+        uint64_t offset = (firstAction + i)*32;
         bool xAreDifferent = false;
         bool valueLtPrime = false;
         for (uint64_t step=0; step<32; step++)
@@ -484,13 +490,13 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
                     case 9:  eq[eqIndex] = eq9(fr, pols, step, offset); break;
                     case 10: eq[eqIndex] = eq10(fr, pols, step, offset); break;
                     default:
-                        zklog.error("ArithExecutor::execute() invalid eqIndex=" + to_string(eqIndex));
+                        zklog.error("ArithExecutor::executeChunk() invalid eqIndex=" + to_string(eqIndex));
                         exitProcess();
                 }
                 pols.carry[carryIndex][offset + step] = fr.fromScalar(carry[carryIndex]);
                 if (((eq[eqIndex] + carry[carryIndex]) % ScalarTwoTo16) != 0)
                 {
-                    zklog.error("ArithExecutor::execute() For input " + to_string(i) +
+                    zklog.error("ArithExecutor::executeChunk() For input " + to_string(firstAction + i) +
                         " eq[" + to_string(eqIndex) + "]=" + eq[eqIndex].get_str(16) +
                         " and carry[" + to_string(carryIndex) + "]=" + carry[carryIndex].get_str(16) +
                         " do not sum 0 mod 2 to 16");
@@ -514,5 +520,9 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
         }
     }
     
-    zklog.info("ArithExecutor successfully processed " + to_string(action.size()) + " arith actions (" + to_string((double(action.size())*32*100)/N) + "%)");
+}
+
+void ArithExecutor::executeFinal (uint64_t nActions, ArithCommitPols &pols)
+{
+    zklog.info("ArithExecutor successfully processed " + to_string(nActions) + " arith actions (" + to_string((double(nActions)*32*100)/N) + "%)");
 }
\ No newline at end of file
@@ -35,6 +35,11 @@ public:
     {
     }
     void execute (vector<ArithAction> &action, PROVER_FORK_NAMESPACE::ArithCommitPols &pols);
+
+    // Streaming version: executeChunk() executes the actions in order, starting at action number firstAction,
+    // and executeFinal() completes the polynomials once all nActions have been executed
+    void executeChunk (const vector<ArithAction> &action, uint64_t firstAction, PROVER_FORK_NAMESPACE::ArithCommitPols &pols);
+    void executeFinal (uint64_t nActions, PROVER_FORK_NAMESPACE::ArithCommitPols &pols);
 };
 
 #endif
\ No newline at end of file
@@ -80,11 +80,17 @@ void BinaryExecutor::buildReset (void)
 }
 
 void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &pols)
+{
+    executeChunk(action, 0, pols);
+    executeFinal(action.size(), pols);
+}
+
+void BinaryExecutor::executeChunk (const vector<BinaryAction> &action, uint64_t firstAction, BinaryCommitPols &pols)
 {
     // Check that we have enough room in polynomials  TODO: Do this check in JS
-    if (action.size()*LATCH_SIZE > N)
+    if ((firstAction + action.size())*LATCH_SIZE > N)
     {
-        zklog.error("BinaryExecutor::execute() Too many Binary entries=" + to_string(action.size()) + " > N/LATCH_SIZE=" + to_string(N/LATCH_SIZE));
+        zklog.error("BinaryExecutor::executeChunk() Too many Binary entries=" + to_string(firstAction + action.size()) + " > N/LATCH_SIZE=" + to_string(N/LATCH_SIZE));
         exitProcess();
     }
 
@@ -101,14 +107,6 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
         input.push_back(actionBytes);
     }
 
-    // Local array of N uint32 
-    uint32_t * c0Temp = (uint32_t *)calloc(N*sizeof(uint32_t),1);
-    if (c0Temp == NULL)
-    {
-        zklog.error("BinaryExecutor::execute() failed calling malloc() for c0Temp");
-        exitProcess();
-    }
-
     // Process all the inputs
 //#pragma omp parallel for // TODO: Disabled since OMP decreases performance, probably due to cache invalidations
     for (uint64_t i = 0; i < input.size(); i++)
@@ -120,6 +118,7 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
         }
 #endif
         
+        const uint64_t rowOffset = (firstAction + i)*STEPS;
         const uint64_t opcode = input[i].opcode;
         uint64_t reset4 = opcode == 8 ? 1 : 0;
         Goldilocks::Element previousAreLt4 = fr.zero();
@@ -127,7 +126,7 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
         for (uint64_t j = 0; j < STEPS; j++)
         {
             bool last = (j == (STEPS - 1)) ? true : false;
-            uint64_t index = i*STEPS + j;
+            uint64_t index = rowOffset + j;
             pols.opcode[index] = fr.fromU64(opcode);
 
             Goldilocks::Element cIn = fr.zero();
@@ -356,8 +355,8 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
             pols.a[0][nextIndex] = fr.fromU64( fr.toU64(pols.a[0][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInA[0][index])*FACTOR[0][index] + 256*fr.toU64(pols.freeInA[1][index])*FACTOR[0][index] );
             pols.b[0][nextIndex] = fr.fromU64( fr.toU64(pols.b[0][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInB[0][index])*FACTOR[0][index] + 256*fr.toU64(pols.freeInB[1][index])*FACTOR[0][index] );
 
-            c0Temp[index] = fr.toU64(pols.c[0][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInC[0][index])*FACTOR[0][index] + 256*fr.toU64(pols.freeInC[1][index])*FACTOR[0][index];
-            pols.c[0][nextIndex] = (!fr.isZero(pols.useCarry[index])) ? pols.cOut[index] : (pols.usePreviousAreLt4[index] == fr.one() ? pols.previousAreLt4[index] : fr.fromU64(c0Temp[index]));
+            uint32_t c0Temp = fr.toU64(pols.c[0][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInC[0][index])*FACTOR[0][index] + 256*fr.toU64(pols.freeInC[1][index])*FACTOR[0][index];
+            pols.c[0][nextIndex] = (!fr.isZero(pols.useCarry[index])) ? pols.cOut[index] : (pols.usePreviousAreLt4[index] == fr.one() ? pols.previousAreLt4[index] : fr.fromU64(c0Temp));
 
             for (uint64_t k = 1; k < REGISTERS_NUM; k++)
             {
@@ -376,23 +375,27 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
 
         if (input[i].type == 1)
         {
-            pols.resultBinOp[((i+1) * STEPS)%N] = fr.one();
+            pols.resultBinOp[(rowOffset + STEPS)%N] = fr.one();
         }
         if (input[i].type == 2)
         {
-            pols.resultValidRange [((i+1) * STEPS)%N] = fr.one();
+            pols.resultValidRange [(rowOffset + STEPS)%N] = fr.one();
         }
     }
+}
 
-    for (uint64_t index = input.size()*STEPS; index < N; index++)
+void BinaryExecutor::executeFinal (uint64_t nActions, BinaryCommitPols &pols)
+{
+    // Fill the rest of the evaluations
+    for (uint64_t index = nActions*STEPS; index < N; index++)
     {
         uint64_t nextIndex = (index + 1) % N;
         bool reset = (index % STEPS) == 0 ? true : false;
         pols.a[0][nextIndex] = fr.fromU64( fr.toU64(pols.a[0][index]) * (reset ? 0 : 1) + fr.toU64(pols.freeInA[0][index]) * FACTOR[0][index] + 256 * fr.toU64(pols.freeInA[1][index]) * FACTOR[0][index] );
         pols.b[0][nextIndex] = fr.fromU64( fr.toU64(pols.b[0][index]) * (reset ? 0 : 1) + fr.toU64(pols.freeInB[0][index]) * FACTOR[0][index] + 256 * fr.toU64(pols.freeInB[1][index]) * FACTOR[0][index] );
 
-        c0Temp[index] = fr.toU64(pols.c[0][index]) * (reset ? 0 : 1) + fr.toU64(pols.freeInC[0][index]) * FACTOR[0][index] + 256 * fr.toU64(pols.freeInC[1][index]) * FACTOR[0][index];
-        pols.c[0][nextIndex] = fr.fromU64( fr.toU64(pols.useCarry[index]) * (fr.toU64(pols.cOut[index]) - c0Temp[index]) + c0Temp[index] );
+        uint32_t c0Temp = fr.toU64(pols.c[0][index]) * (reset ? 0 : 1) + fr.toU64(pols.freeInC[0][index]) * FACTOR[0][index] + 256 * fr.toU64(pols.freeInC[1][index]) * FACTOR[0][index];
+        pols.c[0][nextIndex] = fr.fromU64( fr.toU64(pols.useCarry[index]) * (fr.toU64(pols.cOut[index]) - c0Temp) + c0Temp );
 
         for (uint64_t j = 1; j < REGISTERS_NUM; j++)
         {
@@ -402,9 +405,7 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
         }
     }
 
-    free(c0Temp);
-
-    zklog.info("BinaryExecutor successfully processed " + to_string(action.size()) + " binary actions (" + to_string((double(action.size())*LATCH_SIZE*100)/N) + "%)");
+    zklog.info("BinaryExecutor successfully processed " + to_string(nActions) + " binary actions (" + to_string((double(nActions)*LATCH_SIZE*100)/N) + "%)");
 }
 
 // To be used only for testing, since it allocates a lot of memory
@@ -24,6 +24,11 @@ public:
     
     void execute (vector<BinaryAction> &action, PROVER_FORK_NAMESPACE::BinaryCommitPols &pols);
 
+    // Streaming version: executeChunk() executes the actions in order, starting at action number firstAction,
+    // and executeFinal() completes the polynomials once all nActions have been executed
+    void executeChunk (const vector<BinaryAction> &action, uint64_t firstAction, PROVER_FORK_NAMESPACE::BinaryCommitPols &pols);
+    void executeFinal (uint64_t nActions, PROVER_FORK_NAMESPACE::BinaryCommitPols &pols);
+
     void execute (vector<BinaryAction> &action); // Only for testing purposes
 
 private:
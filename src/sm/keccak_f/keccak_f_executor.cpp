@@ -126,9 +126,22 @@ void KeccakFExecutor::loadScript(json j)
 
 /* Input is a vector of numberOfSlots*1600 fe, output is KeccakPols */
 void KeccakFExecutor::execute(const vector<vector<Goldilocks::Element>> &input, KeccakFCommitPols &pols)
+{
+    executePrepare(input, pols);
+
+    // Execute the program
+#pragma omp parallel for
+    for (uint64_t slot = 0; slot < numberOfSlots; slot++)
+    {
+        executeSlots(pols, slot, slot + 1);
+    }
+
+    zklog.info("KeccakFExecutor successfully processed " + to_string(numberOfSlots) + " Keccak-F actions (" + to_string((double(input.size()) * KeccakGateConfig.slotSize * 100) / N) + "%)");
+}
+
+void KeccakFExecutor::executePrepare (const vector<vector<Goldilocks::Element>> &input, KeccakFCommitPols &pols)
 {
     zkassertpermanent(bLoaded);
-    const uint64_t keccakMask = 0xFFFFFFFFFFF;
 
     // Check input size
     if (input.size() != numberOfSlots)
@@ -163,10 +176,13 @@ void KeccakFExecutor::execute(const vector<vector<Goldilocks::Element>> &input,
             setPol(pols.a, KeccakGateConfig.relRef2AbsRef(KeccakGateConfig.sinRef0 + i * 44, slot), fr.toU64(input[slot][i]));
         }
     }
+}
 
-    // Execute the program
-#pragma omp parallel for
-    for (uint64_t slot = 0; slot < numberOfSlots; slot++)
+void KeccakFExecutor::executeSlots (KeccakFCommitPols &pols, uint64_t firstSlot, uint64_t lastSlot)
+{
+    const uint64_t keccakMask = 0xFFFFFFFFFFF;
+
+    for (uint64_t slot = firstSlot; slot < lastSlot; slot++)
     {
         for (uint64_t i = 0; i < program.size(); i++)
         {
@@ -225,8 +241,6 @@ void KeccakFExecutor::execute(const vector<vector<Goldilocks::Element>> &input,
             }
         }
     }
-
-    zklog.info("KeccakFExecutor successfully processed " + to_string(numberOfSlots) + " Keccak-F actions (" + to_string((double(input.size()) * KeccakGateConfig.slotSize * 100) / N) + "%)");
 }
 
 void KeccakFExecutor::setPol(CommitPol (&pol)[4], uint64_t index, uint64_t value)
@@ -69,6 +69,12 @@ public:
     /* Input is a vector of numberOfSlots*1600 fe, output is KeccakPols */
     void execute (const vector<vector<Goldilocks::Element>> &input, PROVER_FORK_NAMESPACE::KeccakFCommitPols &pols);
 
+    /* Split version of the previous one: executePrepare() sets the input, and then executeSlots() can
+       be called concurrently for disjoint ranges of slots [firstSlot, lastSlot) */
+    void executePrepare (const vector<vector<Goldilocks::Element>> &input, PROVER_FORK_NAMESPACE::KeccakFCommitPols &pols);
+    void executeSlots (PROVER_FORK_NAMESPACE::KeccakFCommitPols &pols, uint64_t firstSlot, uint64_t lastSlot);
+    uint64_t getNumberOfSlots (void) const { return numberOfSlots; };
+
     void setPol (PROVER_FORK_NAMESPACE::CommitPol (&pol)[4], uint64_t index, uint64_t value);
     uint64_t getPol (PROVER_FORK_NAMESPACE::CommitPol (&pol)[4], uint64_t index);
 
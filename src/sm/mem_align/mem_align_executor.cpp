@@ -19,11 +19,17 @@ uint8_t getByte (mpz_class value, uint8_t index) {
 
 
 void MemAlignExecutor::execute (vector<MemAlignAction> &input, MemAlignCommitPols &pols)
+{
+    executeChunk(input, 0, pols);
+    executeFinal(input.size(), pols);
+}
+
+void MemAlignExecutor::executeChunk (const vector<MemAlignAction> &input, uint64_t firstAction, MemAlignCommitPols &pols)
 {
     // Check input size 
-    if (input.size()*32 > N)
+    if ((firstAction + input.size())*32 > N)
     {
-        zklog.error("MemAlignExecutor::execute() Too many entries input.size()=" + to_string(input.size()) + " > N/32=" + to_string(N/32));
+        zklog.error("MemAlignExecutor::executeChunk() Too many entries=" + to_string(firstAction + input.size()) + " > N/32=" + to_string(N/32));
         exitProcess();
     }
 
@@ -36,11 +42,11 @@ void MemAlignExecutor::execute (vector<MemAlignAction> &input, MemAlignCommitPol
         uint8_t offset = input[i].offset;
         uint8_t wr8 = input[i].wr8;
         uint8_t wr256 = input[i].wr256;
-        uint64_t polIndex = i * 32;
+        uint64_t polIndex = (firstAction + i) * 32;
         mpz_class vv = v;
         
         // setting index when result was ready
-        uint64_t polResultIndex = ((i+1) * 32)%N;
+        uint64_t polResultIndex = (polIndex + 32)%N;
         if (!(wr8 || wr256)) pols.resultRd[polResultIndex] = fr.one();
         if (wr8) pols.resultWr8[polResultIndex] = fr.one();
         if (wr256) pols.resultWr256[polResultIndex] = fr.one();
@@ -91,11 +97,15 @@ void MemAlignExecutor::execute (vector<MemAlignAction> &input, MemAlignCommitPol
             }
         }
     }
-    for (uint64_t i = (input.size() * 32); i < N; i++) {
+}
+
+void MemAlignExecutor::executeFinal (uint64_t nActions, MemAlignCommitPols &pols)
+{
+    for (uint64_t i = (nActions * 32); i < N; i++) {
         for (uint8_t index = 0; index < 8; index++) {
             pols.factorV[index][i] = fr.fromU64(FACTORV(index, i % 32));
         }
     }    
 
-    zklog.info("MemAlignExecutor successfully processed " + to_string(input.size()) + " memory align actions (" + to_string((double(input.size())*32*100)/N) + "%)");
+    zklog.info("MemAlignExecutor successfully processed " + to_string(nActions) + " memory align actions (" + to_string((double(nActions)*32*100)/N) + "%)");
 }
\ No newline at end of file
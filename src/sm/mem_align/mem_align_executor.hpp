@@ -34,6 +34,11 @@ public:
         config(config),
         N(PROVER_FORK_NAMESPACE::MemAlignCommitPols::pilDegree()) {}
     void execute (vector<MemAlignAction> &input, PROVER_FORK_NAMESPACE::MemAlignCommitPols &pols);
+
+    // Streaming version: executeChunk() executes the actions in order, starting at action number firstAction,
+    // and executeFinal() completes the polynomials once all nActions have been executed
+    void executeChunk (const vector<MemAlignAction> &input, uint64_t firstAction, PROVER_FORK_NAMESPACE::MemAlignCommitPols &pols);
+    void executeFinal (uint64_t nActions, PROVER_FORK_NAMESPACE::MemAlignCommitPols &pols);
 };
 
 #endif
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include <nlohmann/json.hpp>
+#include <algorithm>
+#include <iterator>
 #include "memory_executor.hpp"
 #include "utils.hpp"
 #include "scalar.hpp"
@@ -7,18 +9,28 @@
 
 using json = nlohmann::json;
 
-void MemoryExecutor::execute (vector<MemoryAccess> &input, MemCommitPols &pols)
+class MemoryAccessCompare
 {
-    // Get input size
-    uint64_t inputSize = input.size();
-    uint64_t inputSizeMinusOne = inputSize - 1;
+public:
+    bool operator()(const MemoryAccess &a, const MemoryAccess &b) const
+    {
+        if (a.address == b.address) return a.pc < b.pc;
+        else return a.address < b.address;
+    }
+};
 
-    // Check input size does not exceed the number of evaluations
-    if (inputSize > N)
+class MemoryAccessEqual
+{
+public:
+    bool operator()(const MemoryAccess &a, const MemoryAccess &b) const
     {
-        zklog.error("MemoryExecutor::execute() Too many entries input.size()=" + to_string(input.size()) + " > N=" + to_string(N));
-        exitProcess();
+        return (a.address == b.address) && (a.pc == b.pc);
     }
+};
+
+void MemoryExecutor::execute (vector<MemoryAccess> &input, MemCommitPols &pols)
+{
+    executePrepare(input);
 
     // Reorder
     TimerStart(MEMORY_EXECUTOR_REORDER);
@@ -26,17 +38,42 @@ void MemoryExecutor::execute (vector<MemoryAccess> &input, MemCommitPols &pols)
     reorder(input, access);
     TimerStopAndLog(MEMORY_EXECUTOR_REORDER);
 
-    // We use variables to store the previous values of addr and step
+    executeRows(access, pols, 0, N);
+    executeFinal(access, pols);
+}
+
+void MemoryExecutor::executePrepare (const vector<MemoryAccess> &input)
+{
+    // Check input size does not exceed the number of evaluations
+    if (input.size() > N)
+    {
+        zklog.error("MemoryExecutor::execute() Too many entries input.size()=" + to_string(input.size()) + " > N=" + to_string(N));
+        exitProcess();
+    }
+}
+
+void MemoryExecutor::executeRows (const vector<MemoryAccess> &access, MemCommitPols &pols, uint64_t firstRow, uint64_t lastRow)
+{
+    // Get access size
+    uint64_t accessSize = access.size();
+    uint64_t accessSizeMinusOne = accessSize - 1;
+
+    // We use variables to store the values of addr and step of the last access
     // We need this to complete the "empty" evaluations of the polynomials addr and step
     // We cannot do it with i-1 because we have to "protect" the case that the access list is empty
     Goldilocks::Element lastAddr = fr.zero();
     uint64_t prevStep = 0;
+    if (accessSize > 0)
+    {
+        lastAddr = fr.add(fr.fromU64(access[accessSizeMinusOne].address), fr.one());
+        prevStep = fr.toU64(fr.fromU64(access[accessSizeMinusOne].pc));
+    }
 
     // Counter of the current polynomial evaluation
-    uint64_t i=0;
+    uint64_t i=firstRow;
 
-    // For every input we consume one evaluation
-    for (; i<inputSize; i++)
+    // For every access we consume one evaluation
+    for (; (i<accessSize) && (i<lastRow); i++)
     {
         pols.addr[i] = fr.fromU64(access[i].address);
         pols.step[i] = fr.fromU64(access[i].pc);
@@ -54,7 +91,7 @@ void MemoryExecutor::execute (vector<MemoryAccess> &input, MemCommitPols &pols)
         pols.val[6][i] = access[i].fe6;
         pols.val[7][i] = access[i].fe7;           
     
-        if ( (i < (inputSizeMinusOne)) && 
+        if ( (i < (accessSizeMinusOne)) && 
              (access[i].address == access[i+1].address) )
         {
             //pols.lastAccess[i] = fr.zero(); // Committed pols memory is zero by default
@@ -83,57 +120,46 @@ void MemoryExecutor::execute (vector<MemoryAccess> &input, MemCommitPols &pols)
 #endif
     }
 
-    // If the input list was not empty, get the values from the previous evaluation before breaking the loop
-    if (i > 0)
-    {
-        lastAddr = fr.add(pols.addr[i-1], fr.one());
-        prevStep = fr.toU64(pols.step[i-1]);
-    }
-
-    // After all inputs have been processed, consume the rest of evaluations
-    for (; i<N; i++)
+    // After all accesses have been processed, consume the rest of evaluations
+    for (; i<lastRow; i++)
     {
         // We complete the remaining polynomial evaluations
         // To validate the pil correctly keep last addr incremented +1 and increment the step respect to the previous value
         pols.addr[i] = lastAddr;
-        prevStep++;
-        pols.step[i] = fr.fromU64(prevStep);
+        pols.step[i] = fr.fromU64(prevStep + (i + 1 - accessSize));
     }
-    
+}
+
+void MemoryExecutor::executeFinal (const vector<MemoryAccess> &access, MemCommitPols &pols)
+{
     // pols.lastAccess = 1 in the last evaluation to ensure ciclical validation
     pols.lastAccess[N-1] = fr.one();
 
     zklog.info("MemoryExecutor successfully processed " + to_string(access.size()) + " memory accesses (" + to_string((double(access.size())*100)/N) + "%)");
 }
 
-class MemoryAccessCompare
-{
-public:
-    bool operator()(const MemoryAccess &a, const MemoryAccess &b) const
-    {
-        if (a.address == b.address) return a.pc < b.pc;
-        else return a.address < b.address;
-    }
-};
-
 void MemoryExecutor::reorder (const vector<MemoryAccess> &input, vector<MemoryAccess> &output)
 {
-    // Clear output vector
-    output.clear();
+    reorder(input, 0, input.size(), output);
+}
 
-    // Map input MemoryAccess entries using the MemoryAccessCompare class to order them
-    map<MemoryAccess, uint64_t, MemoryAccessCompare> auxMap;
-    for (uint64_t i=0; i<input.size(); i++)
-    {
-        auxMap[input[i]] = i;
-    }
+void MemoryExecutor::reorder (const vector<MemoryAccess> &input, uint64_t first, uint64_t last, vector<MemoryAccess> &output)
+{
+    // Copy the input range and sort it using the MemoryAccessCompare class; the sort is stable, so of the entries
+    // with the same address and pc only the first one of the input is kept
+    output.assign(input.begin() + first, input.begin() + last);
+    stable_sort(output.begin(), output.end(), MemoryAccessCompare());
+    output.erase(unique(output.begin(), output.end(), MemoryAccessEqual()), output.end());
+}
 
-    // Copy data from the map to the output vector, in the map order
-    map<MemoryAccess, uint64_t, MemoryAccessCompare>::const_iterator auxMapIterator;
-    for (auxMapIterator = auxMap.begin(); auxMapIterator != auxMap.end(); auxMapIterator++)
-    {
-        output.push_back(auxMapIterator->first);
-    }
+void MemoryExecutor::reorderMerge (const vector<MemoryAccess> &first, const vector<MemoryAccess> &second, vector<MemoryAccess> &output)
+{
+    // merge() places the entries of the first list before the equal entries of the second one, so unique() keeps
+    // the first one of the input, as reorder() does
+    output.clear();
+    output.reserve(first.size() + second.size());
+    merge(first.begin(), first.end(), second.begin(), second.end(), back_inserter(output), MemoryAccessCompare());
+    output.erase(unique(output.begin(), output.end(), MemoryAccessEqual()), output.end());
 }
 
 void MemoryExecutor::print (const vector<MemoryAccess> &access, Goldilocks &fr)
@@ -37,11 +37,24 @@ public:
 
     void execute (vector<MemoryAccess> &input, PROVER_FORK_NAMESPACE::MemCommitPols &pols);
 
+    /* Split version of the previous one: executePrepare() checks the input, reorder() of disjoint ranges of the
+       input and reorderMerge() of the resulting lists can be called in parallel to get the access list, then
+       executeRows() can be called in parallel for disjoint ranges of evaluations, and executeFinal() completes
+       the last evaluation */
+    void executePrepare (const vector<MemoryAccess> &input);
+    void executeRows (const vector<MemoryAccess> &access, PROVER_FORK_NAMESPACE::MemCommitPols &pols, uint64_t firstRow, uint64_t lastRow);
+    void executeFinal (const vector<MemoryAccess> &access, PROVER_FORK_NAMESPACE::MemCommitPols &pols);
+
     /* Reorder access list by the following criteria:
         - In order of incremental address
         - If addresses are the same, in order ov incremental pc
+       Repeated entries with the same address and pc are removed, keeping the first one
     */
     void reorder (const vector<MemoryAccess> &input, vector<MemoryAccess> &output);
+    void reorder (const vector<MemoryAccess> &input, uint64_t first, uint64_t last, vector<MemoryAccess> &output);
+
+    /* Merges the reordered lists of two consecutive ranges of the input, the first range first */
+    void reorderMerge (const vector<MemoryAccess> &first, const vector<MemoryAccess> &second, vector<MemoryAccess> &output);
     
     /* Prints access list contents, for debugging purposes */
     void print (const vector<MemoryAccess> &action, Goldilocks &fr);
@@ -46,7 +46,15 @@ uint64_t PaddingPGExecutor::prepareInput (vector<PaddingPGExecutorInput> &input)
 }
 
 void PaddingPGExecutor::execute (vector<PaddingPGExecutorInput> &input, PaddingPGCommitPols &pols, vector<array<Goldilocks::Element, 17>> &required)
-{    
+{
+    vector<uint64_t> firstRow;
+    executePrepare(input, pols, firstRow);
+    executeInputs(input, firstRow, pols, required, 0, input.size());
+    executeFinal(input, firstRow, pols, required);
+}
+
+void PaddingPGExecutor::executePrepare (vector<PaddingPGExecutorInput> &input, PaddingPGCommitPols &pols, vector<uint64_t> &firstRow)
+{
     uint64_t totalInputBytes = prepareInput(input);
 
     // Check input size
@@ -56,19 +64,27 @@ void PaddingPGExecutor::execute (vector<PaddingPGExecutorInput> &input, PaddingP
         exitProcess();
     }
 
-    uint64_t p = 0;
-    uint64_t pDone = 0;
+    // Every input takes one evaluation per padded byte, so the first evaluation of every input is known in advance
+    firstRow.resize(input.size() + 1);
+    firstRow[0] = 0;
+    for (uint64_t i=0; i<input.size(); i++)
+    {
+        firstRow[i+1] = firstRow[i] + input[i].dataBytes.size();
+    }
 
-    uint64_t addr = 0;
+    pols.incCounter[0] = fr.one();
+}
 
+void PaddingPGExecutor::executeInputs (vector<PaddingPGExecutorInput> &input, const vector<uint64_t> &firstRow, PaddingPGCommitPols &pols, vector<array<Goldilocks::Element, 17>> &required, uint64_t firstInput, uint64_t lastInput)
+{
     CommitPol crF[8] = { pols.crF0, pols.crF1, pols.crF2, pols.crF3, pols.crF4, pols.crF5, pols.crF6, pols.crF7 };
 
     CommitPol crV[8] = { pols.crV0, pols.crV1, pols.crV2, pols.crV3, pols.crV4, pols.crV5, pols.crV6, pols.crV7 };
 
-    pols.incCounter[p] = fr.one();
-
-    for (uint64_t i=0; i<input.size(); i++)
+    for (uint64_t i=firstInput; i<lastInput; i++)
     {
+        uint64_t p = firstRow[i];
+        uint64_t addr = i;
 
         int64_t curRead = -1;
         uint64_t lastOffset = 0;
@@ -77,23 +93,30 @@ void PaddingPGExecutor::execute (vector<PaddingPGExecutorInput> &input, PaddingP
         {
 
             pols.freeIn[p] = fr.fromU64(input[i].dataBytes[j]);
+
+            // The previous input ends with a full block, so at the first byte of an input acc and prevHash
+            // are zero and incCounter is one; they are not read from the evaluation written by the previous
+            // input, which can be executed by another task (crV is not written by the last byte of an input,
+            // which is always padding, with crOffset zero)
+            bool bFirstByte = (j == 0);
             
             uint64_t acci = (j % bytesPerBlock) / bytesPerElement;
             uint64_t sh = (j % bytesPerElement)*8;
             for (uint64_t k=0; k<nElements; k++)
             {
+                Goldilocks::Element acc = bFirstByte ? fr.zero() : pols.acc[k][p];
                 if (k == acci) {
-                    pols.acc[k][p+1] = fr.fromU64( fr.toU64(pols.acc[k][p]) | (fr.toU64(pols.freeIn[p]) << sh) );
+                    pols.acc[k][p+1] = fr.fromU64( fr.toU64(acc) | (fr.toU64(pols.freeIn[p]) << sh) );
                 } else {
-                    pols.acc[k][p+1] = pols.acc[k][p];
+                    pols.acc[k][p+1] = acc;
                 }
             }
 
-            pols.prevHash0[p+1] = pols.prevHash0[p];
-            pols.prevHash1[p+1] = pols.prevHash1[p];
-            pols.prevHash2[p+1] = pols.prevHash2[p];
-            pols.prevHash3[p+1] = pols.prevHash3[p];
-            pols.incCounter[p+1] = pols.incCounter[p];
+            pols.prevHash0[p+1] = bFirstByte ? fr.zero() : pols.prevHash0[p];
+            pols.prevHash1[p+1] = bFirstByte ? fr.zero() : pols.prevHash1[p];
+            pols.prevHash2[p+1] = bFirstByte ? fr.zero() : pols.prevHash2[p];
+            pols.prevHash3[p+1] = bFirstByte ? fr.zero() : pols.prevHash3[p];
+            pols.incCounter[p+1] = bFirstByte ? fr.one() : pols.incCounter[p];
 
             pols.len[p] = fr.fromU64(input[i].realLen);
             pols.addr[p] = fr.fromU64(addr);
@@ -224,10 +247,15 @@ void PaddingPGExecutor::execute (vector<PaddingPGExecutorInput> &input, PaddingP
 
             p += 1;
         }
-        addr += 1;
     }
+}
+
+void PaddingPGExecutor::executeFinal (vector<PaddingPGExecutorInput> &input, const vector<uint64_t> &firstRow, PaddingPGCommitPols &pols, vector<array<Goldilocks::Element, 17>> &required)
+{
+    uint64_t p = firstRow[input.size()];
+    uint64_t pDone = p;
 
-    pDone = p;
+    uint64_t addr = input.size();
 
     uint64_t nFullUnused = ((N - p - 1)/bytesPerBlock)+1;
 
@@ -47,6 +47,14 @@ public:
         bytesPerBlock(bytesPerElement*nElements),
         N(PROVER_FORK_NAMESPACE::PaddingPGCommitPols::pilDegree()) {};
     void execute (vector<PaddingPGExecutorInput> &input, PROVER_FORK_NAMESPACE::PaddingPGCommitPols &pols, vector<array<Goldilocks::Element, 17>> &required);
+
+    /* Split version of the previous one: executePrepare() pads the input and computes the first evaluation
+       of every input, then executeInputs() can be called in parallel for disjoint ranges of inputs, each one
+       with its own required list, and executeFinal() fills the unused evaluations.  The required lists must
+       be appended in input order, before the one of executeFinal() */
+    void executePrepare (vector<PaddingPGExecutorInput> &input, PROVER_FORK_NAMESPACE::PaddingPGCommitPols &pols, vector<uint64_t> &firstRow);
+    void executeInputs (vector<PaddingPGExecutorInput> &input, const vector<uint64_t> &firstRow, PROVER_FORK_NAMESPACE::PaddingPGCommitPols &pols, vector<array<Goldilocks::Element, 17>> &required, uint64_t firstInput, uint64_t lastInput);
+    void executeFinal (vector<PaddingPGExecutorInput> &input, const vector<uint64_t> &firstRow, PROVER_FORK_NAMESPACE::PaddingPGCommitPols &pols, vector<array<Goldilocks::Element, 17>> &required);
 };
 
 
@@ -104,15 +104,80 @@ Goldilocks::Element C[] = {
     0, 0, 0, 0
 };
 
+// Reduces x < 2^96 modulo the Goldilocks prime, since 2^64 = 2^32 - 1 (mod p)
+static inline uint64_t reduce96 (__uint128_t x)
+{
+    uint64_t lo = (uint64_t)x;
+    uint64_t hi = (uint64_t)(x >> 64);
+    uint64_t t = hi * 0xFFFFFFFFULL;
+    uint64_t r = lo + t;
+    if (r < lo) r += 0xFFFFFFFFULL; // Carry; it cannot overflow again since r < t <= 2^64 - 2^33 + 1
+    if (r >= 0xFFFFFFFF00000001ULL) r -= 0xFFFFFFFF00000001ULL;
+    return r;
+}
+
+// Computes one round of the permutation over state, in place
+void PoseidonGExecutor::round (Goldilocks::Element (&state)[12], uint64_t r)
+{
+    for (uint64_t s=0; s<12; s++)
+    {
+        state[s] = fr.add(state[s], C[r*t + s]);
+    }
+
+    if ( (r < (nRoundsF/2)) || (r >= ((nRoundsF/2) + nRoundsP)) )
+    {
+        for (uint64_t s=0; s<12; s++)
+        {
+            state[s] = pow7(state[s]);
+        }
+    }
+    else
+    {
+        state[0] = pow7(state[0]);
+    }
+
+    // M is a circulant matrix of small coefficients plus MDIAG, so every row can be accumulated in
+    // 128 bits and reduced once, instead of doing 12 field multiplications and additions
+    uint64_t in[12];
+    for (uint64_t s=0; s<12; s++)
+    {
+        in[s] = fr.toU64(state[s]);
+    }
+    for (uint64_t x=0; x<12; x++)
+    {
+        __uint128_t acc = (__uint128_t)in[x] * MDIAG_U64[x];
+        for (uint64_t y=0; y<12; y++)
+        {
+            acc += (__uint128_t)in[y] * MCIRC_U64[(y + 12 - x) % 12];
+        }
+        state[x] = fr.fromU64(reduce96(acc));
+    }
+}
+
 void PoseidonGExecutor::execute (   vector<array<Goldilocks::Element, 17>> &inputMain,
                                     vector<array<Goldilocks::Element, 17>> &inputPadding, 
                                     vector<array<Goldilocks::Element, 17>> &inputStorage, 
                                     PoseidonGCommitPols &pols)
 {
-    uint64_t sizeMain = inputMain.size();
-    uint64_t sizePadding = inputPadding.size();
-    uint64_t sizeStorage = inputStorage.size();
-    uint64_t size = sizeMain + sizePadding + sizeStorage;
+    executePrepare(inputMain, inputPadding, inputStorage);
+
+    // Every slot is independent, since its rows are known from the input sizes
+#pragma omp parallel for schedule(static, 256)
+    for (uint64_t slot=0; slot<numberOfSlots; slot++)
+    {
+        executeSlots(inputMain, inputPadding, inputStorage, pols, slot, slot + 1);
+    }
+
+    uint64_t size = inputMain.size() + inputPadding.size() + inputStorage.size();
+    uint64_t pDone = size*slotSize;
+    zklog.info("PoseidonGExecutor successfully processed " + to_string(size) + " Poseidon hashes p=" + to_string(N) + " pDone=" + to_string(pDone) + " (" + to_string((double(pDone)*100)/N) + "%)");
+}
+
+void PoseidonGExecutor::executePrepare (   vector<array<Goldilocks::Element, 17>> &inputMain,
+                                           vector<array<Goldilocks::Element, 17>> &inputPadding, 
+                                           vector<array<Goldilocks::Element, 17>> &inputStorage)
+{
+    uint64_t size = inputMain.size() + inputPadding.size() + inputStorage.size();
 
     // Check input size
     if (size > maxHashes)
@@ -121,205 +186,159 @@ void PoseidonGExecutor::execute (   vector<array<Goldilocks::Element, 17>> &inpu
         exitProcess();
     }
 
-    uint64_t p = 0;
-    uint64_t pDone = 0;
-
-    vector<array<Goldilocks::Element, 17>> * input = NULL;
-    uint64_t sizeIn=0;
-
-    for(int k=0; k<3; k++){
-        
-        //Select input
-        if(k==0){
-            input = &inputMain;
-            sizeIn = sizeMain;
-        } else if(k==1){
-            input = &inputPadding;
-            sizeIn = sizePadding;
-        } else if(k==2){
-            input = &inputStorage;
-            sizeIn = sizeStorage;
-        }
-        
-        //Execute
-        for (uint64_t i=0; i<sizeIn; i++)
+    // Check permutations, so that slots do not need to report errors
+    vector<array<Goldilocks::Element, 17>> * input[3] = { &inputMain, &inputPadding, &inputStorage };
+    for (uint64_t k=0; k<3; k++)
+    {
+        for (uint64_t i=0; i<input[k]->size(); i++)
         {
-            
-            pols.in0[p] = (*input)[i][0];
-            pols.in1[p] = (*input)[i][1];
-            pols.in2[p] = (*input)[i][2];
-            pols.in3[p] = (*input)[i][3];
-            pols.in4[p] = (*input)[i][4];
-            pols.in5[p] = (*input)[i][5];
-            pols.in6[p] = (*input)[i][6];
-            pols.in7[p] = (*input)[i][7];
-            pols.hashType[p] = (*input)[i][8];
-            pols.cap1[p] = (*input)[i][9];
-            pols.cap2[p] = (*input)[i][10];
-            pols.cap3[p] = (*input)[i][11];
-            pols.hash0[p] = (*input)[i][12];
-            pols.hash1[p] = (*input)[i][13];
-            pols.hash2[p] = (*input)[i][14];
-            pols.hash3[p] = (*input)[i][15];
-            uint64_t permutation = fr.toU64((*input)[i][16]);
-            switch (permutation)
+            uint64_t permutation = fr.toU64((*input[k])[i][16]);
+            if ((permutation != POSEIDONG_PERMUTATION1_ID) &&
+                (permutation != POSEIDONG_PERMUTATION2_ID) &&
+                (permutation != POSEIDONG_PERMUTATION3_ID) &&
+                (permutation != POSEIDONG_PERMUTATION4_ID))
             {
-                case POSEIDONG_PERMUTATION1_ID:
-                    pols.result1[p] = fr.one();
-                    break;
-                case POSEIDONG_PERMUTATION2_ID:
-                    pols.result2[p] = fr.one();
-                    break;
-                case POSEIDONG_PERMUTATION3_ID:
-                    pols.result3[p] = fr.one();
-                    break;
-                case POSEIDONG_PERMUTATION4_ID:
-                    // pols.result4[p] = fr.one();
-                    break;
-                default:
-                    zklog.error("PoseidonGExecutor::execute() got an invalid permutation=" + to_string(permutation) + " at input k=" + to_string(k) + " i=" + to_string(i));
-                    exitProcess();
-                    break;
-            }
-
-            p += 1;
-            
-            array<Goldilocks::Element,12> state= {
-                pols.in0[p-1], 
-                pols.in1[p-1], 
-                pols.in2[p-1], 
-                pols.in3[p-1], 
-                pols.in4[p-1], 
-                pols.in5[p-1], 
-                pols.in6[p-1], 
-                pols.in7[p-1], 
-                pols.hashType[p-1], 
-                pols.cap1[p-1], 
-                pols.cap2[p-1], 
-                pols.cap3[p-1] };
-
-            for (uint64_t r=0; r < nRoundsF + nRoundsP; r++)
-            {
-                for (uint64_t s=0; s<12; s++)
-                {
-                    state[s] = fr.add(state[s], C[r*t + s]);
-                }
-
-                if ( (r < (nRoundsF/2)) || (r >= ((nRoundsF/2) + nRoundsP)) )
-                {
-                    for (uint64_t s=0; s<12; s++)
-                    {
-                        state[s] = pow7(state[s]);
-                    }
-                }
-                else
-                {
-                    state[0] = pow7(state[0]);
-                }
-
-                Goldilocks::Element acc[12];
-                for (uint64_t x=0; x<state.size(); x++)
-                {
-                    acc[x] = fr.zero();
-                    for (uint64_t y=0; y<state.size(); y++)
-                    {
-                        acc[x] = fr.add(acc[x], fr.mul(state[y], M[x][y]));
-                    }
-                }
-                for (uint64_t x=0; x<state.size(); x++)
-                {
-                    state[x] = acc[x];
-                }
-
-                pols.in0[p] = state[0];
-                pols.in1[p] = state[1];
-                pols.in2[p] = state[2];
-                pols.in3[p] = state[3];
-                pols.in4[p] = state[4];
-                pols.in5[p] = state[5];
-                pols.in6[p] = state[6];
-                pols.in7[p] = state[7];
-                pols.hashType[p] = state[8];
-                pols.cap1[p] = state[9];
-                pols.cap2[p] = state[10];
-                pols.cap3[p] = state[11];
-                pols.hash0[p] = (*input)[i][12];
-                pols.hash1[p] = (*input)[i][13];
-                pols.hash2[p] = (*input)[i][14];
-                pols.hash3[p] = (*input)[i][15];
-                p+=1;
+                zklog.error("PoseidonGExecutor::execute() got an invalid permutation=" + to_string(permutation) + " at input k=" + to_string(k) + " i=" + to_string(i));
+                exitProcess();
             }
         }
     }
+}
 
-    vector<array<Goldilocks::Element,12>> st0;
-
-    array<Goldilocks::Element, 12> aux;
-    for (uint64_t i=0; i<12; i++)
-    {
-        aux[i] = fr.zero();
-    };
-    st0.push_back(aux);
+/*
+    Slots are consecutive groups of slotSize rows: the first rows contain the hashes of inputMain, then
+    inputPadding and then inputStorage, in this order; the rest of slots contain the hash of a zero input,
+    the last one possibly truncated at N
+*/
+void PoseidonGExecutor::executeSlots (  vector<array<Goldilocks::Element, 17>> &inputMain,
+                                        vector<array<Goldilocks::Element, 17>> &inputPadding, 
+                                        vector<array<Goldilocks::Element, 17>> &inputStorage, 
+                                        PoseidonGCommitPols &pols,
+                                        uint64_t firstSlot,
+                                        uint64_t lastSlot)
+{
+    uint64_t sizeMain = inputMain.size();
+    uint64_t sizePadding = inputPadding.size();
+    uint64_t sizeStorage = inputStorage.size();
+    uint64_t size = sizeMain + sizePadding + sizeStorage;
 
-    for (uint64_t r=0; r<nRoundsF + nRoundsP; r++)
+    for (uint64_t slot=firstSlot; slot<lastSlot; slot++)
     {
-        for (uint64_t s=0; s<12; s++)
-        {
-            aux[s] = fr.add(st0[r][s], C[r*t + s]);
-        }
-        st0.push_back(aux);
+        uint64_t p = slot*slotSize;
 
-        if ( (r < (nRoundsF/2)) || (r >= ((nRoundsF/2) + nRoundsP)) )
+        // Zero input slots
+        if (slot >= size)
         {
-            for (uint64_t s=0; s<12; s++)
+            for (uint64_t r=0; (r < slotSize) && (p < N); r++, p++)
             {
-                st0[r+1][s] = pow7(st0[r+1][s]);
+                pols.in0[p] = st0[r][0];
+                pols.in1[p] = st0[r][1];
+                pols.in2[p] = st0[r][2];
+                pols.in3[p] = st0[r][3];
+                pols.in4[p] = st0[r][4];
+                pols.in5[p] = st0[r][5];
+                pols.in6[p] = st0[r][6];
+                pols.in7[p] = st0[r][7];
+                pols.hashType[p] = st0[r][8];
+                pols.cap1[p] = st0[r][9];
+                pols.cap2[p] = st0[r][10];
+                pols.cap3[p] = st0[r][11];
+                pols.hash0[p] = st0[nRoundsP + nRoundsF][0];
+                pols.hash1[p] = st0[nRoundsP + nRoundsF][1];
+                pols.hash2[p] = st0[nRoundsP + nRoundsF][2];
+                pols.hash3[p] = st0[nRoundsP + nRoundsF][3];
             }
+            continue;
         }
-        else
+
+        // Select input
+        const array<Goldilocks::Element, 17> &in =
+            (slot < sizeMain) ? inputMain[slot] :
+            (slot < sizeMain + sizePadding) ? inputPadding[slot - sizeMain] :
+            inputStorage[slot - sizeMain - sizePadding];
+
+        pols.in0[p] = in[0];
+        pols.in1[p] = in[1];
+        pols.in2[p] = in[2];
+        pols.in3[p] = in[3];
+        pols.in4[p] = in[4];
+        pols.in5[p] = in[5];
+        pols.in6[p] = in[6];
+        pols.in7[p] = in[7];
+        pols.hashType[p] = in[8];
+        pols.cap1[p] = in[9];
+        pols.cap2[p] = in[10];
+        pols.cap3[p] = in[11];
+        pols.hash0[p] = in[12];
+        pols.hash1[p] = in[13];
+        pols.hash2[p] = in[14];
+        pols.hash3[p] = in[15];
+        uint64_t permutation = fr.toU64(in[16]);
+        switch (permutation)
         {
-            st0[r+1][0] = pow7(st0[r+1][0]);
+            case POSEIDONG_PERMUTATION1_ID:
+                pols.result1[p] = fr.one();
+                break;
+            case POSEIDONG_PERMUTATION2_ID:
+                pols.result2[p] = fr.one();
+                break;
+            case POSEIDONG_PERMUTATION3_ID:
+                pols.result3[p] = fr.one();
+                break;
+            default: // POSEIDONG_PERMUTATION4_ID, checked in executePrepare()
+                // pols.result4[p] = fr.one();
+                break;
         }
 
-        Goldilocks::Element acc[12];
-        for (uint64_t x=0; x<st0[r+1].size(); x++)
+        p += 1;
+
+        Goldilocks::Element state[12];
+        for (uint64_t s=0; s<12; s++)
         {
-            acc[x] = fr.zero();
-            for (uint64_t y=0; y<st0[r+1].size(); y++)
-            {
-                acc[x] = fr.add(acc[x], fr.mul(st0[r+1][y], M[x][y]));
-            }
+            state[s] = in[s];
         }
-        for (uint64_t x=0; x<st0[r+1].size(); x++)
+
+        for (uint64_t r=0; r < nRoundsF + nRoundsP; r++)
         {
-            st0[r+1][x] = acc[x];
+            round(state, r);
+
+            pols.in0[p] = state[0];
+            pols.in1[p] = state[1];
+            pols.in2[p] = state[2];
+            pols.in3[p] = state[3];
+            pols.in4[p] = state[4];
+            pols.in5[p] = state[5];
+            pols.in6[p] = state[6];
+            pols.in7[p] = state[7];
+            pols.hashType[p] = state[8];
+            pols.cap1[p] = state[9];
+            pols.cap2[p] = state[10];
+            pols.cap3[p] = state[11];
+            pols.hash0[p] = in[12];
+            pols.hash1[p] = in[13];
+            pols.hash2[p] = in[14];
+            pols.hash3[p] = in[15];
+            p+=1;
         }
     }
+}
 
-    pDone = p;
-
-    while ( p < N ) // TODO: Can we skip this final part?
+void PoseidonGExecutor::initZeroSlot (void)
+{
+    Goldilocks::Element state[12];
+    for (uint64_t s=0; s<12; s++)
     {
-        pols.in0[p] = st0[p%(nRoundsP + nRoundsF + 1)][0];
-        pols.in1[p] = st0[p%(nRoundsP + nRoundsF + 1)][1];
-        pols.in2[p] = st0[p%(nRoundsP + nRoundsF + 1)][2];
-        pols.in3[p] = st0[p%(nRoundsP + nRoundsF + 1)][3];
-        pols.in4[p] = st0[p%(nRoundsP + nRoundsF + 1)][4];
-        pols.in5[p] = st0[p%(nRoundsP + nRoundsF + 1)][5];
-        pols.in6[p] = st0[p%(nRoundsP + nRoundsF + 1)][6];
-        pols.in7[p] = st0[p%(nRoundsP + nRoundsF + 1)][7];
-        pols.hashType[p] = st0[p%(nRoundsP + nRoundsF + 1)][8];
-        pols.cap1[p] = st0[p%(nRoundsP + nRoundsF + 1)][9];
-        pols.cap2[p] = st0[p%(nRoundsP + nRoundsF + 1)][10];
-        pols.cap3[p] = st0[p%(nRoundsP + nRoundsF + 1)][11];
-        pols.hash0[p] = st0[nRoundsP + nRoundsF][0];
-        pols.hash1[p] = st0[nRoundsP + nRoundsF][1];
-        pols.hash2[p] = st0[nRoundsP + nRoundsF][2];
-        pols.hash3[p] = st0[nRoundsP + nRoundsF][3];
-        p+=1;
+        state[s] = fr.zero();
+        st0[0][s] = state[s];
+    }
+    for (uint64_t r=0; r<nRoundsF + nRoundsP; r++)
+    {
+        round(state, r);
+        for (uint64_t s=0; s<12; s++)
+        {
+            st0[r + 1][s] = state[s];
+        }
     }
-
-    zklog.info("PoseidonGExecutor successfully processed " + to_string(size) + " Poseidon hashes p=" + to_string(p) + " pDone=" + to_string(pDone) + " (" + to_string((double(pDone)*100)/N) + "%)");
 }
 
 Goldilocks::Element PoseidonGExecutor::pow7 (Goldilocks::Element &a)
@@ -329,4 +348,3 @@ Goldilocks::Element PoseidonGExecutor::pow7 (Goldilocks::Element &a)
     Goldilocks::Element a3 = fr.mul(a, a2);
     return fr.mul(a3, a4);
 }
-
@@ -21,10 +21,17 @@ private:
     const uint64_t t;
     const uint64_t nRoundsF;
     const uint64_t nRoundsP;
+    const uint64_t slotSize; // Rows per hash: the input plus one row per round
     const uint64_t maxHashes;
+    const uint64_t numberOfSlots; // Including the last one, possibly truncated at N
     const array<Goldilocks::Element,12> MCIRC;
     const array<Goldilocks::Element,12> MDIAG;
-    array<array<Goldilocks::Element,12>,12> M;
+    uint64_t MCIRC_U64[12];
+    uint64_t MDIAG_U64[12];
+    vector<array<Goldilocks::Element,12>> st0; // Rows of the hash of a zero input, used to fill the unused slots
+
+    void round (Goldilocks::Element (&state)[12], uint64_t r);
+    void initZeroSlot (void);
 public:
     PoseidonGExecutor(Goldilocks &fr, PoseidonGoldilocks &poseidon) :
         fr(fr),
@@ -33,26 +40,37 @@ public:
         t(12),
         nRoundsF(8),
         nRoundsP(22),
-        maxHashes(N / (nRoundsF + nRoundsP + 1)),
+        slotSize(nRoundsF + nRoundsP + 1),
+        maxHashes(N / slotSize),
+        numberOfSlots((N + slotSize - 1) / slotSize),
         MCIRC({17, 15, 41, 16, 2, 28, 13, 13, 39, 18, 34, 20}),
-        MDIAG({8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0})
+        MDIAG({8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}),
+        st0(slotSize)
     {
         for (uint64_t i = 0; i < 12; i++)
         {
-            for (uint64_t j = 0; j < 12; j++)
-            {
-                M[i][j] = MCIRC[(-i + j + 12) % 12];
-                if (i==j)
-                {
-                    M[i][j] = fr.add(M[i][j], MDIAG[i]);
-                }
-            }
+            MCIRC_U64[i] = fr.toU64(MCIRC[i]);
+            MDIAG_U64[i] = fr.toU64(MDIAG[i]);
         }
+        initZeroSlot();
     };
     void execute (  vector<array<Goldilocks::Element, 17>> &inputMain,
                     vector<array<Goldilocks::Element, 17>> &inputPadding, 
                     vector<array<Goldilocks::Element, 17>> &inputStorage, 
                     PoseidonGCommitPols &pols);
+
+    /* Split version of the previous one: executePrepare() checks the input, and then executeSlots() can
+       be called in parallel for disjoint ranges of slots, since every slot fills its own rows */
+    void executePrepare (   vector<array<Goldilocks::Element, 17>> &inputMain,
+                            vector<array<Goldilocks::Element, 17>> &inputPadding, 
+                            vector<array<Goldilocks::Element, 17>> &inputStorage);
+    void executeSlots ( vector<array<Goldilocks::Element, 17>> &inputMain,
+                        vector<array<Goldilocks::Element, 17>> &inputPadding, 
+                        vector<array<Goldilocks::Element, 17>> &inputStorage, 
+                        PoseidonGCommitPols &pols,
+                        uint64_t firstSlot,
+                        uint64_t lastSlot);
+    uint64_t getNumberOfSlots (void) const { return numberOfSlots; };
     Goldilocks::Element pow7(Goldilocks::Element &a);
 };
 
@@ -39,17 +39,18 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 
         // Current rom line is set by the program counter of this evaluation
         l = fr.toU64(pols.pc[i]);
+        const StorageRomLine &romLine = rom.line[l];
 
         // Set the next evaluation index, which will be 0 when we reach the last evaluation
         uint64_t nexti = (i+1)%N;
 
 #ifdef LOG_STORAGE_EXECUTOR_ROM_LINE
         string source = "";
-        if (rom.line[l].funcName!="isAlmostEndPolynomial")
+        if (romLine.funcCode != srf_isAlmostEndPolynomial)
         {
-            source = rom.line[l].fileName.substr(8, rom.line[l].fileName.length() - 14) + ":" + to_string(rom.line[l].line);
-            printf("[SR%04d I%03d %-28s] %s\n", (int)l, (int)a, source.c_str(), rom.line[l].lineStr.c_str());
-            // rom.line[l].print(l); // Print the rom line content
+            source = romLine.fileName.substr(8, romLine.fileName.length() - 14) + ":" + to_string(romLine.line);
+            printf("[SR%04d I%03d %-28s] %s\n", (int)l, (int)a, source.c_str(), romLine.lineStr.c_str());
+            // romLine.print(l); // Print the rom line content
         }
 #endif
         /*************/
@@ -59,11 +60,11 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         // When the rom assembler code calls inFREE, it specifies the requested input data
         // using an operation + function name string couple
 
-        if (rom.line[l].inFREE)
+        if (romLine.inFREE)
         {
             const int64_t currentLevel = fr.toU64(pols.level[i]);
 
-            if (rom.line[l].op == "functionCall")
+            if (romLine.opCode == sro_functionCall)
             {
                 /* Possible values of mode when action is SMT Set:
                     - update -> update existing value
@@ -74,7 +75,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                     - deleteLast -> delete the last node, so root becomes 0
                     - zeroToZero -> value was zero and remains zero
                 */
-                if (rom.line[l].funcName == "isSetUpdate")
+                if (romLine.funcCode == srf_isSetUpdate)
                 {
                     if (!actionListEmpty &&
                         action[a].bIsSet &&
@@ -87,7 +88,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 #endif
                     }
                 }
-                else if (rom.line[l].funcName == "isSetInsertFound")
+                else if (romLine.funcCode == srf_isSetInsertFound)
                 {
                     if (!actionListEmpty &&
                         action[a].bIsSet &&
@@ -100,7 +101,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 #endif
                     }
                 }
-                else if (rom.line[l].funcName == "isSetInsertNotFound")
+                else if (romLine.funcCode == srf_isSetInsertNotFound)
                 {
                     if (!actionListEmpty &&
                         action[a].bIsSet &&
@@ -113,7 +114,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 #endif
                     }
                 }
-                else if (rom.line[l].funcName == "isSetDeleteLast")
+                else if (romLine.funcCode == srf_isSetDeleteLast)
                 {
                     if (!actionListEmpty &&
                         action[a].bIsSet &&
@@ -126,7 +127,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 #endif
                     }
                 }
-                else if (rom.line[l].funcName == "isSetDeleteFound")
+                else if (romLine.funcCode == srf_isSetDeleteFound)
                 {
                     if (!actionListEmpty &&
                         action[a].bIsSet &&
@@ -139,7 +140,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 #endif
                     }
                 }
-                else if (rom.line[l].funcName == "isSetDeleteNotFound")
+                else if (romLine.funcCode == srf_isSetDeleteNotFound)
                 {
                     if (!actionListEmpty &&
                         action[a].bIsSet &&
@@ -152,7 +153,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 #endif
                     }
                 }
-                else if (rom.line[l].funcName == "isSetZeroToZero")
+                else if (romLine.funcCode == srf_isSetZeroToZero)
                 {
                     if (!actionListEmpty &&
                         action[a].bIsSet &&
@@ -167,7 +168,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // The SMT action can be a final leaf (isOld0 = true)
-                else if (rom.line[l].funcName == "GetIsOld0")
+                else if (romLine.funcCode == srf_GetIsOld0)
                 {
                     if (!actionListEmpty && (action[a].bIsSet ? action[a].setResult.isOld0 : action[a].getResult.isOld0))
                     {
@@ -179,7 +180,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // The SMT action can be a get, which can return a zero value (key not found) or a non-zero value
-                else if (rom.line[l].funcName=="isGet")
+                else if (romLine.funcCode == srf_isGet)
                 {
                     if (!actionListEmpty &&
                         !action[a].bIsSet)
@@ -193,7 +194,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // Get the remaining key, i.e. the key after removing the bits used in the tree node navigation
-                else if (rom.line[l].funcName=="GetRkey")
+                else if (romLine.funcCode == srf_GetRkey)
                 {
                     op[0] = ctx.rKey[0];
                     op[1] = ctx.rKey[1];
@@ -206,7 +207,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // Get the sibling remaining key, i.e. the part that is not common to the value key
-                else if (rom.line[l].funcName=="GetSiblingRkey")
+                else if (romLine.funcCode == srf_GetSiblingRkey)
                 {
                     op[0] = ctx.siblingRKey[0];
                     op[1] = ctx.siblingRKey[1];
@@ -220,7 +221,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 
                 // Get the sibling hash, obtained from the siblings array of the current level,
                 // taking into account that the sibling bit is the opposite (1-x) of the value bit
-                else if (rom.line[l].funcName=="GetSiblingHash")
+                else if (romLine.funcCode == srf_GetSiblingHash)
                 {
                     if (action[a].bIsSet)
                     {
@@ -241,7 +242,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                     zklog.info("StorageExecutor GetSiblingHash returns " + fea2string(fr, op));
 #endif
                 }
-                else if (rom.line[l].funcName=="GetSiblingLeftChildHash")
+                else if (romLine.funcCode == srf_GetSiblingLeftChildHash)
                 {
                     if (action[a].bIsSet)
                     {
@@ -260,7 +261,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                     zklog.info("StorageExecutor GetSiblingLeftChildHash returns " + fea2string(fr, op) + " input=" + to_string(a));
 // #endif
                 }
-                else if (rom.line[l].funcName=="GetSiblingRightChildHash")
+                else if (romLine.funcCode == srf_GetSiblingRightChildHash)
                 {
                     if (action[a].bIsSet)
                     {
@@ -282,7 +283,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 
                 // Return if value is zero
 
-                else if (rom.line[l].funcName=="isValueZero")
+                else if (romLine.funcCode == srf_isValueZero)
                 {
                     // if ctionList is empty => finish, value is zero
                     if (actionListEmpty || (action[a].bIsSet ? action[a].setResult.newValue : action[a].getResult.value) == 0) {
@@ -298,7 +299,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 // u63 means that it is not an u64, since some of the possible values are lost due to the prime effect
 
                 // Get the lower 4 field elements of the value
-                else if (rom.line[l].funcName=="GetValueLow")
+                else if (romLine.funcCode == srf_GetValueLow)
                 {
                     Goldilocks::Element fea[8];
                     scalar2fea(fr, action[a].bIsSet ? action[a].setResult.newValue : action[a].getResult.value, fea);
@@ -313,7 +314,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // Get the higher 4 field elements of the value
-                else if (rom.line[l].funcName=="GetValueHigh")
+                else if (romLine.funcCode == srf_GetValueHigh)
                 {
                     Goldilocks::Element fea[8];
                     scalar2fea(fr, action[a].bIsSet ? action[a].setResult.newValue : action[a].getResult.value, fea);
@@ -328,7 +329,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // Get the lower 4 field elements of the sibling value
-                else if (rom.line[l].funcName=="GetSiblingValueLow")
+                else if (romLine.funcCode == srf_GetSiblingValueLow)
                 {
                     Goldilocks::Element fea[8];
                     scalar2fea(fr, action[a].bIsSet ? action[a].setResult.insValue : action[a].getResult.insValue, fea);
@@ -343,7 +344,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // Get the higher 4 field elements of the sibling value
-                else if (rom.line[l].funcName=="GetSiblingValueHigh")
+                else if (romLine.funcCode == srf_GetSiblingValueHigh)
                 {
                     Goldilocks::Element fea[8];
                     scalar2fea(fr, action[a].bIsSet ? action[a].setResult.insValue : action[a].getResult.insValue, fea);
@@ -358,7 +359,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // Get the lower 4 field elements of the old value
-                else if (rom.line[l].funcName=="GetOldValueLow")
+                else if (romLine.funcCode == srf_GetOldValueLow)
                 {
                     // This call only makes sense then this is an SMT set
                     if (!action[a].bIsSet)
@@ -383,7 +384,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // Get the higher 4 field elements of the old value
-                else if (rom.line[l].funcName=="GetOldValueHigh")
+                else if (romLine.funcCode == srf_GetOldValueHigh)
                 {
                     // This call only makes sense then this is an SMT set
                     if (!action[a].bIsSet)
@@ -408,12 +409,12 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // Get the level number
-                else if (rom.line[l].funcName=="GetLevel")
+                else if (romLine.funcCode == srf_GetLevel)
                 {
                     // Check that we have the no parameters
-                    if (rom.line[l].params.size()!=0)
+                    if (romLine.params.size()!=0)
                     {
-                        zklog.error("StorageExecutor() called with GetBit but wrong number of parameters=" + to_string(rom.line[l].params.size()));
+                        zklog.error("StorageExecutor() called with GetBit but wrong number of parameters=" + to_string(romLine.params.size()));
                         exitProcess();
                     }
 
@@ -429,7 +430,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // Returns 0 if we reached the top of the tree, i.e. if the current level is 0
-                else if (rom.line[l].funcName=="GetTopTree")
+                else if (romLine.funcCode == srf_GetTopTree)
                 {
                     // Return 0 only if we reached the end of the tree, i.e. if the current level is 0
                     if (currentLevel > 0)
@@ -443,7 +444,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // Returns 0 if we reached the top of the branch, i.e. if the level matches the siblings size
-                else if (rom.line[l].funcName=="GetTopOfBranch")
+                else if (romLine.funcCode == srf_GetTopOfBranch)
                 {
                     // If we have consumed enough key bits to reach the deepest level of the siblings array, then we are at the top of the branch and we can start climing the tree
                     int64_t siblingsSize = action[a].bIsSet ? action[a].setResult.siblings.size() : action[a].getResult.siblings.size();
@@ -459,7 +460,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 
                 // Get the next key bit
                 // This call decrements automatically the current level
-                else if (rom.line[l].funcName=="GetNextKeyBit")
+                else if (romLine.funcCode == srf_GetNextKeyBit)
                 {
                     // Decrease current level
                     ctx.currentLevel--;
@@ -478,7 +479,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
 
                 // Return 1 if we completed all evaluations, except one
-                else if (rom.line[l].funcName=="isAlmostEndPolynomial")
+                else if (romLine.funcCode == srf_isAlmostEndPolynomial)
                 {
                     // Return one if this is the one before the last evaluation of the polynomials
                     if (i == (N-2))
@@ -494,12 +495,12 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 }
                 else
                 {
-                    zklog.error("StorageExecutor() unknown funcName:" + rom.line[l].funcName);
+                    zklog.error("StorageExecutor() unknown funcName:" + romLine.funcName);
                     exitProcess();
                 }
             }
-            else if (rom.line[l].climbRkey) {
-                const int bit = rom.line[l].climbBitN? 1 - fr.toU64(pols.rkeyBit[i]) : fr.toU64(pols.rkeyBit[i]);
+            else if (romLine.climbRkey) {
+                const int bit = romLine.climbBitN? 1 - fr.toU64(pols.rkeyBit[i]) : fr.toU64(pols.rkeyBit[i]);
                 const int level = fr.toU64(pols.level[i]);
                 const int zlevel = level % 4;
                 Goldilocks::Element rkeys[4] = {pols.rkey0[i], pols.rkey1[i], pols.rkey2[i], pols.rkey3[i]};
@@ -515,8 +516,8 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 op[2] = rkeys[2];
                 op[3] = rkeys[3];
             }
-            else if (rom.line[l].climbSiblingRkey) {
-                const int bit = rom.line[l].climbBitN? 1 - fr.toU64(pols.rkeyBit[i]) : fr.toU64(pols.rkeyBit[i]);
+            else if (romLine.climbSiblingRkey) {
+                const int bit = romLine.climbBitN? 1 - fr.toU64(pols.rkeyBit[i]) : fr.toU64(pols.rkeyBit[i]);
                 const int level = fr.toU64(pols.level[i]);
                 const int zlevel = level % 4;
                 Goldilocks::Element rkeys[4] = {pols.siblingRkey0[i], pols.siblingRkey1[i], pols.siblingRkey2[i], pols.siblingRkey3[i]};
@@ -534,14 +535,14 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
             }
 
             // Ignore; this is just to report a list of setters
-            else if (rom.line[l].op=="")
+            else if (romLine.opCode == sro_empty)
             {
             }
 
             // Any other value is an unexpected value
             else
             {
-                zklog.error("StorageExecutor() unknown op:" + rom.line[l].op);
+                zklog.error("StorageExecutor() unknown op:" + romLine.op);
                 exitProcess();
             }
 
@@ -556,12 +557,9 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If a constant is provided, add constant to op0
-        if (rom.line[l].CONST!="")
+        if (romLine.bConst)
         {
-            // Convert constant to scalar
-            mpz_class constScalar;
-            constScalar.set_str(rom.line[l].CONST, 10);
-            Goldilocks::Element const0 = fr.fromS64(constScalar.get_si());
+            Goldilocks::Element const0 = fr.fromS64(romLine.constValue);
             op[0] = fr.add(op[0], const0);
 
             // Store constant field elements in their registers
@@ -569,7 +567,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If inOLD_ROOT then op=OLD_ROOT
-        if (rom.line[l].inOLD_ROOT)
+        if (romLine.inOLD_ROOT)
         {
             op[0] = fr.add(op[0], pols.oldRoot0[i]);
             op[1] = fr.add(op[1], pols.oldRoot1[i]);
@@ -579,7 +577,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If inNEW_ROOT then op=NEW_ROOT
-        if (rom.line[l].inNEW_ROOT)
+        if (romLine.inNEW_ROOT)
         {
             op[0] = fr.add(op[0], pols.newRoot0[i]);
             op[1] = fr.add(op[1], pols.newRoot1[i]);
@@ -589,7 +587,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If inRKEY_BIT then op=RKEY_BIT
-        if (rom.line[l].inRKEY_BIT)
+        if (romLine.inRKEY_BIT)
         {
             op[0] = fr.add(op[0], pols.rkeyBit[i]);
             op[1] = fr.add(op[1], fr.zero());
@@ -599,7 +597,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If inVALUE_LOW then op=VALUE_LOW
-        if (rom.line[l].inVALUE_LOW)
+        if (romLine.inVALUE_LOW)
         {
             op[0] = fr.add(op[0], pols.valueLow0[i]);
             op[1] = fr.add(op[1], pols.valueLow1[i]);
@@ -609,7 +607,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If inVALUE_HIGH then op=VALUE_HIGH
-        if (rom.line[l].inVALUE_HIGH)
+        if (romLine.inVALUE_HIGH)
         {
             op[0] = fr.add(op[0], pols.valueHigh0[i]);
             op[1] = fr.add(op[1], pols.valueHigh1[i]);
@@ -619,7 +617,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If inRKEY then op=RKEY
-        if (rom.line[l].inRKEY)
+        if (romLine.inRKEY)
         {
             op[0] = fr.add(op[0], pols.rkey0[i]);
             op[1] = fr.add(op[1], pols.rkey1[i]);
@@ -629,9 +627,9 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If inSIBLING_RKEY then op=SIBLING_RKEY
-        if (rom.line[l].inSIBLING_RKEY)
+        if (romLine.inSIBLING_RKEY)
         {
-            pols.inSiblingRkey[i] = fr.fromS64(rom.line[l].inSIBLING_RKEY);
+            pols.inSiblingRkey[i] = fr.fromS64(romLine.inSIBLING_RKEY);
             op[0] = fr.add(op[0], fr.mul(pols.inSiblingRkey[i], pols.siblingRkey0[i]));
             op[1] = fr.add(op[1], fr.mul(pols.inSiblingRkey[i], pols.siblingRkey1[i]));
             op[2] = fr.add(op[2], fr.mul(pols.inSiblingRkey[i], pols.siblingRkey2[i]));
@@ -639,7 +637,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If inSIBLING_VALUE_HASH then op=SIBLING_VALUE_HASH
-        if (rom.line[l].inSIBLING_VALUE_HASH)
+        if (romLine.inSIBLING_VALUE_HASH)
         {
             op[0] = fr.add(op[0], pols.siblingValueHash0[i]);
             op[1] = fr.add(op[1], pols.siblingValueHash1[i]);
@@ -649,7 +647,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If inROTL_VH then op=rotate_left(VALUE_HIGH)
-        if (rom.line[l].inROTL_VH)
+        if (romLine.inROTL_VH)
         {
             op[0] = fr.add(op[0], pols.valueHigh3[i]);
             op[1] = fr.add(op[1], pols.valueHigh0[i]);
@@ -659,7 +657,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If inROTL_VH then op=rotate_left(VALUE_HIGH)
-        if (rom.line[l].inLEVEL)
+        if (romLine.inLEVEL)
         {
             pols.inLevel[i] = fr.one();
             op[0] = fr.add(op[0], pols.level[i]);
@@ -670,23 +668,23 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         /****************/
 
         // JMPZ: Jump if OP==0
-        if (rom.line[l].jmpz)
+        if (romLine.jmpz)
         {
             if (fr.isZero(op[0]))
             {
-                pols.pc[nexti] = fr.fromU64(rom.line[l].jmpAddress);
-                //zklog.info("StorageExecutor jmpz jmpAddress=" + to_string(rom.line[l].jmpAddress));
+                pols.pc[nexti] = fr.fromU64(romLine.jmpAddress);
+                //zklog.info("StorageExecutor jmpz jmpAddress=" + to_string(romLine.jmpAddress));
             }
             else
             {
                 pols.pc[nexti] = fr.add(pols.pc[i], fr.one());
             }
-            pols.jmpAddress[i] = fr.fromU64(rom.line[l].jmpAddress);
+            pols.jmpAddress[i] = fr.fromU64(romLine.jmpAddress);
             pols.jmpz[i] = fr.one();
         }
 
         // JMPNZ: Jump if OP!=0
-        else if (rom.line[l].jmpnz)
+        else if (romLine.jmpnz)
         {
             if (fr.isZero(op[0]))
             {
@@ -694,19 +692,19 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
             }
             else
             {
-                pols.pc[nexti] = fr.fromU64(rom.line[l].jmpAddress);
-                //zklog.info("StorageExecutor jmpz jmpAddress=" + to_string(rom.line[l].jmpAddress));
+                pols.pc[nexti] = fr.fromU64(romLine.jmpAddress);
+                //zklog.info("StorageExecutor jmpz jmpAddress=" + to_string(romLine.jmpAddress));
             }
-            pols.jmpAddress[i] = fr.fromU64(rom.line[l].jmpAddress);
+            pols.jmpAddress[i] = fr.fromU64(romLine.jmpAddress);
             pols.jmpnz[i] = fr.one();
         }
 
         // JMP: Jump always
-        else if (rom.line[l].jmp)
+        else if (romLine.jmp)
         {
-            pols.pc[nexti] = fr.fromU64(rom.line[l].jmpAddress);
-            pols.jmpAddress[i] = fr.fromU64(rom.line[l].jmpAddress);
-            //zklog.info("StorageExecutor iJmp jmpAddress=" + to_string(rom.line[l].jmpAddress));
+            pols.pc[nexti] = fr.fromU64(romLine.jmpAddress);
+            pols.jmpAddress[i] = fr.fromU64(romLine.jmpAddress);
+            //zklog.info("StorageExecutor iJmp jmpAddress=" + to_string(romLine.jmpAddress));
             pols.jmp[i] = fr.one();
         }
 
@@ -717,7 +715,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // Hash: op = poseidon.hash(HASH_LEFT + HASH_RIGHT + (0 or 1, depending on iHashType))
-        if (rom.line[l].hash)
+        if (romLine.hash)
         {
             // Prepare the data to hash: HASH_LEFT + HASH_RIGHT + 0 or 1, depending on iHashType
             Goldilocks::Element fea[12];
@@ -729,18 +727,18 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
             fea[5] = pols.hashRight1[i];
             fea[6] = pols.hashRight2[i];
             fea[7] = pols.hashRight3[i];
-            if (rom.line[l].hashType==0)
+            if (romLine.hashType==0)
             {
                 fea[8] = fr.zero();
             }
-            else if (rom.line[l].hashType==1)
+            else if (romLine.hashType==1)
             {
                 fea[8] = fr.one();
                 pols.hashType[i] = fr.one();
             }
             else
             {
-                zklog.error("StorageExecutor:execute() found invalid iHashType=" + to_string(rom.line[l].hashType));
+                zklog.error("StorageExecutor:execute() found invalid iHashType=" + to_string(romLine.hashType));
                 exitProcess();
             }
             fea[9] = fr.zero();
@@ -768,10 +766,10 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
             pols.free2[i] = feaHash[2];
             pols.free3[i] = feaHash[3];
 
-            op[0] = fr.add(op[0], fr.mul(fr.fromU64(rom.line[l].inFREE), feaHash[0]));
-            op[1] = fr.add(op[1], fr.mul(fr.fromU64(rom.line[l].inFREE), feaHash[1]));
-            op[2] = fr.add(op[2], fr.mul(fr.fromU64(rom.line[l].inFREE), feaHash[2]));
-            op[3] = fr.add(op[3], fr.mul(fr.fromU64(rom.line[l].inFREE), feaHash[3]));
+            op[0] = fr.add(op[0], fr.mul(fr.fromU64(romLine.inFREE), feaHash[0]));
+            op[1] = fr.add(op[1], fr.mul(fr.fromU64(romLine.inFREE), feaHash[1]));
+            op[2] = fr.add(op[2], fr.mul(fr.fromU64(romLine.inFREE), feaHash[2]));
+            op[3] = fr.add(op[3], fr.mul(fr.fromU64(romLine.inFREE), feaHash[3]));
 
             pols.hash[i] = fr.one();
 
@@ -784,14 +782,14 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 
 #ifdef LOG_STORAGE_EXECUTOR
             {
-                string s = "StorageExecutor iHash hashType=" + to_string(rom.line[l].hashType) + " hash=" + fea2string(fr, op) + " value=";
+                string s = "StorageExecutor iHash hashType=" + to_string(romLine.hashType) + " hash=" + fea2string(fr, op) + " value=";
                 for (uint64_t i=0; i<12; i++) s += fr.toString(auxFea[i],16) + ":";
                 zklog.info(s);
             }
 #endif
         }
 
-        if (rom.line[l].climbBitN) {
+        if (romLine.climbBitN) {
             pols.climbBitN[i] = fr.one();
 #ifdef LOG_STORAGE_EXECUTOR
             zklog.info("StorageExecutor climbBitN = 1");
@@ -799,9 +797,9 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // Climb the remaining key, by injecting the RKEY_BIT in the register specified by LEVEL
-        if (rom.line[l].climbRkey)
+        if (romLine.climbRkey)
         {
-            const int bit = rom.line[l].climbBitN? 1 - fr.toU64(pols.rkeyBit[i]) : fr.toU64(pols.rkeyBit[i]);
+            const int bit = romLine.climbBitN? 1 - fr.toU64(pols.rkeyBit[i]) : fr.toU64(pols.rkeyBit[i]);
             const int level = fr.toU64(pols.level[i]);
             const int zlevel = level % 4;
             Goldilocks::Element rkeys[4] = {pols.rkey0[i], pols.rkey1[i], pols.rkey2[i], pols.rkey3[i]};
@@ -832,9 +830,9 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // Climb the sibling remaining key, by injecting the sibling bit in the register specified by LEVEL
-        if (rom.line[l].climbSiblingRkey)
+        if (romLine.climbSiblingRkey)
         {
-            const int bit = rom.line[l].climbBitN? 1 - fr.toU64(pols.rkeyBit[i]) : fr.toU64(pols.rkeyBit[i]);
+            const int bit = romLine.climbBitN? 1 - fr.toU64(pols.rkeyBit[i]) : fr.toU64(pols.rkeyBit[i]);
             const int level = fr.toU64(pols.level[i]);
             const int zlevel = level % 4;
             Goldilocks::Element rkeys[4] = {pols.siblingRkey0[i], pols.siblingRkey1[i], pols.siblingRkey2[i], pols.siblingRkey3[i]};
@@ -864,7 +862,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
 #endif
         }
         // Latch get: at this point consistency is granted: OLD_ROOT, RKEY (complete key), VALUE_LOW, VALUE_HIGH, LEVEL
-        if (rom.line[l].latchGet)
+        if (romLine.latchGet)
         {
             // Check that the current action is an SMT get
             if (action[a].bIsSet)
@@ -951,7 +949,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // Latch set: at this point consistency is granted: OLD_ROOT, NEW_ROOT, RKEY (complete key), VALUE_LOW, VALUE_HIGH, LEVEL
-        if (rom.line[l].latchSet)
+        if (romLine.latchSet)
         {
             // Check that the current action is an SMT set
             if (!action[a].bIsSet)
@@ -1048,7 +1046,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
 #ifdef LOG_STORAGE_EXECUTOR_ROM_LINE
-        if (rom.line[l].funcName!="isAlmostEndPolynomial")
+        if (romLine.funcCode != srf_isAlmostEndPolynomial)
         {
             printf("[SR%04d I%03d %-28s] OP=[\x1B[35m%s\x1B[0m]\n", (int)l, (int)a, source.c_str(), fea2string(fr, op).c_str());
         }
@@ -1060,7 +1058,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         /***********/
 
         // If setRKEY then RKEY=op
-        if (rom.line[l].setRKEY)
+        if (romLine.setRKEY)
         {
             pols.rkey0[nexti] = op[0];
             pols.rkey1[nexti] = op[1];
@@ -1077,7 +1075,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If setRKEY_BIT then RKEY_BIT=op
-        if (rom.line[l].setRKEY_BIT)
+        if (romLine.setRKEY_BIT)
         {
             pols.rkeyBit[nexti] = op[0];
             pols.setRkeyBit[i] = fr.one();
@@ -1088,7 +1086,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If setVALUE_LOW then VALUE_LOW=op
-        if (rom.line[l].setVALUE_LOW)
+        if (romLine.setVALUE_LOW)
         {
             pols.valueLow0[nexti] = op[0];
             pols.valueLow1[nexti] = op[1];
@@ -1105,7 +1103,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If setVALUE_HIGH then VALUE_HIGH=op
-        if (rom.line[l].setVALUE_HIGH)
+        if (romLine.setVALUE_HIGH)
         {
             pols.valueHigh0[nexti] = op[0];
             pols.valueHigh1[nexti] = op[1];
@@ -1122,7 +1120,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If setLEVEL then LEVEL=op
-        if (rom.line[l].setLEVEL)
+        if (romLine.setLEVEL)
         {
             pols.level[nexti] = op[0];
             pols.setLevel[i] = fr.one();
@@ -1133,7 +1131,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If setOLD_ROOT then OLD_ROOT=op
-        if (rom.line[l].setOLD_ROOT)
+        if (romLine.setOLD_ROOT)
         {
             pols.oldRoot0[nexti] = op[0];
             pols.oldRoot1[nexti] = op[1];
@@ -1150,7 +1148,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If setNEW_ROOT then NEW_ROOT=op
-        if (rom.line[l].setNEW_ROOT)
+        if (romLine.setNEW_ROOT)
         {
             pols.newRoot0[nexti] = op[0];
             pols.newRoot1[nexti] = op[1];
@@ -1167,7 +1165,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If setHASH_LEFT then HASH_LEFT=op
-        if (rom.line[l].setHASH_LEFT)
+        if (romLine.setHASH_LEFT)
         {
             pols.hashLeft0[nexti] = op[0];
             pols.hashLeft1[nexti] = op[1];
@@ -1184,7 +1182,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If setHASH_RIGHT then HASH_RIGHT=op
-        if (rom.line[l].setHASH_RIGHT)
+        if (romLine.setHASH_RIGHT)
         {
             pols.hashRight0[nexti] = op[0];
             pols.hashRight1[nexti] = op[1];
@@ -1201,7 +1199,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If setSIBLING_RKEY then SIBLING_RKEY=op
-        if (rom.line[l].setSIBLING_RKEY)
+        if (romLine.setSIBLING_RKEY)
         {
             pols.siblingRkey0[nexti] = op[0];
             pols.siblingRkey1[nexti] = op[1];
@@ -1218,7 +1216,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // If setSIBLING_VALUE_HASH then SIBLING_VALUE_HASH=op
-        if (rom.line[l].setSIBLING_VALUE_HASH)
+        if (romLine.setSIBLING_VALUE_HASH)
         {
             pols.siblingValueHash0[nexti] = op[0];
             pols.siblingValueHash1[nexti] = op[1];
@@ -1241,11 +1239,11 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         }
 
         // Increment counter at every hash, and reset it at every latch
-        if (rom.line[l].hash)
+        if (romLine.hash)
         {
             pols.incCounter[nexti] = fr.add(pols.incCounter[i], fr.one());
         }
-        else if (rom.line[l].latchGet || rom.line[l].latchSet)
+        else if (romLine.latchGet || romLine.latchSet)
         {
             pols.incCounter[nexti] = fr.zero();
         }
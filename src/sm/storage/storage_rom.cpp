@@ -73,9 +73,11 @@ void StorageRom::load(json &j)
         if (romLine.inFREE)
         {
             romLine.op = l["freeInTag"]["op"];
-            if (romLine.op=="functionCall")
+            romLine.opCode = string2StorageRomOp(romLine.op);
+            if (romLine.opCode == sro_functionCall)
             {
                 romLine.funcName = l["freeInTag"]["funcName"];
+                romLine.funcCode = string2StorageRomFunction(romLine.funcName);
                 const uint64_t paramCount = l["freeInTag"]["params"].size();
                 json params = l["freeInTag"]["params"];
                 for (uint64_t iParam = 0; iParam < paramCount; iParam++)
@@ -88,7 +90,9 @@ void StorageRom::load(json &j)
         // Constant
         if (l["CONST"].is_number())
         {
-            romLine.CONST = to_string(l["CONST"].get<int64_t>());
+            romLine.constValue = l["CONST"].get<int64_t>();
+            romLine.CONST = to_string(romLine.constValue);
+            romLine.bConst = true;
         }
 
         line.push_back(romLine);
@@ -1,6 +1,7 @@
 #include <iostream>
 #include "storage_rom_line.hpp"
 #include "zklog.hpp"
+#include "exit_process.hpp"
 
 void StorageRomLine::print (uint64_t l)
 {
@@ -64,4 +65,89 @@ void StorageRomLine::print (uint64_t l)
     if (setSIBLING_VALUE_HASH) s += "setSIBLING_VALUE_HASH ";
 
     zklog.info(s);
-}
\ No newline at end of file
+}
+
+tStorageRomOp string2StorageRomOp (const string &s)
+{
+    if (s == "functionCall")                       return sro_functionCall;
+    else if (s == "")                              return sro_empty;
+    else {
+        zklog.error("string2StorageRomOp() invalid string = " + s);
+        exitProcess();
+        return sro_empty;
+    }
+}
+
+tStorageRomFunction string2StorageRomFunction (const string &s)
+{
+    if (s == "isSetUpdate")                         return srf_isSetUpdate;
+    else if (s == "isSetInsertFound")               return srf_isSetInsertFound;
+    else if (s == "isSetInsertNotFound")            return srf_isSetInsertNotFound;
+    else if (s == "isSetDeleteLast")                return srf_isSetDeleteLast;
+    else if (s == "isSetDeleteFound")               return srf_isSetDeleteFound;
+    else if (s == "isSetDeleteNotFound")            return srf_isSetDeleteNotFound;
+    else if (s == "isSetZeroToZero")                return srf_isSetZeroToZero;
+    else if (s == "GetIsOld0")                      return srf_GetIsOld0;
+    else if (s == "isGet")                          return srf_isGet;
+    else if (s == "GetRkey")                        return srf_GetRkey;
+    else if (s == "GetSiblingRkey")                 return srf_GetSiblingRkey;
+    else if (s == "GetSiblingHash")                 return srf_GetSiblingHash;
+    else if (s == "GetSiblingLeftChildHash")        return srf_GetSiblingLeftChildHash;
+    else if (s == "GetSiblingRightChildHash")       return srf_GetSiblingRightChildHash;
+    else if (s == "isValueZero")                    return srf_isValueZero;
+    else if (s == "GetValueLow")                    return srf_GetValueLow;
+    else if (s == "GetValueHigh")                   return srf_GetValueHigh;
+    else if (s == "GetSiblingValueLow")             return srf_GetSiblingValueLow;
+    else if (s == "GetSiblingValueHigh")            return srf_GetSiblingValueHigh;
+    else if (s == "GetOldValueLow")                 return srf_GetOldValueLow;
+    else if (s == "GetOldValueHigh")                return srf_GetOldValueHigh;
+    else if (s == "GetLevel")                       return srf_GetLevel;
+    else if (s == "GetTopTree")                     return srf_GetTopTree;
+    else if (s == "GetTopOfBranch")                 return srf_GetTopOfBranch;
+    else if (s == "GetNextKeyBit")                  return srf_GetNextKeyBit;
+    else if (s == "isAlmostEndPolynomial")          return srf_isAlmostEndPolynomial;
+    else if (s == "")                               return srf_empty;
+    else {
+        zklog.error("string2StorageRomFunction() invalid string = " + s);
+        exitProcess();
+        return srf_empty;
+    }
+}
+
+string storageRomFunction2String (tStorageRomFunction f)
+{
+    switch (f)
+    {
+        case srf_isSetUpdate:                   return "isSetUpdate";
+        case srf_isSetInsertFound:              return "isSetInsertFound";
+        case srf_isSetInsertNotFound:           return "isSetInsertNotFound";
+        case srf_isSetDeleteLast:               return "isSetDeleteLast";
+        case srf_isSetDeleteFound:              return "isSetDeleteFound";
+        case srf_isSetDeleteNotFound:           return "isSetDeleteNotFound";
+        case srf_isSetZeroToZero:               return "isSetZeroToZero";
+        case srf_GetIsOld0:                     return "GetIsOld0";
+        case srf_isGet:                         return "isGet";
+        case srf_GetRkey:                       return "GetRkey";
+        case srf_GetSiblingRkey:                return "GetSiblingRkey";
+        case srf_GetSiblingHash:                return "GetSiblingHash";
+        case srf_GetSiblingLeftChildHash:       return "GetSiblingLeftChildHash";
+        case srf_GetSiblingRightChildHash:      return "GetSiblingRightChildHash";
+        case srf_isValueZero:                   return "isValueZero";
+        case srf_GetValueLow:                   return "GetValueLow";
+        case srf_GetValueHigh:                  return "GetValueHigh";
+        case srf_GetSiblingValueLow:            return "GetSiblingValueLow";
+        case srf_GetSiblingValueHigh:           return "GetSiblingValueHigh";
+        case srf_GetOldValueLow:                return "GetOldValueLow";
+        case srf_GetOldValueHigh:               return "GetOldValueHigh";
+        case srf_GetLevel:                      return "GetLevel";
+        case srf_GetTopTree:                    return "GetTopTree";
+        case srf_GetTopOfBranch:                return "GetTopOfBranch";
+        case srf_GetNextKeyBit:                 return "GetNextKeyBit";
+        case srf_isAlmostEndPolynomial:         return "isAlmostEndPolynomial";
+        case srf_empty:                         return "";
+        default:
+            zklog.error("storageRomFunction2String() invalid function = " + to_string(f));
+            exitProcess();
+            return "";
+    }
+}
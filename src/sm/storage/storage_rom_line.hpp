@@ -7,6 +7,48 @@
 
 using namespace std;
 
+// Storage ROM inFREE operations, compiled from their string at load time
+typedef enum : int {
+    sro_empty = 0,
+    sro_functionCall
+} tStorageRomOp;
+
+// Storage ROM functions, compiled from their funcName at load time
+typedef enum : int {
+    srf_empty = 0,
+    srf_isSetUpdate,
+    srf_isSetInsertFound,
+    srf_isSetInsertNotFound,
+    srf_isSetDeleteLast,
+    srf_isSetDeleteFound,
+    srf_isSetDeleteNotFound,
+    srf_isSetZeroToZero,
+    srf_GetIsOld0,
+    srf_isGet,
+    srf_GetRkey,
+    srf_GetSiblingRkey,
+    srf_GetSiblingHash,
+    srf_GetSiblingLeftChildHash,
+    srf_GetSiblingRightChildHash,
+    srf_isValueZero,
+    srf_GetValueLow,
+    srf_GetValueHigh,
+    srf_GetSiblingValueLow,
+    srf_GetSiblingValueHigh,
+    srf_GetOldValueLow,
+    srf_GetOldValueHigh,
+    srf_GetLevel,
+    srf_GetTopTree,
+    srf_GetTopOfBranch,
+    srf_GetNextKeyBit,
+    srf_isAlmostEndPolynomial
+} tStorageRomFunction;
+
+// Functions for conversion from storage ROM op/function to string and viceversa
+tStorageRomOp string2StorageRomOp (const string &s);
+tStorageRomFunction string2StorageRomFunction (const string &s);
+string storageRomFunction2String (tStorageRomFunction f);
+
 class StorageRomLine
 {
 public:
@@ -61,9 +103,13 @@ public:
     string op;
     string funcName;
     vector<uint64_t> params;
+    tStorageRomOp opCode; // op and funcName compiled to avoid string comparisons at every evaluation
+    tStorageRomFunction funcCode;
 
     // Constant
     string CONST;
+    bool bConst;
+    int64_t constValue; // CONST compiled to avoid parsing it at every evaluation
 
     StorageRomLine ()
     {
@@ -102,6 +148,10 @@ public:
         setSIBLING_RKEY = false;
         setSIBLING_VALUE_HASH = false;
         jmpAddress = 0;
+        opCode = sro_empty;
+        funcCode = srf_empty;
+        bConst = false;
+        constValue = 0;
     }
     void print (uint64_t l);
 };
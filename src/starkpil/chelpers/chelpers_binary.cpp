@@ -0,0 +1,121 @@
+#include <cstring>
+#include "chelpers_binary.hpp"
+#include "utils.hpp"
+#include "zklog.hpp"
+#include "exit_process.hpp"
+#include "timer.hpp"
+
+ChelpersBinary::ChelpersBinary (const string &fileName) : fileName(fileName), pAddress(NULL), size(0)
+{
+    TimerStart(CHELPERS_BINARY_LOAD);
+    if (!fileExists(fileName))
+    {
+        zklog.error("ChelpersBinary::ChelpersBinary() could not find file " + fileName);
+        exitProcess();
+    }
+    size = fileSize(fileName);
+    pAddress = copyFile(fileName, size);
+    parse();
+    TimerStopAndLog(CHELPERS_BINARY_LOAD);
+}
+
+ChelpersBinary::~ChelpersBinary ()
+{
+    if (pAddress != NULL)
+    {
+        free(pAddress);
+    }
+}
+
+void ChelpersBinary::parse (void)
+{
+    const uint64_t * pData = (const uint64_t *)pAddress;
+    uint64_t nWords = size / 8;
+    uint64_t p = 0;
+
+    if ((size % 8 != 0) || (nWords < 4))
+    {
+        zklog.error("ChelpersBinary::parse() found invalid size=" + to_string(size) + " of file " + fileName);
+        exitProcess();
+    }
+    if (pData[0] != CHELPERS_BINARY_MAGIC)
+    {
+        zklog.error("ChelpersBinary::parse() found invalid magic=" + to_string(pData[0]) + " in file " + fileName);
+        exitProcess();
+    }
+    if (pData[1] != CHELPERS_BINARY_VERSION)
+    {
+        zklog.error("ChelpersBinary::parse() found version=" + to_string(pData[1]) + " instead of " + to_string(CHELPERS_BINARY_VERSION) + " in file " + fileName);
+        exitProcess();
+    }
+    if (pData[2] != chelpersGenericIsaHash)
+    {
+        zklog.error("ChelpersBinary::parse() found isaHash=" + to_string(pData[2]) + " instead of " + to_string(chelpersGenericIsaHash) + " in file " + fileName + "; it was generated for a different chelpers_generic_avx.cpp");
+        exitProcess();
+    }
+    uint64_t nSteps = pData[3];
+    p = 4;
+
+    for (uint64_t s=0; s<nSteps; s++)
+    {
+        ChelpersStep step;
+
+        // Name
+        if (p + 1 > nWords) break;
+        uint64_t nameSize = pData[p++];
+        uint64_t nameWords = (nameSize + 7) / 8;
+        if (p + nameWords + 5 > nWords) break;
+        step.name.assign((const char *)&pData[p], nameSize);
+        p += nameWords;
+
+        // Sizes
+        step.nTemp1 = pData[p++];
+        step.nTemp3 = pData[p++];
+        step.flags = pData[p++];
+        step.nOps = pData[p++];
+        step.nArgs = pData[p++];
+        uint64_t opsWords = (step.nOps*sizeof(uint16_t) + 7) / 8;
+        if (p + opsWords + step.nArgs > nWords) break;
+        step.ops = (const uint16_t *)&pData[p];
+        p += opsWords;
+        step.args = &pData[p];
+        p += step.nArgs;
+
+        // Check that every op belongs to the ISA and that the ops consume exactly all the args,
+        // so that the evaluator does not need to check them for every row
+        uint64_t nArgs = 0;
+        for (uint64_t i=0; i<step.nOps; i++)
+        {
+            if (step.ops[i] >= chelpersGenericNOps)
+            {
+                zklog.error("ChelpersBinary::parse() found op=" + to_string(step.ops[i]) + " at position=" + to_string(i) + " of step " + step.name + " out of the ISA size=" + to_string(chelpersGenericNOps) + " in file " + fileName);
+                exitProcess();
+            }
+            nArgs += chelpersGenericOpArgs[step.ops[i]];
+        }
+        if (nArgs != step.nArgs)
+        {
+            zklog.error("ChelpersBinary::parse() found step " + step.name + " with nArgs=" + to_string(step.nArgs) + " but its ops consume " + to_string(nArgs) + " args in file " + fileName);
+            exitProcess();
+        }
+
+        zklog.info("ChelpersBinary::parse() loaded step " + step.name + " nOps=" + to_string(step.nOps) + " nArgs=" + to_string(step.nArgs) + " nTemp1=" + to_string(step.nTemp1) + " nTemp3=" + to_string(step.nTemp3) + " flags=" + to_string(step.flags));
+        steps[step.name] = step;
+    }
+
+    if ((steps.size() != nSteps) || (p != nWords))
+    {
+        zklog.error("ChelpersBinary::parse() found a truncated or corrupted file " + fileName + " size=" + to_string(size) + " nSteps=" + to_string(nSteps) + " parsed=" + to_string(steps.size()));
+        exitProcess();
+    }
+}
+
+const ChelpersStep * ChelpersBinary::getStep (const string &name) const
+{
+    map<string, ChelpersStep>::const_iterator it = steps.find(name);
+    if (it == steps.end())
+    {
+        return NULL;
+    }
+    return &it->second;
+}
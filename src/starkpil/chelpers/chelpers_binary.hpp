@@ -0,0 +1,75 @@
+#ifndef CHELPERS_BINARY_HPP
+#define CHELPERS_BINARY_HPP
+
+#include <string>
+#include <map>
+#include <cstdint>
+
+using namespace std;
+
+struct StepsParams;
+
+/*
+    Chelpers binary file, e.g. zkevm.chelpers.bin, generated by chelpersGenerator from the chelpers
+    parsers of a circuit, and loaded at runtime instead of the compiled-in op and args arrays.
+
+    Every step is a stream of ops of a generic instruction set (ISA), shared by all the steps and
+    circuits, plus its args stream.  The ISA is the set of distinct case bodies of the parsers, and
+    it is compiled into the generic evaluator chelpersGenericAvx(), so a circuit change only requires
+    a new binary file, unless it introduces a case body that is not in the ISA yet.  The file stores
+    the hash of the ISA it was generated for, which must match the compiled one.
+
+    Layout, all fields little endian uint64_t unless stated:
+        magic, version, isaHash, nSteps
+        for every step:
+            nameSize, name (nameSize bytes, padded to 8 bytes)
+            nTemp1, nTemp3, flags, nOps, nArgs
+            ops (nOps uint16_t, padded to 8 bytes)
+            args (nArgs uint64_t)
+*/
+
+#define CHELPERS_BINARY_MAGIC 0x504C4548435A4BULL // "ZKCHELP"
+#define CHELPERS_BINARY_VERSION 1
+
+#define CHELPERS_STEP_FLAG_EXTENDED 0x1 // Constant polynomials are read from pConstPols2ns instead of pConstPols
+
+class ChelpersStep
+{
+public:
+    string name;
+    uint64_t nTemp1;
+    uint64_t nTemp3;
+    uint64_t flags;
+    uint64_t nOps;
+    uint64_t nArgs;
+    const uint16_t * ops; // Points to the file content
+    const uint64_t * args; // Points to the file content
+};
+
+class ChelpersBinary
+{
+private:
+    string fileName;
+    void * pAddress;
+    uint64_t size;
+    map<string, ChelpersStep> steps;
+
+    void parse (void);
+
+public:
+    ChelpersBinary (const string &fileName);
+    ~ChelpersBinary ();
+
+    // Returns the step with this name, e.g. "step42ns", or NULL if the file does not contain it
+    const ChelpersStep * getStep (const string &name) const;
+};
+
+// Generated by chelpersGenerator, in chelpers_generic_avx.cpp
+extern const uint64_t chelpersGenericIsaHash;
+extern const uint64_t chelpersGenericNOps;
+extern const uint8_t chelpersGenericOpArgs[]; // Number of args consumed by every ISA op
+
+// Evaluates the step for all rows, 4 rows per AVX2 batch; equivalent to the <step>_parser_first_avx() it was generated from
+void chelpersGenericAvx (StepsParams &params, const ChelpersStep &step, uint64_t nrows);
+
+#endif
@@ -0,0 +1,1234 @@
+// Generated by chelpersGenerator, do not edit; new ops are appended, so that existing binary files remain valid
+#include <immintrin.h>
+#include "goldilocks_cubic_extension.hpp"
+#include "zhInv.hpp"
+#include "starks.hpp"
+#include "constant_pols_starks.hpp"
+#include "chelpers_binary.hpp"
+#include "zklog.hpp"
+#include "exit_process.hpp"
+
+#define AVX_SIZE_ 4
+#define CHELPERS_GENERIC_NOPS 145
+
+const uint64_t chelpersGenericIsaHash = 0x5993ea5f8e63d9d3ULL;
+const uint64_t chelpersGenericNOps = CHELPERS_GENERIC_NOPS;
+const uint8_t chelpersGenericOpArgs[CHELPERS_GENERIC_NOPS] = { 3, 4, 3, 3, 5, 9, 4, 4, 3, 7, 3, 5, 3, 3, 3, 4, 4, 3, 3, 4, 4, 3, 4, 6, 4, 6, 3, 3, 4, 6, 4, 6, 3, 5, 4, 7, 7, 5, 9, 4, 3, 4, 3, 3, 4, 3, 3, 4, 6, 3, 5, 7, 9, 4, 4, 6, 4, 6, 3, 3, 3, 3, 4, 6, 4, 6, 3, 2, 2, 1, 3, 3, 5, 6, 6, 4, 4, 7, 2, 3, 5, 2, 2, 4, 6, 6, 4, 5, 4, 5, 4, 3, 4, 4, 4, 5, 4, 4, 4, 5, 3, 6, 7, 6, 7, 6, 6, 6, 6, 7, 6, 8, 6, 5, 9, 4, 4, 6, 11, 5, 8, 9, 7, 5, 6, 6, 6, 6, 5, 7, 7, 9, 6, 6, 6, 2, 2, 6, 19, 24, 47, 6, 8, 4, 3 };
+
+void chelpersGenericAvx (StepsParams &params, const ChelpersStep &step, uint64_t nrows)
+{
+     const uint16_t *ops = step.ops;
+     const uint64_t *args = step.args;
+     const uint64_t nOps = step.nOps;
+     ConstantPolsStarks *pConstPols = (step.flags & CHELPERS_STEP_FLAG_EXTENDED) ? params.pConstPols2ns : params.pConstPols;
+     uint64_t numpols = pConstPols->numPols();
+
+#pragma omp parallel
+     {
+          // The number of temporaries is only known at runtime, so they are allocated once per thread
+          __m256i *tmp1 = new __m256i[step.nTemp1];
+          Goldilocks3::Element_avx *tmp3 = new Goldilocks3::Element_avx[step.nTemp3];
+          uint64_t offsets1[4], offsets2[4], offsets3[4];
+
+#pragma omp for
+          for (uint64_t i = 0; i < nrows; i += AVX_SIZE_)
+          {
+               uint64_t i_args = 0;
+               for (uint64_t kk = 0; kk < nOps; ++kk)
+               {
+                    switch (ops[kk])
+                    {
+                    case 0:
+                    {
+                         Goldilocks::add_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 1:
+                    {
+                         Goldilocks::add_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], &params.pols[args[i_args + 2] + i * args[i_args + 3]], args[i_args + 3]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 2:
+                    {
+                         Goldilocks::add_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], Goldilocks::fromU64(args[i_args + 2]));
+                         i_args += 3;
+                         break;
+                    }
+                    case 3:
+                    {
+                         Goldilocks::add_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], &pConstPols->getElement(args[i_args + 2], i), numpols);
+                         i_args += 3;
+                         break;
+                    }
+                    case 4:
+                    {
+                         Goldilocks::add_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &params.pols[args[i_args + 3] + i * args[i_args + 4]], args[i_args + 2], args[i_args + 4]);
+                         i_args += 5;
+                         break;
+                    }
+                    case 5:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = args[i_args + 5] + (((i + j) + args[i_args + 6]) % args[i_args + 7]) * args[i_args + 8];
+                         }
+                         Goldilocks::add_avx(tmp1[(args[i_args])], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                         i_args += 9;
+                         break;
+                    }
+                    case 6:
+                    {
+                         Goldilocks::add_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &pConstPols->getElement(args[i_args + 3], i), args[i_args + 2], numpols);
+                         i_args += 4;
+                         break;
+                    }
+                    case 7:
+                    {
+                         Goldilocks::add_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], Goldilocks::fromU64(args[i_args + 3]), args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 8:
+                    {
+                         Goldilocks::add_avx(tmp1[(args[i_args])], &pConstPols->getElement(args[i_args + 1], i), &pConstPols->getElement(args[i_args + 2], i), numpols, numpols);
+                         i_args += 3;
+                         break;
+                    }
+                    case 9:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * numpols;
+                              offsets2[j] = args[i_args + 4] + (((i + j) + args[i_args + 5]) % args[i_args + 6]) * numpols;
+                         }
+                         Goldilocks::add_avx(tmp1[(args[i_args])], &pConstPols->getElement(0, 0), &pConstPols->getElement(0, 0), offsets1, offsets2);
+                         i_args += 7;
+                         break;
+                    }
+                    case 10:
+                    {
+                         Goldilocks::add_avx(tmp1[(args[i_args])], &pConstPols->getElement(args[i_args + 1], i), Goldilocks::fromU64(args[i_args + 2]), numpols);
+                         i_args += 3;
+                         break;
+                    }
+                    case 11:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * numpols;
+                         }
+                         Goldilocks::add_avx(tmp1[(args[i_args])], &pConstPols->getElement(0, 0), Goldilocks::fromU64(args[i_args + 4]), offsets1);
+                         i_args += 5;
+                         break;
+                    }
+                    case 12:
+                    {
+                         Goldilocks3::add13_avx(tmp3[args[i_args]], tmp1[args[i_args + 1]], tmp3[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 13:
+                    {
+                         Goldilocks3::add1c3c_avx(tmp3[args[i_args]], Goldilocks::fromU64(args[i_args + 1]), params.challenges[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 14:
+                    {
+                         Goldilocks3::add13c_avx(tmp3[args[i_args]], tmp1[args[i_args + 1]], params.challenges[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 15:
+                    {
+                         Goldilocks3::add13_avx(tmp3[args[i_args]], &params.pols[args[i_args + 1] + i * args[i_args + 2]], tmp3[args[i_args + 3]], args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 16:
+                    {
+                         Goldilocks3::add13c_avx(tmp3[args[i_args]], &params.pols[args[i_args + 1] + i * args[i_args + 2]], params.challenges[args[i_args + 3]], args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 17:
+                    {
+                         Goldilocks3::add_avx(tmp3[args[i_args]], tmp3[args[i_args + 1]], tmp3[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 18:
+                    {
+                         Goldilocks3::add33c_avx(tmp3[args[i_args]], tmp3[args[i_args + 1]], params.challenges[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 19:
+                    {
+                         Goldilocks3::add_avx(tmp3[args[i_args]], &params.pols[args[i_args + 1] + i * args[i_args + 2]], tmp3[args[i_args + 3]], args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 20:
+                    {
+                         Goldilocks3::add33c_avx(tmp3[args[i_args]], &params.pols[args[i_args + 1] + i * args[i_args + 2]], params.challenges[args[i_args + 3]], args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 21:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 22:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], &params.pols[args[i_args + 2] + i * args[i_args + 3]], args[i_args + 3]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 23:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets2[j] = args[i_args + 2] + (((i + j) + args[i_args + 3]) % args[i_args + 4]) * args[i_args + 5];
+                         }
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], &params.pols[0], offsets2);
+                         i_args += 6;
+                         break;
+                    }
+                    case 24:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], tmp1[args[i_args + 3]], args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 25:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                         }
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], &params.pols[0], tmp1[args[i_args + 5]], offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 26:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], Goldilocks::fromU64(args[i_args + 2]));
+                         i_args += 3;
+                         break;
+                    }
+                    case 27:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], Goldilocks::fromU64(args[i_args + 1]), tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 28:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], Goldilocks::fromU64(args[i_args + 3]), args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 29:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                         }
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], &params.pols[0], Goldilocks::fromU64(args[i_args + 5]), offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 30:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], Goldilocks::fromU64(args[i_args + 1]), &params.pols[args[i_args + 2] + i * args[i_args + 3]], args[i_args + 3]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 31:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets2[j] = args[i_args + 2] + (((i + j) + args[i_args + 3]) % args[i_args + 4]) * args[i_args + 5];
+                         }
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], Goldilocks::fromU64(args[i_args + 1]), &params.pols[0], offsets2);
+                         i_args += 6;
+                         break;
+                    }
+                    case 32:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], Goldilocks::fromU64(args[i_args + 1]), &pConstPols->getElement(args[i_args + 2], i), numpols);
+                         i_args += 3;
+                         break;
+                    }
+                    case 33:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets2[j] = args[i_args + 2] + (((i + j) + args[i_args + 3]) % args[i_args + 4]) * numpols;
+                         }
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], Goldilocks::fromU64(args[i_args + 1]), &pConstPols->getElement(0, 0), offsets2);
+                         i_args += 5;
+                         break;
+                    }
+                    case 34:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], params.publicInputs[args[i_args + 3]], args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 35:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = args[i_args + 5] + (i + j) * args[i_args + 6];
+                         }
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                         i_args += 7;
+                         break;
+                    }
+                    case 36:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (i + j) * args[i_args + 2];
+                              offsets2[j] = args[i_args + 3] + (((i + j) + args[i_args + 4]) % args[i_args + 5]) * args[i_args + 6];
+                         }
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                         i_args += 7;
+                         break;
+                    }
+                    case 37:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &params.pols[args[i_args + 3] + i * args[i_args + 4]], args[i_args + 2], args[i_args + 4]);
+                         i_args += 5;
+                         break;
+                    }
+                    case 38:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = args[i_args + 5] + (((i + j) + args[i_args + 6]) % args[i_args + 7]) * args[i_args + 8];
+                         }
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                         i_args += 9;
+                         break;
+                    }
+                    case 39:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], &pConstPols->getElement(args[i_args + 1], i), &params.pols[args[i_args + 2] + i * args[i_args + 3]], numpols, args[i_args + 3]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 40:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], &pConstPols->getElement(args[i_args + 2], i), numpols);
+                         i_args += 3;
+                         break;
+                    }
+                    case 41:
+                    {
+                         Goldilocks3::sub31c_avx(tmp3[args[i_args]], &params.pols[args[i_args + 1] + i * args[i_args + 2]], Goldilocks::fromU64(args[i_args + 3]), args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 42:
+                    {
+                         Goldilocks3::sub_avx(tmp3[args[i_args]], tmp3[args[i_args + 1]], tmp3[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 43:
+                    {
+                         Goldilocks3::sub33c_avx(tmp3[args[i_args]], tmp3[args[i_args + 1]], params.challenges[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 44:
+                    {
+                         Goldilocks3::sub_avx(tmp3[args[i_args]], tmp3[args[i_args + 1]], &params.pols[args[i_args + 2] + i * args[i_args + 3]], args[i_args + 3]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 45:
+                    {
+                         Goldilocks::mult_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 46:
+                    {
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], Goldilocks::fromU64(args[i_args + 1]), tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 47:
+                    {
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], tmp1[args[i_args + 3]], args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 48:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                         }
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[0], tmp1[args[i_args + 5]], offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 49:
+                    {
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], &pConstPols->getElement(args[i_args + 2], i), numpols);
+                         i_args += 3;
+                         break;
+                    }
+                    case 50:
+                    {
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &params.pols[args[i_args + 3] + i * args[i_args + 4]], args[i_args + 2], args[i_args + 4]);
+                         i_args += 5;
+                         break;
+                    }
+                    case 51:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (i + j) * args[i_args + 2];
+                              offsets2[j] = args[i_args + 3] + (((i + j) + args[i_args + 4]) % args[i_args + 5]) * args[i_args + 6];
+                         }
+                         Goldilocks::mul_avx(tmp1[args[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                         i_args += 7;
+                         break;
+                    }
+                    case 52:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = args[i_args + 5] + (((i + j) + args[i_args + 6]) % args[i_args + 7]) * args[i_args + 8];
+                         }
+                         Goldilocks::mul_avx(tmp1[args[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                         i_args += 9;
+                         break;
+                    }
+                    case 53:
+                    {
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], Goldilocks::fromU64(args[i_args + 1]), &params.pols[args[i_args + 2] + i * args[i_args + 3]], args[i_args + 3]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 54:
+                    {
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &pConstPols->getElement(args[i_args + 3], i), args[i_args + 2], numpols);
+                         i_args += 4;
+                         break;
+                    }
+                    case 55:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = args[i_args + 5] + (i + j) * numpols;
+                         }
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[0], &pConstPols->getElement(0, 0), offsets1, offsets2);
+                         i_args += 6;
+                         break;
+                    }
+                    case 56:
+                    {
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], &params.pols[args[i_args + 2] + i * args[i_args + 3]], args[i_args + 3]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 57:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets2[j] = args[i_args + 2] + (((i + j) + args[i_args + 3]) % args[i_args + 4]) * args[i_args + 5];
+                         }
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], &params.pols[0], offsets2);
+                         i_args += 6;
+                         break;
+                    }
+                    case 58:
+                    {
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &pConstPols->getElement(args[i_args + 1], i), tmp1[args[i_args + 2]], numpols);
+                         i_args += 3;
+                         break;
+                    }
+                    case 59:
+                    {
+                         Goldilocks3::mul13c_avx(tmp3[args[i_args]], tmp1[args[i_args + 1]], params.challenges[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 60:
+                    {
+                         Goldilocks3::mul13_avx(tmp3[args[i_args]], &pConstPols->getElement(args[i_args + 1], i), tmp3[args[i_args + 2]], numpols);
+                         i_args += 3;
+                         break;
+                    }
+                    case 61:
+                    {
+                         Goldilocks3::mul13_avx(tmp3[args[i_args]], tmp1[args[i_args + 1]], tmp3[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 62:
+                    {
+                         Goldilocks3::mul13c_avx(tmp3[args[i_args]], &params.pols[args[i_args + 1] + i * args[i_args + 2]], params.challenges[args[i_args + 3]], args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 63:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                         }
+                         Goldilocks3::mul13c_avx(tmp3[args[i_args]], &params.pols[0], params.challenges[args[i_args + 5]], offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 64:
+                    {
+                         Goldilocks3::mul13_avx(tmp3[args[i_args]], &params.pols[args[i_args + 1] + i * args[i_args + 2]], tmp3[args[i_args + 3]], args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 65:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = FIELD_EXTENSION * (j + AVX_SIZE_ * args[i_args + 5]);
+                         }
+                         Goldilocks3::mul13_avx(tmp3[args[i_args]], &params.pols[0], tmp3[args[i_args + 5]], offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 66:
+                    {
+                         Goldilocks3::mul1c3c_avx(tmp3[args[i_args]], Goldilocks::fromU64(args[i_args + 1]), (Goldilocks3::Element &)*params.challenges[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 67:
+                    {
+                         Goldilocks3::mul13c_avx(tmp3[args[i_args]], params.x_n[i], (Goldilocks3::Element &)*params.challenges[args[i_args + 1]], params.x_n.offset());
+                         i_args += 2;
+                         break;
+                    }
+                    case 68:
+                    {
+                         Goldilocks3::mul13_avx(tmp3[args[i_args]], params.x_n[i], tmp3[args[i_args + 1]], params.x_n.offset());
+                         i_args += 2;
+                         break;
+                    }
+                    case 69:
+                    {
+                         Goldilocks::Element tmp_inv[3];
+                         Goldilocks::Element ti0[4];
+                         Goldilocks::Element ti1[4];
+                         Goldilocks::Element ti2[4];
+                         Goldilocks::store_avx(ti0, tmp3[args[i_args]][0]);
+                         Goldilocks::store_avx(ti1, tmp3[args[i_args]][1]);
+                         Goldilocks::store_avx(ti2, tmp3[args[i_args]][2]);
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              tmp_inv[0] = ti0[j];
+                              tmp_inv[1] = ti1[j];
+                              tmp_inv[2] = ti2[j];
+                              Goldilocks3::mul((Goldilocks3::Element &)(params.q_2ns[(i + j) * 3]),
+                                               params.zi.zhInv((i + j)),
+                                               (Goldilocks3::Element &)tmp_inv);
+                         }
+                         i_args += 1;
+                         break;
+                    }
+                    case 70:
+                    {
+                         Goldilocks3::mul33c_avx(tmp3[args[i_args]], tmp3[args[i_args + 2]], params.challenges[args[i_args + 1]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 71:
+                    {
+                         Goldilocks3::mul_avx(tmp3[args[i_args]], tmp3[args[i_args + 1]], tmp3[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 72:
+                    {
+                         Goldilocks3::mul_avx(tmp3[args[i_args]], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &params.pols[args[i_args + 3] + i * args[i_args + 4]], args[i_args + 2], args[i_args + 4]);
+                         i_args += 5;
+                         break;
+                    }
+                    case 73:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                         }
+                         Goldilocks3::mul33c_avx(tmp3[args[i_args]], &params.pols[0], params.challenges[args[i_args + 5]], offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 74:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = FIELD_EXTENSION * (j + AVX_SIZE_ * args[i_args + 5]);
+                         }
+                         Goldilocks3::mul_avx(tmp3[args[i_args]], &params.pols[0], tmp3[args[i_args + 5]], offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 75:
+                    {
+                         Goldilocks3::mul_avx(tmp3[args[i_args]], &params.pols[args[i_args + 1] + i * args[i_args + 2]], tmp3[args[i_args + 3]], args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 76:
+                    {
+                         Goldilocks3::mul33c_avx(tmp3[args[i_args]], &params.pols[args[i_args + 1] + i * args[i_args + 2]], params.challenges[args[i_args + 3]], args[i_args + 2]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 77:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = args[i_args + 5] + (i + j) * args[i_args + 6];
+                         }
+                         Goldilocks3::mul_avx(tmp3[args[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                         i_args += 7;
+                         break;
+                    }
+                    case 78:
+                    {
+                         Goldilocks::copy_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]]);
+                         i_args += 2;
+                         break;
+                    }
+                    case 79:
+                    {
+                         Goldilocks::copy_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], args[i_args + 2]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 80:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                         }
+                         Goldilocks::copy_avx(tmp1[args[i_args]], &params.pols[0], offsets1);
+                         i_args += 5;
+                         break;
+                    }
+                    case 81:
+                    {
+                         Goldilocks::copy_avx(tmp1[(args[i_args])], Goldilocks::fromU64(args[i_args + 1]));
+                         i_args += 2;
+                         break;
+                    }
+                    case 82:
+                    {
+                         Goldilocks::copy_avx(tmp1[(args[i_args])], &pConstPols->getElement(args[i_args + 1], i), numpols);
+                         i_args += 2;
+                         break;
+                    }
+                    case 83:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * numpols;
+                         }
+                         Goldilocks::copy_avx(tmp1[(args[i_args])], &pConstPols->getElement(0, 0), offsets1);
+                         i_args += 4;
+                         break;
+                    }
+                    case 84:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 2] + (((i + j) + args[i_args + 3]) % args[i_args + 4]) * args[i_args + 5];
+                         }
+                         Goldilocks::add_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], &params.pols[0], offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 85:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                         }
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[0], Goldilocks::fromU64(args[i_args + 5]), offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 86:
+                    {
+                         Goldilocks::add_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], tmp1[args[i_args + 2]], tmp1[args[i_args + 3]]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 87:
+                    {
+                         Goldilocks::add_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], tmp1[args[i_args + 2]], &params.pols[args[i_args + 3] + i * args[i_args + 4]], args[i_args + 4]);
+                         i_args += 5;
+                         break;
+                    }
+                    case 88:
+                    {
+                         Goldilocks3::add13_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], tmp1[args[i_args + 2]], tmp3[args[i_args + 3]]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 89:
+                    {
+                         Goldilocks3::add_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], &params.pols[args[i_args + 2] + i * args[i_args + 3]], tmp3[args[i_args + 4]], args[i_args + 3]);
+                         i_args += 5;
+                         break;
+                    }
+                    case 90:
+                    {
+                         Goldilocks3::add33c_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], tmp3[args[i_args + 2]], params.challenges[args[i_args + 3]]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 91:
+                    {
+                         Goldilocks::copy_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], &pConstPols->getElement(args[i_args + 2], i), numpols);
+                         i_args += 3;
+                         break;
+                    }
+                    case 92:
+                    {
+                         Goldilocks::sub_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], tmp1[args[i_args + 2]], tmp1[args[i_args + 3]]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 93:
+                    {
+                         Goldilocks::sub_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], Goldilocks::fromU64(args[i_args + 2]), tmp1[args[i_args + 3]]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 94:
+                    {
+                         Goldilocks::mul_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], tmp1[args[i_args + 2]], tmp1[args[i_args + 3]]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 95:
+                    {
+                         Goldilocks::mul_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], &params.pols[args[i_args + 2] + i * args[i_args + 3]], tmp1[args[i_args + 4]], args[i_args + 3]);
+                         i_args += 5;
+                         break;
+                    }
+                    case 96:
+                    {
+                         Goldilocks::mul_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], tmp1[args[i_args + 2]], &pConstPols->getElement(args[i_args + 3], i), numpols);
+                         i_args += 4;
+                         break;
+                    }
+                    case 97:
+                    {
+                         Goldilocks3::sub33c_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], tmp3[args[i_args + 2]], tmp3[args[i_args + 3]]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 98:
+                    {
+                         Goldilocks3::mul_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], tmp3[args[i_args + 2]], tmp3[args[i_args + 3]]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 99:
+                    {
+                         Goldilocks::mul_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], &params.pols[args[i_args + 2] + i * args[i_args + 3]], args[i_args + 3], &pConstPols->getElement(args[i_args + 4], i), numpols);
+                         i_args += 5;
+                         break;
+                    }
+                    case 100:
+                    {
+                         Goldilocks::copy_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], tmp1[(args[i_args + 2])]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 101:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                         }
+                         Goldilocks::add_avx(&params.pols[0], offsets1, tmp1[args[i_args + 4]], tmp1[args[i_args + 5]]);
+                         i_args += 6;
+                         break;
+                    }
+                    case 102:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                         }
+                         Goldilocks::add_avx(&params.pols[0], offsets1, tmp1[args[i_args + 4]], &params.pols[args[i_args + 5] + i * args[i_args + 6]], args[i_args + 6]);
+                         i_args += 7;
+                         break;
+                    }
+                    case 103:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                         }
+                         Goldilocks3::add13_avx(&params.pols[0], offsets1, tmp1[args[i_args + 4]], tmp3[args[i_args + 5]]);
+                         i_args += 6;
+                         break;
+                    }
+                    case 104:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                         }
+                         Goldilocks3::add_avx(&params.pols[0], offsets1, &params.pols[args[i_args + 4] + i * args[i_args + 5]], tmp3[args[i_args + 6]], args[i_args + 5]);
+                         i_args += 7;
+                         break;
+                    }
+                    case 105:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                         }
+                         Goldilocks3::add33c_avx(&params.pols[0], offsets1, tmp3[args[i_args + 4]], params.challenges[args[i_args + 5]]);
+                         i_args += 6;
+                         break;
+                    }
+                    case 106:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                         }
+                         Goldilocks::sub_avx(&params.pols[0], offsets1, tmp1[args[i_args + 4]], tmp1[args[i_args + 5]]);
+                         i_args += 6;
+                         break;
+                    }
+                    case 107:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                         }
+                         Goldilocks::sub_avx(&params.pols[0], offsets1, Goldilocks::fromU64(args[i_args + 4]), tmp1[args[i_args + 5]]);
+                         i_args += 6;
+                         break;
+                    }
+                    case 108:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                         }
+                         Goldilocks::mul_avx(&params.pols[0], offsets1, tmp1[args[i_args + 4]], tmp1[args[i_args + 5]]);
+                         i_args += 6;
+                         break;
+                    }
+                    case 109:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                         }
+                         Goldilocks::mul_avx(&params.pols[0], offsets1, &params.pols[args[i_args + 4] + i * args[i_args + 5]], tmp1[args[i_args + 6]], args[i_args + 5]);
+                         i_args += 7;
+                         break;
+                    }
+                    case 110:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                         }
+                         Goldilocks::mul_avx(&params.pols[0], offsets1, tmp1[args[i_args + 4]], &pConstPols->getElement(args[i_args + 5], i), numpols);
+                         i_args += 6;
+                         break;
+                    }
+                    case 111:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                              offsets2[j] = args[i_args + 4] + (((i + j) + args[i_args + 5]) % args[i_args + 6]) * numpols;
+                         }
+                         Goldilocks::mul_avx(&params.pols[0], offsets1, &pConstPols->getElement(0, 0), tmp1[args[i_args + 7]], offsets2);
+                         i_args += 8;
+                         break;
+                    }
+                    case 112:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                         }
+                         Goldilocks3::mul_avx(&params.pols[0], offsets1, tmp3[args[i_args + 4]], tmp3[args[i_args + 5]]);
+                         i_args += 6;
+                         break;
+                    }
+                    case 113:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                         }
+                         Goldilocks::copy_avx(&params.pols[0], offsets1, tmp1[(args[i_args + 4])]);
+                         i_args += 5;
+                         break;
+                    }
+                    case 114:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                              offsets2[j] = args[i_args + 5] + (((i + j) + args[i_args + 6]) % args[i_args + 7]) * args[i_args + 8];
+                         }
+                         Goldilocks::add_avx(&params.pols[0], offsets1, tmp1[args[i_args + 4]], &params.pols[0], offsets2);
+                         i_args += 9;
+                         break;
+                    }
+                    case 115:
+                    {
+                         Goldilocks3::add_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], tmp3[args[i_args + 2]], tmp3[args[i_args + 3]]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 116:
+                    {
+                         Goldilocks::copy_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], &params.pols[args[i_args + 2] + i * args[i_args + 3]], args[i_args + 3]);
+                         i_args += 4;
+                         break;
+                    }
+                    case 117:
+                    {
+                         Goldilocks::add_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], &params.pols[args[i_args + 2] + i * args[i_args + 3]], args[i_args + 3], &params.pols[args[i_args + 4] + i * args[i_args + 5]], args[i_args + 5]);
+                         i_args += 6;
+                         break;
+                    }
+                    case 118:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args] + (((i + j) + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3];
+                              offsets2[j] = args[i_args + 4] + (((i + j) + args[i_args + 5]) % args[i_args + 6]) * args[i_args + 7];
+                              offsets3[j] = args[i_args + 8] + (((i + j) + args[i_args + 9]) % args[i_args + 10]) * numpols;
+                         }
+                         Goldilocks::mul_avx(&params.pols[0], offsets1, &params.pols[0], &pConstPols->getElement(0, 0), offsets2, offsets3);
+                         i_args += 11;
+                         break;
+                    }
+                    case 119:
+                    {
+                         Goldilocks3::mul_avx(&params.pols[args[i_args] + i * args[i_args + 1]], args[i_args + 1], &params.pols[args[i_args + 2] + i * args[i_args + 3]], tmp3[args[i_args + 4]], args[i_args + 3]);
+                         i_args += 5;
+                         break;
+                    }
+                    case 120:
+                    {
+                         Goldilocks::add_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &params.pols[args[i_args + 3] + i * args[i_args + 4]], args[i_args + 2], args[i_args + 4]);
+                         i_args += 5;
+                         break;
+                    }
+                    case 121:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = args[i_args + 5] + (((i + j) + args[i_args + 6]) % args[i_args + 7]) * args[i_args + 8];
+                         }
+                         Goldilocks::add_avx(tmp1[args[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                         i_args += 9;
+                         break;
+                    }
+                    case 122:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * numpols;
+                              offsets2[j] = args[i_args + 4] + (((i + j) + args[i_args + 5]) % args[i_args + 6]) * numpols;
+                         }
+                         Goldilocks::add_avx(tmp1[args[i_args]], &pConstPols->getElement(0, 0), &pConstPols->getElement(0, 0), offsets1, offsets2);
+                         i_args += 7;
+                         break;
+                    }
+                    case 123:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * numpols;
+                         }
+                         Goldilocks::add_avx(tmp1[args[i_args]], &pConstPols->getElement(0, 0), Goldilocks::fromU64(args[i_args + 4]), offsets1);
+                         i_args += 5;
+                         break;
+                    }
+                    case 124:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets2[j] = args[i_args + 2] + (((i + j) + args[i_args + 3]) % args[i_args + 4]) * args[i_args + 5];
+                         }
+                         Goldilocks::sub_avx(tmp1[args[i_args]], tmp1[args[i_args + 1]], &params.pols[0], offsets2);
+                         i_args += 6;
+                         break;
+                    }
+                    case 125:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                         }
+                         Goldilocks::sub_avx(tmp1[args[i_args]], &params.pols[0], tmp1[args[i_args + 5]], offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 126:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                         }
+                         Goldilocks::sub_avx(tmp1[args[i_args]], &params.pols[0], Goldilocks::fromU64(args[i_args + 5]), offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 127:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets2[j] = args[i_args + 2] + (((i + j) + args[i_args + 3]) % args[i_args + 4]) * args[i_args + 5];
+                         }
+                         Goldilocks::sub_avx(tmp1[args[i_args]], Goldilocks::fromU64(args[i_args + 1]), &params.pols[0], offsets2);
+                         i_args += 6;
+                         break;
+                    }
+                    case 128:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets2[j] = args[i_args + 2] + (((i + j) + args[i_args + 3]) % args[i_args + 4]) * numpols;
+                         }
+                         Goldilocks::sub_avx(tmp1[args[i_args]], Goldilocks::fromU64(args[i_args + 1]), &pConstPols->getElement(0, 0), offsets2);
+                         i_args += 5;
+                         break;
+                    }
+                    case 129:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = args[i_args + 5] + (i + j) * args[i_args + 6];
+                         }
+                         Goldilocks::sub_avx(tmp1[args[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                         i_args += 7;
+                         break;
+                    }
+                    case 130:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (i + j) * args[i_args + 2];
+                              offsets2[j] = args[i_args + 3] + (((i + j) + args[i_args + 4]) % args[i_args + 5]) * args[i_args + 6];
+                         }
+                         Goldilocks::sub_avx(tmp1[args[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                         i_args += 7;
+                         break;
+                    }
+                    case 131:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = args[i_args + 5] + (((i + j) + args[i_args + 6]) % args[i_args + 7]) * args[i_args + 8];
+                         }
+                         Goldilocks::sub_avx(tmp1[args[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                         i_args += 9;
+                         break;
+                    }
+                    case 132:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                         }
+                         Goldilocks::mul_avx(tmp1[args[i_args]], &params.pols[0], tmp1[args[i_args + 5]], offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 133:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = args[i_args + 5] + (i + j) * numpols;
+                         }
+                         Goldilocks::mul_avx(tmp1[args[i_args]], &params.pols[0], &pConstPols->getElement(0, 0), offsets1, offsets2);
+                         i_args += 6;
+                         break;
+                    }
+                    case 134:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets2[j] = args[i_args + 2] + (((i + j) + args[i_args + 3]) % args[i_args + 4]) * args[i_args + 5];
+                         }
+                         Goldilocks::mul_avx(tmp1[args[i_args]], tmp1[args[i_args + 1]], &params.pols[0], offsets2);
+                         i_args += 6;
+                         break;
+                    }
+                    case 135:
+                    {
+                         Goldilocks3::mul13c_avx(tmp3[args[i_args]], params.x_2ns[i], (Goldilocks3::Element &)*params.challenges[args[i_args + 1]], params.x_2ns.offset());
+                         i_args += 2;
+                         break;
+                    }
+                    case 136:
+                    {
+                         Goldilocks3::mul13_avx(tmp3[args[i_args]], params.x_2ns[i], tmp3[args[i_args + 1]], params.x_2ns.offset());
+                         i_args += 2;
+                         break;
+                    }
+                    case 137:
+                    {
+                         Goldilocks3::add13_avx(tmp3[args[i_args]], tmp1[args[i_args + 1]], tmp3[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks3::mul33c_avx(tmp3[args[i_args]], tmp3[args[i_args + 2]], params.challenges[args[i_args + 1]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 138:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], Goldilocks::fromU64(args[i_args + 1]), &pConstPols->getElement(args[i_args + 2], i), numpols);
+                         i_args += 3;
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], tmp1[args[i_args + 3]], args[i_args + 2]);
+                         i_args += 4;
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], Goldilocks::fromU64(args[i_args + 1]), &pConstPols->getElement(args[i_args + 2], i), numpols);
+                         i_args += 3;
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                         }
+                         Goldilocks::mul_avx(tmp1[args[i_args]], &params.pols[0], tmp1[args[i_args + 5]], offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 139:
+                    {
+                         Goldilocks3::add13_avx(tmp3[args[i_args]], tmp1[args[i_args + 1]], tmp3[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks3::mul33c_avx(tmp3[args[i_args]], tmp3[args[i_args + 2]], params.challenges[args[i_args + 1]]);
+                         i_args += 3;
+                         Goldilocks3::add13_avx(tmp3[args[i_args]], tmp1[args[i_args + 1]], tmp3[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks3::mul33c_avx(tmp3[args[i_args]], tmp3[args[i_args + 2]], params.challenges[args[i_args + 1]]);
+                         i_args += 3;
+                         Goldilocks3::add13_avx(tmp3[args[i_args]], tmp1[args[i_args + 1]], tmp3[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks3::mul33c_avx(tmp3[args[i_args]], tmp3[args[i_args + 2]], params.challenges[args[i_args + 1]]);
+                         i_args += 3;
+                         Goldilocks3::add13_avx(tmp3[args[i_args]], tmp1[args[i_args + 1]], tmp3[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks3::mul33c_avx(tmp3[args[i_args]], tmp3[args[i_args + 2]], params.challenges[args[i_args + 1]]);
+                         i_args += 3;
+                         break;
+                    }
+                    case 140:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &params.pols[args[i_args + 3] + i * args[i_args + 4]], args[i_args + 2], args[i_args + 4]);
+                         i_args += 5;
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], Goldilocks::fromU64(args[i_args + 1]), &params.pols[args[i_args + 2] + i * args[i_args + 3]], args[i_args + 3]);
+                         i_args += 4;
+                         Goldilocks::add_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks::add_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &params.pols[args[i_args + 3] + i * args[i_args + 4]], args[i_args + 2], args[i_args + 4]);
+                         i_args += 5;
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &params.pols[args[i_args + 3] + i * args[i_args + 4]], args[i_args + 2], args[i_args + 4]);
+                         i_args += 5;
+                         Goldilocks::add_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &params.pols[args[i_args + 3] + i * args[i_args + 4]], args[i_args + 2], args[i_args + 4]);
+                         i_args += 5;
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], tmp1[args[i_args + 1]], tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         Goldilocks::mul_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &params.pols[args[i_args + 3] + i * args[i_args + 4]], args[i_args + 2], args[i_args + 4]);
+                         i_args += 5;
+                         break;
+                    }
+                    case 141:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                         }
+                         Goldilocks3::sub31c_avx(tmp3[(args[i_args])], &params.pols[0], Goldilocks::fromU64(args[i_args + 5]), offsets1);
+                         i_args += 6;
+                         break;
+                    }
+                    case 142:
+                    {
+                         for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                         {
+                              offsets1[j] = args[i_args + 1] + (((i + j) + args[i_args + 2]) % args[i_args + 3]) * args[i_args + 4];
+                              offsets2[j] = args[i_args + 5] + (((i + j) + args[i_args + 6]) % args[i_args + 7]) * numpols;
+                         }
+                         Goldilocks::mul_avx(tmp1[args[i_args]], &params.pols[0], &pConstPols->getElement(0, 0), offsets1, offsets2);
+                         i_args += 8;
+                         break;
+                    }
+                    case 143:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], &params.pols[args[i_args + 1] + i * args[i_args + 2]], &pConstPols->getElement(args[i_args + 3], i), args[i_args + 2], numpols);
+                         i_args += 4;
+                         break;
+                    }
+                    case 144:
+                    {
+                         Goldilocks::sub_avx(tmp1[(args[i_args])], &pConstPols->getElement(args[i_args + 1], i), numpols, tmp1[args[i_args + 2]]);
+                         i_args += 3;
+                         break;
+                    }
+                    default:
+                         zklog.error("chelpersGenericAvx() found invalid op=" + to_string(ops[kk]) + " in step " + step.name);
+                         exitProcess();
+                    }
+               }
+          }
+
+          delete[] tmp1;
+          delete[] tmp3;
+     }
+}
@@ -0,0 +1,143 @@
+#include "friFold.hpp"
+#include "friProve.hpp"
+#include "ntt_goldilocks.hpp"
+#include <omp.h>
+
+FRIFold::FRIFold(uint64_t reductionBits) : nXBits(reductionBits), nX(1 << reductionBits)
+{
+    half = Goldilocks::inv(Goldilocks::fromU64(2));
+
+    // Precompute the twiddles once per step
+    Goldilocks::Element wInv = Goldilocks::inv(Goldilocks::w(nXBits));
+    halfInvRoots.resize(nX / 2);
+    Goldilocks::Element r = half;
+    for (uint64_t i = 0; i < nX / 2; i++)
+    {
+        halfInvRoots[i] = r;
+        r = r * wInv;
+    }
+}
+
+void FRIFold::fold(Polinomial &pol2_e, Polinomial &friPol, uint64_t polBits, Goldilocks::Element shiftInv, Polinomial &challenge)
+{
+    uint64_t pol2N = (1 << polBits) >> nXBits;
+    Goldilocks::Element wi = Goldilocks::inv(Goldilocks::w(polBits));
+
+    uint64_t maxth = omp_get_max_threads();
+    if (maxth > pol2N)
+    {
+        maxth = pol2N;
+    }
+#pragma omp parallel num_threads(maxth)
+    {
+        uint64_t nth = omp_get_num_threads();
+        uint64_t thid = omp_get_thread_num();
+        uint64_t chunk = (pol2N + nth - 1) / nth;
+        uint64_t init = chunk * thid;
+        uint64_t end = (init + chunk < pol2N) ? init + chunk : pol2N;
+
+        // Thread-local contiguous scratch, reused by all the groups of this thread
+        std::vector<Goldilocks::Element> scratch(nX * FIELD_EXTENSION);
+
+        // sinv = shiftInv * wi^g
+        Goldilocks::Element sinv = shiftInv * Goldilocks::exp(wi, init);
+
+        for (uint64_t g = init; g < end; g++)
+        {
+            // Gather the group evaluations
+            for (uint64_t i = 0; i < nX; i++)
+            {
+                Goldilocks::Element *pSource = friPol[(i * pol2N) + g];
+                scratch[i * FIELD_EXTENSION] = pSource[0];
+                scratch[i * FIELD_EXTENSION + 1] = pSource[1];
+                scratch[i * FIELD_EXTENSION + 2] = pSource[2];
+            }
+
+            // z = challenge * shiftInv * wN^-g
+            Goldilocks3::Element z;
+            z[0] = challenge[0][0] * sinv;
+            z[1] = challenge[0][1] * sinv;
+            z[2] = challenge[0][2] * sinv;
+
+            // Fold in place, halving the number of evaluations at every round
+            uint64_t r = 0;
+            for (uint64_t m = nX; m > 1; m >>= 1)
+            {
+                uint64_t h = m >> 1;
+                for (uint64_t i = 0; i < h; i++)
+                {
+                    Goldilocks::Element *a = &scratch[i * FIELD_EXTENSION];
+                    Goldilocks::Element *b = &scratch[(i + h) * FIELD_EXTENSION];
+                    Goldilocks::Element &twiddle = halfInvRoots[i << r];
+
+                    Goldilocks3::Element even;
+                    Goldilocks3::Element odd;
+                    Goldilocks3::Element zOdd;
+                    for (uint64_t k = 0; k < FIELD_EXTENSION; k++)
+                    {
+                        even[k] = (a[k] + b[k]) * half;
+                        odd[k] = (a[k] - b[k]) * twiddle;
+                    }
+                    Goldilocks3::mul(zOdd, z, odd);
+                    for (uint64_t k = 0; k < FIELD_EXTENSION; k++)
+                    {
+                        a[k] = even[k] + zOdd[k];
+                    }
+                }
+
+                // z = z^2
+                Goldilocks3::Element z2;
+                Goldilocks3::mul(z2, z, z);
+                z[0] = z2[0];
+                z[1] = z2[1];
+                z[2] = z2[2];
+                r++;
+            }
+
+            pol2_e[g][0] = scratch[0];
+            pol2_e[g][1] = scratch[1];
+            pol2_e[g][2] = scratch[2];
+
+            sinv = sinv * wi;
+        }
+    }
+}
+
+void FRIFold::foldNTT(Polinomial &pol2_e, Polinomial &friPol, uint64_t polBits, Goldilocks::Element shiftInv, Polinomial &challenge)
+{
+    uint64_t pol2N = (1 << polBits) >> nXBits;
+    Goldilocks::Element wi = Goldilocks::inv(Goldilocks::w(polBits));
+
+    uint64_t maxth = omp_get_max_threads();
+    if (maxth > pol2N)
+    {
+        maxth = pol2N;
+    }
+#pragma omp parallel num_threads(maxth)
+    {
+        uint64_t nth = omp_get_num_threads();
+        uint64_t thid = omp_get_thread_num();
+        uint64_t chunk = (pol2N + nth - 1) / nth;
+        uint64_t init = chunk * thid;
+        uint64_t end = (init + chunk < pol2N) ? init + chunk : pol2N;
+
+        Goldilocks::Element sinv = shiftInv * Goldilocks::exp(wi, init);
+
+        for (uint64_t g = init; g < end; g++)
+        {
+            Polinomial ppar(nX, FIELD_EXTENSION);
+            Polinomial ppar_c(nX, FIELD_EXTENSION);
+
+            for (uint64_t i = 0; i < nX; i++)
+            {
+                Polinomial::copyElement(ppar, i, friPol, (i * pol2N) + g);
+            }
+            NTT_Goldilocks ntt(nX, 1);
+
+            ntt.INTT(ppar_c.address(), ppar.address(), nX, FIELD_EXTENSION);
+            FRIProve::polMulAxi(ppar_c, Goldilocks::one(), sinv); // Multiplies coefs by 1, shiftInv, shiftInv^2, shiftInv^3, ......
+            FRIProve::evalPol(pol2_e, g, ppar_c, challenge);
+            sinv = sinv * wi;
+        }
+    }
+}
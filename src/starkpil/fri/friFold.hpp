@@ -0,0 +1,36 @@
+#ifndef FRI_FOLD
+#define FRI_FOLD
+
+#include <vector>
+#include "goldilocks_base_field.hpp"
+#include "goldilocks_cubic_extension.hpp"
+#include "polinomial.hpp"
+
+/*
+    FRI folding kernel, working directly in evaluation form.
+
+    For every group g, the nX = 2^reductionBits evaluations friPol[i*pol2N + g], i = 0..nX-1, are the evaluations of a
+    polynomial Q over the nX-th roots of unity w^i, and the folded value is Q(challenge * shiftInv * wN^-g).
+    Q(z) is calculated with reductionBits radix-2 folding rounds, Q(z) = Qe(z^2) + z*Qo(z^2), where
+    Qe(w^2i) = (Q(w^i) + Q(-w^i))/2 and Qo(w^2i) = (Q(w^i) - Q(-w^i))/(2*w^i),
+    so no NTT, roots table or polynomial allocation is needed per group.
+*/
+class FRIFold
+{
+private:
+    uint64_t nXBits; // log2 of the number of evaluations folded into one
+    uint64_t nX; // Number of evaluations folded into one
+    Goldilocks::Element half; // 1/2
+    std::vector<Goldilocks::Element> halfInvRoots; // w^-i/2, i = 0..nX/2-1, where w is the nX-th root of unity; round r uses index i<<r
+
+public:
+    FRIFold(uint64_t reductionBits);
+
+    // Folds the 2^polBits evaluations of friPol into the 2^polBits/nX evaluations of pol2_e
+    void fold(Polinomial &pol2_e, Polinomial &friPol, uint64_t polBits, Goldilocks::Element shiftInv, Polinomial &challenge);
+
+    // Reference implementation, based on an INTT plus a Horner evaluation per group; kept for testing and benchmarking
+    void foldNTT(Polinomial &pol2_e, Polinomial &friPol, uint64_t polBits, Goldilocks::Element shiftInv, Polinomial &challenge);
+};
+
+#endif
@@ -1,6 +1,7 @@
 #include "friProve.hpp"
 #include "timer.hpp"
 #include "zklog.hpp"
+#include "friFold.hpp"
 
 void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transcript, Polinomial &friPol, uint64_t polBits, StarkInfo starkInfo)
 {
@@ -22,90 +23,25 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
         uint64_t reductionBits = polBits - starkInfo.starkStruct.steps[si].nBits;
 
         pol2N = 1 << (polBits - reductionBits);
-        uint64_t nX = (1 << polBits) / pol2N;
 
         Polinomial pol2_e(pol2N, FIELD_EXTENSION);
 
         Polinomial special_x(1, FIELD_EXTENSION);
         transcript.getField(special_x.address());
 
-        Polinomial sinv(1, 1);
-        Polinomial wi(1, 1);
-
-        *sinv[0] = *polShiftInv[0];
-        *wi[0] = Goldilocks::inv(Goldilocks::w(polBits));
-
-        uint64_t nn = ((1 << polBits) / nX);
-        u_int64_t maxth = omp_get_max_threads();
-        if (maxth > nn)
-        {
-            maxth = nn;
-        }
-#pragma omp parallel num_threads(maxth)
+        if (si == 0)
         {
-            u_int64_t nth = omp_get_num_threads();
-            u_int64_t thid = omp_get_thread_num();
-            u_int64_t chunk = nn / nth;
-            u_int64_t res = nn - nth * chunk;
-
-            // Evaluate bounds of the loop for the thread
-            uint64_t init = chunk * thid;
-            uint64_t end;
-            if (thid < res)
-            {
-                init += thid;
-                end = init + chunk + 1;
-            }
-            else
-            {
-                init += res;
-                end = init + chunk;
-            }
-            //  Evaluate the starting point for the sinv
-            Goldilocks::Element aux = *wi[0];
-            Goldilocks::Element sinv_ = *sinv[0];
-            for (uint64_t i = 0; i < chunk - 1; ++i)
-            {
-                aux = aux * (*wi[0]);
-            }
-            for (u_int64_t i = 0; i < thid; ++i)
-            {
-                sinv_ = sinv_ * aux;
-            }
-            u_int64_t ncor = res;
-            if (thid < res)
-            {
-                ncor = thid;
-            }
-            for (u_int64_t j = 0; j < ncor; ++j)
-            {
-                sinv_ = sinv_ * (*wi[0]);
-            }
-
-            for (uint64_t g = init; g < end; g++)
+#pragma omp parallel for
+            for (uint64_t g = 0; g < pol2N; g++)
             {
-                if (si == 0)
-                {
-                    Polinomial::copyElement(pol2_e, g, friPol, g);
-                }
-                else
-                {
-                    Polinomial ppar(nX, FIELD_EXTENSION);
-                    Polinomial ppar_c(nX, FIELD_EXTENSION);
-
-                    for (uint64_t i = 0; i < nX; i++)
-                    {
-                        Polinomial::copyElement(ppar, i, friPol, (i * pol2N) + g);
-                    }
-                    NTT_Goldilocks ntt(nX, 1);
-
-                    ntt.INTT(ppar_c.address(), ppar.address(), nX, FIELD_EXTENSION);
-                    polMulAxi(ppar_c, Goldilocks::one(), sinv_); // Multiplies coefs by 1, shiftInv, shiftInv^2, shiftInv^3, ......
-                    evalPol(pol2_e, g, ppar_c, special_x);
-                    sinv_ = sinv_ * (*wi[0]);
-                }
+                Polinomial::copyElement(pol2_e, g, friPol, g);
             }
         }
+        else
+        {
+            FRIFold friFold(reductionBits);
+            friFold.fold(pol2_e, friPol, polBits, *polShiftInv[0], special_x);
+        }
 
         if (si < starkInfo.starkStruct.steps.size() - 1)
         {
@@ -81,6 +81,71 @@ ordered_json proof2zkinStark(ordered_json &proof)
     return zkinOut;
 };
 
+// Proofs and ProofsC12 only differ in the type of the roots and of the Merkle path siblings
+template <typename P>
+void proofs2zkin(P &proofs, Zkin &zkin)
+{
+    uint64_t rootLimbs = zkinLimbs(proofs.root1[0]);
+    zkin.addSignal("root1", rootLimbs).add(proofs.root1);
+    zkin.addSignal("root2", rootLimbs).add(proofs.root2);
+    zkin.addSignal("root3", rootLimbs).add(proofs.root3);
+    zkin.addSignal("root4", rootLimbs).add(proofs.root4);
+    zkin.addSignal("evals").add(proofs.evals);
+
+    uint64_t nTrees = proofs.fri.trees.size();
+    uint64_t nQueries = proofs.fri.trees[0].polQueries.size();
+    for (uint64_t i = 1; i < nTrees; i++)
+    {
+        ZkinSignal &root = zkin.addSignal("s" + std::to_string(i) + "_root", rootLimbs);
+        root.add(proofs.fri.trees[i].root);
+        ZkinSignal &vals = zkin.addSignal("s" + std::to_string(i) + "_vals");
+        for (uint64_t q = 0; q < nQueries; q++)
+        {
+            vals.add(proofs.fri.trees[i].polQueries[q][0].v);
+        }
+        ZkinSignal &siblings = zkin.addSignal("s" + std::to_string(i) + "_siblings", rootLimbs);
+        for (uint64_t q = 0; q < nQueries; q++)
+        {
+            siblings.add(proofs.fri.trees[i].polQueries[q][0].mp);
+        }
+    }
+
+    // Values and siblings of the trees of stages 1, 2, 3, 4 and of the constant polynomials; stages 2 and 3 are
+    // skipped if they commit no polynomials
+    const char *suffixes[5] = {"1", "2", "3", "4", "C"};
+    bool present[5] = {true, proofs.fri.trees[0].polQueries[0][1].v.size() > 0, proofs.fri.trees[0].polQueries[0][2].v.size() > 0, true, true};
+    for (uint64_t k = 0; k < 5; k++)
+    {
+        if (!present[k]) continue;
+        ZkinSignal &vals = zkin.addSignal(string("s0_vals") + suffixes[k]);
+        for (uint64_t q = 0; q < nQueries; q++)
+        {
+            vals.add(proofs.fri.trees[0].polQueries[q][k].v);
+        }
+    }
+    for (uint64_t k = 0; k < 5; k++)
+    {
+        if (!present[k]) continue;
+        ZkinSignal &siblings = zkin.addSignal(string("s0_siblings") + suffixes[k], rootLimbs);
+        for (uint64_t q = 0; q < nQueries; q++)
+        {
+            siblings.add(proofs.fri.trees[0].polQueries[q][k].mp);
+        }
+    }
+
+    zkin.addSignal("finalPol").add(proofs.fri.pol);
+}
+
+void proof2zkinStark(FRIProof &fproof, Zkin &zkin)
+{
+    proofs2zkin(fproof.proofs, zkin);
+}
+
+void proof2zkinStark(FRIProofC12 &fproof, Zkin &zkin)
+{
+    proofs2zkin(fproof.proofs, zkin);
+}
+
 ordered_json joinzkin(ordered_json &zkin1, ordered_json &zkin2, ordered_json &verKey, uint64_t steps)
 {
     ordered_json zkinOut = ordered_json::object();
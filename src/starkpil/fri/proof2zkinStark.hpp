@@ -3,10 +3,15 @@
 
 #include <nlohmann/json.hpp>
 #include "friProof.hpp"
+#include "friProofC12.hpp"
+#include "zkin.hpp"
 
 using ordered_json = nlohmann::ordered_json;
 
 ordered_json proof2zkinStark(ordered_json &fproof);
+// Typed equivalents of proof2zkinStark(proof.proofs.proof2json()), with the same signals in the same order
+void proof2zkinStark(FRIProof &fproof, Zkin &zkin);
+void proof2zkinStark(FRIProofC12 &fproof, Zkin &zkin);
 ordered_json joinzkin(ordered_json &zkin1, ordered_json &zkin2, ordered_json &verKey, uint64_t steps);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "zkin.hpp"
+#include "zklog.hpp"
+#include "exit_process.hpp"
+
+void ZkinSignal::add (const Goldilocks::Element &e)
+{
+    values.push_back(Goldilocks::toU64(e));
+    for (uint64_t i = 1; i < nLimbs; i++)
+    {
+        values.push_back(0);
+    }
+}
+
+void ZkinSignal::add (const RawFr::Element &e)
+{
+    if (nLimbs != Fr_N64)
+    {
+        zklog.error("ZkinSignal::add() signal " + name + " has nLimbs=" + to_string(nLimbs) + " and cannot hold a BN128 value");
+        exitProcess();
+    }
+    RawFr::Element normal;
+    RawFr::field.fromMontgomery(normal, e);
+    for (uint64_t i = 0; i < Fr_N64; i++)
+    {
+        values.push_back(normal.v[i]);
+    }
+}
+
+void ZkinSignal::add (const mpz_t v)
+{
+    if (mpz_sizeinbase(v, 2) > nLimbs * 64)
+    {
+        zklog.error("ZkinSignal::add() signal " + name + " has nLimbs=" + to_string(nLimbs) + " and cannot hold value of " + to_string(mpz_sizeinbase(v, 2)) + " bits");
+        exitProcess();
+    }
+    uint64_t first = values.size();
+    values.resize(first + nLimbs, 0);
+    mpz_export((void *)&values[first], NULL, -1, 8, -1, 0, v);
+}
+
+string ZkinSignal::toString (uint64_t i) const
+{
+    mpz_t r;
+    mpz_init(r);
+    mpz_import(r, nLimbs, -1, 8, -1, 0, (const void *)value(i));
+    char *s = mpz_get_str(0, 10, r);
+    string result(s);
+    free(s);
+    mpz_clear(r);
+    return result;
+}
+
+ZkinSignal & Zkin::addSignal (const string &name, uint64_t nLimbs)
+{
+    signals.push_back(ZkinSignal(name, nLimbs));
+    return signals.back();
+}
+
+const ZkinSignal * Zkin::getSignal (const string &name) const
+{
+    for (uint64_t i = 0; i < signals.size(); i++)
+    {
+        if (signals[i].name == name)
+        {
+            return &signals[i];
+        }
+    }
+    return NULL;
+}
+
+uint64_t Zkin::size (void) const
+{
+    uint64_t total = 0;
+    for (uint64_t i = 0; i < signals.size(); i++)
+    {
+        total += signals[i].size();
+    }
+    return total;
+}
@@ -0,0 +1,59 @@
+#ifndef ZKIN_HPP
+#define ZKIN_HPP
+
+#include <string>
+#include <vector>
+#include <gmp.h>
+#include "goldilocks_base_field.hpp"
+#include "fr.hpp"
+
+using namespace std;
+
+/*
+    Typed, in-memory input of a circom witness calculator, i.e. the binary equivalent of the zkin JSON built by
+    proof2zkinStark(), used to hand a proof over to the witness calculator of the next recursion stage without
+    serializing it to JSON and parsing it back.
+
+    Every signal keeps its values flattened in the same order as json2FrGElements() flattens the JSON arrays, and
+    every value has nLimbs 64-bit limbs, least significant first, in normal (not Montgomery) form: 1 limb for
+    Goldilocks values, 4 limbs for BN128 values.
+*/
+
+class ZkinSignal
+{
+public:
+    string name;
+    uint64_t nLimbs;
+    vector<uint64_t> values;
+
+    ZkinSignal (const string &name, uint64_t nLimbs) : name(name), nLimbs(nLimbs) {};
+
+    uint64_t size (void) const { return values.size() / nLimbs; };
+    const uint64_t * value (uint64_t i) const { return &values[i * nLimbs]; };
+
+    void add (const Goldilocks::Element &e);
+    void add (const RawFr::Element &e);
+    void add (const mpz_t v);
+    template <typename T>
+    void add (const vector<T> &v) { for (uint64_t i = 0; i < v.size(); i++) add(v[i]); };
+    template <typename T>
+    void add (const vector<vector<T>> &v) { for (uint64_t i = 0; i < v.size(); i++) add(v[i]); };
+
+    string toString (uint64_t i) const;
+};
+
+class Zkin
+{
+public:
+    vector<ZkinSignal> signals;
+
+    ZkinSignal & addSignal (const string &name, uint64_t nLimbs = 1);
+    const ZkinSignal * getSignal (const string &name) const;
+    uint64_t size (void) const; // Total number of values
+};
+
+// Number of limbs of a zkin value of this type
+static inline uint64_t zkinLimbs (const Goldilocks::Element &e) { return 1; };
+static inline uint64_t zkinLimbs (const RawFr::Element &e) { return 4; };
+
+#endif
@@ -42,3 +42,34 @@ void MerkleTreeGL::merkelize()
     PoseidonGoldilocks::merkletree_avx(nodes, source, width, height);
 #endif
 }
+
+void MerkleTreeGL::hashLeaf(uint64_t idx, Goldilocks::Element *row)
+{
+#ifdef __AVX512__
+    PoseidonGoldilocks::linear_hash_avx512(&nodes[idx * HASH_SIZE], row, width);
+#else
+    PoseidonGoldilocks::linear_hash_avx(&nodes[idx * HASH_SIZE], row, width);
+#endif
+}
+
+// Same layout as PoseidonGoldilocks::merkletree(): the leaves are followed by every level of the
+// tree, and every node is the hash of its 2 children
+void MerkleTreeGL::merkelizeNodes()
+{
+    uint64_t pending = height;
+    uint64_t nextIndex = 0;
+    while (pending > 1)
+    {
+        uint64_t nextN = (pending - 1) / 2 + 1;
+#pragma omp parallel for
+        for (uint64_t i = 0; i < nextN; i++)
+        {
+            Goldilocks::Element input[SPONGE_WIDTH];
+            std::memset(input, 0, SPONGE_WIDTH * sizeof(Goldilocks::Element));
+            std::memcpy(input, &nodes[nextIndex + i * RATE], RATE * sizeof(Goldilocks::Element));
+            PoseidonGoldilocks::hash((Goldilocks::Element(&)[CAPACITY])nodes[nextIndex + (pending + i) * CAPACITY], input);
+        }
+        nextIndex += pending * CAPACITY;
+        pending = pending / 2;
+    }
+}
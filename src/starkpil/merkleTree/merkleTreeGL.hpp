@@ -58,6 +58,8 @@ public:
     }
 
     void merkelize();
+    void hashLeaf(uint64_t idx, Goldilocks::Element *row); // Hashes a source row, which may not be stored in source yet
+    void merkelizeNodes(); // Builds the internal nodes once all the leaves have been hashed with hashLeaf()
     uint64_t getTreeNumElements()
     {
         return height * HASH_SIZE + (height - 1) * HASH_SIZE;
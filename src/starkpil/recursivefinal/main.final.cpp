@@ -14,6 +14,7 @@ using json = nlohmann::json;
 
 #include "calcwit.final.hpp"
 #include "circom.final.hpp"
+#include "zkin.hpp"
 
 namespace CircomFinal
 {
@@ -248,6 +249,74 @@ namespace CircomFinal
     }
   }
 
+  void loadZkin(Circom_CalcWit *ctx, const Zkin &zkin)
+  {
+    if (zkin.signals.size() == 0)
+    {
+      ctx->tryRunCircuit();
+    }
+    for (uint64_t s = 0; s < zkin.signals.size(); s++)
+    {
+      const ZkinSignal &signal = zkin.signals[s];
+      if ((signal.nLimbs == 0) || (signal.nLimbs > Fr_N64))
+      {
+        std::ostringstream errStrStream;
+        errStrStream << "Error loading signal " << signal.name << ": Invalid number of limbs " << signal.nLimbs << "\n";
+        throw std::runtime_error(errStrStream.str());
+      }
+      u64 h = fnv1a(signal.name);
+      uint signalSize = ctx->getInputSignalSize(h);
+      if (signal.size() < signalSize)
+      {
+        std::ostringstream errStrStream;
+        errStrStream << "Error loading signal " << signal.name << ": Not enough values\n";
+        throw std::runtime_error(errStrStream.str());
+      }
+      if (signal.size() > signalSize)
+      {
+        std::ostringstream errStrStream;
+        errStrStream << "Error loading signal " << signal.name << ": Too many values\n";
+        throw std::runtime_error(errStrStream.str());
+      }
+      for (uint i = 0; i < signal.size(); i++)
+      {
+        // Same element Fr_str2element() would build from the decimal string of the value
+        FrElement v;
+        const uint64_t *value = signal.value(i);
+        bool bShort = (value[0] <= INT32_MAX);
+        for (uint64_t l = 1; l < signal.nLimbs; l++)
+        {
+          bShort = bShort && (value[l] == 0);
+        }
+        if (bShort)
+        {
+          v.type = Fr_SHORT;
+          v.shortVal = value[0];
+        }
+        else
+        {
+          v.type = Fr_LONG;
+          v.shortVal = 0;
+          for (uint64_t l = 0; l < Fr_N64; l++)
+          {
+            v.longVal[l] = (l < signal.nLimbs) ? value[l] : 0;
+          }
+        }
+        try
+        {
+          ctx->setInputSignal(h, i, v);
+        }
+        catch (std::runtime_error &e)
+        {
+          std::ostringstream errStrStream;
+          errStrStream << "Error setting signal: " << signal.name << "\n"
+                       << e.what();
+          throw std::runtime_error(errStrStream.str());
+        }
+      }
+    }
+  }
+
   void writeBinWitness(Circom_CalcWit *ctx, std::string wtnsFileName)
   {
     FILE *write_ptr;
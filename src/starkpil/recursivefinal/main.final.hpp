@@ -6,6 +6,7 @@
 #include "calcwit.final.hpp"
 #include "circom.final.hpp"
 #include "fr.hpp"
+#include "zkin.hpp"
 
 namespace CircomFinal
 {
@@ -13,6 +14,7 @@ namespace CircomFinal
     void freeCircuit(Circom_Circuit *circuit);
     void loadJson(Circom_CalcWit *ctx, std::string filename);
     void loadJsonImpl(Circom_CalcWit *ctx, json &j);
+    void loadZkin(Circom_CalcWit *ctx, const Zkin &zkin);
     void writeBinWitness(Circom_CalcWit *ctx, std::string wtnsFileName);
     void getBinWitness(Circom_CalcWit *ctx, RawFr::Element *&pWitness, uint64_t &witnessSize);
     bool check_valid_number(std::string &s, uint base);
@@ -42,20 +42,30 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
         q_2ns : p_q_2ns,
         f_2ns : p_f_2ns
     };
+    const ChelpersStep *pChelpersStep = NULL;
     TimerStopAndLog(STARK_INITIALIZATION);
     //--------------------------------
     // 1.- Calculate p_cm1_2ns
     //--------------------------------
     TimerStart(STARK_STEP_1);
     TimerStart(STARK_STEP_1_LDE_AND_MERKLETREE);
-    TimerStart(STARK_STEP_1_LDE);
-
-    ntt.extendPol(p_cm1_2ns, p_cm1_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm2_2ns);
-    TimerStopAndLog(STARK_STEP_1_LDE);
-    TimerStart(STARK_STEP_1_MERKLETREE);
-    treesGL[0]->merkelize();
-    treesGL[0]->getRoot(root0.address());
-    TimerStopAndLog(STARK_STEP_1_MERKLETREE);
+    if (config.fusedLDEAndMerkleTree)
+    {
+        TimerStart(STARK_STEP_1_LDE_AND_MERKLETREE_FUSED);
+        extendPolAndMerkelize(p_cm1_2ns, p_cm1_n, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm2_2ns, treesGL[0]);
+        treesGL[0]->getRoot(root0.address());
+        TimerStopAndLog(STARK_STEP_1_LDE_AND_MERKLETREE_FUSED);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_1_LDE);
+        ntt.extendPol(p_cm1_2ns, p_cm1_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm2_2ns);
+        TimerStopAndLog(STARK_STEP_1_LDE);
+        TimerStart(STARK_STEP_1_MERKLETREE);
+        treesGL[0]->merkelize();
+        treesGL[0]->getRoot(root0.address());
+        TimerStopAndLog(STARK_STEP_1_MERKLETREE);
+    }
     zklog.info("MerkleTree rootGL 0: [ " + root0.toString(4) + " ]");
     transcript.put(root0.address(), HASH_SIZE);
     TimerStopAndLog(STARK_STEP_1_LDE_AND_MERKLETREE);
@@ -67,7 +77,13 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     TimerStart(STARK_STEP_2);
     transcript.getField(challenges[0]); // u
     transcript.getField(challenges[1]); // defVal
-    if (nrowsStepBatch == 4)
+    if ((pChelpersStep = getChelpersStep("step2prev")) != NULL)
+    {
+        TimerStart(STARK_STEP_2_CALCULATE_EXPS_CHELPERS);
+        chelpersGenericAvx(params, *pChelpersStep, N);
+        TimerStopAndLog(STARK_STEP_2_CALCULATE_EXPS_CHELPERS);
+    }
+    else if (nrowsStepBatch == 4)
     {
         TimerStart(STARK_STEP_2_CALCULATE_EXPS_AVX);
         steps->step2prev_parser_first_avx(params, N, nrowsStepBatch);
@@ -130,13 +146,23 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     TimerStopAndLog(STARK_STEP_2_CALCULATEH1H2_TRANSPOSE_2);
 
     TimerStart(STARK_STEP_2_LDE_AND_MERKLETREE);
-    TimerStart(STARK_STEP_2_LDE);
-    ntt.extendPol(p_cm2_2ns, p_cm2_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm2_n], pBuffer);
-    TimerStopAndLog(STARK_STEP_2_LDE);
-    TimerStart(STARK_STEP_2_MERKLETREE);
-    treesGL[1]->merkelize();
-    treesGL[1]->getRoot(root1.address());
-    TimerStopAndLog(STARK_STEP_2_MERKLETREE);
+    if (config.fusedLDEAndMerkleTree)
+    {
+        TimerStart(STARK_STEP_2_LDE_AND_MERKLETREE_FUSED);
+        extendPolAndMerkelize(p_cm2_2ns, p_cm2_n, starkInfo.mapSectionsN.section[eSection::cm2_n], pBuffer, treesGL[1]);
+        treesGL[1]->getRoot(root1.address());
+        TimerStopAndLog(STARK_STEP_2_LDE_AND_MERKLETREE_FUSED);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_2_LDE);
+        ntt.extendPol(p_cm2_2ns, p_cm2_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm2_n], pBuffer);
+        TimerStopAndLog(STARK_STEP_2_LDE);
+        TimerStart(STARK_STEP_2_MERKLETREE);
+        treesGL[1]->merkelize();
+        treesGL[1]->getRoot(root1.address());
+        TimerStopAndLog(STARK_STEP_2_MERKLETREE);
+    }
     zklog.info("MerkleTree rootGL 1: [ " + root1.toString(4) + " ]");
     transcript.put(root1.address(), HASH_SIZE);
 
@@ -149,7 +175,13 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     TimerStart(STARK_STEP_3);
     transcript.getField(challenges[2]); // gamma
     transcript.getField(challenges[3]); // betta
-    if (nrowsStepBatch == 4)
+    if ((pChelpersStep = getChelpersStep("step3prev")) != NULL)
+    {
+        TimerStart(STARK_STEP_3_CALCULATE_EXPS_CHELPERS);
+        chelpersGenericAvx(params, *pChelpersStep, N);
+        TimerStopAndLog(STARK_STEP_3_CALCULATE_EXPS_CHELPERS);
+    }
+    else if (nrowsStepBatch == 4)
     {
         TimerStart(STARK_STEP_3_CALCULATE_EXPS_AVX);
         steps->step3prev_parser_first_avx(params, N, nrowsStepBatch);
@@ -187,7 +219,13 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     TimerStart(STARK_STEP_3_CALCULATE_Z_TRANSPOSE_2);
     transposeZRows(pAddress, numCommited, newpols_);
     TimerStopAndLog(STARK_STEP_3_CALCULATE_Z_TRANSPOSE_2);
-    if (nrowsStepBatch == 4)
+    if ((pChelpersStep = getChelpersStep("step3")) != NULL)
+    {
+        TimerStart(STARK_STEP_3_CALCULATE_EXPS_2_CHELPERS);
+        chelpersGenericAvx(params, *pChelpersStep, N);
+        TimerStopAndLog(STARK_STEP_3_CALCULATE_EXPS_2_CHELPERS);
+    }
+    else if (nrowsStepBatch == 4)
     {
         TimerStart(STARK_STEP_3_CALCULATE_EXPS_2_AVX);
         steps->step3_parser_first_avx(params, N, nrowsStepBatch);
@@ -211,13 +249,23 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     }
 
     TimerStart(STARK_STEP_3_LDE_AND_MERKLETREE);
-    TimerStart(STARK_STEP_3_LDE);
-    ntt.extendPol(p_cm3_2ns, p_cm3_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm3_n], pBuffer);
-    TimerStopAndLog(STARK_STEP_3_LDE);
-    TimerStart(STARK_STEP_3_MERKLETREE);
-    treesGL[2]->merkelize();
-    treesGL[2]->getRoot(root2.address());
-    TimerStopAndLog(STARK_STEP_3_MERKLETREE);
+    if (config.fusedLDEAndMerkleTree)
+    {
+        TimerStart(STARK_STEP_3_LDE_AND_MERKLETREE_FUSED);
+        extendPolAndMerkelize(p_cm3_2ns, p_cm3_n, starkInfo.mapSectionsN.section[eSection::cm3_n], pBuffer, treesGL[2]);
+        treesGL[2]->getRoot(root2.address());
+        TimerStopAndLog(STARK_STEP_3_LDE_AND_MERKLETREE_FUSED);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_3_LDE);
+        ntt.extendPol(p_cm3_2ns, p_cm3_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm3_n], pBuffer);
+        TimerStopAndLog(STARK_STEP_3_LDE);
+        TimerStart(STARK_STEP_3_MERKLETREE);
+        treesGL[2]->merkelize();
+        treesGL[2]->getRoot(root2.address());
+        TimerStopAndLog(STARK_STEP_3_MERKLETREE);
+    }
     zklog.info("MerkleTree rootGL 2: [ " + root2.toString(4) + " ]");
     transcript.put(root2.address(), HASH_SIZE);
     TimerStopAndLog(STARK_STEP_3_LDE_AND_MERKLETREE);
@@ -235,11 +283,61 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
 
     uint64_t extendBits = starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits;
     TimerStopAndLog(STARK_STEP_4_INIT);
-    if (nrowsStepBatch == 4)
+    if ((pChelpersStep = getChelpersStep("step42ns")) != NULL)
+    {
+        TimerStart(STARK_STEP_4_CALCULATE_EXPS_2NS_CHELPERS);
+        struct timeval t;
+        gettimeofday(&t, NULL);
+        chelpersGenericAvx(params, *pChelpersStep, NExtended);
+        uint64_t chelpersTime = TimeDiff(t);
+        TimerStopAndLog(STARK_STEP_4_CALCULATE_EXPS_2NS_CHELPERS);
+
+        // Check the generic evaluator against the compiled-in parser, and compare their performance
+        if (config.chelpersCompare)
+        {
+            TimerStart(STARK_STEP_4_CALCULATE_EXPS_2NS_CHELPERS_COMPARE);
+            uint64_t qSize = NExtended * starkInfo.mapSectionsN.section[eSection::q_2ns];
+            Goldilocks::Element *pChelpersQ = (Goldilocks::Element *)malloc(qSize * sizeof(Goldilocks::Element));
+            if (pChelpersQ == NULL)
+            {
+                zklog.error("Starks::genProof() failed calling malloc() of size=" + to_string(qSize * sizeof(Goldilocks::Element)));
+                exitProcess();
+            }
+            memcpy(pChelpersQ, p_q_2ns, qSize * sizeof(Goldilocks::Element));
+            gettimeofday(&t, NULL);
+            steps->step42ns_parser_first_avx(params, NExtended, 4);
+            uint64_t parserTime = TimeDiff(t);
+            bool bEqual = (memcmp(pChelpersQ, p_q_2ns, qSize * sizeof(Goldilocks::Element)) == 0);
+            free(pChelpersQ);
+            zklog.info("Starks::genProof() step42ns chelpers time=" + to_string(chelpersTime) + "us compiled parser time=" + to_string(parserTime) + "us ratio=" + to_string(double(chelpersTime) / (parserTime == 0 ? 1 : parserTime)) + " equal=" + to_string(bEqual));
+            if (!bEqual)
+            {
+                zklog.error("Starks::genProof() found that the chelpers file " + starkFiles.zkevmChelpers + " and the compiled-in parser computed a different q_2ns in step42ns");
+                exitProcess();
+            }
+            TimerStopAndLog(STARK_STEP_4_CALCULATE_EXPS_2NS_CHELPERS_COMPARE);
+        }
+    }
+    else if (nrowsStepBatch == 4)
     {
-        TimerStart(STARK_STEP_4_CALCULATE_EXPS_2NS_AVX);
-        steps->step42ns_parser_first_avx(params, NExtended, nrowsStepBatch);
-        TimerStopAndLog(STARK_STEP_4_CALCULATE_EXPS_2NS_AVX);
+        if (config.chelpersProfile)
+        {
+            TimerStart(STARK_STEP_4_CALCULATE_EXPS_2NS_AVX_PROFILE);
+            steps->step42ns_parser_first_avx_profile(params, NExtended, nrowsStepBatch);
+            TimerStopAndLog(STARK_STEP_4_CALCULATE_EXPS_2NS_AVX_PROFILE);
+        }
+        if (config.chelpersFused)
+        {
+            TimerStart(STARK_STEP_4_CALCULATE_EXPS_2NS_AVX_FUSED);
+            steps->step42ns_parser_first_avx_fused(params, NExtended, nrowsStepBatch);
+            TimerStopAndLog(STARK_STEP_4_CALCULATE_EXPS_2NS_AVX_FUSED);
+        }
+        else
+        {
+            TimerStart(STARK_STEP_4_CALCULATE_EXPS_2NS_AVX);
+            steps->step42ns_parser_first_avx(params, NExtended, nrowsStepBatch);
+            TimerStopAndLog(STARK_STEP_4_CALCULATE_EXPS_2NS_AVX);
+        }
     }
     else if (nrowsStepBatch == 8)
     {
@@ -403,6 +501,120 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     TimerStopAndLog(STARK_STEP_FRI);
 }
 
+/*
+    Low degree extension of ncols polynomials of pSrc (N rows) into pDst (NExtended rows), hashing the
+    leaves of pTree as soon as their rows are final, instead of re-reading pDst in a separate pass.
+    The extended NTT is computed as a 4-step NTT of NExtended = nTile*nTiles rows:
+      1. The coefficients are computed in pDst with an INTT of N rows, and multiplied by shift^i.
+      2. nTile NTTs of nTiles rows, each of them over the rows i1, nTile + i1, 2*nTile + i1, ..., are
+         multiplied by the twiddle factors w^(i1*k2) and stored in pBuffer as rows k2*nTile + i1.
+      3. nTiles NTTs of nTile consecutive rows of pBuffer: tile k2 produces the final rows
+         k1*nTiles + k2, which are copied to pDst and hashed while the tile is still in cache.
+    nTile is chosen so that a tile fits in config.fusedLDEAndMerkleTreeTileSize bytes, and the NTTs of
+    step 2 are done in blocks of columns of the same size.  pBuffer must have NExtended*ncols elements,
+    as when calling ntt.extendPol().
+*/
+void Starks::extendPolAndMerkelize(Goldilocks::Element *pDst, Goldilocks::Element *pSrc, uint64_t ncols, Goldilocks::Element *pBuffer, MerkleTreeGL *pTree)
+{
+    extendPolAndMerkelize(ntt, starkInfo.starkStruct.nBits, starkInfo.starkStruct.nBitsExt, config.fusedLDEAndMerkleTreeTileSize, pDst, pSrc, ncols, pBuffer, pTree);
+}
+
+// Static version of the previous one, for any size: ntt must be of N = 2^nBits elements
+void Starks::extendPolAndMerkelize(NTT_Goldilocks &ntt, uint64_t nBits, uint64_t nBitsExt, uint64_t tileSize, Goldilocks::Element *pDst, Goldilocks::Element *pSrc, uint64_t ncols, Goldilocks::Element *pBuffer, MerkleTreeGL *pTree)
+{
+    uint64_t N = 1 << nBits;
+    uint64_t NExtended = 1 << nBitsExt;
+
+    uint64_t nTile = 2;
+    while ((nTile * 4 <= NExtended) && (nTile * 2 * ncols * sizeof(Goldilocks::Element) <= tileSize))
+    {
+        nTile *= 2;
+    }
+    uint64_t nTiles = NExtended / nTile;
+    uint64_t nBlockCols = std::max((uint64_t)1, std::min(ncols, tileSize / (nTiles * sizeof(Goldilocks::Element))));
+    uint64_t nBlocks = (ncols + nBlockCols - 1) / nBlockCols;
+
+    NTT_Goldilocks nttTile(nTile, 1);
+    NTT_Goldilocks nttColumn(nTiles, 1);
+
+    // 1. Coefficients
+    ntt.INTT(pDst, pSrc, N, ncols, pBuffer);
+
+#pragma omp parallel
+    {
+        Goldilocks::Element *column = (Goldilocks::Element *)malloc(std::max(nTiles * nBlockCols, nTile * ncols) * sizeof(Goldilocks::Element));
+        Goldilocks::Element *tmp = (Goldilocks::Element *)malloc(std::max(nTiles * nBlockCols, nTile * ncols) * sizeof(Goldilocks::Element));
+        if ((column == NULL) || (tmp == NULL))
+        {
+            zklog.error("Starks::extendPolAndMerkelize() failed calling malloc() nTile=" + to_string(nTile) + " nTiles=" + to_string(nTiles) + " nBlockCols=" + to_string(nBlockCols));
+            exitProcess();
+        }
+
+        // 2. NTTs of the strided rows, in blocks of columns, with the coset shift and the twiddle factors
+#pragma omp for collapse(2)
+        for (uint64_t i1 = 0; i1 < nTile; i1++)
+        {
+            for (uint64_t b = 0; b < nBlocks; b++)
+            {
+                uint64_t firstCol = b * nBlockCols;
+                uint64_t nCols = std::min(nBlockCols, ncols - firstCol);
+
+                Goldilocks::Element shiftStep = Goldilocks::exp(Goldilocks::shift(), nTile);
+                Goldilocks::Element s = Goldilocks::exp(Goldilocks::shift(), i1);
+                for (uint64_t i2 = 0; i2 < nTiles; i2++)
+                {
+                    uint64_t i = i2 * nTile + i1;
+                    for (uint64_t c = 0; c < nCols; c++)
+                    {
+                        if (i < N)
+                        {
+                            Goldilocks::mul(column[i2 * nCols + c], pDst[i * ncols + firstCol + c], s);
+                        }
+                        else
+                        {
+                            column[i2 * nCols + c] = Goldilocks::zero();
+                        }
+                    }
+                    Goldilocks::mul(s, s, shiftStep);
+                }
+
+                nttColumn.NTT(column, column, nTiles, nCols, tmp);
+
+                Goldilocks::Element twiddleStep = Goldilocks::exp(Goldilocks::w(nBitsExt), i1);
+                Goldilocks::Element twiddle = Goldilocks::one();
+                for (uint64_t k2 = 0; k2 < nTiles; k2++)
+                {
+                    Goldilocks::Element *pRow = &pBuffer[(k2 * nTile + i1) * ncols + firstCol];
+                    for (uint64_t c = 0; c < nCols; c++)
+                    {
+                        Goldilocks::mul(pRow[c], column[k2 * nCols + c], twiddle);
+                    }
+                    Goldilocks::mul(twiddle, twiddle, twiddleStep);
+                }
+            }
+        }
+
+        // 3. NTTs of the tiles of consecutive rows, copying and hashing every final row
+#pragma omp for
+        for (uint64_t k2 = 0; k2 < nTiles; k2++)
+        {
+            Goldilocks::Element *pTile = &pBuffer[k2 * nTile * ncols];
+            nttTile.NTT(pTile, pTile, nTile, ncols, tmp);
+            for (uint64_t k1 = 0; k1 < nTile; k1++)
+            {
+                uint64_t row = k1 * nTiles + k2;
+                std::memcpy(&pDst[row * ncols], &pTile[k1 * ncols], ncols * sizeof(Goldilocks::Element));
+                pTree->hashLeaf(row, &pTile[k1 * ncols]);
+            }
+        }
+
+        free(column);
+        free(tmp);
+    }
+
+    pTree->merkelizeNodes();
+}
+
 Polinomial *Starks::transposeH1H2Columns(void *pAddress, uint64_t &numCommited, Goldilocks::Element *pBuffer)
 {
     Goldilocks::Element *mem = (Goldilocks::Element *)pAddress;
@@ -668,6 +880,67 @@ void Starks::evmap(void *pAddress, Polinomial &evals, Polinomial &LEv, Polinomia
     free(evals_acc);
 }
 
+// Copies big buffers, e.g. constant files, in blocks of 1MB
+static void copyInParallel(uint8_t *pDst, const void *pSrc, uint64_t size)
+{
+    uint64_t blockSize = 1024 * 1024;
+    uint64_t nBlocks = (size + blockSize - 1) / blockSize;
+#pragma omp parallel for
+    for (uint64_t i = 0; i < nBlocks; i++)
+    {
+        uint64_t offset = i * blockSize;
+        std::memcpy(pDst + offset, (const uint8_t *)pSrc + offset, std::min(blockSize, size - offset));
+    }
+}
+
+// Attaches to the segment of constant polynomials and constant tree shared by all the prover processes of
+// this host, or creates it and loads the files into it if this is the first process
+void Starks::attachSharedConstants()
+{
+    uint64_t constTreeSize = starkInfo.getConstTreeSizeInBytes();
+    uint64_t signature[SHARED_MEMORY_SIGNATURE_SIZE] = {0};
+    signature[0] = constPolsSize;
+    signature[1] = constTreeSize;
+    signature[2] = fileModificationTime(starkFiles.zkevmConstPols);
+    signature[3] = fileModificationTime(starkFiles.zkevmConstantsTree);
+
+    pSharedConstants = new SharedMemorySegment(sharedMemoryName(starkFiles.zkevmConstPols), config.sharedConstantsHugePagesPath, constPolsSize + constTreeSize, signature);
+    uint8_t *pData = pSharedConstants->getData();
+
+    if (pSharedConstants->isLoader())
+    {
+        TimerStart(LOAD_SHARED_CONSTANTS);
+        void *pFile = mapFile(starkFiles.zkevmConstPols, constPolsSize, false);
+        copyInParallel(pData, pFile, constPolsSize);
+        unmapFile(pFile, constPolsSize);
+        pFile = mapFile(starkFiles.zkevmConstantsTree, constTreeSize, false);
+        copyInParallel(pData + constPolsSize, pFile, constTreeSize);
+        unmapFile(pFile, constTreeSize);
+        pSharedConstants->setReady();
+        TimerStopAndLog(LOAD_SHARED_CONSTANTS);
+        zklog.info("Starks::attachSharedConstants() loaded " + to_string(constPolsSize + constTreeSize) + " bytes from constant files " + starkFiles.zkevmConstPols + " and " + starkFiles.zkevmConstantsTree);
+    }
+    else
+    {
+        TimerStart(WAIT_SHARED_CONSTANTS);
+        pSharedConstants->waitReady(config.sharedConstantsTimeout);
+        TimerStopAndLog(WAIT_SHARED_CONSTANTS);
+    }
+
+    pConstPolsAddress = pData;
+}
+
+// Returns the step of the chelpers binary file, or NULL if there is no file or it does not contain the step,
+// in which case the compiled-in parsers are used
+const ChelpersStep *Starks::getChelpersStep(const string &stepName)
+{
+    if (pChelpers == NULL)
+    {
+        return NULL;
+    }
+    return pChelpers->getStep(stepName);
+}
+
 void Starks::merkelizeMemory()
 {
     uint64_t polsSize = starkInfo.mapTotalN + starkInfo.mapSectionsN.section[eSection::cm3_2ns] * (1 << starkInfo.starkStruct.nBitsExt);
@@ -14,6 +14,8 @@
 #include "steps.hpp"
 #include "zklog.hpp"
 #include "exit_process.hpp"
+#include "shared_memory.hpp"
+#include "chelpers_binary.hpp"
 
 #define STARK_C12_A_NUM_TREES 5
 #define NUM_CHALLENGES 8
@@ -24,6 +26,7 @@ struct StarkFiles
     bool mapConstPolsFile;
     std::string zkevmConstantsTree;
     std::string zkevmStarkInfo;
+    std::string zkevmChelpers; // If not empty, chelpers binary file evaluated instead of the compiled-in parsers
 };
 
 class Starks
@@ -39,6 +42,8 @@ private:
     ConstantPolsStarks *pConstPols;
     ConstantPolsStarks *pConstPols2ns;
     void *pConstTreeAddress;
+    SharedMemorySegment *pSharedConstants; // If not NULL, constant polynomials and tree are in this segment, shared with other processes
+    ChelpersBinary *pChelpers; // If not NULL, steps expressions are evaluated over this file by the generic evaluator
     StarkFiles starkFiles;
     ZhInv zi;
     uint64_t N;
@@ -69,6 +74,8 @@ private:
     Polinomial x;
 
     void merkelizeMemory(); // function for DBG purposes
+    void attachSharedConstants();
+    const ChelpersStep *getChelpersStep(const string &stepName);
 
 public:
     Starks(const Config &config, StarkFiles starkFiles, void *_pAddress) : config(config),
@@ -86,6 +93,7 @@ public:
                                                                            x(config.generateProof() ? N << (starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits) : 0, config.generateProof() ? FIELD_EXTENSION : 0)
     {
         nrowsStepBatch = 1;
+        pChelpers = NULL;
         // Avoid unnecessary initialization if we are not going to generate any proof
         if (!config.generateProof())
             return;
@@ -102,7 +110,12 @@ public:
         constPolsDegree = (1 << starkInfo.starkStruct.nBits);
         constPolsSize = starkInfo.nConstants * sizeof(Goldilocks::Element) * constPolsDegree;
 
-        if (starkFiles.mapConstPolsFile)
+        pSharedConstants = NULL;
+        if (config.useSharedConstants)
+        {
+            attachSharedConstants();
+        }
+        else if (starkFiles.mapConstPolsFile)
         {
             pConstPolsAddress = mapFile(starkFiles.zkevmConstPols, constPolsSize, false);
             zklog.info("Starks::Starks() successfully mapped " + to_string(constPolsSize) + " bytes from constant file " + starkFiles.zkevmConstPols);
@@ -124,7 +137,11 @@ public:
             exitProcess();
         }
 
-        if (config.mapConstantsTreeFile)
+        if (pSharedConstants != NULL)
+        {
+            pConstTreeAddress = pSharedConstants->getData() + constPolsSize;
+        }
+        else if (config.mapConstantsTreeFile)
         {
             pConstTreeAddress = mapFile(starkFiles.zkevmConstantsTree, starkInfo.getConstTreeSizeInBytes(), false);
             zklog.info("Starks::Starks() successfully mapped " + to_string(starkInfo.getConstTreeSizeInBytes()) + " bytes from constant tree file " + starkFiles.zkevmConstantsTree);
@@ -138,12 +155,28 @@ public:
 
         // Initialize and allocate ConstantPols2ns
         TimerStart(LOAD_CONST_POLS_2NS_TO_MEMORY);
-        pConstPolsAddress2ns = (void *)calloc(starkInfo.nConstants * (1 << starkInfo.starkStruct.nBitsExt), sizeof(Goldilocks::Element));
-        pConstPols2ns = new ConstantPolsStarks(pConstPolsAddress2ns, (1 << starkInfo.starkStruct.nBitsExt), starkInfo.nConstants);
-        std::memcpy(pConstPolsAddress2ns, (uint8_t *)pConstTreeAddress + 2 * sizeof(Goldilocks::Element), starkInfo.nConstants * (1 << starkInfo.starkStruct.nBitsExt) * sizeof(Goldilocks::Element));
+        if (pSharedConstants != NULL)
+        {
+            // The extended constant polynomials are the source of the constant tree, so they can be shared as well
+            pConstPolsAddress2ns = (uint8_t *)pConstTreeAddress + 2 * sizeof(Goldilocks::Element);
+            pConstPols2ns = new ConstantPolsStarks(pConstPolsAddress2ns, (1 << starkInfo.starkStruct.nBitsExt), starkInfo.nConstants);
+        }
+        else
+        {
+            pConstPolsAddress2ns = (void *)calloc(starkInfo.nConstants * (1 << starkInfo.starkStruct.nBitsExt), sizeof(Goldilocks::Element));
+            pConstPols2ns = new ConstantPolsStarks(pConstPolsAddress2ns, (1 << starkInfo.starkStruct.nBitsExt), starkInfo.nConstants);
+            std::memcpy(pConstPolsAddress2ns, (uint8_t *)pConstTreeAddress + 2 * sizeof(Goldilocks::Element), starkInfo.nConstants * (1 << starkInfo.starkStruct.nBitsExt) * sizeof(Goldilocks::Element));
+        }
 
         TimerStopAndLog(LOAD_CONST_POLS_2NS_TO_MEMORY);
 
+        // Load the chelpers binary file, if any
+        if (starkFiles.zkevmChelpers.size() > 0)
+        {
+            pChelpers = new ChelpersBinary(starkFiles.zkevmChelpers);
+            zklog.info("Starks::Starks() successfully loaded chelpers file " + starkFiles.zkevmChelpers);
+        }
+
         // TODO x_n and x_2ns could be precomputed
         TimerStart(COMPUTE_X_N_AND_X_2_NS);
         Goldilocks::Element xx = Goldilocks::one();
@@ -197,23 +230,35 @@ public:
 
         delete pConstPols;
         delete pConstPols2ns;
-        free(pConstPolsAddress2ns);
-
-        if (config.mapConstPolsFile)
+        if (pChelpers != NULL)
         {
-            unmapFile(pConstPolsAddress, constPolsSize);
+            delete pChelpers;
         }
-        else
-        {
-            free(pConstPolsAddress);
-        }
-        if (config.mapConstantsTreeFile)
+
+        if (pSharedConstants != NULL)
         {
-            unmapFile(pConstTreeAddress, constPolsSize);
+            delete pSharedConstants;
         }
         else
         {
-            free(pConstTreeAddress);
+            free(pConstPolsAddress2ns);
+
+            if (config.mapConstPolsFile)
+            {
+                unmapFile(pConstPolsAddress, constPolsSize);
+            }
+            else
+            {
+                free(pConstPolsAddress);
+            }
+            if (config.mapConstantsTreeFile)
+            {
+                unmapFile(pConstTreeAddress, constPolsSize);
+            }
+            else
+            {
+                free(pConstTreeAddress);
+            }
         }
 
         for (uint i = 0; i < 5; i++)
@@ -229,6 +274,8 @@ public:
     Polinomial *transposeZColumns(void *pAddress, uint64_t &numCommited, Goldilocks::Element *pBuffer);
     void transposeZRows(void *pAddress, uint64_t &numCommited, Polinomial *transPols);
     void evmap(void *pAddress, Polinomial &evals, Polinomial &LEv, Polinomial &LpEv);
+    void extendPolAndMerkelize(Goldilocks::Element *pDst, Goldilocks::Element *pSrc, uint64_t ncols, Goldilocks::Element *pBuffer, MerkleTreeGL *pTree);
+    static void extendPolAndMerkelize(NTT_Goldilocks &ntt, uint64_t nBits, uint64_t nBitsExt, uint64_t tileSize, Goldilocks::Element *pDst, Goldilocks::Element *pSrc, uint64_t ncols, Goldilocks::Element *pBuffer, MerkleTreeGL *pTree);
 };
 
 #endif // STARKS_H
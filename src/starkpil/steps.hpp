@@ -48,6 +48,8 @@ public:
     virtual void step42ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
     virtual void step42ns_parser_first_avx_jump(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
     virtual void step42ns_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
+    virtual void step42ns_parser_first_avx_fused(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
+    virtual void step42ns_parser_first_avx_profile(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
 
     virtual void step52ns_first(StepsParams &params, uint64_t i) = 0;
     virtual void step52ns_i(StepsParams &params, uint64_t i) = 0;
@@ -2961,3 +2961,6 @@ void ZkevmSteps::step42ns_parser_first_avx512(StepsParams &params, uint64_t nrow
 }
 
 #endif
+
+// Fused parser and profiler, generated by chelpersFuser (make fuse_chelpers)
+#include "zkevm.chelpers.step42ns.parser.fused.hpp"
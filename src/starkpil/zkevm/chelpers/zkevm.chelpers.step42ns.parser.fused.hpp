@@ -0,0 +1,5991 @@
+// Generated by chelpersFuser from ./src/starkpil/zkevm/chelpers/zkevm.chelpers.step42ns.parser.cpp and ./src/starkpil/zkevm/chelpers/zkevm.chelpers.step42ns.parser.hpp; do not edit
+// Must be included at the end of ./src/starkpil/zkevm/chelpers/zkevm.chelpers.step42ns.parser.cpp
+
+#include <vector>
+#include <algorithm>
+#include <x86intrin.h>
+#include "zklog.hpp"
+#include "exit_process.hpp"
+
+#define STEP42NS_PARSER_FIRST_AVX_FUSED_SOURCE_NOPS 18546
+#define STEP42NS_PARSER_FIRST_AVX_FUSED_SOURCE_HASH 534715333182686057ULL
+#define STEP42NS_PARSER_FIRST_AVX_FUSED_NOPS 5050
+
+// 93 = 85 50 21 53
+// 94 = 53 0 53 0 53 0
+// 95 = 53 21 85
+// 96 = 85 50 21 53 0 85 50 21 53 0 85 50 21 53 0
+// 97 = 0 49 0 49 0 49
+// 98 = 79 79 79 79 79 79 79 79
+// 99 = 0 53 21 85 50 0 53 21 85 50
+// 100 = 50 50 21 53
+// 101 = 21 85 50 21 53 21 85 50 21 53 21 85 50 21 53
+// 102 = 0 54 0 54 0 54
+// 103 = 87 87 87 87 87 87
+// 104 = 22 47 1 25
+// 105 = 70 17
+// 106 = 26 30 56 26 30 56
+// 107 = 21 50 21 53 85 50 85 21
+// 108 = 50 50 85 85 85 85 85 85
+// 109 = 46 0 46 0
+// 110 = 78 78 78 78 78 78 78 78
+// 111 = 19 13 70 17 73 19 13 70 17 71
+// 112 = 0 53
+// 113 = 13 70 17 71 13 71 74 75 42
+// 114 = 2 1 1 22 53 53 0 53 0 53 0
+// 115 = 26 1 22 22 53 53 0 53 0 53 0
+// 116 = 53 21 50 53 21 85 53 21 85 53 21 85 53 21 85 53 21 85
+// 117 = 86 86 86 86 86 86 86 86
+// 118 = 0 25 27 47 54 0 53 49
+// 119 = 12 43 61 18 18 74 72 42
+// 120 = 30 47 26
+// 121 = 27 56 54 0 25
+// 122 = 88 88 88 88
+// 123 = 53 1 78 53 1 78
+// 124 = 2 22 50 50 0 53 21 50 50
+// 125 = 26 34 58 26 34 58
+// 126 = 53 0 53 0 53 0 53 0 53 0 53 0 53
+// 127 = 53 21 0 2 22 22 22 50
+// 128 = 0 0 26 50 50 85 21 50
+// 129 = 70 17 70 17 70 17 70 17 70 17 70 17 70 17 70 17
+// 130 = 22 84
+// 131 = 13 70 17 71 13 71 44 17 70
+// 132 = 21 0 22 1 50 50 21 53 21 50 50 21 53 21 85 50 21 53 21 85 50 21 53 21 85 50 21 53
+// 133 = 0 49 0 49 0 49 0 49 0 49 0 49 0 49 0 49 0 49 0 49 0 49 0 49 0 49 0 49 0 49
+// 134 = 46 46 0 46 0 46 0 46 0 46 0 46 0 46 0 46 0 46 0 46 0 46 0
+// 135 = 82 82 82 82
+// 136 = 83 83 83 83
+// 137 = 79 79 79
+// 138 = 84 84 12
+// 139 = 85 50 21 53 0 0
+// 140 = 21 50 21 53 0 0 26 50 50 85 21 50 21 50 21 53 85 50 85 21 50
+// 141 = 41 60 76 19 13 70 17 73 19 13 70 17 71
+// 142 = 59 87 87
+// 143 = 21 0 2 50 50 21 53 21 50 50 21 53
+// 144 = 44 17 70
+// 145 = 85 85 85 85 0
+// 146 = 15 13 70 17 63 15 13 70 17 71
+// 147 = 22 47 1 25 22 47 1 25 22 47 1 25 22 47 1 25 22 47 1 25 22 47 1 25 22 47 1 25 22 47 1 25
+// 148 = 0 25 32 47
+// 149 = 50 1 22 84 50 1 22 84
+// 150 = 0 53 21 85 50 0 53 21 85 50 0 53 21 85 50 0 53 21
+// 151 = 12 43 61 18
+// 152 = 22 50 50 21 53 85 50 21 53 0 85 50 21 53 0 85 50 21 53 0
+// 153 = 45 26 35
+// 154 = 53 21 85 53 21 85 53 21 85
+// 155 = 80 80 80 80 80 80 80 80
+// 156 = 85 50 21 53 0 0 26 50 50 21 53 85 50 21 53 0 85 50 21 53 0 85 50 21 53 0
+
+uint64_t step42ns_parser_first_avx_fused_ops[STEP42NS_PARSER_FIRST_AVX_FUSED_NOPS] = { 82, 27, 57, 27, 56, 21, 27, 57, 27, 56, 21, 27, 57, 27, 56, 21, 27, 56, 26, 27, 56, 26, 27, 56, 26, 120, 120, 30, 47, 106, 26, 4, 56, 26, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 27, 56, 50, 0, 25, 120, 120, 120, 120, 120, 32, 40, 47, 1, 25, 37, 49, 26, 120, 120, 32, 40, 47, 1, 25, 35, 22, 22, 22, 8, 45, 26, 32, 48, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 86, 86, 86, 86, 86, 86, 32, 47, 21, 120, 120, 120, 120, 120, 120, 120, 54, 26, 54, 26, 54, 26, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 4, 47, 51, 46, 21, 53, 2, 1, 1, 22, 53, 53, 0, 2, 1, 1, 22, 53, 53, 112, 0, 114, 114, 53, 0, 114, 53, 112, 0, 114, 94, 114, 94, 53, 0, 114, 94, 53, 112, 0, 114, 94, 94, 114, 126, 0, 114, 126, 112, 0, 114, 94, 94, 94, 114, 94, 126, 0, 114, 94, 126, 112, 0, 114, 94, 94, 94, 94, 114, 94, 126, 112, 112, 94, 94, 126, 112, 94, 94, 126, 94, 126, 112, 112, 94, 126, 112, 94, 126, 126, 112, 112, 126, 112, 126, 94, 53, 112, 112, 94, 53, 112, 94, 53, 53, 112, 112, 53, 112, 81, 49, 49, 133, 133, 0, 1, 47, 51, 46, 21, 53, 2, 1, 1, 22, 53, 53, 0, 2, 1, 1, 22, 53, 53, 112, 0, 114, 114, 53, 0, 114, 53, 112, 0, 114, 94, 114, 94, 53, 0, 114, 94, 53, 112, 0, 114, 94, 94, 114, 126, 0, 114, 126, 112, 0, 114, 94, 94, 94, 114, 94, 126, 0, 114, 94, 126, 112, 0, 114, 94, 94, 94, 94, 114, 94, 126, 112, 112, 94, 94, 126, 112, 94, 94, 126, 94, 126, 112, 112, 94, 126, 112, 94, 126, 126, 112, 112, 126, 112, 126, 94, 53, 112, 112, 94, 53, 112, 94, 53, 53, 112, 112, 53, 112, 81, 49, 49, 133, 133, 0, 1, 47, 51, 46, 21, 53, 26, 1, 22, 22, 53, 53, 0, 26, 1, 22, 22, 53, 53, 112, 0, 115, 115, 53, 0, 115, 53, 112, 0, 115, 94, 115, 94, 53, 0, 115, 94, 53, 112, 0, 115, 94, 94, 115, 126, 0, 115, 126, 112, 0, 115, 94, 94, 94, 115, 94, 126, 0, 115, 94, 126, 112, 0, 115, 94, 94, 94, 94, 115, 94, 126, 112, 112, 94, 94, 126, 112, 94, 94, 126, 94, 126, 112, 112, 94, 126, 112, 94, 126, 126, 112, 112, 126, 112, 126, 94, 53, 112, 112, 94, 53, 112, 94, 53, 53, 112, 112, 53, 112, 81, 49, 49, 133, 133, 0, 1, 47, 51, 46, 21, 53, 26, 1, 22, 22, 53, 53, 0, 26, 1, 22, 22, 53, 53, 112, 0, 115, 115, 53, 0, 115, 53, 112, 0, 115, 94, 115, 94, 53, 0, 115, 94, 53, 112, 0, 115, 94, 94, 115, 126, 0, 115, 126, 112, 0, 115, 94, 94, 94, 115, 94, 126, 0, 115, 94, 126, 112, 0, 115, 94, 94, 94, 94, 115, 94, 126, 112, 112, 94, 94, 126, 112, 94, 94, 126, 94, 126, 112, 112, 94, 126, 112, 94, 126, 126, 112, 112, 126, 112, 126, 94, 53, 112, 112, 94, 53, 112, 94, 53, 53, 112, 112, 53, 112, 81, 49, 49, 133, 133, 0, 1, 47, 51, 46, 21, 120, 120, 120, 120, 120, 8, 27, 56, 26, 27, 56, 26, 120, 120, 50, 26, 9, 35, 27, 45, 26, 8, 3, 3, 3, 3, 47, 0, 27, 47, 25, 8, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 3, 3, 56, 8, 56, 0, 47, 0, 25, 37, 47, 1, 25, 35, 27, 47, 54, 112, 49, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 0, 24, 47, 24, 47, 0, 118, 118, 118, 118, 118, 118, 118, 0, 30, 22, 45, 25, 35, 32, 153, 32, 153, 32, 153, 32, 153, 32, 153, 32, 153, 32, 153, 32, 153, 32, 153, 32, 153, 32, 153, 32, 45, 26, 37, 49, 26, 37, 49, 26, 37, 49, 26, 37, 49, 26, 36, 32, 45, 26, 36, 32, 45, 26, 36, 32, 45, 26, 36, 32, 45, 26, 120, 120, 120, 32, 47, 26, 32, 47, 26, 32, 47, 26, 30, 48, 28, 30, 45, 21, 50, 27, 56, 26, 1, 30, 45, 25, 120, 120, 120, 120, 120, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 54, 1, 32, 45, 25, 32, 48, 86, 86, 86, 32, 47, 21, 37, 58, 1, 50, 21, 25, 37, 58, 1, 50, 21, 25, 37, 58, 1, 50, 21, 25, 37, 58, 1, 50, 21, 25, 32, 47, 7, 39, 45, 0, 1, 25, 28, 49, 26, 51, 51, 21, 30, 48, 30, 47, 21, 35, 30, 45, 26, 33, 47, 29, 22, 45, 26, 50, 27, 47, 26, 27, 48, 28, 27, 45, 21, 27, 48, 27, 47, 21, 57, 29, 45, 21, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 56, 26, 8, 3, 3, 3, 3, 3, 3, 8, 3, 3, 3, 3, 3, 3, 8, 3, 3, 3, 3, 3, 3, 0, 0, 23, 35, 45, 26, 0, 0, 23, 35, 45, 26, 0, 0, 23, 35, 45, 26, 0, 0, 23, 35, 45, 26, 53, 25, 22, 48, 53, 25, 22, 48, 112, 25, 22, 48, 112, 25, 22, 48, 0, 26, 57, 51, 21, 51, 21, 51, 21, 51, 21, 26, 8, 3, 3, 3, 3, 3, 3, 27, 56, 55, 0, 25, 27, 35, 45, 26, 120, 120, 120, 120, 120, 120, 27, 47, 26, 30, 22, 40, 47, 1, 25, 108, 85, 85, 85, 0, 1, 104, 108, 85, 0, 104, 108, 85, 0, 104, 108, 85, 0, 147, 147, 147, 147, 104, 104, 120, 104, 47, 26, 50, 1, 30, 47, 0, 37, 26, 45, 1, 2, 25, 54, 26, 54, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 26, 30, 56, 26, 53, 53, 112, 0, 1, 58, 26, 53, 53, 112, 0, 1, 27, 58, 26, 32, 56, 54, 0, 25, 120, 24, 58, 26, 32, 47, 54, 148, 54, 148, 54, 148, 54, 148, 54, 148, 54, 148, 54, 148, 54, 148, 54, 0, 25, 32, 48, 32, 47, 21, 120, 120, 32, 56, 26, 120, 30, 48, 28, 30, 45, 21, 50, 27, 56, 26, 1, 30, 45, 25, 120, 120, 120, 120, 120, 32, 48, 32, 47, 21, 55, 30, 49, 21, 30, 49, 26, 51, 51, 21, 30, 48, 30, 47, 21, 35, 30, 153, 30, 153, 30, 153, 30, 153, 30, 153, 30, 153, 30, 153, 30, 153, 30, 45, 26, 29, 22, 56, 26, 32, 47, 7, 39, 45, 0, 1, 25, 28, 49, 26, 50, 27, 47, 26, 27, 48, 28, 27, 45, 21, 27, 48, 27, 47, 21, 57, 29, 45, 21, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 47, 25, 27, 56, 26, 28, 47, 26, 30, 35, 45, 26, 28, 47, 26, 28, 47, 26, 30, 56, 26, 32, 28, 27, 153, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 35, 47, 26, 51, 26, 51, 26, 51, 26, 51, 26, 51, 26, 51, 26, 51, 26, 51, 26, 54, 26, 30, 58, 26, 32, 56, 90, 0, 25, 120, 37, 58, 26, 32, 47, 90, 148, 90, 148, 90, 148, 90, 148, 90, 148, 90, 148, 90, 148, 90, 148, 90, 0, 25, 32, 48, 32, 47, 21, 120, 120, 120, 91, 47, 3, 24, 58, 26, 54, 27, 48, 28, 27, 45, 21, 50, 26, 4, 27, 45, 25, 120, 4, 27, 45, 25, 120, 90, 27, 47, 48, 0, 25, 53, 24, 45, 26, 120, 120, 54, 27, 47, 26, 27, 47, 26, 32, 48, 32, 47, 21, 55, 27, 49, 21, 27, 49, 26, 48, 48, 21, 27, 48, 27, 47, 21, 35, 27, 153, 27, 153, 27, 153, 27, 153, 27, 153, 27, 153, 27, 153, 27, 153, 27, 45, 26, 29, 22, 45, 26, 32, 47, 7, 92, 45, 0, 0, 25, 28, 49, 26, 50, 26, 30, 48, 28, 30, 45, 21, 30, 48, 30, 47, 21, 51, 29, 47, 21, 30, 47, 25, 30, 47, 25, 30, 47, 25, 30, 47, 25, 30, 47, 25, 30, 47, 25, 30, 47, 25, 30, 47, 25, 30, 45, 26, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 50, 50, 145, 4, 47, 85, 145, 54, 85, 85, 85, 85, 85, 85, 145, 1, 53, 0, 47, 53, 126, 112, 0, 1, 21, 50, 27, 56, 26, 47, 26, 104, 108, 0, 1, 104, 108, 0, 1, 104, 108, 0, 1, 104, 108, 0, 1, 104, 108, 0, 1, 104, 108, 0, 1, 104, 108, 0, 1, 147, 147, 147, 147, 147, 104, 104, 4, 21, 47, 4, 0, 25, 104, 22, 47, 7, 22, 47, 0, 1, 25, 104, 37, 21, 47, 37, 0, 25, 22, 47, 1, 4, 1, 56, 0, 1, 1, 1, 25, 50, 1, 50, 85, 0, 1, 1, 37, 47, 1, 37, 45, 22, 47, 0, 1, 25, 54, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 26, 24, 56, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 26, 32, 47, 1, 1, 1, 1, 1, 1, 25, 32, 47, 1, 1, 1, 25, 32, 47, 50, 148, 50, 148, 50, 148, 4, 1, 56, 148, 1, 1, 1, 25, 141, 79, 79, 59, 12, 82, 82, 59, 12, 83, 83, 59, 12, 18, 105, 113, 141, 82, 80, 80, 80, 98, 79, 79, 142, 87, 12, 135, 135, 135, 82, 82, 142, 87, 12, 136, 136, 136, 83, 83, 142, 87, 12, 18, 105, 113, 141, 82, 82, 59, 12, 83, 83, 59, 12, 20, 105, 113, 41, 60, 62, 146, 74, 72, 42, 41, 60, 62, 146, 74, 72, 42, 41, 60, 62, 146, 74, 72, 42, 141, 74, 72, 42, 41, 60, 62, 146, 79, 78, 82, 78, 83, 78, 14, 59, 12, 113, 41, 60, 62, 146, 79, 78, 82, 78, 83, 78, 14, 59, 12, 113, 41, 60, 62, 146, 79, 78, 82, 78, 83, 78, 14, 59, 12, 113, 141, 81, 137, 79, 79, 53, 1, 59, 87, 84, 12, 135, 82, 82, 82, 59, 87, 84, 12, 136, 83, 83, 83, 59, 87, 84, 12, 18, 105, 113, 141, 5, 137, 79, 79, 53, 1, 53, 112, 0, 59, 87, 84, 12, 135, 82, 82, 82, 59, 87, 84, 12, 136, 83, 83, 83, 59, 87, 84, 12, 18, 105, 113, 41, 60, 62, 146, 79, 78, 82, 78, 83, 78, 14, 59, 12, 113, 141, 74, 72, 42, 141, 98, 79, 59, 87, 84, 138, 135, 135, 82, 59, 87, 84, 138, 136, 136, 83, 59, 87, 84, 138, 18, 105, 113, 141, 74, 72, 42, 141, 53, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 78, 137, 79, 59, 84, 138, 135, 82, 59, 84, 138, 136, 83, 59, 84, 138, 18, 105, 113, 141, 82, 137, 59, 138, 135, 59, 138, 136, 59, 138, 18, 105, 113, 141, 82, 137, 59, 138, 135, 59, 138, 136, 59, 138, 18, 105, 113, 141, 82, 137, 59, 138, 135, 59, 138, 136, 59, 138, 18, 105, 113, 141, 82, 137, 59, 138, 135, 59, 138, 136, 59, 138, 18, 105, 113, 141, 74, 72, 42, 141, 74, 72, 42, 141, 98, 79, 59, 87, 84, 138, 135, 135, 82, 59, 87, 84, 138, 136, 136, 83, 59, 87, 84, 138, 18, 105, 113, 41, 60, 62, 146, 10, 78, 78, 11, 78, 78, 16, 59, 12, 113, 141, 74, 72, 42, 141, 74, 72, 42, 141, 98, 82, 59, 87, 84, 138, 155, 83, 59, 87, 84, 138, 20, 105, 113, 141, 98, 79, 59, 87, 84, 138, 135, 135, 82, 59, 87, 84, 138, 136, 136, 83, 59, 87, 84, 138, 18, 105, 113, 41, 60, 62, 146, 79, 78, 82, 78, 83, 78, 14, 59, 12, 113, 141, 98, 98, 98, 98, 53, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 126, 112, 0, 78, 137, 137, 59, 103, 87, 87, 87, 84, 12, 135, 135, 135, 135, 135, 135, 135, 135, 135, 82, 82, 82, 59, 103, 87, 87, 87, 84, 12, 136, 136, 136, 136, 136, 136, 136, 136, 136, 83, 83, 83, 59, 103, 87, 87, 87, 84, 12, 18, 105, 113, 141, 74, 72, 42, 141, 74, 72, 42, 141, 74, 72, 42, 41, 60, 98, 98, 137, 79, 142, 87, 87, 84, 119, 41, 60, 137, 79, 80, 79, 80, 80, 80, 80, 79, 142, 119, 41, 60, 98, 98, 137, 142, 87, 87, 119, 41, 60, 137, 137, 79, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 79, 59, 103, 87, 87, 87, 87, 87, 84, 119, 41, 60, 137, 137, 79, 110, 110, 110, 110, 123, 123, 123, 53, 1, 78, 53, 1, 110, 78, 79, 59, 103, 103, 87, 84, 119, 41, 60, 137, 137, 79, 110, 110, 110, 110, 110, 110, 79, 59, 103, 103, 87, 84, 119, 41, 60, 98, 98, 98, 137, 59, 103, 119, 41, 60, 137, 59, 119, 41, 60, 98, 137, 142, 119, 41, 60, 137, 59, 119, 41, 60, 98, 137, 142, 119, 41, 60, 137, 59, 119, 41, 60, 137, 137, 79, 59, 87, 119, 41, 60, 98, 137, 79, 142, 84, 119, 41, 60, 98, 98, 137, 79, 142, 87, 87, 84, 151, 18, 81, 81, 81, 98, 81, 81, 81, 81, 137, 79, 4, 142, 87, 87, 84, 151, 18, 74, 75, 42, 41, 60, 98, 98, 137, 81, 81, 81, 81, 81, 81, 81, 81, 81, 79, 59, 103, 138, 43, 61, 18, 18, 81, 81, 81, 137, 79, 79, 81, 98, 98, 137, 4, 59, 103, 138, 43, 61, 18, 18, 74, 75, 42, 41, 60, 98, 98, 7, 79, 142, 87, 84, 84, 84, 119, 41, 60, 98, 98, 137, 79, 7, 79, 142, 87, 87, 84, 84, 84, 119, 41, 60, 98, 98, 98, 137, 79, 59, 103, 84, 119, 41, 60, 98, 98, 98, 98, 98, 137, 79, 59, 103, 87, 87, 87, 87, 84, 119, 41, 60, 98, 98, 98, 137, 79, 59, 103, 84, 119, 41, 60, 77, 72, 42, 41, 60, 77, 72, 42, 41, 60, 79, 82, 59, 12, 18, 75, 66, 68, 12, 18, 75, 74, 75, 42, 41, 60, 77, 72, 42, 30, 57, 51, 0, 51, 30, 56, 50, 0, 54, 54, 102, 102, 102, 102, 102, 21, 54, 21, 54, 21, 54, 21, 54, 21, 54, 21, 54, 21, 54, 21, 54, 21, 54, 21, 54, 21, 54, 21, 54, 21, 54, 21, 54, 21, 54, 21, 50, 1, 22, 50, 50, 0, 1, 22, 50, 50, 85, 0, 1, 22, 50, 50, 85, 85, 0, 1, 22, 50, 50, 85, 85, 85, 0, 1, 22, 50, 50, 145, 1, 22, 50, 50, 85, 145, 1, 22, 108, 0, 1, 22, 108, 85, 0, 1, 22, 108, 85, 85, 0, 1, 22, 108, 85, 85, 85, 0, 1, 22, 108, 145, 1, 22, 108, 85, 145, 1, 22, 108, 85, 85, 145, 1, 22, 108, 85, 85, 85, 145, 1, 22, 108, 85, 85, 85, 85, 145, 1, 22, 108, 85, 85, 85, 145, 22, 108, 85, 85, 145, 22, 108, 85, 145, 22, 108, 145, 22, 108, 85, 85, 85, 0, 22, 108, 85, 85, 0, 22, 108, 85, 0, 22, 108, 0, 22, 50, 50, 85, 145, 22, 50, 50, 145, 22, 50, 50, 85, 85, 85, 0, 22, 50, 50, 85, 85, 0, 22, 50, 50, 85, 0, 22, 50, 50, 0, 22, 50, 22, 30, 100, 21, 22, 1, 100, 21, 100, 21, 0, 22, 1, 100, 21, 100, 21, 93, 21, 0, 22, 1, 100, 21, 100, 21, 93, 21, 93, 132, 132, 21, 93, 132, 21, 93, 21, 93, 132, 101, 132, 101, 21, 93, 132, 101, 21, 93, 21, 93, 132, 101, 101, 132, 101, 101, 21, 93, 132, 101, 101, 21, 93, 21, 93, 132, 101, 101, 101, 132, 101, 101, 101, 21, 93, 132, 101, 101, 101, 21, 93, 21, 93, 132, 101, 101, 101, 21, 93, 143, 101, 101, 101, 101, 143, 101, 101, 101, 21, 93, 21, 93, 143, 101, 101, 101, 21, 93, 143, 101, 101, 101, 143, 101, 101, 21, 93, 21, 93, 143, 101, 101, 21, 93, 143, 101, 101, 143, 101, 21, 93, 21, 93, 143, 101, 21, 93, 143, 101, 143, 21, 93, 21, 93, 143, 21, 93, 143, 21, 0, 2, 100, 21, 2, 81, 50, 50, 85, 21, 50, 107, 50, 107, 50, 88, 107, 50, 88, 88, 107, 50, 88, 88, 88, 107, 50, 122, 107, 50, 122, 88, 107, 50, 122, 88, 88, 107, 50, 122, 88, 88, 88, 107, 50, 122, 122, 107, 50, 122, 122, 88, 107, 50, 122, 122, 88, 88, 107, 50, 122, 122, 88, 88, 88, 107, 50, 122, 122, 122, 107, 50, 122, 122, 122, 88, 107, 50, 122, 122, 122, 88, 88, 107, 50, 122, 122, 122, 88, 88, 88, 107, 50, 122, 122, 122, 88, 140, 122, 122, 122, 140, 122, 122, 88, 88, 88, 140, 122, 122, 88, 88, 140, 122, 122, 88, 140, 122, 122, 140, 122, 88, 88, 88, 140, 122, 88, 88, 140, 122, 88, 140, 122, 140, 88, 88, 88, 140, 88, 88, 140, 88, 140, 21, 50, 21, 53, 128, 21, 50, 21, 53, 0, 26, 81, 50, 53, 21, 2, 22, 22, 22, 50, 53, 21, 50, 127, 53, 21, 50, 95, 127, 53, 21, 50, 95, 95, 127, 53, 21, 50, 154, 127, 53, 21, 50, 154, 95, 127, 116, 127, 116, 95, 127, 116, 95, 95, 127, 116, 154, 127, 116, 154, 95, 127, 116, 154, 95, 95, 127, 116, 154, 154, 127, 116, 154, 154, 95, 127, 116, 154, 154, 95, 95, 127, 116, 154, 154, 154, 127, 116, 154, 154, 154, 116, 154, 154, 95, 95, 116, 154, 154, 95, 116, 154, 154, 116, 154, 95, 95, 116, 154, 95, 116, 154, 116, 95, 95, 116, 95, 116, 53, 21, 50, 154, 95, 53, 21, 50, 154, 53, 21, 50, 95, 95, 53, 21, 50, 95, 53, 21, 81, 100, 0, 22, 22, 100, 139, 22, 22, 100, 93, 0, 139, 22, 152, 0, 22, 152, 139, 22, 152, 93, 0, 139, 22, 152, 96, 0, 22, 152, 96, 139, 22, 152, 96, 93, 0, 139, 22, 152, 96, 96, 0, 22, 152, 96, 96, 139, 22, 152, 96, 96, 93, 0, 139, 22, 152, 96, 96, 96, 0, 22, 152, 96, 96, 96, 139, 22, 152, 96, 96, 96, 93, 0, 139, 22, 152, 96, 96, 96, 96, 0, 22, 152, 96, 96, 96, 93, 0, 156, 96, 96, 96, 156, 96, 96, 96, 0, 26, 100, 96, 96, 96, 93, 0, 156, 96, 96, 156, 96, 96, 0, 26, 100, 96, 96, 93, 0, 156, 96, 156, 96, 0, 26, 100, 96, 93, 0, 156, 156, 0, 26, 100, 93, 0, 139, 26, 100, 139, 26, 100, 0, 26, 81, 100, 0, 22, 100, 139, 22, 100, 93, 0, 139, 152, 0, 152, 139, 152, 93, 0, 139, 152, 96, 0, 152, 96, 139, 152, 96, 93, 0, 139, 152, 96, 96, 0, 152, 96, 96, 139, 152, 96, 96, 93, 0, 139, 152, 96, 96, 96, 0, 152, 96, 96, 96, 139, 152, 96, 96, 96, 93, 0, 139, 152, 96, 96, 96, 96, 0, 152, 96, 96, 96, 93, 0, 156, 96, 96, 96, 156, 96, 96, 96, 0, 26, 100, 96, 96, 96, 93, 0, 156, 96, 96, 156, 96, 96, 0, 26, 100, 96, 96, 93, 0, 156, 96, 156, 96, 0, 26, 100, 96, 93, 0, 156, 156, 0, 26, 100, 93, 0, 139, 26, 100, 139, 26, 100, 0, 26, 81, 50, 50, 112, 21, 124, 112, 21, 0, 124, 0, 95, 50, 112, 21, 0, 124, 99, 112, 21, 0, 124, 150, 0, 124, 99, 99, 112, 21, 0, 124, 99, 150, 0, 124, 99, 99, 99, 112, 21, 0, 124, 99, 99, 150, 0, 124, 99, 99, 99, 99, 112, 21, 0, 124, 99, 99, 99, 150, 0, 124, 99, 99, 99, 99, 99, 112, 21, 0, 124, 99, 99, 99, 99, 150, 0, 124, 99, 99, 99, 99, 99, 99, 112, 21, 0, 124, 99, 99, 99, 99, 99, 150, 0, 124, 99, 99, 99, 99, 99, 99, 99, 112, 21, 0, 124, 99, 99, 99, 99, 99, 99, 99, 112, 21, 50, 50, 99, 99, 99, 99, 99, 150, 50, 50, 99, 99, 99, 99, 99, 99, 112, 21, 50, 50, 99, 99, 99, 99, 150, 50, 50, 99, 99, 99, 99, 99, 112, 21, 50, 50, 99, 99, 99, 150, 50, 50, 99, 99, 99, 99, 112, 21, 50, 50, 99, 99, 150, 50, 50, 99, 99, 99, 112, 21, 50, 50, 99, 150, 50, 50, 99, 99, 112, 21, 50, 50, 150, 50, 50, 99, 112, 21, 50, 50, 0, 95, 50, 112, 21, 81, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 6, 50, 47, 78, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 0, 47, 21, 58, 112, 56, 24, 47, 1, 52, 50, 50, 0, 1, 50, 46, 53, 85, 112, 0, 0, 8, 8, 46, 0, 1, 56, 8, 46, 8, 46, 0, 8, 46, 0, 8, 46, 0, 8, 46, 0, 8, 46, 0, 8, 46, 0, 8, 46, 0, 8, 46, 0, 8, 46, 0, 8, 46, 0, 8, 46, 0, 8, 46, 0, 8, 46, 0, 8, 46, 0, 8, 46, 0, 1, 4, 1, 45, 0, 30, 45, 54, 54, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 0, 110, 98, 98, 98, 82, 142, 87, 138, 43, 61, 18, 82, 35, 35, 21, 47, 35, 0, 78, 98, 82, 78, 78, 79, 50, 1, 110, 79, 37, 22, 2, 98, 79, 142, 84, 12, 43, 64, 18, 4, 78, 79, 50, 1, 110, 79, 37, 22, 2, 98, 79, 142, 84, 12, 43, 64, 18, 4, 78, 79, 50, 1, 110, 79, 37, 22, 2, 98, 79, 142, 84, 12, 43, 64, 18, 4, 54, 54, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 0, 78, 82, 78, 83, 78, 54, 54, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 0, 78, 82, 78, 83, 78, 54, 54, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 0, 78, 82, 78, 83, 78, 8, 3, 54, 54, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 0, 59, 12, 82, 82, 59, 12, 83, 83, 59, 12, 155, 155, 83, 142, 87, 138, 43, 61, 18, 109, 94, 53, 0, 78, 47, 79, 37, 45, 1, 27, 57, 59, 84, 138, 135, 82, 59, 84, 138, 136, 83, 59, 84, 138, 79, 82, 79, 79, 82, 79, 59, 84, 12, 82, 59, 84, 12, 42, 61, 17, 80, 83, 80, 59, 84, 12, 98, 82, 98, 82, 59, 87, 84, 138, 79, 59, 87, 84, 138, 42, 61, 17, 155, 83, 59, 87, 84, 138, 82, 137, 79, 55, 59, 87, 12, 135, 82, 82, 59, 87, 12, 136, 83, 83, 59, 87, 12, 79, 82, 79, 79, 82, 79, 59, 84, 12, 82, 59, 84, 12, 42, 61, 17, 80, 83, 80, 59, 84, 12, 80, 38, 23, 2, 155, 80, 142, 84, 12, 43, 65, 18, 80, 38, 23, 2, 155, 80, 142, 84, 12, 43, 65, 18, 80, 38, 23, 2, 155, 80, 142, 84, 12, 43, 65, 18, 81, 81, 81, 98, 79, 81, 81, 81, 78, 78, 78, 78, 79, 142, 87, 87, 84, 151, 50, 50, 85, 50, 85, 50, 85, 50, 0, 79, 30, 47, 30, 56, 0, 78, 78, 78, 78, 78, 4, 142, 151, 110, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 4, 142, 87, 87, 151, 81, 81, 81, 81, 81, 81, 81, 98, 98, 98, 98, 110, 79, 59, 103, 87, 87, 87, 87, 87, 84, 151, 81, 79, 81, 98, 98, 98, 98, 98, 137, 79, 110, 4, 1, 1, 59, 103, 103, 87, 84, 151, 81, 81, 81, 81, 81, 81, 81, 98, 98, 98, 98, 98, 110, 79, 59, 103, 103, 87, 84, 151, 98, 98, 79, 110, 79, 79, 59, 103, 151, 78, 78, 79, 59, 151, 110, 78, 79, 79, 142, 151, 78, 78, 79, 59, 151, 110, 78, 79, 79, 142, 151, 78, 78, 79, 59, 151, 78, 109, 109, 79, 79, 59, 87, 151, 78, 82, 79, 110, 79, 142, 84, 151, 53, 1, 53, 1, 53, 1, 53, 1, 137, 79, 110, 79, 79, 142, 87, 84, 138, 43, 61, 18, 53, 1, 53, 1, 53, 1, 53, 1, 98, 137, 79, 109, 109, 79, 79, 142, 87, 87, 84, 138, 43, 61, 18, 81, 81, 98, 98, 110, 79, 79, 59, 103, 84, 151, 81, 81, 98, 98, 110, 98, 98, 79, 79, 59, 103, 87, 87, 87, 87, 84, 151, 81, 81, 98, 110, 98, 79, 79, 59, 103, 84, 151, 78, 67, 12, 18, 78, 66, 68, 12, 18, 71, 53, 53, 112, 0, 1, 78, 82, 59, 12, 18, 82, 59, 12, 18, 71, 82, 79, 67, 12, 18, 66, 68, 15, 18, 71, 79, 82, 59, 12, 18, 82, 59, 15, 18, 71, 82, 79, 67, 12, 18, 79, 66, 68, 12, 18, 71, 79, 82, 59, 12, 18, 82, 59, 12, 18, 71, 82, 79, 67, 12, 18, 79, 66, 68, 12, 18, 71, 79, 82, 59, 12, 18, 82, 59, 12, 18, 71, 82, 59, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 84, 84, 84, 17, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 105, 105, 105, 105, 105, 70, 5, 56, 37, 45, 0, 130, 5, 56, 37, 45, 0, 130, 31, 23, 45, 5, 56, 0, 130, 56, 130, 49, 49, 133, 133, 0, 130, 49, 49, 133, 133, 0, 130, 49, 49, 133, 133, 0, 130, 49, 49, 133, 133, 0, 130, 49, 49, 133, 133, 0, 130, 49, 49, 133, 133, 0, 130, 49, 49, 133, 133, 0, 130, 45, 130, 47, 130, 45, 130, 47, 130, 45, 130, 47, 130, 45, 130, 47, 130, 45, 130, 47, 130, 45, 130, 47, 130, 45, 130, 47, 130, 45, 130, 47, 130, 45, 130, 47, 130, 45, 130, 47, 130, 45, 130, 47, 130, 45, 130, 47, 130, 134, 130, 134, 130, 134, 130, 134, 130, 134, 130, 134, 130, 134, 130, 134, 130, 134, 130, 134, 130, 134, 130, 134, 130, 1, 58, 130, 1, 27, 56, 112, 0, 130, 149, 149, 149, 149, 56, 27, 130, 130, 1, 58, 130, 1, 58, 130, 1, 27, 56, 112, 0, 130, 149, 149, 149, 149, 27, 30, 45, 130, 27, 56, 130, 50, 27, 130, 4, 49, 130, 4, 27, 56, 53, 85, 0, 130, 50, 27, 130, 149, 149, 149, 149, 56, 27, 130, 27, 47, 130, 30, 47, 30, 47, 0, 30, 47, 0, 130, 24, 47, 24, 47, 0, 0, 130, 7, 27, 56, 21, 130, 49, 130, 54, 130, 49, 130, 59, 12, 144, 142, 87, 138, 42, 61, 17, 144, 21, 45, 0, 130, 59, 87, 84, 138, 42, 61, 17, 144, 142, 84, 12, 42, 61, 17, 144, 142, 84, 12, 42, 61, 17, 144, 142, 84, 12, 42, 61, 17, 144, 14, 59, 12, 131, 14, 59, 12, 131, 14, 59, 12, 131, 18, 105, 131, 20, 105, 131, 18, 105, 131, 18, 105, 131, 18, 105, 131, 18, 105, 131, 18, 105, 131, 20, 105, 131, 20, 105, 131, 20, 105, 131, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 18, 144, 66, 68, 12, 18, 71, 144, 59, 12, 18, 71, 144, 66, 68, 12, 18, 71, 144, 59, 12, 18, 71, 144, 66, 68, 12, 18, 71, 144, 59, 12, 18, 71, 144, 66, 68, 12, 18, 71, 144, 59, 12, 18, 71, 44, 17, 69 };
+
+#ifndef CHELPERS_OPS_HASH
+#define CHELPERS_OPS_HASH
+static inline uint64_t chelpersOpsHash (const uint64_t * pOps, uint64_t nOps)
+{
+     uint64_t hash = 14695981039346656037ULL;
+     for (uint64_t i = 0; i < nOps; i++)
+     {
+          hash = (hash ^ pOps[i]) * 1099511628211ULL;
+     }
+     return hash;
+}
+#endif
+
+void ZkevmSteps::step42ns_parser_first_avx_fused(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch)
+{
+     if ((NOPS_ != STEP42NS_PARSER_FIRST_AVX_FUSED_SOURCE_NOPS) || (chelpersOpsHash(op42, NOPS_) != STEP42NS_PARSER_FIRST_AVX_FUSED_SOURCE_HASH))
+     {
+          zklog.error("ZkevmSteps::step42ns_parser_first_avx_fused() found that op42 changed after it was fused; run chelpersFuser again");
+          exitProcess();
+     }
+
+#pragma omp parallel for
+     for (uint64_t i = 0; i < nrows; i += nrowsBatch)
+     {
+          int i_args = 0;
+          //__m256i *tmp1 = new __m256i[NTEMP1_];
+          // Goldilocks3::Element_avx *tmp3 = new Goldilocks3::Element_avx[NTEMP3_];
+          __m256i tmp1[NTEMP1_];
+          Goldilocks3::Element_avx tmp3[NTEMP3_];
+          uint64_t offsets1[4], offsets2[4];
+          uint64_t numpols = params.pConstPols2ns->numPols();
+
+          for (int kk = 0; kk < STEP42NS_PARSER_FIRST_AVX_FUSED_NOPS; ++kk)
+          {
+               switch (step42ns_parser_first_avx_fused_ops[kk])
+               {
+               case 0:
+               {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 1:
+               {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    break;
+               }
+               case 2:
+               {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    break;
+               }
+               case 3:
+               {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    break;
+               }
+               case 4:
+               {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    break;
+               }
+               case 5:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (((i + j) + args42[i_args + 6]) % args42[i_args + 7]) * args42[i_args + 8];
+                    }
+                    Goldilocks::add_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 9;
+                    break;
+               }
+               case 6:
+               {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pConstPols2ns->getElement(args42[i_args + 3], i), args42[i_args + 2], numpols);
+                    i_args += 4;
+                    break;
+               }
+               case 7:
+               {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], Goldilocks::fromU64(args42[i_args + 3]), args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 8:
+               {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols, numpols);
+                    i_args += 3;
+                    break;
+               }
+               case 9:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * numpols;
+                         offsets2[j] = args42[i_args + 4] + (((i + j) + args42[i_args + 5]) % args42[i_args + 6]) * numpols;
+                    }
+                    Goldilocks::add_avx(tmp1[args42[i_args]], &params.pConstPols2ns->getElement(0, 0), &params.pConstPols2ns->getElement(0, 0), offsets1, offsets2);
+                    i_args += 7;
+                    break;
+               }
+               case 10:
+               {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), Goldilocks::fromU64(args42[i_args + 2]), numpols);
+                    i_args += 3;
+                    break;
+               }
+               case 11:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * numpols;
+                    }
+                    Goldilocks::add_avx(tmp1[args42[i_args]], &params.pConstPols2ns->getElement(0, 0), Goldilocks::fromU64(args42[i_args + 4]), offsets1);
+                    i_args += 5;
+                    break;
+               }
+               case 12:
+               {
+
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 13:
+               {
+                    Goldilocks3::add1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 14:
+               {
+                    Goldilocks3::add13c_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 15:
+               {
+
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 16:
+               {
+                    Goldilocks3::add13c_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.challenges[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 17:
+               {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 18:
+               {
+
+                    Goldilocks3::add33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 19:
+               {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 20:
+               {
+                    Goldilocks3::add33c_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.challenges[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 21:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 22:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    break;
+               }
+               case 23:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets2[j] = args42[i_args + 2] + (((i + j) + args42[i_args + 3]) % args42[i_args + 4]) * args42[i_args + 5];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], tmp1[args42[i_args + 1]], &params.pols[0], offsets2);
+                    i_args += 6;
+                    break;
+               }
+               case 24:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 25:
+               {
+
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    break;
+               }
+               case 26:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    break;
+               }
+               case 27:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 28:
+               {
+
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], Goldilocks::fromU64(args42[i_args + 3]), args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 29:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], Goldilocks::fromU64(args42[i_args + 5]), offsets1);
+                    i_args += 6;
+                    break;
+               }
+               case 30:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    break;
+               }
+               case 31:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets2[j] = args42[i_args + 2] + (((i + j) + args42[i_args + 3]) % args42[i_args + 4]) * args42[i_args + 5];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[0], offsets2);
+                    i_args += 6;
+                    break;
+               }
+               case 32:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    break;
+               }
+               case 33:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets2[j] = args42[i_args + 2] + (((i + j) + args42[i_args + 3]) % args42[i_args + 4]) * numpols;
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(0, 0), offsets2);
+                    i_args += 5;
+                    break;
+               }
+               case 34:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.publicInputs[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 35:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (i + j) * args42[i_args + 6];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 7;
+                    break;
+               }
+               case 36:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (i + j) * args42[i_args + 2];
+                         offsets2[j] = args42[i_args + 3] + (((i + j) + args42[i_args + 4]) % args42[i_args + 5]) * args42[i_args + 6];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 7;
+                    break;
+               }
+               case 37:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    break;
+               }
+               case 38:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (((i + j) + args42[i_args + 6]) % args42[i_args + 7]) * args42[i_args + 8];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 9;
+                    break;
+               }
+               case 39:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], numpols, args42[i_args + 3]);
+                    i_args += 4;
+                    break;
+               }
+               case 40:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    break;
+               }
+               case 41:
+               {
+                    Goldilocks3::sub31c_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], Goldilocks::fromU64(args42[i_args + 3]), args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 42:
+               {
+                    Goldilocks3::sub_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 43:
+               {
+                    Goldilocks3::sub33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 44:
+               {
+                    Goldilocks3::sub_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    break;
+               }
+               case 45:
+               {
+                    Goldilocks::mult_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 46:
+               {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 47:
+               {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 48:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    break;
+               }
+               case 49:
+               {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    break;
+               }
+               case 50:
+               {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    break;
+               }
+               case 51:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (i + j) * args42[i_args + 2];
+                         offsets2[j] = args42[i_args + 3] + (((i + j) + args42[i_args + 4]) % args42[i_args + 5]) * args42[i_args + 6];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 7;
+                    break;
+               }
+               case 52:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (((i + j) + args42[i_args + 6]) % args42[i_args + 7]) * args42[i_args + 8];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 9;
+                    break;
+               }
+               case 53:
+               {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    break;
+               }
+               case 54:
+               {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pConstPols2ns->getElement(args42[i_args + 3], i), args42[i_args + 2], numpols);
+                    i_args += 4;
+                    break;
+               }
+               case 55:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (i + j) * numpols;
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], &params.pConstPols2ns->getElement(0, 0), offsets1, offsets2);
+                    i_args += 6;
+                    break;
+               }
+               case 56:
+               {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    break;
+               }
+               case 57:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets2[j] = args42[i_args + 2] + (((i + j) + args42[i_args + 3]) % args42[i_args + 4]) * args42[i_args + 5];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], tmp1[args42[i_args + 1]], &params.pols[0], offsets2);
+                    i_args += 6;
+                    break;
+               }
+               case 58:
+               {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), tmp1[args42[i_args + 2]], numpols);
+                    i_args += 3;
+                    break;
+               }
+               case 59:
+               {
+                    Goldilocks3::mul13c_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 60:
+               {
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], &params.pConstPols2ns->getElement(args42[i_args + 1], i), tmp3[args42[i_args + 2]], numpols);
+                    i_args += 3;
+                    break;
+               }
+               case 61:
+               {
+
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 62:
+               {
+                    Goldilocks3::mul13c_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.challenges[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 63:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks3::mul13c_avx(tmp3[args42[i_args]], &params.pols[0], params.challenges[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    break;
+               }
+               case 64:
+               {
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 65:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = FIELD_EXTENSION * (j + AVX_SIZE_ * args42[i_args + 5]);
+                    }
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], &params.pols[0], tmp3[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    break;
+               }
+               case 66:
+               {
+                    Goldilocks3::mul1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), (Goldilocks3::Element &)*params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 67:
+               {
+                    Goldilocks3::mul13c_avx(tmp3[args42[i_args]], params.x_2ns[i], (Goldilocks3::Element &)*params.challenges[args42[i_args + 1]], params.x_2ns.offset());
+                    i_args += 2;
+                    break;
+               }
+               case 68:
+               {
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], params.x_2ns[i], tmp3[args42[i_args + 1]], params.x_2ns.offset());
+                    i_args += 2;
+                    break;
+               }
+               case 69:
+               {
+
+                    Goldilocks::Element tmp_inv[3];
+                    Goldilocks::Element ti0[4];
+                    Goldilocks::Element ti1[4];
+                    Goldilocks::Element ti2[4];
+                    Goldilocks::store_avx(ti0, tmp3[args42[i_args]][0]);
+                    Goldilocks::store_avx(ti1, tmp3[args42[i_args]][1]);
+                    Goldilocks::store_avx(ti2, tmp3[args42[i_args]][2]);
+
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         tmp_inv[0] = ti0[j];
+                         tmp_inv[1] = ti1[j];
+                         tmp_inv[2] = ti2[j];
+                         Goldilocks3::mul((Goldilocks3::Element &)(params.q_2ns[(i + j) * 3]),
+                                          params.zi.zhInv((i + j)),
+                                          (Goldilocks3::Element &)tmp_inv);
+                    }
+                    i_args += 1;
+                    break;
+               }
+               case 70:
+               {
+
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    break;
+               }
+               case 71:
+               {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 72:
+               {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    break;
+               }
+               case 73:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], &params.pols[0], params.challenges[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    break;
+               }
+               case 74:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = FIELD_EXTENSION * (j + AVX_SIZE_ * args42[i_args + 5]);
+                    }
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], &params.pols[0], tmp3[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    break;
+               }
+               case 75:
+               {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 76:
+               {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.challenges[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    break;
+               }
+               case 77:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (i + j) * args42[i_args + 6];
+                    }
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 7;
+                    break;
+               }
+               case 78:
+               {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]]);
+                    i_args += 2;
+                    break;
+               }
+               case 79:
+               {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    break;
+               }
+               case 80:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::copy_avx(tmp1[args42[i_args]], &params.pols[0], offsets1);
+                    i_args += 5;
+                    break;
+               }
+               case 81:
+               {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]));
+                    i_args += 2;
+                    break;
+               }
+               case 82:
+               {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), numpols);
+                    i_args += 2;
+                    break;
+               }
+               case 83:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * numpols;
+                    }
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(0, 0), offsets1);
+
+                    i_args += 4;
+                    break;
+               }
+               case 84:
+               {
+                    // 12 - 70: 1918
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    break;
+               }
+               case 85:
+               {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    break;
+               }
+               case 86:
+               {
+                    //  32, 47, 21, 32, 48: 166
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    break;
+               }
+               case 87:
+               {
+                    //  84, 84, 84, 84,
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    break;
+               }
+               case 88:
+               {
+                    // 88
+                    //  21, 50, 21, 53, 0, 85, 50, 85, 21, 50,
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    break;
+               }
+	          case 89: 
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks3::sub31c_avx(tmp3[(args42[i_args])], &params.pols[0], Goldilocks::fromU64(args42[i_args + 5]), offsets1);
+                    i_args += 6;
+                    break;
+               }
+               case 90:
+               {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (((i + j) + args42[i_args + 6]) % args42[i_args + 7]) * numpols;
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], &params.pConstPols2ns->getElement(0, 0), offsets1, offsets2);
+                    i_args += 8;
+                    break;
+               }
+               case 91:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pConstPols2ns->getElement(args42[i_args + 3], i), args42[i_args + 2], numpols);
+                    i_args += 4;
+                    break;
+               }
+               case 92:
+               {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), numpols, tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 93:
+               {
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    break;
+               }
+               case 94:
+               {
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 95:
+               {
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    break;
+               }
+               case 96:
+               {
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 97:
+               {
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 98:
+               {
+                    // 79
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    }
+                    // 79
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    }
+                    // 79
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    }
+                    // 79
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    }
+                    // 79
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    }
+                    // 79
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    }
+                    // 79
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    }
+                    // 79
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 99:
+               {
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    break;
+               }
+               case 100:
+               {
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    break;
+               }
+               case 101:
+               {
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    break;
+               }
+               case 102:
+               {
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 54
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pConstPols2ns->getElement(args42[i_args + 3], i), args42[i_args + 2], numpols);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 54
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pConstPols2ns->getElement(args42[i_args + 3], i), args42[i_args + 2], numpols);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 54
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pConstPols2ns->getElement(args42[i_args + 3], i), args42[i_args + 2], numpols);
+                    i_args += 4;
+                    }
+                    break;
+               }
+               case 103:
+               {
+                    // 87
+                    {
+                    //  84, 84, 84, 84,
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 87
+                    {
+                    //  84, 84, 84, 84,
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 87
+                    {
+                    //  84, 84, 84, 84,
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 87
+                    {
+                    //  84, 84, 84, 84,
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 87
+                    {
+                    //  84, 84, 84, 84,
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 87
+                    {
+                    //  84, 84, 84, 84,
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 104:
+               {
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 47
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 25
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    break;
+               }
+               case 105:
+               {
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 106:
+               {
+                    // 26
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 30
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 56
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 26
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 30
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 56
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    break;
+               }
+               case 107:
+               {
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 108:
+               {
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    break;
+               }
+               case 109:
+               {
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 110:
+               {
+                    // 78
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]]);
+                    i_args += 2;
+                    }
+                    // 78
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]]);
+                    i_args += 2;
+                    }
+                    // 78
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]]);
+                    i_args += 2;
+                    }
+                    // 78
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]]);
+                    i_args += 2;
+                    }
+                    // 78
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]]);
+                    i_args += 2;
+                    }
+                    // 78
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]]);
+                    i_args += 2;
+                    }
+                    // 78
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]]);
+                    i_args += 2;
+                    }
+                    // 78
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]]);
+                    i_args += 2;
+                    }
+                    break;
+               }
+               case 111:
+               {
+                    // 19
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 13
+                    {
+                    Goldilocks3::add1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 73
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], &params.pols[0], params.challenges[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 19
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 13
+                    {
+                    Goldilocks3::add1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 71
+                    {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 112:
+               {
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    break;
+               }
+               case 113:
+               {
+                    // 13
+                    {
+                    Goldilocks3::add1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 71
+                    {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 13
+                    {
+                    Goldilocks3::add1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 71
+                    {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 74
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = FIELD_EXTENSION * (j + AVX_SIZE_ * args42[i_args + 5]);
+                    }
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], &params.pols[0], tmp3[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 75
+                    {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 42
+                    {
+                    Goldilocks3::sub_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 114:
+               {
+                    // 2
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 115:
+               {
+                    // 26
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 116:
+               {
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    break;
+               }
+               case 117:
+               {
+                    // 86
+                    {
+                    //  32, 47, 21, 32, 48: 166
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 86
+                    {
+                    //  32, 47, 21, 32, 48: 166
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 86
+                    {
+                    //  32, 47, 21, 32, 48: 166
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 86
+                    {
+                    //  32, 47, 21, 32, 48: 166
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 86
+                    {
+                    //  32, 47, 21, 32, 48: 166
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 86
+                    {
+                    //  32, 47, 21, 32, 48: 166
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 86
+                    {
+                    //  32, 47, 21, 32, 48: 166
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 86
+                    {
+                    //  32, 47, 21, 32, 48: 166
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    break;
+               }
+               case 118:
+               {
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 25
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 27
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 47
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 54
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pConstPols2ns->getElement(args42[i_args + 3], i), args42[i_args + 2], numpols);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 119:
+               {
+                    // 12
+                    {
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 43
+                    {
+                    Goldilocks3::sub33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 61
+                    {
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 18
+                    {
+                    Goldilocks3::add33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 18
+                    {
+                    Goldilocks3::add33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 74
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = FIELD_EXTENSION * (j + AVX_SIZE_ * args42[i_args + 5]);
+                    }
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], &params.pols[0], tmp3[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 72
+                    {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 42
+                    {
+                    Goldilocks3::sub_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 120:
+               {
+                    // 30
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 47
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 26
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 121:
+               {
+                    // 27
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 56
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 54
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pConstPols2ns->getElement(args42[i_args + 3], i), args42[i_args + 2], numpols);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 25
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    break;
+               }
+               case 122:
+               {
+                    // 88
+                    {
+                    // 88
+                    //  21, 50, 21, 53, 0, 85, 50, 85, 21, 50,
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 88
+                    {
+                    // 88
+                    //  21, 50, 21, 53, 0, 85, 50, 85, 21, 50,
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 88
+                    {
+                    // 88
+                    //  21, 50, 21, 53, 0, 85, 50, 85, 21, 50,
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 88
+                    {
+                    // 88
+                    //  21, 50, 21, 53, 0, 85, 50, 85, 21, 50,
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    break;
+               }
+               case 123:
+               {
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 78
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]]);
+                    i_args += 2;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 78
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]]);
+                    i_args += 2;
+                    }
+                    break;
+               }
+               case 124:
+               {
+                    // 2
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    break;
+               }
+               case 125:
+               {
+                    // 26
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 34
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.publicInputs[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 58
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), tmp1[args42[i_args + 2]], numpols);
+                    i_args += 3;
+                    }
+                    // 26
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 34
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.publicInputs[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 58
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), tmp1[args42[i_args + 2]], numpols);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 126:
+               {
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    break;
+               }
+               case 127:
+               {
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 2
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    break;
+               }
+               case 128:
+               {
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 26
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    break;
+               }
+               case 129:
+               {
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 130:
+               {
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 84
+                    {
+                    // 12 - 70: 1918
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 131:
+               {
+                    // 13
+                    {
+                    Goldilocks3::add1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 71
+                    {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 13
+                    {
+                    Goldilocks3::add1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 71
+                    {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 44
+                    {
+                    Goldilocks3::sub_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 132:
+               {
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    break;
+               }
+               case 133:
+               {
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 49
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 134:
+               {
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 46
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 135:
+               {
+                    // 82
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), numpols);
+                    i_args += 2;
+                    }
+                    // 82
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), numpols);
+                    i_args += 2;
+                    }
+                    // 82
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), numpols);
+                    i_args += 2;
+                    }
+                    // 82
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), numpols);
+                    i_args += 2;
+                    }
+                    break;
+               }
+               case 136:
+               {
+                    // 83
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * numpols;
+                    }
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(0, 0), offsets1);
+
+                    i_args += 4;
+                    }
+                    // 83
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * numpols;
+                    }
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(0, 0), offsets1);
+
+                    i_args += 4;
+                    }
+                    // 83
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * numpols;
+                    }
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(0, 0), offsets1);
+
+                    i_args += 4;
+                    }
+                    // 83
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * numpols;
+                    }
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(0, 0), offsets1);
+
+                    i_args += 4;
+                    }
+                    break;
+               }
+               case 137:
+               {
+                    // 79
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    }
+                    // 79
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    }
+                    // 79
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 138:
+               {
+                    // 84
+                    {
+                    // 12 - 70: 1918
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 84
+                    {
+                    // 12 - 70: 1918
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 12
+                    {
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 139:
+               {
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 140:
+               {
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 26
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    break;
+               }
+               case 141:
+               {
+                    // 41
+                    {
+                    Goldilocks3::sub31c_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], Goldilocks::fromU64(args42[i_args + 3]), args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 60
+                    {
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], &params.pConstPols2ns->getElement(args42[i_args + 1], i), tmp3[args42[i_args + 2]], numpols);
+                    i_args += 3;
+                    }
+                    // 76
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.challenges[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 19
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 13
+                    {
+                    Goldilocks3::add1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 73
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], &params.pols[0], params.challenges[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 19
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 13
+                    {
+                    Goldilocks3::add1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 71
+                    {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 142:
+               {
+                    // 59
+                    {
+                    Goldilocks3::mul13c_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 87
+                    {
+                    //  84, 84, 84, 84,
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 87
+                    {
+                    //  84, 84, 84, 84,
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 143:
+               {
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 2
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    break;
+               }
+               case 144:
+               {
+                    // 44
+                    {
+                    Goldilocks3::sub_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 145:
+               {
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 146:
+               {
+                    // 15
+                    {
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 13
+                    {
+                    Goldilocks3::add1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 63
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks3::mul13c_avx(tmp3[args42[i_args]], &params.pols[0], params.challenges[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 15
+                    {
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 13
+                    {
+                    Goldilocks3::add1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 70
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 17
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 71
+                    {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 147:
+               {
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 47
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 25
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 47
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 25
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 47
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 25
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 47
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 25
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 47
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 25
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 47
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 25
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 47
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 25
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 47
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 25
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    break;
+               }
+               case 148:
+               {
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 25
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    // 32
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    // 47
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    break;
+               }
+               case 149:
+               {
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 84
+                    {
+                    // 12 - 70: 1918
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 1
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 84
+                    {
+                    // 12 - 70: 1918
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 150:
+               {
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 151:
+               {
+                    // 12
+                    {
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 43
+                    {
+                    Goldilocks3::sub33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 61
+                    {
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 18
+                    {
+                    Goldilocks3::add33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 152:
+               {
+                    // 22
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               case 153:
+               {
+                    // 45
+                    {
+                    Goldilocks::mult_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 26
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 35
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (i + j) * args42[i_args + 6];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 7;
+                    }
+                    break;
+               }
+               case 154:
+               {
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    break;
+               }
+               case 155:
+               {
+                    // 80
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::copy_avx(tmp1[args42[i_args]], &params.pols[0], offsets1);
+                    i_args += 5;
+                    }
+                    // 80
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::copy_avx(tmp1[args42[i_args]], &params.pols[0], offsets1);
+                    i_args += 5;
+                    }
+                    // 80
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::copy_avx(tmp1[args42[i_args]], &params.pols[0], offsets1);
+                    i_args += 5;
+                    }
+                    // 80
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::copy_avx(tmp1[args42[i_args]], &params.pols[0], offsets1);
+                    i_args += 5;
+                    }
+                    // 80
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::copy_avx(tmp1[args42[i_args]], &params.pols[0], offsets1);
+                    i_args += 5;
+                    }
+                    // 80
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::copy_avx(tmp1[args42[i_args]], &params.pols[0], offsets1);
+                    i_args += 5;
+                    }
+                    // 80
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::copy_avx(tmp1[args42[i_args]], &params.pols[0], offsets1);
+                    i_args += 5;
+                    }
+                    // 80
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::copy_avx(tmp1[args42[i_args]], &params.pols[0], offsets1);
+                    i_args += 5;
+                    }
+                    break;
+               }
+               case 156:
+               {
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 26
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 85
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 50
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    // 21
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    // 53
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    // 0
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    break;
+               }
+               default:
+                    std::cout
+                        << " Wrong operation in step42ns_first!"
+                        << std::endl;
+                    exit(1); // rick, use execption
+               }
+          }
+          assert(i_args == NARGS_);
+          // delete (tmp1);
+          // delete (tmp3);
+     }
+}
+
+#define STEP42NS_PARSER_FIRST_AVX_PROFILE_ROWS 4096 // Rows executed by the profiler
+
+void ZkevmSteps::step42ns_parser_first_avx_profile(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch)
+{
+     uint64_t profileRows = nrows < STEP42NS_PARSER_FIRST_AVX_PROFILE_ROWS ? nrows : STEP42NS_PARSER_FIRST_AVX_PROFILE_ROWS;
+     uint64_t profileCycles[93] = {0};
+     uint64_t profileCalls[93] = {0};
+
+
+     for (uint64_t i = 0; i < profileRows; i += nrowsBatch)
+     {
+          int i_args = 0;
+          //__m256i *tmp1 = new __m256i[NTEMP1_];
+          // Goldilocks3::Element_avx *tmp3 = new Goldilocks3::Element_avx[NTEMP3_];
+          __m256i tmp1[NTEMP1_];
+          Goldilocks3::Element_avx tmp3[NTEMP3_];
+          uint64_t offsets1[4], offsets2[4];
+          uint64_t numpols = params.pConstPols2ns->numPols();
+
+          for (int kk = 0; kk < NOPS_; ++kk)
+          {
+               switch (op42[kk])
+               {
+               case 0:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[0] += __rdtsc() - profileStart;
+                    profileCalls[0]++;
+                    break;
+               }
+               case 1:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    profileCycles[1] += __rdtsc() - profileStart;
+                    profileCalls[1]++;
+                    break;
+               }
+               case 2:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    profileCycles[2] += __rdtsc() - profileStart;
+                    profileCalls[2]++;
+                    break;
+               }
+               case 3:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    profileCycles[3] += __rdtsc() - profileStart;
+                    profileCalls[3]++;
+                    break;
+               }
+               case 4:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    profileCycles[4] += __rdtsc() - profileStart;
+                    profileCalls[4]++;
+                    break;
+               }
+               case 5:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (((i + j) + args42[i_args + 6]) % args42[i_args + 7]) * args42[i_args + 8];
+                    }
+                    Goldilocks::add_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 9;
+                    }
+                    profileCycles[5] += __rdtsc() - profileStart;
+                    profileCalls[5]++;
+                    break;
+               }
+               case 6:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pConstPols2ns->getElement(args42[i_args + 3], i), args42[i_args + 2], numpols);
+                    i_args += 4;
+                    }
+                    profileCycles[6] += __rdtsc() - profileStart;
+                    profileCalls[6]++;
+                    break;
+               }
+               case 7:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], Goldilocks::fromU64(args42[i_args + 3]), args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[7] += __rdtsc() - profileStart;
+                    profileCalls[7]++;
+                    break;
+               }
+               case 8:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols, numpols);
+                    i_args += 3;
+                    }
+                    profileCycles[8] += __rdtsc() - profileStart;
+                    profileCalls[8]++;
+                    break;
+               }
+               case 9:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * numpols;
+                         offsets2[j] = args42[i_args + 4] + (((i + j) + args42[i_args + 5]) % args42[i_args + 6]) * numpols;
+                    }
+                    Goldilocks::add_avx(tmp1[args42[i_args]], &params.pConstPols2ns->getElement(0, 0), &params.pConstPols2ns->getElement(0, 0), offsets1, offsets2);
+                    i_args += 7;
+                    }
+                    profileCycles[9] += __rdtsc() - profileStart;
+                    profileCalls[9]++;
+                    break;
+               }
+               case 10:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), Goldilocks::fromU64(args42[i_args + 2]), numpols);
+                    i_args += 3;
+                    }
+                    profileCycles[10] += __rdtsc() - profileStart;
+                    profileCalls[10]++;
+                    break;
+               }
+               case 11:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * numpols;
+                    }
+                    Goldilocks::add_avx(tmp1[args42[i_args]], &params.pConstPols2ns->getElement(0, 0), Goldilocks::fromU64(args42[i_args + 4]), offsets1);
+                    i_args += 5;
+                    }
+                    profileCycles[11] += __rdtsc() - profileStart;
+                    profileCalls[11]++;
+                    break;
+               }
+               case 12:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[12] += __rdtsc() - profileStart;
+                    profileCalls[12]++;
+                    break;
+               }
+               case 13:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::add1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[13] += __rdtsc() - profileStart;
+                    profileCalls[13]++;
+                    break;
+               }
+               case 14:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::add13c_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[14] += __rdtsc() - profileStart;
+                    profileCalls[14]++;
+                    break;
+               }
+               case 15:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[15] += __rdtsc() - profileStart;
+                    profileCalls[15]++;
+                    break;
+               }
+               case 16:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::add13c_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.challenges[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[16] += __rdtsc() - profileStart;
+                    profileCalls[16]++;
+                    break;
+               }
+               case 17:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[17] += __rdtsc() - profileStart;
+                    profileCalls[17]++;
+                    break;
+               }
+               case 18:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::add33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[18] += __rdtsc() - profileStart;
+                    profileCalls[18]++;
+                    break;
+               }
+               case 19:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::add_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[19] += __rdtsc() - profileStart;
+                    profileCalls[19]++;
+                    break;
+               }
+               case 20:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::add33c_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.challenges[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[20] += __rdtsc() - profileStart;
+                    profileCalls[20]++;
+                    break;
+               }
+               case 21:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[21] += __rdtsc() - profileStart;
+                    profileCalls[21]++;
+                    break;
+               }
+               case 22:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    profileCycles[22] += __rdtsc() - profileStart;
+                    profileCalls[22]++;
+                    break;
+               }
+               case 23:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets2[j] = args42[i_args + 2] + (((i + j) + args42[i_args + 3]) % args42[i_args + 4]) * args42[i_args + 5];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], tmp1[args42[i_args + 1]], &params.pols[0], offsets2);
+                    i_args += 6;
+                    }
+                    profileCycles[23] += __rdtsc() - profileStart;
+                    profileCalls[23]++;
+                    break;
+               }
+               case 24:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[24] += __rdtsc() - profileStart;
+                    profileCalls[24]++;
+                    break;
+               }
+               case 25:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    profileCycles[25] += __rdtsc() - profileStart;
+                    profileCalls[25]++;
+                    break;
+               }
+               case 26:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], Goldilocks::fromU64(args42[i_args + 2]));
+                    i_args += 3;
+                    }
+                    profileCycles[26] += __rdtsc() - profileStart;
+                    profileCalls[26]++;
+                    break;
+               }
+               case 27:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[27] += __rdtsc() - profileStart;
+                    profileCalls[27]++;
+                    break;
+               }
+               case 28:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], Goldilocks::fromU64(args42[i_args + 3]), args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[28] += __rdtsc() - profileStart;
+                    profileCalls[28]++;
+                    break;
+               }
+               case 29:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], Goldilocks::fromU64(args42[i_args + 5]), offsets1);
+                    i_args += 6;
+                    }
+                    profileCycles[29] += __rdtsc() - profileStart;
+                    profileCalls[29]++;
+                    break;
+               }
+               case 30:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    profileCycles[30] += __rdtsc() - profileStart;
+                    profileCalls[30]++;
+                    break;
+               }
+               case 31:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets2[j] = args42[i_args + 2] + (((i + j) + args42[i_args + 3]) % args42[i_args + 4]) * args42[i_args + 5];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[0], offsets2);
+                    i_args += 6;
+                    }
+                    profileCycles[31] += __rdtsc() - profileStart;
+                    profileCalls[31]++;
+                    break;
+               }
+               case 32:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    profileCycles[32] += __rdtsc() - profileStart;
+                    profileCalls[32]++;
+                    break;
+               }
+               case 33:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets2[j] = args42[i_args + 2] + (((i + j) + args42[i_args + 3]) % args42[i_args + 4]) * numpols;
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(0, 0), offsets2);
+                    i_args += 5;
+                    }
+                    profileCycles[33] += __rdtsc() - profileStart;
+                    profileCalls[33]++;
+                    break;
+               }
+               case 34:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.publicInputs[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[34] += __rdtsc() - profileStart;
+                    profileCalls[34]++;
+                    break;
+               }
+               case 35:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (i + j) * args42[i_args + 6];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 7;
+                    }
+                    profileCycles[35] += __rdtsc() - profileStart;
+                    profileCalls[35]++;
+                    break;
+               }
+               case 36:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (i + j) * args42[i_args + 2];
+                         offsets2[j] = args42[i_args + 3] + (((i + j) + args42[i_args + 4]) % args42[i_args + 5]) * args42[i_args + 6];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 7;
+                    }
+                    profileCycles[36] += __rdtsc() - profileStart;
+                    profileCalls[36]++;
+                    break;
+               }
+               case 37:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    profileCycles[37] += __rdtsc() - profileStart;
+                    profileCalls[37]++;
+                    break;
+               }
+               case 38:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (((i + j) + args42[i_args + 6]) % args42[i_args + 7]) * args42[i_args + 8];
+                    }
+                    Goldilocks::sub_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 9;
+                    }
+                    profileCycles[38] += __rdtsc() - profileStart;
+                    profileCalls[38]++;
+                    break;
+               }
+               case 39:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], numpols, args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    profileCycles[39] += __rdtsc() - profileStart;
+                    profileCalls[39]++;
+                    break;
+               }
+               case 40:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    profileCycles[40] += __rdtsc() - profileStart;
+                    profileCalls[40]++;
+                    break;
+               }
+               case 41:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::sub31c_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], Goldilocks::fromU64(args42[i_args + 3]), args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[41] += __rdtsc() - profileStart;
+                    profileCalls[41]++;
+                    break;
+               }
+               case 42:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::sub_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[42] += __rdtsc() - profileStart;
+                    profileCalls[42]++;
+                    break;
+               }
+               case 43:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::sub33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[43] += __rdtsc() - profileStart;
+                    profileCalls[43]++;
+                    break;
+               }
+               case 44:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::sub_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    profileCycles[44] += __rdtsc() - profileStart;
+                    profileCalls[44]++;
+                    break;
+               }
+               case 45:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::mult_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[45] += __rdtsc() - profileStart;
+                    profileCalls[45]++;
+                    break;
+               }
+               case 46:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[46] += __rdtsc() - profileStart;
+                    profileCalls[46]++;
+                    break;
+               }
+               case 47:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[47] += __rdtsc() - profileStart;
+                    profileCalls[47]++;
+                    break;
+               }
+               case 48:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    profileCycles[48] += __rdtsc() - profileStart;
+                    profileCalls[48]++;
+                    break;
+               }
+               case 49:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    }
+                    profileCycles[49] += __rdtsc() - profileStart;
+                    profileCalls[49]++;
+                    break;
+               }
+               case 50:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    profileCycles[50] += __rdtsc() - profileStart;
+                    profileCalls[50]++;
+                    break;
+               }
+               case 51:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (i + j) * args42[i_args + 2];
+                         offsets2[j] = args42[i_args + 3] + (((i + j) + args42[i_args + 4]) % args42[i_args + 5]) * args42[i_args + 6];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 7;
+                    }
+                    profileCycles[51] += __rdtsc() - profileStart;
+                    profileCalls[51]++;
+                    break;
+               }
+               case 52:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (((i + j) + args42[i_args + 6]) % args42[i_args + 7]) * args42[i_args + 8];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 9;
+                    }
+                    profileCycles[52] += __rdtsc() - profileStart;
+                    profileCalls[52]++;
+                    break;
+               }
+               case 53:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    profileCycles[53] += __rdtsc() - profileStart;
+                    profileCalls[53]++;
+                    break;
+               }
+               case 54:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pConstPols2ns->getElement(args42[i_args + 3], i), args42[i_args + 2], numpols);
+                    i_args += 4;
+                    }
+                    profileCycles[54] += __rdtsc() - profileStart;
+                    profileCalls[54]++;
+                    break;
+               }
+               case 55:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (i + j) * numpols;
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], &params.pConstPols2ns->getElement(0, 0), offsets1, offsets2);
+                    i_args += 6;
+                    }
+                    profileCycles[55] += __rdtsc() - profileStart;
+                    profileCalls[55]++;
+                    break;
+               }
+               case 56:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    }
+                    profileCycles[56] += __rdtsc() - profileStart;
+                    profileCalls[56]++;
+                    break;
+               }
+               case 57:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets2[j] = args42[i_args + 2] + (((i + j) + args42[i_args + 3]) % args42[i_args + 4]) * args42[i_args + 5];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], tmp1[args42[i_args + 1]], &params.pols[0], offsets2);
+                    i_args += 6;
+                    }
+                    profileCycles[57] += __rdtsc() - profileStart;
+                    profileCalls[57]++;
+                    break;
+               }
+               case 58:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), tmp1[args42[i_args + 2]], numpols);
+                    i_args += 3;
+                    }
+                    profileCycles[58] += __rdtsc() - profileStart;
+                    profileCalls[58]++;
+                    break;
+               }
+               case 59:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul13c_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[59] += __rdtsc() - profileStart;
+                    profileCalls[59]++;
+                    break;
+               }
+               case 60:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], &params.pConstPols2ns->getElement(args42[i_args + 1], i), tmp3[args42[i_args + 2]], numpols);
+                    i_args += 3;
+                    }
+                    profileCycles[60] += __rdtsc() - profileStart;
+                    profileCalls[60]++;
+                    break;
+               }
+               case 61:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[61] += __rdtsc() - profileStart;
+                    profileCalls[61]++;
+                    break;
+               }
+               case 62:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul13c_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.challenges[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[62] += __rdtsc() - profileStart;
+                    profileCalls[62]++;
+                    break;
+               }
+               case 63:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks3::mul13c_avx(tmp3[args42[i_args]], &params.pols[0], params.challenges[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    profileCycles[63] += __rdtsc() - profileStart;
+                    profileCalls[63]++;
+                    break;
+               }
+               case 64:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[64] += __rdtsc() - profileStart;
+                    profileCalls[64]++;
+                    break;
+               }
+               case 65:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = FIELD_EXTENSION * (j + AVX_SIZE_ * args42[i_args + 5]);
+                    }
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], &params.pols[0], tmp3[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    profileCycles[65] += __rdtsc() - profileStart;
+                    profileCalls[65]++;
+                    break;
+               }
+               case 66:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul1c3c_avx(tmp3[args42[i_args]], Goldilocks::fromU64(args42[i_args + 1]), (Goldilocks3::Element &)*params.challenges[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[66] += __rdtsc() - profileStart;
+                    profileCalls[66]++;
+                    break;
+               }
+               case 67:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul13c_avx(tmp3[args42[i_args]], params.x_2ns[i], (Goldilocks3::Element &)*params.challenges[args42[i_args + 1]], params.x_2ns.offset());
+                    i_args += 2;
+                    }
+                    profileCycles[67] += __rdtsc() - profileStart;
+                    profileCalls[67]++;
+                    break;
+               }
+               case 68:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul13_avx(tmp3[args42[i_args]], params.x_2ns[i], tmp3[args42[i_args + 1]], params.x_2ns.offset());
+                    i_args += 2;
+                    }
+                    profileCycles[68] += __rdtsc() - profileStart;
+                    profileCalls[68]++;
+                    break;
+               }
+               case 69:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::Element tmp_inv[3];
+                    Goldilocks::Element ti0[4];
+                    Goldilocks::Element ti1[4];
+                    Goldilocks::Element ti2[4];
+                    Goldilocks::store_avx(ti0, tmp3[args42[i_args]][0]);
+                    Goldilocks::store_avx(ti1, tmp3[args42[i_args]][1]);
+                    Goldilocks::store_avx(ti2, tmp3[args42[i_args]][2]);
+
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         tmp_inv[0] = ti0[j];
+                         tmp_inv[1] = ti1[j];
+                         tmp_inv[2] = ti2[j];
+                         Goldilocks3::mul((Goldilocks3::Element &)(params.q_2ns[(i + j) * 3]),
+                                          params.zi.zhInv((i + j)),
+                                          (Goldilocks3::Element &)tmp_inv);
+                    }
+                    i_args += 1;
+                    }
+                    profileCycles[69] += __rdtsc() - profileStart;
+                    profileCalls[69]++;
+                    break;
+               }
+               case 70:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    profileCycles[70] += __rdtsc() - profileStart;
+                    profileCalls[70]++;
+                    break;
+               }
+               case 71:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[71] += __rdtsc() - profileStart;
+                    profileCalls[71]++;
+                    break;
+               }
+               case 72:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    profileCycles[72] += __rdtsc() - profileStart;
+                    profileCalls[72]++;
+                    break;
+               }
+               case 73:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], &params.pols[0], params.challenges[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    profileCycles[73] += __rdtsc() - profileStart;
+                    profileCalls[73]++;
+                    break;
+               }
+               case 74:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = FIELD_EXTENSION * (j + AVX_SIZE_ * args42[i_args + 5]);
+                    }
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], &params.pols[0], tmp3[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    profileCycles[74] += __rdtsc() - profileStart;
+                    profileCalls[74]++;
+                    break;
+               }
+               case 75:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp3[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[75] += __rdtsc() - profileStart;
+                    profileCalls[75]++;
+                    break;
+               }
+               case 76:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], params.challenges[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    }
+                    profileCycles[76] += __rdtsc() - profileStart;
+                    profileCalls[76]++;
+                    break;
+               }
+               case 77:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (i + j) * args42[i_args + 6];
+                    }
+                    Goldilocks3::mul_avx(tmp3[args42[i_args]], &params.pols[0], &params.pols[0], offsets1, offsets2);
+                    i_args += 7;
+                    }
+                    profileCycles[77] += __rdtsc() - profileStart;
+                    profileCalls[77]++;
+                    break;
+               }
+               case 78:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]]);
+                    i_args += 2;
+                    }
+                    profileCycles[78] += __rdtsc() - profileStart;
+                    profileCalls[78]++;
+                    break;
+               }
+               case 79:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    }
+                    profileCycles[79] += __rdtsc() - profileStart;
+                    profileCalls[79]++;
+                    break;
+               }
+               case 80:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::copy_avx(tmp1[args42[i_args]], &params.pols[0], offsets1);
+                    i_args += 5;
+                    }
+                    profileCycles[80] += __rdtsc() - profileStart;
+                    profileCalls[80]++;
+                    break;
+               }
+               case 81:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]));
+                    i_args += 2;
+                    }
+                    profileCycles[81] += __rdtsc() - profileStart;
+                    profileCalls[81]++;
+                    break;
+               }
+               case 82:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), numpols);
+                    i_args += 2;
+                    }
+                    profileCycles[82] += __rdtsc() - profileStart;
+                    profileCalls[82]++;
+                    break;
+               }
+               case 83:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * numpols;
+                    }
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(0, 0), offsets1);
+
+                    i_args += 4;
+                    }
+                    profileCycles[83] += __rdtsc() - profileStart;
+                    profileCalls[83]++;
+                    break;
+               }
+               case 84:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    // 12 - 70: 1918
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    profileCycles[84] += __rdtsc() - profileStart;
+                    profileCalls[84]++;
+                    break;
+               }
+               case 85:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    // 0 - 50: 1462
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    profileCycles[85] += __rdtsc() - profileStart;
+                    profileCalls[85]++;
+                    break;
+               }
+               case 86:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    //  32, 47, 21, 32, 48: 166
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], tmp1[args42[i_args + 3]], args42[i_args + 2]);
+                    i_args += 4;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pConstPols2ns->getElement(args42[i_args + 2], i), numpols);
+                    i_args += 3;
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], tmp1[args42[i_args + 5]], offsets1);
+                    i_args += 6;
+                    }
+                    profileCycles[86] += __rdtsc() - profileStart;
+                    profileCalls[86]++;
+                    break;
+               }
+               case 87:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    //  84, 84, 84, 84,
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    Goldilocks3::add13_avx(tmp3[args42[i_args]], tmp1[args42[i_args + 1]], tmp3[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks3::mul33c_avx(tmp3[args42[i_args]], tmp3[args42[i_args + 2]], params.challenges[args42[i_args + 1]]);
+                    i_args += 3;
+                    }
+                    profileCycles[87] += __rdtsc() - profileStart;
+                    profileCalls[87]++;
+                    break;
+               }
+               case 88:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    // 88
+                    //  21, 50, 21, 53, 0, 85, 50, 85, 21, 50,
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pols[args42[i_args + 3] + i * args42[i_args + 4]], args42[i_args + 2], args42[i_args + 4]);
+                    i_args += 5;
+                    }
+                    profileCycles[88] += __rdtsc() - profileStart;
+                    profileCalls[88]++;
+                    break;
+               }
+	          case 89: 
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                    }
+                    Goldilocks3::sub31c_avx(tmp3[(args42[i_args])], &params.pols[0], Goldilocks::fromU64(args42[i_args + 5]), offsets1);
+                    i_args += 6;
+                    }
+                    profileCycles[89] += __rdtsc() - profileStart;
+                    profileCalls[89]++;
+                    break;
+               }
+               case 90:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    for (uint64_t j = 0; j < AVX_SIZE_; ++j)
+                    {
+                         offsets1[j] = args42[i_args + 1] + (((i + j) + args42[i_args + 2]) % args42[i_args + 3]) * args42[i_args + 4];
+                         offsets2[j] = args42[i_args + 5] + (((i + j) + args42[i_args + 6]) % args42[i_args + 7]) * numpols;
+                    }
+                    Goldilocks::mul_avx(tmp1[args42[i_args]], &params.pols[0], &params.pConstPols2ns->getElement(0, 0), offsets1, offsets2);
+                    i_args += 8;
+                    }
+                    profileCycles[90] += __rdtsc() - profileStart;
+                    profileCalls[90]++;
+                    break;
+               }
+               case 91:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], &params.pConstPols2ns->getElement(args42[i_args + 3], i), args42[i_args + 2], numpols);
+                    i_args += 4;
+                    }
+                    profileCycles[91] += __rdtsc() - profileStart;
+                    profileCalls[91]++;
+                    break;
+               }
+               case 92:
+               {
+                    uint64_t profileStart = __rdtsc();
+                    {
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], &params.pConstPols2ns->getElement(args42[i_args + 1], i), numpols, tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    }
+                    profileCycles[92] += __rdtsc() - profileStart;
+                    profileCalls[92]++;
+                    break;
+               }
+               default:
+                    std::cout
+                        << " Wrong operation in step42ns_first!"
+                        << std::endl;
+                    exit(1); // rick, use execption
+               }
+          }
+          assert(i_args == NARGS_);
+          // delete (tmp1);
+          // delete (tmp3);
+     }
+
+     uint64_t profileTotal = 0;
+     for (uint64_t op = 0; op < 93; op++) profileTotal += profileCycles[op];
+     zklog.info("ZkevmSteps::step42ns_parser_first_avx_profile() rows=" + to_string(profileRows) + " ops=" + to_string(NOPS_) + " cycles=" + to_string(profileTotal) + " per op type, sorted by cycles:");
+     vector<pair<uint64_t, uint64_t>> profileSorted;
+     for (uint64_t op = 0; op < 93; op++) if (profileCalls[op] > 0) profileSorted.push_back(pair<uint64_t, uint64_t>(profileCycles[op], op));
+     sort(profileSorted.rbegin(), profileSorted.rend());
+     for (uint64_t i = 0; i < profileSorted.size(); i++)
+     {
+          uint64_t op = profileSorted[i].second;
+          zklog.info("    op=" + to_string(op) + " calls=" + to_string(profileCalls[op]) + " cycles=" + to_string(profileCycles[op]) + " cycles/call=" + to_string(double(profileCycles[op])/profileCalls[op]) + " share=" + to_string(double(profileCycles[op])*100/(profileTotal == 0 ? 1 : profileTotal)) + "%");
+     }
+}
+
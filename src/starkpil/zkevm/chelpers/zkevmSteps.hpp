@@ -42,6 +42,8 @@ public:
     void step42ns_parser_first(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
     void step42ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
     void step42ns_parser_first_avx_jump(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step42ns_parser_first_avx_fused(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step42ns_parser_first_avx_profile(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
 #ifdef __AVX512__
     void step42ns_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
 #endif
@@ -21,6 +21,7 @@ using json = nlohmann::json;
 #include "commit_pols_starks.hpp"
 #include "zklog.hpp"
 #include "exit_process.hpp"
+#include "zkin.hpp"
 
 using namespace std;
 
@@ -257,6 +258,66 @@ namespace Circom
     }
   }
 
+  void loadZkin(Circom_CalcWit *ctx, const Zkin &zkin)
+  {
+    if (zkin.signals.size() == 0)
+    {
+      ctx->tryRunCircuit();
+    }
+    for (uint64_t s = 0; s < zkin.signals.size(); s++)
+    {
+      const ZkinSignal &signal = zkin.signals[s];
+      if (signal.nLimbs != FrG_N64)
+      {
+        std::ostringstream errStrStream;
+        errStrStream << "Error loading signal " << signal.name << ": Invalid number of limbs " << signal.nLimbs << "\n";
+        throw std::runtime_error(errStrStream.str());
+      }
+      u64 h = fnv1a(signal.name);
+      uint signalSize = ctx->getInputSignalSize(h);
+      if (signal.size() < signalSize)
+      {
+        std::ostringstream errStrStream;
+        errStrStream << "Error loading signal " << signal.name << ": Not enough values\n";
+        throw std::runtime_error(errStrStream.str());
+      }
+      if (signal.size() > signalSize)
+      {
+        std::ostringstream errStrStream;
+        errStrStream << "Error loading signal " << signal.name << ": Too many values\n";
+        throw std::runtime_error(errStrStream.str());
+      }
+      for (uint i = 0; i < signal.size(); i++)
+      {
+        // Same element FrG_str2element() would build from the decimal string of the value
+        FrGElement v;
+        uint64_t value = signal.values[i];
+        if (value <= INT32_MAX)
+        {
+          v.type = FrG_SHORT;
+          v.shortVal = value;
+        }
+        else
+        {
+          v.type = FrG_LONG;
+          v.shortVal = 0;
+          v.longVal[0] = value;
+        }
+        try
+        {
+          ctx->setInputSignal(h, i, v);
+        }
+        catch (std::runtime_error &e)
+        {
+          std::ostringstream errStrStream;
+          errStrStream << "Error setting signal: " << signal.name << "\n"
+                       << e.what();
+          throw std::runtime_error(errStrStream.str());
+        }
+      }
+    }
+  }
+
   void writeBinWitness(Circom_CalcWit *ctx, std::string wtnsFileName)
   {
     FILE *write_ptr;
@@ -315,26 +376,10 @@ namespace Circom
     inStream.close();
     loadJsonImpl(ctx, j);
   }
-  
-  void getCommitedPols(CommitPolsStarks *commitPols, const std::string zkevmVerifier, const std::string execFile, nlohmann::json &zkin, uint64_t N, uint64_t nCols)
-  {
-    //-------------------------------------------
-    // Verifier stark proof
-    //-------------------------------------------
-    TimerStart(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_ZKEVM);
-    Circom_Circuit *circuit = loadCircuit(zkevmVerifier);
-    TimerStopAndLog(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_ZKEVM);
-    TimerStart(CIRCOM_LOAD_JSON_BATCH_PROOF);
-    Circom_CalcWit *ctx = new Circom_CalcWit(circuit);
 
-    loadJsonImpl(ctx, zkin);
-    if (ctx->getRemaingInputsToBeSet() != 0)
-    {
-      zklog.error("Prover::genBatchProof() Not all inputs have been set. Only " + to_string(get_main_input_signal_no() - ctx->getRemaingInputsToBeSet()) + " out of " + to_string(get_main_input_signal_no()));
-      exitProcess();
-    }
-    TimerStopAndLog(CIRCOM_LOAD_JSON_BATCH_PROOF);
-    //-------------------------------------------
+  // Computes the witness of the loaded inputs and maps it to the committed polynomials; it deletes ctx
+  void calcCommitedPols(Circom_CalcWit *ctx, CommitPolsStarks *commitPols, const std::string execFile, uint64_t N, uint64_t nCols)
+  {    //-------------------------------------------
     // Compute witness and commited pols
     //-------------------------------------------
     TimerStart(STARK_WITNESS_AND_COMMITED_POLS_BATCH_PROOF);
@@ -392,8 +437,50 @@ namespace Circom
       }
     }
     delete[] tmp;
-    freeCircuit(circuit);
     TimerStopAndLog(STARK_WITNESS_AND_COMMITED_POLS_BATCH_PROOF);
   }
 
+  void getCommitedPols(CommitPolsStarks *commitPols, const std::string zkevmVerifier, const std::string execFile, nlohmann::json &zkin, uint64_t N, uint64_t nCols)
+  {
+    //-------------------------------------------
+    // Verifier stark proof
+    //-------------------------------------------
+    TimerStart(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_ZKEVM);
+    Circom_Circuit *circuit = loadCircuit(zkevmVerifier);
+    TimerStopAndLog(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_ZKEVM);
+    TimerStart(CIRCOM_LOAD_JSON_BATCH_PROOF);
+    Circom_CalcWit *ctx = new Circom_CalcWit(circuit);
+
+    loadJsonImpl(ctx, zkin);
+    if (ctx->getRemaingInputsToBeSet() != 0)
+    {
+      zklog.error("Prover::genBatchProof() Not all inputs have been set. Only " + to_string(get_main_input_signal_no() - ctx->getRemaingInputsToBeSet()) + " out of " + to_string(get_main_input_signal_no()));
+      exitProcess();
+    }
+    TimerStopAndLog(CIRCOM_LOAD_JSON_BATCH_PROOF);
+
+    calcCommitedPols(ctx, commitPols, execFile, N, nCols);
+    freeCircuit(circuit);
+  }
+
+  void getCommitedPols(CommitPolsStarks *commitPols, const std::string zkevmVerifier, const std::string execFile, const Zkin &zkin, uint64_t N, uint64_t nCols)
+  {
+    TimerStart(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_ZKEVM);
+    Circom_Circuit *circuit = loadCircuit(zkevmVerifier);
+    TimerStopAndLog(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_ZKEVM);
+    TimerStart(CIRCOM_LOAD_ZKIN_BATCH_PROOF);
+    Circom_CalcWit *ctx = new Circom_CalcWit(circuit);
+
+    loadZkin(ctx, zkin);
+    if (ctx->getRemaingInputsToBeSet() != 0)
+    {
+      zklog.error("Prover::genBatchProof() Not all inputs have been set. Only " + to_string(get_main_input_signal_no() - ctx->getRemaingInputsToBeSet()) + " out of " + to_string(get_main_input_signal_no()));
+      exitProcess();
+    }
+    TimerStopAndLog(CIRCOM_LOAD_ZKIN_BATCH_PROOF);
+
+    calcCommitedPols(ctx, commitPols, execFile, N, nCols);
+    freeCircuit(circuit);
+  }
+
 }
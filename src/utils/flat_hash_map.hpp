@@ -0,0 +1,305 @@
+#ifndef FLAT_HASH_MAP_HPP
+#define FLAT_HASH_MAP_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include "zklog.hpp"
+#include "exit_process.hpp"
+
+using namespace std;
+
+// Hash of integer keys, e.g. memory addresses or hash IDs, which are usually consecutive
+struct FlatHashU64
+{
+    uint64_t operator() (uint64_t key) const
+    {
+        uint64_t h = key * 0x9E3779B97F4A7C15ULL;
+        return h ^ (h >> 32);
+    }
+};
+
+/*
+    Flat open addressing hash table, using linear probing and backward shift deletion (no tombstones).
+    A separate control byte array stores 7 bits of every slot hash, so that most probes of non-matching
+    slots never touch the (bigger) slot array.
+    Elements are stored as pair<K, T>, so iterators expose first and second as std maps do, and find()
+    returns end() if the key is not present; findValue() returns a pointer to the value, or NULL.
+    Iterators and references are invalidated by any insertion that causes a rehash, and by erase.
+    clear() keeps the allocated capacity, so a map can be reused without allocating it again.
+    H must return a 64-bit hash of the key.
+*/
+
+template <typename K, typename T, typename H>
+class FlatHashMap
+{
+public:
+    typedef pair<K, T> value_type;
+
+private:
+    static const uint64_t minCapacity = 16;
+
+    value_type * slots;
+    uint8_t * control; // 0 = empty slot, otherwise 0x80 | 7 bits of the key hash
+    uint64_t capacity; // Always a power of 2, or 0
+    uint64_t mask;
+    uint64_t count;
+    uint64_t allocations; // Number of times the slots were (re)allocated
+    H hasher;
+
+    static inline uint8_t controlByte (uint64_t h) { return 0x80 | (uint8_t)(h >> 57); };
+
+    // Returns the slot index where key is, or the empty slot where it should be inserted
+    inline uint64_t probe (const K &key, uint64_t h, bool &found) const
+    {
+        uint8_t c = controlByte(h);
+        uint64_t i = h & mask;
+        while (true)
+        {
+            if (control[i] == 0)
+            {
+                found = false;
+                return i;
+            }
+            if ((control[i] == c) && (slots[i].first == key))
+            {
+                found = true;
+                return i;
+            }
+            i = (i + 1) & mask;
+        }
+    }
+
+    void rehash (uint64_t newCapacity)
+    {
+        value_type * oldSlots = slots;
+        uint8_t * oldControl = control;
+        uint64_t oldCapacity = capacity;
+
+        slots = new value_type[newCapacity];
+        control = new uint8_t[newCapacity];
+        if ((slots == NULL) || (control == NULL))
+        {
+            zklog.error("FlatHashMap::rehash() failed allocating capacity=" + to_string(newCapacity));
+            exitProcess();
+        }
+        memset(control, 0, newCapacity);
+        capacity = newCapacity;
+        mask = newCapacity - 1;
+        allocations++;
+
+        for (uint64_t i=0; i<oldCapacity; i++)
+        {
+            if (oldControl[i] != 0)
+            {
+                uint64_t h = hasher(oldSlots[i].first);
+                bool found;
+                uint64_t j = probe(oldSlots[i].first, h, found);
+                control[j] = oldControl[i];
+                slots[j] = std::move(oldSlots[i]);
+            }
+        }
+
+        if (oldSlots != NULL) delete[] oldSlots;
+        if (oldControl != NULL) delete[] oldControl;
+    }
+
+    // Make room for one more element, keeping the load factor under 7/8
+    inline void grow (void)
+    {
+        if ((count + 1)*8 > capacity*7)
+        {
+            rehash(capacity == 0 ? minCapacity : capacity*2);
+        }
+    }
+
+public:
+
+    class iterator
+    {
+    private:
+        const FlatHashMap * pMap;
+        uint64_t i;
+        void skip (void) { while ((i < pMap->capacity) && (pMap->control[i] == 0)) i++; };
+    public:
+        iterator () : pMap(NULL), i(0) {};
+        iterator (const FlatHashMap * pMap, uint64_t i, bool bSkip = true) : pMap(pMap), i(i) { if (bSkip) skip(); };
+        value_type & operator* (void) const { return pMap->slots[i]; };
+        value_type * operator-> (void) const { return &pMap->slots[i]; };
+        iterator & operator++ (void) { i++; skip(); return *this; };
+        iterator operator++ (int) { iterator aux = *this; i++; skip(); return aux; };
+        bool operator== (const iterator &other) const { return i == other.i; };
+        bool operator!= (const iterator &other) const { return i != other.i; };
+    };
+    typedef iterator const_iterator;
+
+    FlatHashMap () : slots(NULL), control(NULL), capacity(0), mask(0), count(0), allocations(0) {};
+
+    FlatHashMap (const FlatHashMap &other) : slots(NULL), control(NULL), capacity(0), mask(0), count(0), allocations(0)
+    {
+        *this = other;
+    }
+
+    FlatHashMap (FlatHashMap &&other) noexcept : slots(other.slots), control(other.control), capacity(other.capacity), mask(other.mask), count(other.count), allocations(other.allocations)
+    {
+        other.slots = NULL;
+        other.control = NULL;
+        other.capacity = other.mask = other.count = 0;
+    }
+
+    FlatHashMap & operator= (FlatHashMap &&other) noexcept
+    {
+        if (this == &other) return *this;
+        if (slots != NULL) delete[] slots;
+        if (control != NULL) delete[] control;
+        slots = other.slots;
+        control = other.control;
+        capacity = other.capacity;
+        mask = other.mask;
+        count = other.count;
+        allocations = other.allocations;
+        other.slots = NULL;
+        other.control = NULL;
+        other.capacity = other.mask = other.count = 0;
+        return *this;
+    }
+
+    FlatHashMap & operator= (const FlatHashMap &other)
+    {
+        if (this == &other) return *this;
+        clear();
+        reserve(other.count);
+        for (iterator it = other.begin(); it != other.end(); it++)
+        {
+            insert(it->first, it->second);
+        }
+        return *this;
+    }
+
+    ~FlatHashMap ()
+    {
+        if (slots != NULL) delete[] slots;
+        if (control != NULL) delete[] control;
+    }
+
+    iterator begin (void) const { return iterator(this, 0); };
+    iterator end (void) const { return iterator(this, capacity, false); };
+    uint64_t size (void) const { return count; };
+    bool empty (void) const { return count == 0; };
+    uint64_t getCapacity (void) const { return capacity; };
+    uint64_t getAllocations (void) const { return allocations; };
+
+    // Makes sure that n elements fit without rehashing
+    void reserve (uint64_t n)
+    {
+        uint64_t newCapacity = capacity == 0 ? minCapacity : capacity;
+        while (n*8 > newCapacity*7) newCapacity *= 2;
+        if (newCapacity != capacity) rehash(newCapacity);
+    }
+
+    // Removes all elements, keeping the allocated capacity
+    void clear (void)
+    {
+        if (count == 0) return;
+        for (uint64_t i=0; i<capacity; i++)
+        {
+            if (control[i] != 0)
+            {
+                slots[i].second = T();
+                control[i] = 0;
+            }
+        }
+        count = 0;
+    }
+
+    // Returns an iterator to the element with this key, or end() if not found
+    iterator find (const K &key) const
+    {
+        if (count == 0) return end();
+        bool found;
+        uint64_t i = probe(key, hasher(key), found);
+        return found ? iterator(this, i, false) : end();
+    }
+
+    // Returns a pointer to the value of this key, or NULL if not found
+    T * findValue (const K &key) const
+    {
+        if (count == 0) return NULL;
+        bool found;
+        uint64_t i = probe(key, hasher(key), found);
+        return found ? &slots[i].second : NULL;
+    }
+
+    // Inserts the key-value pair if the key is not present; returns true if inserted
+    bool insert (const K &key, const T &value)
+    {
+        grow();
+        uint64_t h = hasher(key);
+        bool found;
+        uint64_t i = probe(key, h, found);
+        if (found) return false;
+        control[i] = controlByte(h);
+        slots[i].first = key;
+        slots[i].second = value;
+        count++;
+        return true;
+    }
+
+    // Returns a reference to the value of this key, default-inserting it if not present
+    T & operator[] (const K &key)
+    {
+        grow();
+        uint64_t h = hasher(key);
+        bool found;
+        uint64_t i = probe(key, h, found);
+        if (!found)
+        {
+            control[i] = controlByte(h);
+            slots[i].first = key;
+            count++;
+        }
+        return slots[i].second;
+    }
+
+    // Removes this key, shifting back the following elements of the probe sequence; returns true if found
+    bool erase (const K &key)
+    {
+        if (count == 0) return false;
+        bool found;
+        uint64_t i = probe(key, hasher(key), found);
+        if (!found) return false;
+
+        uint64_t j = i;
+        while (true)
+        {
+            j = (j + 1) & mask;
+            if (control[j] == 0) break;
+
+            // Move element j to the hole i only if its home position is not in the cyclic range (i, j]
+            uint64_t home = hasher(slots[j].first) & mask;
+            bool inRange = (i <= j) ? ((home > i) && (home <= j)) : ((home > i) || (home <= j));
+            if (inRange) continue;
+
+            control[i] = control[j];
+            slots[i] = std::move(slots[j]);
+            i = j;
+        }
+        control[i] = 0;
+        slots[i].second = T();
+        count--;
+        return true;
+    }
+
+    // Inserts all elements of other which are not present in this map, and clears other
+    void merge (FlatHashMap &other)
+    {
+        reserve(count + other.count);
+        for (iterator it = other.begin(); it != other.end(); it++)
+        {
+            insert(it->first, it->second);
+        }
+        other.clear();
+    }
+};
+
+#endif
@@ -61,33 +61,38 @@ void splitKey6 (Goldilocks &fr, const uint64_t key, uint8_t (&_result)[11])
     }
 }
 
+uint64_t getKeyBits9 (const string &baString, const uint64_t bit)
+{
+    uint64_t size = baString.size();
+
+    // Calculate the byte and bit of the first part
+    uint64_t firstByte = bit >> 3;
+    uint64_t firstByteBit = bit & 7;
+    uint8_t resultByte = (uint8_t)baString[firstByte];
+    resultByte = resultByte << firstByteBit;
+    uint64_t resultPart = uint64_t(resultByte);
+    resultPart = resultPart << 1;
+
+    // If this is not the end of the byte array, consume the rest of bits of the next byte
+    if ((firstByte + 1) < size)
+    {
+        resultByte = (uint8_t)baString[firstByte + 1];
+        resultByte = resultByte >> (7 - firstByteBit);
+        resultPart |= uint64_t(resultByte);
+    }
+
+    return resultPart;
+}
+
 void splitKey9 (const string &baString, vector<uint64_t> &result)
 {
     // Calculate the total number of bits to read
-    uint64_t size = baString.size();
-    uint64_t numberOfBits = size << 3;
+    uint64_t numberOfBits = baString.size() << 3;
     
     // Split them in chunks of 9 bits
     for (uint64_t i = 0; i < numberOfBits; i += 9)
     {
-        // Calculate the byte and bit of the first part
-        uint64_t firstByte = i >> 3;
-        uint64_t firstByteBit = i & 7;
-        uint8_t resultByte = (uint8_t)baString[firstByte];
-        resultByte = resultByte << firstByteBit;
-        uint64_t resultPart = uint64_t(resultByte);
-        resultPart = resultPart << 1;
-
-        // If this is not the end of the byte array, consume the rest of bits of the next byte
-        if ((firstByte + 1) < size)
-        {
-            resultByte = (uint8_t)baString[firstByte + 1];
-            resultByte = resultByte >> (7 - firstByteBit);
-            resultPart |= uint64_t(resultByte);
-        }
-
-        // Add to the result
-        result.emplace_back((uint64_t)resultPart);
+        result.emplace_back(getKeyBits9(baString, i));
     }
 }
 
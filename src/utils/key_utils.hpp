@@ -15,6 +15,9 @@ void splitKey6 (Goldilocks &fr, const Goldilocks::Element (&key)[4], uint8_t (&r
 // Get 64 key bits, in sets of 6 bits
 void splitKey6 (Goldilocks &fr, const uint64_t key, uint8_t (&result)[11]);
 
+// Get the set of 9 bits of a generic-size key that starts at a bit position
+uint64_t getKeyBits9 (const string &baString, const uint64_t bit);
+
 // Split a generic-size key, in sets of 9 bits
 void splitKey9 (const string &baString, vector<uint64_t> &result);
 
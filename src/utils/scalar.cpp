@@ -540,12 +540,7 @@ void ba2u32 (const uint8_t *pData, uint32_t &n)
 
 void ba2scalar (const uint8_t *pData, uint64_t dataSize, mpz_class &s)
 {
-    s = 0;
-    for (uint64_t i=0; i<dataSize; i++)
-    {
-        s *= ScalarTwoTo8;
-        s += pData[i];
-    }
+    mpz_import(s.get_mpz_t(), dataSize, 1, 1, 0, 0, pData);
 }
 
 /* Scalar to byte array conversion (up to dataSize bytes) */
@@ -626,6 +621,20 @@ string scalar2ba32(const mpz_class &_s)
     return result;
 }
 
+void scalar2ba32(const mpz_class &s, uint8_t *pData)
+{
+    if (mpz_sizeinbase(s.get_mpz_t(), 2) > 256)
+    {
+        zklog.error("scalar2ba32() run out of buffer of 32 bytes");
+        exitProcess();
+    }
+    size_t count = 0;
+    uint8_t aux[32];
+    mpz_export(aux, &count, 1, 1, 0, 0, s.get_mpz_t());
+    memset(pData, 0, 32 - count);
+    memcpy(pData + 32 - count, aux, count);
+}
+
 void scalar2bytes(mpz_class s, uint8_t (&bytes)[32])
 {
     for (uint64_t i=0; i<32; i++)
@@ -443,10 +443,58 @@ inline void ba2fea (Goldilocks &fr, const uint8_t * pData, uint64_t len, Goldilo
     }
 }
 
+/* Byte array of exactly 32 bytes (big endian) to 4 field elements of 64 bits, i.e. as string2fea(fr, ba2string(pData, 32), fea) */
+inline void ba2fea (Goldilocks &fr, const uint8_t * pData, Goldilocks::Element (&fea)[4])
+{
+    for (uint64_t i=0; i<4; i++)
+    {
+        uint64_t aux = 0;
+        for (uint64_t j=0; j<8; j++)
+        {
+            aux = (aux << 8) | pData[i*8 + j];
+        }
+        fr.fromU64(fea[3-i], aux);
+    }
+}
+
+/* 4 field elements of 64 bits to byte array of exactly 32 bytes (big endian), i.e. as string2ba(fea2string(fr, fea)) */
+inline void fea2ba (Goldilocks &fr, uint8_t * pData, const Goldilocks::Element (&fea)[4])
+{
+    for (uint64_t i=0; i<4; i++)
+    {
+        uint64_t aux = fr.toU64(fea[3-i]);
+        for (uint64_t j=0; j<8; j++)
+        {
+            pData[i*8 + j] = (uint8_t)(aux >> (56 - j*8));
+        }
+    }
+}
+
+/* Field element array to byte array of exactly 32 bytes (big endian), without going through a scalar */
+inline bool fea2ba (Goldilocks &fr, uint8_t * pData, const Goldilocks::Element &fe0, const Goldilocks::Element &fe1, const Goldilocks::Element &fe2, const Goldilocks::Element &fe3, const Goldilocks::Element &fe4, const Goldilocks::Element &fe5, const Goldilocks::Element &fe6, const Goldilocks::Element &fe7)
+{
+    const Goldilocks::Element * fea[8] = { &fe7, &fe6, &fe5, &fe4, &fe3, &fe2, &fe1, &fe0 };
+    for (uint64_t i=0; i<8; i++)
+    {
+        uint64_t aux = fr.toU64(*fea[i]);
+        if (aux >= 0x100000000)
+        {
+            zklog.error("fea2ba() found element " + to_string(7-i) + " has a too high value=" + fr.toString(*fea[i], 16));
+            return false;
+        }
+        pData[i*4] = (uint8_t)(aux >> 24);
+        pData[i*4 + 1] = (uint8_t)(aux >> 16);
+        pData[i*4 + 2] = (uint8_t)(aux >> 8);
+        pData[i*4 + 3] = (uint8_t)aux;
+    }
+    return true;
+}
+
 /* Scalar to byte array conversion (up to dataSize bytes) */
 void scalar2ba(uint8_t *pData, uint64_t &dataSize, mpz_class s);
 void scalar2ba16(uint64_t *pData, uint64_t &dataSize, mpz_class s);
 string scalar2ba32(const mpz_class &s); // Returns exactly 32 bytes
+void scalar2ba32(const mpz_class &s, uint8_t *pData); // pData must be a 32-bytes array; big-endian, left-padded with zeros
 void scalar2bytes(mpz_class s, uint8_t (&bytes)[32]);
 void scalar2bytesBE(mpz_class s, uint8_t *pBytes); // pBytes must be a 32-bytes array
 
@@ -0,0 +1,220 @@
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <errno.h>
+#include <string.h>
+#include "shared_memory.hpp"
+#include "zklog.hpp"
+#include "exit_process.hpp"
+#include "timer.hpp"
+
+#define SHARED_MEMORY_HUGE_PAGE_SIZE (2*1024*1024)
+
+SharedMemorySegment::SharedMemorySegment (const string &name, const string &hugePagesPath, uint64_t dataSize, const uint64_t (&signature)[SHARED_MEMORY_SIGNATURE_SIZE]) :
+    name(name),
+    bHugePages(hugePagesPath.size() > 0),
+    dataSize(dataSize),
+    pAddress(NULL),
+    bLoader(false),
+    fd(-1)
+{
+    for (uint64_t i=0; i<SHARED_MEMORY_SIGNATURE_SIZE; i++)
+    {
+        this->signature[i] = signature[i];
+    }
+
+    // Huge page files can only be mapped in multiples of the huge page size
+    mappedSize = SHARED_MEMORY_HEADER_SIZE + dataSize;
+    mappedSize = ((mappedSize + SHARED_MEMORY_HUGE_PAGE_SIZE - 1) / SHARED_MEMORY_HUGE_PAGE_SIZE) * SHARED_MEMORY_HUGE_PAGE_SIZE;
+
+    // Try to create the segment; if it already exists, attach to it
+    if (bHugePages)
+    {
+        fileName = hugePagesPath + "/" + name;
+        fd = open(fileName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if ((fd < 0) && (errno == EEXIST))
+        {
+            fd = open(fileName.c_str(), O_RDONLY);
+        }
+        else
+        {
+            bLoader = (fd >= 0);
+        }
+    }
+    else
+    {
+        fileName = "/dev/shm/" + name;
+        fd = shm_open(("/" + name).c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if ((fd < 0) && (errno == EEXIST))
+        {
+            fd = shm_open(("/" + name).c_str(), O_RDONLY, 0);
+        }
+        else
+        {
+            bLoader = (fd >= 0);
+        }
+    }
+    if (fd < 0)
+    {
+        zklog.error("SharedMemorySegment::SharedMemorySegment() failed opening segment " + fileName + " errno=" + to_string(errno) + "=" + strerror(errno));
+        exitProcess();
+    }
+
+    if (bLoader)
+    {
+        // Lock the segment before publishing the loading state, so that a waiting process that sees the
+        // loading state and gets the lock knows that the loader died
+        if (flock(fd, LOCK_EX) != 0)
+        {
+            zklog.error("SharedMemorySegment::SharedMemorySegment() failed calling flock() of segment " + fileName + " errno=" + to_string(errno) + "=" + strerror(errno));
+            close(fd);
+            exitProcess();
+        }
+        if (ftruncate(fd, mappedSize) != 0)
+        {
+            zklog.error("SharedMemorySegment::SharedMemorySegment() failed calling ftruncate() of segment " + fileName + " size=" + to_string(mappedSize) + " errno=" + to_string(errno) + "=" + strerror(errno));
+            close(fd);
+            exitProcess();
+        }
+    }
+    else
+    {
+        // The loader could still be setting the size
+        struct stat sb;
+        for (uint64_t i=0; i<100; i++)
+        {
+            if ((fstat(fd, &sb) == 0) && ((uint64_t)sb.st_size >= mappedSize))
+            {
+                break;
+            }
+            usleep(10000);
+        }
+        if ((uint64_t)sb.st_size != mappedSize)
+        {
+            zklog.error("SharedMemorySegment::SharedMemorySegment() found segment " + fileName + " with size=" + to_string(sb.st_size) + " instead of " + to_string(mappedSize) + "; remove it if it was created with a different configuration");
+            close(fd);
+            exitProcess();
+        }
+    }
+
+    pAddress = (uint8_t *)mmap(NULL, mappedSize, bLoader ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED | (bLoader ? MAP_POPULATE : 0), fd, 0);
+    if (pAddress == MAP_FAILED)
+    {
+        pAddress = NULL;
+        close(fd);
+        zklog.error("SharedMemorySegment::SharedMemorySegment() failed calling mmap() of segment " + fileName + " size=" + to_string(mappedSize) + " errno=" + to_string(errno) + "=" + strerror(errno));
+        exitProcess();
+    }
+
+    if (bLoader)
+    {
+        SharedMemoryHeader &h = header();
+        h.magic = SHARED_MEMORY_MAGIC;
+        h.loaderPid = getpid();
+        h.dataSize = dataSize;
+        for (uint64_t i=0; i<SHARED_MEMORY_SIGNATURE_SIZE; i++)
+        {
+            h.signature[i] = signature[i];
+        }
+        __atomic_store_n(&h.state, SHARED_MEMORY_STATE_LOADING, __ATOMIC_RELEASE);
+        zklog.info("SharedMemorySegment::SharedMemorySegment() created segment " + fileName + " size=" + to_string(mappedSize) + " hugePages=" + to_string(bHugePages));
+    }
+    else
+    {
+        zklog.info("SharedMemorySegment::SharedMemorySegment() attached to segment " + fileName + " size=" + to_string(mappedSize));
+    }
+}
+
+SharedMemorySegment::~SharedMemorySegment ()
+{
+    // The segment is not removed, so that the next processes attach to it instead of loading it again
+    if (pAddress != NULL)
+    {
+        munmap(pAddress, mappedSize);
+    }
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+}
+
+void SharedMemorySegment::setReady (void)
+{
+    if (!bLoader)
+    {
+        zklog.error("SharedMemorySegment::setReady() called by a process that is not the loader of segment " + fileName);
+        exitProcess();
+    }
+    __atomic_store_n(&header().state, SHARED_MEMORY_STATE_READY, __ATOMIC_RELEASE);
+
+    // Closing the file releases the lock
+    close(fd);
+    fd = -1;
+
+    if (mprotect(pAddress, mappedSize, PROT_READ) != 0)
+    {
+        zklog.warning("SharedMemorySegment::setReady() failed calling mprotect() of segment " + fileName + " errno=" + to_string(errno) + "=" + strerror(errno));
+    }
+    zklog.info("SharedMemorySegment::setReady() segment " + fileName + " is ready");
+}
+
+void SharedMemorySegment::waitReady (uint64_t timeoutSeconds)
+{
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    while (__atomic_load_n(&header().state, __ATOMIC_ACQUIRE) != SHARED_MEMORY_STATE_READY)
+    {
+        // The loader holds the lock from before the loading state is published until the segment is ready,
+        // so getting the lock while the state is still loading means that the loader died
+        uint64_t state = __atomic_load_n(&header().state, __ATOMIC_ACQUIRE);
+        if ((state == SHARED_MEMORY_STATE_LOADING) && (flock(fd, LOCK_SH | LOCK_NB) == 0))
+        {
+            flock(fd, LOCK_UN);
+            state = __atomic_load_n(&header().state, __ATOMIC_ACQUIRE);
+            if (state == SHARED_MEMORY_STATE_LOADING)
+            {
+                zklog.error("SharedMemorySegment::waitReady() found that the loader pid=" + to_string(header().loaderPid) + " of segment " + fileName + " died before completing it; remove the segment");
+                exitProcess();
+            }
+            continue;
+        }
+        if (TimeDiff(t) > timeoutSeconds*1000000)
+        {
+            zklog.error("SharedMemorySegment::waitReady() timed out after " + to_string(timeoutSeconds) + " seconds waiting for segment " + fileName + " state=" + to_string(state));
+            exitProcess();
+        }
+        usleep(100000);
+    }
+
+    close(fd);
+    fd = -1;
+
+    // The header can be checked once the loader has written it
+    SharedMemoryHeader &h = header();
+    bool bSignatureMatches = true;
+    for (uint64_t i=0; i<SHARED_MEMORY_SIGNATURE_SIZE; i++)
+    {
+        bSignatureMatches = bSignatureMatches && (h.signature[i] == signature[i]);
+    }
+    if ((h.magic != SHARED_MEMORY_MAGIC) || (h.dataSize != dataSize) || !bSignatureMatches)
+    {
+        zklog.error("SharedMemorySegment::waitReady() found segment " + fileName + " with a different content; remove it if its files have changed");
+        exitProcess();
+    }
+    zklog.info("SharedMemorySegment::waitReady() segment " + fileName + " loaded by pid=" + to_string(h.loaderPid) + " is ready after " + to_string(TimeDiff(t)/1000) + " ms");
+}
+
+string sharedMemoryName (const string &fileName)
+{
+    size_t pos = fileName.find_last_of('/');
+    string baseName = (pos == string::npos) ? fileName : fileName.substr(pos + 1);
+    string name = "zkprover_";
+    for (uint64_t i=0; i<baseName.size(); i++)
+    {
+        char c = baseName[i];
+        name += (isalnum(c) || (c == '.') || (c == '_') || (c == '-')) ? c : '_';
+    }
+    return name;
+}
@@ -0,0 +1,74 @@
+#ifndef SHARED_MEMORY_HPP
+#define SHARED_MEMORY_HPP
+
+#include <string>
+#include <cstdint>
+
+using namespace std;
+
+#define SHARED_MEMORY_MAGIC 0x5A4B5348415245ULL // "ZKSHARE"
+#define SHARED_MEMORY_HEADER_SIZE (2*1024*1024) // One huge page, so that the data is huge page aligned
+#define SHARED_MEMORY_SIGNATURE_SIZE 8
+
+#define SHARED_MEMORY_STATE_LOADING 1
+#define SHARED_MEMORY_STATE_READY 2
+
+// Header stored at the beginning of the segment
+class SharedMemoryHeader
+{
+public:
+    uint64_t magic;
+    uint64_t state; // SHARED_MEMORY_STATE_*, written by the loader process
+    uint64_t loaderPid; // Informative only; the loader is known to be alive while it holds the segment lock
+    uint64_t dataSize;
+    uint64_t signature[SHARED_MEMORY_SIGNATURE_SIZE]; // Identifies the content, e.g. sizes and dates of the source files
+};
+
+/*
+    Named memory segment shared by all the processes of the host, that survives them until it is
+    removed or the host reboots.  The first process that opens it creates it and becomes the loader:
+    it must fill getData() and call setReady(); the rest of processes attach to it read-only and wait
+    for the loader in waitReady().
+    The loader holds an exclusive flock() of the segment file until it is ready; the kernel releases it
+    when the loader dies, so the waiting processes can tell a dead loader from a slow one, even across
+    pid namespaces.
+    If hugePagesPath is not empty, the segment is a file of that hugetlbfs mount point (e.g.
+    /dev/hugepages); otherwise it is a POSIX shared memory object (i.e. /dev/shm/<name>).
+    A segment with a different size or signature, e.g. created from a previous version of the files,
+    is reported as an error, and must be removed manually.
+*/
+
+class SharedMemorySegment
+{
+private:
+    string name;
+    string fileName;
+    bool bHugePages;
+    uint64_t dataSize;
+    uint64_t mappedSize;
+    uint64_t signature[SHARED_MEMORY_SIGNATURE_SIZE];
+    uint8_t * pAddress;
+    bool bLoader;
+    int fd; // Kept open until the segment is ready, to hold or check its lock
+
+    SharedMemoryHeader & header (void) const { return *(SharedMemoryHeader *)pAddress; };
+
+public:
+    SharedMemorySegment (const string &name, const string &hugePagesPath, uint64_t dataSize, const uint64_t (&signature)[SHARED_MEMORY_SIGNATURE_SIZE]);
+    ~SharedMemorySegment ();
+
+    bool isLoader (void) const { return bLoader; };
+    uint8_t * getData (void) const { return pAddress + SHARED_MEMORY_HEADER_SIZE; };
+    uint64_t getDataSize (void) const { return dataSize; };
+
+    // Loader: makes the data read-only and available to the other processes
+    void setReady (void);
+
+    // Other processes: waits until the loader calls setReady(), and checks that the content has the expected signature
+    void waitReady (uint64_t timeoutSeconds);
+};
+
+// Returns a valid segment name based on a file name, e.g. "config/zkevm.const" -> "zkprover_zkevm.const"
+string sharedMemoryName (const string &fileName);
+
+#endif
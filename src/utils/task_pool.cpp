@@ -0,0 +1,192 @@
+#include <unistd.h>
+#include "task_pool.hpp"
+#include "zklog.hpp"
+#include "exit_process.hpp"
+
+// Worker of the current thread, if it belongs to a task pool
+static thread_local TaskPool * pCurrentPool = NULL;
+static thread_local int64_t currentWorkerId = -1;
+
+void * taskPoolWorkerThread (void * arg)
+{
+    TaskPool::Worker * pWorker = (TaskPool::Worker *)arg;
+    TaskPool * pPool = pWorker->pPool;
+    pCurrentPool = pPool;
+    currentWorkerId = pWorker->id;
+
+    while (true)
+    {
+        sem_wait(&pPool->available);
+        if (pPool->bStop)
+        {
+            break;
+        }
+
+        // The semaphore can be ahead of the queued tasks, since wait() executes tasks without consuming it
+        TaskPool::Task task;
+        if (pPool->getTask(pWorker->id, task))
+        {
+            pPool->runTask(task);
+        }
+    }
+
+    return NULL;
+}
+
+TaskPool::TaskPool (uint64_t nThreads) : nextWorker(0), bStop(false)
+{
+    if (nThreads == 0)
+    {
+        zklog.error("TaskPool::TaskPool() called with nThreads=0");
+        exitProcess();
+    }
+
+    sem_init(&available, 0, 0);
+
+    for (uint64_t i=0; i<nThreads; i++)
+    {
+        Worker * pWorker = new Worker();
+        pWorker->pPool = this;
+        pWorker->id = i;
+        pWorker->executed = 0;
+        pWorker->stolen = 0;
+        pthread_mutex_init(&pWorker->mutex, NULL);
+        workers.push_back(pWorker);
+    }
+
+    // Start the threads once all the workers exist, since they steal from each other
+    for (uint64_t i=0; i<nThreads; i++)
+    {
+        pthread_create(&workers[i]->thread, NULL, taskPoolWorkerThread, workers[i]);
+    }
+}
+
+TaskPool::~TaskPool ()
+{
+    bStop = true;
+    for (uint64_t i=0; i<workers.size(); i++)
+    {
+        sem_post(&available);
+    }
+    for (uint64_t i=0; i<workers.size(); i++)
+    {
+        pthread_join(workers[i]->thread, NULL);
+        pthread_mutex_destroy(&workers[i]->mutex);
+        delete workers[i];
+    }
+    sem_destroy(&available);
+}
+
+void TaskPool::submit (TaskGroup &group, TaskFunction function, void * pArg)
+{
+    Task task;
+    task.function = function;
+    task.pArg = pArg;
+    task.pGroup = &group;
+    group.pending++;
+
+    // Tasks submitted by a worker go to its own deque, the rest are distributed round robin
+    Worker * pWorker;
+    if ((pCurrentPool == this) && (currentWorkerId >= 0))
+    {
+        pWorker = workers[currentWorkerId];
+    }
+    else
+    {
+        pWorker = workers[nextWorker++ % workers.size()];
+    }
+
+    pthread_mutex_lock(&pWorker->mutex);
+    pWorker->tasks.push_back(task);
+    pthread_mutex_unlock(&pWorker->mutex);
+
+    sem_post(&available);
+}
+
+bool TaskPool::popTask (uint64_t workerId, Task &task)
+{
+    Worker * pWorker = workers[workerId];
+    pthread_mutex_lock(&pWorker->mutex);
+    if (pWorker->tasks.empty())
+    {
+        pthread_mutex_unlock(&pWorker->mutex);
+        return false;
+    }
+    task = pWorker->tasks.back();
+    pWorker->tasks.pop_back();
+    pthread_mutex_unlock(&pWorker->mutex);
+    return true;
+}
+
+bool TaskPool::stealTask (uint64_t workerId, Task &task)
+{
+    for (uint64_t i=1; i<=workers.size(); i++)
+    {
+        Worker * pVictim = workers[(workerId + i) % workers.size()];
+        pthread_mutex_lock(&pVictim->mutex);
+        if (!pVictim->tasks.empty())
+        {
+            task = pVictim->tasks.front();
+            pVictim->tasks.pop_front();
+            pthread_mutex_unlock(&pVictim->mutex);
+            return true;
+        }
+        pthread_mutex_unlock(&pVictim->mutex);
+    }
+    return false;
+}
+
+// Gets a task from the own deque, or steals one; workerId is -1 for threads that do not belong to this pool
+bool TaskPool::getTask (int64_t workerId, Task &task)
+{
+    if (workerId >= 0)
+    {
+        if (popTask(workerId, task))
+        {
+            workers[workerId]->executed++;
+            return true;
+        }
+        if (stealTask(workerId, task))
+        {
+            workers[workerId]->executed++;
+            workers[workerId]->stolen++;
+            return true;
+        }
+        return false;
+    }
+    return stealTask(nextWorker % workers.size(), task);
+}
+
+void TaskPool::runTask (Task &task)
+{
+    task.function(task.pArg);
+    task.pGroup->pending--;
+}
+
+void TaskPool::wait (TaskGroup &group)
+{
+    int64_t workerId = (pCurrentPool == this) ? currentWorkerId : -1;
+    while (group.pending > 0)
+    {
+        Task task;
+        if (getTask(workerId, task))
+        {
+            runTask(task);
+        }
+        else
+        {
+            // All the pending tasks of the group are being executed by other threads
+            usleep(100);
+        }
+    }
+}
+
+void TaskPool::printStats (void)
+{
+    string s = "TaskPool::printStats() threads=" + to_string(workers.size()) + " executed/stolen per worker:";
+    for (uint64_t i=0; i<workers.size(); i++)
+    {
+        s += " " + to_string(workers[i]->executed) + "/" + to_string(workers[i]->stolen);
+    }
+    zklog.info(s);
+}
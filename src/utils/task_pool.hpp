@@ -0,0 +1,78 @@
+#ifndef TASK_POOL_HPP
+#define TASK_POOL_HPP
+
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <pthread.h>
+#include <semaphore.h>
+
+using namespace std;
+
+// Same signature as a pthread start routine, so that thread functions can be used as tasks
+typedef void * (*TaskFunction) (void * pArg);
+
+// Set of submitted tasks that can be waited for
+class TaskGroup
+{
+public:
+    atomic<uint64_t> pending; // Submitted tasks that have not completed yet
+    TaskGroup() : pending(0) {};
+};
+
+/*
+    Work-stealing thread pool.
+    Every worker owns a deque of tasks: tasks submitted from a worker are pushed to the back of its own
+    deque and popped from the back (LIFO, cache friendly); idle workers steal from the front of the
+    other workers' deques (FIFO, i.e. the oldest and usually biggest tasks).  Tasks submitted from
+    outside the pool are distributed round robin.
+    wait() executes pending tasks while the group is not complete, so a task can split its work into
+    subtasks and wait for them without blocking a worker.
+*/
+
+class TaskPool
+{
+private:
+    class Task
+    {
+    public:
+        TaskFunction function;
+        void * pArg;
+        TaskGroup * pGroup;
+    };
+
+    class Worker
+    {
+    public:
+        TaskPool * pPool;
+        uint64_t id;
+        pthread_t thread;
+        pthread_mutex_t mutex; // Mutex to protect the tasks deque
+        deque<Task> tasks;
+        uint64_t executed; // Tasks executed by this worker
+        uint64_t stolen; // Tasks stolen by this worker from other workers
+    };
+
+    vector<Worker *> workers;
+    sem_t available; // Posted once per submitted task, to wake up idle workers
+    atomic<uint64_t> nextWorker; // Round robin for tasks submitted from outside the pool
+    bool bStop;
+
+    bool popTask (uint64_t workerId, Task &task);
+    bool stealTask (uint64_t workerId, Task &task);
+    bool getTask (int64_t workerId, Task &task);
+    void runTask (Task &task);
+
+public:
+    TaskPool (uint64_t nThreads);
+    ~TaskPool ();
+
+    void submit (TaskGroup &group, TaskFunction function, void * pArg);
+    void wait (TaskGroup &group);
+    uint64_t size (void) const { return workers.size(); };
+    void printStats (void);
+
+    friend void * taskPoolWorkerThread (void * arg);
+};
+
+#endif
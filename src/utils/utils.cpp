@@ -282,6 +282,18 @@ uint64_t fileSize (const string &fileName)
     return fileStat.st_size;
 }
 
+uint64_t fileModificationTime (const string &fileName)
+{
+    struct stat fileStat;
+    int iResult = stat( fileName.c_str(), &fileStat);
+    if (iResult != 0)
+    {
+        zklog.error("fileModificationTime() could not find file " + fileName);
+        exitProcess();
+    }
+    return fileStat.st_mtime;
+}
+
 bool fileIsDirectory (const string &fileName)
 {
     struct stat fileStat;
@@ -57,6 +57,9 @@ uint64_t fileSize (const string &fileName);
 // Return if file is a directory
 bool fileIsDirectory (const string &fileName);
 
+// Return file last modification time, in seconds since epoch
+uint64_t fileModificationTime (const string &fileName);
+
 // Ensure directory exists
 void ensureDirectoryExists (const string &fileName);
 
@@ -0,0 +1,173 @@
+#include <random>
+#include <sys/time.h>
+#include "fft_test.hpp"
+#include "alt_bn128.hpp"
+#include "fft.hpp"
+#include "binfile_utils.hpp"
+#include "zkey.hpp"
+#include "zkey_utils.hpp"
+#include "zkey_fflonk.hpp"
+#include "timer.hpp"
+#include "utils.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
+
+#define FFT_TEST_MAX_CHECK_BITS 16
+#define FFT_TEST_DEFAULT_BENCH_MIN_BITS 16
+#define FFT_TEST_DEFAULT_BENCH_MAX_BITS 22
+
+void FFTTestRandom (AltBn128::FrElement *a, uint64_t n, std::mt19937_64 &gen)
+{
+    for (uint64_t i = 0; i < n; i++)
+    {
+        AltBn128::FrElement r;
+        AltBn128::Fr.fromUI(a[i], gen());
+        AltBn128::Fr.fromUI(r, gen());
+        AltBn128::Fr.mul(a[i], a[i], r);
+    }
+}
+
+// Returns the index of the first different element, or n if they are all equal
+uint64_t FFTTestCompare (AltBn128::FrElement *a, AltBn128::FrElement *b, uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++)
+    {
+        if (!AltBn128::Fr.eq(a[i], b[i])) return i;
+    }
+    return n;
+}
+
+// Returns the domain size of the final zkey, or 0 if it is not available
+uint64_t FFTTestZkeyDomainSize (const Config &config)
+{
+    if ((config.finalStarkZkey.size() == 0) || !fileExists(config.finalStarkZkey))
+    {
+        return 0;
+    }
+    std::unique_ptr<BinFileUtils::BinFile> zkey = BinFileUtils::openExisting(config.finalStarkZkey, "zkey", 1);
+    int protocolId = Zkey::getProtocolIdFromZkey(zkey.get());
+    if (protocolId == Zkey::GROTH16_PROTOCOL_ID)
+    {
+        return ZKeyUtils::loadHeader(zkey.get())->domainSize;
+    }
+    if (protocolId == Zkey::FFLONK_PROTOCOL_ID)
+    {
+        Zkey::FflonkZkeyHeader *header = Zkey::FflonkZkeyHeader::loadFflonkZkeyHeader(zkey.get());
+        uint64_t domainSize = header->domainSize;
+        delete header;
+        return domainSize;
+    }
+    return 0;
+}
+
+// Checks that the blocked fft and ifft match the classic ones, for every domain size up to 2^FFT_TEST_MAX_CHECK_BITS,
+// so that the first blocks and every number of levels of the last pass are covered
+uint64_t FFTTestCheck (std::mt19937_64 &gen)
+{
+    uint64_t numberOfFailedTests = 0;
+    uint64_t maxN = (uint64_t)1 << FFT_TEST_MAX_CHECK_BITS;
+    FFT<RawFr> fft(maxN);
+    AltBn128::FrElement *a = new AltBn128::FrElement[maxN];
+    AltBn128::FrElement *b = new AltBn128::FrElement[maxN];
+
+    for (uint64_t bits = 0; bits <= FFT_TEST_MAX_CHECK_BITS; bits++)
+    {
+        uint64_t n = (uint64_t)1 << bits;
+        FFTTestRandom(a, n, gen);
+        memcpy(b, a, n * sizeof(AltBn128::FrElement));
+
+        fft.setBlocked(false);
+        fft.fft(a, n);
+        fft.setBlocked(true);
+        fft.fft(b, n);
+        uint64_t i = FFTTestCompare(a, b, n);
+        if (i != n)
+        {
+            zklog.error("FFTTestCheck() found fft mismatch with n=" + to_string(n) + " at i=" + to_string(i));
+            numberOfFailedTests++;
+        }
+
+        fft.setBlocked(false);
+        fft.ifft(a, n);
+        fft.setBlocked(true);
+        fft.ifft(b, n);
+        i = FFTTestCompare(a, b, n);
+        if (i != n)
+        {
+            zklog.error("FFTTestCheck() found ifft mismatch with n=" + to_string(n) + " at i=" + to_string(i));
+            numberOfFailedTests++;
+        }
+    }
+
+    delete[] a;
+    delete[] b;
+    return numberOfFailedTests;
+}
+
+// Times the classic and the blocked fft of a domain of n elements
+uint64_t FFTTestBenchmark (uint64_t n, std::mt19937_64 &gen)
+{
+    FFT<RawFr> fft(n);
+    AltBn128::FrElement *a = new AltBn128::FrElement[n];
+    AltBn128::FrElement *b = new AltBn128::FrElement[n];
+    FFTTestRandom(a, n, gen);
+    memcpy(b, a, n * sizeof(AltBn128::FrElement));
+
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    fft.setBlocked(false);
+    fft.fft(a, n);
+    uint64_t classicTime = TimeDiff(t);
+
+    gettimeofday(&t, NULL);
+    fft.setBlocked(true);
+    fft.fft(b, n);
+    uint64_t blockedTime = TimeDiff(t);
+
+    uint64_t numberOfFailedTests = 0;
+    if (FFTTestCompare(a, b, n) != n)
+    {
+        zklog.error("FFTTestBenchmark() found mismatch with n=" + to_string(n));
+        numberOfFailedTests++;
+    }
+
+    zklog.info("FFTTestBenchmark() n=2^" + to_string(fft.log2(n)) + " classic=" + to_string(classicTime) + "us blocked=" + to_string(blockedTime) +
+        "us speedup=" + to_string(double(classicTime) / zkmax(blockedTime, (uint64_t)1)));
+
+    delete[] a;
+    delete[] b;
+    return numberOfFailedTests;
+}
+
+uint64_t FFTTest (const Config &config)
+{
+    TimerStart(FFT_TEST);
+
+    uint64_t numberOfFailedTests = 0;
+    std::mt19937_64 gen(0);
+
+    numberOfFailedTests += FFTTestCheck(gen);
+
+    // The provers transform the domain, and the fflonk prover also its 4x extension
+    uint64_t domainSize = FFTTestZkeyDomainSize(config);
+    if (domainSize > 0)
+    {
+        zklog.info("FFTTest() benchmarking the domain sizes of zkey " + config.finalStarkZkey + " domainSize=" + to_string(domainSize));
+        for (uint64_t n = domainSize; n <= 4 * domainSize; n *= 2)
+        {
+            numberOfFailedTests += FFTTestBenchmark(n, gen);
+        }
+    }
+    else
+    {
+        for (uint64_t bits = FFT_TEST_DEFAULT_BENCH_MIN_BITS; bits <= FFT_TEST_DEFAULT_BENCH_MAX_BITS; bits += 2)
+        {
+            numberOfFailedTests += FFTTestBenchmark((uint64_t)1 << bits, gen);
+        }
+    }
+
+    zklog.info("FFTTest() done, numberOfFailedTests=" + to_string(numberOfFailedTests));
+
+    TimerStopAndLog(FFT_TEST);
+    return numberOfFailedTests;
+}
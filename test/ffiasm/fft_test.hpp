@@ -0,0 +1,9 @@
+#ifndef FFT_TEST_HPP
+#define FFT_TEST_HPP
+
+#include <cstdint>
+#include "config.hpp"
+
+uint64_t FFTTest (const Config &config);
+
+#endif
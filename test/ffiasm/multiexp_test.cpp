@@ -0,0 +1,158 @@
+#include <random>
+#include <sys/time.h>
+#include "multiexp_test.hpp"
+#include "alt_bn128.hpp"
+#include "timer.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
+
+using namespace AltBn128;
+
+#define MULTIEXP_TEST_SCALAR_SIZE 32
+#define MULTIEXP_TEST_MIN_BENCH_BITS 16
+#define MULTIEXP_TEST_MAX_BENCH_BITS 22 // Order of the largest groth16 and fflonk zkeys sections
+
+// Generates the bases (i+1)*one, i.e. distinct points, in parallel segments
+template <typename Group>
+void MultiexpTestBases (Group &G, typename Group::PointAffine *bases, uint64_t n)
+{
+    uint64_t nSegments = 256;
+#pragma omp parallel for schedule(dynamic)
+    for (uint64_t s = 0; s < nSegments; s++)
+    {
+        uint64_t begin = s * n / nSegments;
+        uint64_t end = (s + 1) * n / nSegments;
+        if (begin >= end) continue;
+        typename Group::Point p;
+        uint64_t k = begin + 1;
+        G.mulByScalar(p, G.oneAffine(), (uint8_t *)&k, sizeof(k));
+        for (uint64_t i = begin; i < end; i++)
+        {
+            G.copy(bases[i], p);
+            G.add(p, p, G.oneAffine());
+        }
+    }
+}
+
+void MultiexpTestScalars (uint8_t *scalars, uint64_t n, std::mt19937_64 &gen)
+{
+    for (uint64_t i = 0; i < n * MULTIEXP_TEST_SCALAR_SIZE; i++)
+    {
+        scalars[i] = gen();
+    }
+}
+
+// Compares the batch affine multiexp against the reference ParallelMultiexp, with random scalars plus some corner
+// cases: zero and all-ones scalars, zero bases, repeated bases and opposite bases
+template <typename Group>
+uint64_t MultiexpTestCompare (Group &G, const string &name, uint64_t n, std::mt19937_64 &gen)
+{
+    typename Group::PointAffine *bases = new typename Group::PointAffine[n];
+    uint8_t *scalars = new uint8_t[n * MULTIEXP_TEST_SCALAR_SIZE];
+    MultiexpTestBases(G, bases, n);
+    MultiexpTestScalars(scalars, n, gen);
+    if (n > 8)
+    {
+        memset(scalars, 0, MULTIEXP_TEST_SCALAR_SIZE);
+        memset(scalars + MULTIEXP_TEST_SCALAR_SIZE, 0xFF, MULTIEXP_TEST_SCALAR_SIZE);
+        G.copy(bases[2], G.zeroAffine());
+        G.copy(bases[4], bases[3]);
+        memcpy(scalars + 4 * MULTIEXP_TEST_SCALAR_SIZE, scalars + 3 * MULTIEXP_TEST_SCALAR_SIZE, MULTIEXP_TEST_SCALAR_SIZE);
+        G.neg(bases[6], bases[5]);
+        memcpy(scalars + 6 * MULTIEXP_TEST_SCALAR_SIZE, scalars + 5 * MULTIEXP_TEST_SCALAR_SIZE, MULTIEXP_TEST_SCALAR_SIZE);
+    }
+
+    uint64_t numberOfFailedTests = 0;
+    typename Group::Point r, rRef;
+
+    BatchAffineMultiexp<Group> pm(G);
+    pm.multiexp(r, bases, scalars, MULTIEXP_TEST_SCALAR_SIZE, n);
+    ParallelMultiexp<Group> pmRef(G);
+    pmRef.multiexp(rRef, bases, scalars, MULTIEXP_TEST_SCALAR_SIZE, n);
+    if (!G.eq(r, rRef))
+    {
+        zklog.error("MultiexpTestCompare() " + name + " found mismatch with n=" + to_string(n));
+        numberOfFailedTests++;
+    }
+
+    // Fflonk variant, which only uses the first x[i%nx] bases of every of the nx interleaved polynomials
+    uint64_t nx = 3;
+    uint64_t x[3] = { n / 3, (n + 2) / 3, n / 5 + 1 };
+    pm.multiexp(r, bases, scalars, MULTIEXP_TEST_SCALAR_SIZE, n, nx, x);
+    pmRef.multiexp(rRef, bases, scalars, MULTIEXP_TEST_SCALAR_SIZE, n, nx, x);
+    if (!G.eq(r, rRef))
+    {
+        zklog.error("MultiexpTestCompare() " + name + " found mismatch with n=" + to_string(n) + " nx=" + to_string(nx));
+        numberOfFailedTests++;
+    }
+
+    delete[] bases;
+    delete[] scalars;
+    return numberOfFailedTests;
+}
+
+// Times the batch affine multiexp against the reference ParallelMultiexp
+template <typename Group>
+uint64_t MultiexpTestBenchmark (Group &G, const string &name, uint64_t n, std::mt19937_64 &gen)
+{
+    typename Group::PointAffine *bases = new typename Group::PointAffine[n];
+    uint8_t *scalars = new uint8_t[n * MULTIEXP_TEST_SCALAR_SIZE];
+    MultiexpTestBases(G, bases, n);
+    MultiexpTestScalars(scalars, n, gen);
+
+    typename Group::Point r, rRef;
+    struct timeval t;
+
+    gettimeofday(&t, NULL);
+    BatchAffineMultiexp<Group> pm(G);
+    pm.multiexp(r, bases, scalars, MULTIEXP_TEST_SCALAR_SIZE, n);
+    uint64_t batchAffineTime = TimeDiff(t);
+
+    gettimeofday(&t, NULL);
+    ParallelMultiexp<Group> pmRef(G);
+    pmRef.multiexp(rRef, bases, scalars, MULTIEXP_TEST_SCALAR_SIZE, n);
+    uint64_t referenceTime = TimeDiff(t);
+
+    uint64_t numberOfFailedTests = 0;
+    if (!G.eq(r, rRef))
+    {
+        zklog.error("MultiexpTestBenchmark() " + name + " found mismatch with n=" + to_string(n));
+        numberOfFailedTests++;
+    }
+
+    zklog.info("MultiexpTestBenchmark() " + name + " n=" + to_string(n) + " batchAffine=" + to_string(batchAffineTime) + "us reference=" + to_string(referenceTime) +
+        "us speedup=" + to_string(double(referenceTime) / zkmax(batchAffineTime, (uint64_t)1)));
+
+    delete[] bases;
+    delete[] scalars;
+    return numberOfFailedTests;
+}
+
+uint64_t MultiexpTest (void)
+{
+    TimerStart(MULTIEXP_TEST);
+
+    uint64_t numberOfFailedTests = 0;
+    std::mt19937_64 gen(0);
+
+    uint64_t sizes[] = { 0, 1, 2, 3, 7, 9, 31, 100, 1000, 4097, 10000, 70001 };
+    for (uint64_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        numberOfFailedTests += MultiexpTestCompare(G1, "G1", sizes[i], gen);
+        if (sizes[i] <= 10000)
+        {
+            numberOfFailedTests += MultiexpTestCompare(G2, "G2", sizes[i], gen);
+        }
+    }
+
+    for (uint64_t bits = MULTIEXP_TEST_MIN_BENCH_BITS; bits <= MULTIEXP_TEST_MAX_BENCH_BITS; bits += 2)
+    {
+        numberOfFailedTests += MultiexpTestBenchmark(G1, "G1", 1 << bits, gen);
+    }
+    numberOfFailedTests += MultiexpTestBenchmark(G2, "G2", 1 << MULTIEXP_TEST_MIN_BENCH_BITS, gen);
+
+    zklog.info("MultiexpTest() done, numberOfFailedTests=" + to_string(numberOfFailedTests));
+
+    TimerStopAndLog(MULTIEXP_TEST);
+    return numberOfFailedTests;
+}
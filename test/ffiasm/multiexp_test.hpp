@@ -0,0 +1,8 @@
+#ifndef MULTIEXP_TEST_HPP
+#define MULTIEXP_TEST_HPP
+
+#include <cstdint>
+
+uint64_t MultiexpTest (void);
+
+#endif
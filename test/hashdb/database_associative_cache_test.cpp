@@ -0,0 +1,128 @@
+#include <omp.h>
+#include <sys/time.h>
+#include "database_associative_cache_test.hpp"
+#include "database_associative_cache.hpp"
+#include "timer.hpp"
+#include "zklog.hpp"
+
+#define DATABASE_ASSOCIATIVE_CACHE_TEST_LOG2_INDEXES 22
+#define DATABASE_ASSOCIATIVE_CACHE_TEST_LOG2_ENTRIES 20
+#define DATABASE_ASSOCIATIVE_CACHE_TEST_KEYS (1<<19)
+#define DATABASE_ASSOCIATIVE_CACHE_TEST_READS_PER_THREAD (1<<21)
+
+// Deterministic pseudo-random field element, so that every thread can rebuild any key
+static inline uint64_t testKeyElement (uint64_t i)
+{
+    uint64_t z = i + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31);
+    return z % 0xFFFFFFFF00000001ULL;
+}
+
+static inline void testKey (uint64_t i, Goldilocks::Element (&key)[4])
+{
+    for (uint64_t j=0; j<4; j++)
+    {
+        key[j].fe = testKeyElement(4*i + j);
+    }
+}
+
+static inline void testValue (uint64_t i, vector<Goldilocks::Element> &value)
+{
+    value.resize(12);
+    for (uint64_t j=0; j<12; j++)
+    {
+        value[j].fe = i + j;
+    }
+}
+
+// Reads random keys from nThreads threads, while nWriters of them keep updating existing keys;
+// returns the number of failed reads, and the read throughput in Mreads/s
+static uint64_t DatabaseAssociativeCacheTestRead (DatabaseMTAssociativeCache &cache, uint64_t nThreads, uint64_t nWriters, double &mReadsPerSecond)
+{
+    uint64_t numberOfFailed = 0;
+    uint64_t totalReads = 0;
+    struct timeval t;
+    gettimeofday(&t, NULL);
+
+    #pragma omp parallel num_threads(nThreads) reduction(+:numberOfFailed,totalReads)
+    {
+        uint64_t thread = omp_get_thread_num();
+        Goldilocks::Element key[4];
+        vector<Goldilocks::Element> value;
+        uint64_t seed = thread*0x51ED27;
+        for (uint64_t r=0; r<DATABASE_ASSOCIATIVE_CACHE_TEST_READS_PER_THREAD; r++)
+        {
+            uint64_t i = testKeyElement(seed + r) % DATABASE_ASSOCIATIVE_CACHE_TEST_KEYS;
+            testKey(i, key);
+            if (thread < nWriters)
+            {
+                testValue(i, value);
+                cache.addKeyValue(key, value, true);
+                continue;
+            }
+            if (!cache.findKey(key, value) || (value.size() != 12) || (value[0].fe != i) || (value[11].fe != i + 11))
+            {
+                numberOfFailed++;
+            }
+            totalReads++;
+        }
+    }
+
+    mReadsPerSecond = double(totalReads)/double(zkmax(TimeDiff(t), 1));
+    return numberOfFailed;
+}
+
+uint64_t DatabaseAssociativeCacheTest (void)
+{
+    TimerStart(DATABASE_ASSOCIATIVE_CACHE_TEST);
+
+    uint64_t numberOfFailed = 0;
+    DatabaseMTAssociativeCache cache(DATABASE_ASSOCIATIVE_CACHE_TEST_LOG2_INDEXES, DATABASE_ASSOCIATIVE_CACHE_TEST_LOG2_ENTRIES, "TestMTACache");
+
+    // Fill the cache with half of its capacity, so that no key is evicted
+    Goldilocks::Element key[4];
+    vector<Goldilocks::Element> value;
+    for (uint64_t i=0; i<DATABASE_ASSOCIATIVE_CACHE_TEST_KEYS; i++)
+    {
+        testKey(i, key);
+        testValue(i, value);
+        cache.addKeyValue(key, value, false);
+    }
+
+    // Read scaling, with and without a concurrent writer
+    uint64_t maxThreads = omp_get_max_threads();
+    for (uint64_t nWriters=0; nWriters<=1; nWriters++)
+    {
+        uint64_t nThreads = 1 + nWriters;
+        while (true)
+        {
+            cache.resetStats();
+            double mReadsPerSecond;
+            uint64_t failed = DatabaseAssociativeCacheTestRead(cache, nThreads, nWriters, mReadsPerSecond);
+            DatabaseMTAssociativeCacheStats stats;
+            cache.getStats(stats);
+            zklog.info("DatabaseAssociativeCacheTest() threads=" + to_string(nThreads) + " writers=" + to_string(nWriters) +
+                " reads=" + to_string(mReadsPerSecond) + "M/s" +
+                " hitRatio=" + to_string(stats.hitRatio()) + "%" +
+                " readRetries=" + to_string(stats.readRetries) +
+                " readLocks=" + to_string(stats.readLocks) +
+                " writes=" + to_string(stats.writes) +
+                " writeContentions=" + to_string(stats.writeContentions) +
+                " failed=" + to_string(failed));
+            numberOfFailed += failed;
+
+            if (nThreads >= maxThreads) break;
+            nThreads = zkmin(nThreads*2, maxThreads);
+        }
+    }
+
+    if (numberOfFailed != 0)
+    {
+        zklog.error("DatabaseAssociativeCacheTest() failed numberOfFailed=" + to_string(numberOfFailed));
+    }
+
+    TimerStopAndLog(DATABASE_ASSOCIATIVE_CACHE_TEST);
+    return numberOfFailed;
+}
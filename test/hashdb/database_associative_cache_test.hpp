@@ -0,0 +1,8 @@
+#ifndef DATABASE_ASSOCIATIVE_CACHE_TEST_HPP
+#define DATABASE_ASSOCIATIVE_CACHE_TEST_HPP
+
+#include <cstdint>
+
+uint64_t DatabaseAssociativeCacheTest (void);
+
+#endif
@@ -5,9 +5,127 @@
 #include "scalar.hpp"
 #include "utils.hpp"
 #include "timer.hpp"
+#include "database_key.hpp"
 
 
 #define DATABASE_PERFORMANCE_TEST_SIZE 10000
+#define DATABASE_PERFORMANCE_TEST_KEYS (1024*1024)
+
+// Compares the in-memory key path cost of hex string keys vs. binary keys, in ns per operation
+uint64_t DatabasePerformanceTestKeys (void)
+{
+    TimerStart(DATABASE_PERFORMANCE_TEST_KEYS);
+
+    Goldilocks fr;
+    PoseidonGoldilocks poseidon;
+    struct timeval t;
+    uint64_t numberOfFailed = 0;
+    const uint64_t n = DATABASE_PERFORMANCE_TEST_KEYS;
+
+    // Create keys, as poseidon hashes, and their hex strings, as provided by the SMT callers
+    Goldilocks::Element keyValue[12];
+    for (uint64_t i=0; i<12; i++)
+    {
+        keyValue[i] = fr.zero();
+    }
+    Goldilocks::Element (*pKeys)[4] = new Goldilocks::Element[n][4];
+    string *pKeyStrings = new string[n];
+    for (uint64_t i=0; i<n; i++)
+    {
+        keyValue[0] = fr.fromU64(i);
+        poseidon.hash(pKeys[i], keyValue);
+        pKeyStrings[i] = fea2string(fr, pKeys[i]);
+    }
+    vector<Goldilocks::Element> value;
+    for (uint64_t i=0; i<12; i++)
+    {
+        value.push_back(fr.fromU64(i));
+    }
+    vector<Goldilocks::Element> readValue;
+
+    // Hex string keys, normalized as Database::read() and StateManager used to do
+    {
+        unordered_map<string, vector<Goldilocks::Element>> stringMap;
+        gettimeofday(&t, NULL);
+        for (uint64_t i=0; i<n; i++)
+        {
+            string key = NormalizeToNFormat(pKeyStrings[i], 64);
+            key = stringToLower(key);
+            stringMap[key] = value;
+        }
+        uint64_t writeTime = TimeDiff(t);
+        gettimeofday(&t, NULL);
+        for (uint64_t i=0; i<n; i++)
+        {
+            string key = NormalizeToNFormat(pKeyStrings[(i*7919)%n], 64);
+            key = stringToLower(key);
+            unordered_map<string, vector<Goldilocks::Element>>::const_iterator it = stringMap.find(key);
+            if (it == stringMap.end()) numberOfFailed++;
+            else readValue = it->second;
+        }
+        uint64_t readTime = TimeDiff(t);
+        zklog.info("DatabasePerformanceTestKeys() string keys:  write=" + to_string(double(writeTime)*1000/n) + "ns/op read=" + to_string(double(readTime)*1000/n) + "ns/op");
+    }
+
+    // Binary keys in a flat open addressing table
+    {
+        DatabaseKeyMap<vector<Goldilocks::Element>> binaryMap;
+        gettimeofday(&t, NULL);
+        for (uint64_t i=0; i<n; i++)
+        {
+            binaryMap[DatabaseKey(pKeys[i])] = value;
+        }
+        uint64_t writeTime = TimeDiff(t);
+        gettimeofday(&t, NULL);
+        for (uint64_t i=0; i<n; i++)
+        {
+            vector<Goldilocks::Element> *pValue = binaryMap.findValue(DatabaseKey(pKeys[(i*7919)%n]));
+            if (pValue == NULL) numberOfFailed++;
+            else readValue = *pValue;
+        }
+        uint64_t readTime = TimeDiff(t);
+        zklog.info("DatabasePerformanceTestKeys() binary keys:  write=" + to_string(double(writeTime)*1000/n) + "ns/op read=" + to_string(double(readTime)*1000/n) + "ns/op");
+    }
+
+    // MT cache, through the string and the binary interfaces
+    int64_t maxSize = Database::dbMTCache.getMaxSize();
+    Database::dbMTCache.clear();
+    Database::dbMTCache.setMaxSize(int64_t(n)*1024);
+    for (uint64_t b=0; b<2; b++)
+    {
+        bool bBinary = (b == 1);
+        gettimeofday(&t, NULL);
+        for (uint64_t i=0; i<n; i++)
+        {
+            if (bBinary) Database::dbMTCache.add(DatabaseKey(pKeys[i]), value, false);
+            else Database::dbMTCache.add(pKeyStrings[i], value, false);
+        }
+        uint64_t writeTime = TimeDiff(t);
+        gettimeofday(&t, NULL);
+        for (uint64_t i=0; i<n; i++)
+        {
+            uint64_t j = (i*7919)%n;
+            bool bFound = bBinary ? Database::dbMTCache.find(DatabaseKey(pKeys[j]), readValue) : Database::dbMTCache.find(pKeyStrings[j], readValue);
+            if (!bFound) numberOfFailed++;
+        }
+        uint64_t readTime = TimeDiff(t);
+        zklog.info("DatabasePerformanceTestKeys() MT cache " + string(bBinary ? "binary" : "string") + " keys: add=" + to_string(double(writeTime)*1000/n) + "ns/op find=" + to_string(double(readTime)*1000/n) + "ns/op");
+        Database::dbMTCache.clear();
+    }
+    Database::dbMTCache.setMaxSize(maxSize);
+
+    delete[] pKeys;
+    delete[] pKeyStrings;
+
+    if (numberOfFailed != 0)
+    {
+        zklog.error("DatabasePerformanceTestKeys() failed numberOfFailed=" + to_string(numberOfFailed));
+    }
+
+    TimerStopAndLog(DATABASE_PERFORMANCE_TEST_KEYS);
+
+    return numberOfFailed;
+}
 
 uint64_t DatabasePerformanceTestSendValues (uint64_t valueSize)
 {
@@ -107,9 +225,11 @@ uint64_t DatabasePerformanceTestSendValues (uint64_t valueSize)
 
 uint64_t DatabasePerformanceTest (void)
 {
+    uint64_t numberOfFailed = DatabasePerformanceTestKeys();
+
     for (uint64_t i=1; i<=256; i*=2)
     {
         DatabasePerformanceTestSendValues(12*i);
     }
-    return 0;
+    return numberOfFailed;
 }
\ No newline at end of file
@@ -25,6 +25,7 @@ uint64_t PageManagerTest (void)
     PageManagerAccuracyTest();
     PageManagerDBResizeTest();
     PageManagerDBResetTest();
+    PageManagerFlushBenchmark();
     //PageManagerPerformanceTest();
     TimerStopAndLog(PAGE_MANAGER_TEST);
     return 0;
@@ -472,3 +473,103 @@ uint64_t PageManagerDBResetTest (void){
     return 0;
 }
 
+// Times the flush of a few edited pages syncing the whole mapped files against syncing only the dirty page ranges, for
+// databases of a growing number of files; the files other than the first one are created sparse, as if the pages of
+// the database had been written long ago, so every flush only touches the first file
+uint64_t PageManagerFlushBenchmark (void){
+
+    const string fileName = "page_manager_flush";
+    const string folderName = "pmtest";
+    const int file_size = 1;  //in GB
+    const uint64_t numLivePages = 1 << 14;
+    const uint64_t numEditedPages = 64;
+    const uint64_t numReps = 10;
+    const uint64_t dbSizes[] = {1, 4, 16}; //in files
+
+    std::mt19937_64 rng(0);
+    uint64_t numberOfFailedTests = 0;
+
+    Config configPMFile;
+    configPMFile.hashDBFileName = fileName;
+    configPMFile.hashDBFileSize = file_size;
+    configPMFile.hashDBFolder = folderName;
+
+    for(uint64_t s=0; s< sizeof(dbSizes)/sizeof(dbSizes[0]); ++s){
+
+        //delete folder (is exists)
+        std::string command = "rm -rf " + folderName;
+        int r = system(command.c_str());
+        if(r!=0){
+            zklog.info("Error removing folder");
+            return 1;
+        }
+
+        //populate the first file with numLivePages pages
+        vector<uint64_t> livePages(numLivePages);
+        {
+            PageManager pageManagerFile;
+            PageContext ctxf(pageManagerFile, configPMFile);
+            pageManagerFile.init(ctxf);
+            for(uint64_t i=0; i< numLivePages; ++i){
+                livePages[i] = pageManagerFile.getFreePage();
+                uint64_t* pageData = (uint64_t *)pageManagerFile.getPageAddress(livePages[i]);
+                pageData[0] = i;
+            }
+            pageManagerFile.flushPages(ctxf);
+        }
+
+        //add the rest of the files
+        for(uint64_t f=1; f< dbSizes[s]; ++f){
+            string file = folderName + "/" + fileName + "_" + to_string(f) + ".db";
+            int fd = open(file.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+            if (fd == -1 || ftruncate(fd, (uint64_t)file_size << 30) == -1) {
+                zklog.error("PageManagerFlushBenchmark() failed creating file " + file);
+                return 1;
+            }
+            close(fd);
+        }
+
+        PageManager pageManagerFile;
+        PageContext ctxf(pageManagerFile, configPMFile);
+        pageManagerFile.init(ctxf);
+
+        //edit a few random pages and flush them, alternatively syncing the whole files or only the dirty page ranges
+        double flushTime[2] = {0, 0};
+        for(uint64_t k=0; k< 2*numReps; ++k){
+            bool fullSync = (k%2 == 0);
+            pageManagerFile.setFullSync(fullSync);
+            for(uint64_t i=0; i< numEditedPages; ++i){
+                uint64_t position = rng() % numLivePages;
+                livePages[position] = pageManagerFile.editPage(livePages[position]);
+                uint64_t* pageData = (uint64_t *)pageManagerFile.getPageAddress(livePages[position]);
+                pageData[1] = k;
+            }
+            double start = omp_get_wtime();
+            pageManagerFile.flushPages(ctxf);
+            flushTime[fullSync ? 0 : 1] += omp_get_wtime() - start;
+        }
+
+        //check the edited pages kept their content
+        for(uint64_t i=0; i< numLivePages; ++i){
+            uint64_t* pageData = (uint64_t *)pageManagerFile.getPageAddress(livePages[i]);
+            if(pageData[0] != i){
+                zklog.error("PageManagerFlushBenchmark() found wrong value " + to_string(pageData[0]) + " at page " + to_string(livePages[i]) + " instead of " + to_string(i));
+                numberOfFailedTests++;
+                break;
+            }
+        }
+
+        zklog.info("PageManagerFlushBenchmark() files=" + to_string(dbSizes[s]) + " livePages=" + to_string(numLivePages) + " editedPages=" + to_string(numEditedPages) +
+            " fullSync=" + to_string(flushTime[0]*1e6/numReps) + "us dirtyRanges=" + to_string(flushTime[1]*1e6/numReps) + "us speedup=" + to_string(flushTime[0]/flushTime[1]));
+    }
+
+    //delete folder
+    std::string command = "rm -rf " + folderName;
+    int r = system(command.c_str());
+    if(r!=0){
+        zklog.info("Error removing folder");
+        return 1;
+    }
+
+    return numberOfFailedTests;
+}
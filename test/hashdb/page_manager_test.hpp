@@ -8,5 +8,6 @@ uint64_t PageManagerAccuracyTest (void);
 uint64_t PageManagerPerformanceTest (void);
 uint64_t PageManagerDBResizeTest (void);
 uint64_t PageManagerDBResetTest (void);
+uint64_t PageManagerFlushBenchmark (void);
 
 #endif
\ No newline at end of file
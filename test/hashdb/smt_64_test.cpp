@@ -4,11 +4,463 @@
 #include "unistd.h"
 #include "hashdb_factory.hpp"
 #include "utils.hpp"
+#include "database_64.hpp"
+#include "key_value_history_page.hpp"
+#include "zkglobals.hpp"
+#include "timer.hpp"
+#include <omp.h>
 
 #define SMT64_TEST_NUMBER_OF_WRITES 1000
 #define SMT64_TEST_KEYS_PER_WRITE 10
 #define SMT64_TEST_NUMBER_OF_KEYS (SMT64_TEST_NUMBER_OF_WRITES*SMT64_TEST_KEYS_PER_WRITE)
+#define SMT64_BENCHMARK_NUMBER_OF_WRITES 20
+#define SMT64_BENCHMARK_KEYS_PER_WRITE 10000
+#define SMT64_READ_BENCHMARK_NUMBER_OF_KEYS 2000000
+#define SMT64_READ_BENCHMARK_KEYS_PER_WRITE 100000
+#define SMT64_COMPACTION_BENCHMARK_NUMBER_OF_WRITES 400
+#define SMT64_COMPACTION_BENCHMARK_NUMBER_OF_KEYS 10000
+#define SMT64_COMPACTION_BENCHMARK_KEYS_PER_WRITE 1000
+#define SMT64_COMPACTION_BENCHMARK_MAX_VERSIONS 16
 
+// Writes the same SMT64 test style key-values into a database that writes serially and into one that writes with all
+// the threads, checking that both get the same state roots, and logs the throughput of the WriteTree() calls of both;
+// the databases are in memory or in files
+uint64_t Smt64WriteTreeBenchmark (const Config &config, const uint64_t numberOfWrites, const uint64_t keysPerWrite, const bool inMemory)
+{
+    uint64_t numberOfFailedTests = 0;
+    PoseidonGoldilocks poseidon;
+    zkresult zkr;
+
+    // Half of the keys are new, and the other half overwrite them with new values
+    uint64_t numberOfDistinctKeys = zkmax(numberOfWrites*keysPerWrite/2, keysPerWrite);
+    vector<vector<KeyValue>> keyValues(numberOfWrites);
+    Goldilocks::Element keyValue[12];
+    for (uint64_t i=0; i<12; i++)
+    {
+        keyValue[i] = fr.zero();
+    }
+    for (uint64_t i=0; i<numberOfWrites*keysPerWrite; i++)
+    {
+        KeyValue kv;
+        keyValue[0] = fr.fromU64(i % numberOfDistinctKeys);
+        poseidon.hash(kv.key, keyValue);
+        kv.value = i + 1;
+        keyValues[i/keysPerWrite].emplace_back(kv);
+    }
+
+    uint64_t writeThreads[2] = {1, (uint64_t)omp_get_max_threads()};
+    uint64_t writeTime[2] = {0, 0};
+    vector<string> roots[2];
+    for (uint64_t t=0; t<2; t++)
+    {
+        Config benchmarkConfig = config;
+        benchmarkConfig.hashDBFileName = inMemory ? "" : "smt64_benchmark";
+        benchmarkConfig.hashDBFileSize = 1;
+        benchmarkConfig.hashDBFolder = "smt64benchmark";
+        benchmarkConfig.hashDB64WriteThreads = writeThreads[t];
+        string command = "rm -rf " + benchmarkConfig.hashDBFolder;
+        if (system(command.c_str()) != 0)
+        {
+            zklog.error("Smt64WriteTreeBenchmark() failed removing folder " + benchmarkConfig.hashDBFolder);
+            return numberOfFailedTests + 1;
+        }
+
+        Database64 *pDatabase = new Database64(fr, benchmarkConfig);
+        Goldilocks::Element root[4] = {fr.zero(), fr.zero(), fr.zero(), fr.zero()};
+        struct timeval startTime;
+        gettimeofday(&startTime, NULL);
+        for (uint64_t i=0; i<numberOfWrites; i++)
+        {
+            zkr = pDatabase->WriteTree(root, keyValues[i], root, true);
+            if (zkr != ZKR_SUCCESS)
+            {
+                zklog.error("Smt64WriteTreeBenchmark() failed calling WriteTree() result=" + zkresult2string(zkr) + " i=" + to_string(i) + " writeThreads=" + to_string(writeThreads[t]));
+                numberOfFailedTests++;
+                break;
+            }
+            roots[t].emplace_back(fea2string(fr, root));
+        }
+        writeTime[t] = TimeDiff(startTime);
+
+        // The last write overwrites its keys, so the read values must be the last written ones
+        vector<KeyValue> readKeyValues = keyValues[numberOfWrites - 1];
+        zkr = pDatabase->ReadTree(root, readKeyValues, NULL);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("Smt64WriteTreeBenchmark() failed calling ReadTree() result=" + zkresult2string(zkr) + " writeThreads=" + to_string(writeThreads[t]));
+            numberOfFailedTests++;
+        }
+        else
+        {
+            for (uint64_t j=0; j<readKeyValues.size(); j++)
+            {
+                if (readKeyValues[j].value != keyValues[numberOfWrites - 1][j].value)
+                {
+                    zklog.error("Smt64WriteTreeBenchmark() read value=" + readKeyValues[j].value.get_str(10) + " expected=" + keyValues[numberOfWrites - 1][j].value.get_str(10) + " writeThreads=" + to_string(writeThreads[t]));
+                    numberOfFailedTests++;
+                }
+            }
+        }
+
+        delete pDatabase;
+        if (system(command.c_str()) != 0)
+        {
+            zklog.error("Smt64WriteTreeBenchmark() failed removing folder " + benchmarkConfig.hashDBFolder);
+            numberOfFailedTests++;
+        }
+    }
+
+    if (roots[0] != roots[1])
+    {
+        zklog.error("Smt64WriteTreeBenchmark() got different state roots writing serially and with writeThreads=" + to_string(writeThreads[1]));
+        numberOfFailedTests++;
+    }
+
+    zklog.info("Smt64WriteTreeBenchmark() writes=" + to_string(numberOfWrites) + " keysPerWrite=" + to_string(keysPerWrite) + " inMemory=" + to_string(inMemory) +
+        " serial=" + to_string(writeTime[0]) + "us (" + to_string(double(numberOfWrites*keysPerWrite)*1000000/zkmax(writeTime[0], (uint64_t)1)) + " keys/s)" +
+        " writeThreads=" + to_string(writeThreads[1]) + " parallel=" + to_string(writeTime[1]) + "us (" + to_string(double(numberOfWrites*keysPerWrite)*1000000/zkmax(writeTime[1], (uint64_t)1)) + " keys/s)" +
+        " speedup=" + to_string(double(writeTime[0])/zkmax(writeTime[1], (uint64_t)1)));
+
+    return numberOfFailedTests;
+}
+
+// Writes numberOfKeys distinct keys into a database, keysPerWrite at a time, and reads all of them back from the last
+// state root, logging the ns per key of the WriteTree() calls and the ns per readKV() call
+uint64_t Smt64ReadKVBenchmark (const Config &config, const uint64_t numberOfKeys, const uint64_t keysPerWrite)
+{
+    uint64_t numberOfFailedTests = 0;
+    PoseidonGoldilocks poseidon;
+    zkresult zkr;
+
+    Config benchmarkConfig = config;
+    benchmarkConfig.hashDBFileName = "smt64_read_benchmark";
+    benchmarkConfig.hashDBFileSize = 1;
+    benchmarkConfig.hashDBFolder = "smt64readbenchmark";
+    string command = "rm -rf " + benchmarkConfig.hashDBFolder;
+    if (system(command.c_str()) != 0)
+    {
+        zklog.error("Smt64ReadKVBenchmark() failed removing folder " + benchmarkConfig.hashDBFolder);
+        return numberOfFailedTests + 1;
+    }
+
+    Database64 *pDatabase = new Database64(fr, benchmarkConfig);
+    pDatabase->init();
+    Goldilocks::Element root[4] = {fr.zero(), fr.zero(), fr.zero(), fr.zero()};
+    Goldilocks::Element keyValue[12];
+    for (uint64_t i=0; i<12; i++)
+    {
+        keyValue[i] = fr.zero();
+    }
+
+    // Write the keys, with value = i + 1
+    vector<KeyValue> keyValues;
+    uint64_t writeTime = 0;
+    for (uint64_t i=0; i<numberOfKeys; i++)
+    {
+        KeyValue kv;
+        keyValue[0] = fr.fromU64(i);
+        poseidon.hash(kv.key, keyValue);
+        kv.value = i + 1;
+        keyValues.emplace_back(kv);
+        if ((keyValues.size() == keysPerWrite) || (i == numberOfKeys - 1))
+        {
+            struct timeval startTime;
+            gettimeofday(&startTime, NULL);
+            zkr = pDatabase->WriteTree(root, keyValues, root, true);
+            writeTime += TimeDiff(startTime);
+            if (zkr != ZKR_SUCCESS)
+            {
+                zklog.error("Smt64ReadKVBenchmark() failed calling WriteTree() result=" + zkresult2string(zkr) + " i=" + to_string(i));
+                numberOfFailedTests++;
+                break;
+            }
+            keyValues.clear();
+        }
+    }
+
+    // Read them back, in the same order
+    uint64_t readTime = 0;
+    for (uint64_t i=0; (i<numberOfKeys) && (numberOfFailedTests == 0); i++)
+    {
+        Goldilocks::Element key[4];
+        keyValue[0] = fr.fromU64(i);
+        poseidon.hash(key, keyValue);
+        mpz_class value;
+        uint64_t level;
+        struct timeval startTime;
+        gettimeofday(&startTime, NULL);
+        zkr = pDatabase->readKV(root, key, value, level, NULL);
+        readTime += TimeDiff(startTime);
+        if ((zkr != ZKR_SUCCESS) || (value != i + 1))
+        {
+            zklog.error("Smt64ReadKVBenchmark() failed calling readKV() result=" + zkresult2string(zkr) + " i=" + to_string(i) + " value=" + value.get_str(10));
+            numberOfFailedTests++;
+        }
+    }
+
+    zklog.info("Smt64ReadKVBenchmark() keys=" + to_string(numberOfKeys) + " keysPerWrite=" + to_string(keysPerWrite) +
+        " WriteTree=" + to_string(double(writeTime)*1000/zkmax(numberOfKeys, (uint64_t)1)) + "ns/key" +
+        " readKV=" + to_string(double(readTime)*1000/zkmax(numberOfKeys, (uint64_t)1)) + "ns/op");
+
+    delete pDatabase;
+    if (system(command.c_str()) != 0)
+    {
+        zklog.error("Smt64ReadKVBenchmark() failed removing folder " + benchmarkConfig.hashDBFolder);
+        numberOfFailedTests++;
+    }
+
+    return numberOfFailedTests;
+}
+
+// Writes a key A, and then a key B that shares its first 6 bits, and checks that readKV() returns the levels that
+// they have at the state root of every write: A is alone in the tree after the first write, at level 6, and B would go
+// at the level it shares with A after the second write, even if B was not written yet
+uint64_t Smt64ReadKVLevelTest (const Config &config)
+{
+    uint64_t numberOfFailedTests = 0;
+    PoseidonGoldilocks poseidon;
+    zkresult zkr;
+
+    Config testConfig = config;
+    testConfig.hashDBFileName = "";
+
+    // Find 2 keys with the same first 6 bits, which 65 keys are enough for
+    Goldilocks::Element keyValue[12];
+    for (uint64_t i=0; i<12; i++)
+    {
+        keyValue[i] = fr.zero();
+    }
+    KeyValue keys[65];
+    uint64_t a = 0;
+    uint64_t b = 0;
+    for (uint64_t i=0; (i<65) && (b == 0); i++)
+    {
+        keyValue[0] = fr.fromU64(i);
+        poseidon.hash(keys[i].key, keyValue);
+        keys[i].value = i + 1;
+        KeyValueHistoryKey iKey(keys[i].key);
+        for (uint64_t j=0; j<i; j++)
+        {
+            KeyValueHistoryKey jKey(keys[j].key);
+            if (iKey.bits[0] == jKey.bits[0])
+            {
+                a = j;
+                b = i;
+                break;
+            }
+        }
+    }
+    zkassertpermanent(b != 0);
+
+    Database64 *pDatabase = new Database64(fr, testConfig);
+    pDatabase->init();
+    Goldilocks::Element roots[3][4] = {{fr.zero(), fr.zero(), fr.zero(), fr.zero()}};
+    uint64_t writes[2] = {a, b};
+    for (uint64_t w=0; w<2; w++)
+    {
+        vector<KeyValue> keyValues;
+        keyValues.emplace_back(keys[writes[w]]);
+        zkr = pDatabase->WriteTree(roots[w], keyValues, roots[w+1], true);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("Smt64ReadKVLevelTest() failed calling WriteTree() result=" + zkresult2string(zkr) + " w=" + to_string(w));
+            delete pDatabase;
+            return numberOfFailedTests + 1;
+        }
+    }
+
+    // The level of A at the first root, and the one of A and B at the second root, which B already had at the first
+    mpz_class value;
+    uint64_t levels[2][2];
+    for (uint64_t w=0; w<2; w++)
+    {
+        for (uint64_t k=0; k<2; k++)
+        {
+            zkr = pDatabase->readKV(roots[w+1], keys[writes[k]].key, value, levels[w][k], NULL);
+            mpz_class expectedValue = (k <= w) ? keys[writes[k]].value : mpz_class(0);
+            if ((zkr != ZKR_SUCCESS) || (value != expectedValue))
+            {
+                zklog.error("Smt64ReadKVLevelTest() failed calling readKV() result=" + zkresult2string(zkr) + " w=" + to_string(w) + " k=" + to_string(k) + " value=" + value.get_str(10) + " expected=" + expectedValue.get_str(10));
+                numberOfFailedTests++;
+            }
+        }
+    }
+    if ((levels[0][0] != 6) || (levels[1][0] <= 6) || (levels[0][1] != levels[1][0]) || (levels[1][1] != levels[1][0]))
+    {
+        zklog.error("Smt64ReadKVLevelTest() got wrong levels: A at first root=" + to_string(levels[0][0]) + " B at first root=" + to_string(levels[0][1]) +
+            " A at second root=" + to_string(levels[1][0]) + " B at second root=" + to_string(levels[1][1]));
+        numberOfFailedTests++;
+    }
+
+    delete pDatabase;
+
+    return numberOfFailedTests;
+}
+
+// Overwrites keysPerWrite of numberOfKeys keys in every one of numberOfWrites writes, keeping kvDBMaxVersions=maxVersions
+// versions and, if bCompact, compacting the key-value history every maxVersions writes; then checks the values of all
+// keys at the last and at the oldest kept state roots, and that the pruned ones cannot be read, and logs the file size,
+// the used pages and the ns per readKV() call at both roots
+uint64_t Smt64CompactionBenchmark (const Config &config, const uint64_t numberOfWrites, const uint64_t numberOfKeys, const uint64_t keysPerWrite, const uint64_t maxVersions, const bool bCompact)
+{
+    uint64_t numberOfFailedTests = 0;
+    PoseidonGoldilocks poseidon;
+    zkresult zkr;
+
+    zkassert(numberOfWrites >= maxVersions);
+    zkassert(maxVersions > 0);
+
+    Config benchmarkConfig = config;
+    benchmarkConfig.hashDBFileName = "smt64_compaction_benchmark";
+    benchmarkConfig.hashDBFileSize = 1;
+    benchmarkConfig.hashDBFolder = "smt64compactionbenchmark";
+    benchmarkConfig.kvDBMaxVersions = maxVersions;
+    benchmarkConfig.hashDB64CompactionPeriod = 0; // Compact synchronously, to get the same pruned versions every run
+    string command = "rm -rf " + benchmarkConfig.hashDBFolder;
+    if (system(command.c_str()) != 0)
+    {
+        zklog.error("Smt64CompactionBenchmark() failed removing folder " + benchmarkConfig.hashDBFolder);
+        return numberOfFailedTests + 1;
+    }
+
+    Database64 *pDatabase = new Database64(fr, benchmarkConfig);
+    pDatabase->init();
+    Goldilocks::Element keyValue[12];
+    for (uint64_t i=0; i<12; i++)
+    {
+        keyValue[i] = fr.zero();
+    }
+    vector<KeyValue> keys(numberOfKeys);
+    for (uint64_t i=0; i<numberOfKeys; i++)
+    {
+        keyValue[0] = fr.fromU64(i);
+        poseidon.hash(keys[i].key, keyValue);
+    }
+
+    // Write the versions, keeping the state roots and the values of the last maxVersions ones
+    vector<mpz_class> values(numberOfKeys, 0);
+    vector<vector<mpz_class>> keptValues;
+    vector<vector<Goldilocks::Element>> roots;
+    Goldilocks::Element root[4] = {fr.zero(), fr.zero(), fr.zero(), fr.zero()};
+    KeyValueHistoryCompactionCounters counters;
+    for (uint64_t w=0; w<numberOfWrites; w++)
+    {
+        vector<KeyValue> keyValues;
+        for (uint64_t j=0; j<keysPerWrite; j++)
+        {
+            uint64_t i = (w*keysPerWrite + j*7) % numberOfKeys;
+            KeyValue kv;
+            kv.key[0] = keys[i].key[0];
+            kv.key[1] = keys[i].key[1];
+            kv.key[2] = keys[i].key[2];
+            kv.key[3] = keys[i].key[3];
+            kv.value = w*numberOfKeys + i + 1;
+            values[i] = kv.value;
+            keyValues.emplace_back(kv);
+        }
+        zkr = pDatabase->WriteTree(root, keyValues, root, true);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("Smt64CompactionBenchmark() failed calling WriteTree() result=" + zkresult2string(zkr) + " w=" + to_string(w));
+            numberOfFailedTests++;
+            break;
+        }
+        roots.emplace_back(vector<Goldilocks::Element>(root, root + 4));
+        keptValues.emplace_back(values);
+        if (keptValues.size() > maxVersions)
+        {
+            keptValues.erase(keptValues.begin());
+        }
+
+        if (bCompact && (((w + 1) % maxVersions) == 0))
+        {
+            zkr = pDatabase->compactHistory(counters);
+            if (zkr != ZKR_SUCCESS)
+            {
+                zklog.error("Smt64CompactionBenchmark() failed calling compactHistory() result=" + zkresult2string(zkr) + " w=" + to_string(w));
+                numberOfFailedTests++;
+                break;
+            }
+        }
+    }
+
+    // Read all the keys at the last and at the oldest kept state roots
+    uint64_t readTime[2] = {0, 0};
+    for (uint64_t r=0; (r<2) && (numberOfFailedTests == 0); r++)
+    {
+        uint64_t w = (r == 0) ? numberOfWrites - 1 : numberOfWrites - maxVersions;
+        const vector<mpz_class> &expectedValues = (r == 0) ? keptValues.back() : keptValues.front();
+        Goldilocks::Element readRoot[4] = {roots[w][0], roots[w][1], roots[w][2], roots[w][3]};
+        for (uint64_t i=0; i<numberOfKeys; i++)
+        {
+            mpz_class value;
+            uint64_t level;
+            struct timeval startTime;
+            gettimeofday(&startTime, NULL);
+            zkr = pDatabase->readKV(readRoot, keys[i].key, value, level, NULL);
+            readTime[r] += TimeDiff(startTime);
+            if ((zkr != ZKR_SUCCESS) || (value != expectedValues[i]))
+            {
+                zklog.error("Smt64CompactionBenchmark() failed calling readKV() result=" + zkresult2string(zkr) + " w=" + to_string(w) + " i=" + to_string(i) + " value=" + value.get_str(10) + " expected=" + expectedValues[i].get_str(10));
+                numberOfFailedTests++;
+                break;
+            }
+        }
+    }
+
+    // Read all the keys at once at the oldest kept state root, which is not the last one if more than one is kept
+    if (numberOfFailedTests == 0)
+    {
+        uint64_t w = numberOfWrites - maxVersions;
+        Goldilocks::Element readRoot[4] = {roots[w][0], roots[w][1], roots[w][2], roots[w][3]};
+        vector<KeyValue> readKeyValues = keys;
+        zkr = pDatabase->ReadTree(readRoot, readKeyValues, NULL);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("Smt64CompactionBenchmark() failed calling ReadTree() result=" + zkresult2string(zkr) + " w=" + to_string(w));
+            numberOfFailedTests++;
+        }
+        for (uint64_t i=0; (i<numberOfKeys) && (numberOfFailedTests == 0); i++)
+        {
+            if (readKeyValues[i].value != keptValues.front()[i])
+            {
+                zklog.error("Smt64CompactionBenchmark() called ReadTree() and got w=" + to_string(w) + " i=" + to_string(i) + " value=" + readKeyValues[i].value.get_str(10) + " expected=" + keptValues.front()[i].get_str(10));
+                numberOfFailedTests++;
+            }
+        }
+    }
+
+    // The first state root must have been pruned by the compaction
+    if (bCompact && (numberOfFailedTests == 0) && (numberOfWrites > maxVersions))
+    {
+        Goldilocks::Element readRoot[4] = {roots[0][0], roots[0][1], roots[0][2], roots[0][3]};
+        mpz_class value;
+        uint64_t level;
+        zkr = pDatabase->readKV(readRoot, keys[0].key, value, level, NULL);
+        if (zkr != ZKR_DB_VERSION_NOT_FOUND_KVDB)
+        {
+            zklog.error("Smt64CompactionBenchmark() called readKV() with a pruned state root and got result=" + zkresult2string(zkr));
+            numberOfFailedTests++;
+        }
+    }
+
+    uint64_t firstUnusedPage, usedPages;
+    pDatabase->getPagesStats(firstUnusedPage, usedPages);
+    zklog.info("Smt64CompactionBenchmark() compact=" + to_string(bCompact) + " writes=" + to_string(numberOfWrites) + " keys=" + to_string(numberOfKeys) + " keysPerWrite=" + to_string(keysPerWrite) + " maxVersions=" + to_string(maxVersions) +
+        " fileSize=" + to_string(firstUnusedPage*4096) + "B usedPages=" + to_string(usedPages) +
+        " readKV(last)=" + to_string(double(readTime[0])*1000/zkmax(numberOfKeys, (uint64_t)1)) + "ns/op" +
+        " readKV(oldest)=" + to_string(double(readTime[1])*1000/zkmax(numberOfKeys, (uint64_t)1)) + "ns/op" +
+        " rewrittenPages=" + to_string(counters.rewrittenPages) + " droppedHistoryEntries=" + to_string(counters.droppedHistoryEntries) + " releasedPages=" + to_string(counters.releasedPages));
+
+    delete pDatabase;
+    if (system(command.c_str()) != 0)
+    {
+        zklog.error("Smt64CompactionBenchmark() failed removing folder " + benchmarkConfig.hashDBFolder);
+        numberOfFailedTests++;
+    }
+
+    return numberOfFailedTests;
+}
 
 uint64_t Smt64Test (const Config &config)
 {
@@ -199,6 +651,23 @@ uint64_t Smt64Test (const Config &config)
         }
     }
 
+    TimerStart(SMT64_WRITE_TREE_BENCHMARK);
+    numberOfFailedTests += Smt64WriteTreeBenchmark(config, SMT64_TEST_NUMBER_OF_WRITES, SMT64_TEST_KEYS_PER_WRITE, false);
+    numberOfFailedTests += Smt64WriteTreeBenchmark(config, SMT64_BENCHMARK_NUMBER_OF_WRITES, SMT64_BENCHMARK_KEYS_PER_WRITE, false);
+    numberOfFailedTests += Smt64WriteTreeBenchmark(config, SMT64_BENCHMARK_NUMBER_OF_WRITES, SMT64_BENCHMARK_KEYS_PER_WRITE, true);
+    TimerStopAndLog(SMT64_WRITE_TREE_BENCHMARK);
+
+    numberOfFailedTests += Smt64ReadKVLevelTest(config);
+
+    TimerStart(SMT64_READ_KV_BENCHMARK);
+    numberOfFailedTests += Smt64ReadKVBenchmark(config, SMT64_READ_BENCHMARK_NUMBER_OF_KEYS, SMT64_READ_BENCHMARK_KEYS_PER_WRITE);
+    TimerStopAndLog(SMT64_READ_KV_BENCHMARK);
+
+    TimerStart(SMT64_COMPACTION_BENCHMARK);
+    numberOfFailedTests += Smt64CompactionBenchmark(config, SMT64_COMPACTION_BENCHMARK_NUMBER_OF_WRITES, SMT64_COMPACTION_BENCHMARK_NUMBER_OF_KEYS, SMT64_COMPACTION_BENCHMARK_KEYS_PER_WRITE, SMT64_COMPACTION_BENCHMARK_MAX_VERSIONS, false);
+    numberOfFailedTests += Smt64CompactionBenchmark(config, SMT64_COMPACTION_BENCHMARK_NUMBER_OF_WRITES, SMT64_COMPACTION_BENCHMARK_NUMBER_OF_KEYS, SMT64_COMPACTION_BENCHMARK_KEYS_PER_WRITE, SMT64_COMPACTION_BENCHMARK_MAX_VERSIONS, true);
+    TimerStopAndLog(SMT64_COMPACTION_BENCHMARK);
+
     TimerStopAndLog(SMT64_TEST);
 
     return numberOfFailedTests;
@@ -356,6 +356,12 @@ bool ExecutorClient::ProcessBatch (const string &inputFile)
     #ifdef LOG_SERVICE
             cout << "ExecutorClient::ProcessBatch() got:\n" << response.DebugString() << endl;
     #endif
+
+            // Process the same batch in streaming mode, and check it against the previous response
+            if (config.executorClientStream && !ProcessBatchV2Stream(request, processBatchResponse))
+            {
+                return false;
+            }
         }
 
         // Store the hash at the end of each block
@@ -626,6 +632,73 @@ bool ProcessDirectory (ExecutorClient *pClient, const string &directoryName, uin
     return true;
 }
 
+bool ExecutorClient::ProcessBatchV2Stream (const ::executor::v1::ProcessBatchRequestV2 &request, const ::executor::v1::ProcessBatchResponseV2 &expectedResponse)
+{
+    ::grpc::ClientContext context;
+    std::unique_ptr< ::grpc::ClientReader< ::executor::v1::ProcessBatchV2StreamResponse> > reader(stub->ProcessBatchV2Stream(&context, request));
+
+    ::executor::v1::ProcessBatchV2StreamResponse message;
+    int64_t nBlocks = 0;
+    uint64_t nBatchResponses = 0;
+    bool bResult = true;
+    while (reader->Read(&message))
+    {
+        if (message.has_block_response())
+        {
+            if (nBatchResponses > 0)
+            {
+                zklog.error("ExecutorClient::ProcessBatchV2Stream() got block response " + to_string(nBlocks) + " after the batch response");
+                bResult = false;
+            }
+            else if ((nBlocks >= expectedResponse.block_responses_size()) ||
+                     (message.block_response().block_hash() != expectedResponse.block_responses(nBlocks).block_hash()) ||
+                     (message.block_response().responses_size() != expectedResponse.block_responses(nBlocks).responses_size()))
+            {
+                zklog.error("ExecutorClient::ProcessBatchV2Stream() got block response " + to_string(nBlocks) + " with hash=" + ba2string(message.block_response().block_hash()) + " that does not match the ProcessBatchV2() one");
+                bResult = false;
+            }
+            nBlocks++;
+        }
+        else if (message.has_batch_response())
+        {
+            nBatchResponses++;
+            if (message.batch_response().block_responses_size() != 0)
+            {
+                zklog.error("ExecutorClient::ProcessBatchV2Stream() got a batch response with " + to_string(message.batch_response().block_responses_size()) + " block responses");
+                bResult = false;
+            }
+            if ((message.batch_response().error() != expectedResponse.error()) || (message.batch_response().new_state_root() != expectedResponse.new_state_root()))
+            {
+                zklog.error("ExecutorClient::ProcessBatchV2Stream() got a batch response with error=" + to_string(message.batch_response().error()) + " new_state_root=" + ba2string(message.batch_response().new_state_root()) + " that does not match the ProcessBatchV2() one");
+                bResult = false;
+            }
+        }
+        else
+        {
+            zklog.error("ExecutorClient::ProcessBatchV2Stream() got an empty message");
+            bResult = false;
+        }
+    }
+
+    ::grpc::Status grpcStatus = reader->Finish();
+    if (grpcStatus.error_code() != grpc::StatusCode::OK)
+    {
+        zklog.error("ExecutorClient::ProcessBatchV2Stream() failed calling server error=" + to_string(grpcStatus.error_code()) + "=" + grpcStatus.error_message());
+        return false;
+    }
+    if ((nBlocks != expectedResponse.block_responses_size()) || (nBatchResponses != 1))
+    {
+        zklog.error("ExecutorClient::ProcessBatchV2Stream() got nBlocks=" + to_string(nBlocks) + " nBatchResponses=" + to_string(nBatchResponses) + " instead of nBlocks=" + to_string(expectedResponse.block_responses_size()) + " nBatchResponses=1");
+        return false;
+    }
+
+    if (bResult)
+    {
+        zklog.info("ExecutorClient::ProcessBatchV2Stream() got the " + to_string(nBlocks) + " blocks of ProcessBatchV2(), followed by the batch response");
+    }
+    return bResult;
+}
+
 void* executorClientThread (void* arg)
 {
     zklog.info("executorClientThread() started");
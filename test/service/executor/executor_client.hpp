@@ -35,6 +35,10 @@ public:
     int64_t waitForThreads (void);
 
     bool ProcessBatch (const string &inputFile);
+
+    // Calls ProcessBatchV2Stream() and checks that it returns the blocks of the ProcessBatchV2() response, in
+    // the same order, followed by one batch response without blocks
+    bool ProcessBatchV2Stream (const ::executor::v1::ProcessBatchRequestV2 &request, const ::executor::v1::ProcessBatchResponseV2 &expectedResponse);
 };
 
 void* executorClientThread  (void* arg); // One process batch
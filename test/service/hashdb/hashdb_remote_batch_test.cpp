@@ -0,0 +1,151 @@
+#include <unistd.h>
+#include "hashdb_remote_batch_test.hpp"
+#include "hashdb_remote.hpp"
+#include "zklog.hpp"
+#include "zkresult.hpp"
+#include "scalar.hpp"
+#include "utils.hpp"
+#include "timer.hpp"
+#include "zkmax.hpp"
+
+#define HASHDB_REMOTE_BATCH_TEST_NUMBER_OF_KEYS 1000
+
+uint64_t HashDBRemoteBatchTest (const Config& config)
+{
+    zklog.info("HashDBRemoteBatchTest() started");
+
+    if (config.hashDBURL == "local")
+    {
+        zklog.info("HashDBRemoteBatchTest() skipped, since it requires a remote hashDBURL");
+        return 0;
+    }
+
+    Goldilocks fr;
+    PoseidonGoldilocks poseidon;
+    zkresult zkr;
+    Persistence persistence = PERSISTENCE_DATABASE;
+    uint64_t numberOfFailedTests = 0;
+    uint64_t flushId, storedFlushId;
+    uint64_t block = 0;
+    uint64_t tx = 0;
+
+    // One client per mode
+    Config singleConfig = config;
+    singleConfig.hashDBRemoteBatch = false;
+    Config batchConfig = config;
+    batchConfig.hashDBRemoteBatch = true;
+    HashDBRemote singleClient(fr, singleConfig);
+    HashDBRemote batchClient(fr, batchConfig);
+
+    // Build the keys and write them
+    vector<KeyValue> keyValues;
+    Goldilocks::Element keyfea[12];
+    for (uint64_t i=0; i<12; i++) keyfea[i] = fr.zero();
+    Goldilocks::Element root[4] = {fr.zero(), fr.zero(), fr.zero(), fr.zero()};
+    string batchUUID = getUUID();
+    for (uint64_t i=0; i<HASHDB_REMOTE_BATCH_TEST_NUMBER_OF_KEYS; i++)
+    {
+        KeyValue keyValue;
+        keyfea[0] = fr.fromU64(i);
+        poseidon.hash(keyValue.key, keyfea);
+        keyValue.value = i + 1;
+        zkr = singleClient.set(batchUUID, block, tx, root, keyValue.key, keyValue.value, persistence, root, NULL, NULL);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("HashDBRemoteBatchTest() failed calling set() i=" + to_string(i) + " result=" + zkresult2string(zkr));
+            return 1;
+        }
+        keyValues.emplace_back(keyValue);
+    }
+    singleClient.flush(batchUUID, fea2string(fr, root), persistence, flushId, storedFlushId);
+
+    struct timeval t;
+
+    // Single gets, i.e. one round trip per key
+    TimerStart(HASHDB_REMOTE_BATCH_TEST_SINGLE_GETS);
+    gettimeofday(&t, NULL);
+    batchUUID = getUUID();
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        mpz_class value;
+        zkr = singleClient.get(batchUUID, root, keyValues[i].key, value, NULL, NULL);
+        if ((zkr != ZKR_SUCCESS) || (value != keyValues[i].value))
+        {
+            zklog.error("HashDBRemoteBatchTest() single get i=" + to_string(i) + " got value=" + value.get_str(16) + " result=" + zkresult2string(zkr));
+            numberOfFailedTests++;
+        }
+    }
+    uint64_t singleGetsTime = TimeDiff(t);
+    TimerStopAndLog(HASHDB_REMOTE_BATCH_TEST_SINGLE_GETS);
+
+    // GetBatch, i.e. one round trip for all the keys
+    TimerStart(HASHDB_REMOTE_BATCH_TEST_GET_BATCH);
+    gettimeofday(&t, NULL);
+    batchUUID = getUUID();
+    vector<KeyValue> batchKeyValues = keyValues;
+    for (uint64_t i=0; i<batchKeyValues.size(); i++) batchKeyValues[i].value = 0;
+    zkr = batchClient.getBatch(batchUUID, root, batchKeyValues, NULL);
+    if (zkr != ZKR_SUCCESS)
+    {
+        zklog.error("HashDBRemoteBatchTest() failed calling getBatch() result=" + zkresult2string(zkr));
+        numberOfFailedTests++;
+    }
+    for (uint64_t i=0; i<batchKeyValues.size(); i++)
+    {
+        if (batchKeyValues[i].value != keyValues[i].value)
+        {
+            zklog.error("HashDBRemoteBatchTest() getBatch i=" + to_string(i) + " got value=" + batchKeyValues[i].value.get_str(16));
+            numberOfFailedTests++;
+        }
+    }
+    uint64_t getBatchTime = TimeDiff(t);
+    batchClient.flush(batchUUID, fea2string(fr, root), persistence, flushId, storedFlushId);
+    TimerStopAndLog(HASHDB_REMOTE_BATCH_TEST_GET_BATCH);
+
+    // Overlay, i.e. the previous batch touched the same keys, so they are prefetched in one round trip;
+    // then a set is done, and the keys are read again from the new root without any round trip
+    TimerStart(HASHDB_REMOTE_BATCH_TEST_OVERLAY);
+    gettimeofday(&t, NULL);
+    batchUUID = getUUID();
+    Goldilocks::Element newRoot[4];
+    mpz_class newValue = 0xFFFF;
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        mpz_class value;
+        zkr = batchClient.get(batchUUID, root, keyValues[i].key, value, NULL, NULL);
+        if ((zkr != ZKR_SUCCESS) || (value != keyValues[i].value))
+        {
+            zklog.error("HashDBRemoteBatchTest() overlay get i=" + to_string(i) + " got value=" + value.get_str(16) + " result=" + zkresult2string(zkr));
+            numberOfFailedTests++;
+        }
+    }
+    zkr = batchClient.set(batchUUID, block, tx, root, keyValues[0].key, newValue, persistence, newRoot, NULL, NULL);
+    if (zkr != ZKR_SUCCESS)
+    {
+        zklog.error("HashDBRemoteBatchTest() failed calling overlay set() result=" + zkresult2string(zkr));
+        numberOfFailedTests++;
+    }
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        mpz_class value;
+        zkr = batchClient.get(batchUUID, newRoot, keyValues[i].key, value, NULL, NULL);
+        mpz_class expectedValue = (i == 0) ? newValue : keyValues[i].value;
+        if ((zkr != ZKR_SUCCESS) || (value != expectedValue))
+        {
+            zklog.error("HashDBRemoteBatchTest() overlay get after set i=" + to_string(i) + " got value=" + value.get_str(16) + " result=" + zkresult2string(zkr));
+            numberOfFailedTests++;
+        }
+    }
+    uint64_t overlayTime = TimeDiff(t);
+    batchClient.cancelBatch(batchUUID);
+    TimerStopAndLog(HASHDB_REMOTE_BATCH_TEST_OVERLAY);
+
+    // Latency per key of every mode; the overlay reads every key twice
+    uint64_t numberOfKeys = zkmax(keyValues.size(), (uint64_t)1);
+    zklog.info("HashDBRemoteBatchTest() latency per key: singleGets=" + to_string(double(singleGetsTime)/numberOfKeys) + "us getBatch=" + to_string(double(getBatchTime)/numberOfKeys) +
+        "us overlay=" + to_string(double(overlayTime)/(2*numberOfKeys)) + "us");
+
+    zklog.info("HashDBRemoteBatchTest() done keys=" + to_string(keyValues.size()) + " numberOfFailedTests=" + to_string(numberOfFailedTests));
+
+    return numberOfFailedTests;
+}
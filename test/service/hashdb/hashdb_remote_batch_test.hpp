@@ -0,0 +1,9 @@
+#ifndef HASHDB_REMOTE_BATCH_TEST_HPP
+#define HASHDB_REMOTE_BATCH_TEST_HPP
+
+#include "config.hpp"
+
+// Compares the latency of single remote gets, GetBatch and the batch overlay; requires a remote hashDBURL
+uint64_t HashDBRemoteBatchTest (const Config& config);
+
+#endif
@@ -13,6 +13,7 @@
 #include "hashdb64_workflow_test.hpp"
 #include "hashdb64_simple_workflow_test.hpp"
 #include "hashdb_program_test.hpp"
+#include "hashdb_remote_batch_test.hpp"
 
 uint64_t HashDBTest (const Config& config)
 {
@@ -27,6 +28,10 @@ uint64_t HashDBTest (const Config& config)
     
     //numberOfFailedTests += HashDBTestMultiWrite(config);
     //numberOfFailedTests += HashDBProgramTest(config);
+    if (config.runHashDBRemoteBatchTest)
+    {
+        numberOfFailedTests += HashDBRemoteBatchTest(config);
+    }
     numberOfFailedTests += HashDB64WorkflowTest(config);
     //numberOfFailedTests += HashDB64SimpleWorkflowTest(config);
     return numberOfFailedTests;
@@ -7,6 +7,8 @@
 #include "smt_action_list.hpp"
 #include "scalar.hpp"
 #include "zkassert.hpp"
+#include "timer.hpp"
+#include "storage_rom.hpp"
 
 using namespace std;
 
@@ -16,6 +18,7 @@ void StorageSM_ZeroToZero2Test (Goldilocks &fr, PoseidonGoldilocks &poseidon, co
 void StorageSM_ZeroToZeroTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config);
 void StorageSM_EmptyTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config);
 void StorageSM_UseCaseTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config);
+void StorageSM_BenchmarkTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config);
 
 uint64_t StorageSMTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config)
 {
@@ -27,6 +30,7 @@ uint64_t StorageSMTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Conf
     StorageSM_ZeroToZeroTest(fr, poseidon, config);
     StorageSM_EmptyTest(fr, poseidon, config);
     StorageSM_UseCaseTest(fr, poseidon, config);
+    StorageSM_BenchmarkTest(fr, poseidon, config);
 
     cout << "StorageSMTest done" << endl;
     return numberOfErrors;
@@ -927,4 +931,113 @@ void StorageSM_GetZeroTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const
     storageExecutor.execute(actionList.action);
 
     cout << "StorageSM_GetZeroTest done" << endl;
-};
\ No newline at end of file
+};
+
+/* Measures the storage executor with a storage-heavy action list, and compares the cost of the ROM
+   line dispatch by function name strings, as the executor used to do at every evaluation, with the
+   dispatch by the function codes compiled at load time */
+void StorageSM_BenchmarkTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config)
+{
+    cout << "StorageSM_BenchmarkTest starting..." << endl;
+
+    string uuid = getUUID();
+    uint64_t block = 0;
+    uint64_t tx = 0;
+    Smt smt(fr);
+    Database db(fr, config);
+    db.init();
+    SmtActionList actionList;
+    SmtSetResult setResult;
+    SmtGetResult getResult;
+    Goldilocks::Element root[4]={0,0,0,0};
+    Goldilocks::Element key[4];
+    mpz_class keyScalar;
+    mpz_class value;
+
+    // Insert, read and update many keys, so that the tree has several levels
+    const uint64_t numberOfKeys = 256;
+    for (uint64_t k=0; k<numberOfKeys; k++)
+    {
+        keyScalar = (uint64_t)(k*0x9E3779B97F4A7C15ULL + 1);
+        scalar2key(fr, keyScalar, key);
+        value = k + 1;
+        smt.set(uuid, block, tx, db, root, key, value, PERSISTENCE_CACHE, setResult);
+        actionList.addSetAction(setResult);
+        for (uint64_t i=0; i<4; i++) root[i] = setResult.newRoot[i];
+    }
+    for (uint64_t k=0; k<numberOfKeys; k++)
+    {
+        keyScalar = (uint64_t)(k*0x9E3779B97F4A7C15ULL + 1);
+        scalar2key(fr, keyScalar, key);
+        smt.get(uuid, db, root, key, getResult);
+        actionList.addGetAction(getResult);
+        zkassertpermanent(getResult.value == k + 1);
+        value = k + 2;
+        smt.set(uuid, block, tx, db, root, key, value, PERSISTENCE_CACHE, setResult);
+        actionList.addSetAction(setResult);
+        for (uint64_t i=0; i<4; i++) root[i] = setResult.newRoot[i];
+    }
+
+    StorageExecutor storageExecutor(fr, poseidon, config);
+    TimerStart(STORAGE_SM_BENCHMARK_EXECUTE);
+    storageExecutor.execute(actionList.action);
+    TimerStopAndLog(STORAGE_SM_BENCHMARK_EXECUTE);
+
+    // Compare the ROM line dispatch methods over as many evaluations as the executor performs
+    json romJson;
+    file2json(config.storageRomFile, romJson);
+    StorageRom rom;
+    rom.load(romJson);
+    const uint64_t N = StorageCommitPols::pilDegree();
+    const uint64_t numberOfFunctions = srf_isAlmostEndPolynomial + 1;
+    vector<string> functionNames;
+    for (uint64_t f=0; f<numberOfFunctions; f++)
+    {
+        functionNames.push_back(storageRomFunction2String((tStorageRomFunction)f));
+    }
+
+    uint64_t stringSum = 0;
+    TimerStart(STORAGE_SM_BENCHMARK_STRING_DISPATCH);
+    for (uint64_t i=0; i<N; i++)
+    {
+        const StorageRomLine &romLine = rom.line[i % rom.line.size()];
+        if (romLine.inFREE && (romLine.op == "functionCall"))
+        {
+            for (uint64_t f=1; f<numberOfFunctions; f++)
+            {
+                if (romLine.funcName == functionNames[f])
+                {
+                    stringSum += f;
+                    break;
+                }
+            }
+        }
+        if (romLine.CONST != "")
+        {
+            mpz_class constScalar;
+            constScalar.set_str(romLine.CONST, 10);
+            stringSum += constScalar.get_si();
+        }
+    }
+    TimerStopAndLog(STORAGE_SM_BENCHMARK_STRING_DISPATCH);
+
+    uint64_t codeSum = 0;
+    TimerStart(STORAGE_SM_BENCHMARK_CODE_DISPATCH);
+    for (uint64_t i=0; i<N; i++)
+    {
+        const StorageRomLine &romLine = rom.line[i % rom.line.size()];
+        if (romLine.inFREE && (romLine.opCode == sro_functionCall))
+        {
+            codeSum += romLine.funcCode;
+        }
+        if (romLine.bConst)
+        {
+            codeSum += romLine.constValue;
+        }
+    }
+    TimerStopAndLog(STORAGE_SM_BENCHMARK_CODE_DISPATCH);
+
+    zkassertpermanent(stringSum == codeSum);
+
+    cout << "StorageSM_BenchmarkTest done actions=" << actionList.action.size() << " evaluations=" << N << endl;
+};
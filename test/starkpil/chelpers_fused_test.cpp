@@ -0,0 +1,166 @@
+#include <random>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include "chelpers_fused_test.hpp"
+#include "zkevmSteps.hpp"
+#include "stark_info.hpp"
+#include "polinomial.hpp"
+#include "zhInv.hpp"
+#include "timer.hpp"
+#include "utils.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
+#include "exit_process.hpp"
+
+// Number of extended rows evaluated by both parsers, and number of rows filled at the beginning and at the end of
+// every section, so that the rows reached through the next/previous row offsets hold random values as well
+#define CHELPERS_FUSED_TEST_ROWS (1 << 16)
+#define CHELPERS_FUSED_TEST_MARGIN_ROWS 64
+
+// Fills the first and last rows of a row-major buffer of degree rows and nCols columns with random field elements
+void ChelpersFusedTestFill (Goldilocks::Element *pBuffer, uint64_t degree, uint64_t nCols, uint64_t rows, std::mt19937_64 &gen)
+{
+    std::uniform_int_distribution<uint64_t> dist(0, GOLDILOCKS_PRIME - 1);
+    uint64_t firstRows = zkmin(degree, rows + CHELPERS_FUSED_TEST_MARGIN_ROWS);
+    uint64_t lastRow = degree > CHELPERS_FUSED_TEST_MARGIN_ROWS ? degree - CHELPERS_FUSED_TEST_MARGIN_ROWS : 0;
+    for (uint64_t r = 0; r < degree; r++)
+    {
+        if ((r >= firstRows) && (r < lastRow))
+        {
+            r = lastRow;
+        }
+        for (uint64_t c = 0; c < nCols; c++)
+        {
+            pBuffer[r * nCols + c] = Goldilocks::fromU64(dist(gen));
+        }
+    }
+}
+
+// Evaluates the step 4 constraint polynomial over the zkevm stark info layout with random committed, constant and
+// challenge values, using both the original and the fused compiled-in parsers, checks that they compute the same
+// q_2ns and logs their duration
+uint64_t ChelpersFusedTest (const Config &config)
+{
+    TimerStart(CHELPERS_FUSED_TEST);
+
+    uint64_t numberOfFailedTests = 0;
+
+    if (!fileExists(config.zkevmStarkInfo))
+    {
+        zklog.warning("ChelpersFusedTest() skipping missing stark info file " + config.zkevmStarkInfo);
+        TimerStopAndLog(CHELPERS_FUSED_TEST);
+        return 0;
+    }
+
+    StarkInfo starkInfo(config, config.zkevmStarkInfo);
+    uint64_t N = 1 << starkInfo.starkStruct.nBits;
+    uint64_t NExtended = 1 << starkInfo.starkStruct.nBitsExt;
+    uint64_t rows = zkmin(NExtended, uint64_t(CHELPERS_FUSED_TEST_ROWS));
+
+    // The parsers address the committed polynomials through the absolute offsets of the stark info, so map the
+    // whole area without reserving it and only fill the rows that are going to be read
+    uint64_t polsSize = starkInfo.mapTotalN * sizeof(Goldilocks::Element);
+    Goldilocks::Element *pPols = (Goldilocks::Element *)mmap(NULL, polsSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (pPols == MAP_FAILED)
+    {
+        zklog.error("ChelpersFusedTest() failed calling mmap() of size=" + to_string(polsSize));
+        exitProcess();
+    }
+    uint64_t constPolsSize = NExtended * starkInfo.nConstants * sizeof(Goldilocks::Element);
+    Goldilocks::Element *pConstPolsAddress = (Goldilocks::Element *)mmap(NULL, constPolsSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (pConstPolsAddress == MAP_FAILED)
+    {
+        zklog.error("ChelpersFusedTest() failed calling mmap() of size=" + to_string(constPolsSize));
+        exitProcess();
+    }
+
+    std::mt19937_64 gen(0);
+    for (uint64_t s = 0; s < eSectionMax; s++)
+    {
+        if ((starkInfo.mapSectionsN.section[s] == 0) || (starkInfo.mapDeg.section[s] == 0))
+        {
+            continue;
+        }
+        ChelpersFusedTestFill(pPols + starkInfo.mapOffsets.section[s], starkInfo.mapDeg.section[s], starkInfo.mapSectionsN.section[s], rows, gen);
+    }
+    ChelpersFusedTestFill(pConstPolsAddress, NExtended, starkInfo.nConstants, rows, gen);
+    ConstantPolsStarks constPols2ns(pConstPolsAddress, NExtended, starkInfo.nConstants);
+
+    Polinomial challenges(NUM_CHALLENGES, FIELD_EXTENSION);
+    ChelpersFusedTestFill(challenges.address(), NUM_CHALLENGES, FIELD_EXTENSION, NUM_CHALLENGES, gen);
+    Polinomial x_2ns(NExtended, 1);
+    ChelpersFusedTestFill(x_2ns.address(), NExtended, 1, rows, gen);
+    vector<Goldilocks::Element> publicInputs(starkInfo.nPublics);
+    ChelpersFusedTestFill(publicInputs.data(), starkInfo.nPublics, 1, starkInfo.nPublics, gen);
+    ZhInv zi(starkInfo.starkStruct.nBits, starkInfo.starkStruct.nBitsExt);
+
+    // Step 4 does not read these
+    Polinomial x_n;
+    Polinomial evals;
+    Polinomial xDivXSubXi;
+    Polinomial xDivXSubWXi;
+
+    // The parsers write q_2ns as (i + j) * FIELD_EXTENSION, so a buffer of the evaluated rows is enough
+    vector<Goldilocks::Element> q(rows * FIELD_EXTENSION, Goldilocks::zero());
+    vector<Goldilocks::Element> qFused(rows * FIELD_EXTENSION, Goldilocks::zero());
+
+    StepsParams params = {
+        pols : pPols,
+        pConstPols : NULL,
+        pConstPols2ns : &constPols2ns,
+        challenges : challenges,
+        x_n : x_n,
+        x_2ns : x_2ns,
+        zi : zi,
+        evals : evals,
+        xDivXSubXi : xDivXSubXi,
+        xDivXSubWXi : xDivXSubWXi,
+        publicInputs : publicInputs.data(),
+        q_2ns : q.data(),
+        f_2ns : NULL
+    };
+
+    ZkevmSteps steps;
+
+    // Warm up the mapped pages and the caches with a first untimed run
+    steps.step42ns_parser_first_avx(params, rows, 4);
+
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    steps.step42ns_parser_first_avx(params, rows, 4);
+    uint64_t originalTime = TimeDiff(t);
+
+    params.q_2ns = qFused.data();
+    gettimeofday(&t, NULL);
+    steps.step42ns_parser_first_avx_fused(params, rows, 4);
+    uint64_t fusedTime = TimeDiff(t);
+
+    for (uint64_t i = 0; i < rows * FIELD_EXTENSION; i++)
+    {
+        if (!Goldilocks::equal(q[i], qFused[i]))
+        {
+            zklog.error("ChelpersFusedTest() found q_2ns mismatch at row=" + to_string(i / FIELD_EXTENSION) + " index=" + to_string(i % FIELD_EXTENSION) +
+                " original=" + Goldilocks::toString(q[i]) + " fused=" + Goldilocks::toString(qFused[i]));
+            numberOfFailedTests++;
+            break;
+        }
+    }
+
+    zklog.info("ChelpersFusedTest() N=" + to_string(N) + " NExtended=" + to_string(NExtended) + " rows=" + to_string(rows) +
+        " original=" + to_string(originalTime) + "us=" + to_string(double(originalTime) * 1000 / rows) + "ns/row" +
+        " fused=" + to_string(fusedTime) + "us=" + to_string(double(fusedTime) * 1000 / rows) + "ns/row" +
+        " speedup=" + to_string(double(originalTime) / (fusedTime == 0 ? 1 : fusedTime)) +
+        " equal=" + to_string(numberOfFailedTests == 0));
+
+    munmap(pConstPolsAddress, constPolsSize);
+    munmap(pPols, polsSize);
+
+    if (numberOfFailedTests != 0)
+    {
+        zklog.error("ChelpersFusedTest() failed");
+    }
+
+    TimerStopAndLog(CHELPERS_FUSED_TEST);
+
+    return numberOfFailedTests;
+}
@@ -0,0 +1,9 @@
+#ifndef CHELPERS_FUSED_TEST_HPP
+#define CHELPERS_FUSED_TEST_HPP
+
+#include <cstdint>
+#include "config.hpp"
+
+uint64_t ChelpersFusedTest (const Config &config);
+
+#endif
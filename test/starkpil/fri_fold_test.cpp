@@ -0,0 +1,94 @@
+#include <random>
+#include "fri_fold_test.hpp"
+#include "friFold.hpp"
+#include "stark_info.hpp"
+#include "polinomial.hpp"
+#include "timer.hpp"
+#include "utils.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
+
+// Folds a random polynomial with every step configuration of the stark info file, using both the evaluation form
+// kernel and the reference INTT + Horner implementation, checks they match and logs their duration
+uint64_t FRIFoldStarkInfoTest (const Config &config, const string &starkInfoFile)
+{
+    uint64_t numberOfFailedTests = 0;
+
+    if (!fileExists(starkInfoFile))
+    {
+        zklog.warning("FRIFoldStarkInfoTest() skipping missing stark info file " + starkInfoFile);
+        return 0;
+    }
+
+    StarkInfo starkInfo(config, starkInfoFile);
+
+    std::mt19937_64 gen(0);
+    std::uniform_int_distribution<uint64_t> dist(0, GOLDILOCKS_PRIME - 1);
+
+    Goldilocks::Element shiftInv = Goldilocks::inv(Goldilocks::shift());
+    for (uint64_t si = 1; si < starkInfo.starkStruct.steps.size(); si++)
+    {
+        uint64_t polBits = starkInfo.starkStruct.steps[si - 1].nBits;
+        uint64_t reductionBits = polBits - starkInfo.starkStruct.steps[si].nBits;
+        uint64_t pol2N = 1 << starkInfo.starkStruct.steps[si].nBits;
+
+        Polinomial friPol(1 << polBits, FIELD_EXTENSION);
+        for (uint64_t i = 0; i < friPol.length(); i++)
+        {
+            friPol.address()[i] = Goldilocks::fromU64(dist(gen));
+        }
+        Polinomial challenge(1, FIELD_EXTENSION);
+        for (uint64_t i = 0; i < FIELD_EXTENSION; i++)
+        {
+            challenge.address()[i] = Goldilocks::fromU64(dist(gen));
+        }
+
+        Polinomial pol2_e(pol2N, FIELD_EXTENSION);
+        Polinomial pol2_eNTT(pol2N, FIELD_EXTENSION);
+
+        struct timeval t;
+        gettimeofday(&t, NULL);
+        FRIFold friFold(reductionBits);
+        friFold.fold(pol2_e, friPol, polBits, shiftInv, challenge);
+        uint64_t foldTime = TimeDiff(t);
+
+        gettimeofday(&t, NULL);
+        FRIFold friFoldNTT(reductionBits);
+        friFoldNTT.foldNTT(pol2_eNTT, friPol, polBits, shiftInv, challenge);
+        uint64_t foldNTTTime = TimeDiff(t);
+
+        for (uint64_t i = 0; i < pol2_e.length(); i++)
+        {
+            if (Goldilocks::toU64(pol2_e.address()[i]) != Goldilocks::toU64(pol2_eNTT.address()[i]))
+            {
+                zklog.error("FRIFoldStarkInfoTest() file=" + starkInfoFile + " step=" + to_string(si) + " found mismatch at i=" + to_string(i));
+                numberOfFailedTests++;
+                break;
+            }
+        }
+
+        zklog.info("FRIFoldStarkInfoTest() file=" + starkInfoFile + " step=" + to_string(si) + " polBits=" + to_string(polBits) + " reductionBits=" + to_string(reductionBits) +
+            " fold=" + to_string(foldTime) + "us foldNTT=" + to_string(foldNTTTime) + "us speedup=" + to_string(double(foldNTTTime) / zkmax(foldTime, (uint64_t)1)));
+
+        shiftInv = Goldilocks::exp(shiftInv, 1 << reductionBits);
+    }
+
+    return numberOfFailedTests;
+}
+
+uint64_t FRIFoldTest (const Config &config)
+{
+    TimerStart(FRI_FOLD_TEST);
+
+    uint64_t numberOfFailedTests = 0;
+    numberOfFailedTests += FRIFoldStarkInfoTest(config, config.zkevmStarkInfo);
+    numberOfFailedTests += FRIFoldStarkInfoTest(config, config.c12aStarkInfo);
+    numberOfFailedTests += FRIFoldStarkInfoTest(config, config.recursive1StarkInfo);
+    numberOfFailedTests += FRIFoldStarkInfoTest(config, config.recursive2StarkInfo);
+    numberOfFailedTests += FRIFoldStarkInfoTest(config, config.recursivefStarkInfo);
+
+    zklog.info("FRIFoldTest() done, numberOfFailedTests=" + to_string(numberOfFailedTests));
+
+    TimerStopAndLog(FRI_FOLD_TEST);
+    return numberOfFailedTests;
+}
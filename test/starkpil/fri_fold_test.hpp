@@ -0,0 +1,9 @@
+#ifndef FRI_FOLD_TEST_HPP
+#define FRI_FOLD_TEST_HPP
+
+#include <cstdint>
+#include "config.hpp"
+
+uint64_t FRIFoldTest (const Config &config);
+
+#endif
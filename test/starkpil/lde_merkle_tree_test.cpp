@@ -0,0 +1,105 @@
+#include <random>
+#include "lde_merkle_tree_test.hpp"
+#include "starks.hpp"
+#include "timer.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
+
+// Extends random polynomials and builds their merkle tree with Starks::extendPolAndMerkelize(), and with
+// ntt.extendPol() followed by merkelize(), checks that the extended polynomials and the roots match and logs
+// their duration
+uint64_t LDEMerkleTreeCase (uint64_t nBits, uint64_t nBitsExt, uint64_t ncols, uint64_t tileSize)
+{
+    uint64_t N = 1 << nBits;
+    uint64_t NExtended = 1 << nBitsExt;
+    string testName = "nBits=" + to_string(nBits) + " nBitsExt=" + to_string(nBitsExt) + " ncols=" + to_string(ncols) + " tileSize=" + to_string(tileSize);
+
+    std::mt19937_64 gen(nBits*1000 + ncols);
+    std::uniform_int_distribution<uint64_t> dist(0, GOLDILOCKS_PRIME - 1);
+
+    Goldilocks::Element *pSrc = (Goldilocks::Element *)malloc(N * ncols * sizeof(Goldilocks::Element));
+    Goldilocks::Element *pDst = (Goldilocks::Element *)malloc(NExtended * ncols * sizeof(Goldilocks::Element));
+    Goldilocks::Element *pDstFused = (Goldilocks::Element *)malloc(NExtended * ncols * sizeof(Goldilocks::Element));
+    Goldilocks::Element *pBuffer = (Goldilocks::Element *)malloc(NExtended * ncols * sizeof(Goldilocks::Element));
+    if ((pSrc == NULL) || (pDst == NULL) || (pDstFused == NULL) || (pBuffer == NULL))
+    {
+        zklog.error("LDEMerkleTreeCase() failed calling malloc() " + testName);
+        exitProcess();
+    }
+    for (uint64_t i = 0; i < N * ncols; i++)
+    {
+        pSrc[i] = Goldilocks::fromU64(dist(gen));
+    }
+
+    NTT_Goldilocks ntt(N);
+
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    MerkleTreeGL tree(NExtended, ncols, pDst);
+    ntt.extendPol(pDst, pSrc, NExtended, N, ncols, pBuffer);
+    tree.merkelize();
+    uint64_t separateTime = TimeDiff(t);
+
+    gettimeofday(&t, NULL);
+    MerkleTreeGL treeFused(NExtended, ncols, pDstFused);
+    Starks::extendPolAndMerkelize(ntt, nBits, nBitsExt, tileSize, pDstFused, pSrc, ncols, pBuffer, &treeFused);
+    uint64_t fusedTime = TimeDiff(t);
+
+    uint64_t numberOfFailedTests = 0;
+
+    for (uint64_t i = 0; i < NExtended * ncols; i++)
+    {
+        if (Goldilocks::toU64(pDst[i]) != Goldilocks::toU64(pDstFused[i]))
+        {
+            zklog.error("LDEMerkleTreeCase() " + testName + " found extended polynomial mismatch at row=" + to_string(i / ncols) + " col=" + to_string(i % ncols));
+            numberOfFailedTests++;
+            break;
+        }
+    }
+
+    Goldilocks::Element root[HASH_SIZE];
+    Goldilocks::Element rootFused[HASH_SIZE];
+    tree.getRoot(root);
+    treeFused.getRoot(rootFused);
+    for (uint64_t i = 0; i < HASH_SIZE; i++)
+    {
+        if (Goldilocks::toU64(root[i]) != Goldilocks::toU64(rootFused[i]))
+        {
+            zklog.error("LDEMerkleTreeCase() " + testName + " found root mismatch at i=" + to_string(i) + " root=" + Goldilocks::toString(root[i]) + " rootFused=" + Goldilocks::toString(rootFused[i]));
+            numberOfFailedTests++;
+            break;
+        }
+    }
+
+    zklog.info("LDEMerkleTreeCase() " + testName + " extendPol+merkelize=" + to_string(separateTime) + "us extendPolAndMerkelize=" + to_string(fusedTime) +
+        "us speedup=" + to_string(double(separateTime) / zkmax(fusedTime, (uint64_t)1)));
+
+    free(pSrc);
+    free(pDst);
+    free(pDstFused);
+    free(pBuffer);
+
+    return numberOfFailedTests;
+}
+
+uint64_t LDEMerkleTreeTest (void)
+{
+    TimerStart(LDE_MERKLE_TREE_TEST);
+
+    uint64_t numberOfFailedTests = 0;
+
+    // Small sizes and tiles, to get many tiles and column blocks, including a last block with fewer columns
+    numberOfFailedTests += LDEMerkleTreeCase(2, 3, 1, 64);
+    numberOfFailedTests += LDEMerkleTreeCase(6, 7, 5, 256);
+    numberOfFailedTests += LDEMerkleTreeCase(8, 10, 17, 1024);
+    numberOfFailedTests += LDEMerkleTreeCase(10, 11, 12, 2*1024);
+
+    // Sizes closer to the proofs, with the default tile size
+    numberOfFailedTests += LDEMerkleTreeCase(16, 17, 12, 2*1024*1024);
+    numberOfFailedTests += LDEMerkleTreeCase(18, 19, 100, 2*1024*1024);
+
+    zklog.info("LDEMerkleTreeTest() done, numberOfFailedTests=" + to_string(numberOfFailedTests));
+
+    TimerStopAndLog(LDE_MERKLE_TREE_TEST);
+    return numberOfFailedTests;
+}
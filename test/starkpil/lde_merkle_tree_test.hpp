@@ -0,0 +1,8 @@
+#ifndef LDE_MERKLE_TREE_TEST_HPP
+#define LDE_MERKLE_TREE_TEST_HPP
+
+#include <cstdint>
+
+uint64_t LDEMerkleTreeTest (void);
+
+#endif
@@ -0,0 +1,206 @@
+#include <random>
+#include <sys/time.h>
+#include "zkin_test.hpp"
+#include "proof2zkinStark.hpp"
+#include "goldilocks_cubic_extension.hpp"
+#include "timer.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
+
+#define ZKIN_TEST_N_QUERIES 64
+#define ZKIN_TEST_N_TREES 5
+#define ZKIN_TEST_TREE_BITS 20 // Depth of the first tree; every next tree is 4 bits shallower
+#define ZKIN_TEST_N_EVALS 200
+#define ZKIN_TEST_N_PUBLICS 44
+
+// Flattens a zkin JSON value in the same order json2FrGElements() does
+void ZkinTestFlatten (const ordered_json &j, vector<string> &values)
+{
+    if (j.is_array())
+    {
+        for (uint64_t i = 0; i < j.size(); i++)
+        {
+            ZkinTestFlatten(j[i], values);
+        }
+    }
+    else
+    {
+        values.push_back(j.get<string>());
+    }
+}
+
+// Checks the typed zkin has the same signals, in the same order and with the same values, as the JSON one
+uint64_t ZkinTestCompare (const string &name, ordered_json &jZkin, const Zkin &zkin)
+{
+    if (jZkin.size() != zkin.signals.size())
+    {
+        zklog.error("ZkinTestCompare() " + name + " found " + to_string(zkin.signals.size()) + " signals instead of " + to_string(jZkin.size()));
+        return 1;
+    }
+    uint64_t s = 0;
+    for (ordered_json::iterator it = jZkin.begin(); it != jZkin.end(); ++it, s++)
+    {
+        const ZkinSignal &signal = zkin.signals[s];
+        if (it.key() != signal.name)
+        {
+            zklog.error("ZkinTestCompare() " + name + " found signal " + signal.name + " instead of " + it.key());
+            return 1;
+        }
+        vector<string> values;
+        ZkinTestFlatten(it.value(), values);
+        if (values.size() != signal.size())
+        {
+            zklog.error("ZkinTestCompare() " + name + " found " + to_string(signal.size()) + " values of signal " + signal.name + " instead of " + to_string(values.size()));
+            return 1;
+        }
+        for (uint64_t i = 0; i < values.size(); i++)
+        {
+            if (values[i] != signal.toString(i))
+            {
+                zklog.error("ZkinTestCompare() " + name + " found value " + signal.toString(i) + " at " + signal.name + "[" + to_string(i) + "] instead of " + values[i]);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+Goldilocks::Element ZkinTestRandom (std::mt19937_64 &gen, const Goldilocks::Element &)
+{
+    return Goldilocks::fromU64(gen() % GOLDILOCKS_PRIME);
+}
+
+RawFr::Element ZkinTestRandom (std::mt19937_64 &gen, const RawFr::Element &)
+{
+    RawFr::Element e, factor;
+    RawFr::field.fromUI(e, gen());
+    RawFr::field.fromUI(factor, gen());
+    RawFr::field.mul(e, e, factor);
+    RawFr::field.mul(e, e, factor);
+    return e;
+}
+
+template <typename T>
+void ZkinTestRandom (std::mt19937_64 &gen, vector<T> &v)
+{
+    for (uint64_t i = 0; i < v.size(); i++)
+    {
+        v[i] = ZkinTestRandom(gen, v[i]);
+    }
+}
+
+template <typename T>
+void ZkinTestRandom (std::mt19937_64 &gen, vector<vector<T>> &v)
+{
+    for (uint64_t i = 0; i < v.size(); i++)
+    {
+        ZkinTestRandom(gen, v[i]);
+    }
+}
+
+string ZkinTestToString (const Goldilocks::Element &e)
+{
+    return Goldilocks::toString(e);
+}
+
+string ZkinTestToString (const RawFr::Element &e)
+{
+    return RawFr::field.toString(e);
+}
+
+// Fills a proof with random values, with the query layout of the recursion circuits: 5 trees at the first FRI
+// step, i.e. stages 1 to 4 plus the constant polynomials, and a single tree at every next step; the values of
+// every query are followed by the siblings in the buffer MerkleProof and MerkleProofC12 are built from
+template <typename Proof, typename MerkleProofType, typename Hash>
+void ZkinTestFillProof (Proof &proof, uint64_t siblingSize, bool bStage2, std::mt19937_64 &gen)
+{
+    ZkinTestRandom(gen, proof.proofs.root1);
+    ZkinTestRandom(gen, proof.proofs.root2);
+    ZkinTestRandom(gen, proof.proofs.root3);
+    ZkinTestRandom(gen, proof.proofs.root4);
+    ZkinTestRandom(gen, proof.proofs.evals);
+    ZkinTestRandom(gen, proof.proofs.fri.pol);
+    ZkinTestRandom(gen, proof.publics);
+
+    uint64_t nLinears[5] = {20, bStage2 ? 9 : 0, 30, 6, 40};
+    for (uint64_t t = 0; t < proof.proofs.fri.trees.size(); t++)
+    {
+        ZkinTestRandom(gen, proof.proofs.fri.trees[t].root);
+        uint64_t nSiblings = ZKIN_TEST_TREE_BITS - 4 * t;
+        uint64_t nTrees = (t == 0) ? 5 : 1;
+        for (uint64_t q = 0; q < ZKIN_TEST_N_QUERIES; q++)
+        {
+            vector<MerkleProofType> query;
+            for (uint64_t k = 0; k < nTrees; k++)
+            {
+                uint64_t nValues = (t == 0) ? nLinears[k] : FIELD_EXTENSION * 16;
+                vector<Goldilocks::Element> values(nValues);
+                vector<Hash> siblings(nSiblings * siblingSize);
+                ZkinTestRandom(gen, values);
+                ZkinTestRandom(gen, siblings);
+                vector<uint8_t> buffer(nValues * sizeof(Goldilocks::Element) + siblings.size() * sizeof(Hash));
+                memcpy(buffer.data(), values.data(), nValues * sizeof(Goldilocks::Element));
+                memcpy(buffer.data() + nValues * sizeof(Goldilocks::Element), siblings.data(), siblings.size() * sizeof(Hash));
+                query.push_back(MerkleProofType(nValues, nSiblings, (Goldilocks::Element *)buffer.data()));
+            }
+            proof.proofs.fri.trees[t].polQueries.push_back(query);
+        }
+    }
+}
+
+// Builds the zkin of the same proof both through JSON and typed, checks they match and logs the time of each
+template <typename Proof>
+uint64_t ZkinTestProof (const string &name, Proof &proof)
+{
+    struct timeval t;
+
+    gettimeofday(&t, NULL);
+    ordered_json jProof = proof.proofs.proof2json();
+    ordered_json jZkin = proof2zkinStark(jProof);
+    ordered_json jPublics = ordered_json::array();
+    for (uint64_t i = 0; i < proof.publics.size(); i++)
+    {
+        jPublics[i] = ZkinTestToString(proof.publics[i]);
+    }
+    jZkin["publics"] = jPublics;
+    uint64_t jsonTime = TimeDiff(t);
+
+    gettimeofday(&t, NULL);
+    Zkin zkin;
+    proof2zkinStark(proof, zkin);
+    zkin.addSignal("publics", zkinLimbs(proof.publics[0])).add(proof.publics);
+    uint64_t zkinTime = TimeDiff(t);
+
+    uint64_t numberOfFailedTests = ZkinTestCompare(name, jZkin, zkin);
+
+    zklog.info("ZkinTestProof() " + name + " signals=" + to_string(zkin.signals.size()) + " values=" + to_string(zkin.size()) + " json=" + to_string(jsonTime) +
+        "us zkin=" + to_string(zkinTime) + "us speedup=" + to_string(double(jsonTime) / zkmax(zkinTime, (uint64_t)1)));
+
+    return numberOfFailedTests;
+}
+
+uint64_t ZkinTest (void)
+{
+    TimerStart(ZKIN_TEST);
+
+    uint64_t numberOfFailedTests = 0;
+    std::mt19937_64 gen(0);
+
+    uint64_t polN = 1 << (ZKIN_TEST_TREE_BITS - 4 * (ZKIN_TEST_N_TREES - 1));
+    for (uint64_t bStage2 = 0; bStage2 <= 1; bStage2++)
+    {
+        FRIProof fproof(polN, FIELD_EXTENSION, ZKIN_TEST_N_TREES, ZKIN_TEST_N_EVALS, ZKIN_TEST_N_PUBLICS);
+        ZkinTestFillProof<FRIProof, MerkleProof, Goldilocks::Element>(fproof, HASH_SIZE, bStage2, gen);
+        numberOfFailedTests += ZkinTestProof(bStage2 ? "FRIProof" : "FRIProof(no stage 2)", fproof);
+
+        // The Merkle paths of the C12 proofs have 16 BN128 siblings per level
+        FRIProofC12 fproofC12(polN, FIELD_EXTENSION, ZKIN_TEST_N_TREES, ZKIN_TEST_N_EVALS, ZKIN_TEST_N_PUBLICS);
+        ZkinTestFillProof<FRIProofC12, MerkleProofC12, RawFr::Element>(fproofC12, 16, bStage2, gen);
+        numberOfFailedTests += ZkinTestProof(bStage2 ? "FRIProofC12" : "FRIProofC12(no stage 2)", fproofC12);
+    }
+
+    zklog.info("ZkinTest() done, numberOfFailedTests=" + to_string(numberOfFailedTests));
+
+    TimerStopAndLog(ZKIN_TEST);
+    return numberOfFailedTests;
+}
@@ -0,0 +1,8 @@
+#ifndef ZKIN_TEST_HPP
+#define ZKIN_TEST_HPP
+
+#include <cstdint>
+
+uint64_t ZkinTest (void);
+
+#endif
@@ -9,6 +9,7 @@
 #include "climb_key_test.hpp"
 #include "keccak_executor_test.hpp"
 #include "get_string_increment_test.hpp"
+#include "full_tracer_conversion_test.hpp"
 #include "database_cache_test.hpp"
 #include "hashdb_test.hpp"
 #include "key_utils_unit_tests.hpp"
@@ -52,6 +53,10 @@ uint64_t UnitTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &c
     numberOfErrors += GetStringIncrementTest();
     TimerStopAndLog(UNIT_TEST_GET_STRING_INCREMENT);
 
+    TimerStart(UNIT_TEST_FULL_TRACER_CONVERSION);
+    numberOfErrors += FullTracerConversionTest(fr);
+    TimerStopAndLog(UNIT_TEST_FULL_TRACER_CONVERSION);
+
     TimerStart(UNIT_TEST_DATABASE_CACHE);
     numberOfErrors += DatabaseCacheTest();
     TimerStopAndLog(UNIT_TEST_DATABASE_CACHE);
@@ -0,0 +1,162 @@
+#include <unordered_map>
+#include <array>
+#include <sys/time.h>
+#include "flat_hash_map_test.hpp"
+#include "flat_hash_map.hpp"
+#include "timer.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
+
+using namespace std;
+
+// Shape of a large batch: memory accesses to a set of addresses, repeated over several requests
+#define FLAT_HASH_MAP_TEST_REQUESTS 8
+#define FLAT_HASH_MAP_TEST_ADDRESSES (1<<20)
+#define FLAT_HASH_MAP_TEST_READS_PER_ADDRESS 4
+
+typedef array<uint64_t, 8> TestFea; // Same size as the main executor memory values
+
+// Allocator that counts the allocations of the std maps
+static uint64_t testAllocations = 0;
+
+template <typename T>
+class CountingAllocator
+{
+public:
+    typedef T value_type;
+    CountingAllocator () {};
+    template <typename U> CountingAllocator (const CountingAllocator<U> &) {};
+    T * allocate (size_t n) { testAllocations++; return std::allocator<T>().allocate(n); };
+    void deallocate (T * p, size_t n) { std::allocator<T>().deallocate(p, n); };
+    template <typename U> bool operator== (const CountingAllocator<U> &) const { return true; };
+    template <typename U> bool operator!= (const CountingAllocator<U> &) const { return false; };
+};
+
+typedef unordered_map<uint64_t, TestFea, hash<uint64_t>, equal_to<uint64_t>, CountingAllocator<pair<const uint64_t, TestFea>>> TestStdMap;
+typedef FlatHashMap<uint64_t, TestFea, FlatHashU64> TestFlatMap;
+
+// Memory addresses are clustered as in the ROM: contexts of 0x40000 slots, mostly accessed at their beginning
+static inline uint64_t testAddress (uint64_t i)
+{
+    return (i % 64)*0x40000 + (i / 64);
+}
+
+// Runs the access pattern of one request; returns a checksum of the read values
+template <typename M>
+static uint64_t FlatHashMapTestRequest (M &m, uint64_t request)
+{
+    uint64_t checksum = 0;
+    for (uint64_t i=0; i<FLAT_HASH_MAP_TEST_ADDRESSES; i++)
+    {
+        TestFea &fea = m[testAddress(i)];
+        fea[0] = i + request;
+        fea[7] = i;
+        for (uint64_t r=1; r<=FLAT_HASH_MAP_TEST_READS_PER_ADDRESS; r++)
+        {
+            typename M::iterator it = m.find(testAddress((i*r*7919) % (i + 1)));
+            if (it != m.end())
+            {
+                checksum += it->second[0];
+            }
+        }
+    }
+    return checksum;
+}
+
+// Compares the results of the flat map with the std map after inserts and erases
+static uint64_t FlatHashMapTestCorrectness (void)
+{
+    uint64_t numberOfFailed = 0;
+    TestStdMap stdMap;
+    TestFlatMap flatMap;
+    for (uint64_t i=0; i<100000; i++)
+    {
+        uint64_t key = testAddress(i*13 % 70001);
+        if (i % 3 == 2)
+        {
+            bool bStd = (stdMap.erase(key) > 0);
+            bool bFlat = flatMap.erase(key);
+            if (bStd != bFlat) numberOfFailed++;
+        }
+        else
+        {
+            stdMap[key][0] = i;
+            flatMap[key][0] = i;
+        }
+    }
+    if (stdMap.size() != flatMap.size())
+    {
+        zklog.error("FlatHashMapTestCorrectness() got stdMap.size()=" + to_string(stdMap.size()) + " != flatMap.size()=" + to_string(flatMap.size()));
+        numberOfFailed++;
+    }
+    for (TestStdMap::iterator it = stdMap.begin(); it != stdMap.end(); it++)
+    {
+        TestFea * pFea = flatMap.findValue(it->first);
+        if ((pFea == NULL) || ((*pFea)[0] != it->second[0]))
+        {
+            zklog.error("FlatHashMapTestCorrectness() got a different value for key=" + to_string(it->first));
+            numberOfFailed++;
+        }
+    }
+    uint64_t n = 0;
+    for (TestFlatMap::iterator it = flatMap.begin(); it != flatMap.end(); it++) n++;
+    if (n != flatMap.size())
+    {
+        zklog.error("FlatHashMapTestCorrectness() iterated n=" + to_string(n) + " != flatMap.size()=" + to_string(flatMap.size()));
+        numberOfFailed++;
+    }
+    return numberOfFailed;
+}
+
+uint64_t FlatHashMapTest (void)
+{
+    TimerStart(FLAT_HASH_MAP_TEST);
+
+    uint64_t numberOfFailed = FlatHashMapTestCorrectness();
+
+    uint64_t operations = uint64_t(FLAT_HASH_MAP_TEST_REQUESTS)*FLAT_HASH_MAP_TEST_ADDRESSES*(1 + FLAT_HASH_MAP_TEST_READS_PER_ADDRESS);
+    struct timeval t;
+
+    // Before: a new std map per request, as the context used to do
+    testAllocations = 0;
+    uint64_t stdChecksum = 0;
+    gettimeofday(&t, NULL);
+    for (uint64_t request=0; request<FLAT_HASH_MAP_TEST_REQUESTS; request++)
+    {
+        TestStdMap m;
+        stdChecksum += FlatHashMapTestRequest(m, request);
+    }
+    uint64_t stdTime = TimeDiff(t);
+    uint64_t stdAllocations = testAllocations;
+
+    // After: one flat map cleared between requests, as the context arena does
+    uint64_t flatChecksum = 0;
+    TestFlatMap flatMap;
+    gettimeofday(&t, NULL);
+    for (uint64_t request=0; request<FLAT_HASH_MAP_TEST_REQUESTS; request++)
+    {
+        flatChecksum += FlatHashMapTestRequest(flatMap, request);
+        flatMap.clear();
+    }
+    uint64_t flatTime = TimeDiff(t);
+
+    if (stdChecksum != flatChecksum)
+    {
+        zklog.error("FlatHashMapTest() got stdChecksum=" + to_string(stdChecksum) + " != flatChecksum=" + to_string(flatChecksum));
+        numberOfFailed++;
+    }
+
+    zklog.info("FlatHashMapTest() requests=" + to_string(FLAT_HASH_MAP_TEST_REQUESTS) + " addresses=" + to_string(FLAT_HASH_MAP_TEST_ADDRESSES) + " operations=" + to_string(operations));
+    zklog.info("FlatHashMapTest() unordered_map: allocations=" + to_string(stdAllocations) + " time=" + to_string(double(stdTime)/1000) + "ms ns/op=" + to_string(double(stdTime)*1000/operations));
+    // Every table allocation allocates the slots and the control bytes
+    zklog.info("FlatHashMapTest() FlatHashMap with reuse: allocations=" + to_string(2*flatMap.getAllocations()) + " time=" + to_string(double(flatTime)/1000) + "ms ns/op=" + to_string(double(flatTime)*1000/operations) + " speedup=" + to_string(double(stdTime)/double(zkmax(flatTime, 1))));
+
+    if (numberOfFailed != 0)
+    {
+        zklog.error("FlatHashMapTest() failed numberOfFailed=" + to_string(numberOfFailed));
+    }
+
+    TimerStopAndLog(FLAT_HASH_MAP_TEST);
+
+    return numberOfFailed;
+}
@@ -0,0 +1,8 @@
+#ifndef FLAT_HASH_MAP_TEST_HPP
+#define FLAT_HASH_MAP_TEST_HPP
+
+#include <cstdint>
+
+uint64_t FlatHashMapTest (void);
+
+#endif
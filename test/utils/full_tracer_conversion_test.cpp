@@ -0,0 +1,118 @@
+#include <vector>
+#include <sys/time.h>
+#include "full_tracer_conversion_test.hpp"
+#include "scalar.hpp"
+#include "timer.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
+
+using namespace std;
+
+// Number of 32-bytes memory slots converted, e.g. a contract memory of 32KB dumped in 1000 opcodes
+#define FULL_TRACER_CONVERSION_TEST_SLOTS (1000*1024)
+
+/*
+    Compares the conversion of the full tracer memory snapshots and state roots from field elements to
+    bytes, as it used to be done (fea -> scalar -> hex string -> bytes) and as it is done now (fea ->
+    bytes), checking that both produce the same bytes and logging the time of both
+*/
+uint64_t FullTracerConversionTest (Goldilocks &fr)
+{
+    TimerStart(FULL_TRACER_CONVERSION_TEST);
+
+    uint64_t numberOfFailed = 0;
+
+    // Build the memory slots, including zero and maximum values
+    vector<Goldilocks::Element> slots(FULL_TRACER_CONVERSION_TEST_SLOTS*8);
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (uint64_t i=0; i<FULL_TRACER_CONVERSION_TEST_SLOTS*8; i++)
+    {
+        seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+        uint64_t value = seed >> 32;
+        if ((i/8) % 97 == 0) value = 0;
+        if ((i/8) % 89 == 0) value = 0xFFFFFFFF;
+        if ((i/8) % 7 == 0) value &= 0xFF; // Small values, i.e. hex strings that need zeros prepended
+        fr.fromU64(slots[i], value);
+    }
+
+    struct timeval t;
+
+    // Before: fea -> scalar -> 64 chars hex string -> bytes
+    gettimeofday(&t, NULL);
+    mpz_class auxScalar;
+    string hexMemory;
+    for (uint64_t i=0; i<FULL_TRACER_CONVERSION_TEST_SLOTS; i++)
+    {
+        Goldilocks::Element * fea = &slots[i*8];
+        if (!fea2scalar(fr, auxScalar, fea[0], fea[1], fea[2], fea[3], fea[4], fea[5], fea[6], fea[7]))
+        {
+            zklog.error("FullTracerConversionTest() failed calling fea2scalar() i=" + to_string(i));
+            numberOfFailed++;
+        }
+        hexMemory += PrependZeros(auxScalar.get_str(16), 64);
+    }
+    string oldMemory = string2ba(hexMemory);
+    uint64_t oldTime = TimeDiff(t);
+
+    // After: fea -> bytes
+    gettimeofday(&t, NULL);
+    string newMemory;
+    newMemory.assign(FULL_TRACER_CONVERSION_TEST_SLOTS*32, 0);
+    for (uint64_t i=0; i<FULL_TRACER_CONVERSION_TEST_SLOTS; i++)
+    {
+        Goldilocks::Element * fea = &slots[i*8];
+        if (!fea2ba(fr, (uint8_t *)&newMemory[i*32], fea[0], fea[1], fea[2], fea[3], fea[4], fea[5], fea[6], fea[7]))
+        {
+            zklog.error("FullTracerConversionTest() failed calling fea2ba() i=" + to_string(i));
+            numberOfFailed++;
+        }
+    }
+    uint64_t newTime = TimeDiff(t);
+
+    if (oldMemory != newMemory)
+    {
+        zklog.error("FullTracerConversionTest() got different memory bytes oldMemory.size()=" + to_string(oldMemory.size()) + " newMemory.size()=" + to_string(newMemory.size()));
+        numberOfFailed++;
+    }
+
+    // State roots: the old format was a 0x-prefixed hex string, that the executor service converted to bytes
+    for (uint64_t i=0; i<1000; i++)
+    {
+        Goldilocks::Element * fea = &slots[i*8];
+        fea2scalar(fr, auxScalar, fea[0], fea[1], fea[2], fea[3], fea[4], fea[5], fea[6], fea[7]);
+        string oldStateRoot = string2ba(NormalizeTo0xNFormat(auxScalar.get_str(16), 64));
+        string newStateRoot;
+        newStateRoot.resize(32);
+        fea2ba(fr, (uint8_t *)&newStateRoot[0], fea[0], fea[1], fea[2], fea[3], fea[4], fea[5], fea[6], fea[7]);
+        if ((oldStateRoot != newStateRoot) || (scalar2ba32(auxScalar) != newStateRoot))
+        {
+            zklog.error("FullTracerConversionTest() got different state root bytes i=" + to_string(i) + " stateRoot=" + auxScalar.get_str(16));
+            numberOfFailed++;
+        }
+    }
+
+    // A value that does not fit in 32 bits must be rejected
+    Goldilocks::Element tooHigh[8];
+    for (uint64_t i=0; i<8; i++) tooHigh[i] = fr.zero();
+    fr.fromU64(tooHigh[3], 0x100000000);
+    uint8_t bytes[32];
+    if (fea2ba(fr, bytes, tooHigh[0], tooHigh[1], tooHigh[2], tooHigh[3], tooHigh[4], tooHigh[5], tooHigh[6], tooHigh[7]))
+    {
+        zklog.error("FullTracerConversionTest() fea2ba() accepted an element of more than 32 bits");
+        numberOfFailed++;
+    }
+
+    zklog.info("FullTracerConversionTest() slots=" + to_string(FULL_TRACER_CONVERSION_TEST_SLOTS) +
+        " fea->scalar->hex->bytes time=" + to_string(double(oldTime)/1000) + "ms ns/slot=" + to_string(double(oldTime)*1000/FULL_TRACER_CONVERSION_TEST_SLOTS) +
+        " fea->bytes time=" + to_string(double(newTime)/1000) + "ms ns/slot=" + to_string(double(newTime)*1000/FULL_TRACER_CONVERSION_TEST_SLOTS) +
+        " speedup=" + to_string(double(oldTime)/double(zkmax(newTime, 1))));
+
+    if (numberOfFailed != 0)
+    {
+        zklog.error("FullTracerConversionTest() failed numberOfFailed=" + to_string(numberOfFailed));
+    }
+
+    TimerStopAndLog(FULL_TRACER_CONVERSION_TEST);
+
+    return numberOfFailed;
+}
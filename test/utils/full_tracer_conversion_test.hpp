@@ -0,0 +1,9 @@
+#ifndef FULL_TRACER_CONVERSION_TEST_HPP
+#define FULL_TRACER_CONVERSION_TEST_HPP
+
+#include <cstdint>
+#include "goldilocks_base_field.hpp"
+
+uint64_t FullTracerConversionTest (Goldilocks &fr);
+
+#endif
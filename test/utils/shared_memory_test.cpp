@@ -0,0 +1,144 @@
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "shared_memory_test.hpp"
+#include "shared_memory.hpp"
+#include "timer.hpp"
+#include "zklog.hpp"
+
+#define SHARED_MEMORY_TEST_DATA_SIZE (4*1024*1024)
+#define SHARED_MEMORY_TEST_TIMEOUT 60 // Seconds
+
+// Forks a process that creates the segment as its loader and tells the parent through a pipe; then the child
+// fills the data and sets it ready after a delay, or exits without doing it if bLoaderDies
+pid_t SharedMemoryTestForkLoader (const string &name, const uint64_t (&signature)[SHARED_MEMORY_SIGNATURE_SIZE], bool bLoaderDies)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        zklog.error("SharedMemoryTestForkLoader() failed calling pipe()");
+        return -1;
+    }
+
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        close(fds[0]);
+        SharedMemorySegment segment(name, "", SHARED_MEMORY_TEST_DATA_SIZE, signature);
+        char c = segment.isLoader() ? 1 : 0;
+        if (write(fds[1], &c, 1) != 1) _exit(1);
+        close(fds[1]);
+        if (!segment.isLoader()) _exit(1);
+        if (bLoaderDies) _exit(0);
+        usleep(500000);
+        uint64_t * pData = (uint64_t *)segment.getData();
+        for (uint64_t i=0; i<SHARED_MEMORY_TEST_DATA_SIZE/8; i++)
+        {
+            pData[i] = i;
+        }
+        segment.setReady();
+        _exit(0);
+    }
+
+    // Wait until the child is the loader of the segment
+    close(fds[1]);
+    char c = 0;
+    if ((pid < 0) || (read(fds[0], &c, 1) != 1) || (c != 1))
+    {
+        zklog.error("SharedMemoryTestForkLoader() failed creating the loader process of segment " + name);
+        pid = -1;
+    }
+    close(fds[0]);
+    return pid;
+}
+
+uint64_t SharedMemoryTest (void)
+{
+    TimerStart(SHARED_MEMORY_TEST);
+
+    uint64_t numberOfFailedTests = 0;
+    uint64_t signature[SHARED_MEMORY_SIGNATURE_SIZE] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    int status;
+
+    // A process attaches to a segment while another one is loading it, and waits until it is ready
+    {
+        string name = "zkprover_test_" + to_string(getpid()) + "_ready";
+        pid_t loaderPid = SharedMemoryTestForkLoader(name, signature, false);
+        if (loaderPid < 0)
+        {
+            numberOfFailedTests++;
+        }
+        else
+        {
+            {
+                SharedMemorySegment segment(name, "", SHARED_MEMORY_TEST_DATA_SIZE, signature);
+                if (segment.isLoader())
+                {
+                    zklog.error("SharedMemoryTest() became the loader of segment " + name + " created by pid=" + to_string(loaderPid));
+                    numberOfFailedTests++;
+                }
+                else
+                {
+                    segment.waitReady(SHARED_MEMORY_TEST_TIMEOUT);
+                    uint64_t * pData = (uint64_t *)segment.getData();
+                    for (uint64_t i=0; i<SHARED_MEMORY_TEST_DATA_SIZE/8; i++)
+                    {
+                        if (pData[i] != i)
+                        {
+                            zklog.error("SharedMemoryTest() found data mismatch in segment " + name + " at i=" + to_string(i) + " data=" + to_string(pData[i]));
+                            numberOfFailedTests++;
+                            break;
+                        }
+                    }
+                }
+            }
+            if ((waitpid(loaderPid, &status, 0) != loaderPid) || !WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+            {
+                zklog.error("SharedMemoryTest() loader process of segment " + name + " failed");
+                numberOfFailedTests++;
+            }
+        }
+        shm_unlink(("/" + name).c_str());
+    }
+
+    // A process waiting for a segment whose loader died must fail, without waiting for the timeout
+    {
+        string name = "zkprover_test_" + to_string(getpid()) + "_died";
+        pid_t loaderPid = SharedMemoryTestForkLoader(name, signature, true);
+        if (loaderPid < 0)
+        {
+            numberOfFailedTests++;
+        }
+        else
+        {
+            waitpid(loaderPid, &status, 0);
+
+            // waitReady() exits the process when it detects the dead loader, so it is called in a child process
+            struct timeval t;
+            gettimeofday(&t, NULL);
+            pid_t waiterPid = fork();
+            if (waiterPid == 0)
+            {
+                SharedMemorySegment segment(name, "", SHARED_MEMORY_TEST_DATA_SIZE, signature);
+                segment.waitReady(SHARED_MEMORY_TEST_TIMEOUT);
+                _exit(0);
+            }
+            if ((waiterPid < 0) || (waitpid(waiterPid, &status, 0) != waiterPid) || (WIFEXITED(status) && (WEXITSTATUS(status) == 0)))
+            {
+                zklog.error("SharedMemoryTest() did not detect the dead loader of segment " + name);
+                numberOfFailedTests++;
+            }
+            else if (TimeDiff(t) >= SHARED_MEMORY_TEST_TIMEOUT*1000000)
+            {
+                zklog.error("SharedMemoryTest() detected the dead loader of segment " + name + " only after the timeout");
+                numberOfFailedTests++;
+            }
+        }
+        shm_unlink(("/" + name).c_str());
+    }
+
+    zklog.info("SharedMemoryTest() done, numberOfFailedTests=" + to_string(numberOfFailedTests));
+
+    TimerStopAndLog(SHARED_MEMORY_TEST);
+    return numberOfFailedTests;
+}
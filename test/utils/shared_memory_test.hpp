@@ -0,0 +1,8 @@
+#ifndef SHARED_MEMORY_TEST_HPP
+#define SHARED_MEMORY_TEST_HPP
+
+#include <cstdint>
+
+uint64_t SharedMemoryTest (void);
+
+#endif